@@ -87,17 +87,29 @@
 
 #define NDEF_CC_BUF_LEN             17U                                                /*!< CC buffer len. Max len = 17 in case of T4T v3                */
 #define NDEF_NFCV_SUPPORTED_CMD_LEN  4U                                                /*!< Ext sys info supported commands list len                     */
+#define NDEF_T4T_AID_MAX_LEN        16U                                                /*!< Max AID len (ISO 7816-4 5.3.1.3)                             */
 
 #define NDEF_SHORT_VFIELD_MAX_LEN  254U                                                /*!< Max V-field length for 1-byte Lengh encoding                 */
 #define NDEF_TERMINATOR_TLV_LEN      1U                                                /*!< Terminator TLV size                                          */
 #define NDEF_TERMINATOR_TLV_T     0xFEU                                                /*!< Terminator TLV T=FEh                                         */
 
+#define NDEF_T1T_SEGMENT_SIZE      128U                                                /*!< Size of a T1T segment i.e. RSEG response and RALL data       */
+#define NDEF_T1T_MAX_RSVD_AREAS      4U                                                /*!< Max lock/reserved areas: fixed one + Lock/Memory Control TLVs */
+
 #define NDEF_T2T_READ_RESP_SIZE     16U                                                /*!< Size of the READ response i.e. four blocks                   */
 
+#ifndef NDEF_T2T_CACHE_SIZE
+#define NDEF_T2T_CACHE_SIZE        512U                                                /*!< T2T memory mirrored in RAM from block 0 (multiple of 16), may be set on platform.h. Default keeps the T2T context within the T3T one; 1024U covers a whole sector e.g. NTAG216 */
+#endif /* NDEF_T2T_CACHE_SIZE */
+#define NDEF_T2T_CACHE_BLOCKS     (NDEF_T2T_CACHE_SIZE / 4U)                           /*!< Number of T2T blocks mirrored in RAM                         */
+#define NDEF_T2T_CACHE_MAP_LEN    ((NDEF_T2T_CACHE_BLOCKS + 7U) / 8U)                  /*!< Size of the per block cache bitmaps                          */
+
 #define NDEF_T3T_BLOCK_SIZE         16U                                                /*!< size for a block in t3t                                      */
-#define NDEF_T3T_MAX_NB_BLOCKS       4U                                                /*!< size for a block in t3t                                      */
-#define NDEF_T3T_MAX_RX_SIZE      ((NDEF_T3T_BLOCK_SIZE*NDEF_T3T_MAX_NB_BLOCKS) + 16U) /*!< size for receive 4 blocks of 16 + UID + HEADER + CHECKSUM    */
-#define NDEF_T3T_MAX_TX_SIZE      ((NDEF_T3T_BLOCK_SIZE*NDEF_T3T_MAX_NB_BLOCKS) + 16U) /*!< size for send Check 4 blocks of 16 + UID + HEADER + CHECKSUM */
+#ifndef NDEF_T3T_MAX_NB_BLOCKS
+#define NDEF_T3T_MAX_NB_BLOCKS      15U                                                /*!< Max nb of blocks per CHECK/UPDATE, further limited by Nbr/Nbw */
+#endif /* NDEF_T3T_MAX_NB_BLOCKS */
+#define NDEF_T3T_MAX_RX_SIZE      ((NDEF_T3T_BLOCK_SIZE*NDEF_T3T_MAX_NB_BLOCKS) + 16U) /*!< size for receive max blocks of 16 + UID + HEADER + CHECKSUM  */
+#define NDEF_T3T_MAX_TX_SIZE      ((NDEF_T3T_BLOCK_SIZE*NDEF_T3T_MAX_NB_BLOCKS) + 16U) /*!< size for send max blocks of 16 + UID + HEADER + CHECKSUM     */
 
 #define NDEF_T5T_TxRx_BUFF_HEADER_SIZE        1U                                       /*!< Request Flags/Responses Flags size                           */
 #define NDEF_T5T_TxRx_BUFF_FOOTER_SIZE        2U                                       /*!< CRC size                                                     */
@@ -238,17 +250,33 @@ typedef union {
     ndefCapabilityContainerT5T   t5t;                          /*!< T5T Capability Container                           */
 } ndefCapabilityContainer;
 
+/*! T1T memory area not part of the NDEF data area (lock or reserved bytes) */
+typedef struct {
+    uint16_t                    addr;                              /*!< First byte address of the area                 */
+    uint16_t                    len;                               /*!< Area length in bytes                           */
+} ndefT1TRsvdArea;
+
 /*! NDEF T1T sub context structure */
 typedef struct {
-    void * rfu;                                                /*!< RFU                                                */
+    uint8_t                     memBuf[NDEF_T1T_SEGMENT_SIZE];     /*!< Tag memory of the cached segment               */
+    uint8_t                     memSegNo;                          /*!< Cached segment number                          */
+    bool                        memValid;                          /*!< memBuf holds the tag content                   */
+    bool                        dynamicMem;                        /*!< Dynamic memory: RSEG/READ8/WRITE-E8 supported  */
+    uint16_t                    memSize;                           /*!< Tag memory size in bytes                       */
+    uint32_t                    offsetNdefTLV;                     /*!< NDEF TLV message offset                        */
+    uint8_t                     nbRsvdAreas;                       /*!< Number of lock/reserved areas                  */
+    ndefT1TRsvdArea             rsvdAreas[NDEF_T1T_MAX_RSVD_AREAS];/*!< Lock/reserved areas, sorted and disjoint       */
 } ndefT1TContext;
 
 /*! NDEF T2T sub context structure */
 typedef struct {
     uint8_t                     currentSecNo;                      /*!< Current sector number                          */
-    uint8_t                     cacheBuf[NDEF_T2T_READ_RESP_SIZE]; /*!< Cache buffer                                   */
-    uint32_t                    cacheAddr;                         /*!< Address of cached data                         */
+    uint8_t                     cacheBuf[NDEF_T2T_CACHE_SIZE];     /*!< Tag memory mirror, indexed by byte address     */
+    uint8_t                     cacheValid[NDEF_T2T_CACHE_MAP_LEN];/*!< Blocks holding the tag content (1 bit/block)   */
+    uint8_t                     cacheDirty[NDEF_T2T_CACHE_MAP_LEN];/*!< Blocks pending write back (1 bit/block)        */
     uint32_t                    offsetNdefTLV;                     /*!< NDEF TLV message offset                        */
+    bool                        versionChecked;                    /*!< GET_VERSION already attempted                  */
+    bool                        fastReadSupported;                 /*!< FAST_READ supported flag                       */
 } ndefT2TContext;
 
 /*! NDEF T3T sub context structure */
@@ -260,14 +288,17 @@ typedef struct {
 
 /*! NDEF T4T sub context structure */
 typedef struct {
-    uint8_t                      curMLe;                       /*!< Current MLe. Default Fh until CC file is read      */
-    uint8_t                      curMLc;                       /*!< Current MLc. Default Dh until CC file is read      */
+    uint16_t                     curMLe;                       /*!< Current MLe. Default Fh until CC file is read      */
+    uint16_t                     curMLc;                       /*!< Current MLc. Default Dh until CC file is read      */
     bool                         mv1Flag;                      /*!< Mapping version 1 flag                             */
     rfalIsoDepApduBufFormat      cApduBuf;                     /*!< Command-APDU buffer                                */
     rfalIsoDepApduBufFormat      rApduBuf;                     /*!< Response-APDU buffer                               */
     rfalT4tRApduParam            respAPDU;                     /*!< Response-APDU params                               */
-    rfalIsoDepBufFormat          tmpBuf;                       /*!< I-Block temporary buffer                           */
     uint16_t                     rApduBodyLen;                 /*!< Response Body Len                                  */
+    uint8_t                      selAid[NDEF_T4T_AID_MAX_LEN]; /*!< Select cache: currently selected application       */
+    uint8_t                      selAidLen;                    /*!< Select cache: selAid length, 0 if unknown          */
+    uint8_t                      selFid[2];                    /*!< Select cache: currently selected file              */
+    bool                         selFidValid;                  /*!< Select cache: selFid is valid                      */
 } ndefT4TContext;
 
 /*! NDEF T5T sub context structure */
@@ -278,6 +309,9 @@ typedef struct {
     ndefSystemInformation        sysInfo;                      /*!< System Information (when supported)                */
     bool                         sysInfoSupported;             /*!< System Information Supported flag                  */
     bool                         legacySTHighDensity;          /*!< Legacy ST High Density flag                        */
+    uint8_t                      maxReadBlocks;                /*!< Max blocks per (Extended) READ_MULTIPLE_BLOCKS     */
+    uint8_t                      maxWriteBlocks;               /*!< Max blocks per (Extended) WRITE_MULTIPLE_BLOCKS    */
+    bool                         extWriteMultiple;             /*!< Extended WRITE_MULTIPLE_BLOCKS supported           */
     uint8_t                      txrxBuf[NDEF_T5T_TxRx_BUFF_SIZE];  /*!< Tx Rx Buffer                                  */
 } ndefT5TContext;
 
@@ -294,7 +328,9 @@ typedef struct {
                                  ndefPollWrapper;              /*!< pointer to array of function for wrapper           */
     union {
         ndefT1TContext t1t;                                    /*!< T1T context                                        */
+#if RFAL_FEATURE_T2T
         ndefT2TContext t2t;                                    /*!< T2T context                                        */
+#endif
         ndefT3TContext t3t;                                    /*!< T3T context                                        */
 #if RFAL_FEATURE_T4T
         ndefT4TContext t4t;                                    /*!< T4T context                                        */
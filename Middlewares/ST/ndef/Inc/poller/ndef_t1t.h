@@ -0,0 +1,341 @@
+/******************************************************************************
+  * \attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2019 STMicroelectronics</center></h2>
+  *
+  * Licensed under ST MYLIBERTY SOFTWARE LICENSE AGREEMENT (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        www.st.com/myliberty
+  *
+  * Unless required by applicable law or agreed to in writing, software 
+  * distributed under the License is distributed on an "AS IS" BASIS, 
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied,
+  * AND SPECIFICALLY DISCLAIMING THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+******************************************************************************/
+
+/*
+ *      PROJECT:   NDEF firmware
+ *      Revision:
+ *      LANGUAGE:  ISO C99
+ */
+
+/*! \file 
+ *
+ *  \author 
+ *
+ *  \brief Provides NDEF methods and definitions to access NFC Forum T1T
+ *  
+ *  NDEF T1T provides several functionalities required to 
+ *  perform NDEF message management with T1T tags.
+ *  
+ *  The most common interfaces are
+ *    <br>&nbsp; ndefT1TPollerContextInitialization()
+ *    <br>&nbsp; ndefT1TPollerNdefDetect()
+ *    <br>&nbsp; ndefT1TPollerReadRawMessage()
+ *    <br>&nbsp; ndefT1TPollerWriteRawMessage()
+ *    <br>&nbsp; ndefT1TPollerTagFormat()
+ *  
+ *  
+ * \addtogroup NDEF
+ * @{
+ *  
+ */
+
+
+#ifndef NDEF_T1T_H
+#define NDEF_T1T_H
+
+/*
+ ******************************************************************************
+ * INCLUDES
+ ******************************************************************************
+ */
+#include "platform.h"
+#include "st_errno.h"
+#include "rfal_nfca.h"
+#include "rfal_t1t.h"
+
+/*
+ ******************************************************************************
+ * GLOBAL DEFINES
+ ******************************************************************************
+ */
+
+
+/*
+ ******************************************************************************
+ * GLOBAL MACROS
+ ******************************************************************************
+ */
+
+ /*
+ ******************************************************************************
+ * GLOBAL TYPES
+ ******************************************************************************
+ */
+
+
+/*
+ ******************************************************************************
+ * GLOBAL FUNCTION PROTOTYPES
+ ******************************************************************************
+ */
+
+/*!
+ *****************************************************************************
+ * \brief Handle T1T NDEF context activation
+ *  
+ * This method performs the initialization of the NDEF context and handles 
+ * the retrieval of the tag memory model from HR0. It must be called after a successful 
+ * anti-collision procedure and prior to any NDEF procedures such as NDEF 
+ * detection procedure.
+ *
+ * \param[in]   ctx    : ndef Context
+ * \param[in]   dev    : ndef Device
+ *
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_PROTO        : Protocol error
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode ndefT1TPollerContextInitialization(ndefContext *ctx, const rfalNfcDevice *dev);
+
+
+/*!
+ *****************************************************************************
+ * \brief T1T NDEF Detection procedure
+ *  
+ * This method performs the T1T NDEF Detection procedure
+ *
+ *
+ * \param[in]   ctx    : ndef Context
+ * \param[out]  info   : ndef Information (optional parameter, NULL may be used when no NDEF Information is needed)
+ * 
+ * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+ * \return ERR_REQUEST      : Detection failed (application or ccfile not found)
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_PROTO        : Protocol error
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode ndefT1TPollerNdefDetect(ndefContext *ctx, ndefInfo *info);
+
+
+/*!
+ *****************************************************************************
+ * \brief T1T Read data from tag memory
+ *  
+ * This method reads arbitrary length data from the tag memory. 
+ * Offsets are byte addresses in the tag memory with the lock and reserved 
+ * areas skipped i.e. they match the physical addresses up to 67h.
+ * Dynamic memory tags are read by segments (RSEG), static ones with RALL.
+ *
+ * \param[in]   ctx    : ndef Context
+ * \param[in]   len    : requested len 
+ * \param[in]   offset : memory offset of where to start reading data
+ * \param[out]  buf    : buffer to place the data read from the tag
+ * \param[out]  rcvdLen: received length
+ * 
+ * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+ * \return ERR_REQUEST      : read failed
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_PROTO        : Protocol error
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode ndefT1TPollerReadBytes(ndefContext *ctx, uint32_t offset, uint32_t len, uint8_t *buf, uint32_t *rcvdLen);
+
+
+/*!
+ *****************************************************************************
+ * \brief T1T write data to tag memory
+ *  
+ * This method writes arbitrary length data to the tag memory, lock and 
+ * reserved areas being skipped as for ndefT1TPollerReadBytes().
+ * Dynamic memory tags are written by blocks (WRITE-E8), static ones by 
+ * bytes (WRITE-E). Bytes already holding the requested value are not written.
+ *
+ * \param[in]   ctx    : ndef Context
+ * \param[in]   offset : memory offset of where to start writing data
+ * \param[in]   buf    : data to write
+ * \param[in]   len    : buf len 
+ * 
+ * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+ * \return ERR_REQUEST      : read failed
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_PROTO        : Protocol error
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode ndefT1TPollerWriteBytes(ndefContext *ctx, uint32_t offset, const uint8_t *buf, uint32_t len);
+
+
+/*!
+ *****************************************************************************
+ * \brief T1T Read raw NDEF message
+ *  
+ * This method reads a raw NDEF message.
+ * Prior to NDEF Read procedure, a successful ndefT1TPollerNdefDetect() 
+ * has to be performed.
+ * 
+ * \param[in]   ctx    : ndef Context
+ * \param[out]  buf    : buffer to place the NDEF message
+ * \param[in]   bufLen : buffer length
+ * \param[out]  rcvdLen: received length
+ * 
+ * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+ * \return ERR_REQUEST      : read failed
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_PROTO        : Protocol error
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode ndefT1TPollerReadRawMessage(ndefContext *ctx, uint8_t *buf, uint32_t bufLen, uint32_t *rcvdLen);
+
+
+/*!
+ *****************************************************************************
+ * \brief T1T Write raw NDEF message
+ *  
+ * This method writes a raw NDEF message.
+ * Prior to NDEF Write procedure, a successful ndefT1TPollerNdefDetect() 
+ * has to be performed.
+ * 
+ * \param[in]   ctx    : ndef Context
+ * \param[in]   buf    : raw message buffer
+ * \param[in]   bufLen : buffer length
+ * 
+ * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+ * \return ERR_REQUEST      : write failed
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_PROTO        : Protocol error
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode ndefT1TPollerWriteRawMessage(ndefContext *ctx, const uint8_t *buf, uint32_t bufLen);
+
+
+/*!
+ *****************************************************************************
+ * \brief T1T Write NDEF message length
+ *  
+ * This method writes the L field of the NDEF Message TLV.
+ *
+ * \param[in]   ctx          : ndef Context
+ * \param[in]   rawMessageLen: len
+ * 
+ * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+ * \return ERR_REQUEST      : write failed
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_PROTO        : Protocol error
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode ndefT1TPollerWriteRawMessageLen(ndefContext *ctx, uint32_t rawMessageLen);
+ 
+ 
+/*!
+ *****************************************************************************
+ * \brief T1T Format Tag
+ *  
+ * This method formats a tag to make it ready for NDEF storage. 
+ * The Capability Container block is written only for virgin tags.
+ * If the cc parameter is not provided (i.e. NULL), a default one is used 
+ * with the memory size of the tag (TMS = 0Eh static, 3Fh dynamic).
+ * Beware that formatting is on most tags a one time operation (OTP bits!!!!)
+ * Doing a wrong format may render your tag unusable.
+ * options parameter is not used for T1T Tag Format method
+ *
+ * \param[in]   ctx    : ndef Context
+ * \param[in]   cc     : Capability Container
+ * \param[in]   options: specific flags
+ * 
+ * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+ * \return ERR_REQUEST      : write failed
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_PROTO        : Protocol error
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode ndefT1TPollerTagFormat(ndefContext *ctx, const ndefCapabilityContainer *cc, uint32_t options);
+
+
+/*!
+ *****************************************************************************
+ * \brief T1T Check Presence
+ *  
+ * This method checks whether a T1T tag is still present in the operating field
+ *
+ * \param[in]   ctx    : ndef Context
+ * 
+ * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_PROTO        : Protocol error
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode ndefT1TPollerCheckPresence(ndefContext *ctx);
+
+
+/*!
+ *****************************************************************************
+ * \brief T1T Check Available Space
+ *  
+ * This method checks whether a T1T tag has enough space to write a message of a given length
+ *
+ * \param[in]   ctx       : ndef Context
+ * \param[in]   messageLen: message length
+ * 
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_NOMEM        : not enough space
+ * \return ERR_NONE         : Enough space for message of messageLen length
+ *****************************************************************************
+ */
+ReturnCode ndefT1TPollerCheckAvailableSpace(const ndefContext *ctx, uint32_t messageLen);
+
+
+/*!
+ *****************************************************************************
+ * \brief T1T Begin Write Message
+ *  
+ * This method sets the L-field to 0 and sets the message offset to the proper value according to messageLen
+ *
+ * \param[in]   ctx       : ndef Context
+ * \param[in]   messageLen: message length
+ * 
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_NOMEM        : not enough space
+ * \return ERR_NONE         : Enough space for message of messageLen length
+ *****************************************************************************
+ */
+ReturnCode ndefT1TPollerBeginWriteMessage(ndefContext *ctx, uint32_t messageLen);
+
+
+/*!
+ *****************************************************************************
+ * \brief T1T End Write Message
+ *  
+ * This method updates the L-field value after the message has been written
+ *
+ * \param[in]   ctx       : ndef Context
+ * \param[in]   messageLen: message length
+ * 
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_NOMEM        : not enough space
+ * \return ERR_NONE         : Enough space for message of messageLen length
+ *****************************************************************************
+ */
+ReturnCode ndefT1TPollerEndWriteMessage(ndefContext *ctx, uint32_t messageLen);
+
+
+#endif /* NDEF_T1T_H */
+
+/**
+  * @}
+  */
@@ -40,6 +40,7 @@
  *    <br>&nbsp; ndefT4TPollerReadRawMessage()
  *    <br>&nbsp; ndefT4TPollerWriteRawMessage()
  *    <br>&nbsp; ndefT4TPollerTagFormat()
+ *    <br>&nbsp; ndefT4TPollerRunScript()
  *  
  *  
  * \addtogroup NDEF
@@ -97,6 +98,17 @@
  ******************************************************************************
  */
 
+/*! T4T APDU script command: a precompiled C-APDU, its expected status word and result sink */
+typedef struct {
+    const uint8_t            *cApdu;                           /*!< C-APDU: CLA INS P1 P2 [Lc Data] [Le]               */
+    uint16_t                 cApduLen;                         /*!< C-APDU length                                      */
+    uint16_t                 sw;                               /*!< Expected SW1SW2                                    */
+    uint16_t                 swMask;                           /*!< SW1SW2 bits to check (FFFFh: exact match)          */
+    uint8_t                  *rspBuf;                          /*!< Sink for the response body, NULL to discard it     */
+    uint16_t                 rspBufLen;                        /*!< Sink size                                          */
+    uint16_t                 *rspLen;                          /*!< Response body length (optional, may be NULL)       */
+} ndefT4TScriptCmd;
+
 /*
 ******************************************************************************
 * GLOBAL FUNCTION PROTOTYPES
@@ -195,7 +207,7 @@ ReturnCode ndefT4TPollerSelectFile(ndefContext *ctx, const uint8_t *fileId);
  *
  * \param[in]   ctx    : ndef Context
  * \param[in]   offset : file offset of where to star reading data; valid range 0000h-7FFFh
- * \param[in]   len    : requested len (short field coding)
+ * \param[in]   len    : requested len (extended field coding if above 256), up to current MLe
  * 
  * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
  * \return ERR_REQUEST      : read failed (SW1SW2 <> 9000h)
@@ -204,7 +216,7 @@ ReturnCode ndefT4TPollerSelectFile(ndefContext *ctx, const uint8_t *fileId);
  * \return ERR_NONE         : No error
  *****************************************************************************
  */
-ReturnCode ndefT4TPollerReadBinary(ndefContext *ctx, uint16_t offset, uint8_t len);
+ReturnCode ndefT4TPollerReadBinary(ndefContext *ctx, uint16_t offset, uint16_t len);
 
 
 /*! 
@@ -216,7 +228,7 @@ ReturnCode ndefT4TPollerReadBinary(ndefContext *ctx, uint16_t offset, uint8_t le
  *
  * \param[in]   ctx    : ndef Context
  * \param[in]   offset : file offset of where to star reading data; valid range 0000h-7FFFh
- * \param[in]   len    : requested len (short field coding)
+ * \param[in]   len    : requested len (extended field coding if above 256), up to current MLe
  * 
  * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
  * \return ERR_REQUEST      : read failed (SW1SW2 <> 9000h)
@@ -225,7 +237,7 @@ ReturnCode ndefT4TPollerReadBinary(ndefContext *ctx, uint16_t offset, uint8_t le
  * \return ERR_NONE         : No error
  *****************************************************************************
  */
-ReturnCode ndefT4TPollerReadBinaryODO(ndefContext *ctx, uint32_t offset, uint8_t len);
+ReturnCode ndefT4TPollerReadBinaryODO(ndefContext *ctx, uint32_t offset, uint16_t len);
 
 
 /*! 
@@ -268,7 +280,7 @@ ReturnCode ndefT4TPollerReadBytes(ndefContext *ctx, uint32_t offset, uint32_t le
  * \return ERR_NONE         : No error
  *****************************************************************************
  */
-ReturnCode ndefT4TPollerWriteBinary(ndefContext *ctx, uint16_t offset, const uint8_t *data, uint8_t len);
+ReturnCode ndefT4TPollerWriteBinary(ndefContext *ctx, uint16_t offset, const uint8_t *data, uint16_t len);
 
 
 /*! 
@@ -290,7 +302,7 @@ ReturnCode ndefT4TPollerWriteBinary(ndefContext *ctx, uint16_t offset, const uin
  * \return ERR_NONE         : No error
  *****************************************************************************
  */
-ReturnCode ndefT4TPollerWriteBinaryODO(ndefContext *ctx, uint32_t offset, const uint8_t *data, uint8_t len);
+ReturnCode ndefT4TPollerWriteBinaryODO(ndefContext *ctx, uint32_t offset, const uint8_t *data, uint16_t len);
 
 /*! 
  *****************************************************************************
@@ -478,6 +490,38 @@ ReturnCode ndefT4TPollerBeginWriteMessage(ndefContext *ctx, uint32_t messageLen)
 ReturnCode ndefT4TPollerEndWriteMessage(ndefContext *ctx, uint32_t messageLen);
 
 
+/*! 
+ *****************************************************************************
+ * \brief T4T Run APDU script
+ *  
+ * This method executes a precompiled list of C-APDUs in a single call,
+ * without returning to the application between commands. Each R-APDU
+ * status word is checked against the expected one and its body is copied
+ * to the command's sink. Execution stops on the first mismatch.
+ *
+ * A SELECT of the application or file already selected is not sent when
+ * its response body is discarded (rspBuf == NULL). The select cache is
+ * shared with ndefT4TPollerSelectNdefTagApplication()/ndefT4TPollerSelectFile()
+ * and reset by ndefT4TPollerContextInitialization(); it assumes every APDU
+ * to the tag goes through this module.
+ *
+ * \param[in]   ctx    : ndef Context
+ * \param[in]   script : commands to execute
+ * \param[in]   cmdCnt : number of commands in script
+ * \param[out]  cmdIdx : index of the command that stopped the script, 
+ *                       cmdCnt on success (optional, may be NULL)
+ * 
+ * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+ * \return ERR_REQUEST      : Unexpected SW1SW2, available in subCtx.t4t.respAPDU.statusWord
+ * \return ERR_NOMEM        : Response body does not fit the sink
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_PROTO        : Protocol error
+ * \return ERR_NONE         : No error, all commands executed
+ *****************************************************************************
+ */
+ReturnCode ndefT4TPollerRunScript(ndefContext *ctx, const ndefT4TScriptCmd *script, uint8_t cmdCnt, uint8_t *cmdIdx);
+
+
 #endif /* NDEF_T4T_H */
 
 /**
@@ -41,6 +41,7 @@
  ******************************************************************************
  */
 #include "ndef_poller.h"
+#include "ndef_t1t.h"
 #include "ndef_t2t.h"
 #include "ndef_t3t.h"
 #include "ndef_t4t.h"
@@ -104,19 +105,19 @@ ReturnCode ndefPollerContextInitialization(ndefContext *ctx, const rfalNfcDevice
 #if RFAL_FEATURE_T1T
     static const ndefPollerWrapper ndefT1TWrapper =
     {
-        NULL, /* ndefT1TPollerContextInitialization, */
-        NULL, /* ndefT1TPollerNdefDetect,            */
-        NULL, /* ndefT1TPollerReadBytes,             */
-        NULL, /* ndefT1TPollerReadRawMessage,        */
+        ndefT1TPollerContextInitialization,
+        ndefT1TPollerNdefDetect,
+        ndefT1TPollerReadBytes,
+        ndefT1TPollerReadRawMessage,
 #if NDEF_FEATURE_ALL
-        NULL, /* ndefT1TPollerWriteBytes,            */
-        NULL, /* ndefT1TPollerWriteRawMessage,       */
-        NULL, /* ndefT1TPollerTagFormat,             */
-        NULL, /* ndefT1TPollerWriteRawMessageLen     */
-        NULL, /* ndefT1TPollerCheckPresence          */
-        NULL, /* ndefT1TPollerCheckAvailableSpace    */
-        NULL, /* ndefT1TPollerBeginWriteMessage      */
-        NULL  /* ndefT1TPollerEndWriteMessage        */
+        ndefT1TPollerWriteBytes,
+        ndefT1TPollerWriteRawMessage,
+        ndefT1TPollerTagFormat,
+        ndefT1TPollerWriteRawMessageLen,
+        ndefT1TPollerCheckPresence,
+        ndefT1TPollerCheckAvailableSpace,
+        ndefT1TPollerBeginWriteMessage,
+        ndefT1TPollerEndWriteMessage
 #endif /* NDEF_FEATURE_ALL */
     };
 #endif /* RFAL_FEATURE_T1T */
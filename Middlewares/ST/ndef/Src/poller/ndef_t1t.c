@@ -0,0 +1,1034 @@
+/******************************************************************************
+  * \attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2019 STMicroelectronics</center></h2>
+  *
+  * Licensed under ST MYLIBERTY SOFTWARE LICENSE AGREEMENT (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        www.st.com/myliberty
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied,
+  * AND SPECIFICALLY DISCLAIMING THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+******************************************************************************/
+
+/*
+ *      PROJECT:   NDEF firmware
+ *      Revision:
+ *      LANGUAGE:  ISO C99
+ */
+
+/*! \file
+ *
+ *  \author
+ *
+ *  \brief Provides NDEF methods and definitions to access NFC Forum T1T
+ *
+ *  This module provides an interface to perform as a NFC Reader/Writer
+ *  to handle a Type 1 Tag T1T
+ *
+ *  Static memory tags (e.g. Topaz 96) are read at once with RALL and written
+ *  byte per byte. Dynamic memory tags (e.g. Topaz 512) are read by segments
+ *  (RSEG) and written by blocks (WRITE-E8), one frame carrying 8 bytes.
+ *
+ */
+
+/*
+ ******************************************************************************
+ * INCLUDES
+ ******************************************************************************
+ */
+ #include "ndef_poller.h"
+ #include "ndef_t1t.h"
+ #include "utils.h"
+
+/*
+ ******************************************************************************
+ * ENABLE SWITCH
+ ******************************************************************************
+ */
+
+#ifndef RFAL_FEATURE_T1T
+    #error " RFAL: Module configuration missing. Please enable/disable T1T module by setting: RFAL_FEATURE_T1T "
+#endif
+
+#if RFAL_FEATURE_T1T
+
+
+/*
+ ******************************************************************************
+ * GLOBAL DEFINES
+ ******************************************************************************
+ */
+
+#define NDEF_T1T_BLOCK_SIZE            8U         /*!< block size                                        */
+#define NDEF_T1T_STATIC_MEM_SIZE     120U         /*!< Static memory size i.e. blocks 0h to Eh           */
+#define NDEF_T1T_RALL_RES_LEN     (RFAL_T1T_HR_LENGTH + NDEF_T1T_STATIC_MEM_SIZE) /*!< RALL response: HR0 HR1 + static memory */
+#define NDEF_T1T_BYTE_ADDR_LIMIT    0x80U         /*!< Memory reachable by byte commands (7 bits ADD)    */
+#define NDEF_T1T_3_BYTES_TLV_LEN    0xFFU         /* FFh indicates the use of 3 bytes got the L field    */
+
+#define NDEF_T1T_CC_OFFSET             8U         /*!< CC offset i.e. block #1                           */
+#define NDEF_T1T_CC_LEN                4U         /*!< CC length                                         */
+#define NDEF_T1T_AREA_OFFSET          12U         /*!< T1T Area starts right after the CC                */
+#define NDEF_T1T_RSVD_OFFSET        0x68U         /*!< Reserved, static lock and OTP bytes: blocks Dh-Eh */
+#define NDEF_T1T_RSVD_LEN             16U         /*!< Reserved, static lock and OTP bytes length        */
+
+#define NDEF_T1T_MAGIC              0xE1U         /*!< CC Magic Number                                   */
+#define NDEF_T1T_CC_0                  0U         /*!< CC_0: Magic Number                                */
+#define NDEF_T1T_CC_1                  1U         /*!< CC_1: Version                                     */
+#define NDEF_T1T_CC_2                  2U         /*!< CC_2: Tag Memory Size (TMS)                       */
+#define NDEF_T1T_CC_3                  3U         /*!< CC_3: Access conditions                           */
+
+#define NDEF_T1T_VERSION_1_0        0x10U         /*!< Version 1.0                                       */
+#define NDEF_T1T_TMS_STATIC         0x0EU         /*!< Default TMS of static memory tags: 120 bytes      */
+#define NDEF_T1T_TMS_DYNAMIC        0x3FU         /*!< Default TMS of dynamic memory tags: 512 bytes     */
+
+#define NDEF_T1T_SIZE_DIVIDER          8U         /*!< Tag memory size in bytes is equal to 8 * (TMS + 1) */
+
+#define NDEF_T1T_TLV_NULL           0x00U         /*!< Null TLV                                          */
+#define NDEF_T1T_TLV_LOCK_CTRL      0x01U         /*!< Lock Control TLV                                  */
+#define NDEF_T1T_TLV_MEMORY_CTRL    0x02U         /*!< Memory Control TLV                                */
+#define NDEF_T1T_TLV_NDEF_MESSAGE   0x03U         /*!< NDEF Message TLV                                  */
+#define NDEF_T1T_TLV_PROPRIETRARY   0xFDU         /*!< Proprietary TLV                                   */
+#define NDEF_T1T_TLV_TERMINATOR     0xFEU         /*!< Terminator TLV                                    */
+
+#define NDEF_T1T_TLV_L_3_BYTES_LEN     3U         /*!< TLV L Length: 3 bytes                             */
+#define NDEF_T1T_TLV_L_1_BYTES_LEN     1U         /*!< TLV L Length: 1 bytes                             */
+#define NDEF_T1T_TLV_T_LEN             1U         /*!< TLV T Length: 1 bytes                             */
+#define NDEF_T1T_TLV_CTRL_LEN          3U         /*!< Lock/Memory Control TLV V Length                  */
+
+/*
+ ******************************************************************************
+ * GLOBAL TYPES
+ ******************************************************************************
+ */
+
+/*
+ ******************************************************************************
+ * GLOBAL MACROS
+ ******************************************************************************
+ */
+
+#define ndefT1TisT1TDevice(device) ((((device)->type == RFAL_NFC_LISTEN_TYPE_NFCA) && ((device)->dev.nfca.type == RFAL_NFCA_T1T)))
+#define ndefT1TUid(ctx)            ((ctx)->device.dev.nfca.ridRes.uid)
+#define ndefT1TIsDynamicMem(dev)   (((dev)->dev.nfca.ridRes.hr0 & RFAL_T1T_HR0_MEM_MASK) != RFAL_T1T_HR0_MEM_STATIC)
+
+#define ndefT1TIsReadOnlyAccessGranted(ctx)  (((ctx)->cc.t1t.readAccess == 0x0U) && ((ctx)->cc.t1t.writeAccess == 0xFU))
+#define ndefT1TIsReadWriteAccessGranted(ctx) (((ctx)->cc.t1t.readAccess == 0x0U) && ((ctx)->cc.t1t.writeAccess == 0x0U))
+
+/*
+ ******************************************************************************
+ * LOCAL VARIABLES
+ ******************************************************************************
+ */
+
+/*
+ ******************************************************************************
+ * LOCAL FUNCTION PROTOTYPES
+ ******************************************************************************
+ */
+static uint32_t ndefT1TPollerGetPhysAddr(const ndefContext *ctx, uint32_t offset, uint32_t *contLen);
+static uint32_t ndefT1TPollerGetAreaLen(const ndefContext *ctx);
+static ReturnCode ndefT1TPollerAddRsvdArea(ndefContext *ctx, uint32_t addr, uint32_t len);
+static ReturnCode ndefT1TPollerReadSegment(ndefContext *ctx, uint8_t segNo);
+
+#if NDEF_FEATURE_ALL
+static bool ndefT1TPollerIsRsvd(const ndefContext *ctx, uint32_t addr, uint32_t len);
+static ReturnCode ndefT1TPollerWriteBlock(ndefContext *ctx, uint32_t addr, const uint8_t *buf, uint32_t len);
+#endif /* NDEF_FEATURE_ALL */
+
+/*
+ ******************************************************************************
+ * GLOBAL FUNCTIONS
+ ******************************************************************************
+ */
+
+/*******************************************************************************/
+static uint32_t ndefT1TPollerGetPhysAddr(const ndefContext *ctx, uint32_t offset, uint32_t *contLen)
+{
+    uint32_t             addr;
+    uint32_t             end;
+    uint8_t              i;
+
+    /* Areas are sorted and disjoint: skip each one lying before the address reached so far */
+    addr = offset;
+    end  = ctx->subCtx.t1t.memSize;
+    for( i = 0U; i < ctx->subCtx.t1t.nbRsvdAreas; i++ )
+    {
+        if( ctx->subCtx.t1t.rsvdAreas[i].addr <= addr )
+        {
+            addr += ctx->subCtx.t1t.rsvdAreas[i].len;
+        }
+        else
+        {
+            end = MIN( end, ctx->subCtx.t1t.rsvdAreas[i].addr );
+            break;
+        }
+    }
+
+    *contLen = (addr < end) ? (end - addr) : 0U;
+    return addr;
+}
+
+/*******************************************************************************/
+static uint32_t ndefT1TPollerGetAreaLen(const ndefContext *ctx)
+{
+    uint32_t             len;
+    uint32_t             rsvdLen;
+    uint8_t              i;
+
+    len = ctx->subCtx.t1t.memSize;
+    for( i = 0U; i < ctx->subCtx.t1t.nbRsvdAreas; i++ )
+    {
+        if( ctx->subCtx.t1t.rsvdAreas[i].addr < ctx->subCtx.t1t.memSize )
+        {
+            rsvdLen = MIN( ctx->subCtx.t1t.rsvdAreas[i].len, ((uint32_t)ctx->subCtx.t1t.memSize - ctx->subCtx.t1t.rsvdAreas[i].addr) );
+            len    -= rsvdLen;
+        }
+    }
+
+    return (len > NDEF_T1T_AREA_OFFSET) ? (len - NDEF_T1T_AREA_OFFSET) : 0U;
+}
+
+/*******************************************************************************/
+static ReturnCode ndefT1TPollerAddRsvdArea(ndefContext *ctx, uint32_t addr, uint32_t len)
+{
+    ndefT1TRsvdArea      areas[NDEF_T1T_MAX_RSVD_AREAS + 1U];
+    uint32_t             start;
+    uint32_t             end;
+    uint32_t             areaEnd;
+    uint8_t              nbAreas;
+    uint8_t              i;
+    bool                 inserted;
+
+    start    = addr;
+    end      = addr + len;
+    nbAreas  = 0U;
+    inserted = false;
+
+    /* Keep the list sorted, overlapping or adjacent areas are merged */
+    for( i = 0U; i < ctx->subCtx.t1t.nbRsvdAreas; i++ )
+    {
+        areaEnd = (uint32_t)ctx->subCtx.t1t.rsvdAreas[i].addr + ctx->subCtx.t1t.rsvdAreas[i].len;
+        if( (ctx->subCtx.t1t.rsvdAreas[i].addr <= end) && (start <= areaEnd) )
+        {
+            start = MIN( start, ctx->subCtx.t1t.rsvdAreas[i].addr );
+            end   = MAX( end, areaEnd );
+        }
+        else
+        {
+            if( !inserted && (ctx->subCtx.t1t.rsvdAreas[i].addr > end) )
+            {
+                areas[nbAreas].addr = (uint16_t)start;
+                areas[nbAreas].len  = (uint16_t)(end - start);
+                nbAreas++;
+                inserted = true;
+            }
+            areas[nbAreas] = ctx->subCtx.t1t.rsvdAreas[i];
+            nbAreas++;
+        }
+    }
+    if( !inserted )
+    {
+        areas[nbAreas].addr = (uint16_t)start;
+        areas[nbAreas].len  = (uint16_t)(end - start);
+        nbAreas++;
+    }
+
+    if( nbAreas > NDEF_T1T_MAX_RSVD_AREAS )
+    {
+        return ERR_NOMEM;
+    }
+
+    (void)ST_MEMCPY(ctx->subCtx.t1t.rsvdAreas, areas, (sizeof(ndefT1TRsvdArea) * nbAreas));
+    ctx->subCtx.t1t.nbRsvdAreas = nbAreas;
+    return ERR_NONE;
+}
+
+/*******************************************************************************/
+static ReturnCode ndefT1TPollerReadSegment(ndefContext *ctx, uint8_t segNo)
+{
+    ReturnCode           ret;
+    uint16_t             rcvdLen;
+    uint8_t              rallBuf[NDEF_T1T_RALL_RES_LEN];
+
+    if( ctx->subCtx.t1t.memValid && (ctx->subCtx.t1t.memSegNo == segNo) )
+    {
+        return ERR_NONE;
+    }
+    ctx->subCtx.t1t.memValid = false;
+
+    if( ctx->subCtx.t1t.dynamicMem )
+    {
+        ret = rfalT1TPollerRseg(ndefT1TUid(ctx), segNo, ctx->subCtx.t1t.memBuf, NDEF_T1T_SEGMENT_SIZE);
+    }
+    else
+    {
+        /* Static memory only supports RALL: the whole memory in a single frame */
+        if( segNo != 0U )
+        {
+            return ERR_PARAM;
+        }
+        ret = rfalT1TPollerRall(ndefT1TUid(ctx), rallBuf, (uint16_t)sizeof(rallBuf), &rcvdLen);
+        if( (ret == ERR_NONE) && (rcvdLen != NDEF_T1T_RALL_RES_LEN) )
+        {
+            ret = ERR_PROTO;
+        }
+        if( ret == ERR_NONE )
+        {
+            (void)ST_MEMCPY(ctx->subCtx.t1t.memBuf, &rallBuf[RFAL_T1T_HR_LENGTH], NDEF_T1T_STATIC_MEM_SIZE);
+            (void)ST_MEMSET(&ctx->subCtx.t1t.memBuf[NDEF_T1T_STATIC_MEM_SIZE], 0x00, (NDEF_T1T_SEGMENT_SIZE - NDEF_T1T_STATIC_MEM_SIZE));
+        }
+    }
+
+    if( ret == ERR_NONE )
+    {
+        ctx->subCtx.t1t.memSegNo = segNo;
+        ctx->subCtx.t1t.memValid = true;
+    }
+    return ret;
+}
+
+/*******************************************************************************/
+ReturnCode ndefT1TPollerReadBytes(ndefContext *ctx, uint32_t offset, uint32_t len, uint8_t *buf, uint32_t *rcvdLen)
+{
+    ReturnCode           ret;
+    uint32_t             lvOffset = offset;
+    uint32_t             lvLen    = len;
+    uint8_t *            lvBuf    = buf;
+    uint32_t             addr;
+    uint32_t             contLen;
+    uint32_t             segOffset;
+    uint32_t             le;
+
+    if( (ctx == NULL) || !ndefT1TisT1TDevice(&ctx->device) || (lvLen == 0U) || (buf == NULL) )
+    {
+        return ERR_PARAM;
+    }
+
+    while( lvLen != 0U )
+    {
+        addr = ndefT1TPollerGetPhysAddr(ctx, lvOffset, &contLen);
+        if( contLen == 0U )
+        {
+            return ERR_PARAM;
+        }
+
+        ret = ndefT1TPollerReadSegment(ctx, (uint8_t)(addr / NDEF_T1T_SEGMENT_SIZE));
+        if( ret != ERR_NONE )
+        {
+            return ret;
+        }
+
+        /* Copy up to the end of the segment or of the contiguous data area */
+        segOffset = addr % NDEF_T1T_SEGMENT_SIZE;
+        le = MIN( lvLen, MIN( contLen, (NDEF_T1T_SEGMENT_SIZE - segOffset) ) );
+        (void)ST_MEMCPY(lvBuf, &ctx->subCtx.t1t.memBuf[segOffset], le);
+
+        lvBuf     = &lvBuf[le];
+        lvOffset += le;
+        lvLen    -= le;
+    }
+
+    if( rcvdLen != NULL )
+    {
+        *rcvdLen = len;
+    }
+    return ERR_NONE;
+}
+
+/*******************************************************************************/
+ReturnCode ndefT1TPollerContextInitialization(ndefContext *ctx, const rfalNfcDevice *dev)
+{
+    if( (ctx == NULL) || (dev == NULL) || !ndefT1TisT1TDevice(dev) )
+    {
+        return ERR_PARAM;
+    }
+
+    (void)ST_MEMCPY(&ctx->device, dev, sizeof(ctx->device));
+
+    ctx->state                   = NDEF_STATE_INVALID;
+    ctx->areaLen                 = 0U;
+    ctx->subCtx.t1t.memSegNo     = 0U;
+    ctx->subCtx.t1t.memValid     = false;
+    ctx->subCtx.t1t.dynamicMem   = ndefT1TIsDynamicMem(dev);
+    ctx->subCtx.t1t.memSize      = NDEF_T1T_STATIC_MEM_SIZE;
+    ctx->subCtx.t1t.nbRsvdAreas  = 0U;
+
+   return ERR_NONE;
+}
+
+/*******************************************************************************/
+ReturnCode ndefT1TPollerNdefDetect(ndefContext *ctx, ndefInfo *info)
+{
+    ReturnCode           ret;
+    uint8_t              data[NDEF_T1T_TLV_CTRL_LEN];
+    uint32_t             offset;
+    uint32_t             rsvdAddr;
+    uint32_t             rsvdLen;
+    uint16_t             lenTLV;
+    uint8_t              typeTLV;
+
+    if( info != NULL )
+    {
+        info->state                = NDEF_STATE_INVALID;
+        info->majorVersion         = 0U;
+        info->minorVersion         = 0U;
+        info->areaLen              = 0U;
+        info->areaAvalableSpaceLen = 0U;
+        info->messageLen           = 0U;
+    }
+
+    if( (ctx == NULL) || !ndefT1TisT1TDevice(&ctx->device) )
+    {
+        return ERR_PARAM;
+    }
+
+    ctx->state = NDEF_STATE_INVALID;
+
+    /* Start over from a fresh image of the tag memory, only the fixed reserved area is known so far */
+    ctx->subCtx.t1t.memValid    = false;
+    ctx->subCtx.t1t.memSize     = NDEF_T1T_STATIC_MEM_SIZE;
+    ctx->subCtx.t1t.nbRsvdAreas = 0U;
+    (void)ndefT1TPollerAddRsvdArea(ctx, NDEF_T1T_RSVD_OFFSET, NDEF_T1T_RSVD_LEN);
+
+    /* Read CC TS T1T v1.2 8.3.1.1 */
+    ret = ndefT1TPollerReadBytes(ctx, NDEF_T1T_CC_OFFSET, NDEF_T1T_CC_LEN, ctx->ccBuf, NULL);
+    if( ret != ERR_NONE )
+    {
+        /* Conclude procedure */
+        return ret;
+    }
+    ctx->cc.t1t.magicNumber   = ctx->ccBuf[NDEF_T1T_CC_0];
+    ctx->cc.t1t.majorVersion  = ndefMajorVersion(ctx->ccBuf[NDEF_T1T_CC_1]);
+    ctx->cc.t1t.minorVersion  = ndefMinorVersion(ctx->ccBuf[NDEF_T1T_CC_1]);
+    ctx->cc.t1t.tagMemorySize = (uint16_t)(((uint32_t)ctx->ccBuf[NDEF_T1T_CC_2] + 1U) * NDEF_T1T_SIZE_DIVIDER);
+    ctx->cc.t1t.readAccess    = (uint8_t)(ctx->ccBuf[NDEF_T1T_CC_3] >> 4U);
+    ctx->cc.t1t.writeAccess   = (uint8_t)(ctx->ccBuf[NDEF_T1T_CC_3] & 0xFU);
+    /* Check version number TS T1T v1.2 8.3.1.2 */
+    if( (ctx->cc.t1t.magicNumber != NDEF_T1T_MAGIC) || (ctx->cc.t1t.majorVersion > ndefMajorVersion(NDEF_T1T_VERSION_1_0)) )
+    {
+        /* Conclude procedure TS T1T v1.2 8.3.1.2 */
+        return ERR_REQUEST;
+    }
+    ctx->subCtx.t1t.memSize = ctx->subCtx.t1t.dynamicMem ? ctx->cc.t1t.tagMemorySize : (uint16_t)MIN( ctx->cc.t1t.tagMemorySize, NDEF_T1T_STATIC_MEM_SIZE );
+    ctx->areaLen            = ndefT1TPollerGetAreaLen(ctx);
+
+    /* Search for NDEF message TLV TS T1T v1.2 8.3.1.3 */
+    offset = NDEF_T1T_AREA_OFFSET;
+    while ( (offset < (NDEF_T1T_AREA_OFFSET + ctx->areaLen)) )
+    {
+        ret = ndefT1TPollerReadBytes(ctx, offset, 1, data, NULL);
+        if( ret != ERR_NONE )
+        {
+            /* Conclude procedure */
+            return ret;
+        }
+        typeTLV = data[0];
+        if( typeTLV == NDEF_T1T_TLV_NDEF_MESSAGE )
+        {
+            ctx->subCtx.t1t.offsetNdefTLV = offset;
+        }
+        offset++;
+        if( typeTLV == NDEF_T1T_TLV_TERMINATOR )
+        {
+            break;
+        }
+        if( typeTLV == NDEF_T1T_TLV_NULL )
+        {
+            continue;
+        }
+        /* read TLV Len */
+        ret = ndefT1TPollerReadBytes(ctx, offset, 1, data, NULL);
+        if( ret != ERR_NONE )
+        {
+            /* Conclude procedure */
+            return ret;
+        }
+        offset++;
+        lenTLV = data[0];
+        if( lenTLV == NDEF_T1T_3_BYTES_TLV_LEN )
+        {
+            ret = ndefT1TPollerReadBytes(ctx, offset, 2, data, NULL);
+            if( ret != ERR_NONE )
+            {
+                /* Conclude procedure */
+                return ret;
+            }
+            offset += 2U;
+            lenTLV = GETU16(&data[0]);
+        }
+
+        if( (typeTLV == NDEF_T1T_TLV_LOCK_CTRL) || (typeTLV == NDEF_T1T_TLV_MEMORY_CTRL) )
+        {
+            if( lenTLV != NDEF_T1T_TLV_CTRL_LEN )
+            {
+                return ERR_REQUEST;
+            }
+            ret = ndefT1TPollerReadBytes(ctx, offset, NDEF_T1T_TLV_CTRL_LEN, data, NULL);
+            if( ret != ERR_NONE )
+            {
+                /* Conclude procedure */
+                return ret;
+            }
+
+            /* Position: PageAddr * 2^BytesPerPage + ByteOffset. Size: lock bits or reserved bytes, 0 meaning 256 TS T1T v1.2 2.3.1 & 2.3.2 */
+            rsvdAddr = ((uint32_t)(data[0] >> 4U) << (data[2] & 0xFU)) + (uint32_t)(data[0] & 0xFU);
+            rsvdLen  = (data[1] == 0U) ? 256U : (uint32_t)data[1];
+            if( typeTLV == NDEF_T1T_TLV_LOCK_CTRL )
+            {
+                rsvdLen = (rsvdLen + 7U) / 8U;
+            }
+
+            /* Following offsets skip the area, which always lies beyond the TLV itself */
+            if( ndefT1TPollerAddRsvdArea(ctx, rsvdAddr, rsvdLen) != ERR_NONE )
+            {
+                /* Conclude procedure */
+                return ERR_REQUEST;
+            }
+            ctx->areaLen = ndefT1TPollerGetAreaLen(ctx);
+        }
+        /* NDEF message present TLV TS T1T v1.2 8.3.1.4 */
+        if( typeTLV == NDEF_T1T_TLV_NDEF_MESSAGE )
+        {
+            /* Read length TS T1T v1.2 8.3.1.5 */
+            ctx->messageLen    = lenTLV;
+            ctx->messageOffset = offset;
+            if( ctx->messageLen == 0U )
+            {
+                if( !(ndefT1TIsReadWriteAccessGranted(ctx)) )
+                {
+                    /* Conclude procedure  */
+                    return ERR_REQUEST;
+                }
+                 /* Empty message found TS T1T v1.2 8.3.1.6 & TS T1T v1.2 8.2.2 */
+                ctx->state = NDEF_STATE_INITIALIZED;
+            }
+            else
+            {
+                if( (ndefT1TIsReadWriteAccessGranted(ctx)) )
+                {
+                    /* Empty message found TS T1T v1.2 8.3.1.7 & TS T1T v1.2 8.2.3 */
+                    ctx->state = NDEF_STATE_READWRITE;
+                }
+                else
+                {
+                    if( !(ndefT1TIsReadOnlyAccessGranted(ctx)) )
+                    {
+                        /* Conclude procedure  */
+                        return ERR_REQUEST;
+                    }
+                     /* Empty message found TS T1T v1.2 8.3.1.7 & TS T1T v1.2 8.2.4 */
+                    ctx->state = NDEF_STATE_READONLY;
+                }
+            }
+            if( info != NULL )
+            {
+                info->state                = ctx->state;
+                info->majorVersion         = ctx->cc.t1t.majorVersion;
+                info->minorVersion         = ctx->cc.t1t.minorVersion;
+                info->areaLen              = ctx->areaLen;
+                info->areaAvalableSpaceLen = (ctx->areaLen + NDEF_T1T_AREA_OFFSET) - ctx->messageOffset;
+                info->messageLen           = ctx->messageLen;
+            }
+            return ERR_NONE;
+        }
+        offset += lenTLV;
+    }
+    return ERR_REQUEST;
+}
+
+/*******************************************************************************/
+ReturnCode ndefT1TPollerReadRawMessage(ndefContext *ctx, uint8_t *buf, uint32_t bufLen, uint32_t *rcvdLen)
+{
+    ReturnCode           ret;
+
+    if( (ctx == NULL) || !ndefT1TisT1TDevice(&ctx->device) || (buf == NULL) )
+    {
+        return ERR_PARAM;
+    }
+
+    /* TS T1T v1.2 8.3.2: T1T NDEF Detect should have been called before NDEF read procedure */
+    /* Warning: current tag content must not be changed between NDEF Detect procedure and NDEF read procedure*/
+
+    /* TS T1T v1.2 8.3.2: check presence of NDEF message */
+    if ( ctx->state <= NDEF_STATE_INITIALIZED )
+    {
+        /* Conclude procedure */
+        return ERR_WRONG_STATE;
+    }
+
+    if( ctx->messageLen > bufLen )
+    {
+        return ERR_NOMEM;
+    }
+
+    /* Lock and reserved areas are skipped by ndefT1TPollerReadBytes() */
+    ret = ndefT1TPollerReadBytes( ctx, ctx->messageOffset, ctx->messageLen, buf, rcvdLen );
+    if( ret != ERR_NONE )
+    {
+        ctx->state = NDEF_STATE_INVALID;
+    }
+    return ret;
+}
+
+#if NDEF_FEATURE_ALL
+
+/*******************************************************************************/
+static bool ndefT1TPollerIsRsvd(const ndefContext *ctx, uint32_t addr, uint32_t len)
+{
+    uint8_t              i;
+
+    for( i = 0U; i < ctx->subCtx.t1t.nbRsvdAreas; i++ )
+    {
+        if( (ctx->subCtx.t1t.rsvdAreas[i].addr < (addr + len)) && (addr < ((uint32_t)ctx->subCtx.t1t.rsvdAreas[i].addr + ctx->subCtx.t1t.rsvdAreas[i].len)) )
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/*******************************************************************************/
+static ReturnCode ndefT1TPollerWriteBlock(ndefContext *ctx, uint32_t addr, const uint8_t *buf, uint32_t len)
+{
+    ReturnCode           ret;
+    uint32_t             blockAddr;
+    uint32_t             byteNo;
+    uint32_t             segOffset;
+    uint32_t             i;
+    bool                 cached;
+    bool                 known;
+    uint8_t              curBuf[NDEF_T1T_BLOCK_SIZE];
+    uint8_t              newBuf[NDEF_T1T_BLOCK_SIZE];
+
+    /* Writes bytes [addr; addr + len[ all lying in one block */
+    blockAddr = addr / NDEF_T1T_BLOCK_SIZE;
+    byteNo    = addr % NDEF_T1T_BLOCK_SIZE;
+    segOffset = (blockAddr * NDEF_T1T_BLOCK_SIZE) % NDEF_T1T_SEGMENT_SIZE;
+    cached    = ctx->subCtx.t1t.memValid && (ctx->subCtx.t1t.memSegNo == (uint8_t)(addr / NDEF_T1T_SEGMENT_SIZE));
+    known     = cached;
+    ret       = ERR_NONE;
+
+    if( cached )
+    {
+        (void)ST_MEMCPY(curBuf, &ctx->subCtx.t1t.memBuf[segOffset], NDEF_T1T_BLOCK_SIZE);
+    }
+    else if( len != NDEF_T1T_BLOCK_SIZE )
+    {
+        /* Partially written block: fetch the bytes to be preserved */
+        ret = ctx->subCtx.t1t.dynamicMem ? rfalT1TPollerRead8(ndefT1TUid(ctx), (uint8_t)blockAddr, curBuf, (uint16_t)sizeof(curBuf)) : ERR_WRONG_STATE;
+        known = true;
+    }
+    else
+    {
+        /* MISRA 15.7 - Empty else */
+    }
+
+    if( ret == ERR_NONE )
+    {
+        if( known )
+        {
+            (void)ST_MEMCPY(newBuf, curBuf, NDEF_T1T_BLOCK_SIZE);
+        }
+        (void)ST_MEMCPY(&newBuf[byteNo], buf, len);
+
+        if( known && (ST_BYTECMP(newBuf, curBuf, NDEF_T1T_BLOCK_SIZE) == 0) )
+        {
+            /* Content unchanged: nothing to write */
+        }
+        else if( !ctx->subCtx.t1t.dynamicMem || ((blockAddr < (NDEF_T1T_BYTE_ADDR_LIMIT / NDEF_T1T_BLOCK_SIZE)) && ndefT1TPollerIsRsvd(ctx, (blockAddr * NDEF_T1T_BLOCK_SIZE), NDEF_T1T_BLOCK_SIZE)) )
+        {
+            /* Static memory, or block sharing lock/reserved bytes: write the changed bytes only */
+            for( i = byteNo; (i < (byteNo + len)) && (ret == ERR_NONE); i++ )
+            {
+                if( !known || (newBuf[i] != curBuf[i]) )
+                {
+                    ret = rfalT1TPollerWrite(ndefT1TUid(ctx), (uint8_t)((blockAddr * NDEF_T1T_BLOCK_SIZE) + i), newBuf[i]);
+                }
+            }
+        }
+        else
+        {
+            ret = rfalT1TPollerWriteE8(ndefT1TUid(ctx), (uint8_t)blockAddr, newBuf);
+        }
+    }
+
+    /* Keep the cached segment coherent with the tag */
+    if( cached )
+    {
+        if( ret == ERR_NONE )
+        {
+            (void)ST_MEMCPY(&ctx->subCtx.t1t.memBuf[segOffset + byteNo], buf, len);
+        }
+        else
+        {
+            ctx->subCtx.t1t.memValid = false;
+        }
+    }
+
+    return ret;
+}
+
+/*******************************************************************************/
+ReturnCode ndefT1TPollerWriteBytes(ndefContext *ctx, uint32_t offset, const uint8_t *buf, uint32_t len)
+{
+    ReturnCode           ret;
+    uint32_t             lvOffset = offset;
+    uint32_t             lvLen    = len;
+    const uint8_t *      lvBuf    = buf;
+    uint32_t             addr;
+    uint32_t             contLen;
+    uint32_t             le;
+
+    if( (ctx == NULL) || !ndefT1TisT1TDevice(&ctx->device) || (lvLen == 0U) || (buf == NULL) )
+    {
+        return ERR_PARAM;
+    }
+
+    /* Static memory is written byte per byte: get its content at once to skip unchanged bytes */
+    if( !ctx->subCtx.t1t.dynamicMem )
+    {
+        ret = ndefT1TPollerReadSegment(ctx, 0U);
+        if( ret != ERR_NONE )
+        {
+            return ret;
+        }
+    }
+
+    while( lvLen != 0U )
+    {
+        addr = ndefT1TPollerGetPhysAddr(ctx, lvOffset, &contLen);
+        if( contLen == 0U )
+        {
+            return ERR_PARAM;
+        }
+
+        /* Up to the end of the block or of the contiguous data area */
+        le = MIN( lvLen, MIN( contLen, (NDEF_T1T_BLOCK_SIZE - (addr % NDEF_T1T_BLOCK_SIZE)) ) );
+        ret = ndefT1TPollerWriteBlock(ctx, addr, lvBuf, le);
+        if( ret != ERR_NONE )
+        {
+            return ret;
+        }
+
+        lvBuf     = &lvBuf[le];
+        lvOffset += le;
+        lvLen    -= le;
+    }
+
+    return ERR_NONE;
+}
+
+/*******************************************************************************/
+ReturnCode ndefT1TPollerWriteRawMessageLen(ndefContext *ctx, uint32_t rawMessageLen)
+{
+    ReturnCode           ret;
+    uint8_t              buf[NDEF_T1T_TLV_T_LEN + NDEF_T1T_TLV_L_3_BYTES_LEN];
+    uint8_t              dataIt;
+
+    if( (ctx == NULL) || !ndefT1TisT1TDevice(&ctx->device) )
+    {
+        return ERR_PARAM;
+    }
+
+    if( (ctx->state != NDEF_STATE_INITIALIZED) && (ctx->state != NDEF_STATE_READWRITE) )
+    {
+        return ERR_WRONG_STATE;
+    }
+
+    /* Write Terminator TLV first, the message becomes valid once its L field is set */
+    if( (rawMessageLen != 0U) && ((ctx->messageOffset + rawMessageLen) < (ctx->areaLen + NDEF_T1T_AREA_OFFSET)) )
+    {
+        buf[0] = NDEF_T1T_TLV_TERMINATOR;
+        ret = ndefT1TPollerWriteBytes(ctx, ctx->messageOffset + rawMessageLen, buf, NDEF_TERMINATOR_TLV_LEN);
+        if( ret != ERR_NONE )
+        {
+            return ret;
+        }
+    }
+
+    dataIt = 0U;
+    buf[dataIt] = NDEF_T1T_TLV_NDEF_MESSAGE;
+    dataIt++;
+    if( rawMessageLen <= NDEF_SHORT_VFIELD_MAX_LEN )
+    {
+        buf[dataIt] = (uint8_t) rawMessageLen;
+        dataIt++;
+    }
+    else
+    {
+        buf[dataIt] = NDEF_T1T_3_BYTES_TLV_LEN;
+        dataIt++;
+        buf[dataIt] = (uint8_t) (rawMessageLen >> 8U);
+        dataIt++;
+        buf[dataIt] = (uint8_t) rawMessageLen;
+        dataIt++;
+    }
+    if( rawMessageLen == 0U )
+    {
+        buf[dataIt] = NDEF_T1T_TLV_TERMINATOR;
+        dataIt++;
+    }
+
+    return ndefT1TPollerWriteBytes(ctx, ctx->subCtx.t1t.offsetNdefTLV, buf, dataIt);
+}
+
+/*******************************************************************************/
+ReturnCode ndefT1TPollerWriteRawMessage(ndefContext *ctx, const uint8_t *buf, uint32_t bufLen)
+{
+    ReturnCode ret;
+
+    if( (ctx == NULL) || !ndefT1TisT1TDevice(&ctx->device) || ((buf == NULL) && (bufLen != 0U)) )
+    {
+        return ERR_PARAM;
+    }
+
+    /* TS T1T v1.2 8.3.3: T1T NDEF Detect should have been called before NDEF write procedure */
+    /* Warning: current tag content must not be changed between NDEF Detect procedure and NDEF Write procedure*/
+
+    /* TS T1T v1.2 8.3.3: check write access condition */
+    if ( (ctx->state != NDEF_STATE_INITIALIZED) && (ctx->state != NDEF_STATE_READWRITE) )
+    {
+        /* Conclude procedure */
+        return ERR_WRONG_STATE;
+    }
+
+    /* TS T1T v1.2 8.3.3: verify available space */
+    ret = ndefT1TPollerCheckAvailableSpace(ctx, bufLen);
+    if( ret != ERR_NONE )
+    {
+        /* Conclude procedures */
+        return ERR_PARAM;
+    }
+
+    /* TS T1T v1.2 8.3.3: reset L_Field to 0                */
+    /* and update ctx->messageOffset according to L-field len */
+    ret = ndefT1TPollerBeginWriteMessage(ctx, bufLen);
+    if( ret != ERR_NONE )
+    {
+        ctx->state = NDEF_STATE_INVALID;
+        /* Conclude procedure */
+        return ret;
+    }
+
+    if( bufLen != 0U )
+    {
+       /* TS T1T v1.2 8.3.3: write new NDEF message */
+        ret = ndefT1TPollerWriteBytes(ctx, ctx->messageOffset, buf, bufLen);
+        if  (ret != ERR_NONE)
+        {
+            /* Conclude procedure */
+            ctx->state = NDEF_STATE_INVALID;
+            return ret;
+        }
+
+        /* TS T1T v1.2 8.3.3: update L_Field and write Terminator TLV */
+        ret = ndefT1TPollerEndWriteMessage(ctx, bufLen);
+        if( ret != ERR_NONE )
+        {
+            /* Conclude procedure */
+            ctx->state = NDEF_STATE_INVALID;
+            return ret;
+        }
+    }
+
+    return ret;
+}
+
+/*******************************************************************************/
+ReturnCode ndefT1TPollerTagFormat(ndefContext *ctx, const ndefCapabilityContainer *cc, uint32_t options)
+{
+    ReturnCode           ret;
+    uint8_t              dataIt;
+    uint8_t              buf[NDEF_T1T_CC_LEN + 3U];
+
+    NO_WARNING(options);
+
+    if( (ctx == NULL) || !ndefT1TisT1TDevice(&ctx->device) )
+    {
+        return ERR_PARAM;
+    }
+
+    /* Only the fixed reserved area is assumed, as on a virgin tag */
+    ctx->subCtx.t1t.memSize     = NDEF_T1T_STATIC_MEM_SIZE;
+    ctx->subCtx.t1t.nbRsvdAreas = 0U;
+    (void)ndefT1TPollerAddRsvdArea(ctx, NDEF_T1T_RSVD_OFFSET, NDEF_T1T_RSVD_LEN);
+
+    /*
+     * Read CC area
+     */
+    ret = ndefT1TPollerReadBytes(ctx, NDEF_T1T_CC_OFFSET, NDEF_T1T_CC_LEN, ctx->ccBuf, NULL);
+    if( ret != ERR_NONE )
+    {
+        return ret;
+    }
+
+    /*
+     * Write CC only in case of virgin CC area
+     */
+    if( (ctx->ccBuf[NDEF_T1T_CC_0] == 0U) && (ctx->ccBuf[NDEF_T1T_CC_1] == 0U) && (ctx->ccBuf[NDEF_T1T_CC_2] == 0U) && (ctx->ccBuf[NDEF_T1T_CC_3] == 0U) )
+    {
+        dataIt = 0U;
+        if( cc == NULL )
+        {
+            /* Use default values if no cc provided */
+            ctx->ccBuf[dataIt] = NDEF_T1T_MAGIC;
+            dataIt++;
+            ctx->ccBuf[dataIt] = NDEF_T1T_VERSION_1_0;
+            dataIt++;
+            ctx->ccBuf[dataIt] = ctx->subCtx.t1t.dynamicMem ? NDEF_T1T_TMS_DYNAMIC : NDEF_T1T_TMS_STATIC;
+            dataIt++;
+            ctx->ccBuf[dataIt] = 0x00U;
+            dataIt++;
+        }
+        else
+        {
+            ctx->ccBuf[dataIt] = cc->t1t.magicNumber;
+            dataIt++;
+            ctx->ccBuf[dataIt] = (uint8_t)(cc->t1t.majorVersion << 4U) | cc->t1t.minorVersion;
+            dataIt++;
+            ctx->ccBuf[dataIt] = (uint8_t)((cc->t1t.tagMemorySize / NDEF_T1T_SIZE_DIVIDER) - 1U);
+            dataIt++;
+            ctx->ccBuf[dataIt] = (uint8_t)(cc->t1t.readAccess << 4U) | cc->t1t.writeAccess;
+            dataIt++;
+        }
+    }
+
+    /*
+     * Write CC and NDEF place holder: both lie in block #1, a single WRITE-E8 on dynamic memory
+     */
+    (void)ST_MEMCPY(buf, ctx->ccBuf, NDEF_T1T_CC_LEN);
+    dataIt = NDEF_T1T_CC_LEN;
+    buf[dataIt] = NDEF_T1T_TLV_NDEF_MESSAGE;
+    dataIt++;
+    buf[dataIt] = 0x00U;
+    dataIt++;
+    buf[dataIt] = NDEF_T1T_TLV_TERMINATOR;
+    dataIt++;
+    ret = ndefT1TPollerWriteBytes(ctx, NDEF_T1T_CC_OFFSET, buf, dataIt);
+
+    return ret;
+}
+
+/*******************************************************************************/
+ReturnCode ndefT1TPollerCheckPresence(ndefContext *ctx)
+{
+    ReturnCode           ret;
+    rfalT1TRidRes        ridRes;
+
+    if( (ctx == NULL) || !ndefT1TisT1TDevice(&ctx->device) )
+    {
+        return ERR_PARAM;
+    }
+
+    /* RID is the shortest T1T exchange */
+    ret = rfalT1TPollerRid(&ridRes);
+    if( (ret == ERR_NONE) && (ST_BYTECMP(ridRes.uid, ndefT1TUid(ctx), RFAL_T1T_UID_LEN) != 0) )
+    {
+        ret = ERR_PROTO;
+    }
+    if( ret != ERR_NONE )
+    {
+        ctx->subCtx.t1t.memValid = false;
+    }
+    return ret;
+}
+
+/*******************************************************************************/
+ReturnCode ndefT1TPollerCheckAvailableSpace(const ndefContext *ctx, uint32_t messageLen)
+{
+    uint32_t             lLen;
+
+    if( (ctx == NULL) || !ndefT1TisT1TDevice(&ctx->device) )
+    {
+        return ERR_PARAM;
+    }
+
+    if ( ctx->state == NDEF_STATE_INVALID )
+    {
+        return ERR_WRONG_STATE;
+    }
+
+    lLen = ( messageLen > NDEF_SHORT_VFIELD_MAX_LEN) ? NDEF_T1T_TLV_L_3_BYTES_LEN : NDEF_T1T_TLV_L_1_BYTES_LEN;
+
+    if( (messageLen + ctx->subCtx.t1t.offsetNdefTLV + NDEF_T1T_TLV_T_LEN + lLen) > (ctx->areaLen + NDEF_T1T_AREA_OFFSET) )
+    {
+        return ERR_NOMEM;
+    }
+    return ERR_NONE;
+}
+
+/*******************************************************************************/
+ReturnCode ndefT1TPollerBeginWriteMessage(ndefContext *ctx, uint32_t messageLen)
+{
+    ReturnCode           ret;
+    uint32_t             lLen;
+
+    if( (ctx == NULL) || !ndefT1TisT1TDevice(&ctx->device) )
+    {
+        return ERR_PARAM;
+    }
+
+    if( (ctx->state != NDEF_STATE_INITIALIZED) && (ctx->state != NDEF_STATE_READWRITE) )
+    {
+        return ERR_WRONG_STATE;
+    }
+
+    /* TS T1T v1.2 8.3.3: reset L_Field to 0 */
+    ret = ndefT1TPollerWriteRawMessageLen(ctx, 0U);
+    if( ret != ERR_NONE )
+    {
+        /* Conclude procedure */
+        ctx->state = NDEF_STATE_INVALID;
+        return ret;
+    }
+
+    lLen = ( messageLen > NDEF_SHORT_VFIELD_MAX_LEN) ? NDEF_T1T_TLV_L_3_BYTES_LEN : NDEF_T1T_TLV_L_1_BYTES_LEN;
+    ctx->messageOffset  = ctx->subCtx.t1t.offsetNdefTLV;
+    ctx->messageOffset += NDEF_T1T_TLV_T_LEN; /* T Len */
+    ctx->messageOffset += lLen;               /* L Len */
+
+    ctx->state = NDEF_STATE_INITIALIZED;
+
+    return ERR_NONE;
+}
+
+/*******************************************************************************/
+ReturnCode ndefT1TPollerEndWriteMessage(ndefContext *ctx, uint32_t messageLen)
+{
+    ReturnCode           ret;
+
+    if( (ctx == NULL) || !ndefT1TisT1TDevice(&ctx->device) )
+    {
+        return ERR_PARAM;
+    }
+
+    if( ctx->state != NDEF_STATE_INITIALIZED )
+    {
+        return ERR_WRONG_STATE;
+    }
+
+    /* TS T1T v1.2 8.3.3: update L_Field and write Terminator TLV */
+    ret = ndefT1TPollerWriteRawMessageLen(ctx, messageLen);
+    if( ret != ERR_NONE )
+    {
+        /* Conclude procedure */
+        ctx->state = NDEF_STATE_INVALID;
+        return ret;
+    }
+    ctx->messageLen = messageLen;
+    ctx->state = (ctx->messageLen == 0U) ? NDEF_STATE_INITIALIZED : NDEF_STATE_READWRITE;
+    return ERR_NONE;
+}
+
+#endif /* NDEF_FEATURE_ALL */
+
+#endif /* RFAL_FEATURE_T1T */
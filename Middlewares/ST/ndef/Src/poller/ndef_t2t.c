@@ -71,6 +71,8 @@
 #define NDEF_T2T_MAX_OFFSET       (NDEF_T2T_BYTES_PER_SECTOR  * NDEF_T2T_MAX_SECTOR) /*!< Maximum offset allowed                            */
 #define NDEF_T2T_3_BYTES_TLV_LEN    0xFFU         /* FFh indicates the use of 3 bytes got the L field    */
 #define NDEF_T2T_STATIC_MEM_SIZE      48U         /* Static memory size                                  */
+#define NDEF_T2T_FAST_READ_MAX_LEN   240U         /*!< Max bytes per FAST_READ, fits RFAL_NFC_RF_BUF_LEN */
+#define NDEF_T2T_CACHE_SECTORS    ((NDEF_T2T_CACHE_BLOCKS + NDEF_T2T_BLOCKS_PER_SECTOR - 1U) / NDEF_T2T_BLOCKS_PER_SECTOR) /*!< Sectors covered by the cache */
 
 #define NDEF_T2T_CC_OFFSET            12U         /*!< CC offset                                         */
 #define NDEF_T2T_CC_LEN                4U         /*!< CC length                                         */
@@ -110,7 +112,13 @@
  */
 
 #define ndefT2TisT2TDevice(device) ((((device)->type == RFAL_NFC_LISTEN_TYPE_NFCA) && ((device)->dev.nfca.type == RFAL_NFCA_T2T)))
-#define ndefT2TInvalidateCache(ctx) { (ctx)->subCtx.t2t.cacheAddr = 0xFFFFFFFFU; }
+#define ndefT2TInvalidateCache(ctx) { (void)ST_MEMSET((ctx)->subCtx.t2t.cacheValid, 0x00, NDEF_T2T_CACHE_MAP_LEN); (void)ST_MEMSET((ctx)->subCtx.t2t.cacheDirty, 0x00, NDEF_T2T_CACHE_MAP_LEN); }
+
+#define ndefT2TCacheMapSet(map, bl)   { (map)[(bl) >> 3U] |= (uint8_t)(1U << ((bl) & 7U)); }
+#define ndefT2TCacheMapClr(map, bl)   { (map)[(bl) >> 3U] &= (uint8_t)~(uint8_t)(1U << ((bl) & 7U)); }
+#define ndefT2TCacheMapGet(map, bl)   (((map)[(bl) >> 3U] & (uint8_t)(1U << ((bl) & 7U))) != 0U)
+#define ndefT2TIsBlockCached(ctx, bl) (((bl) < NDEF_T2T_CACHE_BLOCKS) && ndefT2TCacheMapGet((ctx)->subCtx.t2t.cacheValid, (bl)))
+#define ndefT2TIsBlockDirty(ctx, bl)  (((bl) < NDEF_T2T_CACHE_BLOCKS) && ndefT2TCacheMapGet((ctx)->subCtx.t2t.cacheDirty, (bl)))
 
 
 #define ndefT2TIsReadOnlyAccessGranted(ctx)  (((ctx)->cc.t2t.readAccess == 0x0U) && ((ctx)->cc.t2t.writeAccess == 0xFU))
@@ -128,9 +136,16 @@
  ******************************************************************************
  */
 static ReturnCode ndefT2TPollerReadBlock(ndefContext *ctx, uint16_t blockAddr, uint8_t *buf);
+static ReturnCode ndefT2TPollerFastReadBlocks(ndefContext *ctx, uint16_t blockAddr, uint8_t len, uint8_t *buf);
+static uint8_t ndefT2TPollerGetFastReadLen(ndefContext *ctx, uint32_t offset, uint32_t len);
+static void ndefT2TPollerCacheStore(ndefContext *ctx, uint16_t blockAddr, const uint8_t *buf, uint16_t nBlocks);
+static ReturnCode ndefT2TPollerCacheFill(ndefContext *ctx, uint16_t firstBlock, uint16_t lastBlock);
+static ReturnCode ndefT2TPollerReadBytesDirect(ndefContext *ctx, uint32_t offset, uint32_t len, uint8_t *buf);
 
 #if NDEF_FEATURE_ALL
 static ReturnCode ndefT2TPollerWriteBlock(ndefContext *ctx, uint16_t blockAddr, const uint8_t *buf);
+static ReturnCode ndefT2TPollerCacheFlush(ndefContext *ctx);
+static ReturnCode ndefT2TPollerWriteBytesDirect(ndefContext *ctx, uint32_t offset, const uint8_t *buf, uint32_t len);
 #endif /* NDEF_FEATURE_ALL */
 
 /*
@@ -176,70 +191,267 @@ static ReturnCode ndefT2TPollerReadBlock(ndefContext *ctx, uint16_t blockAddr, u
 }
 
 /*******************************************************************************/
-ReturnCode ndefT2TPollerReadBytes(ndefContext *ctx, uint32_t offset, uint32_t len, uint8_t *buf, uint32_t *rcvdLen)
+static ReturnCode ndefT2TPollerFastReadBlocks(ndefContext *ctx, uint16_t blockAddr, uint8_t len, uint8_t *buf)
 {
     ReturnCode           ret;
-    uint8_t              le;
-    uint32_t             lvOffset = offset;
-    uint32_t             lvLen    = len;
-    uint8_t *            lvBuf    = buf;
-    uint16_t             blockAddr;
-    uint8_t              byteNo;
+    uint8_t              secNo;
+    uint8_t              blNo;
+    uint16_t             rcvdLen;
 
-    if( (ctx == NULL) || !ndefT2TisT2TDevice(&ctx->device) || (lvLen == 0U) || (offset > NDEF_T2T_MAX_OFFSET) )
+    secNo = (uint8_t)(blockAddr >> 8U);
+    blNo  = (uint8_t)blockAddr;
+
+    if( secNo != ctx->subCtx.t2t.currentSecNo )
     {
-        return ERR_PARAM;
+        ret = rfalT2TPollerSectorSelect(secNo);
+        if( ret != ERR_NONE )
+        {
+            return ret;
+        }
+        ctx->subCtx.t2t.currentSecNo = secNo;
     }
 
-    if( (offset >= ctx->subCtx.t2t.cacheAddr) && (offset < (ctx->subCtx.t2t.cacheAddr + NDEF_T2T_READ_RESP_SIZE)) && ((offset + len) < (ctx->subCtx.t2t.cacheAddr + NDEF_T2T_READ_RESP_SIZE)) )
+    ret = rfalT2TPollerFastRead(blNo, (uint8_t)(blNo + ((len / NDEF_T2T_BLOCK_SIZE) - 1U)), buf, len, &rcvdLen);
+
+    if( (ret == ERR_NONE) && (rcvdLen != len) )
     {
-        /* data in cache buffer */
-        (void)ST_MEMCPY(lvBuf, &ctx->subCtx.t2t.cacheBuf[offset - ctx->subCtx.t2t.cacheAddr], len);
+        return ERR_PROTO;
     }
-    else
+
+    return ret;
+}
+
+/*******************************************************************************/
+static uint8_t ndefT2TPollerGetFastReadLen(ndefContext *ctx, uint32_t offset, uint32_t len)
+{
+    ReturnCode           ret;
+    rfalT2TVersion       version;
+    rfalNfcaSensRes      sensRes;
+    rfalNfcaSelRes       selRes;
+    uint32_t             areaEnd;
+    uint32_t             fastLen;
+
+    /* FAST_READ must not go beyond the T2T area as the device NACKs past its memory end */
+    areaEnd = NDEF_T2T_AREA_OFFSET + ctx->areaLen;
+    if( (ctx->areaLen == 0U) || (offset >= areaEnd) )
+    {
+        return 0U;
+    }
+
+    fastLen = MIN( len, (areaEnd - offset) );
+    fastLen = MIN( fastLen, (NDEF_T2T_BYTES_PER_SECTOR - (offset % NDEF_T2T_BYTES_PER_SECTOR)) );
+    fastLen = MIN( fastLen, NDEF_T2T_FAST_READ_MAX_LEN );
+    fastLen = ((fastLen / NDEF_T2T_BLOCK_SIZE) * NDEF_T2T_BLOCK_SIZE);
+
+    /* Only worth it when replacing more than a single READ, and more than two while the GET_VERSION probe is pending */
+    if( (fastLen <= NDEF_T2T_READ_RESP_SIZE) || (!ctx->subCtx.t2t.versionChecked && (fastLen <= (2U * NDEF_T2T_READ_RESP_SIZE))) )
+    {
+        return 0U;
+    }
+
+    if( !ctx->subCtx.t2t.versionChecked )
+    {
+        ctx->subCtx.t2t.versionChecked = true;
+
+        ret = rfalT2TPollerGetVersion(&version);
+        if( ret == ERR_NONE )
+        {
+            ctx->subCtx.t2t.fastReadSupported = ( (version.vendorId == RFAL_T2T_VERSION_VENDOR_NXP) &&
+                                                  ((version.prodType == RFAL_T2T_VERSION_TYPE_UL) || (version.prodType == RFAL_T2T_VERSION_TYPE_NTAG)) );
+        }
+        else
+        {
+            /* Devices not supporting GET_VERSION fall back to IDLE: wake it up and select it again */
+            (void)rfalNfcaPollerCheckPresence(RFAL_14443A_SHORTFRAME_CMD_WUPA, &sensRes);
+            (void)rfalNfcaPollerSelect(ctx->device.dev.nfca.nfcId1, ctx->device.dev.nfca.nfcId1Len, &selRes);
+            ctx->subCtx.t2t.currentSecNo = 0U;
+        }
+    }
+
+    return (ctx->subCtx.t2t.fastReadSupported ? (uint8_t)fastLen : 0U);
+}
+
+/*******************************************************************************/
+static void ndefT2TPollerCacheStore(ndefContext *ctx, uint16_t blockAddr, const uint8_t *buf, uint16_t nBlocks)
+{
+    uint16_t             i;
+    uint16_t             bl;
+    uint8_t *            dst;
+
+    for( i = 0U; (i < nBlocks) && (((uint32_t)blockAddr + i) < NDEF_T2T_CACHE_BLOCKS); i++ )
     {
-        do {
-            blockAddr = (uint16_t)(lvOffset / NDEF_T2T_BLOCK_SIZE);
-            byteNo    =  (uint8_t)(lvOffset % NDEF_T2T_BLOCK_SIZE);
-            le = (lvLen < NDEF_T2T_READ_RESP_SIZE) ? (uint8_t)lvLen : (uint8_t)NDEF_T2T_READ_RESP_SIZE;
+        bl = blockAddr + i;
 
-            if( (byteNo != 0U ) || (lvLen < NDEF_T2T_READ_RESP_SIZE) )
+        /* Never overwrite data still pending write back */
+        if( !ndefT2TIsBlockDirty(ctx, bl) )
+        {
+            dst = &ctx->subCtx.t2t.cacheBuf[(uint32_t)bl * NDEF_T2T_BLOCK_SIZE];
+            if( dst != &buf[(uint32_t)i * NDEF_T2T_BLOCK_SIZE] )
             {
-                ret = ndefT2TPollerReadBlock(ctx, blockAddr, ctx->subCtx.t2t.cacheBuf);
+                (void)ST_MEMCPY(dst, &buf[(uint32_t)i * NDEF_T2T_BLOCK_SIZE], NDEF_T2T_BLOCK_SIZE);
+            }
+            ndefT2TCacheMapSet(ctx->subCtx.t2t.cacheValid, bl);
+        }
+    }
+}
+
+/*******************************************************************************/
+static ReturnCode ndefT2TPollerCacheFill(ndefContext *ctx, uint16_t firstBlock, uint16_t lastBlock)
+{
+    ReturnCode           ret;
+    uint16_t             bl;
+    uint16_t             runEnd;
+    uint16_t             limit;
+    uint8_t              fastLen;
+    uint8_t              tempBuf[NDEF_T2T_READ_RESP_SIZE];
+
+    /* READ returns four blocks and rolls over at the memory end: keep the extra *
+     * blocks only where the memory surely exists i.e. within the T2T area        */
+    limit = (uint16_t)((NDEF_T2T_AREA_OFFSET + ((ctx->areaLen != 0U) ? ctx->areaLen : NDEF_T2T_STATIC_MEM_SIZE)) / NDEF_T2T_BLOCK_SIZE);
+
+    bl = firstBlock;
+    while( bl <= lastBlock )
+    {
+        if( ndefT2TIsBlockCached(ctx, bl) )
+        {
+            bl++;
+        }
+        else
+        {
+            /* Fetch the whole run of missing blocks at once */
+            runEnd = bl;
+            while( (runEnd < lastBlock) && !ndefT2TIsBlockCached(ctx, (runEnd + 1U)) )
+            {
+                runEnd++;
+            }
+
+            fastLen = ndefT2TPollerGetFastReadLen(ctx, ((uint32_t)bl * NDEF_T2T_BLOCK_SIZE), (((uint32_t)runEnd - bl + 1U) * NDEF_T2T_BLOCK_SIZE));
+            if( fastLen > 0U )
+            {
+                ret = ndefT2TPollerFastReadBlocks(ctx, bl, fastLen, &ctx->subCtx.t2t.cacheBuf[(uint32_t)bl * NDEF_T2T_BLOCK_SIZE]);
                 if( ret != ERR_NONE )
                 {
-                    ndefT2TInvalidateCache(ctx);
                     return ret;
                 }
-                ctx->subCtx.t2t.cacheAddr = (uint32_t)blockAddr * NDEF_T2T_BLOCK_SIZE;
-                if( (NDEF_T2T_READ_RESP_SIZE - byteNo) < le )
-                {
-                    le = NDEF_T2T_READ_RESP_SIZE - byteNo;
-                }
-                if( le > 0U)
-                {
-                    (void)ST_MEMCPY(lvBuf, &ctx->subCtx.t2t.cacheBuf[byteNo], le);
-                }
+                ndefT2TPollerCacheStore(ctx, bl, &ctx->subCtx.t2t.cacheBuf[(uint32_t)bl * NDEF_T2T_BLOCK_SIZE], ((uint16_t)fastLen / NDEF_T2T_BLOCK_SIZE));
+                bl += ((uint16_t)fastLen / NDEF_T2T_BLOCK_SIZE);
             }
             else
             {
-                ret = ndefT2TPollerReadBlock(ctx, blockAddr, lvBuf);
+                ret = ndefT2TPollerReadBlock(ctx, bl, tempBuf);
                 if( ret != ERR_NONE )
                 {
                     return ret;
                 }
-                if( lvLen == le )
-                {
-                    /* cache the last read block */
-                    (void)ST_MEMCPY(&ctx->subCtx.t2t.cacheBuf[0], lvBuf, NDEF_T2T_READ_RESP_SIZE);
-                    ctx->subCtx.t2t.cacheAddr = (uint32_t)blockAddr * NDEF_T2T_BLOCK_SIZE;
-                }
+                ndefT2TPollerCacheStore(ctx, bl, tempBuf, MIN( (NDEF_T2T_READ_RESP_SIZE / NDEF_T2T_BLOCK_SIZE), (MAX( (runEnd + 1U), limit ) - bl) ));
+                bl++;
             }
-            lvBuf     = &lvBuf[le];
-            lvOffset += le;
-            lvLen    -= le;
+        }
+    }
+
+    return ERR_NONE;
+}
+
+/*******************************************************************************/
+static ReturnCode ndefT2TPollerReadBytesDirect(ndefContext *ctx, uint32_t offset, uint32_t len, uint8_t *buf)
+{
+    ReturnCode           ret;
+    uint8_t              le;
+    uint32_t             lvOffset = offset;
+    uint32_t             lvLen    = len;
+    uint8_t *            lvBuf    = buf;
+    uint16_t             blockAddr;
+    uint8_t              byteNo;
+    uint8_t              fastLen;
+    uint8_t              tempBuf[NDEF_T2T_READ_RESP_SIZE];
+
+    do {
+        blockAddr = (uint16_t)(lvOffset / NDEF_T2T_BLOCK_SIZE);
+        byteNo    =  (uint8_t)(lvOffset % NDEF_T2T_BLOCK_SIZE);
+        le = (lvLen < NDEF_T2T_READ_RESP_SIZE) ? (uint8_t)lvLen : (uint8_t)NDEF_T2T_READ_RESP_SIZE;
+
+        if( (byteNo != 0U ) || (lvLen < NDEF_T2T_READ_RESP_SIZE) )
+        {
+            ret = ndefT2TPollerReadBlock(ctx, blockAddr, tempBuf);
+            if( ret != ERR_NONE )
+            {
+                return ret;
+            }
+            if( (NDEF_T2T_READ_RESP_SIZE - byteNo) < le )
+            {
+                le = NDEF_T2T_READ_RESP_SIZE - byteNo;
+            }
+            if( le > 0U)
+            {
+                (void)ST_MEMCPY(lvBuf, &tempBuf[byteNo], le);
+            }
+        }
+        else
+        {
+            /* Retrieve as many full blocks as possible in a single FAST_READ when supported */
+            fastLen = ndefT2TPollerGetFastReadLen(ctx, lvOffset, lvLen);
+            if( fastLen > 0U )
+            {
+                le  = fastLen;
+                ret = ndefT2TPollerFastReadBlocks(ctx, blockAddr, le, lvBuf);
+            }
+            else
+            {
+                ret = ndefT2TPollerReadBlock(ctx, blockAddr, lvBuf);
+            }
+            if( ret != ERR_NONE )
+            {
+                return ret;
+            }
+        }
+        lvBuf     = &lvBuf[le];
+        lvOffset += le;
+        lvLen    -= le;
+
+    } while( lvLen != 0U );
+
+    return ERR_NONE;
+}
+
+/*******************************************************************************/
+ReturnCode ndefT2TPollerReadBytes(ndefContext *ctx, uint32_t offset, uint32_t len, uint8_t *buf, uint32_t *rcvdLen)
+{
+    ReturnCode           ret;
+    uint32_t             le;
+    uint32_t             lvOffset = offset;
+    uint32_t             lvLen    = len;
+    uint8_t *            lvBuf    = buf;
+
+    if( (ctx == NULL) || !ndefT2TisT2TDevice(&ctx->device) || (lvLen == 0U) || (offset > NDEF_T2T_MAX_OFFSET) )
+    {
+        return ERR_PARAM;
+    }
+
+    /* Serve the part mirrored in the cache, fetching only the missing blocks */
+    if( lvOffset < NDEF_T2T_CACHE_SIZE )
+    {
+        le  = MIN( lvLen, (NDEF_T2T_CACHE_SIZE - lvOffset) );
+        ret = ndefT2TPollerCacheFill(ctx, (uint16_t)(lvOffset / NDEF_T2T_BLOCK_SIZE), (uint16_t)((lvOffset + le - 1U) / NDEF_T2T_BLOCK_SIZE));
+        if( ret != ERR_NONE )
+        {
+            ndefT2TInvalidateCache(ctx);
+            return ret;
+        }
+        (void)ST_MEMCPY(lvBuf, &ctx->subCtx.t2t.cacheBuf[lvOffset], le);
+
+        lvBuf     = &lvBuf[le];
+        lvOffset += le;
+        lvLen    -= le;
+    }
 
-        } while( lvLen != 0U );
+    /* Memory beyond the cache is read straight from the tag */
+    if( lvLen != 0U )
+    {
+        ret = ndefT2TPollerReadBytesDirect(ctx, lvOffset, lvLen, lvBuf);
+        if( ret != ERR_NONE )
+        {
+            return ret;
+        }
     }
 
     if( rcvdLen != NULL )
@@ -259,8 +471,11 @@ ReturnCode ndefT2TPollerContextInitialization(ndefContext *ctx, const rfalNfcDev
 
     (void)ST_MEMCPY(&ctx->device, dev, sizeof(ctx->device));
 
-    ctx->state                   = NDEF_STATE_INVALID;
-    ctx->subCtx.t2t.currentSecNo = 0U;
+    ctx->state                        = NDEF_STATE_INVALID;
+    ctx->areaLen                      = 0U;
+    ctx->subCtx.t2t.currentSecNo      = 0U;
+    ctx->subCtx.t2t.versionChecked    = false;
+    ctx->subCtx.t2t.fastReadSupported = false;
     ndefT2TInvalidateCache(ctx);
 
    return ERR_NONE;
@@ -292,6 +507,9 @@ ReturnCode ndefT2TPollerNdefDetect(ndefContext *ctx, ndefInfo *info)
 
     ctx->state = NDEF_STATE_INVALID;
 
+    /* Start over from a fresh image of the tag memory */
+    ndefT2TInvalidateCache(ctx);
+
     /* Read CC TS T2T v1.0 7.5.1.1 */
     ret = ndefT2TPollerReadBytes(ctx, NDEF_T2T_CC_OFFSET, NDEF_T2T_CC_LEN, ctx->ccBuf, NULL);
     if( ret != ERR_NONE )
@@ -462,24 +680,79 @@ static ReturnCode ndefT2TPollerWriteBlock(ndefContext *ctx, uint16_t blockAddr,
 
     secNo = (uint8_t)(blockAddr >> 8U);
     blNo  = (uint8_t)blockAddr;
+    ret   = ERR_NONE;
 
     if( secNo != ctx->subCtx.t2t.currentSecNo )
     {
         ret = rfalT2TPollerSectorSelect(secNo);
-        if( ret != ERR_NONE )
+        if( ret == ERR_NONE )
         {
-            return ret;
+            ctx->subCtx.t2t.currentSecNo = secNo;
         }
-        ctx->subCtx.t2t.currentSecNo = secNo;
     }
 
-    ret = rfalT2TPollerWrite(blNo, buf);
+    if( ret == ERR_NONE )
+    {
+        ret = rfalT2TPollerWrite(blNo, buf);
+    }
+
+    /* Keep the cache coherent: written data mirrors the tag, otherwise the block content is unknown */
+    if( blockAddr < NDEF_T2T_CACHE_BLOCKS )
+    {
+        ndefT2TCacheMapClr(ctx->subCtx.t2t.cacheDirty, blockAddr);
+        ndefT2TCacheMapClr(ctx->subCtx.t2t.cacheValid, blockAddr);
+        if( ret == ERR_NONE )
+        {
+            ndefT2TPollerCacheStore(ctx, blockAddr, buf, 1U);
+        }
+    }
 
     return ret;
 }
 
 /*******************************************************************************/
-ReturnCode ndefT2TPollerWriteBytes(ndefContext *ctx, uint32_t offset, const uint8_t *buf, uint32_t len)
+static ReturnCode ndefT2TPollerCacheFlush(ndefContext *ctx)
+{
+    ReturnCode           ret;
+    uint16_t             i;
+    uint16_t             bl;
+    uint16_t             lastBl;
+    uint8_t              secNo;
+    uint8_t              startSecNo;
+
+    ret        = ERR_NONE;
+    startSecNo = ctx->subCtx.t2t.currentSecNo;
+
+    /* Write back sector by sector starting with the selected one: each sector is selected at most once */
+    for( i = 0U; (i <= NDEF_T2T_CACHE_SECTORS) && (ret == ERR_NONE); i++ )
+    {
+        secNo = (i == 0U) ? startSecNo : (uint8_t)(i - 1U);
+        if( (i == 0U) || (secNo != startSecNo) )
+        {
+            bl     = (uint16_t)((uint32_t)secNo * NDEF_T2T_BLOCKS_PER_SECTOR);
+            lastBl = (uint16_t)MIN( ((uint32_t)bl + NDEF_T2T_BLOCKS_PER_SECTOR), NDEF_T2T_CACHE_BLOCKS );
+
+            for( ; (bl < lastBl) && (ret == ERR_NONE); bl++ )
+            {
+                if( ndefT2TIsBlockDirty(ctx, bl) )
+                {
+                    ret = ndefT2TPollerWriteBlock(ctx, bl, &ctx->subCtx.t2t.cacheBuf[(uint32_t)bl * NDEF_T2T_BLOCK_SIZE]);
+                }
+            }
+        }
+    }
+
+    if( ret != ERR_NONE )
+    {
+        /* Blocks not written back no longer match the tag */
+        ndefT2TInvalidateCache(ctx);
+    }
+
+    return ret;
+}
+
+/*******************************************************************************/
+static ReturnCode ndefT2TPollerWriteBytesDirect(ndefContext *ctx, uint32_t offset, const uint8_t *buf, uint32_t len)
 {
     ReturnCode           ret;
     uint32_t             lvOffset = offset;
@@ -490,13 +763,6 @@ ReturnCode ndefT2TPollerWriteBytes(ndefContext *ctx, uint32_t offset, const uint
     uint8_t              le;
     uint8_t              tempBuf[NDEF_T2T_READ_RESP_SIZE];
 
-    if( (ctx == NULL) || !ndefT2TisT2TDevice(&ctx->device) || (lvLen == 0U) )
-    {
-        return ERR_PARAM;
-    }
-
-    ndefT2TInvalidateCache(ctx);
-
     do
     {
         blockAddr = (uint16_t)(lvOffset / NDEF_T2T_BLOCK_SIZE);
@@ -540,6 +806,81 @@ ReturnCode ndefT2TPollerWriteBytes(ndefContext *ctx, uint32_t offset, const uint
     return ERR_NONE;
 }
 
+/*******************************************************************************/
+ReturnCode ndefT2TPollerWriteBytes(ndefContext *ctx, uint32_t offset, const uint8_t *buf, uint32_t len)
+{
+    ReturnCode           ret;
+    uint32_t             lvOffset = offset;
+    uint32_t             lvLen    = len;
+    const uint8_t *      lvBuf    = buf;
+    uint32_t             le;
+    uint32_t             from;
+    uint32_t             to;
+    uint16_t             bl;
+    uint16_t             firstBl;
+    uint16_t             lastBl;
+
+    if( (ctx == NULL) || !ndefT2TisT2TDevice(&ctx->device) || (lvLen == 0U) )
+    {
+        return ERR_PARAM;
+    }
+
+    if( lvOffset < NDEF_T2T_CACHE_SIZE )
+    {
+        le      = MIN( lvLen, (NDEF_T2T_CACHE_SIZE - lvOffset) );
+        firstBl = (uint16_t)(lvOffset / NDEF_T2T_BLOCK_SIZE);
+        lastBl  = (uint16_t)((lvOffset + le - 1U) / NDEF_T2T_BLOCK_SIZE);
+
+        /* Partially written blocks need their current content: only fetched if not cached yet */
+        ret = ERR_NONE;
+        if( (lvOffset % NDEF_T2T_BLOCK_SIZE) != 0U )
+        {
+            ret = ndefT2TPollerCacheFill(ctx, firstBl, firstBl);
+        }
+        if( (ret == ERR_NONE) && (((lvOffset + le) % NDEF_T2T_BLOCK_SIZE) != 0U) )
+        {
+            ret = ndefT2TPollerCacheFill(ctx, lastBl, lastBl);
+        }
+        if( ret != ERR_NONE )
+        {
+            ndefT2TInvalidateCache(ctx);
+            return ret;
+        }
+
+        /* Merge into the cache, only blocks actually changing are written back */
+        for( bl = firstBl; bl <= lastBl; bl++ )
+        {
+            from = MAX( lvOffset, ((uint32_t)bl * NDEF_T2T_BLOCK_SIZE) );
+            to   = MIN( (lvOffset + le), (((uint32_t)bl + 1U) * NDEF_T2T_BLOCK_SIZE) );
+
+            if( !ndefT2TIsBlockCached(ctx, bl) || (ST_BYTECMP(&ctx->subCtx.t2t.cacheBuf[from], &lvBuf[from - lvOffset], (to - from)) != 0) )
+            {
+                (void)ST_MEMCPY(&ctx->subCtx.t2t.cacheBuf[from], &lvBuf[from - lvOffset], (to - from));
+                ndefT2TCacheMapSet(ctx->subCtx.t2t.cacheValid, bl);
+                ndefT2TCacheMapSet(ctx->subCtx.t2t.cacheDirty, bl);
+            }
+        }
+
+        ret = ndefT2TPollerCacheFlush(ctx);
+        if( ret != ERR_NONE )
+        {
+            return ret;
+        }
+
+        lvBuf     = &lvBuf[le];
+        lvOffset += le;
+        lvLen    -= le;
+    }
+
+    /* Memory beyond the cache is written straight to the tag */
+    if( lvLen != 0U )
+    {
+        return ndefT2TPollerWriteBytesDirect(ctx, lvOffset, lvBuf, lvLen);
+    }
+
+    return ERR_NONE;
+}
+
 /*******************************************************************************/
 ReturnCode ndefT2TPollerWriteRawMessageLen(ndefContext *ctx, uint32_t rawMessageLen)
 {
@@ -726,20 +1067,22 @@ ReturnCode ndefT2TPollerCheckPresence(ndefContext *ctx)
 {
     ReturnCode           ret;
     uint16_t             blockAddr;
+    uint8_t              tempBuf[NDEF_T2T_READ_RESP_SIZE];
 
     if( (ctx == NULL) || !ndefT2TisT2TDevice(&ctx->device) )
     {
         return ERR_PARAM;
     }
 
+    /* Always go to the tag, the answer refreshes the cached blocks */
     blockAddr = 0U;
-    ret = ndefT2TPollerReadBlock(ctx, blockAddr, ctx->subCtx.t2t.cacheBuf);
+    ret = ndefT2TPollerReadBlock(ctx, blockAddr, tempBuf);
     if( ret != ERR_NONE )
     {
         ndefT2TInvalidateCache(ctx);
         return ret;
     }
-    ctx->subCtx.t2t.cacheAddr = (uint32_t)blockAddr * NDEF_T2T_BLOCK_SIZE;
+    ndefT2TPollerCacheStore(ctx, blockAddr, tempBuf, (NDEF_T2T_READ_RESP_SIZE / NDEF_T2T_BLOCK_SIZE));
     return ERR_NONE;
 }
 
@@ -84,6 +84,9 @@
 #define NDEF_T3T_ATTRIB_INFO_BLOCK_NB         0U /*!< T3T attribute info block number                    */
 #define NDEF_T3T_BLOCKNB_CONF              0x80U /*!< T3T TxRx config value for Read/Write block         */
 #define NDEF_T3T_CHECK_NB_BLOCKS_LEN          1U /*!< T3T Length of the Nb of blocks in the CHECK reply  */
+#define NDEF_T3T_CHECK_MAX_NB_BLOCKS         15U /*!< T3T max nb of blocks fitting a CHECK response       */
+#define NDEF_T3T_UPDATE_MAX_NB_BLOCKS        13U /*!< T3T max nb of blocks fitting an UPDATE command      */
+#define NDEF_T3T_UPDATE_RES_LEN              12U /*!< T3T UPDATE response length including LEN byte       */
 
 #ifdef RFAL_FEATURE_NFCF
 
@@ -115,6 +118,7 @@
  */
 static ReturnCode ndefT3TPollerReadBlocks                    ( ndefContext * ctx, uint16_t blockNum, uint8_t nbBlocks, uint8_t* rxBuf, uint16_t rxBufLen, uint16_t *rcvLen );
 static ReturnCode ndefT3TPollerReadAttributeInformationBlock ( ndefContext * ctx);
+static uint8_t    ndefT3TPollerGetNbBlocks                   ( const ndefContext * ctx, uint8_t nbAdvertised, uint8_t nbMax );
 
 #if NDEF_FEATURE_ALL
 static ReturnCode ndefT3TPollerWriteBlocks                   ( ndefContext * ctx, uint16_t blockNum, uint8_t nbBlocks, const uint8_t* dataBlocks);
@@ -174,7 +178,8 @@ static ReturnCode ndefT3TPollerReadBlocks( ndefContext *ctx, uint16_t blockNum,
     }
     if( requestedDataSize > 0U )
     {
-        (void)ST_MEMCPY( rxBuf, &ctx->subCtx.t3t.rxbuf[NDEF_T3T_CHECK_NB_BLOCKS_LEN], requestedDataSize );
+        /* rxBuf may be the T3T rxbuf itself */
+        (void)ST_MEMMOVE( rxBuf, &ctx->subCtx.t3t.rxbuf[NDEF_T3T_CHECK_NB_BLOCKS_LEN], requestedDataSize );
         if (rcvLen != NULL)
         {
             *rcvLen = requestedDataSize;
@@ -183,119 +188,88 @@ static ReturnCode ndefT3TPollerReadBlocks( ndefContext *ctx, uint16_t blockNum,
     return ERR_NONE;
 }
 
+/*******************************************************************************/
+static uint8_t ndefT3TPollerGetNbBlocks( const ndefContext * ctx, uint8_t nbAdvertised, uint8_t nbMax )
+{
+    uint8_t nbBlocks;
+
+    /* Use the per command limit (Nbr/Nbw) advertised in the Attribute Information Block once known */
+    nbBlocks = ( (ctx->state == NDEF_STATE_INVALID) || (nbAdvertised == 0U) ) ? (uint8_t)NDEF_T3T_NBBLOCKSMAX : nbAdvertised;
+
+    /* ... bounded by the frame size and the T3T context buffers */
+    nbBlocks = MIN( nbBlocks, nbMax );
+    nbBlocks = MIN( nbBlocks, (uint8_t)NDEF_T3T_MAX_NB_BLOCKS );
+
+    return nbBlocks;
+}
+
 /*******************************************************************************/
 ReturnCode ndefT3TPollerReadBytes(ndefContext *ctx, uint32_t offset, uint32_t len, uint8_t *buf, uint32_t *rcvdLen)
 {
-    uint16_t        res;
+    ReturnCode      res      = ERR_NONE;
     uint16_t        nbRead;
-    ReturnCode      result     = ERR_NONE;
-    uint32_t        currentLen = len;
-    uint32_t        lvRcvLen   = 0U;
-    const uint16_t  blockLen   = (uint16_t) NDEF_T3T_BLOCKLEN;
-    uint16_t        startBlock = (uint16_t) (offset / blockLen);
-    uint16_t        startAddr  = (uint16_t) (startBlock * blockLen);
-    uint16_t        startOffset= (uint16_t) (offset -  (uint32_t) startAddr);
-    uint16_t        nbBlocks   = (uint16_t) NDEF_T3T_NBBLOCKSMAX;
+    uint32_t        lvRcvLen = 0U;
+    uint32_t        chunkAddr;
+    uint32_t        chunkEnd;
+    uint32_t        from;
+    uint32_t        to;
+    uint16_t        block;
+    uint16_t        endBlock;
+    uint8_t         nbBlocks;
+    uint8_t         nbMax;
 
     if( (ctx == NULL) || !ndefT3TisT3TDevice(&ctx->device) || (len == 0U) )
     {
         return ERR_PARAM;
     }
-    if (ctx->state != NDEF_STATE_INVALID)
-    {
-        nbBlocks = ctx->cc.t3t.nbR;
-    }
 
-    if ( startOffset != 0U )
+    nbMax    = ndefT3TPollerGetNbBlocks(ctx, ctx->cc.t3t.nbR, NDEF_T3T_CHECK_MAX_NB_BLOCKS);
+    block    = (uint16_t)(offset / NDEF_T3T_BLOCKLEN);
+    endBlock = (uint16_t)((offset + len - 1U) / NDEF_T3T_BLOCKLEN);
+
+    /* Issue back to back CHECKs of Nbr blocks, unaligned head and tail being part of them */
+    while( block <= endBlock )
     {
-        /* Unaligned read, need to use a tmp buffer */
-        res = ndefT3TPollerReadBlocks(ctx, startBlock, 1U /* One block */ , ctx->subCtx.t3t.rxbuf, blockLen, &nbRead);
-        if (res != ERR_NONE)
-        {
-            /* Check result */
-            result = res;
-        }
-        else if (nbRead != NDEF_T3T_BLOCKLEN)
+        nbBlocks  = (uint8_t)MIN( (uint32_t)nbMax, ((uint32_t)endBlock - block + 1U) );
+        chunkAddr = (uint32_t)block * NDEF_T3T_BLOCKLEN;
+        chunkEnd  = chunkAddr + ((uint32_t)nbBlocks * NDEF_T3T_BLOCKLEN);
+        from      = MAX( offset, chunkAddr );
+        to        = MIN( (offset + len), chunkEnd );
+
+        if( (from == chunkAddr) && (to == chunkEnd) )
         {
-            /* Check len */
-            result = ERR_MEM_CORRUPT;
+            /* Whole blocks: straight into the caller buffer */
+            res = ndefT3TPollerReadBlocks(ctx, block, nbBlocks, &buf[from - offset], (uint16_t)(to - from), &nbRead);
         }
         else
         {
-            nbRead = (uint16_t) (nbRead - (uint16_t)startOffset);
-            if ((uint32_t) nbRead > currentLen)
+            /* Partial blocks: through the T3T rxbuf */
+            res = ndefT3TPollerReadBlocks(ctx, block, nbBlocks, ctx->subCtx.t3t.rxbuf, (uint16_t)sizeof(ctx->subCtx.t3t.rxbuf), &nbRead);
+            if( res == ERR_NONE )
             {
-                nbRead = (uint16_t) currentLen;
+                (void)ST_MEMCPY(&buf[from - offset], &ctx->subCtx.t3t.rxbuf[from - chunkAddr], (to - from));
             }
-            if (nbRead > 0U)
-            {
-                (void)ST_MEMCPY(buf, &ctx->subCtx.t3t.rxbuf[offset], (uint32_t)nbRead);
-            }
-            lvRcvLen   += (uint32_t) nbRead;
-            currentLen -= (uint32_t) nbRead;
-            startBlock++;
-        }
-    }
-
-    while ( (currentLen >= (uint32_t)blockLen) && (result == ERR_NONE) )
-    {
-        if ( currentLen <  ((uint32_t)blockLen * nbBlocks) )
-        {
-              /* Reduce the nb of blocks to read */
-              nbBlocks =  (uint16_t) (currentLen / blockLen);
-        }
-        res = ndefT3TPollerReadBlocks(ctx, startBlock, (uint8_t)nbBlocks, ctx->subCtx.t3t.rxbuf, blockLen * nbBlocks, &nbRead);
-        if (res != ERR_NONE)
-        {
-            /* Check result */
-            return res;
-        }
-        else if (nbRead != (blockLen * nbBlocks))
-        {
-            /* Check len */
-            return ERR_MEM_CORRUPT;
-        }
-        else
-        {
-            (void)ST_MEMCPY(&buf[lvRcvLen], ctx->subCtx.t3t.rxbuf, (uint32_t)currentLen);
-            lvRcvLen   += nbRead;
-            currentLen -= nbRead;
-            startBlock += nbBlocks;
         }
-    }
-    if  ( (currentLen > 0U) && (result == ERR_NONE) )
-    {
-        /* Unaligned read, need to use a tmp buffer */
-        res = ndefT3TPollerReadBlocks(ctx, startBlock, 1U /* One block */, ctx->subCtx.t3t.rxbuf, blockLen, &nbRead);
-        if (res != ERR_NONE)
+        if( res != ERR_NONE )
         {
-            /* Check result */
-            return res;
+            break;
         }
-        else if (nbRead != NDEF_T3T_BLOCKLEN)
+        if( nbRead != (uint16_t)(chunkEnd - chunkAddr) )
         {
             /* Check len */
-            return ERR_MEM_CORRUPT;
-        }
-        else
-        {
-            if (currentLen > 0U)
-            {
-                (void)ST_MEMCPY(&buf[lvRcvLen], ctx->subCtx.t3t.rxbuf, (uint32_t)currentLen);
-            }
-            lvRcvLen   += (uint32_t) currentLen;
-            currentLen -= (uint32_t) currentLen;
+            res = ERR_MEM_CORRUPT;
+            break;
         }
+
+        lvRcvLen += (to - from);
+        block    += nbBlocks;
     }
-    if ( (currentLen == 0U) && (result == ERR_NONE) )
-    {
-        result = ERR_NONE;
-    }
+
     if( rcvdLen != NULL )
     {
         *rcvdLen = lvRcvLen;
     }
-    return result;
+    return res;
 }
 
 /*******************************************************************************/
@@ -489,6 +463,7 @@ static ReturnCode ndefT3TPollerWriteBlocks( ndefContext * ctx, uint16_t blockNum
     rfalNfcfServBlockListParam servBlock;
     rfalNfcfBlockListElem  *   listBlocks;
     uint8_t                    index;
+    uint8_t                    updateRes[NDEF_T3T_UPDATE_RES_LEN];
     rfalNfcfServ               serviceCodeLst = 0x0009U;
 
     if( (ctx == NULL) || !ndefT3TisT3TDevice(&ctx->device) )
@@ -509,7 +484,8 @@ static ReturnCode ndefT3TPollerWriteBlocks( ndefContext * ctx, uint16_t blockNum
     servBlock.numBlock  = nbBlocks;
     servBlock.blockList = listBlocks;
 
-    ret = rfalNfcfPollerUpdate( ctx->device.dev.nfcf.sensfRes.NFCID2, &servBlock, ctx->subCtx.t3t.txbuf, (uint16_t)sizeof(ctx->subCtx.t3t.txbuf), dataBlocks, ctx->subCtx.t3t.rxbuf, (uint16_t)sizeof(ctx->subCtx.t3t.rxbuf));
+    /* Response in a local buffer: dataBlocks may be staged in the T3T rxbuf */
+    ret = rfalNfcfPollerUpdate( ctx->device.dev.nfcf.sensfRes.NFCID2, &servBlock, ctx->subCtx.t3t.txbuf, (uint16_t)sizeof(ctx->subCtx.t3t.txbuf), dataBlocks, updateRes, (uint16_t)sizeof(updateRes));
 
     return ret;
 }
@@ -517,119 +493,98 @@ static ReturnCode ndefT3TPollerWriteBlocks( ndefContext * ctx, uint16_t blockNum
 /*******************************************************************************/
 ReturnCode ndefT3TPollerWriteBytes(ndefContext *ctx, uint32_t offset, const uint8_t *buf, uint32_t len)
 {
+    ReturnCode      res;
     uint16_t        nbRead;
-    uint16_t        nbWrite;
-    uint16_t        res;
-    ReturnCode      result     = ERR_NONE;
-    uint32_t        currentLen = len;
-    uint32_t        txtLen     = 0U;
-    const uint16_t  blockLen   = (uint16_t )NDEF_T3T_BLOCKLEN;
-    uint16_t        nbBlocks   = (uint16_t ) NDEF_T3T_NBBLOCKSMAX;
-    uint16_t        startBlock = (uint16_t) (offset / blockLen);
-    uint16_t        startAddr  = (uint16_t) (startBlock * blockLen);
-    uint16_t        startOffset= (uint16_t) (offset -  (uint32_t) startAddr);
-    uint8_t         tmpBuf[NDEF_T3T_BLOCKLEN];
+    uint32_t        chunkAddr;
+    uint32_t        chunkEnd;
+    uint32_t        from;
+    uint32_t        to;
+    uint16_t        block;
+    uint16_t        startBlock;
+    uint16_t        endBlock;
+    uint8_t         nbBlocks;
+    uint8_t         nbMax;
+    uint8_t         headBuf[NDEF_T3T_BLOCKLEN];
+    uint8_t         tailBuf[NDEF_T3T_BLOCKLEN];
 
     if( (ctx == NULL) || !ndefT3TisT3TDevice(&ctx->device) || (len == 0U) )
     {
         return ERR_PARAM;
     }
-    if (ctx->state != NDEF_STATE_INVALID)
-    {
-        nbBlocks = ctx->cc.t3t.nbW;
-    }
 
-    if ( startOffset != 0U )
+    nbMax      = ndefT3TPollerGetNbBlocks(ctx, ctx->cc.t3t.nbW, NDEF_T3T_UPDATE_MAX_NB_BLOCKS);
+    startBlock = (uint16_t)(offset / NDEF_T3T_BLOCKLEN);
+    endBlock   = (uint16_t)((offset + len - 1U) / NDEF_T3T_BLOCKLEN);
+
+    /* Unaligned head and tail: retrieve the current content of the partially written blocks */
+    if( (offset % NDEF_T3T_BLOCKLEN) != 0U )
     {
-        /* Unaligned write, need to use a tmp buffer */
-        res = ndefT3TPollerReadBlocks(ctx, startBlock, 1, tmpBuf, blockLen, &nbRead);
-        if (res != ERR_NONE)
+        res = ndefT3TPollerReadBlocks(ctx, startBlock, 1U /* One block */, headBuf, NDEF_T3T_BLOCKLEN, &nbRead);
+        if( (res == ERR_NONE) && (nbRead != NDEF_T3T_BLOCKLEN) )
         {
-            /* Check result */
-            result = res;
+            res = ERR_MEM_CORRUPT;
         }
-        else if (nbRead != blockLen)
+        if( res != ERR_NONE )
         {
-            /* Check len */
-            result = ERR_MEM_CORRUPT;
-        }
-        else
-        {
-            /* Fill the rest of the buffer with user data */
-            nbWrite =  NDEF_T3T_BLOCKLEN - startOffset;
-            if (nbWrite >  len)
-            {
-                 nbWrite = (uint16_t) len;
-            }
-            (void)ST_MEMCPY(&tmpBuf[startOffset], buf, nbWrite);
-            res = ndefT3TPollerWriteBlocks(ctx, startBlock, 1U /* One block */, tmpBuf);
-            if (res == ERR_NONE)
-            {
-                txtLen     += (uint32_t) nbWrite;
-                currentLen -= (uint32_t) nbWrite;
-                startBlock++;
-            }
-            else
-            {
-                result = res; /* Copy the error code */
-            }
+            return res;
         }
     }
-    while ( (currentLen >= (uint32_t)blockLen) && (result == ERR_NONE) )
+    if( ((offset + len) % NDEF_T3T_BLOCKLEN) != 0U )
     {
-        if ( currentLen <  ((uint32_t)blockLen * nbBlocks) )
+        if( (endBlock == startBlock) && ((offset % NDEF_T3T_BLOCKLEN) != 0U) )
         {
-              /* Reduce the nb of blocks to read */
-              nbBlocks = (uint16_t) (currentLen / blockLen);
-        }
-        nbWrite = blockLen * nbBlocks;
-        res     = ndefT3TPollerWriteBlocks(ctx, startBlock, (uint8_t) nbBlocks, &buf[txtLen]);
-        if (res != ERR_NONE)
-        {
-            /* Check result */
-            result = res;
+            (void)ST_MEMCPY(tailBuf, headBuf, NDEF_T3T_BLOCKLEN);
         }
         else
         {
-            txtLen     += nbWrite;
-            currentLen -= nbWrite;
-            startBlock += nbBlocks;
+            res = ndefT3TPollerReadBlocks(ctx, endBlock, 1U /* One block */, tailBuf, NDEF_T3T_BLOCKLEN, &nbRead);
+            if( (res == ERR_NONE) && (nbRead != NDEF_T3T_BLOCKLEN) )
+            {
+                res = ERR_MEM_CORRUPT;
+            }
+            if( res != ERR_NONE )
+            {
+                return res;
+            }
         }
     }
-    if ( (currentLen > 0U) && (result == ERR_NONE) )
+
+    /* Issue UPDATEs of Nbw blocks, unaligned head and tail being merged in them */
+    block = startBlock;
+    res   = ERR_NONE;
+    while( (block <= endBlock) && (res == ERR_NONE) )
     {
-        /* Unaligned write, need to use a tmp buffer */
-        res = ndefT3TPollerReadBlocks(ctx, startBlock, 1U /* One block */, tmpBuf, blockLen, &nbRead);
-        if (res != ERR_NONE)
+        nbBlocks  = (uint8_t)MIN( (uint32_t)nbMax, ((uint32_t)endBlock - block + 1U) );
+        chunkAddr = (uint32_t)block * NDEF_T3T_BLOCKLEN;
+        chunkEnd  = chunkAddr + ((uint32_t)nbBlocks * NDEF_T3T_BLOCKLEN);
+        from      = MAX( offset, chunkAddr );
+        to        = MIN( (offset + len), chunkEnd );
+
+        if( (from == chunkAddr) && (to == chunkEnd) )
         {
-            /* Check result */
-            result = res;
-        }
-        else if (nbRead != blockLen)
-        {
-            /* Check len */
-            result = ERR_MEM_CORRUPT;
+            /* Whole blocks: straight from the caller buffer */
+            res = ndefT3TPollerWriteBlocks(ctx, block, nbBlocks, &buf[from - offset]);
         }
         else
         {
-            /* Fill the beginning of the buffer with user data */
-            (void)ST_MEMCPY( tmpBuf, &buf[txtLen], currentLen);
-            res = ndefT3TPollerWriteBlocks(ctx, startBlock, 1U /* One block */, tmpBuf);
-            if (res == ERR_NONE)
+            /* Stage the partial blocks in the T3T rxbuf */
+            if( from != chunkAddr )
             {
-                currentLen = 0U;
+                (void)ST_MEMCPY(ctx->subCtx.t3t.rxbuf, headBuf, NDEF_T3T_BLOCKLEN);
             }
-            else
+            if( to != chunkEnd )
             {
-                result = res; /* Copy the error code */
+                (void)ST_MEMCPY(&ctx->subCtx.t3t.rxbuf[chunkEnd - chunkAddr - NDEF_T3T_BLOCKLEN], tailBuf, NDEF_T3T_BLOCKLEN);
             }
+            (void)ST_MEMCPY(&ctx->subCtx.t3t.rxbuf[from - chunkAddr], &buf[from - offset], (to - from));
+
+            res = ndefT3TPollerWriteBlocks(ctx, block, nbBlocks, ctx->subCtx.t3t.rxbuf);
         }
+
+        block += nbBlocks;
     }
-    if ( (currentLen == 0U) && (result == ERR_NONE) )
-    {
-        result = ERR_NONE;
-    }
-    return result;
+
+    return res;
 }
 
 /*******************************************************************************/
@@ -68,7 +68,12 @@
  */
 
 #define NDEF_T4T_FID_SIZE              2U        /*!< File Id size                                      */
+#define NDEF_T4T_FID_MF           0x3F00U        /*!< Master File Id, selecting it leaves the application */
+#define NDEF_T4T_CAPDU_INS_POS         1U        /*!< INS position in a C-APDU                          */
+#define NDEF_T4T_CAPDU_P1_POS          2U        /*!< P1 position in a C-APDU                           */
+#define NDEF_T4T_CAPDU_LC_POS          4U        /*!< Lc position in a C-APDU                           */
 #define NDEF_T4T_WRITE_ODO_PREFIX_SIZE 7U        /*!< Size of ODO for Write Binary: 54 03 xxyyzz 53 Ld  */
+#define NDEF_T4T_BER_SHORT_LEN_MAX  0x7FU        /*!< Max Ld coded on 1 byte (81h Ld / 82h LdLd beyond) */
 
 #define NDEF_T4T_DEFAULT_MLC      0x000DU        /*!< Defauit Max Lc value before reading CCFILE values */
 #define NDEF_T4T_DEFAULT_MLE      0x000FU        /*!< Defauit Max Le value before reading CCFILE values */
@@ -95,8 +100,10 @@
 
 #define NDEF_T4T_MV2_MAX_OFSSET   0x7FFFU        /*!< ReadBinary maximum Offset (offset range 0000-7FFFh)*/
 
-#define NDEF_T4T_MAX_MLE             255U        /*!< Maximum MLe value supported in this implementation (short field coding). Le=0 (MLe=256) not supported by some tag. */
-#define NDEF_T4T_MAX_MLC             255U        /*!< Maximum MLc value supported in this implementation (short field coding).                                           */
+#define NDEF_T4T_MAX_SHORT_MLE       255U        /*!< Maximum MLe value with short field coding. Le=0 (MLe=256) not supported by some tag.      */
+#define NDEF_T4T_MAX_SHORT_MLC       255U        /*!< Maximum MLc value with short field coding.                                                */
+#define NDEF_T4T_MAX_MLE  (RFAL_FEATURE_ISO_DEP_APDU_MAX_LEN - RFAL_T4T_MAX_RAPDU_SW1SW2_LEN)                      /*!< Maximum MLe value supported in this implementation: R-APDU fits the APDU buffer */
+#define NDEF_T4T_MAX_MLC  (RFAL_FEATURE_ISO_DEP_APDU_MAX_LEN - RFAL_T4T_MAX_CAPDU_PROLOGUE_LEN - RFAL_T4T_LC_EXT_LEN) /*!< Maximum MLc value supported in this implementation: C-APDU fits the APDU buffer */
 
 /*
  ******************************************************************************
@@ -126,6 +133,10 @@
 static void ndefT4TInitializeIsoDepTxRxParam(ndefContext *ctx, rfalIsoDepApduTxRxParam *isoDepAPDU);
 static ReturnCode ndefT4TTransceiveTxRx(ndefContext *ctx, rfalIsoDepApduTxRxParam *isoDepAPDU);
 static ReturnCode ndefT4TReadAndParseCCFile(ndefContext *ctx);
+static bool ndefT4TParseSelect(const rfalIsoDepApduTxRxParam *isoDepAPDU, uint8_t *p1, const uint8_t **id, uint8_t *idLen);
+static bool ndefT4TSelectElide(ndefContext *ctx, const rfalIsoDepApduTxRxParam *isoDepAPDU);
+static void ndefT4TSelectCacheUpdate(ndefContext *ctx, const rfalIsoDepApduTxRxParam *isoDepAPDU, ReturnCode ret);
+static void ndefT4TSelectCacheReset(ndefContext *ctx);
 
 /*
  ******************************************************************************
@@ -144,7 +155,6 @@ static void ndefT4TInitializeIsoDepTxRxParam(ndefContext *ctx, rfalIsoDepApduTxR
     isoDepAPDU->FSx          = ctx->device.proto.isoDep.info.FSx;
     isoDepAPDU->ourFSx       = RFAL_ISODEP_FSX_KEEP;
     isoDepAPDU->rxBuf        = &ctx->subCtx.t4t.rApduBuf;
-    isoDepAPDU->tmpBuf       = &ctx->subCtx.t4t.tmpBuf;
 }
 
 /*******************************************************************************/
@@ -166,17 +176,121 @@ static ReturnCode ndefT4TTransceiveTxRx(ndefContext *ctx, rfalIsoDepApduTxRxPara
         } while (ret == ERR_BUSY);
     }
     
-    if (ret != ERR_NONE)
+    if (ret == ERR_NONE)
     {
-        return ret;
+        ret = rfalT4TPollerParseRAPDU(&ctx->subCtx.t4t.respAPDU);
+        ctx->subCtx.t4t.rApduBodyLen = ctx->subCtx.t4t.respAPDU.rApduBodyLen;
     }
-
-    ret = rfalT4TPollerParseRAPDU(&ctx->subCtx.t4t.respAPDU);
-    ctx->subCtx.t4t.rApduBodyLen = ctx->subCtx.t4t.respAPDU.rApduBodyLen;
+    
+    ndefT4TSelectCacheUpdate(ctx, isoDepAPDU, ret);
     
     return ret;
 }
 
+/*******************************************************************************/
+static bool ndefT4TParseSelect(const rfalIsoDepApduTxRxParam *isoDepAPDU, uint8_t *p1, const uint8_t **id, uint8_t *idLen)
+{
+    const uint8_t *apdu = isoDepAPDU->txBuf->apdu;
+    
+    if( (isoDepAPDU->txBufLen < RFAL_T4T_MAX_CAPDU_PROLOGUE_LEN) || (apdu[NDEF_T4T_CAPDU_INS_POS] != (uint8_t)RFAL_T4T_INS_SELECT) )
+    {
+        return false;
+    }
+    
+    *p1    = apdu[NDEF_T4T_CAPDU_P1_POS];
+    *id    = &apdu[NDEF_T4T_CAPDU_LC_POS + RFAL_T4T_LC_LEN];
+    *idLen = 0U;
+    
+    /* Only the short field coding identifies an application or file, anything else is reported with idLen 0 */
+    if( isoDepAPDU->txBufLen > NDEF_T4T_CAPDU_LC_POS )
+    {
+        if( ((uint16_t)NDEF_T4T_CAPDU_LC_POS + RFAL_T4T_LC_LEN + apdu[NDEF_T4T_CAPDU_LC_POS]) <= isoDepAPDU->txBufLen )
+        {
+            *idLen = apdu[NDEF_T4T_CAPDU_LC_POS];
+        }
+    }
+    return true;
+}
+
+/*******************************************************************************/
+static bool ndefT4TSelectElide(ndefContext *ctx, const rfalIsoDepApduTxRxParam *isoDepAPDU)
+{
+    const uint8_t *id;
+    uint8_t        idLen;
+    uint8_t        p1;
+    bool           cached;
+    
+    if( !ndefT4TParseSelect(isoDepAPDU, &p1, &id, &idLen) || (idLen == 0U) )
+    {
+        return false;
+    }
+    
+    if( p1 == RFAL_T4T_ISO7816_P1_SELECT_BY_DF_NAME )
+    {
+        cached = (idLen == ctx->subCtx.t4t.selAidLen) && (ST_BYTECMP(id, ctx->subCtx.t4t.selAid, idLen) == 0);
+    }
+    else if( p1 == RFAL_T4T_ISO7816_P1_SELECT_BY_FILEID )
+    {
+        cached = ctx->subCtx.t4t.selFidValid && (idLen == NDEF_T4T_FID_SIZE) && (ST_BYTECMP(id, ctx->subCtx.t4t.selFid, NDEF_T4T_FID_SIZE) == 0);
+    }
+    else
+    {
+        cached = false;
+    }
+    
+    if( cached )
+    {
+        /* Already selected on the tag: report the SELECT as completed without any response body */
+        ctx->subCtx.t4t.respAPDU.statusWord   = RFAL_T4T_ISO7816_STATUS_COMPLETE;
+        ctx->subCtx.t4t.respAPDU.rApduBodyLen = 0U;
+        ctx->subCtx.t4t.rApduBodyLen          = 0U;
+    }
+    return cached;
+}
+
+/*******************************************************************************/
+static void ndefT4TSelectCacheUpdate(ndefContext *ctx, const rfalIsoDepApduTxRxParam *isoDepAPDU, ReturnCode ret)
+{
+    const uint8_t *id;
+    uint8_t        idLen;
+    uint8_t        p1;
+    
+    if( !ndefT4TParseSelect(isoDepAPDU, &p1, &id, &idLen) )
+    {
+        /* Other commands keep the selection, unless the link to the tag failed */
+        if( (ret != ERR_NONE) && (ret != ERR_REQUEST) )
+        {
+            ndefT4TSelectCacheReset(ctx);
+        }
+        return;
+    }
+    
+    if( (ret == ERR_NONE) && (p1 == RFAL_T4T_ISO7816_P1_SELECT_BY_DF_NAME) && (idLen != 0U) && (idLen <= NDEF_T4T_AID_MAX_LEN) )
+    {
+        (void)ST_MEMCPY(ctx->subCtx.t4t.selAid, id, idLen);
+        ctx->subCtx.t4t.selAidLen   = idLen;
+        ctx->subCtx.t4t.selFidValid = false;
+    }
+    /* T4T files selected by Id are EFs of the current application, except the MF */
+    else if( (ret == ERR_NONE) && (p1 == RFAL_T4T_ISO7816_P1_SELECT_BY_FILEID) && (idLen == NDEF_T4T_FID_SIZE) && (GETU16(id) != NDEF_T4T_FID_MF) )
+    {
+        (void)ST_MEMCPY(ctx->subCtx.t4t.selFid, id, NDEF_T4T_FID_SIZE);
+        ctx->subCtx.t4t.selFidValid = true;
+    }
+    else
+    {
+        /* Failed or not tracked SELECT: the selection on the tag is unknown */
+        ndefT4TSelectCacheReset(ctx);
+    }
+}
+
+/*******************************************************************************/
+static void ndefT4TSelectCacheReset(ndefContext *ctx)
+{
+    ctx->subCtx.t4t.selAidLen   = 0U;
+    ctx->subCtx.t4t.selFidValid = false;
+}
+
 /*******************************************************************************/
 static ReturnCode ndefT4TReadAndParseCCFile(ndefContext *ctx)
 {
@@ -219,8 +333,9 @@ static ReturnCode ndefT4TReadAndParseCCFile(ndefContext *ctx)
         return ERR_REQUEST;
     }
 
-    ctx->subCtx.t4t.curMLe   = (uint8_t)MIN(ctx->cc.t4t.mLe, NDEF_T4T_MAX_MLE); /* Only short field codind supported */
-    ctx->subCtx.t4t.curMLc   = (uint8_t)MIN(ctx->cc.t4t.mLc, NDEF_T4T_MAX_MLC); /* Only short field codind supported */
+    /* Extended field coding is only used when the tag announces more than the short field coding can carry (TS T4T v1.0 5.1.2) */
+    ctx->subCtx.t4t.curMLe   = (ctx->cc.t4t.mLe > NDEF_T4T_MAX_RAPDU_BODY_LEN) ? (uint16_t)MIN(ctx->cc.t4t.mLe, NDEF_T4T_MAX_MLE) : (uint16_t)MIN(ctx->cc.t4t.mLe, NDEF_T4T_MAX_SHORT_MLE);
+    ctx->subCtx.t4t.curMLc   = (uint16_t)MIN(ctx->cc.t4t.mLc, NDEF_T4T_MAX_MLC);
 
     /* TS T4T v1.0 7.2.1.7 and 4.3.2.4 verify support of mapping version */
     if( ndefMajorVersion(ctx->cc.t4t.vNo) > ndefMajorVersion(NDEF_T4T_MAPPING_VERSION_3_0) )
@@ -304,6 +419,11 @@ ReturnCode ndefT4TPollerSelectNdefTagApplication(ndefContext *ctx)
     
     ndefT4TInitializeIsoDepTxRxParam(ctx, &isoDepAPDU);
     (void)rfalT4TPollerComposeSelectAppl(isoDepAPDU.txBuf, NDEF_T4T_AID_NDEF, (uint8_t)sizeof(NDEF_T4T_AID_NDEF), &isoDepAPDU.txBufLen);
+    if( ndefT4TSelectElide(ctx, &isoDepAPDU) )
+    {
+        ctx->subCtx.t4t.mv1Flag = false;
+        return ERR_NONE;
+    }
     ret = ndefT4TTransceiveTxRx(ctx, &isoDepAPDU);
     
     if( ret == ERR_NONE )
@@ -320,6 +440,11 @@ ReturnCode ndefT4TPollerSelectNdefTagApplication(ndefContext *ctx)
 
     /* if v2 application not found, try v1 */
     (void)rfalT4TPollerComposeSelectAppl(isoDepAPDU.txBuf, NDEF_T4T_AID_NDEF_V1, (uint8_t)sizeof(NDEF_T4T_AID_NDEF_V1), &isoDepAPDU.txBufLen);
+    if( ndefT4TSelectElide(ctx, &isoDepAPDU) )
+    {
+        ctx->subCtx.t4t.mv1Flag = true;
+        return ERR_NONE;
+    }
     ret = ndefT4TTransceiveTxRx(ctx, &isoDepAPDU);
     
     if( ret == ERR_NONE )
@@ -351,6 +476,11 @@ ReturnCode ndefT4TPollerSelectFile(ndefContext *ctx, const uint8_t *fileId)
     {
         (void)rfalT4TPollerComposeSelectFile(isoDepAPDU.txBuf, fileId, NDEF_T4T_FID_SIZE, &isoDepAPDU.txBufLen);
     }
+    
+    if( ndefT4TSelectElide(ctx, &isoDepAPDU) )
+    {
+        return ERR_NONE;
+    }
        
     ret = ndefT4TTransceiveTxRx(ctx, &isoDepAPDU);
 
@@ -359,7 +489,7 @@ ReturnCode ndefT4TPollerSelectFile(ndefContext *ctx, const uint8_t *fileId)
 
 
 /*******************************************************************************/
-ReturnCode ndefT4TPollerReadBinary(ndefContext *ctx, uint16_t offset, uint8_t len)
+ReturnCode ndefT4TPollerReadBinary(ndefContext *ctx, uint16_t offset, uint16_t len)
 {
     ReturnCode               ret;
     rfalIsoDepApduTxRxParam  isoDepAPDU;
@@ -377,7 +507,7 @@ ReturnCode ndefT4TPollerReadBinary(ndefContext *ctx, uint16_t offset, uint8_t le
 }
 
 /*******************************************************************************/
-ReturnCode ndefT4TPollerReadBinaryODO(ndefContext *ctx, uint32_t offset, uint8_t len)
+ReturnCode ndefT4TPollerReadBinaryODO(ndefContext *ctx, uint32_t offset, uint16_t len)
 {
     ReturnCode               ret;
     rfalIsoDepApduTxRxParam  isoDepAPDU;
@@ -398,7 +528,7 @@ ReturnCode ndefT4TPollerReadBinaryODO(ndefContext *ctx, uint32_t offset, uint8_t
 ReturnCode ndefT4TPollerReadBytes(ndefContext *ctx, uint32_t offset, uint32_t len, uint8_t *buf, uint32_t *rcvdLen)
 {
     ReturnCode           ret;
-    uint8_t              le;
+    uint16_t             le;
     uint32_t             lvOffset = offset;
     uint32_t             lvLen    = len;
     uint8_t *            lvBuf    = buf;
@@ -413,7 +543,7 @@ ReturnCode ndefT4TPollerReadBytes(ndefContext *ctx, uint32_t offset, uint32_t le
     }
 
     do {
-        le = ( lvLen > ctx->subCtx.t4t.curMLe ) ? ctx->subCtx.t4t.curMLe : (uint8_t)lvLen;
+        le = ( lvLen > ctx->subCtx.t4t.curMLe ) ? ctx->subCtx.t4t.curMLe : (uint16_t)lvLen;
         if( lvOffset > NDEF_T4T_MV2_MAX_OFSSET )
         {
             ret = ndefT4TPollerReadBinaryODO(ctx, lvOffset, le);
@@ -422,6 +552,12 @@ ReturnCode ndefT4TPollerReadBytes(ndefContext *ctx, uint32_t offset, uint32_t le
         {
             ret = ndefT4TPollerReadBinary(ctx, (uint16_t)lvOffset, le);
         }
+        if( (ret == ERR_REQUEST) && (le > NDEF_T4T_MAX_SHORT_MLE) )
+        {
+            /* Extended field coding refused by the tag: fall back to short field coding */
+            ctx->subCtx.t4t.curMLe = NDEF_T4T_MAX_SHORT_MLE;
+            continue;
+        }
         if( ret != ERR_NONE )
         {
             return ret;
@@ -460,6 +596,9 @@ ReturnCode ndefT4TPollerContextInitialization(ndefContext *ctx, const rfalNfcDev
     ctx->state             = NDEF_STATE_INVALID;
     ctx->subCtx.t4t.curMLc = NDEF_T4T_DEFAULT_MLC;
     ctx->subCtx.t4t.curMLe = NDEF_T4T_DEFAULT_MLE;
+    
+    /* Freshly activated: nothing selected yet */
+    ndefT4TSelectCacheReset(ctx);
 
     return ERR_NONE;
 }
@@ -601,10 +740,77 @@ ReturnCode ndefT4TPollerReadRawMessage(ndefContext *ctx, uint8_t *buf, uint32_t
     return ret;
 }
 
+/*******************************************************************************/
+ReturnCode ndefT4TPollerRunScript(ndefContext *ctx, const ndefT4TScriptCmd *script, uint8_t cmdCnt, uint8_t *cmdIdx)
+{
+    ReturnCode               ret;
+    rfalIsoDepApduTxRxParam  isoDepAPDU;
+    const ndefT4TScriptCmd  *cmd;
+    uint8_t                  i;
+
+    if( (ctx == NULL) || !ndefT4TisT4TDevice(&ctx->device) || ((script == NULL) && (cmdCnt != 0U)) )
+    {
+        return ERR_PARAM;
+    }
+
+    ndefT4TInitializeIsoDepTxRxParam(ctx, &isoDepAPDU);
+
+    for( i = 0U; i < cmdCnt; i++ )
+    {
+        cmd = &script[i];
+        if( cmdIdx != NULL )
+        {
+            *cmdIdx = i;
+        }
+        
+        if( (cmd->cApdu == NULL) || (cmd->cApduLen < RFAL_T4T_MAX_CAPDU_PROLOGUE_LEN) || (cmd->cApduLen > sizeof(isoDepAPDU.txBuf->apdu)) )
+        {
+            return ERR_PARAM;
+        }
+        
+        (void)ST_MEMCPY(isoDepAPDU.txBuf->apdu, cmd->cApdu, cmd->cApduLen);
+        isoDepAPDU.txBufLen = cmd->cApduLen;
+        
+        /* A redundant SELECT is only sent when its FCI is wanted */
+        if( (cmd->rspBuf != NULL) || !ndefT4TSelectElide(ctx, &isoDepAPDU) )
+        {
+            ret = ndefT4TTransceiveTxRx(ctx, &isoDepAPDU);
+            if( (ret != ERR_NONE) && (ret != ERR_REQUEST) )
+            {
+                return ret;
+            }
+        }
+        
+        if( ((ctx->subCtx.t4t.respAPDU.statusWord ^ cmd->sw) & cmd->swMask) != 0U )
+        {
+            return ERR_REQUEST;
+        }
+        
+        if( cmd->rspLen != NULL )
+        {
+            *cmd->rspLen = ctx->subCtx.t4t.rApduBodyLen;
+        }
+        if( cmd->rspBuf != NULL )
+        {
+            if( ctx->subCtx.t4t.rApduBodyLen > cmd->rspBufLen )
+            {
+                return ERR_NOMEM;
+            }
+            (void)ST_MEMCPY(cmd->rspBuf, ctx->subCtx.t4t.rApduBuf.apdu, ctx->subCtx.t4t.rApduBodyLen);
+        }
+    }
+    
+    if( cmdIdx != NULL )
+    {
+        *cmdIdx = cmdCnt;
+    }
+    return ERR_NONE;
+}
+
 #if NDEF_FEATURE_ALL
 
 /*******************************************************************************/
-ReturnCode ndefT4TPollerWriteBinary(ndefContext *ctx, uint16_t offset, const uint8_t *data, uint8_t len)
+ReturnCode ndefT4TPollerWriteBinary(ndefContext *ctx, uint16_t offset, const uint8_t *data, uint16_t len)
 {
     ReturnCode               ret;
     rfalIsoDepApduTxRxParam  isoDepAPDU;
@@ -622,7 +828,7 @@ ReturnCode ndefT4TPollerWriteBinary(ndefContext *ctx, uint16_t offset, const uin
 }
 
 /*******************************************************************************/
-ReturnCode ndefT4TPollerWriteBinaryODO(ndefContext *ctx, uint32_t offset, const uint8_t *data, uint8_t len)
+ReturnCode ndefT4TPollerWriteBinaryODO(ndefContext *ctx, uint32_t offset, const uint8_t *data, uint16_t len)
 {
     ReturnCode               ret;
     rfalIsoDepApduTxRxParam  isoDepAPDU;
@@ -643,7 +849,8 @@ ReturnCode ndefT4TPollerWriteBinaryODO(ndefContext *ctx, uint32_t offset, const
 ReturnCode ndefT4TPollerWriteBytes(ndefContext *ctx, uint32_t offset, const uint8_t *buf, uint32_t len)
 {
     ReturnCode           ret;
-    uint8_t              lc;
+    uint16_t             lc;
+    bool                 ext;
     uint32_t             lvOffset = offset;
     uint32_t             lvLen    = len;
     const uint8_t *      lvBuf    = buf;
@@ -657,14 +864,32 @@ ReturnCode ndefT4TPollerWriteBytes(ndefContext *ctx, uint32_t offset, const uint
 
         if( lvOffset > NDEF_T4T_MV2_MAX_OFSSET )
         {
-            lc = ( lvLen > ((uint32_t)ctx->subCtx.t4t.curMLc - NDEF_T4T_WRITE_ODO_PREFIX_SIZE) ) ? (uint8_t)(ctx->subCtx.t4t.curMLc - NDEF_T4T_WRITE_ODO_PREFIX_SIZE) : (uint8_t)lvLen;
+            /* Ld grows to 81h Ld / 82h LdLd beyond 127 / 255 bytes: keep the whole Data DO within MLc */
+            lc = (uint16_t)(ctx->subCtx.t4t.curMLc - NDEF_T4T_WRITE_ODO_PREFIX_SIZE);
+            if( lc > NDEF_T4T_BER_SHORT_LEN_MAX )
+            {
+                lc = (uint16_t)MAX(lc - 1U, NDEF_T4T_BER_SHORT_LEN_MAX);
+            }
+            if( lc > NDEF_T4T_MAX_SHORT_MLC )
+            {
+                lc = (uint16_t)MAX(lc - 1U, NDEF_T4T_MAX_SHORT_MLC);
+            }
+            lc  = ( lvLen > lc ) ? lc : (uint16_t)lvLen;
+            ext = ( ((uint32_t)lc + NDEF_T4T_WRITE_ODO_PREFIX_SIZE + 1U) > NDEF_T4T_MAX_SHORT_MLC );
             ret = ndefT4TPollerWriteBinaryODO(ctx, lvOffset, lvBuf, lc);
         }
         else
         {
-            lc = ( lvLen > ctx->subCtx.t4t.curMLc ) ? ctx->subCtx.t4t.curMLc : (uint8_t)lvLen;
+            lc  = ( lvLen > ctx->subCtx.t4t.curMLc ) ? ctx->subCtx.t4t.curMLc : (uint16_t)lvLen;
+            ext = ( lc > NDEF_T4T_MAX_SHORT_MLC );
             ret = ndefT4TPollerWriteBinary(ctx, (uint16_t)lvOffset, lvBuf, lc);
         }
+        if( (ret == ERR_REQUEST) && ext )
+        {
+            /* Extended field coding refused by the tag: fall back to short field coding */
+            ctx->subCtx.t4t.curMLc = NDEF_T4T_MAX_SHORT_MLC;
+            continue;
+        }
         if( ret != ERR_NONE )
         {
             return ret;
@@ -76,6 +76,10 @@
 
 #define NDEF_T5T_MAX_BLOCK_1_BYTE_ADDR       256U    /*!< Max number of blocks for 1 byte addressing        */
 #define NDEF_T5T_MAX_MLEN_1_BYTE_ENCODING    256U    /*!< MLEN max value for 1 byte encoding                */
+#define NDEF_T5T_MBREAD_MAX_LEN              256U    /*!< Max data per (Extended) READ_MULTIPLE_BLOCKS: response fits the RFAL NFC-V decoding buffer */
+#define NDEF_T5T_M24LR_SECTOR_BLOCKS          32U    /*!< Legacy ST High Density: multiple reads do not cross a sector      */
+#define NDEF_T5T_MBWRITE_HEADER_MAX_LEN       14U    /*!< (Extended) WRITE_MULTIPLE_BLOCKS header: flags, cmd, UID, BNo(2), Bno(2) */
+#define NDEF_T5T_MBWRITE_DEFAULT_BLOCKS        4U    /*!< Max blocks per WRITE_MULTIPLE_BLOCKS of a device not identified   */
 
 #define NDEF_T5T_TL_MAX_SIZE  (NDEF_T5T_TLV_T_LEN \
                        + NDEF_T5T_TLV_L_3_BYTES_LEN) /*!< Max TL size                                       */
@@ -91,6 +95,15 @@
  ******************************************************************************
  */
 
+/*! T5T device write capabilities, identified by IC manufacturer code and IC reference */
+typedef struct {
+    uint8_t                  manufId;                          /*!< IC manufacturer code (UID)                         */
+    uint8_t                  icRefMask;                        /*!< IC reference significant bits                      */
+    uint8_t                  icRef;                            /*!< IC reference (System Information)                  */
+    uint8_t                  maxWriteBlocks;                   /*!< Max blocks per (Extended) WRITE_MULTIPLE_BLOCKS    */
+    uint16_t                 blockWrTime;                      /*!< Programming time of one block (us)                 */
+} ndefT5TDeviceInfo;
+
 /*
  ******************************************************************************
  * GLOBAL MACROS
@@ -105,6 +118,12 @@
  ******************************************************************************
  */
 
+/*! Devices known to support (Extended) WRITE_MULTIPLE_BLOCKS, with their EEPROM programming time */
+static const ndefT5TDeviceInfo gNdefT5TDeviceInfo[] = {
+    { NDEF_T5T_MANUFACTURER_ID_ST, 0xFCU, 0x24U, 4U, 5000U },  /* ST25DV04K/16K/64K -IE/-JF */
+    { NDEF_T5T_MANUFACTURER_ID_ST, 0xFEU, 0x50U, 4U, 5000U },  /* ST25DV04KC/16KC/64KC      */
+};
+
 /*
  ******************************************************************************
  * LOCAL FUNCTION PROTOTYPES
@@ -112,12 +131,16 @@
  */
 
 static ReturnCode ndefT5TPollerReadSingleBlock(ndefContext *ctx, uint16_t blockNum, uint8_t *rxBuf, uint16_t rxBufLen, uint16_t *rcvLen);
+static ReturnCode ndefT5TPollerReadMultipleBlocks(ndefContext *ctx, uint16_t firstBlockNum, uint8_t numOfBlocks, uint8_t *rxBuf, uint16_t rxBufLen, uint16_t *rcvLen);
+static uint16_t ndefT5TPollerGetReadBlocksNb(const ndefContext *ctx, uint16_t firstBlockNum, uint32_t maxBlocks);
 static ReturnCode ndefT5TGetSystemInformation(ndefContext *ctx, bool extended);
+static void ndefT5TSetWriteCapabilities(ndefContext *ctx);
 
 #if NDEF_FEATURE_ALL
 static ReturnCode ndefT5TWriteCC(ndefContext *ctx);
 static ReturnCode ndefT5TPollerWriteSingleBlock(ndefContext *ctx, uint16_t blockNum, const uint8_t* wrData);
-static ReturnCode ndefT5TPollerReadMultipleBlocks(ndefContext *ctx, uint16_t firstBlockNum, uint8_t numOfBlocks, uint8_t *rxBuf, uint16_t rxBufLen, uint16_t *rcvLen);
+static ReturnCode ndefT5TPollerWriteMultipleBlocks(ndefContext *ctx, uint16_t firstBlockNum, uint16_t numOfBlocks, const uint8_t* wrData);
+static uint16_t ndefT5TPollerGetWriteBlocksNb(const ndefContext *ctx, uint16_t firstBlockNum, uint32_t maxBlocks);
 #endif /* NDEF_FEATURE_ALL */
 
 /*
@@ -133,6 +156,7 @@ ReturnCode ndefT5TPollerReadBytes(ndefContext * ctx, uint32_t offset, uint32_t l
     uint8_t         status;
     uint16_t        res;
     uint16_t        nbRead;
+    uint16_t        nbBlocks;
     uint16_t        blockLen;
     uint16_t        startBlock;
     uint16_t        startAddr;
@@ -167,14 +191,32 @@ ReturnCode ndefT5TPollerReadBytes(ndefContext * ctx, uint32_t offset, uint32_t l
             while (currentLen >= ((uint32_t)blockLen + 2U) )
             {
                 startBlock++;
-                lastVal = buf[lvRcvLen - 1U];
-                res = ndefT5TPollerReadSingleBlock(ctx, startBlock, &buf[lvRcvLen - 1U], blockLen + 3U, &nbRead);
+                /* Whole blocks are received in place, the CRC must fit in buf too */
+                nbBlocks = ndefT5TPollerGetReadBlocksNb(ctx, startBlock, ((currentLen - 2U) / blockLen));
+                lastVal  = buf[lvRcvLen - 1U];
+                if( nbBlocks > 1U )
+                {
+                    res = ndefT5TPollerReadMultipleBlocks(ctx, startBlock, (uint8_t)(nbBlocks - 1U), &buf[lvRcvLen - 1U], (uint16_t)((nbBlocks * blockLen) + 3U), &nbRead);
+                    if( (res != ERR_NONE) || (nbRead != ((nbBlocks * blockLen) + 1U)) || (buf[lvRcvLen - 1U] != 0U) )
+                    {
+                        /* Tag quirk: smaller (or no) multiple block read support, retry with half the blocks down to single block reads */
+                        buf[lvRcvLen - 1U] = lastVal;
+                        ctx->subCtx.t5t.maxReadBlocks = (uint8_t)(nbBlocks / 2U);
+                        startBlock--;
+                        continue;
+                    }
+                }
+                else
+                {
+                    res = ndefT5TPollerReadSingleBlock(ctx, startBlock, &buf[lvRcvLen - 1U], blockLen + 3U, &nbRead);
+                }
                 status  = buf[lvRcvLen - 1U]; /* Keep status */
                 buf[lvRcvLen - 1U] = lastVal; /* Restore previous value */
                 if ( (res == ERR_NONE) && (nbRead > 0U) && (status == 0U))
                 {
-                    lvRcvLen   += blockLen;
-                    currentLen -= blockLen;
+                    lvRcvLen   += (uint32_t)nbBlocks * blockLen;
+                    currentLen -= (uint32_t)nbBlocks * blockLen;
+                    startBlock += (nbBlocks - 1U);
                 }
                 else
                 {
@@ -253,7 +295,8 @@ ReturnCode ndefT5TPollerContextInitialization(ndefContext *ctx, const rfalNfcDev
 
     if( (rcvLen > 1U) && (ctx->subCtx.t5t.txrxBuf[0U] == (uint8_t) 0U) )
     {
-        ctx->subCtx.t5t.blockLen = (uint8_t) (rcvLen - 1U);
+        ctx->subCtx.t5t.blockLen      = (uint8_t) (rcvLen - 1U);
+        ctx->subCtx.t5t.maxReadBlocks = (uint8_t)MIN( (NDEF_T5T_MBREAD_MAX_LEN / ctx->subCtx.t5t.blockLen), 0xFFU );
     }
     else
     {
@@ -283,6 +326,9 @@ ReturnCode ndefT5TPollerContextInitialization(ndefContext *ctx, const rfalNfcDev
             ctx->subCtx.t5t.sysInfoSupported = true;
         }
     }
+
+    ndefT5TSetWriteCapabilities(ctx);
+
     return result;
 }
 
@@ -306,6 +352,7 @@ ReturnCode ndefT5TPollerNdefDetect(ndefContext * ctx, ndefInfo *info)
     ctx->state                           = NDEF_STATE_INVALID;
     ctx->cc.t5t.ccLen                    = 0U;
     ctx->cc.t5t.memoryLen                = 0U;
+    ctx->cc.t5t.multipleBlockRead        = false;
     ctx->messageLen                      = 0U;
     ctx->messageOffset                   = 0U;
 
@@ -483,6 +530,7 @@ ReturnCode ndefT5TPollerWriteBytes(ndefContext *ctx, uint32_t offset, const uint
     ReturnCode      result = ERR_REQUEST;
     ReturnCode      res;
     uint16_t        nbRead;
+    uint16_t        nbBlocks;
     uint16_t        blockLen16;
     uint16_t        startBlock;
     uint16_t        startAddr ;
@@ -540,12 +588,26 @@ ReturnCode ndefT5TPollerWriteBytes(ndefContext *ctx, uint32_t offset, const uint
     }
     while (currentLen >= blockLen16)
     {
-        res = ndefT5TPollerWriteSingleBlock(ctx, startBlock, wrbuf);
+        nbBlocks = ndefT5TPollerGetWriteBlocksNb(ctx, startBlock, (currentLen / blockLen16));
+        if( nbBlocks > 1U )
+        {
+            res = ndefT5TPollerWriteMultipleBlocks(ctx, startBlock, nbBlocks, wrbuf);
+            if( res != ERR_NONE )
+            {
+                /* Tag quirk: fewer blocks per command, retry with half the blocks down to single block writes */
+                ctx->subCtx.t5t.maxWriteBlocks = (uint8_t)(nbBlocks / 2U);
+                continue;
+            }
+        }
+        else
+        {
+            res = ndefT5TPollerWriteSingleBlock(ctx, startBlock, wrbuf);
+        }
         if (res == ERR_NONE)
         {
-            currentLen -= blockLen16;
-            wrbuf       = &wrbuf[blockLen16];
-            startBlock++;
+            currentLen -= ((uint32_t)nbBlocks * blockLen16);
+            wrbuf       = &wrbuf[(uint32_t)nbBlocks * blockLen16];
+            startBlock += nbBlocks;
         }
         else
         {
@@ -994,35 +1056,63 @@ static ReturnCode ndefT5TPollerWriteSingleBlock(ndefContext *ctx, uint16_t block
 }
 
 /*******************************************************************************/
-static ReturnCode ndefT5TPollerReadMultipleBlocks(ndefContext *ctx, uint16_t firstBlockNum, uint8_t numOfBlocks, uint8_t *rxBuf, uint16_t rxBufLen, uint16_t *rcvLen)
+static ReturnCode ndefT5TPollerWriteMultipleBlocks(ndefContext *ctx, uint16_t firstBlockNum, uint16_t numOfBlocks, const uint8_t* wrData)
 {
     ReturnCode                ret;
+    uint8_t                   flags;
+    uint16_t                  wrDataLen;
 
     if( (ctx == NULL) || !ndefT5TisT5TDevice(&ctx->device) )
     {
         return ERR_PARAM;
     }
 
-    if( ctx->subCtx.t5t.legacySTHighDensity )
-    {
+    flags     = ctx->cc.t5t.specialFrame ? ((uint8_t)RFAL_NFCV_REQ_FLAG_DEFAULT | (uint8_t)RFAL_NFCV_REQ_FLAG_OPTION): (uint8_t)RFAL_NFCV_REQ_FLAG_DEFAULT;
+    wrDataLen = (uint16_t)(numOfBlocks * ctx->subCtx.t5t.blockLen);
 
-        ret = rfalST25xVPollerM24LRReadMultipleBlocks((uint8_t)RFAL_NFCV_REQ_FLAG_DEFAULT, ctx->subCtx.t5t.pAddressedUid, firstBlockNum, numOfBlocks, rxBuf, rxBufLen, rcvLen);
+    /* The request is composed in txrxBuf, data are copied from wrData */
+    if( firstBlockNum < NDEF_T5T_MAX_BLOCK_1_BYTE_ADDR )
+    {
+        ret = rfalNfcvPollerWriteMultipleBlocks(flags, ctx->subCtx.t5t.pAddressedUid, (uint8_t)firstBlockNum, (uint8_t)numOfBlocks, ctx->subCtx.t5t.txrxBuf, (uint16_t)sizeof(ctx->subCtx.t5t.txrxBuf), ctx->subCtx.t5t.blockLen, wrData, wrDataLen);
     }
     else
     {
-        if( firstBlockNum < NDEF_T5T_MAX_BLOCK_1_BYTE_ADDR )
-        {
-            ret = rfalNfcvPollerReadMultipleBlocks((uint8_t)RFAL_NFCV_REQ_FLAG_DEFAULT, ctx->subCtx.t5t.pAddressedUid, (uint8_t)firstBlockNum, numOfBlocks, rxBuf, rxBufLen, rcvLen);
-        }
-        else
-        {
-            ret = rfalNfcvPollerExtendedReadMultipleBlocks((uint8_t)RFAL_NFCV_REQ_FLAG_DEFAULT, ctx->subCtx.t5t.pAddressedUid, firstBlockNum, numOfBlocks, rxBuf, rxBufLen, rcvLen);
-        }
+        ret = rfalNfcvPollerExtendedWriteMultipleBlocks(flags, ctx->subCtx.t5t.pAddressedUid, firstBlockNum, numOfBlocks, ctx->subCtx.t5t.txrxBuf, (uint16_t)sizeof(ctx->subCtx.t5t.txrxBuf), ctx->subCtx.t5t.blockLen, wrData, wrDataLen);
     }
 
     return ret;
 }
 
+/*******************************************************************************/
+static uint16_t ndefT5TPollerGetWriteBlocksNb(const ndefContext *ctx, uint16_t firstBlockNum, uint32_t maxBlocks)
+{
+    uint32_t                  nbBlocks;
+
+    nbBlocks = MIN( maxBlocks, (uint32_t)ctx->subCtx.t5t.maxWriteBlocks );
+
+    /* Keep writes aligned on their size so that they do not cross a memory area / sector boundary */
+    if( nbBlocks > 1U )
+    {
+        nbBlocks = MIN( nbBlocks, ((uint32_t)ctx->subCtx.t5t.maxWriteBlocks - ((uint32_t)firstBlockNum % ctx->subCtx.t5t.maxWriteBlocks)) );
+    }
+
+    if( firstBlockNum < NDEF_T5T_MAX_BLOCK_1_BYTE_ADDR )
+    {
+        /* 1 byte addressing: do not wrap beyond block FFh */
+        nbBlocks = MIN( nbBlocks, (NDEF_T5T_MAX_BLOCK_1_BYTE_ADDR - (uint32_t)firstBlockNum) );
+    }
+    else if( !ctx->subCtx.t5t.extWriteMultiple )
+    {
+        nbBlocks = 1U;
+    }
+    else
+    {
+        /* MISRA 15.7 - Empty else */
+    }
+
+    return (uint16_t)MAX( nbBlocks, 1U );
+}
+
 #endif /* NDEF_FEATURE_ALL */
 
 /*******************************************************************************/
@@ -1055,6 +1145,61 @@ static ReturnCode ndefT5TPollerReadSingleBlock(ndefContext *ctx, uint16_t blockN
     return ret;
 }
 
+/*******************************************************************************/
+static ReturnCode ndefT5TPollerReadMultipleBlocks(ndefContext *ctx, uint16_t firstBlockNum, uint8_t numOfBlocks, uint8_t *rxBuf, uint16_t rxBufLen, uint16_t *rcvLen)
+{
+    ReturnCode                ret;
+
+    if( (ctx == NULL) || !ndefT5TisT5TDevice(&ctx->device) )
+    {
+        return ERR_PARAM;
+    }
+
+    if( ctx->subCtx.t5t.legacySTHighDensity )
+    {
+
+        ret = rfalST25xVPollerM24LRReadMultipleBlocks((uint8_t)RFAL_NFCV_REQ_FLAG_DEFAULT, ctx->subCtx.t5t.pAddressedUid, firstBlockNum, numOfBlocks, rxBuf, rxBufLen, rcvLen);
+    }
+    else
+    {
+        if( firstBlockNum < NDEF_T5T_MAX_BLOCK_1_BYTE_ADDR )
+        {
+            ret = rfalNfcvPollerReadMultipleBlocks((uint8_t)RFAL_NFCV_REQ_FLAG_DEFAULT, ctx->subCtx.t5t.pAddressedUid, (uint8_t)firstBlockNum, numOfBlocks, rxBuf, rxBufLen, rcvLen);
+        }
+        else
+        {
+            ret = rfalNfcvPollerExtendedReadMultipleBlocks((uint8_t)RFAL_NFCV_REQ_FLAG_DEFAULT, ctx->subCtx.t5t.pAddressedUid, firstBlockNum, numOfBlocks, rxBuf, rxBufLen, rcvLen);
+        }
+    }
+
+    return ret;
+}
+
+/*******************************************************************************/
+static uint16_t ndefT5TPollerGetReadBlocksNb(const ndefContext *ctx, uint16_t firstBlockNum, uint32_t maxBlocks)
+{
+    uint32_t                  nbBlocks;
+
+    /* Multiple block reads only when advertised in the CC (MBREAD) and not found unreliable */
+    nbBlocks = ctx->cc.t5t.multipleBlockRead ? MIN( maxBlocks, (uint32_t)ctx->subCtx.t5t.maxReadBlocks ) : 1U;
+
+    if( ctx->subCtx.t5t.legacySTHighDensity )
+    {
+        nbBlocks = MIN( nbBlocks, (NDEF_T5T_M24LR_SECTOR_BLOCKS - ((uint32_t)firstBlockNum % NDEF_T5T_M24LR_SECTOR_BLOCKS)) );
+    }
+    else if( firstBlockNum < NDEF_T5T_MAX_BLOCK_1_BYTE_ADDR )
+    {
+        /* 1 byte addressing: do not wrap beyond block FFh */
+        nbBlocks = MIN( nbBlocks, (NDEF_T5T_MAX_BLOCK_1_BYTE_ADDR - (uint32_t)firstBlockNum) );
+    }
+    else
+    {
+        /* MISRA 15.7 - Empty else */
+    }
+
+    return (uint16_t)MAX( nbBlocks, 1U );
+}
+
 /*******************************************************************************/
 static ReturnCode ndefT5TGetSystemInformation(ndefContext *ctx, bool extended)
 {
@@ -1146,4 +1291,60 @@ static ReturnCode ndefT5TGetSystemInformation(ndefContext *ctx, bool extended)
     return ERR_NONE;
 }
 
+/*******************************************************************************/
+static void ndefT5TSetWriteCapabilities(ndefContext *ctx)
+{
+    const ndefSystemInformation *sysInfo;
+    uint32_t                     i;
+    uint16_t                     blockWrTime;
+
+    sysInfo                          = &ctx->subCtx.t5t.sysInfo;
+    blockWrTime                      = 0U;
+    ctx->subCtx.t5t.maxWriteBlocks   = 1U;
+    ctx->subCtx.t5t.extWriteMultiple = false;
+
+    /* Legacy ST High Density devices only accept single block writes */
+    if( !ctx->subCtx.t5t.legacySTHighDensity && ctx->subCtx.t5t.sysInfoSupported )
+    {
+        if( ndefT5TSysInfoICRefPresent(sysInfo->infoFlags) != 0U )
+        {
+            for( i = 0U; i < SIZEOF_ARRAY(gNdefT5TDeviceInfo); i++ )
+            {
+                if( (ctx->device.dev.nfcv.InvRes.UID[NDEF_T5T_UID_MANUFACTURER_ID_POS] == gNdefT5TDeviceInfo[i].manufId) &&
+                    ((sysInfo->ICRef & gNdefT5TDeviceInfo[i].icRefMask) == gNdefT5TDeviceInfo[i].icRef) )
+                {
+                    ctx->subCtx.t5t.maxWriteBlocks   = gNdefT5TDeviceInfo[i].maxWriteBlocks;
+                    ctx->subCtx.t5t.extWriteMultiple = true;
+                    blockWrTime                      = gNdefT5TDeviceInfo[i].blockWrTime;
+                    break;
+                }
+            }
+        }
+
+        /* The command list of the Extended System Information prevails on the IC reference */
+        if( ndefT5TSysInfoCmdListPresent(sysInfo->infoFlags) != 0U )
+        {
+            if( ndefT5TSysInfoWriteMultipleBlocksSupported(sysInfo->supportedCmd) == 0U )
+            {
+                ctx->subCtx.t5t.maxWriteBlocks = 1U;
+            }
+            else if( ctx->subCtx.t5t.maxWriteBlocks == 1U )
+            {
+                ctx->subCtx.t5t.maxWriteBlocks = NDEF_T5T_MBWRITE_DEFAULT_BLOCKS;
+            }
+            else
+            {
+                /* MISRA 15.7 - Empty else */
+            }
+            ctx->subCtx.t5t.extWriteMultiple = (ndefT5TSysInfoExtWriteMultipleBlocksSupported(sysInfo->supportedCmd) != 0U);
+        }
+    }
+
+    /* The request is composed in txrxBuf */
+    ctx->subCtx.t5t.maxWriteBlocks = (uint8_t)MIN( ctx->subCtx.t5t.maxWriteBlocks, ((NDEF_T5T_TxRx_BUFF_SIZE - NDEF_T5T_MBWRITE_HEADER_MAX_LEN) / ctx->subCtx.t5t.blockLen) );
+
+    /* Write commands wait the programming time of the device instead of FDTV,EOF max when known */
+    rfalNfcvPollerSetWriteTime( rfalConvUsTo1fc(blockWrTime) );
+}
+
 #endif /* RFAL_FEATURE_NFCV */
@@ -59,6 +59,7 @@
  ******************************************************************************
  */
 #include "platform.h"
+#include "rfal_nfca.h"
 #include "rfal_nfcb.h"
 /*
  ******************************************************************************
@@ -92,6 +93,35 @@
 
 
 #define RFAL_ISODEP_FSDI_DEFAULT                RFAL_ISODEP_FSXI_256  /*!< Default Frame Size Integer in Poll mode              */
+
+/*! Largest FSDI whose FSD fits the I-Block buffer of this build (RFAL_FEATURE_ISO_DEP_IBLOCK_MAX_LEN) */
+#if   (RFAL_FEATURE_ISO_DEP_IBLOCK_MAX_LEN >= 4096U)
+    #define RFAL_ISODEP_FSDI_MAX                RFAL_ISODEP_FSXI_4096
+#elif (RFAL_FEATURE_ISO_DEP_IBLOCK_MAX_LEN >= 2048U)
+    #define RFAL_ISODEP_FSDI_MAX                RFAL_ISODEP_FSXI_2048
+#elif (RFAL_FEATURE_ISO_DEP_IBLOCK_MAX_LEN >= 1024U)
+    #define RFAL_ISODEP_FSDI_MAX                RFAL_ISODEP_FSXI_1024
+#elif (RFAL_FEATURE_ISO_DEP_IBLOCK_MAX_LEN >= 512U)
+    #define RFAL_ISODEP_FSDI_MAX                RFAL_ISODEP_FSXI_512
+#elif (RFAL_FEATURE_ISO_DEP_IBLOCK_MAX_LEN >= 256U)
+    #define RFAL_ISODEP_FSDI_MAX                RFAL_ISODEP_FSXI_256
+#elif (RFAL_FEATURE_ISO_DEP_IBLOCK_MAX_LEN >= 128U)
+    #define RFAL_ISODEP_FSDI_MAX                RFAL_ISODEP_FSXI_128
+#elif (RFAL_FEATURE_ISO_DEP_IBLOCK_MAX_LEN >= 96U)
+    #define RFAL_ISODEP_FSDI_MAX                RFAL_ISODEP_FSXI_96
+#elif (RFAL_FEATURE_ISO_DEP_IBLOCK_MAX_LEN >= 64U)
+    #define RFAL_ISODEP_FSDI_MAX                RFAL_ISODEP_FSXI_64
+#elif (RFAL_FEATURE_ISO_DEP_IBLOCK_MAX_LEN >= 48U)
+    #define RFAL_ISODEP_FSDI_MAX                RFAL_ISODEP_FSXI_48
+#elif (RFAL_FEATURE_ISO_DEP_IBLOCK_MAX_LEN >= 40U)
+    #define RFAL_ISODEP_FSDI_MAX                RFAL_ISODEP_FSXI_40
+#elif (RFAL_FEATURE_ISO_DEP_IBLOCK_MAX_LEN >= 32U)
+    #define RFAL_ISODEP_FSDI_MAX                RFAL_ISODEP_FSXI_32
+#elif (RFAL_FEATURE_ISO_DEP_IBLOCK_MAX_LEN >= 24U)
+    #define RFAL_ISODEP_FSDI_MAX                RFAL_ISODEP_FSXI_24
+#else
+    #define RFAL_ISODEP_FSDI_MAX                RFAL_ISODEP_FSXI_16
+#endif
 #define RFAL_ISODEP_FSX_KEEP                    (0xFFU)               /*!< Flag to keep FSX from activation                     */
 #define RFAL_ISODEP_DEFAULT_FSCI                RFAL_ISODEP_FSXI_256  /*!< FSCI default value to be used  in Listen Mode        */
 #define RFAL_ISODEP_DEFAULT_FSC                 RFAL_ISODEP_FSX_256   /*!< FSC default value (aligned RFAL_ISODEP_DEFAULT_FSCI) */
@@ -100,6 +130,8 @@
 
 #define RFAL_ISODEP_APDU_MAX_LEN                RFAL_ISODEP_FSX_1024  /*!< Max APDU length                                      */
 
+#define RFAL_ISODEP_RT_INS_NUM                  (12U)                 /*!< Number of commands (INS and length class) whose response time a profile learns */
+
 #define RFAL_ISODEP_ATTRIB_RES_MBLI_NO_INFO     (0x00U)  /*!< MBLI indicating no information on its internal input buffer size  */
 #define RFAL_ISODEP_ATTRIB_REQ_PARAM1_DEFAULT   (0x00U)  /*!< Default values of Param 1 of ATTRIB_REQ Digital 1.0  12.6.1.3-5   */
 #define RFAL_ISODEP_ATTRIB_HLINFO_LEN           (32U)    /*!< Maximum Size of Higher Layer Information                          */
@@ -310,6 +342,7 @@ typedef struct {
     bool               supDID;          /*!< DID supported flag                                   */
     bool               supNAD;          /*!< NAD supported flag                                   */
     bool               supAdFt;         /*!< Advanced Features supported flag                     */
+    uint16_t           HBKey;           /*!< Key of the Historical Bytes (NFC-A) or Application Data (NFC-B), identifies the card type */
 } rfalIsoDepInfo;
 
 
@@ -320,6 +353,38 @@ typedef struct {
 } rfalIsoDepDevice;
 
 
+/*! ISO-DEP Poller learned response time of a command */
+typedef struct {
+    uint8_t                 INS;        /*!< Instruction byte of the C-APDU                        */
+    uint8_t                 lenClass;   /*!< Class of data length of the C-APDU (Lc or Le)         */
+    uint8_t                 samples;    /*!< Number of responses measured (saturates)              */
+    uint8_t                 wtxSamples; /*!< Number of responses to an S(WTX) measured (saturates) */
+    uint16_t                rtMax;      /*!< Slowest first response, I-Block or S(WTX) (ms)        */
+    uint16_t                wtxRtMax;   /*!< Slowest response to an S(WTX), once granted (ms)      */
+} rfalIsoDepRtIns;
+
+
+/*! ISO-DEP Poller response time profile of a card type, learned across sessions */
+typedef struct {
+    uint16_t                HBKey;      /*!< Card type, see rfalIsoDepInfo                         */
+    uint8_t                 ctrlSamples;/*!< Number of R-Block responses measured (saturates)      */
+    uint16_t                ctrlRtMax;  /*!< Slowest response to an R-Block (ms)                   */
+    uint8_t                 insNext;    /*!< Next INS entry to be replaced                         */
+    rfalIsoDepRtIns         ins[RFAL_ISODEP_RT_INS_NUM]; /*!< Learned response time per INS       */
+} rfalIsoDepRtProfile;
+
+
+/*! ISO-DEP Poller session: protocol state kept per card when several cards are active with distinct DIDs */
+typedef struct {
+    rfalIsoDepDevice        *isoDepDev; /*!< Activated device (DID, FSC, FWT, bit rate)            */
+    uint8_t                 blockNumber;/*!< PCD block number towards this card                     */
+    uint16_t                ourFsx;     /*!< FSD announced to this card                            */
+    uint8_t                 brErrLvl;   /*!< Bit rate error level towards this card                */
+    bool                    isBrSParam; /*!< Bit rate set by S(PARAMETERS), may be stepped down    */
+    rfalIsoDepRtProfile     *rtProfile; /*!< Response time profile of this card, NULL if none      */
+} rfalIsoDepSession;
+
+
 /*! ATTRIB Response parameters */
 typedef struct
 {
@@ -392,7 +457,6 @@ typedef struct
     uint16_t                 txBufLen;                 /*!< Transmit Buffer INF field length in Bytes*/
     rfalIsoDepApduBufFormat  *rxBuf;                   /*!< Receive Buffer struct reference in Bytes */
     uint16_t                 *rxLen;                   /*!< Received INF data length in Bytes        */
-    rfalIsoDepBufFormat      *tmpBuf;                  /*!< Temp buffer for Rx I-Blocks (internal)   */
     uint32_t                 FWT;                      /*!< FWT to be used (ignored in Listen Mode)  */
     uint32_t                 dFWT;                     /*!< Delta FWT to be used                     */
     uint16_t                 FSx;                      /*!< Other device Frame Size (FSD or FSC)     */
@@ -449,6 +513,10 @@ void rfalIsoDepInitializeWithParams( rfalComplianceMode compMode, uint8_t maxRet
  *  FSx  = FSD or FSC
  *  
  *  The FSD/FSC value includes the header and CRC
+ *  
+ *  FSxI values above the maximum of the current compliance mode are
+ *  handled as that maximum: FSxI 8 (256 bytes) for NFC Forum, FSxI 12
+ *  (4096 bytes) for ISO14443 (Amd2) and EMVCo
  *
  *  \param[in] FSxI :  Frame Size for proximity coupling Device Integer
  *  
@@ -640,8 +708,11 @@ ReturnCode rfalIsoDepGetTransceiveStatus( void );
  *  The txBuf  contains a complete APDU to be transmitted 
  *  The Prologue field will be manipulated by the Transceive
  *  
+ *  I-Blocks are framed and received in place: chained blocks are sent from
+ *  and received into the APDU buffers directly, without intermediate copies
+ *  
  *  \warning the txBuf will be modified during the transmission
- *  \warning the maximum RF frame which can be received is limited by param.tmpBuf
+ *  \warning the rxBuf must not be accessed until the Transceive is completed
  *  
  *  \param[in] param: reference parameters to be used for the Transceive
  *                     
@@ -677,7 +748,7 @@ ReturnCode rfalIsoDepGetApduTransceiveStatus( void );
  *  This sends a RATS to make a NFC-A Listen Device to enter 
  *  ISO-DEP layer (ISO14443-4) and checks if the received ATS is valid
  *   
- *  \param[in]  FSDI   : Frame Size Device Integer to be used
+ *  \param[in]  FSDI   : Frame Size Device Integer to be used, limited to RFAL_ISODEP_FSDI_MAX
  *  \param[in]  DID    : Device ID to be used or RFAL_ISODEP_NO_DID for not use DID  
  *  \param[out] ats    : pointer to place the ATS Response
  *  \param[out] atsLen : pointer to place the ATS length
@@ -734,7 +805,7 @@ ReturnCode rfalIsoDepPPS( uint8_t DID, rfalBitRate DSI, rfalBitRate DRI, rfalIso
  *  \param[in]  PARAM1    : ATTRIB PARAM1 byte (communication parameters) 
  *  \param[in]  DSI       : DSI code the divisor from Listener (PICC) to Poller (PCD)
  *  \param[in]  DRI       : DRI code the divisor from Poller (PCD) to Listener (PICC)
- *  \param[in]  FSDI      : PCD's Frame Size to be announced on the ATTRIB
+ *  \param[in]  FSDI      : PCD's Frame Size to be announced on the ATTRIB, limited to RFAL_ISODEP_FSDI_MAX
  *  \param[in]  PARAM3    : ATTRIB PARAM1 byte (protocol type)
  *  \param[in]  DID       : Device ID to be used or RFAL_ISODEP_NO_DID for not use DID
  *  \param[in]  HLInfo    : pointer to Higher layer INF (NULL if none)
@@ -780,7 +851,7 @@ ReturnCode rfalIsoDepDeselect( void );
  *  both devices it additionally sends PPS
  *  Once Activated all details of the device are provided on isoDepDev
  *   
- *  \param[in]  FSDI      : Frame Size Device Integer to be used
+ *  \param[in]  FSDI      : Frame Size Device Integer to be used, limited to RFAL_ISODEP_FSDI_MAX
  *  \param[in]  DID       : Device ID to be used or RFAL_ISODEP_NO_DID for not use DID
  *  \param[in]  maxBR     : Max bit rate supported by the Poller
  *  \param[out] isoDepDev : ISO-DEP information of the activated Listen device
@@ -808,7 +879,7 @@ ReturnCode rfalIsoDepPollAHandleActivation( rfalIsoDepFSxI FSDI, uint8_t DID, rf
  *  devices and performs activation.
  *  Once Activated all details of the device are provided on isoDepDev
  *   
- *  \param[in]  FSDI         : Frame Size Device Integer to be used
+ *  \param[in]  FSDI         : Frame Size Device Integer to be used, limited to RFAL_ISODEP_FSDI_MAX
  *  \param[in]  DID          : Device ID to be used or RFAL_ISODEP_NO_DID for not use DID
  *  \param[in]  maxBR        : Max bit rate supported by the Poller
  *  \param[in]  PARAM1       : ATTRIB PARAM1 byte (communication parameters)
@@ -855,6 +926,155 @@ ReturnCode rfalIsoDepPollBHandleActivation( rfalIsoDepFSxI FSDI, uint8_t DID, rf
 ReturnCode rfalIsoDepPollHandleSParameters( rfalIsoDepDevice *isoDepDev, rfalBitRate maxTxBR, rfalBitRate maxRxBR );
 
 
+/*! 
+ *****************************************************************************
+ *  \brief  ISO-DEP Poller Is Bit Rate Degraded
+ *   
+ *  The bit rate in use is monitored from the activation, or the last 
+ *  S(PARAMETERS) selection, on: CRC, parity and framing errors on received
+ *  blocks raise an error level which valid blocks lower again. Once the 
+ *  level shows repeated transmission errors it is kept until the bit rate
+ *  changes.
+ *  
+ *  If the bit rate was set by rfalIsoDepPollHandleSParameters() the PICC 
+ *  supports S(PARAMETERS): the ISO-DEP layer then steps it one down within
+ *  the session, ahead of the next command's first I-Block, as part of the
+ *  Start/GetTransceiveStatus sequence. The selected application, file and 
+ *  security state are kept.
+ *  
+ *  A bit rate set by PPS or ATTRIB, or a PICC refusing the S(PARAMETERS),
+ *  is never changed by the ISO-DEP layer: this reports the degraded link
+ *  and the caller decides whether to deselect and re-activate the device
+ *  with a lower maxBR.
+ *  
+ *  \return true  : Repeated transmission errors, a lower bit rate is advised
+ *  \return false : Bit rate in use is fine, or not in Poller role
+ *****************************************************************************
+ */
+bool rfalIsoDepPollIsBitRateDegraded( void );
+
+
+/*! 
+ *****************************************************************************
+ *  \brief  ISO-DEP Poller Activate NFC-A Session
+ *   
+ *  Activates one of several NFC-A cards already resolved (and put to HALT)
+ *  by the collision resolution: WUPA, SELECT of its NFCID1, RATS with the
+ *  given DID and PPS. Cards previously activated with other DIDs remain
+ *  in protocol state and ignore these commands.
+ *  
+ *  On success the session is initialized and becomes the current one.
+ *  Exchanges with several cards are interleaved by restoring a card's
+ *  session with rfalIsoDepSessionRestore() before starting a Transceive
+ *  with its DID/FSC/FWT, and saving it after with rfalIsoDepSessionSave().
+ *  
+ *  Distinct DIDs in the range [1 .. RFAL_ISODEP_DID_MAX] shall be used. 
+ *  A card not supporting DID is still activated (info.DID is
+ *  RFAL_ISODEP_NO_DID); at most one such card may be active at a time,
+ *  until it is deselected with rfalIsoDepDeselect() or rfalIsoDepInitialize()
+ *  is called. A second one is reported with ERR_PARAM: it is then left in
+ *  protocol state along with the first, the field shall be reset.
+ *   
+ *  \param[in]  FSDI      : Frame Size Device Integer to be used, limited to RFAL_ISODEP_FSDI_MAX
+ *  \param[in]  DID       : Device ID to be assigned to the card
+ *  \param[in]  maxBR     : Max bit rate supported by the Poller
+ *  \param[in]  nfcaDev   : NFC-A card as retrieved by the collision resolution
+ *  \param[out] isoDepDev : ISO-DEP information of the activated card
+ *  \param[out] session   : session of the activated card
+ *
+ *  \return ERR_PARAM        : Invalid parameters, or a second card not supporting DID
+ *  \return ERR_TIMEOUT      : Timeout error
+ *  \return ERR_PROTO        : Protocol error detected
+ *  \return ERR_NONE         : No error, card activated
+ *****************************************************************************
+ */
+ReturnCode rfalIsoDepPollASessionActivate( rfalIsoDepFSxI FSDI, uint8_t DID, rfalBitRate maxBR, const rfalNfcaListenDevice *nfcaDev, rfalIsoDepDevice *isoDepDev, rfalIsoDepSession *session );
+
+
+/*! 
+ *****************************************************************************
+ *  \brief  ISO-DEP Poller Save Session
+ *   
+ *  Stores the protocol state of the current card into its session
+ *  Shall be called once an exchange has completed, not in between the
+ *  blocks of a chain
+ *   
+ *  \param[out] session  : session of the current card
+ *
+ *  \return ERR_PARAM        : Invalid parameters
+ *  \return ERR_WRONG_STATE  : Chaining ongoing or not in Poll mode
+ *  \return ERR_NONE         : No error, session saved
+ *****************************************************************************
+ */
+ReturnCode rfalIsoDepSessionSave( rfalIsoDepSession *session );
+
+
+/*! 
+ *****************************************************************************
+ *  \brief  ISO-DEP Poller Restore Session
+ *   
+ *  Makes the given card the current one: restores its block number, DID,
+ *  frame sizes, FWT and bit rate. Its Transceives/Deselect may be started
+ *  afterwards without any reselection.
+ *  A chain left incomplete by a failed exchange with the previous card is
+ *  discarded; that card shall be deselected or reactivated.
+ *   
+ *  \param[in]  session  : session of the card to be made current
+ *
+ *  \return ERR_PARAM        : Invalid parameters
+ *  \return ERR_WRONG_STATE  : Not in Poll mode
+ *  \return ERR_NONE         : No error, session restored
+ *****************************************************************************
+ */
+ReturnCode rfalIsoDepSessionRestore( const rfalIsoDepSession *session );
+
+
+/*! 
+ *****************************************************************************
+ *  \brief  ISO-DEP Poller Find Response Time Profile
+ *   
+ *  Returns the profile of the given device's card type (rfalIsoDepInfo.HBKey).
+ *  If none of the profiles matches, the least trained one is cleared and 
+ *  assigned to this card type.
+ *   
+ *  \param[in]  profiles    : profiles kept by the application across sessions
+ *  \param[in]  profilesCnt : number of profiles
+ *  \param[in]  isoDepDev   : activated device
+ *
+ *  \return the profile to be used, NULL if invalid parameters
+ *****************************************************************************
+ */
+rfalIsoDepRtProfile* rfalIsoDepRtProfileFind( rfalIsoDepRtProfile *profiles, uint8_t profilesCnt, const rfalIsoDepDevice *isoDepDev );
+
+
+/*! 
+ *****************************************************************************
+ *  \brief  ISO-DEP Poller Set Response Time Profile
+ *   
+ *  Enables the adaptive timeouts towards the current card. The response 
+ *  time to each command and to R-Blocks is measured and learned in the 
+ *  profile. A command is keyed by its INS and by the class of data length
+ *  it moves, Lc or Le: up to 16, 64, 256 bytes or more.
+ *  Once 4 clean responses of a command are learned, the wait for its first
+ *  response and for the response to an R(NAK) is reduced from FWT to a 
+ *  multiple of the slowest response seen.
+ *  WTX is pre-armed: commands whose card requests S(WTX) learn the time 
+ *  until the request and the time the card still takes once the extension
+ *  is granted. The wait after the S(WTX) response is then reduced the same
+ *  way, never beyond FWT x WTXM.
+ *  A card that stops responding then fails within milliseconds.
+ *  
+ *  \warning Waits shorter than FWT are outside ISO14443-4/NFC Forum 
+ *  timing: a command much slower than learned for its INS and length 
+ *  class, e.g. depending on P1/P2 or on the card's state, may fail. 
+ *  The activation resets the profile, it must be set after each one.
+ *   
+ *  \param[in]  profile : profile of the card, NULL to use FWT only
+ *****************************************************************************
+ */
+void rfalIsoDepSetRtProfile( rfalIsoDepRtProfile *profile );
+
+
 #endif /* RFAL_ISODEP_H_ */
 
 /**
@@ -0,0 +1,526 @@
+
+/******************************************************************************
+  * \attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2019 STMicroelectronics</center></h2>
+  *
+  * Licensed under ST MYLIBERTY SOFTWARE LICENSE AGREEMENT (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        www.st.com/myliberty
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied,
+  * AND SPECIFICALLY DISCLAIMING THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+******************************************************************************/
+
+/*
+ *      PROJECT:   ST25R391x firmware
+ *      Revision:
+ *      LANGUAGE:  ISO C99
+ */
+
+/*! \file rfal_llcp.h
+ *
+ *  \author
+ *
+ *  \brief Implementation of the NFC Forum Logical Link Control Protocol (LLCP)
+ *
+ *  This module provides the LLCP MAC mapping on top of NFC-DEP and the
+ *  connection-oriented transport (data link connections with I-PDU
+ *  sliding windows) used by P2P services such as SNEP.
+ *
+ *  The link parameters (version, link MIU, WKS, LTO) are exchanged in the
+ *  NFC-DEP General Bytes (ATR_REQ/ATR_RES) and the connection parameters
+ *  (MIU, RW) on CONNECT/CC. On every NFC-DEP exchange all the pending PDUs
+ *  (control PDUs, as many I-PDUs as the peer's receive window allows and
+ *  the RR acknowledgements) are aggregated into a single AGF PDU, and
+ *  frames longer than the NFC-DEP frame size are sent with DEP chaining.
+ *
+ *  The LLCP engine itself is transport independent:
+ *    <br>&nbsp; rfalLlcpGetFrame()     : outgoing LLCP frame for the next exchange
+ *    <br>&nbsp; rfalLlcpProcessFrame() : incoming LLCP frame from the peer
+ *
+ *  which allows two links to be connected back to back (loopback). The
+ *  NFC-DEP binding is provided by:
+ *    <br>&nbsp; rfalLlcpStartExchange()
+ *    <br>&nbsp; rfalLlcpGetExchangeStatus()
+ *
+ *  Connectionless transport (UI PDUs) and service discovery (SNL PDUs) are
+ *  not supported, services are reached by their well known SAP or by name
+ *  through the SDP SAP on CONNECT.
+ *
+ *  This implementation was based on the following specs:
+ *    - NFC Forum Logical Link Control Protocol 1.1  2011-06-20
+ *
+ * \addtogroup RFAL
+ * @{
+ *
+ * \addtogroup RFAL-AL
+ * \brief RFAL Abstraction Layer
+ * @{
+ *
+ * \addtogroup LLCP
+ * \brief RFAL LLCP Module
+ * @{
+ *
+ */
+
+
+#ifndef RFAL_LLCP_H
+#define RFAL_LLCP_H
+
+/*
+ ******************************************************************************
+ * INCLUDES
+ ******************************************************************************
+ */
+#include "platform.h"
+#include "st_errno.h"
+#include "rfal_nfcDep.h"
+
+/*
+ ******************************************************************************
+ * GLOBAL DEFINES
+ ******************************************************************************
+ */
+
+#ifndef RFAL_FEATURE_LLCP_MIU
+    #define RFAL_FEATURE_LLCP_MIU          248U                                 /*!< Local link and data link MIU. LLCP 1.1 min 128 max 2175    */
+#endif
+
+#ifndef RFAL_FEATURE_LLCP_CONN_MAX
+    #define RFAL_FEATURE_LLCP_CONN_MAX     2U                                   /*!< Maximum number of data link connections per link           */
+#endif
+
+#ifndef RFAL_FEATURE_LLCP_RW
+    #define RFAL_FEATURE_LLCP_RW           4U                                   /*!< Local receive window (RW) announced on CONNECT/CC          */
+#endif
+
+#define RFAL_LLCP_VERSION                  0x11U                                /*!< LLCP version 1.1  (major | minor)                          */
+#define RFAL_LLCP_MIU_DEFAULT              128U                                 /*!< Default MIU when no MIUX is given   LLCP 1.1  5.2.2        */
+#define RFAL_LLCP_LTO_DEFAULT              10U                                  /*!< Link Timeout announced (10ms units) LLCP 1.1  4.5.4        */
+#define RFAL_LLCP_RW_MAX                   15U                                  /*!< Maximum receive window              LLCP 1.1  4.5.2        */
+
+#define RFAL_LLCP_SAP_LINK                 0x00U                                /*!< LLC Link Management SAP                                    */
+#define RFAL_LLCP_SAP_SDP                  0x01U                                /*!< Service Discovery Protocol SAP (connect by name)           */
+#define RFAL_LLCP_SAP_SNEP                 0x04U                                /*!< SNEP well known SAP                                        */
+#define RFAL_LLCP_SAP_LOCAL                0x20U                                /*!< First SAP for local (unregistered) services                */
+
+#define RFAL_LLCP_MAGIC_LEN                3U                                   /*!< LLCP magic number length on the General Bytes              */
+#define RFAL_LLCP_HEADER_LEN               2U                                   /*!< PDU header length: DSAP | PTYPE | SSAP                     */
+#define RFAL_LLCP_SEQ_LEN                  1U                                   /*!< Sequence field length of I, RR and RNR PDUs                */
+#define RFAL_LLCP_AGF_LEN_LEN              2U                                   /*!< Length field of each PDU encapsulated on an AGF            */
+#define RFAL_LLCP_GB_MAX_LEN               20U                                  /*!< General Bytes length built by rfalLlcpGetGeneralBytes()    */
+#define RFAL_LLCP_REPLY_MAX                2U                                   /*!< DM/FRMR replies that can be pending at a time              */
+#define RFAL_LLCP_REPLY_MAX_LEN            6U                                   /*!< Longest DM/FRMR reply: header + FRMR info                  */
+
+#define RFAL_LLCP_TX_FRAME_MAX_LEN         (RFAL_LLCP_HEADER_LEN + RFAL_LLCP_AGF_LEN_LEN + RFAL_LLCP_HEADER_LEN + RFAL_LLCP_SEQ_LEN + RFAL_FEATURE_LLCP_MIU) /*!< Frame buffer: AGF header + one PDU with a full info field */
+#define RFAL_LLCP_RX_FRAME_MAX_LEN         (RFAL_LLCP_HEADER_LEN + RFAL_LLCP_SEQ_LEN + RFAL_FEATURE_LLCP_MIU)                                               /*!< Largest frame the peer may send within our link MIU     */
+
+
+/*
+******************************************************************************
+* GLOBAL TYPES
+******************************************************************************
+*/
+
+/*! LLCP link states */
+typedef enum
+{
+    RFAL_LLCP_LINK_ST_IDLE       = 0,            /*!< Link not activated                                   */
+    RFAL_LLCP_LINK_ST_ACTIVE     = 1,            /*!< Link activated, PDUs being exchanged                 */
+    RFAL_LLCP_LINK_ST_CLOSING    = 2,            /*!< Link deactivation (DISC on SAP 0) to be sent         */
+    RFAL_LLCP_LINK_ST_CLOSED     = 3             /*!< Link deactivated by either side                      */
+} rfalLlcpLinkState;
+
+
+/*! LLCP data link connection states */
+typedef enum
+{
+    RFAL_LLCP_CONN_ST_IDLE          = 0,         /*!< Not connected                                        */
+    RFAL_LLCP_CONN_ST_LISTEN        = 1,         /*!< Waiting for a CONNECT from the peer                  */
+    RFAL_LLCP_CONN_ST_CONNECT       = 2,         /*!< CONNECT to be sent                                   */
+    RFAL_LLCP_CONN_ST_CONNECTING    = 3,         /*!< CONNECT sent, waiting for CC or DM                   */
+    RFAL_LLCP_CONN_ST_ACCEPT        = 4,         /*!< CONNECT received, CC to be sent                      */
+    RFAL_LLCP_CONN_ST_CONNECTED     = 5,         /*!< Connection established                               */
+    RFAL_LLCP_CONN_ST_DISC          = 6,         /*!< DISC to be sent                                      */
+    RFAL_LLCP_CONN_ST_DISCONNECTING = 7          /*!< DISC sent, waiting for DM                            */
+} rfalLlcpConnState;
+
+
+/*! LLCP data link connection */
+typedef struct
+{
+    rfalLlcpConnState  state;                    /*!< Connection state                                     */
+    ReturnCode         status;                   /*!< Reason of the last close: ERR_NONE, ERR_REQUEST (DM), ERR_PROTO (FRMR), ERR_LINK_LOSS */
+    bool               isListen;                 /*!< Connection accepts incoming CONNECTs (server)        */
+    uint8_t            lsap;                     /*!< Local SAP                                            */
+    uint8_t            rsap;                     /*!< Remote SAP                                           */
+    const uint8_t      *sn;                      /*!< Service Name to connect to / to be bound to          */
+    uint8_t            snLen;                    /*!< Service Name length                                  */
+    uint16_t           rMiu;                     /*!< Remote data link MIU, within the remote link MIU     */
+    uint8_t            rRw;                      /*!< Remote receive window                                */
+    bool               rBusy;                    /*!< Remote is busy (RNR received)                        */
+    uint8_t            vs;                       /*!< Send state variable V(S)                             */
+    uint8_t            vsa;                      /*!< Send acknowledgement state variable V(SA)            */
+    uint8_t            vr;                       /*!< Receive state variable V(R)                          */
+    uint8_t            vra;                      /*!< Receive acknowledgement state variable V(RA)         */
+    const uint8_t      *txData;                  /*!< Data being sent, segmented in I-PDUs of up to rMiu   */
+    uint16_t           txLen;                    /*!< Length of the data being sent                        */
+    uint16_t           txIt;                     /*!< Amount of data already placed on I-PDUs              */
+    uint8_t            *rxBuf;                   /*!< Buffer where the received I-PDU info is appended     */
+    uint16_t           rxBufLen;                 /*!< Receive buffer size                                  */
+    uint16_t           rxLen;                    /*!< Amount of data received, reset by the user           */
+} rfalLlcpConn;
+
+
+/*! LLCP link */
+typedef struct
+{
+    rfalLlcpLinkState  state;                                           /*!< Link state                                 */
+    bool               isInitiator;                                     /*!< Local device is the NFC-DEP Initiator      */
+    uint8_t            version;                                         /*!< Remote LLCP version                        */
+    uint16_t           rLinkMiu;                                        /*!< Remote link MIU                            */
+    uint16_t           rWks;                                            /*!< Remote Well Known Services                 */
+    uint8_t            rLto;                                            /*!< Remote Link Timeout (10ms units)           */
+    rfalLlcpConn       *conn[RFAL_FEATURE_LLCP_CONN_MAX];               /*!< Registered data link connections           */
+
+    uint8_t            reply[RFAL_LLCP_REPLY_MAX][RFAL_LLCP_REPLY_MAX_LEN]; /*!< Pending DM/FRMR replies                   */
+    uint8_t            replyLen[RFAL_LLCP_REPLY_MAX];                   /*!< Pending reply lengths (0: free)            */
+
+    uint8_t            txFrame[RFAL_LLCP_TX_FRAME_MAX_LEN];             /*!< Outgoing frame being built                 */
+    uint16_t           txFrameIt;                                       /*!< Next free position on txFrame              */
+    uint8_t            txPduCnt;                                        /*!< Number of PDUs on txFrame                  */
+    uint8_t            rxFrame[RFAL_LLCP_RX_FRAME_MAX_LEN];             /*!< Incoming frame (DEP chaining reassembly)   */
+    uint16_t           rxFrameLen;                                      /*!< Incoming frame length                      */
+
+    rfalNfcDepDevice   *nfcDepDev;                                      /*!< Activated NFC-DEP device (NULL: loopback)  */
+    const uint8_t      *depFrame;                                       /*!< Frame being sent over NFC-DEP              */
+    uint16_t           depFrameLen;                                     /*!< Length of the frame being sent             */
+    uint16_t           depFrameIt;                                      /*!< Amount of the frame already sent           */
+    bool               isDepTxChaining;                                 /*!< Last DEP block sent had MI set             */
+    bool               isDepRxChaining;                                 /*!< Last DEP block received had MI set         */
+    uint16_t           depRxLen;                                        /*!< Last DEP block received length             */
+    rfalNfcDepBufFormat depTxBuf;                                       /*!< NFC-DEP transmit block                     */
+    rfalNfcDepBufFormat depRxBuf;                                       /*!< NFC-DEP receive block                      */
+} rfalLlcpLink;
+
+
+/*
+******************************************************************************
+* GLOBAL FUNCTION PROTOTYPES
+******************************************************************************
+*/
+
+
+/*!
+ *****************************************************************************
+ * \brief  Initialize LLCP link
+ *
+ * Resets the link and removes all the registered connections
+ *
+ * \param[out] link : link to be initialized
+ *****************************************************************************
+ */
+void rfalLlcpInitialize( rfalLlcpLink *link );
+
+
+/*!
+ *****************************************************************************
+ * \brief  Get the General Bytes
+ *
+ * Builds the LLCP parameters (magic number, VERSION, MIUX, WKS, LTO, OPT)
+ * to be placed on the ATR_REQ/ATR_RES General Bytes.
+ * The WKS reflects the connections registered with rfalLlcpListen() on a
+ * well known SAP, so these shall be registered before calling this method
+ *
+ * \param[in]  link : link
+ * \param[out] gb   : buffer with at least RFAL_LLCP_GB_MAX_LEN bytes
+ *
+ * \return the General Bytes length
+ *****************************************************************************
+ */
+uint8_t rfalLlcpGetGeneralBytes( const rfalLlcpLink *link, uint8_t *gb );
+
+
+/*!
+ *****************************************************************************
+ * \brief  Activate LLCP link
+ *
+ * Validates the peer's LLCP magic number and version on the General Bytes
+ * received during NFC-DEP activation (ATR_RES when Initiator, ATR_REQ when
+ * Target) and takes the remote link MIU, WKS and LTO.
+ * Any connection left established from a previous link is closed.
+ *
+ * As Target the first LLCP frame has already been received with the
+ * activation and shall be given to rfalLlcpProcessFrame() before the
+ * first rfalLlcpStartExchange()
+ *
+ * \param[in,out] link        : link
+ * \param[in]     nfcDepDev   : activated NFC-DEP device
+ * \param[in]     isInitiator : true if the local device is the Initiator
+ *
+ * \return ERR_PARAM   : Invalid parameters
+ * \return ERR_PROTO   : Peer does not support LLCP
+ * \return ERR_NOTSUPP : Incompatible LLCP major version
+ * \return ERR_NONE    : Link activated
+ *****************************************************************************
+ */
+ReturnCode rfalLlcpActivate( rfalLlcpLink *link, rfalNfcDepDevice *nfcDepDev, bool isInitiator );
+
+
+/*!
+ *****************************************************************************
+ * \brief  Activate LLCP link in loopback
+ *
+ * Same as rfalLlcpActivate() but takes the peer's General Bytes directly,
+ * without an NFC-DEP device. The frames are then carried by
+ * rfalLlcpLoopbackExchange() between two local links, or by the caller
+ * through rfalLlcpGetFrame() / rfalLlcpProcessFrame().
+ * Meant for host testing and for transports other than NFC-DEP
+ *
+ * \param[in,out] link        : link
+ * \param[in]     gb          : peer's General Bytes, see rfalLlcpGetGeneralBytes()
+ * \param[in]     gbLen       : peer's General Bytes length
+ * \param[in]     isInitiator : true if the local link sends the first frame
+ *
+ * \return ERR_PARAM   : Invalid parameters
+ * \return ERR_PROTO   : Peer does not support LLCP
+ * \return ERR_NOTSUPP : Incompatible LLCP major version
+ * \return ERR_NONE    : Link activated
+ *****************************************************************************
+ */
+ReturnCode rfalLlcpActivateLoopback( rfalLlcpLink *link, const uint8_t *gb, uint8_t gbLen, bool isInitiator );
+
+
+/*!
+ *****************************************************************************
+ * \brief  Deactivate LLCP link
+ *
+ * Requests the link deactivation, a DISC on SAP 0 is sent on the next
+ * exchange after which the NFC-DEP link may be released
+ *
+ * \param[in,out] link : link
+ *
+ * \return ERR_WRONG_STATE : Link is not active
+ * \return ERR_NONE        : Deactivation scheduled
+ *****************************************************************************
+ */
+ReturnCode rfalLlcpDeactivate( rfalLlcpLink *link );
+
+
+/*!
+ *****************************************************************************
+ * \brief  Connect
+ *
+ * Registers a connection and requests a data link connection to the
+ * given remote SAP, or to the service with the given name through the
+ * SDP SAP. The CONNECT is sent on the next exchange once the link is active.
+ * A connection already registered is reused
+ *
+ * \param[in,out] link     : link
+ * \param[out]    conn     : connection
+ * \param[in]     dsap     : remote SAP (ignored if sn is given)
+ * \param[in]     sn       : Service Name (NULL to connect by SAP)
+ * \param[in]     snLen    : Service Name length
+ * \param[in]     rxBuf    : buffer where the received data is placed
+ * \param[in]     rxBufLen : receive buffer size
+ *
+ * \return ERR_PARAM : Invalid parameters
+ * \return ERR_NOMEM : No free connection on the link
+ * \return ERR_NONE  : Connection scheduled
+ *****************************************************************************
+ */
+ReturnCode rfalLlcpConnect( rfalLlcpLink *link, rfalLlcpConn *conn, uint8_t dsap, const uint8_t *sn, uint8_t snLen, uint8_t *rxBuf, uint16_t rxBufLen );
+
+
+/*!
+ *****************************************************************************
+ * \brief  Listen
+ *
+ * Registers a connection that accepts CONNECTs addressed to the given
+ * local SAP or to the given Service Name through the SDP SAP. After being
+ * disconnected the connection goes back to listening
+ *
+ * \param[in,out] link     : link
+ * \param[out]    conn     : connection
+ * \param[in]     sap      : local SAP
+ * \param[in]     sn       : Service Name (NULL: by SAP only)
+ * \param[in]     snLen    : Service Name length
+ * \param[in]     rxBuf    : buffer where the received data is placed
+ * \param[in]     rxBufLen : receive buffer size
+ *
+ * \return ERR_PARAM : Invalid parameters
+ * \return ERR_NOMEM : No free connection on the link
+ * \return ERR_NONE  : Connection listening
+ *****************************************************************************
+ */
+ReturnCode rfalLlcpListen( rfalLlcpLink *link, rfalLlcpConn *conn, uint8_t sap, const uint8_t *sn, uint8_t snLen, uint8_t *rxBuf, uint16_t rxBufLen );
+
+
+/*!
+ *****************************************************************************
+ * \brief  Send
+ *
+ * Sends the given data over the connection. The data is segmented in
+ * I-PDUs of up to the remote MIU which are sent as the remote receive
+ * window allows. The data must be kept until rfalLlcpIsSendDone()
+ *
+ * \param[in,out] conn    : connection
+ * \param[in]     data    : data to be sent
+ * \param[in]     dataLen : data length
+ *
+ * \return ERR_WRONG_STATE : Connection not established
+ * \return ERR_BUSY        : Previous data not yet sent
+ * \return ERR_NONE        : Data scheduled
+ *****************************************************************************
+ */
+ReturnCode rfalLlcpSend( rfalLlcpConn *conn, const uint8_t *data, uint16_t dataLen );
+
+
+/*!
+ *****************************************************************************
+ * \brief  Is Send Done
+ *
+ * \param[in] conn : connection
+ *
+ * \return true if all the data given on rfalLlcpSend() has been sent
+ *              and acknowledged by the peer
+ *****************************************************************************
+ */
+bool rfalLlcpIsSendDone( const rfalLlcpConn *conn );
+
+
+/*!
+ *****************************************************************************
+ * \brief  Disconnect
+ *
+ * Requests the disconnection, DISC is sent on the next exchange
+ *
+ * \param[in,out] conn : connection
+ *
+ * \return ERR_WRONG_STATE : Connection not established
+ * \return ERR_NONE        : Disconnection scheduled
+ *****************************************************************************
+ */
+ReturnCode rfalLlcpDisconnect( rfalLlcpConn *conn );
+
+
+/*!
+ *****************************************************************************
+ * \brief  Get Frame
+ *
+ * Builds the LLCP frame to be sent on the next exchange: pending DM/FRMR,
+ * the connections' CONNECT/CC/DISC, I-PDUs within the remote receive
+ * windows and RR acknowledgements, aggregated on an AGF PDU when more
+ * than one fits within the remote link MIU, or a SYMM if nothing is
+ * pending
+ *
+ * \param[in,out] link     : link
+ * \param[out]    frame    : location of the frame
+ * \param[out]    frameLen : frame length
+ *
+ * \return ERR_WRONG_STATE : Link is not active
+ * \return ERR_NONE        : Frame built
+ *****************************************************************************
+ */
+ReturnCode rfalLlcpGetFrame( rfalLlcpLink *link, const uint8_t **frame, uint16_t *frameLen );
+
+
+/*!
+ *****************************************************************************
+ * \brief  Process Frame
+ *
+ * Processes an LLCP frame received from the peer
+ *
+ * \param[in,out] link     : link
+ * \param[in]     frame    : received frame
+ * \param[in]     frameLen : frame length
+ *
+ * \return ERR_WRONG_STATE : Link is not active
+ * \return ERR_PROTO       : Malformed frame
+ * \return ERR_RELEASE_REQ : Link has been deactivated
+ * \return ERR_NONE        : Frame processed
+ *****************************************************************************
+ */
+ReturnCode rfalLlcpProcessFrame( rfalLlcpLink *link, const uint8_t *frame, uint16_t frameLen );
+
+
+/*!
+ *****************************************************************************
+ * \brief  Start Exchange
+ *
+ * Starts an NFC-DEP exchange carrying the frame from rfalLlcpGetFrame().
+ * As Initiator the peer's frame is received in response, as Target the
+ * frame is the response and the next peer frame is received.
+ *
+ * The exchange is driven by rfalWorker() and rfalLlcpGetExchangeStatus(),
+ * rfalNfcWorker() shall not be called meanwhile
+ *
+ * \param[in,out] link : link
+ *
+ * \return ERR_WRONG_STATE : Link is not active or not activated over NFC-DEP
+ * \return ERR_NONE        : Exchange started
+ *****************************************************************************
+ */
+ReturnCode rfalLlcpStartExchange( rfalLlcpLink *link );
+
+
+/*!
+ *****************************************************************************
+ * \brief  Get Exchange Status
+ *
+ * Sends the remaining DEP chaining blocks, reassembles the received frame
+ * and processes it once complete
+ *
+ * \param[in,out] link : link
+ *
+ * \return ERR_BUSY        : Exchange ongoing
+ * \return ERR_NOMEM       : Received frame exceeds the local link MIU
+ * \return ERR_RELEASE_REQ : Link has been deactivated
+ * \return ERR_NONE        : Exchange completed
+ * \return Others          : NFC-DEP error, link lost
+ *****************************************************************************
+ */
+ReturnCode rfalLlcpGetExchangeStatus( rfalLlcpLink *link );
+
+
+
+
+/*!
+ *****************************************************************************
+ * \brief  Loopback Exchange
+ *
+ * Performs one symmetric exchange between two links activated with
+ * rfalLlcpActivateLoopback(): the Initiator's frame is processed by the
+ * Target and the Target's frame by the Initiator
+ *
+ * \param[in,out] initiator : link activated as Initiator
+ * \param[in,out] target    : link activated as Target
+ *
+ * \return ERR_WRONG_STATE : A link is not active or not on loopback
+ * \return ERR_NOMEM       : Frame larger than the receiver's link MIU
+ * \return ERR_PROTO       : Malformed frame
+ * \return ERR_RELEASE_REQ : Link deactivated by either side
+ * \return ERR_NONE        : Exchange done
+ *****************************************************************************
+ */
+ReturnCode rfalLlcpLoopbackExchange( rfalLlcpLink *initiator, rfalLlcpLink *target );
+
+
+#endif /* RFAL_LLCP_H */
+
+/**
+  * @}
+  *
+  * @}
+  *
+  * @}
+  */
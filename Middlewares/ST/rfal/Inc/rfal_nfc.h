@@ -92,6 +92,8 @@
 #define RFAL_NFC_LISTEN_TECH_F           0x4000U  /*!< NFC-V technology Flag     */
 #define RFAL_NFC_LISTEN_TECH_AP2P        0x8000U  /*!< NFC-V technology Flag     */
 
+#define RFAL_NFC_INV_UID_MAX_LEN         RFAL_NFCA_CASCADE_3_UID_LEN  /*!< Max UID length kept on the inventory */
+
 
 /*
 ******************************************************************************
@@ -127,6 +129,7 @@ typedef enum{
     RFAL_NFC_STATE_POLL_COLAVOIDANCE        =  11,  /*!< Collision Avoidance state   */
     RFAL_NFC_STATE_POLL_SELECT              =  12,  /*!< Wait for Selection state    */
     RFAL_NFC_STATE_POLL_ACTIVATION          =  13,  /*!< Activation state            */
+    RFAL_NFC_STATE_POLL_REACQUIRE           =  14,  /*!< Last device re-acquisition  */
     RFAL_NFC_STATE_LISTEN_TECHDETECT        =  20,  /*!< Listen Tech Detect          */
     RFAL_NFC_STATE_LISTEN_COLAVOIDANCE      =  21,  /*!< Listen Collision Avoidance  */
     RFAL_NFC_STATE_LISTEN_ACTIVATION        =  22,  /*!< Listen Activation state     */
@@ -138,6 +141,25 @@ typedef enum{
 }rfalNfcState;
 
 
+/*! Trace event type                                                                 */
+typedef enum{
+    RFAL_NFC_TRACE_EVT_STATE                =  0,   /*!< State left (info: rfalNfcState)         */
+    RFAL_NFC_TRACE_EVT_TECHDETECT           =  1,   /*!< Tech Detection (info: tech flag)        */
+    RFAL_NFC_TRACE_EVT_COLRESOLUTION        =  2,   /*!< Collision Resolution (info: tech flag)  */
+    RFAL_NFC_TRACE_EVT_REACQUIRE            =  3,   /*!< Re-acquisition (info: rfalNfcDevType)   */
+    RFAL_NFC_TRACE_EVT_ACTIVATION           =  4,   /*!< Activation (info: rfalNfcDevType)       */
+    RFAL_NFC_TRACE_EVT_DATAEXCHANGE         =  5,   /*!< Data Exchange (info: rfalNfcRfInterface)*/
+    RFAL_NFC_TRACE_EVT_DEACTIVATION         =  6    /*!< Deactivation (info: none)               */
+}rfalNfcTraceEvt;
+
+
+/*! Inventory event type                                                             */
+typedef enum{
+    RFAL_NFC_INV_EVT_ARRIVAL                =  0,   /*!< Device seen (again) after being absent  */
+    RFAL_NFC_INV_EVT_DEPARTURE              =  1    /*!< Device not seen for longer than the TTL */
+}rfalNfcInvEvt;
+
+
 /*! Device type                                                                       */
 typedef enum{
     RFAL_NFC_LISTEN_TYPE_NFCA               =  0,   /*!< NFC-A Listener device type  */
@@ -184,6 +206,28 @@ typedef struct{
 }rfalNfcDevice;
 
 
+/*! Trace entry, one per phase/state left                                            */
+typedef struct{
+    uint32_t                   tick;                /*!< System tick at phase start   */
+    uint16_t                   duration;            /*!< Phase duration (ms)          */
+    uint16_t                   info;                /*!< Event specific information   */
+    ReturnCode                 err;                 /*!< Phase error code             */
+    uint8_t                    evt;                 /*!< Event type (rfalNfcTraceEvt) */
+}rfalNfcTraceEntry;
+
+
+/*! Inventory entry, one per device UID seen recently                                */
+typedef struct{
+    uint32_t                   firstSeen;           /*!< System tick when first seen  */
+    uint32_t                   lastSeen;            /*!< System tick when last seen   */
+    uint16_t                   rssi;                /*!< RSSI when last seen (mV)     */
+    rfalNfcDevType             type;                /*!< Device's type                */
+    uint8_t                    uid[RFAL_NFC_INV_UID_MAX_LEN]; /*!< Device's UID       */
+    uint8_t                    uidLen;              /*!< Device's UID length          */
+    bool                       handled;             /*!< Device has been activated    */
+}rfalNfcInvEntry;
+
+
 /*! Discovery parameters                                                                                           */
 typedef struct{
     rfalComplianceMode compMode;                        /*!< Compliancy mode to be used                            */
@@ -192,19 +236,28 @@ typedef struct{
     uint8_t            devLimit;                        /*!< Max number of devices                                 */
     
     rfalBitRate        nfcfBR;                          /*!< Bit rate to poll for NFC-F                            */
+    bool               nfcbAdaptiveColRes;              /*!< NFC-B: number of slots of each Collision Resolution round chosen from the estimated population, see rfalNfcbPollerAdaptiveCollisionResolution() */
     uint8_t            nfcid3[RFAL_NFCDEP_NFCID3_LEN];  /*!< NFCID3 to be used on the ATR_REQ/ATR_RES              */
     uint8_t            GB[RFAL_NFCDEP_GB_MAX_LEN];      /*!< General bytes to be used on the ATR-REQ               */
     uint8_t            GBLen;                           /*!< Length of the General Bytes                           */
     rfalBitRate        ap2pBR;                          /*!< Bit rate to poll for AP2P                             */
+    bool               isoDepBRAuto;                    /*!< ISO-DEP: request the highest bit rate supported by both (PPS, S(PARAMETERS) in ISO mode), a device deactivated on a degraded link is re-activated one bit rate lower */
     
     rfalLmConfPA       lmConfigPA;                      /*!< Configuration for Passive Listen mode NFC-A           */
     rfalLmConfPF       lmConfigPF;                      /*!< Configuration for Passive Listen mode NFC-A           */
     
     void               (*notifyCb)( rfalNfcState st );  /*!< Callback to Notify upper layer                        */
+    void               (*traceCb)( const rfalNfcTraceEntry *entry ); /*!< Callback to export trace entries (optional)  */
                                                         
     bool               wakeupEnabled;                   /*!< Enable Wake-Up mode before polling                    */
     bool               wakeupConfigDefault;             /*!< Wake-Up mode default configuration                    */
     rfalWakeUpConfig   wakeupConfig;                    /*!< Wake-Up mode configuration                            */
+    
+    bool               reacquireEnabled;                /*!< Re-acquire last activated device before full discovery*/
+    
+    uint16_t           invTtl;                          /*!< Inventory TTL (ms) until a device departs, shall not be 0 */
+    bool               invSkipHandled;                  /*!< Do not activate devices already handled within TTL    */
+    void               (*invCb)( rfalNfcInvEvt evt, const rfalNfcInvEntry *entry ); /*!< Inventory events callback (optional) */
 }rfalNfcDiscoverParam;
 
 
@@ -213,6 +266,7 @@ typedef union{  /*  PRQA S 0750 # MISRA 19.2 - Members of the union will not be
     uint8_t                 rfBuf[RFAL_NFC_RF_BUF_LEN]; /*!< RF buffer                                             */
     rfalIsoDepBufFormat     isoDepBuf;                  /*!< ISO-DEP Tx buffer format (with header/prologue)       */
     rfalNfcDepBufFormat     nfcDepBuf;                  /*!< NFC-DEP Rx buffer format (with header/prologue)       */
+    rfalNfcDepPduBufFormat  nfcDepPduBuf;               /*!< NFC-DEP PDU buffer format (with header/prologue)      */
 }rfalNfcBuffer;
 
 /*******************************************************************************/
@@ -257,6 +311,11 @@ ReturnCode rfalNfcInitialize( void );
  * The number of devices on the list is indicated by the devLimit and shall
  * be at >= 1.
  *
+ * If reacquireEnabled is set, each discovery cycle first tries to directly
+ * wake-up/select the last activated Poll device (same technology and UID).
+ * Only if it is not found a full Technology Detection and Collision 
+ * Resolution is performed.
+ *
  * \param[in]  disParams    : discovery configuration parameters
  *
  * \return ERR_WRONG_STATE  : Incorrect state for this operation
@@ -340,6 +399,17 @@ ReturnCode rfalNfcSelect( uint8_t devIdx );
  * therefore this method must be called first with txDataLen set to zero 
  * to retrieve the rxData and rcvLen locations.
  *
+ * On NFC-DEP complete PDUs of up to RFAL_FEATURE_NFC_DEP_PDU_MAX_LEN are
+ * exchanged, the DEP chaining is handled underneath. The exchange buffers
+ * grow with it: larger PDUs are to be streamed by the application with 
+ * rfalNfcDepStartStreamTransceive() on the activated device.
+ *
+ * On ISO-DEP a bit rate set by S(PARAMETERS) is stepped down by the ISO-DEP
+ * layer within the session upon repeated transmission errors. Otherwise the 
+ * bit rate is kept: rfalIsoDepPollIsBitRateDegraded() reports the degraded
+ * link and the application decides whether to deactivate the device. With
+ * isoDepBRAuto it is then re-activated one bit rate lower.
+ *
  *
  * \param[in]  txData       : data to be transmitted
  * \param[in]  txDataLen    : size of the data to be transmitted
@@ -350,11 +420,33 @@ ReturnCode rfalNfcSelect( uint8_t devIdx );
  *
  * \return ERR_WRONG_STATE  : Incorrect state for this operation
  * \return ERR_PARAM        : Invalid parameters
+ * \return ERR_NOMEM        : txData does not fit on the NFC-DEP PDU buffer
  * \return ERR_NONE         : No error
  *****************************************************************************
  */
 ReturnCode rfalNfcDataExchangeStart( uint8_t *txData, uint16_t txDataLen, uint8_t **rxData, uint16_t **rvdLen, uint32_t fwt );
 
+/*! 
+ *****************************************************************************
+ * \brief  RFAL NFC Get Data Exchange Tx buffer
+ *  
+ * Returns the location where the data of the next rfalNfcDataExchangeStart()
+ * may be built in place, right after the room the active interface needs 
+ * for its header/prologue. When txData of rfalNfcDataExchangeStart() points
+ * here the data is not copied again into the interface's Tx buffer.
+ *
+ * The buffer shall not be written while a Data Exchange is ongoing.
+ *
+ * \param[out] txData       : location where the data to be sent may be placed
+ * \param[out] txDataSize   : size available on txData
+ *
+ * \return ERR_WRONG_STATE  : No device activated
+ * \return ERR_PARAM        : Invalid parameters
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode rfalNfcDataExchangeGetTxBuffer( uint8_t **txData, uint16_t *txDataSize );
+
 /*! 
  *****************************************************************************
  * \brief  RFAL NFC Get Data Exchange Status
@@ -394,6 +486,73 @@ ReturnCode rfalNfcDataExchangeGetStatus( void );
  */
 ReturnCode rfalNfcDeactivate( bool discovery );
 
+/*! 
+ *****************************************************************************
+ * \brief  RFAL NFC Trace Read
+ *  
+ * Retrieves (and removes) the oldest entries from the trace ring buffer.
+ * An entry is recorded when a state is left and at the end of each 
+ * Technology Detection, Collision Resolution, Re-acquisition, Activation,
+ * Data Exchange and Deactivation phase.
+ * When the ring buffer is full the oldest entries are overwritten.
+ * 
+ * The same entries are also given to the traceCb (if set) when recorded.
+ *
+ * \param[out] entries      : location to place the trace entries
+ * \param[in]  maxEntries   : max number of entries to retrieve
+ * \param[out] entriesCnt   : number of entries retrieved
+ * \param[out] lostCnt      : number of entries overwritten since last read
+ *                            (optional, may be NULL)
+ *
+ * \return ERR_DISABLED     : Trace feature disabled (RFAL_FEATURE_NFC_TRACE)
+ * \return ERR_PARAM        : Invalid parameters
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode rfalNfcTraceRead( rfalNfcTraceEntry *entries, uint8_t maxEntries, uint8_t *entriesCnt, uint16_t *lostCnt );
+
+
+/*! 
+ *****************************************************************************
+ * \brief  RFAL NFC Inventory Read
+ *  
+ * Retrieves the devices currently on the inventory, i.e. the UIDs found 
+ * by the Collision Resolution which have not departed yet.
+ * 
+ * During discovery every device found is looked up by its UID: a new UID 
+ * raises an arrival event and one not seen for longer than invTtl raises 
+ * a departure event and is removed. Events are given to invCb (if set).
+ * If invSkipHandled is set, devices already activated while on the 
+ * inventory are removed from the device list and not activated again. 
+ * They are still resolved, refreshing their entry, but do not count 
+ * towards devLimit (up to RFAL_NFC_MAX_DEVICES devices are resolved).
+ * When the inventory is full the least recently seen entry departs.
+ *
+ * \param[out] entries      : location to place the inventory entries
+ * \param[in]  maxEntries   : max number of entries to retrieve
+ * \param[out] entriesCnt   : number of entries retrieved
+ *
+ * \return ERR_DISABLED     : Inventory feature disabled (RFAL_FEATURE_NFC_INVENTORY)
+ * \return ERR_PARAM        : Invalid parameters
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode rfalNfcInventoryRead( rfalNfcInvEntry *entries, uint8_t maxEntries, uint8_t *entriesCnt );
+
+
+/*! 
+ *****************************************************************************
+ * \brief  RFAL NFC Inventory Clear
+ *  
+ * Removes all entries from the inventory without raising departure events.
+ * Devices still in the field will be reported (and activated) again.
+ *
+ * \return ERR_DISABLED     : Inventory feature disabled (RFAL_FEATURE_NFC_INVENTORY)
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode rfalNfcInventoryClear( void );
+
 #endif /* RFAL_NFC_H */
 
 
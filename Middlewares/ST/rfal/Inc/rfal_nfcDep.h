@@ -70,6 +70,10 @@
  * DEFINES
  ******************************************************************************
  */
+#ifndef RFAL_FEATURE_NFC_DEP_PDU_MAX_LEN
+    #define RFAL_FEATURE_NFC_DEP_PDU_MAX_LEN  512U       /*!< NFC-DEP PDU max length, transferred by DEP chaining. Sizes rfalNfcDepPduBufFormat, thus the rfalNfc exchange buffers: larger PDUs are to be streamed (rfalNfcDepStartStreamTransceive()) */
+#endif
+
 #define RFAL_NFCDEP_FRAME_SIZE_MAX_LEN  254U             /*!< NFCIP Maximum Frame Size   Digital 1.0 Table 91                */
 #define RFAL_NFCDEP_DEPREQ_HEADER_LEN   5U               /*!< DEP_REQ header length: CMD_TYPE + CMD_CMD + PBF + DID + NAD    */
 
@@ -81,6 +85,7 @@
 #define RFAL_NFCDEP_CMDTYPE_LEN         1U               /*!< Length of the cmd type (REQ | RES) on NFCIP frame              */
 #define RFAL_NFCDEP_CMD_LEN             1U               /*!< Length of the cmd on NFCIP frame                               */
 #define RFAL_NFCDEP_DID_LEN             1U               /*!< Length of did on NFCIP frame                                   */
+#define RFAL_NFCDEP_NAD_LEN             1U               /*!< Length of nad on NFCIP frame                                   */
 #define RFAL_NFCDEP_DEP_PFB_LEN         1U               /*!< Length of the PFB field on NFCIP frame                         */
 
 #define RFAL_NFCDEP_DSL_RLS_LEN_NO_DID  (RFAL_NFCDEP_LEN_LEN + RFAL_NFCDEP_CMDTYPE_LEN + RFAL_NFCDEP_CMD_LEN)  /*!< Length of DSL_REQ and RLS_REQ with no DID */
@@ -291,6 +296,14 @@ typedef struct
 } rfalNfcDepBufFormat;
 
 
+/*! Structure of PDU Buffer format from caller                                               */
+typedef struct
+{
+    uint8_t  prologue[RFAL_NFCDEP_DEPREQ_HEADER_LEN];  /*!< Prologue space for NFC-DEP header*/
+    uint8_t  pdu[RFAL_FEATURE_NFC_DEP_PDU_MAX_LEN];    /*!< Complete PDU | Data area         */
+} rfalNfcDepPduBufFormat;
+
+
 /*! Activation info as Initiator and Target                                       */
 typedef union { /*  PRQA S 0750 # MISRA 19.2 - Both members of the union will not be used concurrently , device is only initiatior or target a time. No problem can occur. */
     struct {
@@ -404,6 +417,43 @@ typedef struct
 } rfalNfcDepTxRxParam;
 
 
+/*! Structure of parameters to be passed in for nfcDepStartPduTransceive                  */
+typedef struct
+{
+    rfalNfcDepPduBufFormat *txBuf;         /*!< Transmit Buffer struct reference          */
+    uint16_t               txBufLen;       /*!< Transmit Buffer PDU length in bytes       */
+    rfalNfcDepPduBufFormat *rxBuf;         /*!< Receive Buffer struct reference           */
+    uint16_t               *rxLen;         /*!< Received PDU length                       */
+    uint32_t               FWT;            /*!< FWT to be used (ignored in Listen Mode)   */
+    uint32_t               dFWT;           /*!< Delta FWT to be used                      */
+    uint16_t               FSx;            /*!< Other device Frame Size (FSD or FSC)      */
+    uint8_t                DID;            /*!< Device ID (RFAL_ISODEP_NO_DID if no DID)  */
+} rfalNfcDepPduTxRxParam;
+
+
+/*! Stream Tx callback: writes the next payload of the outgoing PDU, of at most paylMaxLen bytes, on payl and its length on paylLen.
+ *  Returns true if more payload follows: the DEP is then chained and shall carry exactly paylMaxLen bytes */
+typedef bool (* rfalNfcDepStreamTxCb)( uint8_t *payl, uint16_t paylMaxLen, uint16_t *paylLen );
+
+/*! Stream Rx callback: consumes the payload of an incoming DEP, isChaining set if more DEPs of the same PDU follow.
+ *  The payload is only valid during the call, the next DEP is received on the same buffer */
+typedef void (* rfalNfcDepStreamRxCb)( const uint8_t *payl, uint16_t paylLen, bool isChaining );
+
+
+/*! Structure of parameters to be passed in for nfcDepStartStreamTransceive               */
+typedef struct
+{
+    rfalNfcDepBufFormat    *txBuf;         /*!< Buffer each outgoing DEP is framed on     */
+    rfalNfcDepBufFormat    *rxBuf;         /*!< Buffer each incoming DEP is received on   */
+    rfalNfcDepStreamTxCb   txCb;           /*!< Provides the outgoing PDU, DEP by DEP     */
+    rfalNfcDepStreamRxCb   rxCb;           /*!< Consumes the incoming PDU, DEP by DEP     */
+    uint32_t               FWT;            /*!< FWT to be used (ignored in Listen Mode)   */
+    uint32_t               dFWT;           /*!< Delta FWT to be used                      */
+    uint16_t               FSx;            /*!< Other device Frame Size (FSD or FSC)      */
+    uint8_t                DID;            /*!< Device ID (RFAL_ISODEP_NO_DID if no DID)  */
+} rfalNfcDepStreamTxRxParam;
+
+
 /*
  * *****************************************************************************
  * GLOBAL VARIABLE DECLARATIONS
@@ -559,6 +609,50 @@ ReturnCode rfalNfcDepRLS( void );
 ReturnCode rfalNfcDepInitiatorHandleActivation( rfalNfcDepAtrParam* param, rfalBitRate desiredBR, rfalNfcDepDevice* nfcDepDev );
 
 
+/*! 
+ *****************************************************************************
+ *  \brief  NFC-DEP Initiator Start Activation
+ *   
+ *  This method starts rfalNfcDepInitiatorHandleActivation(): it sends the 
+ *  ATR_REQ and returns immediately. rfalWorker() must be executed and the 
+ *  result retrieved with rfalNfcDepInitiatorGetActivationStatus()
+ *  
+ *  The given nfcDepDev must remain valid until the activation completes
+ *   
+ *  \param[in]  param     : required parameters to initialize and send ATR_REQ
+ *  \param[in]  desiredBR : Desired bit rate supported by the Poller
+ *  \param[out] nfcDepDev : NFC-DEP information of the activated Listen device
+ *
+ *  \return ERR_WRONG_STATE  : RFAL not initialized or incorrect mode
+ *  \return ERR_PARAM        : Invalid parameters
+ *  \return ERR_NONE         : No error, activation started
+ *****************************************************************************
+ */
+ReturnCode rfalNfcDepInitiatorStartActivation( rfalNfcDepAtrParam* param, rfalBitRate desiredBR, rfalNfcDepDevice* nfcDepDev );
+
+
+/*! 
+ *****************************************************************************
+ *  \brief  NFC-DEP Initiator Get Activation Status
+ *   
+ *  Returns the status of the activation started by 
+ *  rfalNfcDepInitiatorStartActivation(). ATR_REQ is retried upon 
+ *  transmission errors and PSL_REQ is sent if the higher bit rates are 
+ *  supported by both devices
+ *
+ *  \return ERR_BUSY         : Operation is ongoing
+ *  \return ERR_WRONG_STATE  : No activation ongoing
+ *  \return ERR_TIMEOUT      : Timeout error
+ *  \return ERR_PAR          : Parity error detected
+ *  \return ERR_CRC          : CRC error detected
+ *  \return ERR_FRAMING      : Framing error detected
+ *  \return ERR_PROTO        : Protocol error detected
+ *  \return ERR_NONE         : No error, activation successful
+ *****************************************************************************
+ */
+ReturnCode rfalNfcDepInitiatorGetActivationStatus( void );
+
+
 /*!
  ******************************************************************************
  * \brief Check if buffer contains valid ATR_REQ 
@@ -689,6 +783,97 @@ ReturnCode rfalNfcDepStartTransceive( rfalNfcDepTxRxParam *param );
 ReturnCode rfalNfcDepGetTransceiveStatus( void );
 
 
+/*!
+ *****************************************************************************
+ * \brief Start PDU Transceive 
+ * 
+ * Transceives a complete PDU, of any length up to 
+ * RFAL_FEATURE_NFC_DEP_PDU_MAX_LEN, in Initiator or in Target role.
+ * It handles the DEP chaining in both directions, using the largest
+ * payload allowed by the other device's Frame Size on each DEP
+ * 
+ * The txBuf contains the complete PDU to be transmitted. 
+ * The Prologue field will be manipulated by the Transceive
+ * 
+ * DEPs are framed and received in place: chained blocks are sent from
+ * and received into the PDU buffers directly, without intermediate copies
+ * 
+ * \warning the txBuf will be modified during the transmission
+ * \warning the rxBuf must not be accessed until the Transceive is completed
+ * 
+ * \param[in] param: reference parameters to be used for the Transceive
+ *                    
+ * \return ERR_PARAM       : Bad request
+ * \return ERR_WRONG_STATE : The module is not in a proper state
+ * \return ERR_NONE        : The Transceive request has been started
+ *****************************************************************************
+ */
+ReturnCode rfalNfcDepStartPduTransceive( rfalNfcDepPduTxRxParam param );
+
+
+/*!
+ *****************************************************************************
+ * \brief Return the PDU Transceive status
+ *
+ * Returns the status of the NFC-DEP PDU Transceive
+ * 
+ * \return ERR_NONE      : Transceive has been completed successfully
+ * \return ERR_BUSY      : Transceive is ongoing
+ * \return ERR_PROTO     : Protocol error occurred
+ * \return ERR_TIMEOUT   : Timeout error occurred
+ * \return ERR_SLEEP_REQ : Deselect has been received and responded
+ * \return ERR_NOMEM     : The received PDU does not fit into the
+ *                            receive buffer
+ * \return ERR_LINK_LOSS : Communication is lost because Reader/Writer 
+ *                            has turned off its field
+ *****************************************************************************
+ */
+ReturnCode rfalNfcDepGetPduTransceiveStatus( void );
+
+
+/*!
+ *****************************************************************************
+ * \brief Start Stream Transceive 
+ * 
+ * Transceives a PDU of any length, in Initiator or in Target role, 
+ * without holding it in memory: the outgoing PDU is requested DEP by DEP
+ * through txCb and each incoming DEP is handed over to rxCb.
+ * The DEP chaining is handled underneath as on rfalNfcDepStartPduTransceive()
+ * 
+ * Only the two DEP buffers are used, the PDU length is neither bound by 
+ * RFAL_FEATURE_NFC_DEP_PDU_MAX_LEN nor by the buffers' size.
+ * The callbacks are called from rfalNfcDepGetStreamTransceiveStatus() 
+ * and shall not run rfalWorker()
+ * 
+ * In Listen mode the first call waits for the Initiator's PDU: txCb 
+ * shall then provide no payload
+ * 
+ * \param[in] param: reference parameters to be used for the Transceive
+ *                    
+ * \return ERR_PARAM       : Bad request
+ * \return ERR_WRONG_STATE : The module is not in a proper state
+ * \return ERR_NONE        : The Transceive request has been started
+ *****************************************************************************
+ */
+ReturnCode rfalNfcDepStartStreamTransceive( const rfalNfcDepStreamTxRxParam *param );
+
+
+/*!
+ *****************************************************************************
+ * \brief Return the Stream Transceive status
+ *
+ * Returns the status of the NFC-DEP Stream Transceive, calling txCb 
+ * for each outgoing DEP and rxCb for each incoming DEP on the way
+ * 
+ * \return ERR_NONE      : Transceive has been completed successfully
+ * \return ERR_BUSY      : Transceive is ongoing
+ * \return ERR_PARAM     : txCb provided an invalid payload length
+ * \return Others        : As defined on rfalNfcDepGetPduTransceiveStatus()
+ *****************************************************************************
+ */
+ReturnCode rfalNfcDepGetStreamTransceiveStatus( void );
+
+
 #endif /* RFAL_NFCDEP_H_ */
 
 /**
@@ -188,6 +188,7 @@ typedef struct
     rfalT1TRidRes            ridRes;                              /*!< RID_RES                                                                    */
 #endif /* RFAL_FEATURE_T1T */
     bool                     isSleep;                             /*!< Device sleeping flag                                                       */
+    uint16_t                 rssi;                                /*!< RSSI of the SEL_RES/RID_RES that found the device (mV), 0 if not available */
 } rfalNfcaListenDevice;
 
 /*
@@ -237,6 +238,42 @@ ReturnCode rfalNfcaPollerInitialize( void );
 ReturnCode rfalNfcaPollerCheckPresence( rfal14443AShortFrameCmd cmd, rfalNfcaSensRes *sensRes );
 
 
+/*! 
+ *****************************************************************************
+ * \brief  NFC-A Poller Start Check Presence
+ *  
+ * This method starts the NFC-A Check Presence (ALL_REQ or SENS_REQ) and 
+ * returns immediately. rfalWorker() must be executed and the result 
+ * retrieved with rfalNfcaPollerGetCheckPresenceStatus()
+ *  
+ * \param[in]  cmd     : Indicate if to send an ALL_REQ or a SENS_REQ
+ * \param[out] sensRes : If received, the SENS_RES
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or incorrect mode
+ * \return ERR_PARAM        : Invalid parameters
+ * \return ERR_IO           : Generic internal error 
+ * \return ERR_NONE         : No error, Check Presence started
+ *****************************************************************************
+ */
+ReturnCode rfalNfcaPollerStartCheckPresence( rfal14443AShortFrameCmd cmd, rfalNfcaSensRes *sensRes );
+
+
+/*! 
+ *****************************************************************************
+ * \brief  NFC-A Poller Get Check Presence Status
+ *  
+ * Returns the status of the Check Presence started by 
+ * rfalNfcaPollerStartCheckPresence()
+ *
+ * \return ERR_BUSY         : Operation is ongoing
+ * \return ERR_TIMEOUT      : Timeout error, no listener device detected
+ * \return ERR_PROTO        : Protocol error detected, one or more device in the field
+ * \return ERR_NONE         : No error, one or more device in the field
+ *****************************************************************************
+ */
+ReturnCode rfalNfcaPollerGetCheckPresenceStatus( void );
+
+
 /*! 
  *****************************************************************************
  * \brief  NFC-A Poller Select
@@ -261,6 +298,45 @@ ReturnCode rfalNfcaPollerCheckPresence( rfal14443AShortFrameCmd cmd, rfalNfcaSen
 ReturnCode rfalNfcaPollerSelect( const uint8_t *nfcid1, uint8_t nfcidLen, rfalNfcaSelRes *selRes );
 
 
+/*! 
+ *****************************************************************************
+ * \brief  NFC-A Poller Start Select
+ *  
+ * This method starts the selection of a NFC-A Listener device (PICC) and
+ * returns immediately. rfalWorker() must be executed and the result 
+ * retrieved with rfalNfcaPollerGetSelectStatus()
+ *  
+ * \param[in]  nfcid1   : Listener device NFCID1 to be selected, kept until done
+ * \param[in]  nfcidLen : Length of the NFCID1 to be selected  
+ * \param[out] selRes   : pointer to place the SEL_RES
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or incorrect mode
+ * \return ERR_PARAM        : Invalid parameters
+ * \return ERR_IO           : Generic internal error
+ * \return ERR_NONE         : No error, Select started
+ *****************************************************************************
+ */
+ReturnCode rfalNfcaPollerStartSelect( const uint8_t *nfcid1, uint8_t nfcidLen, rfalNfcaSelRes *selRes );
+
+
+/*! 
+ *****************************************************************************
+ * \brief  NFC-A Poller Get Select Status
+ *  
+ * Returns the status of the Select started by rfalNfcaPollerStartSelect()
+ *
+ * \return ERR_BUSY         : Operation is ongoing
+ * \return ERR_TIMEOUT      : Timeout error
+ * \return ERR_PAR          : Parity error detected
+ * \return ERR_CRC          : CRC error detected
+ * \return ERR_FRAMING      : Framing error detected
+ * \return ERR_PROTO        : Protocol error detected
+ * \return ERR_NONE         : No error, SEL_RES received
+ *****************************************************************************
+ */
+ReturnCode rfalNfcaPollerGetSelectStatus( void );
+
+
 /*! 
  *****************************************************************************
  * \brief  NFC-A Poller Sleep
@@ -277,6 +353,37 @@ ReturnCode rfalNfcaPollerSelect( const uint8_t *nfcid1, uint8_t nfcidLen, rfalNf
 ReturnCode rfalNfcaPollerSleep( void );
 
 
+/*! 
+ *****************************************************************************
+ * \brief  NFC-A Poller Start Sleep
+ *  
+ * This method starts sending a SLP_REQ (HLTA) and returns immediately.
+ * rfalWorker() must be executed and the status retrieved with 
+ * rfalNfcaPollerGetSleepStatus()
+ *  
+ * \return ERR_WRONG_STATE  : RFAL not initialized or incorrect mode
+ * \return ERR_PARAM        : Invalid parameters
+ * \return ERR_IO           : Generic internal error
+ * \return ERR_NONE         : No error, SLP_REQ started
+ *****************************************************************************
+ */
+ReturnCode rfalNfcaPollerStartSleep( void );
+
+
+/*! 
+ *****************************************************************************
+ * \brief  NFC-A Poller Get Sleep Status
+ *  
+ * Returns the status of the SLP_REQ started by rfalNfcaPollerStartSleep()
+ * The SLP_REQ is always considered acknowledged   Digital 2.0  6.9.2.1
+ *  
+ * \return ERR_BUSY         : Operation is ongoing
+ * \return ERR_NONE         : No error, SLP_REQ sent
+ *****************************************************************************
+ */
+ReturnCode rfalNfcaPollerGetSleepStatus( void );
+
+
 /*!
  *****************************************************************************
  * \brief  NFC-A Technology Detection
@@ -300,6 +407,42 @@ ReturnCode rfalNfcaPollerSleep( void );
 ReturnCode rfalNfcaPollerTechnologyDetection( rfalComplianceMode compMode, rfalNfcaSensRes *sensRes );
 
 
+/*!
+ *****************************************************************************
+ * \brief  NFC-A Start Technology Detection
+ *  
+ * This method starts the NFC-A Technology Detection and returns immediately.
+ * rfalWorker() must be executed and the result retrieved with 
+ * rfalNfcaPollerGetTechnologyDetectionStatus()
+ *  
+ * \param[in]  compMode  : compliance mode to be performed
+ * \param[out] sensRes   : location to store the SENS_RES, if received
+ *  
+ * \return ERR_WRONG_STATE  : RFAL not initialized or incorrect mode
+ * \return ERR_PARAM        : Invalid parameters
+ * \return ERR_IO           : Generic internal error
+ * \return ERR_NONE         : No error, Technology Detection started
+ *****************************************************************************
+ */
+ReturnCode rfalNfcaPollerStartTechnologyDetection( rfalComplianceMode compMode, rfalNfcaSensRes *sensRes );
+
+
+/*!
+ *****************************************************************************
+ * \brief  NFC-A Get Technology Detection Status
+ *  
+ * Returns the status of the Technology Detection started by 
+ * rfalNfcaPollerStartTechnologyDetection(), including the SLP_REQ 
+ * that follows a detection when not in ISO compliance
+ *  
+ * \return ERR_BUSY         : Operation is ongoing
+ * \return ERR_TIMEOUT      : Timeout error, no listener device detected
+ * \return ERR_NONE         : No error, one or more device in the field
+ *****************************************************************************
+ */
+ReturnCode rfalNfcaPollerGetTechnologyDetectionStatus( void );
+
+
 /*! 
  *****************************************************************************
  * \brief  NFC-A Poller Collision Resolution
@@ -330,6 +473,47 @@ ReturnCode rfalNfcaPollerTechnologyDetection( rfalComplianceMode compMode, rfalN
 ReturnCode rfalNfcaPollerSingleCollisionResolution( uint8_t devLimit, bool *collPending, rfalNfcaSelRes *selRes, uint8_t *nfcId1, uint8_t *nfcId1Len );
 
 
+/*! 
+ *****************************************************************************
+ * \brief  NFC-A Poller Start Collision Resolution
+ *  
+ * This method starts the collision resolution of one NFC-A Listener device
+ * and returns immediately. rfalWorker() must be executed and the result 
+ * retrieved with rfalNfcaPollerGetSingleCollisionResolutionStatus()
+ * 
+ * The given output locations must remain valid until the operation completes
+ *
+ * \param[in]  devLimit    : device limit value (CON_DEVICES_LIMIT)
+ * \param[out] collPending : pointer to collision pending flag (INT_COLL_PEND)
+ * \param[out] selRes      : location to store the last Select Response from listener device (PICC)
+ * \param[out] nfcId1      : location to store the NFCID1 (UID), ensure RFAL_NFCA_CASCADE_3_UID_LEN
+ * \param[out] nfcId1Len   : pointer to length of NFCID1 (UID)
+ *
+ * \return ERR_PARAM        : Invalid parameters
+ * \return ERR_NONE         : No error, Collision Resolution started
+ *****************************************************************************
+ */
+ReturnCode rfalNfcaPollerStartSingleCollisionResolution( uint8_t devLimit, bool *collPending, rfalNfcaSelRes *selRes, uint8_t *nfcId1, uint8_t *nfcId1Len );
+
+
+/*! 
+ *****************************************************************************
+ * \brief  NFC-A Poller Get Collision Resolution Status
+ *  
+ * Returns the status of the collision resolution started by
+ * rfalNfcaPollerStartSingleCollisionResolution()
+ *
+ * \return ERR_BUSY         : Operation is ongoing
+ * \return ERR_WRONG_STATE  : No Collision Resolution has been started
+ * \return ERR_IO           : Generic internal error
+ * \return ERR_PROTO        : Card length invalid
+ * \return ERR_IGNORE       : conDevLimit is 0 and there is a collision
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode rfalNfcaPollerGetSingleCollisionResolutionStatus( void );
+
+
 /*! 
  *****************************************************************************
  * \brief  NFC-A Poller Full Collision Resolution
@@ -351,6 +535,12 @@ ReturnCode rfalNfcaPollerSingleCollisionResolution( uint8_t devLimit, bool *coll
  * This proprietary behaviour ensures proper activation of certain devices that suffer
  * from influence of Type B commands as foreseen in ISO14443-3 5.2.3
  *  
+ * The collisions found while resolving a device are kept. Once that device is put 
+ * to Sleep the next one is resolved from the deepest unresolved collision (re-selecting
+ * the previous Cascade Levels if needed) instead of starting the anticollision again
+ * from the first bit of CL1. A SENS_REQ ends the loop once all known collisions are 
+ * resolved and no other device responds.
+ *  
  *  
  * When devLimit = 0 it is configured to perform collision detection only. Once a collision 
  * is detected the collision resolution is aborted immidiatly. If only one device is found
@@ -366,6 +556,47 @@ ReturnCode rfalNfcaPollerSingleCollisionResolution( uint8_t devLimit, bool *coll
 ReturnCode rfalNfcaPollerFullCollisionResolution( rfalComplianceMode compMode, uint8_t devLimit, rfalNfcaListenDevice *nfcaDevList, uint8_t *devCnt );
 
 
+/*! 
+ *****************************************************************************
+ * \brief  NFC-A Poller Start Full Collision Resolution
+ *  
+ * This method starts the Full Collision resolution, as described in 
+ * rfalNfcaPollerFullCollisionResolution(), and returns immediately.
+ * rfalWorker() must be executed and the result retrieved with
+ * rfalNfcaPollerGetFullCollisionResolutionStatus()
+ * 
+ * The given nfcaDevList and devCnt must remain valid until the operation completes
+ *
+ * \param[in]  compMode    : compliance mode to be performed
+ * \param[in]  devLimit    : device limit value, and size nfcaDevList
+ * \param[out] nfcaDevList : NFC-A listener device info
+ * \param[out] devCnt      : Devices found counter
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+ * \return ERR_PARAM        : Invalid parameters
+ * \return ERR_IO           : Generic internal error
+ * \return ERR_NONE         : No error, Full Collision Resolution started
+ *****************************************************************************
+ */
+ReturnCode rfalNfcaPollerStartFullCollisionResolution( rfalComplianceMode compMode, uint8_t devLimit, rfalNfcaListenDevice *nfcaDevList, uint8_t *devCnt );
+
+
+/*! 
+ *****************************************************************************
+ * \brief  NFC-A Poller Get Full Collision Resolution Status
+ *  
+ * Returns the status of the Full Collision resolution started by
+ * rfalNfcaPollerStartFullCollisionResolution()
+ *
+ * \return ERR_BUSY         : Operation is ongoing
+ * \return ERR_WRONG_STATE  : No Full Collision Resolution has been started
+ * \return ERR_IO           : Generic internal error
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode rfalNfcaPollerGetFullCollisionResolutionStatus( void );
+
+
 /*!
  *****************************************************************************
  * \brief NFC-A Listener is SLP_REQ 
@@ -175,6 +175,7 @@ typedef struct
     uint8_t           sensbResLen;                              /*!< SENSB_RES length      */   
     rfalNfcbSensbRes  sensbRes;                                 /*!< SENSB_RES             */
     bool              isSleep;                                  /*!< Device sleeping flag  */
+    uint16_t          rssi;                                     /*!< RSSI of the SENSB_RES that found the device (mV), 0 if not available */
 }rfalNfcbListenDevice;
 
 /*
@@ -248,6 +249,42 @@ ReturnCode rfalNfcbPollerInitializeWithParams( uint8_t AFI, uint8_t PARAM );
 ReturnCode rfalNfcbPollerCheckPresence( rfalNfcbSensCmd cmd, rfalNfcbSlots slots, rfalNfcbSensbRes *sensbRes, uint8_t *sensbResLen );
 
 
+/*! 
+ *****************************************************************************
+ * \brief  NFC-B Poller Start Check Presence
+ *  
+ * This method starts the NFC-B Check Presence (ALLB_REQ or SENSB_REQ) and returns immediately.
+ * rfalWorker() must be executed and the result retrieved with
+ * rfalNfcbPollerGetCheckPresenceStatus()
+ * 
+ * \param[in]  cmd         : Indicate if to send an ALLB_REQ or a SENSB_REQ
+ * \param[in]  slots       : The number of slots to be reported on the SENSB_REQ
+ * \param[out] sensbRes    : If received, the SENSB_RES
+ * \param[out] sensbResLen : If received, the SENSB_RES length
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or incorrect mode
+ * \return ERR_PARAM        : Invalid parameters
+ * \return ERR_IO           : Generic internal error
+ * \return ERR_NONE         : No error, Check Presence started
+ *****************************************************************************
+ */
+ReturnCode rfalNfcbPollerStartCheckPresence( rfalNfcbSensCmd cmd, rfalNfcbSlots slots, rfalNfcbSensbRes *sensbRes, uint8_t *sensbResLen );
+
+
+/*! 
+ *****************************************************************************
+ * \brief  NFC-B Poller Get Check Presence Status
+ *  
+ * Returns the status of the NFC-B Check Presence (ALLB_REQ or SENSB_REQ) started by
+ * rfalNfcbPollerStartCheckPresence()
+ *
+ * \return ERR_BUSY         : Operation is ongoing
+ * \return Others           : As defined on rfalNfcbPollerCheckPresence()
+ *****************************************************************************
+ */
+ReturnCode rfalNfcbPollerGetCheckPresenceStatus( void );
+
+
 /*! 
  *****************************************************************************
  * \brief  NFC-B Poller Sleep
@@ -267,6 +304,39 @@ ReturnCode rfalNfcbPollerCheckPresence( rfalNfcbSensCmd cmd, rfalNfcbSlots slots
 ReturnCode rfalNfcbPollerSleep( const uint8_t* nfcid0 );
 
 
+/*! 
+ *****************************************************************************
+ * \brief  NFC-B Poller Start Sleep
+ *  
+ * This method starts the SLPB_REQ (HLTB) transmission and returns immediately.
+ * rfalWorker() must be executed and the result retrieved with
+ * rfalNfcbPollerGetSleepStatus()
+ * 
+ * \param[in]  nfcid0       : NFCID of the device to be put to Sleep
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or incorrect mode
+ * \return ERR_PARAM        : Invalid parameters
+ * \return ERR_IO           : Generic internal error
+ * \return ERR_NONE         : No error, Sleep started
+ *****************************************************************************
+ */
+ReturnCode rfalNfcbPollerStartSleep( const uint8_t* nfcid0 );
+
+
+/*! 
+ *****************************************************************************
+ * \brief  NFC-B Poller Get Sleep Status
+ *  
+ * Returns the status of the SLPB_REQ (HLTB) transmission started by
+ * rfalNfcbPollerStartSleep()
+ *
+ * \return ERR_BUSY         : Operation is ongoing
+ * \return Others           : As defined on rfalNfcbPollerSleep()
+ *****************************************************************************
+ */
+ReturnCode rfalNfcbPollerGetSleepStatus( void );
+
+
 /*! 
  *****************************************************************************
  * \brief  NFC-B Poller Slot Marker
@@ -290,6 +360,41 @@ ReturnCode rfalNfcbPollerSleep( const uint8_t* nfcid0 );
  */
 ReturnCode rfalNfcbPollerSlotMarker( uint8_t slotCode, rfalNfcbSensbRes *sensbRes, uint8_t *sensbResLen );
 
+
+/*! 
+ *****************************************************************************
+ * \brief  NFC-B Poller Start Slot Marker
+ *  
+ * This method starts the SLOT_MARKER transmission and returns immediately.
+ * rfalWorker() must be executed and the result retrieved with
+ * rfalNfcbPollerGetSlotMarkerStatus()
+ * 
+ * \param[in]  slotCode     : Slot Code [1-15] 
+ * \param[out] sensbRes     : If received, the SENSB_RES
+ * \param[out] sensbResLen  : If received, the SENSB_RES length
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or incorrect mode
+ * \return ERR_PARAM        : Invalid parameters
+ * \return ERR_IO           : Generic internal error
+ * \return ERR_NONE         : No error, Slot Marker started
+ *****************************************************************************
+ */
+ReturnCode rfalNfcbPollerStartSlotMarker( uint8_t slotCode, rfalNfcbSensbRes *sensbRes, uint8_t *sensbResLen );
+
+
+/*! 
+ *****************************************************************************
+ * \brief  NFC-B Poller Get Slot Marker Status
+ *  
+ * Returns the status of the SLOT_MARKER transmission started by
+ * rfalNfcbPollerStartSlotMarker()
+ *
+ * \return ERR_BUSY         : Operation is ongoing
+ * \return Others           : As defined on rfalNfcbPollerSlotMarker()
+ *****************************************************************************
+ */
+ReturnCode rfalNfcbPollerGetSlotMarkerStatus( void );
+
 /*! 
  *****************************************************************************
  * \brief  NFC-B Technology Detection
@@ -309,6 +414,41 @@ ReturnCode rfalNfcbPollerSlotMarker( uint8_t slotCode, rfalNfcbSensbRes *sensbRe
  */
 ReturnCode rfalNfcbPollerTechnologyDetection( rfalComplianceMode compMode, rfalNfcbSensbRes *sensbRes, uint8_t *sensbResLen );
 
+
+/*! 
+ *****************************************************************************
+ * \brief  NFC-B Poller Start Technology Detection
+ *  
+ * This method starts the NFC-B Technology Detection and returns immediately.
+ * rfalWorker() must be executed and the result retrieved with
+ * rfalNfcbPollerGetTechnologyDetectionStatus()
+ * 
+ * \param[in]  compMode    : compliance mode to be performed
+ * \param[out] sensbRes    : location to store the SENSB_RES, if received
+ * \param[out] sensbResLen : length of the SENSB_RES, if received
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or incorrect mode
+ * \return ERR_PARAM        : Invalid parameters
+ * \return ERR_IO           : Generic internal error
+ * \return ERR_NONE         : No error, Technology Detection started
+ *****************************************************************************
+ */
+ReturnCode rfalNfcbPollerStartTechnologyDetection( rfalComplianceMode compMode, rfalNfcbSensbRes *sensbRes, uint8_t *sensbResLen );
+
+
+/*! 
+ *****************************************************************************
+ * \brief  NFC-B Poller Get Technology Detection Status
+ *  
+ * Returns the status of the NFC-B Technology Detection started by
+ * rfalNfcbPollerStartTechnologyDetection()
+ *
+ * \return ERR_BUSY         : Operation is ongoing
+ * \return Others           : As defined on rfalNfcbPollerTechnologyDetection()
+ *****************************************************************************
+ */
+ReturnCode rfalNfcbPollerGetTechnologyDetectionStatus( void );
+
 /*! 
  *****************************************************************************
  * \brief  NFC-B Poller Collision Resolution
@@ -334,6 +474,44 @@ ReturnCode rfalNfcbPollerTechnologyDetection( rfalComplianceMode compMode, rfalN
  */
 ReturnCode rfalNfcbPollerCollisionResolution( rfalComplianceMode compMode, uint8_t devLimit, rfalNfcbListenDevice *nfcbDevList, uint8_t *devCnt );
 
+
+/*! 
+ *****************************************************************************
+ * \brief  NFC-B Poller Start Collision Resolution
+ *  
+ * This method starts the NFC-B Collision Resolution and returns immediately.
+ * rfalWorker() must be executed and the result retrieved with
+ * rfalNfcbPollerGetCollisionResolutionStatus()
+ * 
+ * The given nfcbDevList and devCnt must remain valid until the operation completes
+ * 
+ * \param[in]  compMode    : compliance mode to be performed
+ * \param[in]  devLimit    : device limit value, and size nfcbDevList
+ * \param[out] nfcbDevList : NFC-B listener device info
+ * \param[out] devCnt      : devices found counter
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or incorrect mode
+ * \return ERR_PARAM        : Invalid parameters
+ * \return ERR_IO           : Generic internal error
+ * \return ERR_NONE         : No error, Collision Resolution started
+ *****************************************************************************
+ */
+ReturnCode rfalNfcbPollerStartCollisionResolution( rfalComplianceMode compMode, uint8_t devLimit, rfalNfcbListenDevice *nfcbDevList, uint8_t *devCnt );
+
+
+/*! 
+ *****************************************************************************
+ * \brief  NFC-B Poller Get Collision Resolution Status
+ *  
+ * Returns the status of the NFC-B Collision Resolution started by
+ * rfalNfcbPollerStartCollisionResolution()
+ *
+ * \return ERR_BUSY         : Operation is ongoing
+ * \return Others           : As defined on rfalNfcbPollerCollisionResolution()
+ *****************************************************************************
+ */
+ReturnCode rfalNfcbPollerGetCollisionResolutionStatus( void );
+
 /*! 
  *****************************************************************************
  * \brief  NFC-B Poller Collision Resolution Slotted
@@ -372,6 +550,118 @@ ReturnCode rfalNfcbPollerCollisionResolution( rfalComplianceMode compMode, uint8
 ReturnCode rfalNfcbPollerSlottedCollisionResolution( rfalComplianceMode compMode, uint8_t devLimit, rfalNfcbSlots initSlots, rfalNfcbSlots endSlots, rfalNfcbListenDevice *nfcbDevList, uint8_t *devCnt, bool *colPending );
 
 
+/*! 
+ *****************************************************************************
+ * \brief  NFC-B Poller Start Slotted Collision Resolution
+ *  
+ * This method starts the NFC-B slotted Collision Resolution and returns immediately.
+ * rfalWorker() must be executed and the result retrieved with
+ * rfalNfcbPollerGetSlottedCollisionResolutionStatus()
+ * 
+ * The given nfcbDevList, devCnt and colPending must remain valid until 
+ * the operation completes
+ * 
+ * \param[in]  compMode    : compliance mode to be performed
+ * \param[in]  devLimit    : device limit value, and size nfcbDevList
+ * \param[in]  initSlots   : number of slots to open initially 
+ * \param[in]  endSlots    : number of slots when to stop collision resolution 
+ * \param[out] nfcbDevList : NFC-B listener device info
+ * \param[out] devCnt      : devices found counter
+ * \param[out] colPending  : flag indicating whether collision are still pending
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or incorrect mode
+ * \return ERR_PARAM        : Invalid parameters
+ * \return ERR_IO           : Generic internal error
+ * \return ERR_NONE         : No error, Slotted Collision Resolution started
+ *****************************************************************************
+ */
+ReturnCode rfalNfcbPollerStartSlottedCollisionResolution( rfalComplianceMode compMode, uint8_t devLimit, rfalNfcbSlots initSlots, rfalNfcbSlots endSlots, rfalNfcbListenDevice *nfcbDevList, uint8_t *devCnt, bool *colPending );
+
+
+/*! 
+ *****************************************************************************
+ * \brief  NFC-B Poller Get Slotted Collision Resolution Status
+ *  
+ * Returns the status of the NFC-B slotted Collision Resolution started by
+ * rfalNfcbPollerStartSlottedCollisionResolution()
+ *
+ * \return ERR_BUSY         : Operation is ongoing
+ * \return Others           : As defined on rfalNfcbPollerSlottedCollisionResolution()
+ *****************************************************************************
+ */
+ReturnCode rfalNfcbPollerGetSlottedCollisionResolutionStatus( void );
+
+
+/*! 
+ *****************************************************************************
+ * \brief  NFC-B Poller Adaptive Collision Resolution
+ *  
+ * NFC-B slotted Collision Resolution, as rfalNfcbPollerSlottedCollisionResolution(),
+ * where the number of slots of each round is chosen from the population estimated 
+ * out of the empty, single and collided slots of the previous round.
+ * The number of slots is set just above the estimated remaining devices, which 
+ * maximises the devices identified per airtime as empty slots are the cheapest.
+ * 
+ * The first round uses a single slot, as continuation of Technology Detection,
+ * and the loop ends once no collision is pending or a round with 16 slots 
+ * found no device.
+ *
+ * \param[in]  compMode    : compliance mode to be performed
+ * \param[in]  devLimit    : device limit value, and size nfcbDevList
+ * \param[out] nfcbDevList : NFC-B listener device info
+ * \param[out] devCnt      : devices found counter
+ * \param[out] colPending  : flag indicating whether collision are still pending
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+ * \return ERR_PARAM        : Invalid parameters
+ * \return ERR_IO           : Generic internal error
+ * \return ERR_PROTO        : Protocol error detected
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode rfalNfcbPollerAdaptiveCollisionResolution( rfalComplianceMode compMode, uint8_t devLimit, rfalNfcbListenDevice *nfcbDevList, uint8_t *devCnt, bool *colPending );
+
+
+/*! 
+ *****************************************************************************
+ * \brief  NFC-B Poller Start Adaptive Collision Resolution
+ *  
+ * This method starts the NFC-B adaptive Collision Resolution and returns immediately.
+ * rfalWorker() must be executed and the result retrieved with
+ * rfalNfcbPollerGetAdaptiveCollisionResolutionStatus()
+ * 
+ * The given nfcbDevList, devCnt and colPending must remain valid until 
+ * the operation completes
+ * 
+ * \param[in]  compMode    : compliance mode to be performed
+ * \param[in]  devLimit    : device limit value, and size nfcbDevList
+ * \param[out] nfcbDevList : NFC-B listener device info
+ * \param[out] devCnt      : devices found counter
+ * \param[out] colPending  : flag indicating whether collision are still pending
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or incorrect mode
+ * \return ERR_PARAM        : Invalid parameters
+ * \return ERR_IO           : Generic internal error
+ * \return ERR_NONE         : No error, Adaptive Collision Resolution started
+ *****************************************************************************
+ */
+ReturnCode rfalNfcbPollerStartAdaptiveCollisionResolution( rfalComplianceMode compMode, uint8_t devLimit, rfalNfcbListenDevice *nfcbDevList, uint8_t *devCnt, bool *colPending );
+
+
+/*! 
+ *****************************************************************************
+ * \brief  NFC-B Poller Get Adaptive Collision Resolution Status
+ *  
+ * Returns the status of the NFC-B adaptive Collision Resolution started by
+ * rfalNfcbPollerStartAdaptiveCollisionResolution()
+ *
+ * \return ERR_BUSY         : Operation is ongoing
+ * \return Others           : As defined on rfalNfcbPollerAdaptiveCollisionResolution()
+ *****************************************************************************
+ */
+ReturnCode rfalNfcbPollerGetAdaptiveCollisionResolutionStatus( void );
+
+
 /*! 
  *****************************************************************************
  * \brief  NFC-B TR2 code to FDT
@@ -173,6 +173,7 @@ typedef struct
 {
     uint8_t           sensfResLen;              /*!< SENF_RES length    */
     rfalNfcfSensfRes  sensfRes;                 /*!< SENF_RES           */
+    uint16_t          rssi;                     /*!< RSSI of the SENSF_RES (mV), 0 if not available */
 } rfalNfcfListenDevice;
 
 typedef  uint16_t rfalNfcfServ;                 /*!< NFC-F Service Code */
@@ -238,6 +239,39 @@ ReturnCode rfalNfcfPollerInitialize( rfalBitRate bitRate );
 ReturnCode rfalNfcfPollerCheckPresence( void );
 
 
+/*! 
+ *****************************************************************************
+ *  \brief NFC-F Poller Start Check Presence
+ *  
+ *  This function starts the Poll/SENSF command of rfalNfcfPollerCheckPresence()
+ *  and returns immediately. rfalWorker() must be executed and the result 
+ *  retrieved with rfalNfcfPollerGetCheckPresenceStatus()
+ * 
+ * \return ERR_WRONG_STATE  : RFAL not initialized or incorrect mode
+ * \return ERR_PARAM        : Invalid parameters
+ * \return ERR_NONE         : No error, Check Presence started
+ *
+ *****************************************************************************
+ */
+ReturnCode rfalNfcfPollerStartCheckPresence( void );
+
+
+/*! 
+ *****************************************************************************
+ *  \brief NFC-F Poller Get Check Presence Status
+ *  
+ *  Returns the status of the Check Presence started by
+ *  rfalNfcfPollerStartCheckPresence()
+ * 
+ * \return ERR_BUSY         : Operation is ongoing
+ * \return ERR_TIMEOUT      : Timeout error, no listener device detected
+ * \return ERR_NONE         : No error and some NFC-F device was detected
+ *
+ *****************************************************************************
+ */
+ReturnCode rfalNfcfPollerGetCheckPresenceStatus( void );
+
+
 /*! 
  *****************************************************************************
  * \brief NFC-F Poller Poll
@@ -288,6 +322,120 @@ ReturnCode rfalNfcfPollerPoll( rfalFeliCaPollSlots slots, uint16_t sysCode, uint
 ReturnCode rfalNfcfPollerCollisionResolution( rfalComplianceMode compMode, uint8_t devLimit, rfalNfcfListenDevice *nfcfDevList, uint8_t *devCnt );
 
 
+/*! 
+ *****************************************************************************
+ * \brief  NFC-F Poller Start Full Collision Resolution
+ *  
+ * Starts the Collision resolution of rfalNfcfPollerCollisionResolution() 
+ * and returns immediately. rfalWorker() must be executed and the result 
+ * retrieved with rfalNfcfPollerGetCollisionResolutionStatus()
+ * 
+ * The given nfcfDevList and devCnt must remain valid until the operation completes
+ *
+ * \param[in]  compMode    : compliance mode to be performed
+ * \param[in]  devLimit    : device limit value, and size nfcaDevList
+ * \param[out] nfcfDevList : NFC-F listener devices list
+ * \param[out] devCnt      : Devices found counter
+ *
+ * \return ERR_PARAM        : Invalid parameters
+ * \return ERR_NONE         : No error, Collision Resolution started
+ *****************************************************************************
+ */
+ReturnCode rfalNfcfPollerStartCollisionResolution( rfalComplianceMode compMode, uint8_t devLimit, rfalNfcfListenDevice *nfcfDevList, uint8_t *devCnt );
+
+
+/*! 
+ *****************************************************************************
+ * \brief  NFC-F Poller Get Full Collision Resolution Status
+ *  
+ * Returns the status of the Collision resolution started by 
+ * rfalNfcfPollerStartCollisionResolution()
+ *
+ * \return ERR_BUSY         : Operation is ongoing
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode rfalNfcfPollerGetCollisionResolutionStatus( void );
+
+
+/*! 
+ *****************************************************************************
+ * \brief  NFC-F Poller Inventory
+ *  
+ * Performs a multi-round inventory over the given list of System Codes.
+ * Unlike rfalNfcfPollerCollisionResolution() which relies on a single 
+ * SENSF_REQ, the devices whose responses collided are given further 
+ * rounds. NFCID2s are deduplicated across rounds and System Codes.
+ * 
+ * Each System Code starts with 4 slots; the following rounds are sized 
+ * to the number of responders seen and escalated up to 16 slots while 
+ * collisions reveal no new device.
+ * A System Code is concluded once a round has no collisions, or once the 
+ * probability of a device having lost every round since the last new 
+ * NFCID2 is below (100 - confidence)%, or after a maximum of rounds.
+ * 
+ * \warning Devices that generate a random NFCID2 on every SENSF_REQ 
+ *          (e.g. some phones) will be reported once per round
+ *
+ * \param[in]  sysCodes    : System Codes to poll, NULL/0 for RFAL_NFCF_SYSTEMCODE only
+ * \param[in]  sysCodesCnt : number of System Codes in sysCodes
+ * \param[in]  confidence  : completeness confidence in % (0 - 100)
+ * \param[in]  devLimit    : device limit value, and size nfcfDevList
+ * \param[out] nfcfDevList : NFC-F listener devices list
+ * \param[out] devCnt      : Devices found counter
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+ * \return ERR_PARAM        : Invalid parameters
+ * \return ERR_NONE         : No error
+ * \return Others           : SENSF_REQ failed, devCnt holds the devices 
+ *                            found before the error
+ *****************************************************************************
+ */
+ReturnCode rfalNfcfPollerInventory( const uint16_t *sysCodes, uint8_t sysCodesCnt, uint8_t confidence, uint8_t devLimit, rfalNfcfListenDevice *nfcfDevList, uint8_t *devCnt );
+
+
+/*! 
+ *****************************************************************************
+ * \brief  NFC-F Poller Start Inventory
+ *  
+ * Starts the Inventory of rfalNfcfPollerInventory() and returns 
+ * immediately. rfalWorker() must be executed and the result retrieved 
+ * with rfalNfcfPollerGetInventoryStatus()
+ * 
+ * The given sysCodes, nfcfDevList and devCnt must remain valid until the 
+ * operation completes
+ *
+ * \param[in]  sysCodes    : System Codes to poll, NULL/0 for RFAL_NFCF_SYSTEMCODE only
+ * \param[in]  sysCodesCnt : number of System Codes in sysCodes
+ * \param[in]  confidence  : completeness confidence in % (0 - 100)
+ * \param[in]  devLimit    : device limit value, and size nfcfDevList
+ * \param[out] nfcfDevList : NFC-F listener devices list
+ * \param[out] devCnt      : Devices found counter
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+ * \return ERR_PARAM        : Invalid parameters
+ * \return ERR_NONE         : No error, Inventory started
+ *****************************************************************************
+ */
+ReturnCode rfalNfcfPollerStartInventory( const uint16_t *sysCodes, uint8_t sysCodesCnt, uint8_t confidence, uint8_t devLimit, rfalNfcfListenDevice *nfcfDevList, uint8_t *devCnt );
+
+
+/*! 
+ *****************************************************************************
+ * \brief  NFC-F Poller Get Inventory Status
+ *  
+ * Returns the status of the Inventory started by 
+ * rfalNfcfPollerStartInventory()
+ *
+ * \return ERR_BUSY         : Operation is ongoing
+ * \return ERR_NONE         : No error, devCnt holds the devices found
+ * \return Others           : SENSF_REQ failed, Inventory stopped with the 
+ *                            devices found so far on devCnt
+ *****************************************************************************
+ */
+ReturnCode rfalNfcfPollerGetInventoryStatus( void );
+
+
 /*! 
  *****************************************************************************
  * \brief  NFC-F Poller Check/Read
@@ -243,6 +243,7 @@ typedef struct
 {
     rfalNfcvInventoryRes    InvRes;     /*!< INVENTORY_RES                  */
     bool                    isSleep;    /*!< Device sleeping flag           */
+    uint16_t                rssi;       /*!< RSSI of the INVENTORY_RES (mV), 0 if not available */
 } rfalNfcvListenDevice;
 
 
@@ -266,6 +267,24 @@ typedef struct
  */
 ReturnCode rfalNfcvPollerInitialize( void );
 
+/*! 
+ *****************************************************************************
+ * \brief  NFC-V Poller Set Write Time
+ *  
+ * Sets the programming time of one block of the VICC, as known from its
+ * IC reference. Write commands then wait this time per block written:
+ *  - without Option flag it sizes the response timeout, which is never
+ *    shorter than FDTV,EOF max (20ms) and grows with the blocks written
+ *  - with Option flag the EOF is sent once the blocks are programmed
+ *    instead of after FDTV,EOF max
+ *
+ * rfalNfcvPollerInitialize() resets it to unknown: FDTV,EOF max is used
+ *
+ * \param[in]  blockWrTime : programming time of one block (1/fc), 0: unknown
+ *****************************************************************************
+ */
+void rfalNfcvPollerSetWriteTime( uint32_t blockWrTime );
+
 /*! 
  *****************************************************************************
  * \brief  NFC-V Poller Check Presence
@@ -284,6 +303,40 @@ ReturnCode rfalNfcvPollerInitialize( void );
  */
 ReturnCode rfalNfcvPollerCheckPresence( rfalNfcvInventoryRes *invRes );
 
+
+/*! 
+ *****************************************************************************
+ * \brief  NFC-V Poller Start Check Presence
+ *  
+ * This method starts the INVENTORY_REQ of rfalNfcvPollerCheckPresence() and
+ * returns immediately. rfalWorker() must be executed and the result 
+ * retrieved with rfalNfcvPollerGetCheckPresenceStatus()
+ *  
+ * \param[out] invRes : If received, the INVENTORY_RES
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or incorrect mode
+ * \return ERR_PARAM        : Invalid parameters
+ * \return ERR_NONE         : No error, Check Presence started
+ *****************************************************************************
+ */
+ReturnCode rfalNfcvPollerStartCheckPresence( rfalNfcvInventoryRes *invRes );
+
+
+/*! 
+ *****************************************************************************
+ * \brief  NFC-V Poller Get Check Presence Status
+ *  
+ * Returns the status of the Check Presence started by 
+ * rfalNfcvPollerStartCheckPresence()
+ *
+ * \return ERR_BUSY         : Operation is ongoing
+ * \return ERR_TIMEOUT      : Timeout error, no listener device detected
+ * \return ERR_NONE         : No error, one or more device in the field
+ *****************************************************************************
+ */
+ReturnCode rfalNfcvPollerGetCheckPresenceStatus( void );
+
+
 /*! 
  *****************************************************************************
  * \brief NFC-F Poller Poll
@@ -311,6 +364,45 @@ ReturnCode rfalNfcvPollerCheckPresence( rfalNfcvInventoryRes *invRes );
  */ 
 ReturnCode rfalNfcvPollerInventory( rfalNfcvNumSlots nSlots, uint8_t maskLen, const uint8_t *maskVal, rfalNfcvInventoryRes *invRes, uint16_t* rcvdLen );
 
+
+/*! 
+ *****************************************************************************
+ * \brief NFC-V Poller Start Inventory
+ * 
+ * This function starts the INVENTORY command of rfalNfcvPollerInventory() 
+ * and returns immediately. rfalWorker() must be executed and the result 
+ * retrieved with rfalNfcvPollerGetInventoryStatus()
+ *
+ * \param[in]  nSlots  : Number of Slots to be sent (1 or 16)
+ * \param[in]  maskLen : Number bits on the Mask value
+ * \param[in]  maskVal : location of the Mask value
+ * \param[out] invRes  : location to place the INVENTORY_RES
+ * \param[out] rcvdLen : number of bits received (without collision)
+ * 
+ * \return ERR_WRONG_STATE  : RFAL not initialized or incorrect mode
+ * \return ERR_PARAM        : Invalid parameters
+ * \return ERR_NONE         : No error, Inventory started
+ *****************************************************************************
+ */ 
+ReturnCode rfalNfcvPollerStartInventory( rfalNfcvNumSlots nSlots, uint8_t maskLen, const uint8_t *maskVal, rfalNfcvInventoryRes *invRes, uint16_t* rcvdLen );
+
+
+/*! 
+ *****************************************************************************
+ * \brief NFC-V Poller Get Inventory Status
+ * 
+ * Returns the status of the Inventory started by rfalNfcvPollerStartInventory()
+ * 
+ * \return ERR_BUSY         : Operation is ongoing
+ * \return ERR_RF_COLLISION : Collision detected 
+ * \return ERR_CRC          : CRC error detected
+ * \return ERR_PROTO        : Protocol error detected
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */ 
+ReturnCode rfalNfcvPollerGetInventoryStatus( void );
+
+
 /*! 
  *****************************************************************************
  * \brief  NFC-V Poller Full Collision Resolution
@@ -327,6 +419,12 @@ ReturnCode rfalNfcvPollerInventory( rfalNfcvNumSlots nSlots, uint8_t maskLen, co
  * When compMode is set to ISO the function immediately goes to 16 slots improving
  * chances to detect more than only one strong card.
  *
+ * Collisions are resolved depth first, so no collision is ever dropped 
+ * regardless of the number of devices in the field. The number of devices
+ * behind each collision is estimated from the empty slots of the round that
+ * found it: dense collisions are resolved with another 16 slots round while
+ * sparse ones are split in two with 1 slot INVENTORY_REQ (mask + 1 bit).
+ *
  * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
  * \return ERR_PARAM        : Invalid parameters
  * \return ERR_IO           : Generic internal error
@@ -335,6 +433,48 @@ ReturnCode rfalNfcvPollerInventory( rfalNfcvNumSlots nSlots, uint8_t maskLen, co
  */
 ReturnCode rfalNfcvPollerCollisionResolution( rfalComplianceMode compMode, uint8_t devLimit, rfalNfcvListenDevice *nfcvDevList, uint8_t *devCnt );
 
+
+/*! 
+ *****************************************************************************
+ * \brief  NFC-V Poller Start Full Collision Resolution
+ *  
+ * Starts the Collision resolution of rfalNfcvPollerCollisionResolution()
+ * and returns immediately. rfalWorker() must be executed and the result 
+ * retrieved with rfalNfcvPollerGetCollisionResolutionStatus()
+ * 
+ * The FDTV,INVENT_NORES between slots is awaited on a timer instead of 
+ * blocking. The given nfcvDevList and devCnt must remain valid until the
+ * operation completes
+ *
+ * \param[in]  compMode    : compliance mode to be performed
+ * \param[in]  devLimit    : device limit value, and size nfcvDevList
+ * \param[out] nfcvDevList : NFC-V listener devices list
+ * \param[out] devCnt      : Devices found counter
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+ * \return ERR_PARAM        : Invalid parameters
+ * \return ERR_NONE         : No error, Collision Resolution started
+ *****************************************************************************
+ */
+ReturnCode rfalNfcvPollerStartCollisionResolution( rfalComplianceMode compMode, uint8_t devLimit, rfalNfcvListenDevice *nfcvDevList, uint8_t *devCnt );
+
+
+/*! 
+ *****************************************************************************
+ * \brief  NFC-V Poller Get Full Collision Resolution Status
+ *  
+ * Returns the status of the Collision resolution started by
+ * rfalNfcvPollerStartCollisionResolution()
+ *
+ * \return ERR_BUSY         : Operation is ongoing
+ * \return ERR_WRONG_STATE  : No Collision Resolution has been started
+ * \return ERR_RF_COLLISION : devLimit is 0 and a collision was detected
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode rfalNfcvPollerGetCollisionResolutionStatus( void );
+
+
 /*!
  *****************************************************************************
  * \brief  NFC-V Poller Full Collision Resolution With Sleep
@@ -356,6 +496,45 @@ ReturnCode rfalNfcvPollerCollisionResolution( rfalComplianceMode compMode, uint8
  */
 ReturnCode rfalNfcvPollerSleepCollisionResolution( uint8_t devLimit, rfalNfcvListenDevice *nfcvDevList, uint8_t *devCnt );
 
+
+/*! 
+ *****************************************************************************
+ * \brief  NFC-V Poller Start Full Collision Resolution With Sleep
+ *  
+ * Starts the Collision resolution of rfalNfcvPollerSleepCollisionResolution()
+ * and returns immediately. rfalWorker() must be executed and the result 
+ * retrieved with rfalNfcvPollerGetSleepCollisionResolutionStatus()
+ * 
+ * Each device identified is put to Quiet (SLPV_REQ) as soon as the 
+ * inventory round in which it replied is over, so a later call only 
+ * reports the devices not yet identified (e.g. once devLimit is reached)
+ *
+ * \param[in]  devLimit     : device limit value, and size nfcvDevList
+ * \param[out] nfcvDevList  : NFC-V listener devices list
+ * \param[out] devCnt       : Devices found counter
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+ * \return ERR_PARAM        : Invalid parameters
+ * \return ERR_NONE         : No error, Collision Resolution started
+ *****************************************************************************
+ */
+ReturnCode rfalNfcvPollerStartSleepCollisionResolution( uint8_t devLimit, rfalNfcvListenDevice *nfcvDevList, uint8_t *devCnt );
+
+
+/*! 
+ *****************************************************************************
+ * \brief  NFC-V Poller Get Full Collision Resolution With Sleep Status
+ *  
+ * Returns the status of the Collision resolution started by
+ * rfalNfcvPollerStartSleepCollisionResolution()
+ *
+ * \return ERR_BUSY         : Operation is ongoing
+ * \return ERR_WRONG_STATE  : No Collision Resolution has been started
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode rfalNfcvPollerGetSleepCollisionResolutionStatus( void );
+
 /*! 
  *****************************************************************************
  * \brief  NFC-V Poller Sleep
@@ -375,6 +554,40 @@ ReturnCode rfalNfcvPollerSleepCollisionResolution( uint8_t devLimit, rfalNfcvLis
  */
 ReturnCode rfalNfcvPollerSleep( uint8_t flags, const uint8_t* uid );
 
+
+/*! 
+ *****************************************************************************
+ * \brief  NFC-V Poller Start Sleep
+ *  
+ * Starts the SLPV_REQ of rfalNfcvPollerSleep() and returns immediately.
+ * rfalWorker() must be executed and the result retrieved with
+ * rfalNfcvPollerGetSleepStatus()
+ * 
+ * \param[in]  flags        : Flags to be used: Sub-carrier; Data_rate; Option
+ *                            for NFC-Forum use: RFAL_NFCV_REQ_FLAG_DEFAULT
+ * \param[in]  uid          : UID of the device to be put to Sleep
+ *  
+ * \return ERR_WRONG_STATE  : RFAL not initialized or incorrect mode
+ * \return ERR_PARAM        : Invalid parameters
+ * \return ERR_NONE         : No error, SLPV_REQ started
+ *****************************************************************************
+ */
+ReturnCode rfalNfcvPollerStartSleep( uint8_t flags, const uint8_t* uid );
+
+
+/*! 
+ *****************************************************************************
+ * \brief  NFC-V Poller Get Sleep Status
+ *  
+ * Returns the status of the SLPV_REQ started by rfalNfcvPollerStartSleep()
+ * 
+ * \return ERR_BUSY         : Operation is ongoing
+ * \return ERR_NONE         : No error, SLPV_REQ acknowledged (no response)
+ * \return Others           : As defined on rfalNfcvPollerSleep()
+ *****************************************************************************
+ */
+ReturnCode rfalNfcvPollerGetSleepStatus( void );
+
 /*! 
  *****************************************************************************
  * \brief  NFC-V Poller Select
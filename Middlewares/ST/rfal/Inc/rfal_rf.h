@@ -1168,6 +1168,49 @@ void rfalWorker( void );
 ReturnCode rfalISO14443ATransceiveShortFrame( rfal14443AShortFrameCmd txCmd, uint8_t* rxBuf, uint8_t rxBufLen, uint16_t* rxRcvdLen, uint32_t fwt );
 
 
+/*! 
+ *****************************************************************************
+ *  \brief Start an ISO14443A ShortFrame Transceive
+ *  
+ * Non-blocking variant of rfalISO14443ATransceiveShortFrame(). It sends the
+ * REQA/WUPA and configures the reception. Once started the transceive is 
+ * progressed by rfalWorker() and its status retrieved with 
+ * rfalISO14443AGetTransceiveShortFrameStatus()
+ * 
+ * \warning The GT is not handled in a non-blocking way. The caller should 
+ *          only start this method once rfalIsGTExpired() is true
+ *
+ * \param[in]  txCmd    : type of short frame to be sent REQA or WUPA                          
+ * \param[out] rxBuf    : buffer to place the response
+ * \param[in]  rxBufLen : length of rxBuf
+ * \param[out] rxRcvdLen: received length
+ * \param[in]  fwt      : Frame Waiting Time in 1/fc
+ * 
+ * \return ERR_WRONG_STATE : RFAL not initialized or mode not set
+ * \return ERR_PARAM       : Invalid parameter
+ * \return ERR_IO          : Error during transmission
+ * \return ERR_NONE        : Transceive started
+ *****************************************************************************
+ */
+ReturnCode rfalISO14443AStartTransceiveShortFrame( rfal14443AShortFrameCmd txCmd, uint8_t* rxBuf, uint8_t rxBufLen, uint16_t* rxRcvdLen, uint32_t fwt );
+
+
+/*! 
+ *****************************************************************************
+ *  \brief Get ISO14443A ShortFrame Transceive status
+ *  
+ * Returns the status of the transceive started with 
+ * rfalISO14443AStartTransceiveShortFrame()
+ * 
+ * \return ERR_BUSY      : Transceive ongoing
+ * \return ERR_NONE      : there is response
+ * \return ERR_TIMEOUT   : there is no response
+ * \return ERR_COLLISION : collision has occurred
+ *****************************************************************************
+ */
+ReturnCode rfalISO14443AGetTransceiveShortFrameStatus( void );
+
+
 /*!
  *****************************************************************************
  * \brief Sends an ISO14443A Anticollision Frame 
@@ -1191,6 +1234,42 @@ ReturnCode rfalISO14443ATransceiveShortFrame( rfal14443AShortFrameCmd txCmd, uin
 ReturnCode rfalISO14443ATransceiveAnticollisionFrame( uint8_t *buf, uint8_t *bytesToSend, uint8_t *bitsToSend, uint16_t *rxLength, uint32_t fwt );
 
 
+/*!
+ *****************************************************************************
+ * \brief Start an ISO14443A Anticollision Frame 
+ * 
+ * Non-blocking variant of rfalISO14443ATransceiveAnticollisionFrame().
+ * The given buffer and byte/bit references must remain valid until 
+ * rfalISO14443AGetTransceiveAnticollisionFrameStatus() reports completion,
+ * where they are updated the same way as on the blocking method
+ * 
+ * \param[in]   buf        : reference to ANTICOLLISION command (with known UID if any) to be sent (also out param)
+ * \param[in]   bytesToSend: reference number of full bytes to be sent (including CMD byte and SEL_PAR)
+ * \param[in]   bitsToSend : reference to number of bits (0-7) to be sent; and received (also out param)
+ * \param[out]  rxLength   : reference to the return the received length
+ * \param[in]   fwt        : Frame Waiting Time in 1/fc
+ * 
+ * \return ERR_NONE if the frame has been started
+ *****************************************************************************
+ */
+ReturnCode rfalISO14443AStartTransceiveAnticollisionFrame( uint8_t *buf, uint8_t *bytesToSend, uint8_t *bitsToSend, uint16_t *rxLength, uint32_t fwt );
+
+
+/*!
+ *****************************************************************************
+ * \brief Get ISO14443A Anticollision Frame status
+ * 
+ * Returns the status of the frame started with 
+ * rfalISO14443AStartTransceiveAnticollisionFrame()
+ * 
+ * \return ERR_BUSY         : Transceive ongoing
+ * \return ERR_RF_COLLISION : Collision detected, bytesToSend/bitsToSend updated
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode rfalISO14443AGetTransceiveAnticollisionFrameStatus( void );
+
+
 /*****************************************************************************
  *  FeliCa                                                                   *  
  *****************************************************************************/
@@ -1218,6 +1297,62 @@ ReturnCode rfalISO14443ATransceiveAnticollisionFrame( uint8_t *buf, uint8_t *byt
 ReturnCode rfalFeliCaPoll( rfalFeliCaPollSlots slots, uint16_t sysCode, uint8_t reqCode, rfalFeliCaPollRes* pollResList, uint8_t pollResListSize, uint8_t *devicesDetected, uint8_t *collisionsDetected );
 
 
+/*!
+ *****************************************************************************
+ * \brief Start FeliCa Poll 
+ * 
+ * Non-blocking variant of rfalFeliCaPoll(). It sends the Poll Request and
+ * each Poll Response is collected by rfalGetFeliCaPollStatus() as soon as
+ * it appears, so that the caller is not held for all the slots duration.
+ * The output parameters are only assigned once the Poll has completed
+ * 
+ * \param[in]   slots             : number of slots for the Poll Request
+ * \param[in]   sysCode           : system code (SC) for the Poll Request  
+ * \param[in]   reqCode           : request code (RC) for the Poll Request
+ * \param[out]  pollResList       : list of all responses
+ * \param[in]   pollResListSize   : number of responses that can be placed in pollResList 
+ * \param[out]  devicesDetected   : number of cards found
+ * \param[out]  collisionsDetected: number of collisions detected
+ * 
+ * \return ERR_WRONG_STATE : RFAL not initialized or mode not set
+ * \return ERR_NONE        : Poll started
+ *****************************************************************************
+ */
+ReturnCode rfalStartFeliCaPoll( rfalFeliCaPollSlots slots, uint16_t sysCode, uint8_t reqCode, rfalFeliCaPollRes* pollResList, uint8_t pollResListSize, uint8_t *devicesDetected, uint8_t *collisionsDetected );
+
+
+/*!
+ *****************************************************************************
+ * \brief Get FeliCa Poll status
+ * 
+ * Progresses the FeliCa Poll started with rfalStartFeliCaPoll() and returns 
+ * its status
+ * 
+ * \return ERR_BUSY    : Poll ongoing, waiting for further slots
+ * \return ERR_NONE    : there is no error
+ * \return ERR_TIMEOUT : there is no response
+ *****************************************************************************
+ */
+ReturnCode rfalGetFeliCaPollStatus( void );
+
+
+/*!
+ *****************************************************************************
+ * \brief Get FeliCa Poll RSSI
+ * 
+ * Gets the RSSI of one of the responses received by the last FeliCa Poll,
+ * taken as it was received (see rfalGetTransceiveRSSI())
+ * 
+ * \param[in]   resIdx : response index on pollResList
+ * \param[out]  rssi   : RSSI value in mV, 0 if not available
+ * 
+ * \return ERR_PARAM : No such response
+ * \return ERR_NONE  : No error
+ *****************************************************************************
+ */
+ReturnCode rfalGetFeliCaPollRSSI( uint8_t resIdx, uint16_t *rssi );
+
+
 /*****************************************************************************
  *  ISO15693                                                                 *  
  *****************************************************************************/
@@ -1244,6 +1379,45 @@ ReturnCode rfalFeliCaPoll( rfalFeliCaPollSlots slots, uint16_t sysCode, uint8_t
 ReturnCode rfalISO15693TransceiveAnticollisionFrame( uint8_t *txBuf, uint8_t txBufLen, uint8_t *rxBuf, uint8_t rxBufLen, uint16_t *actLen );
 
 
+/*!
+ *****************************************************************************
+ * \brief Start an ISO15693 Anticollision Frame 
+ * 
+ * Non-blocking variant of rfalISO15693TransceiveAnticollisionFrame().
+ * The given buffers must remain valid until 
+ * rfalISO15693GetTransceiveAnticollisionFrameStatus() reports completion
+ *
+ * \warning rxBuf must be able to contain the payload and CRC
+ * 
+ * \param[in]  txBuf        : Buffer where outgoing message is located
+ * \param[in]  txBufLen     : Length of the outgoing message in bytes
+ * \param[out] rxBuf        : Buffer where incoming message will be placed
+ * \param[in]  rxBufLen     : Maximum length of the incoming message in bytes
+ * \param[out] actLen       : Actual received length in bits
+ * 
+ * \return  ERR_NONE        : Transceive started
+ * \return  ERR_WRONG_STATE : RFAL not initialized or mode not set
+ *****************************************************************************
+ */
+ReturnCode rfalISO15693StartTransceiveAnticollisionFrame( uint8_t *txBuf, uint8_t txBufLen, uint8_t *rxBuf, uint8_t rxBufLen, uint16_t *actLen );
+
+
+/*!
+ *****************************************************************************
+ * \brief Get ISO15693 Anticollision Frame status
+ * 
+ * Returns the status of the frame/EOF started with 
+ * rfalISO15693StartTransceiveAnticollisionFrame() or
+ * rfalISO15693StartTransceiveEOFAnticollision()
+ * 
+ * \return  ERR_BUSY        : Transceive ongoing
+ * \return  ERR_NONE        : Transceive done with no error
+ * \return  ERR_XXXX        : Error occurred
+ *****************************************************************************
+ */
+ReturnCode rfalISO15693GetTransceiveAnticollisionFrameStatus( void );
+
+
 /*!
  *****************************************************************************
  * \brief Sends an ISO15693 Anticollision EOF
@@ -1264,6 +1438,24 @@ ReturnCode rfalISO15693TransceiveAnticollisionFrame( uint8_t *txBuf, uint8_t txB
 ReturnCode rfalISO15693TransceiveEOFAnticollision( uint8_t *rxBuf, uint8_t rxBufLen, uint16_t *actLen );
 
 
+/*!
+ *****************************************************************************
+ * \brief Start an ISO15693 Anticollision EOF
+ * 
+ * Non-blocking variant of rfalISO15693TransceiveEOFAnticollision().
+ * Its status is retrieved with rfalISO15693GetTransceiveAnticollisionFrameStatus()
+ * 
+ * \param[out] rxBuf        : Buffer where incoming message will be placed
+ * \param[in] rxBufLen      : Maximum length of the incoming message in bytes
+ * \param[out] actLen       : Actual received length in bits
+ * 
+ * \return  ERR_NONE        : Transceive started
+ * \return  ERR_WRONG_STATE : RFAL not initialized or mode not set
+ *****************************************************************************
+ */
+ReturnCode rfalISO15693StartTransceiveEOFAnticollision( uint8_t *rxBuf, uint8_t rxBufLen, uint16_t *actLen );
+
+
 /*!
  *****************************************************************************
  * \brief Sends an ISO15693 EOF
@@ -0,0 +1,285 @@
+
+/******************************************************************************
+  * \attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2019 STMicroelectronics</center></h2>
+  *
+  * Licensed under ST MYLIBERTY SOFTWARE LICENSE AGREEMENT (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        www.st.com/myliberty
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied,
+  * AND SPECIFICALLY DISCLAIMING THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+******************************************************************************/
+
+/*
+ *      PROJECT:   ST25R391x firmware
+ *      Revision:
+ *      LANGUAGE:  ISO C99
+ */
+
+/*! \file rfal_snep.h
+ *
+ *  \author
+ *
+ *  \brief Implementation of the NFC Forum Simple NDEF Exchange Protocol (SNEP)
+ *
+ *  SNEP client (PUT) and default server (PUT) on top of an LLCP data link
+ *  connection. Requests longer than the remote MIU are fragmented: the
+ *  first fragment is sent, and on the server's Continue the remaining
+ *  fragments are streamed within the LLCP receive window.
+ *  GET requests are answered with Not Implemented.
+ *
+ *  The state machines are advanced by their GetStatus methods, which are
+ *  to be called after each LLCP exchange.
+ *
+ *  This implementation was based on the following specs:
+ *    - NFC Forum Simple NDEF Exchange Protocol 1.0  2011-08-31
+ *
+ * \addtogroup RFAL
+ * @{
+ *
+ * \addtogroup RFAL-AL
+ * \brief RFAL Abstraction Layer
+ * @{
+ *
+ * \addtogroup SNEP
+ * \brief RFAL SNEP Module
+ * @{
+ *
+ */
+
+
+#ifndef RFAL_SNEP_H
+#define RFAL_SNEP_H
+
+/*
+ ******************************************************************************
+ * INCLUDES
+ ******************************************************************************
+ */
+#include "platform.h"
+#include "st_errno.h"
+#include "rfal_llcp.h"
+
+/*
+ ******************************************************************************
+ * GLOBAL DEFINES
+ ******************************************************************************
+ */
+
+#ifndef RFAL_FEATURE_SNEP_NDEF_MAX_LEN
+    #define RFAL_FEATURE_SNEP_NDEF_MAX_LEN  RFAL_FEATURE_LLCP_MIU               /*!< Largest NDEF message sent or received over SNEP            */
+#endif
+
+#define RFAL_SNEP_VERSION                  0x10U                                /*!< SNEP version 1.0  (major | minor)                          */
+#define RFAL_SNEP_HEADER_LEN               6U                                   /*!< SNEP header: Version, Request/Response, Length (4 bytes)   */
+#define RFAL_SNEP_ACCEPT_LEN_LEN           4U                                   /*!< Acceptable Length field of a Get request  SNEP 1.0  3.1.2  */
+#define RFAL_SNEP_SN                       "urn:nfc:sn:snep"                    /*!< SNEP default server Service Name                           */
+
+#define RFAL_SNEP_REQ_CONTINUE             0x00U                                /*!< Request:  Continue                                         */
+#define RFAL_SNEP_REQ_GET                  0x01U                                /*!< Request:  Get                                              */
+#define RFAL_SNEP_REQ_PUT                  0x02U                                /*!< Request:  Put                                              */
+#define RFAL_SNEP_REQ_REJECT               0x7FU                                /*!< Request:  Reject                                           */
+#define RFAL_SNEP_RSP_CONTINUE             0x80U                                /*!< Response: Continue                                         */
+#define RFAL_SNEP_RSP_SUCCESS              0x81U                                /*!< Response: Success                                          */
+#define RFAL_SNEP_RSP_NOT_FOUND            0xC0U                                /*!< Response: Not Found                                        */
+#define RFAL_SNEP_RSP_EXCESS_DATA          0xC1U                                /*!< Response: Excess Data                                      */
+#define RFAL_SNEP_RSP_BAD_REQUEST          0xC2U                                /*!< Response: Bad Request                                      */
+#define RFAL_SNEP_RSP_NOT_IMPLEMENTED      0xE0U                                /*!< Response: Not Implemented                                  */
+#define RFAL_SNEP_RSP_UNSUPPORTED_VERSION  0xE1U                                /*!< Response: Unsupported Version                              */
+#define RFAL_SNEP_RSP_REJECT               0xFFU                                /*!< Response: Reject                                           */
+
+
+/*
+******************************************************************************
+* GLOBAL TYPES
+******************************************************************************
+*/
+
+/*! SNEP message buffer: header space followed by the NDEF message                             *
+ *  A Get request takes the whole prologue (header + Acceptable Length), every other message   *
+ *  (Put request, responses) places its header at the end of the prologue                      */
+typedef struct
+{
+    uint8_t  prologue[RFAL_SNEP_HEADER_LEN + RFAL_SNEP_ACCEPT_LEN_LEN]; /*!< Prologue space for the SNEP header          */
+    uint8_t  ndef[RFAL_FEATURE_SNEP_NDEF_MAX_LEN];                      /*!< NDEF message                                */
+} rfalSnepBufFormat;
+
+
+/*! SNEP states */
+typedef enum
+{
+    RFAL_SNEP_ST_IDLE          = 0,              /*!< No request ongoing                                   */
+    RFAL_SNEP_ST_CONNECT       = 1,              /*!< Client: waiting for the connection                   */
+    RFAL_SNEP_ST_WAIT_CONTINUE = 2,              /*!< Client: first fragment sent, waiting for Continue    */
+    RFAL_SNEP_ST_WAIT_RESPONSE = 3,              /*!< Client: request sent, waiting for the response       */
+    RFAL_SNEP_ST_SERVE         = 4               /*!< Server: receiving requests                           */
+} rfalSnepState;
+
+
+/*! SNEP client or server */
+typedef struct
+{
+    rfalLlcpConn       conn;                     /*!< LLCP data link connection                            */
+    rfalSnepState      state;                    /*!< State                                                */
+    rfalSnepBufFormat  *buf;                     /*!< Client: request/response  Server: request reassembly */
+    uint16_t           msgLen;                   /*!< Client: request  Server: Get response, with header   */
+    bool               isContinueSent;           /*!< Continue sent for the message being received         */
+    uint16_t           *rspLen;                  /*!< Client: Get response length (NULL: Put)              */
+    const uint8_t      *getRsp;                  /*!< Server: NDEF message answered to Get (NULL: none)    */
+    uint16_t           getRspLen;                /*!< Server: Get response NDEF message length             */
+    uint8_t            hdr[RFAL_SNEP_HEADER_LEN]; /*!< Header only message sent (responses, Continue)      */
+} rfalSnep;
+
+
+/*
+******************************************************************************
+* GLOBAL FUNCTION PROTOTYPES
+******************************************************************************
+*/
+
+
+/*!
+ *****************************************************************************
+ * \brief  SNEP Client Put
+ *
+ * Connects to the peer's default SNEP server (by name) and pushes the
+ * NDEF message placed on buf->ndef. The connection is released once the
+ * response is received
+ *
+ * \param[out]    snep    : SNEP client
+ * \param[in,out] link    : LLCP link
+ * \param[in]     buf     : buffer holding the NDEF message, kept until completion
+ * \param[in]     ndefLen : NDEF message length
+ *
+ * \return ERR_PARAM : Invalid parameters
+ * \return ERR_NOMEM : No free connection on the link
+ * \return ERR_NONE  : Put scheduled
+ *****************************************************************************
+ */
+ReturnCode rfalSnepClientPut( rfalSnep *snep, rfalLlcpLink *link, rfalSnepBufFormat *buf, uint16_t ndefLen );
+
+
+/*!
+ *****************************************************************************
+ * \brief  SNEP Client Get
+ *
+ * Connects to the peer's default SNEP server (by name) and requests the
+ * NDEF message matching the request placed on buf->ndef. The response
+ * NDEF message is received on buf->ndef (over the request), up to
+ * RFAL_FEATURE_SNEP_NDEF_MAX_LEN which is given as Acceptable Length.
+ * SNEP 1.0  6.1  A default server may answer Not Implemented
+ *
+ * \param[out]    snep   : SNEP client
+ * \param[in,out] link   : LLCP link
+ * \param[in,out] buf    : buffer holding the request, and the response once completed
+ * \param[in]     reqLen : request NDEF message length
+ * \param[out]    rspLen : response NDEF message length, set on completion
+ *
+ * \return ERR_PARAM : Invalid parameters
+ * \return ERR_NOMEM : No free connection on the link
+ * \return ERR_NONE  : Get scheduled
+ *****************************************************************************
+ */
+ReturnCode rfalSnepClientGet( rfalSnep *snep, rfalLlcpLink *link, rfalSnepBufFormat *buf, uint16_t reqLen, uint16_t *rspLen );
+
+
+/*!
+ *****************************************************************************
+ * \brief  SNEP Client Get Status
+ *
+ * Advances the client after an LLCP exchange
+ *
+ * \param[in,out] snep : SNEP client
+ *
+ * \return ERR_BUSY        : Put or Get ongoing
+ * \return ERR_REQUEST     : Server not available or the request was refused
+ * \return ERR_PROTO       : Invalid response or connection lost
+ * \return ERR_WRONG_STATE : No Put or Get ongoing
+ * \return ERR_NONE        : NDEF message delivered or received (Success)
+ *****************************************************************************
+ */
+ReturnCode rfalSnepClientGetStatus( rfalSnep *snep );
+
+
+/*!
+ *****************************************************************************
+ * \brief  SNEP Server Start
+ *
+ * Binds a default SNEP server to SAP 4 and to the SNEP Service Name
+ * Shall be called before rfalLlcpGetGeneralBytes() to be announced on WKS
+ *
+ * \param[out]    snep : SNEP server
+ * \param[in,out] link : LLCP link
+ * \param[in]     buf  : buffer where the requests are received
+ *
+ * \return ERR_PARAM : Invalid parameters
+ * \return ERR_NOMEM : No free connection on the link
+ * \return ERR_NONE  : Server listening
+ *****************************************************************************
+ */
+ReturnCode rfalSnepServerStart( rfalSnep *snep, rfalLlcpLink *link, rfalSnepBufFormat *buf );
+
+
+/*!
+ *****************************************************************************
+ * \brief  SNEP Server Set Get Response
+ *
+ * Sets the NDEF message answered to every Get request, whatever the
+ * request message, until the server is restarted.
+ * Without it Get is answered Not Implemented, as
+ * SNEP 1.0  6.1  expects from a default server; only set it for peers
+ * known to Get from it.
+ * The message is copied to the server buffer when answered, so it shall
+ * not be placed on it
+ *
+ * \param[in,out] snep    : SNEP server
+ * \param[in]     ndef    : NDEF message, kept by the caller (NULL: Not Implemented)
+ * \param[in]     ndefLen : NDEF message length
+ *
+ * \return ERR_PARAM : Message larger than the server buffer
+ * \return ERR_NONE  : Get response set
+ *****************************************************************************
+ */
+ReturnCode rfalSnepServerSetGetResponse( rfalSnep *snep, const uint8_t *ndef, uint16_t ndefLen );
+
+
+/*!
+ *****************************************************************************
+ * \brief  SNEP Server Get Status
+ *
+ * Advances the server after an LLCP exchange: asks for the remaining
+ * fragments, answers the requests and reports received NDEF messages.
+ * Get responses larger than the client MIU are sent once the client
+ * asks to Continue.
+ * The message on buf->ndef is valid until the next LLCP exchange
+ *
+ * \param[in,out] snep    : SNEP server
+ * \param[out]    ndefLen : length of the NDEF message received on buf->ndef
+ *
+ * \return ERR_BUSY        : No complete NDEF message received
+ * \return ERR_WRONG_STATE : Server not started
+ * \return ERR_NONE        : NDEF message received by a Put
+ *****************************************************************************
+ */
+ReturnCode rfalSnepServerGetStatus( rfalSnep *snep, uint16_t *ndefLen );
+
+
+#endif /* RFAL_SNEP_H */
+
+/**
+  * @}
+  *
+  * @}
+  *
+  * @}
+  */
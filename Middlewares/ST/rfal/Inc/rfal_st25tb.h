@@ -94,6 +94,7 @@ typedef struct
     uint8_t           chipID;                              /*!< Device's session Chip ID */
     rfalSt25tbUID     UID;                                 /*!< Device's UID             */
     bool              isDeselected;                        /*!< Device deselect flag     */
+    uint16_t          rssi;                                /*!< RSSI of the Get UID response (mV), 0 if not available */
 }rfalSt25tbListenDevice;
 
 
@@ -138,6 +139,41 @@ ReturnCode rfalSt25tbPollerInitialize( void );
 ReturnCode rfalSt25tbPollerCheckPresence( uint8_t *chipId );
 
 
+/*! 
+ *****************************************************************************
+ * \brief  ST25TB Poller Start Check Presence
+ *  
+ * This method starts rfalSt25tbPollerCheckPresence() and returns 
+ * immediately. rfalWorker() must be executed and the result retrieved 
+ * with rfalSt25tbPollerGetCheckPresenceStatus()
+ * 
+ * \param[out] chipId : if successfully retrieved, the device's chip ID
+ * 
+ * \return ERR_WRONG_STATE  : RFAL not initialized or incorrect mode
+ * \return ERR_PARAM        : Invalid parameters
+ * \return ERR_NONE         : No error, Check Presence started
+ *****************************************************************************
+ */
+ReturnCode rfalSt25tbPollerStartCheckPresence( uint8_t *chipId );
+
+
+/*! 
+ *****************************************************************************
+ * \brief  ST25TB Poller Get Check Presence Status
+ *  
+ * Returns the status of the Check Presence started by 
+ * rfalSt25tbPollerStartCheckPresence()
+ * 
+ * \return ERR_BUSY         : Operation is ongoing
+ * \return ERR_WRONG_STATE  : No Check Presence ongoing
+ * \return ERR_TIMEOUT      : Timeout error, no listener device detected
+ * \return ERR_PROTO        : Protocol error detected
+ * \return ERR_NONE         : No error, one or more devices detected
+ *****************************************************************************
+ */
+ReturnCode rfalSt25tbPollerGetCheckPresenceStatus( void );
+
+
 /*! 
  *****************************************************************************
  * \brief  ST25TB Poller Collision Resolution
@@ -162,6 +198,45 @@ ReturnCode rfalSt25tbPollerCheckPresence( uint8_t *chipId );
  */
 ReturnCode rfalSt25tbPollerCollisionResolution( uint8_t devLimit, rfalSt25tbListenDevice *st25tbDevList, uint8_t *devCnt );
 
+
+/*! 
+ *****************************************************************************
+ * \brief  ST25TB Poller Start Collision Resolution
+ *  
+ * This method starts rfalSt25tbPollerCollisionResolution() and returns 
+ * immediately. rfalWorker() must be executed and the result retrieved 
+ * with rfalSt25tbPollerGetCollisionResolutionStatus()
+ * 
+ * The given st25tbDevList and devCnt must remain valid until the operation
+ * completes
+ *   
+ * \param[in]  devLimit      : device limit value, and size st25tbDevList
+ * \param[out] st25tbDevList : ST35TB listener device info
+ * \param[out] devCnt        : Devices found counter
+ * 
+ * \return ERR_WRONG_STATE  : RFAL not initialized or incorrect mode
+ * \return ERR_PARAM        : Invalid parameters
+ * \return ERR_NONE         : No error, Collision Resolution started
+ *****************************************************************************
+ */
+ReturnCode rfalSt25tbPollerStartCollisionResolution( uint8_t devLimit, rfalSt25tbListenDevice *st25tbDevList, uint8_t *devCnt );
+
+
+/*! 
+ *****************************************************************************
+ * \brief  ST25TB Poller Get Collision Resolution Status
+ *  
+ * Returns the status of the Collision Resolution started by 
+ * rfalSt25tbPollerStartCollisionResolution()
+ * 
+ * \return ERR_BUSY         : Operation is ongoing
+ * \return ERR_WRONG_STATE  : No Collision Resolution ongoing
+ * \return ERR_IO           : Generic internal error
+ * \return ERR_NONE         : No error, devCnt devices found
+ *****************************************************************************
+ */
+ReturnCode rfalSt25tbPollerGetCollisionResolutionStatus( void );
+
 /*! 
  *****************************************************************************
  * \brief  ST25TB Poller Initiate
@@ -247,6 +322,39 @@ ReturnCode rfalSt25tbPollerSlotMarker( uint8_t slotNum, uint8_t *chipIdRes );
 ReturnCode rfalSt25tbPollerSelect( uint8_t chipId );
 
 
+/*! 
+ *****************************************************************************
+ * \brief  ST25TB Poller Start Select
+ *  
+ * This method starts rfalSt25tbPollerSelect() and returns immediately.
+ * rfalWorker() must be executed and the result retrieved with 
+ * rfalSt25tbPollerGetSelectStatus()
+ *   
+ * \param[in]  chipId       : chip ID of the device to be selected
+ * 
+ * \return ERR_WRONG_STATE  : RFAL not initialized or incorrect mode
+ * \return ERR_NONE         : No error, Select started
+ *****************************************************************************
+ */
+ReturnCode rfalSt25tbPollerStartSelect( uint8_t chipId );
+
+
+/*! 
+ *****************************************************************************
+ * \brief  ST25TB Poller Get Select Status
+ *  
+ * Returns the status of the Select started by rfalSt25tbPollerStartSelect()
+ * 
+ * \return ERR_BUSY         : Operation is ongoing
+ * \return ERR_WRONG_STATE  : No Select ongoing
+ * \return ERR_TIMEOUT      : Timeout error, no listener device detected
+ * \return ERR_PROTO        : Protocol error detected
+ * \return ERR_NONE         : No error, device selected
+ *****************************************************************************
+ */
+ReturnCode rfalSt25tbPollerGetSelectStatus( void );
+
+
 /*! 
  *****************************************************************************
  * \brief  ST25TB Get UID
@@ -268,6 +376,41 @@ ReturnCode rfalSt25tbPollerSelect( uint8_t chipId );
 ReturnCode rfalSt25tbPollerGetUID( rfalSt25tbUID *UID );
 
 
+/*! 
+ *****************************************************************************
+ * \brief  ST25TB Poller Start Get UID
+ *  
+ * This method starts rfalSt25tbPollerGetUID() and returns immediately.
+ * rfalWorker() must be executed and the result retrieved with 
+ * rfalSt25tbPollerGetGetUIDStatus()
+ *
+ * \param[out]  UID      : UID of the found device, must remain valid 
+ *                         until the operation completes
+ * 
+ * \return ERR_WRONG_STATE  : RFAL not initialized or incorrect mode
+ * \return ERR_PARAM        : Invalid parameters
+ * \return ERR_NONE         : No error, Get UID started
+ *****************************************************************************
+ */
+ReturnCode rfalSt25tbPollerStartGetUID( rfalSt25tbUID *UID );
+
+
+/*! 
+ *****************************************************************************
+ * \brief  ST25TB Poller Get Get UID Status
+ *  
+ * Returns the status of the Get UID started by rfalSt25tbPollerStartGetUID()
+ * 
+ * \return ERR_BUSY         : Operation is ongoing
+ * \return ERR_WRONG_STATE  : No Get UID ongoing
+ * \return ERR_TIMEOUT      : Timeout error, no listener device detected
+ * \return ERR_PROTO        : Protocol error detected
+ * \return ERR_NONE         : No error, UID retrieved
+ *****************************************************************************
+ */
+ReturnCode rfalSt25tbPollerGetGetUIDStatus( void );
+
+
 /*! 
  *****************************************************************************
  * \brief  ST25TB Poller Read Block
@@ -288,6 +431,67 @@ ReturnCode rfalSt25tbPollerGetUID( rfalSt25tbUID *UID );
 ReturnCode rfalSt25tbPollerReadBlock( uint8_t blockAddress, rfalSt25tbBlock *blockData  );
 
 
+/*! 
+ *****************************************************************************
+ * \brief  ST25TB Poller Read Multiple Blocks
+ *  
+ * This method reads a range of consecutive blocks of the ST25TB. 
+ * ST25TB has no multiple block command, each Read Block is issued as soon 
+ * as the previous response is received so that only t2 separates them
+ * 
+ * \param[in]  firstBlock   : address of the first block to be read
+ * \param[in]  numOfBlocks  : number of blocks to be read
+ * \param[out] blockData    : location to place the data read, numOfBlocks long
+ * 
+ * \return ERR_WRONG_STATE  : RFAL not initialized or incorrect mode
+ * \return ERR_PARAM        : Invalid parameters
+ * \return ERR_IO           : Generic internal error
+ * \return ERR_TIMEOUT      : Timeout error, no listener device detected
+ * \return ERR_PROTO        : Protocol error detected
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode rfalSt25tbPollerReadMultipleBlocks( uint8_t firstBlock, uint8_t numOfBlocks, rfalSt25tbBlock *blockData );
+
+
+/*! 
+ *****************************************************************************
+ * \brief  ST25TB Poller Start Read Multiple Blocks
+ *  
+ * This method starts rfalSt25tbPollerReadMultipleBlocks() and returns 
+ * immediately. rfalWorker() must be executed and the result retrieved 
+ * with rfalSt25tbPollerGetReadMultipleBlocksStatus()
+ * 
+ * The given blockData must remain valid until the operation completes
+ * 
+ * \param[in]  firstBlock   : address of the first block to be read
+ * \param[in]  numOfBlocks  : number of blocks to be read
+ * \param[out] blockData    : location to place the data read, numOfBlocks long
+ * 
+ * \return ERR_WRONG_STATE  : RFAL not initialized or incorrect mode
+ * \return ERR_PARAM        : Invalid parameters
+ * \return ERR_NONE         : No error, Read Multiple Blocks started
+ *****************************************************************************
+ */
+ReturnCode rfalSt25tbPollerStartReadMultipleBlocks( uint8_t firstBlock, uint8_t numOfBlocks, rfalSt25tbBlock *blockData );
+
+
+/*! 
+ *****************************************************************************
+ * \brief  ST25TB Poller Get Read Multiple Blocks Status
+ *  
+ * Returns the status of the Read Multiple Blocks started by 
+ * rfalSt25tbPollerStartReadMultipleBlocks()
+ * 
+ * \return ERR_BUSY         : Operation is ongoing
+ * \return ERR_TIMEOUT      : Timeout error, no listener device detected
+ * \return ERR_PROTO        : Protocol error detected
+ * \return ERR_NONE         : No error, all blocks read
+ *****************************************************************************
+ */
+ReturnCode rfalSt25tbPollerGetReadMultipleBlocksStatus( void );
+
+
 /*! 
  *****************************************************************************
  * \brief  ST25TB Poller Write Block
@@ -69,9 +69,13 @@
  */
 #define RFAL_T1T_UID_LEN               4   /*!< T1T UID length of cascade level 1 only tag  */
 #define RFAL_T1T_HR_LENGTH             2   /*!< T1T HR(Header ROM) length                   */
+#define RFAL_T1T_BLOCK_LEN             8U  /*!< T1T block length (READ8/WRITE-E8/WRITE-NE8)  */
+#define RFAL_T1T_SEGMENT_LEN         128U  /*!< T1T segment length (RSEG)                    */
 
 #define RFAL_T1T_HR0_NDEF_MASK      0xF0   /*!< T1T HR0 NDEF capability mask  T1T 1.2 2.2.2 */
 #define RFAL_T1T_HR0_NDEF_SUPPORT   0x10   /*!< T1T HR0 NDEF capable value    T1T 1.2 2.2.2 */
+#define RFAL_T1T_HR0_MEM_MASK       0x0F   /*!< T1T HR0 memory model mask     T1T 1.2 2.2.2 */
+#define RFAL_T1T_HR0_MEM_STATIC     0x01   /*!< T1T HR0 static memory (RALL/READ/WRITE only) */
 
 
 /*! NFC-A T1T (Topaz) command set */
@@ -81,7 +85,11 @@ typedef enum
     RFAL_T1T_CMD_RALL     = 0x00,          /*!< T1T Read All                                */
     RFAL_T1T_CMD_READ     = 0x01,          /*!< T1T Read                                    */
     RFAL_T1T_CMD_WRITE_E  = 0x53,          /*!< T1T Write with erase (single byte)          */
-    RFAL_T1T_CMD_WRITE_NE = 0x1A           /*!< T1T Write with no erase (single byte)       */
+    RFAL_T1T_CMD_WRITE_NE = 0x1A,          /*!< T1T Write with no erase (single byte)       */
+    RFAL_T1T_CMD_RSEG     = 0x10,          /*!< T1T Read segment (128 bytes)                */
+    RFAL_T1T_CMD_READ8    = 0x02,          /*!< T1T Read block (8 bytes)                    */
+    RFAL_T1T_CMD_WRITE_E8 = 0x54,          /*!< T1T Write with erase (8 bytes)              */
+    RFAL_T1T_CMD_WRITE_NE8 = 0x1B          /*!< T1T Write with no erase (8 bytes)           */
 } rfalT1Tcmds;
 
 
@@ -138,6 +146,39 @@ ReturnCode rfalT1TPollerInitialize( void );
 ReturnCode rfalT1TPollerRid( rfalT1TRidRes *ridRes );
 
 
+/*! 
+ *****************************************************************************
+ * \brief  NFC-A T1T Poller Start RID
+ *  
+ * This method starts the RID of a NFC-A T1T Listener device and returns
+ * immediately. rfalWorker() must be executed and the result retrieved 
+ * with rfalT1TPollerGetRidStatus()
+ *
+ * \param[out]  ridRes : pointer to place the RID_RES
+ * 
+ * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_NONE         : No error, RID started
+ *****************************************************************************
+ */
+ReturnCode rfalT1TPollerStartRid( rfalT1TRidRes *ridRes );
+
+
+/*! 
+ *****************************************************************************
+ * \brief  NFC-A T1T Poller Get RID Status
+ *  
+ * Returns the status of the RID started by rfalT1TPollerStartRid()
+ *
+ * \return ERR_BUSY         : Operation is ongoing
+ * \return ERR_TIMEOUT      : Timeout error, no listener device detected
+ * \return ERR_PROTO        : Protocol error, invalid RID_RES
+ * \return ERR_NONE         : No error, RID_RES received
+ *****************************************************************************
+ */
+ReturnCode rfalT1TPollerGetRidStatus( void );
+
+
 /*! 
  *****************************************************************************
  * \brief  NFC-A T1T Poller RALL
@@ -176,6 +217,93 @@ ReturnCode rfalT1TPollerRall( const uint8_t* uid, uint8_t* rxBuf, uint16_t rxBuf
  */
 ReturnCode rfalT1TPollerWrite( const uint8_t* uid, uint8_t address, uint8_t data );
 
+
+/*! 
+ *****************************************************************************
+ * \brief  NFC-A T1T Poller RSEG
+ *  
+ * This method reads a whole segment (128 bytes) of a NFC-A T1T Listener 
+ * device with dynamic memory (e.g. Topaz 512)
+ *
+ *
+ * \param[in]   uid       : the UID of the device to read data
+ * \param[in]   segment   : segment number to be read
+ * \param[out]  rxBuf     : pointer to place the read data (segment data only)
+ * \param[in]   rxBufLen  : size of rxBuf, at least RFAL_T1T_SEGMENT_LEN
+ * 
+ * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_PROTO        : Protocol error
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode rfalT1TPollerRseg( const uint8_t* uid, uint8_t segment, uint8_t* rxBuf, uint16_t rxBufLen );
+
+
+/*! 
+ *****************************************************************************
+ * \brief  NFC-A T1T Poller READ8
+ *  
+ * This method reads one block (8 bytes) of a NFC-A T1T Listener 
+ * device with dynamic memory
+ *
+ *
+ * \param[in]   uid       : the UID of the device to read data
+ * \param[in]   block     : block number to be read
+ * \param[out]  rxBuf     : pointer to place the read data (block data only)
+ * \param[in]   rxBufLen  : size of rxBuf, at least RFAL_T1T_BLOCK_LEN
+ * 
+ * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_PROTO        : Protocol error
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode rfalT1TPollerRead8( const uint8_t* uid, uint8_t block, uint8_t* rxBuf, uint16_t rxBufLen );
+
+
+/*! 
+ *****************************************************************************
+ * \brief  NFC-A T1T Poller WRITE-E8
+ *  
+ * This method erases and writes one block (8 bytes) of a NFC-A T1T 
+ * Listener device with dynamic memory
+ *
+ *
+ * \param[in]   uid       : the UID of the device to write data
+ * \param[in]   block     : block number to be written
+ * \param[in]   data      : the RFAL_T1T_BLOCK_LEN bytes to be written
+ * 
+ * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_PROTO        : Protocol error
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode rfalT1TPollerWriteE8( const uint8_t* uid, uint8_t block, const uint8_t* data );
+
+
+/*! 
+ *****************************************************************************
+ * \brief  NFC-A T1T Poller WRITE-NE8
+ *  
+ * This method writes one block (8 bytes) of a NFC-A T1T Listener device 
+ * with dynamic memory without erasing it i.e. bits can only be set, 
+ * as used for lock and OTP bytes
+ *
+ *
+ * \param[in]   uid       : the UID of the device to write data
+ * \param[in]   block     : block number to be written
+ * \param[in]   data      : the RFAL_T1T_BLOCK_LEN bytes to be written
+ * 
+ * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_PROTO        : Protocol error
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode rfalT1TPollerWriteNE8( const uint8_t* uid, uint8_t block, const uint8_t* data );
+
 #endif /* RFAL_T1T_H */
 
 /**
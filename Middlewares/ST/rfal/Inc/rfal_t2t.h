@@ -71,6 +71,11 @@
 #define RFAL_T2T_BLOCK_LEN            4U                          /*!< T2T block length           */
 #define RFAL_T2T_READ_DATA_LEN        (4U * RFAL_T2T_BLOCK_LEN)   /*!< T2T READ data length       */
 #define RFAL_T2T_WRITE_DATA_LEN       RFAL_T2T_BLOCK_LEN          /*!< T2T WRITE data length      */
+#define RFAL_T2T_VERSION_LEN          8U                          /*!< GET_VERSION response length*/
+
+#define RFAL_T2T_VERSION_VENDOR_NXP   0x04U                       /*!< GET_VERSION NXP vendor ID  */
+#define RFAL_T2T_VERSION_TYPE_UL      0x03U                       /*!< Product type Ultralight    */
+#define RFAL_T2T_VERSION_TYPE_NTAG    0x04U                       /*!< Product type NTAG          */
 
 /*
 ******************************************************************************
@@ -78,6 +83,19 @@
 ******************************************************************************
 */
 
+/*! NTAG / Ultralight EV1 GET_VERSION response   NTAG21x 10.1 */
+typedef struct
+{
+    uint8_t header;                         /*!< Fixed header: 00h                       */
+    uint8_t vendorId;                       /*!< Vendor ID                               */
+    uint8_t prodType;                       /*!< Product type                            */
+    uint8_t prodSubType;                    /*!< Product subtype                         */
+    uint8_t majorVer;                       /*!< Major product version                   */
+    uint8_t minorVer;                       /*!< Minor product version                   */
+    uint8_t storageSize;                    /*!< Storage size                            */
+    uint8_t protocolType;                   /*!< Protocol type                           */
+} rfalT2TVersion;
+
 
 /*
 ******************************************************************************
@@ -106,6 +124,54 @@
 ReturnCode rfalT2TPollerRead( uint8_t blockNum, uint8_t* rxBuf, uint16_t rxBufLen, uint16_t *rcvLen );
 
 
+/*! 
+ *****************************************************************************
+ * \brief  NFC-A T2T Poller Fast Read
+ *  
+ * This method sends a FAST_READ command to a NFC-A T2T Listener device 
+ * (NTAG21x, Ultralight EV1) retrieving all blocks from startBlockNum up 
+ * to endBlockNum in a single response.
+ * The range is limited to the current sector and must be supported by the 
+ * device, otherwise it will NACK the command
+ *
+ *
+ * \param[in]   startBlockNum : Number of the first block to read
+ * \param[in]   endBlockNum   : Number of the last block to read (inclusive)
+ * \param[out]  rxBuf         : pointer to place the read data
+ * \param[in]   rxBufLen      : size of rxBuf, at least the range length
+ * \param[out]  rcvLen        : actual received data
+ * 
+ * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_PROTO        : Protocol error
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode rfalT2TPollerFastRead( uint8_t startBlockNum, uint8_t endBlockNum, uint8_t* rxBuf, uint16_t rxBufLen, uint16_t *rcvLen );
+
+
+/*! 
+ *****************************************************************************
+ * \brief  NFC-A T2T Poller Get Version
+ *  
+ * This method sends a GET_VERSION command to a NFC-A T2T Listener device 
+ * to retrieve its vendor, product type and storage size
+ *
+ * \warning Devices not supporting GET_VERSION may return to IDLE state 
+ *          and must then be re-activated
+ *
+ * \param[out]  version    : pointer to place the version information
+ * 
+ * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_TIMEOUT      : No response, command not supported
+ * \return ERR_PROTO        : Protocol error, command not supported
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode rfalT2TPollerGetVersion( rfalT2TVersion *version );
+
+
 /*! 
  *****************************************************************************
  * \brief  NFC-A T2T Poller Write
@@ -75,6 +75,8 @@
 #define RFAL_T4T_MAX_CAPDU_PROLOGUE_LEN                          4U                          /*!< Command-APDU prologue length (CLA INS P1 P2)                    */
 #define RFAL_T4T_LE_LEN                                          1U                          /*!< Le Expected Response Length (short field coding)                */
 #define RFAL_T4T_LC_LEN                                          1U                          /*!< Lc Data field length  (short field coding)                      */
+#define RFAL_T4T_LE_EXT_LEN                                      2U                          /*!< Le Expected Response Length (extended field coding)             */
+#define RFAL_T4T_LC_EXT_LEN                                      3U                          /*!< Lc Data field length  (extended field coding: 00h + 2 bytes)    */
 #define RFAL_T4T_MAX_RAPDU_SW1SW2_LEN                            2U                          /*!< SW1 SW2 length                                                  */
 #define RFAL_T4T_CLA                                          0x00U                          /*!< Class byte (contains 00h because secure message are not used)   */
 
@@ -106,9 +108,9 @@ typedef struct
     uint8_t                  INS;                              /*!< Instruction byte                                   */
     uint8_t                  P1;                               /*!< Parameter byte 1                                   */
     uint8_t                  P2;                               /*!< Parameter byte 2                                   */
-    uint8_t                  Lc;                               /*!< Data field length                                  */
+    uint16_t                 Lc;                               /*!< Data field length (extended coding if > 255)       */
     bool                     LcFlag;                           /*!< Lc flag (append Lc when true)                      */
-    uint8_t                  Le;                               /*!< Expected Response Length                           */
+    uint16_t                 Le;                               /*!< Expected Response Length (extended if > 256)       */
     bool                     LeFlag;                           /*!< Le flag (append Le when true)                      */
     
     rfalIsoDepApduBufFormat  *cApduBuf;                        /*!< Command-APDU buffer  (Tx)                          */
@@ -160,10 +162,15 @@ typedef enum
  * \warning The ISO-DEP module is used to perform the tranceive. Usually 
  *          activation has been done via ISO-DEP activatiavtion. If not
  *          please call rfalIsoDepInitialize() before.
+ *
+ * \note Extended field coding (ISO7816-4 5.1) is used for both Lc and Le
+ *       whenever Lc exceeds 255 or Le exceeds 256, otherwise short field 
+ *       coding is used. Le = 0 is coded as 00h (short maximum).
  * 
  * \param[in,out] apduParam : APDU parameters
  *                            apduParam.cApduLen will contain the APDU length 
  * 
+ * \return ERR_NOMEM        : C-APDU does not fit the APDU buffer
  * \return ERR_PARAM        : Invalid parameter
  * \return ERR_PROTO        : Protocol error
  * \return ERR_NONE         : No error
@@ -281,7 +288,7 @@ ReturnCode rfalT4TPollerComposeSelectFileV1Mapping( rfalIsoDepApduBufFormat *cAp
  * \return ERR_NONE         : No error
  *****************************************************************************
  */
-ReturnCode rfalT4TPollerComposeReadData( rfalIsoDepApduBufFormat *cApduBuf, uint16_t offset, uint8_t expLen, uint16_t *cApduLen );
+ReturnCode rfalT4TPollerComposeReadData( rfalIsoDepApduBufFormat *cApduBuf, uint16_t offset, uint16_t expLen, uint16_t *cApduLen );
 
 /*! 
  *****************************************************************************
@@ -304,7 +311,7 @@ ReturnCode rfalT4TPollerComposeReadData( rfalIsoDepApduBufFormat *cApduBuf, uint
  * \return ERR_NONE         : No error
  *****************************************************************************
  */
-ReturnCode rfalT4TPollerComposeReadDataODO( rfalIsoDepApduBufFormat *cApduBuf, uint32_t offset, uint8_t expLen, uint16_t *cApduLen );
+ReturnCode rfalT4TPollerComposeReadDataODO( rfalIsoDepApduBufFormat *cApduBuf, uint32_t offset, uint16_t expLen, uint16_t *cApduLen );
 
 /*! 
  *****************************************************************************
@@ -328,7 +335,7 @@ ReturnCode rfalT4TPollerComposeReadDataODO( rfalIsoDepApduBufFormat *cApduBuf, u
  * \return ERR_NONE         : No error
  *****************************************************************************
  */
-ReturnCode rfalT4TPollerComposeWriteData( rfalIsoDepApduBufFormat *cApduBuf, uint16_t offset, const uint8_t* data, uint8_t dataLen, uint16_t *cApduLen );
+ReturnCode rfalT4TPollerComposeWriteData( rfalIsoDepApduBufFormat *cApduBuf, uint16_t offset, const uint8_t* data, uint16_t dataLen, uint16_t *cApduLen );
 
 /*! 
  *****************************************************************************
@@ -352,7 +359,7 @@ ReturnCode rfalT4TPollerComposeWriteData( rfalIsoDepApduBufFormat *cApduBuf, uin
  * \return ERR_NONE         : No error
  *****************************************************************************
  */
-ReturnCode rfalT4TPollerComposeWriteDataODO( rfalIsoDepApduBufFormat *cApduBuf, uint32_t offset, const uint8_t* data, uint8_t dataLen, uint16_t *cApduLen );
+ReturnCode rfalT4TPollerComposeWriteDataODO( rfalIsoDepApduBufFormat *cApduBuf, uint32_t offset, const uint8_t* data, uint16_t dataLen, uint16_t *cApduLen );
 
 #endif /* RFAL_T4T_H */
 
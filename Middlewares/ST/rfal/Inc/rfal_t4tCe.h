@@ -0,0 +1,265 @@
+
+/******************************************************************************
+  * \attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2019 STMicroelectronics</center></h2>
+  *
+  * Licensed under ST MYLIBERTY SOFTWARE LICENSE AGREEMENT (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        www.st.com/myliberty
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied,
+  * AND SPECIFICALLY DISCLAIMING THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+******************************************************************************/
+
+/*
+ *      PROJECT:   ST25R391x firmware
+ *      Revision:
+ *      LANGUAGE:  ISO C99
+ */
+
+/*! \file rfal_t4tCe.h
+ *
+ *  \author
+ *
+ *  \brief T4T NDEF Tag card emulation
+ *
+ *  This module answers the C-APDUs of the NFC Forum T4T NDEF procedures
+ *  (SELECT NDEF Tag Application, SELECT CC / NDEF File, READ BINARY and
+ *  UPDATE BINARY) received while in ISO-DEP Listen mode.
+ *
+ *  The NDEF File is served from an NDEF image: a caller-owned NDEF File
+ *  (NLEN followed by the NDEF message) that is read in place, from RAM or
+ *  Flash, together with its CC File R-APDU precomputed by
+ *  rfalT4tCeNdefImageInit(). READ BINARY data is taken directly from the
+ *  image onto the R-APDU.
+ *
+ *  A new image is published with rfalT4tCeSetNdefImage() at any time, also
+ *  while emulating. It is only taken into use on the next SELECT of the
+ *  NDEF Tag Application, or on rfalT4tCeDeactivate(), so that a Reader 
+ *  never reads a mix of two images. rfalT4tCeGetNdefImage() tells when 
+ *  the image replaced has been released.
+ *
+ *  This implementation was based on the following specs:
+ *    - ISO/IEC 7816-4  3rd Edition 2013-04-15
+ *    - NFC Forum T4T Technical Specification 1.0 2017-08-28
+ *
+ * \addtogroup RFAL
+ * @{
+ *
+ * \addtogroup RFAL-AL
+ * \brief RFAL Abstraction Layer
+ * @{
+ *
+ * \addtogroup T4TCE
+ * \brief RFAL T4T Card Emulation Module
+ * @{
+ *
+ */
+
+
+#ifndef RFAL_T4TCE_H
+#define RFAL_T4TCE_H
+
+/*
+ ******************************************************************************
+ * INCLUDES
+ ******************************************************************************
+ */
+#include "platform.h"
+#include "st_errno.h"
+#include "rfal_t4t.h"
+
+/*
+ ******************************************************************************
+ * GLOBAL DEFINES
+ ******************************************************************************
+ */
+
+#ifndef RFAL_FEATURE_T4T_CE_MLE
+    #define RFAL_FEATURE_T4T_CE_MLE        0x007FU                              /*!< MLe announced on the CC File: max READ BINARY data length  */
+#endif
+
+#ifndef RFAL_FEATURE_T4T_CE_MLC
+    #define RFAL_FEATURE_T4T_CE_MLC        0x007FU                              /*!< MLc announced on the CC File: max UPDATE BINARY data length*/
+#endif
+
+#define RFAL_T4TCE_FID_CC                  0xE103U                              /*!< CC File Identifier                      T4T 1.0  5.1.2     */
+#define RFAL_T4TCE_FID_NDEF                0xE104U                              /*!< NDEF File Identifier emulated                              */
+#define RFAL_T4TCE_CC_LEN                  15U                                  /*!< CC File length, mapping version 2.0     T4T 1.0  5.1.2.1   */
+#define RFAL_T4TCE_NDEF_FILE_MIN_LEN       0x0005U                              /*!< Min NDEF File size                      T4T 1.0  5.1.2.2   */
+#define RFAL_T4TCE_NDEF_FILE_MAX_LEN       0x7FFFU                              /*!< Max NDEF File size: READ BINARY offset range 0000h-7FFFh   */
+
+#define RFAL_T4TCE_SW_OK                   0x9000U                              /*!< Normal processing                                          */
+#define RFAL_T4TCE_SW_WRONG_LENGTH         0x6700U                              /*!< Wrong length                                               */
+#define RFAL_T4TCE_SW_SECURITY             0x6982U                              /*!< Security status not satisfied: no write access             */
+#define RFAL_T4TCE_SW_NO_EF                0x6986U                              /*!< Command not allowed: no current EF                         */
+#define RFAL_T4TCE_SW_NOT_FOUND            0x6A82U                              /*!< File or application not found                             */
+#define RFAL_T4TCE_SW_WRONG_P1P2           0x6B00U                              /*!< Wrong parameters P1-P2: offset outside the EF              */
+#define RFAL_T4TCE_SW_INS_NOT_SUPPORTED    0x6D00U                              /*!< Instruction code not supported                             */
+#define RFAL_T4TCE_SW_CLA_NOT_SUPPORTED    0x6E00U                              /*!< Class not supported                                        */
+
+
+/*
+******************************************************************************
+* GLOBAL TYPES
+******************************************************************************
+*/
+
+/*! NDEF image: NDEF File served in place with its precomputed CC File R-APDU */
+typedef struct
+{
+    const uint8_t  *file;                        /*!< NDEF File: NLEN followed by the NDEF message         */
+    uint8_t        *wrFile;                      /*!< Same NDEF File when writable, NULL if read-only      */
+    uint16_t       fileLen;                      /*!< NDEF File size                                       */
+    uint8_t        ccRApdu[RFAL_T4TCE_CC_LEN + RFAL_T4T_MAX_RAPDU_SW1SW2_LEN]; /*!< CC File followed by SW 9000 */
+} rfalT4tCeNdefImage;
+
+
+/*! T4T CE states */
+typedef enum
+{
+    RFAL_T4TCE_ST_IDLE          = 0,             /*!< NDEF Tag Application not selected                    */
+    RFAL_T4TCE_ST_APP_SELECTED  = 1,             /*!< NDEF Tag Application selected, no current EF         */
+    RFAL_T4TCE_ST_CC_SELECTED   = 2,             /*!< CC File selected                                     */
+    RFAL_T4TCE_ST_NDEF_SELECTED = 3              /*!< NDEF File selected                                   */
+} rfalT4tCeState;
+
+
+/*! T4T CE context */
+typedef struct
+{
+    const rfalT4tCeNdefImage * volatile pending; /*!< Image published by the application                   */
+    const rfalT4tCeNdefImage * volatile image;   /*!< Image served, latched on NDEF Tag Application SELECT */
+    rfalT4tCeState                      state;   /*!< State                                                */
+} rfalT4tCe;
+
+
+/*
+******************************************************************************
+* GLOBAL FUNCTION PROTOTYPES
+******************************************************************************
+*/
+
+
+/*!
+ *****************************************************************************
+ * \brief  T4T CE NDEF Image Initialize
+ *
+ * Describes an NDEF File and precomputes its CC File R-APDU.
+ * The NDEF File is referenced, not copied, and shall be kept while the
+ * image is in use. If wrFile is not NULL it shall point to the same NDEF
+ * File, which the Reader is then allowed to UPDATE.
+ *
+ * \param[out] img     : NDEF image
+ * \param[in]  file    : NDEF File (NLEN followed by the NDEF message)
+ * \param[in]  wrFile  : same NDEF File if writable, NULL if read-only
+ * \param[in]  fileLen : NDEF File size
+ *
+ * \return ERR_PARAM : Invalid parameters
+ * \return ERR_NONE  : No error
+ *****************************************************************************
+ */
+ReturnCode rfalT4tCeNdefImageInit( rfalT4tCeNdefImage *img, const uint8_t *file, uint8_t *wrFile, uint16_t fileLen );
+
+
+/*!
+ *****************************************************************************
+ * \brief  T4T CE Initialize
+ *
+ * Initializes the T4T CE context, with no application nor file selected
+ *
+ * \param[out] ce  : T4T CE context
+ * \param[in]  img : NDEF image to be served, NULL if none yet
+ *****************************************************************************
+ */
+void rfalT4tCeInitialize( rfalT4tCe *ce, const rfalT4tCeNdefImage *img );
+
+
+/*!
+ *****************************************************************************
+ * \brief  T4T CE Set NDEF Image
+ *
+ * Publishes a new NDEF image. It may be called while emulating, also from
+ * another context than the one processing the C-APDUs: the image served
+ * is swapped atomically on the next SELECT of the NDEF Tag Application
+ * (SELECT by DF name) or on rfalT4tCeDeactivate(). The image replaced 
+ * shall be kept until rfalT4tCeGetNdefImage() returns img.
+ *
+ * \param[in,out] ce  : T4T CE context
+ * \param[in]     img : NDEF image, NULL to stop answering SELECTs
+ *****************************************************************************
+ */
+void rfalT4tCeSetNdefImage( rfalT4tCe *ce, const rfalT4tCeNdefImage *img );
+
+
+/*!
+ *****************************************************************************
+ * \brief  T4T CE Get NDEF Image
+ *
+ * Returns the NDEF image being served. Once it returns the image last 
+ * published with rfalT4tCeSetNdefImage(), the images published before 
+ * are no longer referenced and may be modified or freed.
+ *
+ * \param[in] ce : T4T CE context
+ *
+ * \return NDEF image being served, NULL if none
+ *****************************************************************************
+ */
+const rfalT4tCeNdefImage* rfalT4tCeGetNdefImage( const rfalT4tCe *ce );
+
+
+/*!
+ *****************************************************************************
+ * \brief  T4T CE Deactivate
+ *
+ * To be called, from the context processing the C-APDUs, when the Reader
+ * is gone (field off, DESELECT) or before a new session starts. The NDEF
+ * Tag Application is no longer selected and the last image published is
+ * taken into use, releasing the previous one.
+ *
+ * \param[in,out] ce : T4T CE context
+ *****************************************************************************
+ */
+void rfalT4tCeDeactivate( rfalT4tCe *ce );
+
+
+/*!
+ *****************************************************************************
+ * \brief  T4T CE Process C-APDU
+ *
+ * Processes a C-APDU received from the Reader and places the R-APDU to be
+ * sent back on rApdu. READ BINARY data is limited to the Le requested, to
+ * RFAL_FEATURE_T4T_CE_MLE and to the space available on rApdu.
+ *
+ * \param[in,out] ce          : T4T CE context
+ * \param[in]     cApdu       : C-APDU received
+ * \param[in]     cApduLen    : C-APDU length
+ * \param[out]    rApdu       : buffer where the R-APDU is placed
+ * \param[in]     rApduBufLen : rApdu size
+ * \param[out]    rApduLen    : R-APDU length
+ *
+ * \return ERR_PARAM : Invalid parameters, no R-APDU
+ * \return ERR_NONE  : R-APDU placed on rApdu
+ *****************************************************************************
+ */
+ReturnCode rfalT4tCeProcessCApdu( rfalT4tCe *ce, const uint8_t *cApdu, uint16_t cApduLen, uint8_t *rApdu, uint16_t rApduBufLen, uint16_t *rApduLen );
+
+
+#endif /* RFAL_T4TCE_H */
+
+/**
+  * @}
+  *
+  * @}
+  *
+  * @}
+  */
@@ -46,6 +46,7 @@
 
 #include "rfal_isoDep.h"
 #include "rfal_rf.h"
+#include "rfal_crc.h"
 #include "utils.h"
 
 /*
@@ -140,6 +141,17 @@
 #define ISODEP_FWT_DEACTIVATION         (71680U)     /*!< FWT to be used after DESELECT, Digital 1.0 A9   */
 #define ISODEP_MAX_RERUNS               (0x0FFFFFFFU)/*!< Maximum rerun retrys for a blocking protocol run*/
 
+#define ISODEP_BR_ERR_INC               (4U)         /*!< Bit rate error level raise on a Rx transmission error */
+#define ISODEP_BR_ERR_LEVEL             (12U)        /*!< Bit rate error level that triggers a bit rate fallback */
+
+#define ISODEP_RT_MIN_SAMPLES           (4U)         /*!< Responses measured before a learned response time is used    */
+#define ISODEP_RT_MARGIN                (4U)         /*!< Adaptive timeout: multiple of the slowest response learned   */
+#define ISODEP_RT_FLOOR_MS              (10U)        /*!< Adaptive timeout added margin (ms): SysTick resolution, card jitter */
+#define ISODEP_RT_SAMPLES_MAX           (0xFFU)      /*!< Number of samples saturation value                           */
+#define ISODEP_RT_LEN_CLASS_MIN         (16U)        /*!< Data length up to which a command is of the first length class */
+#define ISODEP_RT_LEN_CLASS_MAX         (3U)         /*!< Last length class: each one spans 4x the data of the previous */
+#define ISODEP_HBKEY_PRELOAD            (0xFFFFU)    /*!< CRC preload of the historical bytes key                      */
+
 
 #define ISODEP_PCBSBLOCK                ( 0x00U | ISODEP_PCB_SBLOCK | ISODEP_PCB_B2_BIT ) /*!< PCB Value of a S-Block                 */ 
 #define ISODEP_PCB_SDSL                 ( ISODEP_PCBSBLOCK | ISODEP_PCB_DESELECT )        /*!< PCB Value of a S-Block with DESELECT   */
@@ -151,6 +163,9 @@
 #define ISODEP_FWI_LIS_MAX              (uint8_t)((gIsoDep.compMode == RFAL_COMPLIANCE_MODE_EMV) ? ISODEP_FWI_LIS_MAX_EMVCO : ISODEP_FWI_LIS_MAX_NFC)  /*!< FWI Listener Max as NFC / EMVCo */
 #define ISODEP_FWT_LIS_MAX              rfalIsoDepFWI2FWT(ISODEP_FWI_LIS_MAX)             /*!< FWT Listener Max                       */
 
+#define ISODEP_FSXI_MAX                 (uint8_t)((gIsoDep.compMode == RFAL_COMPLIANCE_MODE_EMV) ? RFAL_ISODEP_FSDI_MAX_EMV : ((gIsoDep.compMode == RFAL_COMPLIANCE_MODE_ISO) ? RFAL_ISODEP_FSDI_MAX_ISO : RFAL_ISODEP_FSDI_MAX_NFC))  /*!< FSxI Max as NFC / ISO / EMVCo */
+#define ISODEP_FSDI_LIMIT( fsdi )       (uint8_t)MIN( MIN( (uint8_t)(fsdi), (uint8_t)RFAL_ISODEP_FSDI_MAX ), ISODEP_FSXI_MAX )  /*!< FSDI to be announced: bound by the compliance mode and by the I-Block buffer */
+
 #define ISODEP_FWI_MIN_10               (1U)      /*!< Minimum value for FWI Digital 1.0 11.6.2.17 */
 #define ISODEP_FWI_MIN_11               (0U)      /*!< Default value for FWI Digital 1.1 13.6.2    */
 #define ISODEP_FWI_MAX                  (14U)     /*!< Maximum value for FWI Digital 1.0 11.6.2.17 */
@@ -207,6 +222,7 @@
 
 #define RFAL_ISODEP_FSDI_MAX_NFC               (8U)     /*!< Max FSDI value   Digital 2.0  14.6.1.9 & B7 & B8   */
 #define RFAL_ISODEP_FSDI_MAX_EMV               (0x0CU)  /*!< Max FSDI value   EMVCo 3.0  5.7.2.5                */
+#define RFAL_ISODEP_FSDI_MAX_ISO               (0x0CU)  /*!< Max FSDI value   ISO14443-3 Amd2 2012              */
 
 #define RFAL_ISODEP_RATS_PARAM_FSDI_MASK       (0xF0U)  /*!< Mask bits for FSDI in RATS                         */
 #define RFAL_ISODEP_RATS_PARAM_FSDI_SHIFT      (4U)     /*!< Shift for FSDI in RATS                             */
@@ -343,6 +359,8 @@ typedef enum
     ISODEP_ST_PCD_TX,               /*!< PCD Transmission State         */
     ISODEP_ST_PCD_RX,               /*!< PCD Reception State            */
     ISODEP_ST_PCD_WAIT_DSL,         /*!< PCD Wait for DSL response      */
+    ISODEP_ST_PCD_BR_TX,            /*!< PCD S(PARAMETERS) Transmission */
+    ISODEP_ST_PCD_BR_RX,            /*!< PCD S(PARAMETERS) Reception    */
         
     ISODEP_ST_PICC_ACT_ATS,         /*!< PICC has replied to RATS (ATS) */
     ISODEP_ST_PICC_ACT_ATTRIB,      /*!< PICC has replied to ATTRIB     */
@@ -403,7 +421,7 @@ typedef struct{
   rfalComplianceMode compMode;   /*!< Compliance mode                           */
   
   uint8_t         ctrlRxBuf[ISODEP_CONTROLMSG_BUF_LEN];  /*!< Control msg buf   */
-  uint16_t        ctrlRxLen;  /*!< Control msg rcvd len (used only for DSL)     */
+  uint16_t        ctrlRxLen;  /*!< Control msg rcvd len (DSL and S(PARAMETERS)) */
   
   
   rfalIsoDepListenActvParam actvParam;  /*!< Listen Activation context          */
@@ -413,6 +431,27 @@ typedef struct{
   uint16_t                APDURxPos;        /*!< APDU Rx position               */
   bool                    isAPDURxChaining; /*!< APDU Transceive chaining flag  */
   
+  bool            isRxInPlace;   /*!< Chained INF placed contiguously in rxBuf  */
+  bool            isRxHdrSaved;  /*!< rxHdrSave holds bytes under Rx header     */
+  uint8_t         rxHdrSave[ISODEP_HDR_MAX_LEN]; /*!< Data overlaid by Rx header */
+  
+  uint8_t         brErrLvl;      /*!< Bit rate error level: raised by Rx transmission errors, decayed by valid blocks */
+  rfalIsoDepDevice *brDev;       /*!< Device whose bit rate was set by S(PARAMETERS) */
+  rfalIsoDepControlMsgSParam brMsg; /*!< S(PARAMETERS) of a bit rate step down  */
+  rfalBitRate     brTxSel;       /*!< Step down Tx bit rate selected from BRIND */
+  rfalBitRate     brRxSel;       /*!< Step down Rx bit rate selected from BRIND */
+  bool            isBrAct;       /*!< Step down BRACT sent, BRACK expected      */
+  
+  bool            isNoDidActive; /*!< A session card not supporting DID is active */
+  
+  rfalIsoDepRtProfile *rtProf;   /*!< Learned response times, NULL: FWT only    */
+  uint32_t        rtTick;        /*!< SysTick of the last block sent            */
+  uint32_t        rtCmdTick;     /*!< SysTick of the last block of the command  */
+  uint8_t         rtIns;         /*!< INS of the current command                */
+  uint8_t         rtLenClass;    /*!< Data length class of the current command  */
+  bool            isRtIns;       /*!< rtIns is valid                            */
+  bool            isRtPending;   /*!< Command's first response not yet received */
+  
 }rfalIsoDep;
 
 
@@ -434,11 +473,26 @@ static void isoDepClearCounters( void );
 static ReturnCode isoDepTx( uint8_t pcb, const uint8_t* txBuf, uint8_t *infBuf, uint16_t infLen, uint32_t fwt );
 static ReturnCode isoDepHandleControlMsg( rfalIsoDepControlMsg controlMsg, uint8_t param );
 static void rfalIsoDepApdu2IBLockParam( rfalIsoDepApduTxRxParam apduParam, rfalIsoDepTxRxParam *iBlockParam, uint16_t txPos, uint16_t rxPos );
+static ReturnCode isoDepStartTransceive( rfalIsoDepTxRxParam param, uint16_t rxBufLen, bool isRxInPlace );
+static void isoDepRxInPlaceNext( uint16_t infLen );
+static void isoDepRxInPlaceRestore( void );
 
 #if RFAL_FEATURE_ISO_DEP_POLL
     static ReturnCode isoDepDataExchangePCD( uint16_t *outActRxLen, bool *outIsChaining );
     static void rfalIsoDepCalcBitRate(rfalBitRate maxAllowedBR, uint8_t piccBRCapability, rfalBitRate *dsi, rfalBitRate *dri);
     static uint32_t rfalIsoDepSFGI2SFGT( uint8_t sfgi );
+    static uint16_t isoDepSParamBRReq( rfalIsoDepControlMsgSParam *sParam );
+    static ReturnCode isoDepSParamBRInd( const rfalIsoDepControlMsgSParam *sParam, uint16_t rcvLen, rfalBitRate maxTxBR, rfalBitRate maxRxBR, rfalBitRate *txBR, rfalBitRate *rxBR );
+    static uint16_t isoDepSParamBRAct( rfalIsoDepControlMsgSParam *sParam, rfalBitRate txBR, rfalBitRate rxBR );
+    static ReturnCode isoDepSParamBRAck( rfalIsoDepDevice *isoDepDev, const rfalIsoDepControlMsgSParam *sParam, uint16_t rcvLen, rfalBitRate txBR, rfalBitRate rxBR );
+    static bool isoDepBRStepDownStart( void );
+    static ReturnCode isoDepBRStepDown( void );
+    static uint8_t isoDepRtLenClass( const uint8_t *apdu, uint16_t apduLen );
+    static rfalIsoDepRtIns* isoDepRtGetIns( uint8_t ins, uint8_t lenClass, bool add );
+    static uint32_t isoDepRtFwt( uint32_t fwt, uint16_t rtMax, uint8_t samples );
+    static uint32_t isoDepRtIBlockFwt( void );
+    static uint32_t isoDepRtWtxFwt( uint32_t fwt );
+    static void isoDepRtLearn( uint8_t rxPCB );
 #endif
 #if RFAL_FEATURE_ISO_DEP_LISTEN
     static ReturnCode isoDepDataExchangePICC( void );
@@ -462,6 +516,28 @@ static void isoDepClearCounters( void )
     gIsoDep.cntSRetrys   = 0;
 }
 
+/*******************************************************************************/
+static void isoDepRxInPlaceNext( uint16_t infLen )
+{
+    /* Move the Rx window right after the INF just received, so that the next   *
+     * chained INF lands contiguously. The header of the next block overlays    *
+     * the tail of the current INF, keep those bytes to restore them afterwards */
+    gIsoDep.rxBuf        = &gIsoDep.rxBuf[infLen];
+    gIsoDep.rxBufLen    -= infLen;
+    gIsoDep.isRxHdrSaved = true;
+    ST_MEMCPY( gIsoDep.rxHdrSave, gIsoDep.rxBuf, gIsoDep.rxBufInfPos );
+}
+
+/*******************************************************************************/
+static void isoDepRxInPlaceRestore( void )
+{
+    /* Put back the previous INF bytes overlaid by the header of the block just received */
+    if( gIsoDep.isRxHdrSaved )
+    {
+        ST_MEMCPY( gIsoDep.rxBuf, gIsoDep.rxHdrSave, gIsoDep.rxBufInfPos );
+    }
+}
+
 /*******************************************************************************/
 static ReturnCode isoDepTx( uint8_t pcb, const uint8_t* txBuf, uint8_t *infBuf, uint16_t infLen, uint32_t fwt )
 {
@@ -473,6 +549,16 @@ static ReturnCode isoDepTx( uint8_t pcb, const uint8_t* txBuf, uint8_t *infBuf,
     txBlock         = infBuf;                      /* Point to beginning of the INF, and go backwards     */
     gIsoDep.lastPCB = pcb;                         /* Store the last PCB sent                             */
     
+#if RFAL_FEATURE_ISO_DEP_POLL
+    /* Response time measured from the first transmission of the command's last block */
+    gIsoDep.rtTick  = platformGetSysTick();
+    if( isoDep_PCBisIBlock( pcb ) && !gIsoDep.isTxChaining && gIsoDep.isRtIns && !gIsoDep.isRtPending )
+    {
+        gIsoDep.rtCmdTick   = gIsoDep.rtTick;
+        gIsoDep.isRtPending = true;
+    }
+#endif /* RFAL_FEATURE_ISO_DEP_POLL */
+    
     
     if ( infLen > 0U )
     {
@@ -548,7 +634,15 @@ static ReturnCode isoDepHandleControlMsg( rfalIsoDepControlMsg controlMsg, uint8
                 return ERR_TIMEOUT;
             }
             
-            pcb = isoDep_PCBRNAK( gIsoDep.blockNumber );            
+            pcb = isoDep_PCBRNAK( gIsoDep.blockNumber );
+            
+#if RFAL_FEATURE_ISO_DEP_POLL
+            /* A card answers an R(NAK) without processing: wait for what it has been seen to take, or as for the command itself */
+            if( (gIsoDep.role == ISODEP_ROLE_PCD) && (gIsoDep.rtProf != NULL) )
+            {
+                fwtTemp = ((gIsoDep.rtProf->ctrlSamples >= ISODEP_RT_MIN_SAMPLES) ? isoDepRtFwt( fwtTemp, gIsoDep.rtProf->ctrlRtMax, gIsoDep.rtProf->ctrlSamples ) : isoDepRtIBlockFwt());
+            }
+#endif /* RFAL_FEATURE_ISO_DEP_POLL */
             break;
             
         /*******************************************************************************/
@@ -570,6 +664,11 @@ static ReturnCode isoDepHandleControlMsg( rfalIsoDepControlMsg controlMsg, uint8
                 fwtTemp = (gIsoDep.fwt * param);
                 fwtTemp = MIN( RFAL_ISODEP_MAX_FWT, fwtTemp );
                 fwtTemp += gIsoDep.dFwt;
+                
+#if RFAL_FEATURE_ISO_DEP_POLL
+                /* Pre-armed WTX: the extension granted is cut down to what the command was seen to take once granted */
+                fwtTemp = isoDepRtWtxFwt( fwtTemp );
+#endif /* RFAL_FEATURE_ISO_DEP_POLL */
             }
             
             pcb = ISODEP_PCB_SWTX;
@@ -657,6 +756,15 @@ void rfalIsoDepInitialize( void )
     gIsoDep.isTxPending  = false;
     gIsoDep.isWait4WTX   = false;
     
+    gIsoDep.rtProf       = NULL;
+    gIsoDep.isRtIns      = false;
+    gIsoDep.isRtPending  = false;
+    
+    gIsoDep.brErrLvl     = 0;
+    gIsoDep.brDev        = NULL;
+    
+    gIsoDep.isNoDidActive = false;
+    
     gIsoDep.compMode       = RFAL_COMPLIANCE_MODE_NFC;
     gIsoDep.maxRetriesR    = RFAL_ISODEP_MAX_R_RETRYS;
     gIsoDep.maxRetriesS    = RFAL_ISODEP_MAX_S_RETRYS;
@@ -726,9 +834,14 @@ static ReturnCode isoDepDataExchangePCD( uint16_t *outActRxLen, bool *outIsChain
         case ISODEP_ST_IDLE:
             return ERR_NONE;
         
+        /*******************************************************************************/
+        case ISODEP_ST_PCD_BR_TX:
+        case ISODEP_ST_PCD_BR_RX:
+            return isoDepBRStepDown();
+        
         /*******************************************************************************/
         case ISODEP_ST_PCD_TX:
-            ret = isoDepTx( isoDep_PCBIBlock( gIsoDep.blockNumber ), gIsoDep.txBuf, &gIsoDep.txBuf[gIsoDep.txBufInfPos], gIsoDep.txBufLen, (gIsoDep.fwt + gIsoDep.dFwt) );
+            ret = isoDepTx( isoDep_PCBIBlock( gIsoDep.blockNumber ), gIsoDep.txBuf, &gIsoDep.txBuf[gIsoDep.txBufInfPos], gIsoDep.txBufLen, isoDepRtIBlockFwt() );
             switch( ret )
             {
               case ERR_NONE:
@@ -754,6 +867,12 @@ static ReturnCode isoDepDataExchangePCD( uint16_t *outActRxLen, bool *outIsChain
                 case ERR_FRAMING:          /* added to handle test cases scenario TC_POL_NFCB_T4AT_BI_82_x_y & TC_POL_NFCB_T4BT_BI_82_x_y */
                 case ERR_INCOMPLETE_BYTE:  /* added to handle test cases scenario TC_POL_NFCB_T4AT_BI_82_x_y & TC_POL_NFCB_T4BT_BI_82_x_y  */
                     
+                    /* Transmission errors (not a mute PICC) raise the bit rate error level */
+                    if( ret != ERR_TIMEOUT )
+                    {
+                        gIsoDep.brErrLvl = (uint8_t)MIN( ((uint16_t)gIsoDep.brErrLvl + ISODEP_BR_ERR_INC), ISODEP_BR_ERR_LEVEL );
+                    }
+                    
                     if( gIsoDep.isRxChaining )
                     {   /* Rule 5 - In PICC chaining when a invalid/timeout occurs -> R-ACK */                        
                         EXIT_ON_ERR( ret, isoDepHandleControlMsg( ISODEP_R_ACK, RFAL_ISODEP_NO_PARAM ) );
@@ -769,6 +888,11 @@ static ReturnCode isoDepDataExchangePCD( uint16_t *outActRxLen, bool *outIsChain
                     return ERR_BUSY;
                     
                 case ERR_NONE:
+                    /* Once reached, the degraded level is kept until the bit rate changes */
+                    if( (gIsoDep.brErrLvl > 0U) && (gIsoDep.brErrLvl < ISODEP_BR_ERR_LEVEL) )
+                    {
+                        gIsoDep.brErrLvl--;
+                    }
                     break;
                     
                 case ERR_BUSY:
@@ -807,6 +931,8 @@ static ReturnCode isoDepDataExchangePCD( uint16_t *outActRxLen, bool *outIsChain
                 return ERR_PROTO;
             }
             
+            isoDepRtLearn( rxPCB );
+            
             
             /*******************************************************************************/
             /* Process S-Block                                                             */
@@ -896,9 +1022,6 @@ static ReturnCode isoDepDataExchangePCD( uint16_t *outActRxLen, bool *outIsChain
                         
                         isoDepClearCounters();  /* Clear counters in case R counter is already at max */
                         
-                        /* Rule 2 - Send ACK */
-                        EXIT_ON_ERR( ret, isoDepHandleControlMsg( ISODEP_R_ACK, RFAL_ISODEP_NO_PARAM ) );
-                        
                         /* Received I-Block with chaining, send current data to DH */
                         
                         /* remove ISO DEP header, check is necessary to move the INF data on the buffer */
@@ -908,6 +1031,16 @@ static ReturnCode isoDepDataExchangePCD( uint16_t *outActRxLen, bool *outIsChain
                             ST_MEMMOVE( &gIsoDep.rxBuf[gIsoDep.rxBufInfPos], &gIsoDep.rxBuf[gIsoDep.hdrLen], *outActRxLen );
                         }
                         
+                        /* Place the next block after this one before acknowledging it */
+                        if( gIsoDep.isRxInPlace )
+                        {
+                            isoDepRxInPlaceRestore();
+                            isoDepRxInPlaceNext( *outActRxLen );
+                        }
+                        
+                        /* Rule 2 - Send ACK */
+                        EXIT_ON_ERR( ret, isoDepHandleControlMsg( ISODEP_R_ACK, RFAL_ISODEP_NO_PARAM ) );
+                        
                         isoDepClearCounters();
                         return ERR_AGAIN;       /* Send Again signalling to run again, but some chaining data has arrived */
                     }
@@ -934,6 +1067,7 @@ static ReturnCode isoDepDataExchangePCD( uint16_t *outActRxLen, bool *outIsChain
                     {
                         ST_MEMMOVE( &gIsoDep.rxBuf[gIsoDep.rxBufInfPos], &gIsoDep.rxBuf[gIsoDep.hdrLen], *outActRxLen );
                     }
+                    isoDepRxInPlaceRestore();
                     
                     gIsoDep.state = ISODEP_ST_IDLE;
                     isoDepClearCounters();
@@ -973,6 +1107,10 @@ ReturnCode rfalIsoDepDeselect( void )
     ReturnCode ret;
     uint32_t   cntRerun;
     bool       dummyB;
+    bool       isNoDidActive;
+    
+    /* Other session cards remain active: a card without DID is only released by its own Deselect */
+    isNoDidActive = (gIsoDep.isNoDidActive && (gIsoDep.did != RFAL_ISODEP_NO_DID));
     
     /*******************************************************************************/
     /* Check if  rx parameters have been set before, otherwise use global variable *
@@ -1005,6 +1143,8 @@ ReturnCode rfalIsoDepDeselect( void )
     while( ((cntRerun--) != 0U) && (ret == ERR_BUSY) );
         
     rfalIsoDepInitialize();
+    gIsoDep.isNoDidActive = isNoDidActive;
+    
     return ((cntRerun == 0U) ? ERR_TIMEOUT : ret);
 }
 
@@ -1043,8 +1183,8 @@ uint16_t rfalIsoDepFSxI2FSx( uint8_t FSxI )
     uint16_t fsx;
     uint8_t  fsi;
     
-    /* Enforce maximum FSxI/FSx allowed - NFC Forum and EMVCo differ */
-    fsi = (( gIsoDep.compMode == RFAL_COMPLIANCE_MODE_EMV ) ? MIN( FSxI, RFAL_ISODEP_FSDI_MAX_EMV ) : MIN( FSxI, RFAL_ISODEP_FSDI_MAX_NFC ));
+    /* Enforce maximum FSxI/FSx allowed - NFC Forum, ISO14443 and EMVCo differ */
+    fsi = MIN( FSxI, ISODEP_FSXI_MAX );
     
     switch( fsi )
     {
@@ -1408,6 +1548,26 @@ uint16_t rfalIsoDepGetMaxInfLen( void )
 /*******************************************************************************/
 ReturnCode rfalIsoDepStartTransceive( rfalIsoDepTxRxParam param )
 {
+    return isoDepStartTransceive( param, sizeof(rfalIsoDepBufFormat), false );
+}
+
+
+/*******************************************************************************/
+static ReturnCode isoDepStartTransceive( rfalIsoDepTxRxParam param, uint16_t rxBufLen, bool isRxInPlace )
+{
+    uint8_t hdrLen;
+    bool    isNewCmd;
+    
+    /* A new command starts unless the previous block was chained: INF holds CLA INS */
+    isNewCmd = !gIsoDep.isTxChaining;
+    if( isNewCmd )
+    {
+        gIsoDep.isRtIns    = (param.txBufLen > 1U);
+        gIsoDep.rtIns      = (gIsoDep.isRtIns ? param.txBuf->inf[1] : 0U);
+        gIsoDep.rtLenClass = isoDepRtLenClass( param.txBuf->inf, param.txBufLen );
+    }
+    gIsoDep.isRtPending  = false;
+    
     gIsoDep.txBuf        = param.txBuf->prologue;
     gIsoDep.txBufInfPos  = (uint8_t)((uint32_t)param.txBuf->inf - (uint32_t)param.txBuf->prologue);
     gIsoDep.txBufLen     = param.txBufLen;
@@ -1415,7 +1575,9 @@ ReturnCode rfalIsoDepStartTransceive( rfalIsoDepTxRxParam param )
     
     gIsoDep.rxBuf        = param.rxBuf->prologue;
     gIsoDep.rxBufInfPos  = (uint8_t)((uint32_t)param.rxBuf->inf - (uint32_t)param.rxBuf->prologue);
-    gIsoDep.rxBufLen     = sizeof(rfalIsoDepBufFormat);
+    gIsoDep.rxBufLen     = rxBufLen;
+    gIsoDep.isRxInPlace  = isRxInPlace;
+    gIsoDep.isRxHdrSaved = false;
     
     gIsoDep.rxLen        = param.rxLen;
     gIsoDep.rxChaining   = param.isRxChaining;
@@ -1455,7 +1617,27 @@ ReturnCode rfalIsoDepStartTransceive( rfalIsoDepTxRxParam param )
        return ERR_NONE;
     }
     
+    /* As a PCD the response header is known upfront: receive the frame such that its INF lands directly on the INF position */
+    hdrLen  = RFAL_ISODEP_PCB_LEN;
+    hdrLen += (uint8_t)((gIsoDep.did != RFAL_ISODEP_NO_DID) ? RFAL_ISODEP_DID_LEN : 0U);
+    hdrLen += (uint8_t)((gIsoDep.nad != RFAL_ISODEP_NO_NAD) ? RFAL_ISODEP_NAD_LEN : 0U);
+    if( gIsoDep.rxBufInfPos > hdrLen )
+    {
+        gIsoDep.rxBuf       = &gIsoDep.rxBuf[gIsoDep.rxBufInfPos - hdrLen];
+        gIsoDep.rxBufLen   -= (uint16_t)(gIsoDep.rxBufInfPos - hdrLen);
+        gIsoDep.rxBufInfPos = hdrLen;
+    }
+    
     gIsoDep.state = ISODEP_ST_PCD_TX;
+    
+#if RFAL_FEATURE_ISO_DEP_POLL
+    /* In between commands a degraded link is first stepped down, the I-Block follows on GetTransceiveStatus */
+    if( isNewCmd && isoDepBRStepDownStart() )
+    {
+        gIsoDep.state = ISODEP_ST_PCD_BR_TX;
+    }
+#endif /* RFAL_FEATURE_ISO_DEP_POLL */
+    
     return ERR_NONE;
 }
 
@@ -1532,7 +1714,7 @@ static ReturnCode isoDepDataExchangePICC( void )
                 case ERR_FRAMING:
                     
                     /* Digital 1.1 - 15.2.6.2  The CE SHALL NOT attempt error recovery and remains in Rx mode upon Transmission or a Protocol Error */                                        
-                    isoDepReEnableRx( (uint8_t*)gIsoDep.rxBuf, sizeof( rfalIsoDepBufFormat ), gIsoDep.rxLen );
+                    isoDepReEnableRx( gIsoDep.rxBuf, gIsoDep.rxBufLen, gIsoDep.rxLen );
                     
                     return ERR_BUSY;
                     
@@ -1704,7 +1886,7 @@ static ReturnCode isoDepDataExchangePICC( void )
                 if( !gIsoDep.isTxChaining )
                 {
                     /* Rule 13 violation R(ACK) without performing chaining */
-                    isoDepReEnableRx( (uint8_t*)gIsoDep.rxBuf, sizeof( rfalIsoDepBufFormat ), gIsoDep.rxLen );
+                    isoDepReEnableRx( gIsoDep.rxBuf, gIsoDep.rxBufLen, gIsoDep.rxLen );
                     return ERR_BUSY;
                 }
                 
@@ -1770,7 +1952,7 @@ static ReturnCode isoDepDataExchangePICC( void )
             isoDep_ToggleBN( gIsoDep.blockNumber );
             
             /* ISO 14443-4 7.5.6.2 & Digital 1.1 - 15.2.6.2  The CE SHALL NOT attempt error recovery and remains in Rx mode upon Transmission or a Protocol Error */                                  
-            isoDepReEnableRx( (uint8_t*)gIsoDep.rxBuf, sizeof( rfalIsoDepBufFormat ), gIsoDep.rxLen );
+            isoDepReEnableRx( gIsoDep.rxBuf, gIsoDep.rxBufLen, gIsoDep.rxLen );
             return ERR_BUSY;
         }
         
@@ -1780,8 +1962,6 @@ static ReturnCode isoDepDataExchangePICC( void )
         {
             gIsoDep.isRxChaining  = true;
             *gIsoDep.rxChaining   = true; /* Output Parameter*/            
-                        
-            EXIT_ON_ERR( ret, isoDepHandleControlMsg( ISODEP_R_ACK, RFAL_ISODEP_NO_PARAM ) );
                             
             /* Received I-Block with chaining, send current data to DH */
             
@@ -1791,6 +1971,15 @@ static ReturnCode isoDepDataExchangePICC( void )
             {
                 ST_MEMMOVE( &gIsoDep.rxBuf[gIsoDep.rxBufInfPos], &gIsoDep.rxBuf[gIsoDep.hdrLen], *gIsoDep.rxLen );
             }
+            
+            /* Place the next block after this one before acknowledging it */
+            if( gIsoDep.isRxInPlace )
+            {
+                isoDepRxInPlaceRestore();
+                isoDepRxInPlaceNext( *gIsoDep.rxLen );
+            }
+            
+            EXIT_ON_ERR( ret, isoDepHandleControlMsg( ISODEP_R_ACK, RFAL_ISODEP_NO_PARAM ) );
             return ERR_AGAIN;  /* Send Again signalling to run again, but some chaining data has arrived*/            
         }
         
@@ -1806,6 +1995,7 @@ static ReturnCode isoDepDataExchangePICC( void )
         {
             ST_MEMMOVE( &gIsoDep.rxBuf[gIsoDep.rxBufInfPos], &gIsoDep.rxBuf[gIsoDep.hdrLen], *gIsoDep.rxLen );
         }
+        isoDepRxInPlaceRestore();
         
         
         /*******************************************************************************/
@@ -1822,7 +2012,7 @@ static ReturnCode isoDepDataExchangePICC( void )
     
     /* Unexpected/Unknown Block */
     /* ISO 14443-4 7.5.6.2 & Digital 1.1 - 15.2.6.2  The CE SHALL NOT attempt error recovery and remains in Rx mode upon Transmission or a Protocol Error */
-    isoDepReEnableRx( (uint8_t*)gIsoDep.rxBuf, sizeof( rfalIsoDepBufFormat ), gIsoDep.rxLen );
+    isoDepReEnableRx( gIsoDep.rxBuf, gIsoDep.rxBufLen, gIsoDep.rxLen );
     
     return ERR_BUSY;
 }
@@ -1848,7 +2038,7 @@ ReturnCode rfalIsoDepRATS( rfalIsoDepFSxI FSDI, uint8_t DID, rfalIsoDepAts *ats
     /*******************************************************************************/
     /* Compose RATS */
     ratsReq.CMD   = RFAL_ISODEP_CMD_RATS;
-    ratsReq.PARAM = (((uint8_t)FSDI << RFAL_ISODEP_RATS_PARAM_FSDI_SHIFT) & RFAL_ISODEP_RATS_PARAM_FSDI_MASK) | (DID & RFAL_ISODEP_RATS_PARAM_DID_MASK);
+    ratsReq.PARAM = ((ISODEP_FSDI_LIMIT(FSDI) << RFAL_ISODEP_RATS_PARAM_FSDI_SHIFT) & RFAL_ISODEP_RATS_PARAM_FSDI_MASK) | (DID & RFAL_ISODEP_RATS_PARAM_DID_MASK);
     
     ret = rfalTransceiveBlockingTxRx( (uint8_t*)&ratsReq, sizeof(rfalIsoDepRats), (uint8_t*)ats, sizeof(rfalIsoDepAts), &rcvLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_ISODEP_T4T_FWT_ACTIVATION );
     
@@ -1861,7 +2051,7 @@ ReturnCode rfalIsoDepRATS( rfalIsoDepFSxI FSDI, uint8_t DID, rfalIsoDepAts *ats
         }
         
         /* Assign our FSx, in case the a Deselect is send without Transceive */
-        gIsoDep.ourFsx = rfalIsoDepFSxI2FSx( (uint8_t)FSDI );
+        gIsoDep.ourFsx = rfalIsoDepFSxI2FSx( ISODEP_FSDI_LIMIT(FSDI) );
     }
     
     /* Check and assign if ATS length was requested (length also available on TL) */
@@ -1927,7 +2117,7 @@ ReturnCode rfalIsoDepATTRIB( const uint8_t* nfcid0, uint8_t PARAM1, rfalBitRate
     /* Compose ATTRIB command */
     attribCmd.cmd          = RFAL_ISODEP_CMD_ATTRIB;
     attribCmd.Param.PARAM1 = PARAM1;
-    attribCmd.Param.PARAM2 = ( ((((uint8_t)DSI<<RFAL_ISODEP_ATTRIB_PARAM2_DSI_SHIFT) | ((uint8_t)DRI<<RFAL_ISODEP_ATTRIB_PARAM2_DRI_SHIFT)) & RFAL_ISODEP_ATTRIB_PARAM2_DXI_MASK) | ((uint8_t)FSDI & RFAL_ISODEP_ATTRIB_PARAM2_FSDI_MASK) );
+    attribCmd.Param.PARAM2 = ( ((((uint8_t)DSI<<RFAL_ISODEP_ATTRIB_PARAM2_DSI_SHIFT) | ((uint8_t)DRI<<RFAL_ISODEP_ATTRIB_PARAM2_DRI_SHIFT)) & RFAL_ISODEP_ATTRIB_PARAM2_DXI_MASK) | (ISODEP_FSDI_LIMIT(FSDI) & RFAL_ISODEP_ATTRIB_PARAM2_FSDI_MASK) );
     attribCmd.Param.PARAM3 = PARAM3;
     attribCmd.Param.PARAM4 = (DID & RFAL_ISODEP_ATTRIB_PARAM4_DID_MASK);
     ST_MEMCPY(attribCmd.nfcid0, nfcid0, RFAL_NFCB_NFCID0_LEN);
@@ -1972,6 +2162,11 @@ ReturnCode rfalIsoDepPollAHandleActivation( rfalIsoDepFSxI FSDI, uint8_t DID, rf
         return ERR_PARAM;
     }
     
+    /* A new device starts at the activation bit rate and without learned response times */
+    gIsoDep.brErrLvl = 0;
+    gIsoDep.brDev    = NULL;
+    gIsoDep.rtProf   = NULL;
+    
     /* Enable EMD handling according   Digital 1.1  4.1.1.1 ; EMVCo 2.6  4.9.2 */
     rfalSetErrorHandling( RFAL_ERRORHANDLING_EMVCO );
     
@@ -2020,10 +2215,9 @@ ReturnCode rfalIsoDepPollAHandleActivation( rfalIsoDepFSxI FSDI, uint8_t DID, rf
     
     /*******************************************************************************/
     /* Check for ATS optional fields                                               */
+    msgIt = RFAL_ISODEP_ATS_MIN_LEN;
     if( isoDepDev->activation.A.Listener.ATS.TL > RFAL_ISODEP_ATS_MIN_LEN )
     {
-        msgIt = RFAL_ISODEP_ATS_MIN_LEN;
-        
         /* Format byte T0 is optional, if present assign FSDI */
         isoDepDev->info.FSxI = (isoDepDev->activation.A.Listener.ATS.T0 & RFAL_ISODEP_ATS_T0_FSCI_MASK);
         
@@ -2055,6 +2249,10 @@ ReturnCode rfalIsoDepPollAHandleActivation( rfalIsoDepFSxI FSDI, uint8_t DID, rf
         }
     }
     
+    /* Historical bytes follow the interface bytes up to TL */
+    msgIt = MIN( msgIt, isoDepDev->activation.A.Listener.ATS.TL );
+    isoDepDev->info.HBKey = rfalCrcCalculateCcitt( ISODEP_HBKEY_PRELOAD, &((uint8_t*)&isoDepDev->activation.A.Listener.ATS)[msgIt], ((uint16_t)isoDepDev->activation.A.Listener.ATS.TL - msgIt) );
+    
     isoDepDev->info.FSx  = rfalIsoDepFSxI2FSx(isoDepDev->info.FSxI);
     
     isoDepDev->info.SFGT = rfalIsoDepSFGI2SFGT( (uint8_t)isoDepDev->info.SFGI );
@@ -2092,7 +2290,7 @@ ReturnCode rfalIsoDepPollAHandleActivation( rfalIsoDepFSxI FSDI, uint8_t DID, rf
     /*******************************************************************************/
     /* Store already FS info,  rfalIsoDepGetMaxInfLen() may be called before setting TxRx params */
     gIsoDep.fsx    = isoDepDev->info.FSx;
-    gIsoDep.ourFsx = rfalIsoDepFSxI2FSx( (uint8_t)FSDI );
+    gIsoDep.ourFsx = rfalIsoDepFSxI2FSx( ISODEP_FSDI_LIMIT(FSDI) );
     
     return ERR_NONE;
 }
@@ -2107,6 +2305,11 @@ ReturnCode rfalIsoDepPollBHandleActivation( rfalIsoDepFSxI FSDI, uint8_t DID, rf
     ReturnCode ret;
     uint8_t    mbli;
     
+    /* A new device starts at the activation bit rate and without learned response times */
+    gIsoDep.brErrLvl = 0;
+    gIsoDep.brDev    = NULL;
+    gIsoDep.rtProf   = NULL;
+    
     /***************************************************************************/
     /* Initialize ISO-DEP Device with info from SENSB_RES                      */
     isoDepDev->info.FWI     = ((nfcbDev->sensbRes.protInfo.FwiAdcFo >> RFAL_NFCB_SENSB_RES_FWI_SHIFT) & RFAL_NFCB_SENSB_RES_FWI_MASK);
@@ -2119,6 +2322,7 @@ ReturnCode rfalIsoDepPollBHandleActivation( rfalIsoDepFSxI FSDI, uint8_t DID, rf
     isoDepDev->info.DID     = DID;
     isoDepDev->info.supDID  = ((( nfcbDev->sensbRes.protInfo.FwiAdcFo & RFAL_NFCB_SENSB_RES_FO_DID_MASK ) != 0U) ? true : false);
     isoDepDev->info.supNAD  = ((( nfcbDev->sensbRes.protInfo.FwiAdcFo & RFAL_NFCB_SENSB_RES_FO_NAD_MASK ) != 0U) ? true : false);
+    isoDepDev->info.HBKey   = rfalCrcCalculateCcitt( ISODEP_HBKEY_PRELOAD, (const uint8_t*)&nfcbDev->sensbRes.appData, (uint16_t)sizeof(rfalNfcbSensbResAppData) );
     
     
     /* Check if DID requested is supported by PICC */
@@ -2203,7 +2407,7 @@ ReturnCode rfalIsoDepPollBHandleActivation( rfalIsoDepFSxI FSDI, uint8_t DID, rf
     /*******************************************************************************/
     /* Store already FS info,  rfalIsoDepGetMaxInfLen() may be called before setting TxRx params */
     gIsoDep.fsx    = isoDepDev->info.FSx;
-    gIsoDep.ourFsx = rfalIsoDepFSxI2FSx( (uint8_t)FSDI );
+    gIsoDep.ourFsx = rfalIsoDepFSxI2FSx( ISODEP_FSDI_LIMIT(FSDI) );
     
     return ret;
 }
@@ -2212,48 +2416,42 @@ ReturnCode rfalIsoDepPollBHandleActivation( rfalIsoDepFSxI FSDI, uint8_t DID, rf
 
 
 /*******************************************************************************/
-ReturnCode rfalIsoDepPollHandleSParameters( rfalIsoDepDevice *isoDepDev, rfalBitRate maxTxBR, rfalBitRate maxRxBR )
+static uint16_t isoDepSParamBRReq( rfalIsoDepControlMsgSParam *sParam )
 {
-    uint8_t                    it;
-    uint8_t                    supPCD2PICC;
-    uint8_t                    supPICC2PCD;
-    uint8_t                    currenttxBR;
-    uint8_t                    currentrxBR; 
-    rfalBitRate                txBR;
-    rfalBitRate                rxBR;
-    uint16_t                   rcvLen;
-    ReturnCode                 ret;
-    rfalIsoDepControlMsgSParam sParam;
-   
-  
-    if( (isoDepDev == NULL) || (maxTxBR > RFAL_BR_13560) || (maxRxBR > RFAL_BR_13560) )
-    {
-        return ERR_PARAM;
-    }
+    uint8_t it;
     
-    it          = 0;
-    supPICC2PCD = 0x00;
-    supPCD2PICC = 0x00;
-    txBR        = RFAL_BR_106;
-    rxBR        = RFAL_BR_106;
-    sParam.pcb  = ISODEP_PCB_SPARAMETERS;
+    it = 0;
     
     /*******************************************************************************/
-    /* Send S(PARAMETERS) - Block Info */
-    sParam.sParam.tag         = RFAL_ISODEP_SPARAM_TAG_BLOCKINFO;
-    sParam.sParam.value[it++] = RFAL_ISODEP_SPARAM_TAG_BRREQ;
-    sParam.sParam.value[it++] = RFAL_ISODEP_SPARAM_TAG_BRREQ_LEN;
-    sParam.sParam.length      = it;
-    
-    EXIT_ON_ERR( ret, rfalTransceiveBlockingTxRx( (uint8_t*)&sParam, (RFAL_ISODEP_SPARAM_HDR_LEN + (uint16_t)it), (uint8_t*)&sParam, sizeof(rfalIsoDepControlMsgSParam), &rcvLen, RFAL_TXRX_FLAGS_DEFAULT, (isoDepDev->info.FWT + isoDepDev->info.dFWT) ));
+    /* S(PARAMETERS) - Block Info: Bit rates Request */
+    sParam->pcb                = ISODEP_PCB_SPARAMETERS;
+    sParam->sParam.tag         = RFAL_ISODEP_SPARAM_TAG_BLOCKINFO;
+    sParam->sParam.value[it++] = RFAL_ISODEP_SPARAM_TAG_BRREQ;
+    sParam->sParam.value[it++] = RFAL_ISODEP_SPARAM_TAG_BRREQ_LEN;
+    sParam->sParam.length      = it;
+    
+    return (RFAL_ISODEP_SPARAM_HDR_LEN + (uint16_t)it);
+}
+
+
+/*******************************************************************************/
+static ReturnCode isoDepSParamBRInd( const rfalIsoDepControlMsgSParam *sParam, uint16_t rcvLen, rfalBitRate maxTxBR, rfalBitRate maxRxBR, rfalBitRate *txBR, rfalBitRate *rxBR )
+{
+    uint8_t it;
+    uint8_t supPCD2PICC;
+    uint8_t supPICC2PCD;
     
-    it = 0;
+    it          = 0;
+    supPICC2PCD = 0x00;
+    supPCD2PICC = 0x00;
+    *txBR       = RFAL_BR_106;
+    *rxBR       = RFAL_BR_106;
     
     /*******************************************************************************/
     /* Check S(PARAMETERS) response */
-    if( (sParam.pcb != ISODEP_PCB_SPARAMETERS) || (sParam.sParam.tag != RFAL_ISODEP_SPARAM_TAG_BLOCKINFO)  || 
-        (sParam.sParam.value[it] != RFAL_ISODEP_SPARAM_TAG_BRIND) || (rcvLen < RFAL_ISODEP_SPARAM_HDR_LEN) || 
-        (rcvLen != ((uint16_t)sParam.sParam.length + RFAL_ISODEP_SPARAM_HDR_LEN))                             )
+    if( (sParam->pcb != ISODEP_PCB_SPARAMETERS) || (sParam->sParam.tag != RFAL_ISODEP_SPARAM_TAG_BLOCKINFO)  || 
+        (sParam->sParam.value[it] != RFAL_ISODEP_SPARAM_TAG_BRIND) || (rcvLen < RFAL_ISODEP_SPARAM_HDR_LEN) || 
+        (rcvLen != ((uint16_t)sParam->sParam.length + RFAL_ISODEP_SPARAM_HDR_LEN))                              )
     {
         return ERR_PROTO;
     }
@@ -2261,14 +2459,14 @@ ReturnCode rfalIsoDepPollHandleSParameters( rfalIsoDepDevice *isoDepDev, rfalBit
     /* Retrieve PICC's bit rate PICC capabilities */
     for( it=0; it<(rcvLen-(uint16_t)RFAL_ISODEP_SPARAM_TAG_LEN); it++ )
     {
-        if( (sParam.sParam.value[it] == RFAL_ISODEP_SPARAM_TAG_SUP_PCD2PICC) && (sParam.sParam.value[it+(uint16_t)RFAL_ISODEP_SPARAM_TAG_LEN] == RFAL_ISODEP_SPARAM_TAG_PCD2PICC_LEN) )
+        if( (sParam->sParam.value[it] == RFAL_ISODEP_SPARAM_TAG_SUP_PCD2PICC) && (sParam->sParam.value[it+(uint16_t)RFAL_ISODEP_SPARAM_TAG_LEN] == RFAL_ISODEP_SPARAM_TAG_PCD2PICC_LEN) )
         {
-            supPCD2PICC = sParam.sParam.value[it + RFAL_ISODEP_SPARAM_TAG_PCD2PICC_LEN];
+            supPCD2PICC = sParam->sParam.value[it + RFAL_ISODEP_SPARAM_TAG_PCD2PICC_LEN];
         }
         
-        if( (sParam.sParam.value[it] == RFAL_ISODEP_SPARAM_TAG_SUP_PICC2PCD) && (sParam.sParam.value[it+(uint16_t)RFAL_ISODEP_SPARAM_TAG_LEN] == RFAL_ISODEP_SPARAM_TAG_PICC2PCD_LEN) )
+        if( (sParam->sParam.value[it] == RFAL_ISODEP_SPARAM_TAG_SUP_PICC2PCD) && (sParam->sParam.value[it+(uint16_t)RFAL_ISODEP_SPARAM_TAG_LEN] == RFAL_ISODEP_SPARAM_TAG_PICC2PCD_LEN) )
         {
-            supPICC2PCD = sParam.sParam.value[it + RFAL_ISODEP_SPARAM_TAG_PICC2PCD_LEN];
+            supPICC2PCD = sParam->sParam.value[it + RFAL_ISODEP_SPARAM_TAG_PICC2PCD_LEN];
         }
     }
     
@@ -2283,44 +2481,57 @@ ReturnCode rfalIsoDepPollHandleSParameters( rfalIsoDepDevice *isoDepDev, rfalBit
     {
         if( (supPCD2PICC & (0x01U << it)) != 0U )
         {
-            txBR = (rfalBitRate)it; /* PRQA S 4342 # MISRA 10.5 - Layout of enum rfalBitRate and above clamping of maxTxBR guarantee no invalid enum values to be created */
+            *txBR = (rfalBitRate)it; /* PRQA S 4342 # MISRA 10.5 - Layout of enum rfalBitRate and above clamping of maxTxBR guarantee no invalid enum values to be created */
         }
     }
     for( it=0; it<=(uint8_t)maxRxBR; it++ )
     {
         if( (supPICC2PCD & (0x01U << it)) != 0U )
         {
-            rxBR = (rfalBitRate)it; /* PRQA S 4342 # MISRA 10.5 - Layout of enum rfalBitRate and above clamping of maxTxBR guarantee no invalid enum values to be created */
+            *rxBR = (rfalBitRate)it; /* PRQA S 4342 # MISRA 10.5 - Layout of enum rfalBitRate and above clamping of maxTxBR guarantee no invalid enum values to be created */
         }
     }
     
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+static uint16_t isoDepSParamBRAct( rfalIsoDepControlMsgSParam *sParam, rfalBitRate txBR, rfalBitRate rxBR )
+{
+    uint8_t it;
+    
     it = 0;
-    currenttxBR = (uint8_t)txBR;
-    currentrxBR = (uint8_t)rxBR;
     
     /*******************************************************************************/
-    /* Send S(PARAMETERS) - Bit rates Activation */
-    sParam.sParam.tag         = RFAL_ISODEP_SPARAM_TAG_BLOCKINFO;
-    sParam.sParam.value[it++] = RFAL_ISODEP_SPARAM_TAG_BRACT;
-    sParam.sParam.value[it++] = ( RFAL_ISODEP_SPARAM_TVL_HDR_LEN + RFAL_ISODEP_SPARAM_TAG_PCD2PICC_LEN + RFAL_ISODEP_SPARAM_TVL_HDR_LEN + RFAL_ISODEP_SPARAM_TAG_PICC2PCD_LEN);
-    sParam.sParam.value[it++] = RFAL_ISODEP_SPARAM_TAG_SEL_PCD2PICC;
-    sParam.sParam.value[it++] = RFAL_ISODEP_SPARAM_TAG_PCD2PICC_LEN;
-    sParam.sParam.value[it++] = ((uint8_t)0x01U << currenttxBR);
-    sParam.sParam.value[it++] = 0x00U;
-    sParam.sParam.value[it++] = RFAL_ISODEP_SPARAM_TAG_SEL_PICC2PCD;
-    sParam.sParam.value[it++] = RFAL_ISODEP_SPARAM_TAG_PICC2PCD_LEN;
-    sParam.sParam.value[it++] = ((uint8_t)0x01U << currentrxBR);
-    sParam.sParam.value[it++] = 0x00U;
-    sParam.sParam.length      = it;
-    
-    EXIT_ON_ERR( ret, rfalTransceiveBlockingTxRx( (uint8_t*)&sParam, (RFAL_ISODEP_SPARAM_HDR_LEN + (uint16_t)it), (uint8_t*)&sParam, sizeof(rfalIsoDepControlMsgSParam), &rcvLen, RFAL_TXRX_FLAGS_DEFAULT, (isoDepDev->info.FWT + isoDepDev->info.dFWT) ));
-    
-    it = 0;
+    /* S(PARAMETERS) - Bit rates Activation */
+    sParam->pcb                = ISODEP_PCB_SPARAMETERS;
+    sParam->sParam.tag         = RFAL_ISODEP_SPARAM_TAG_BLOCKINFO;
+    sParam->sParam.value[it++] = RFAL_ISODEP_SPARAM_TAG_BRACT;
+    sParam->sParam.value[it++] = ( RFAL_ISODEP_SPARAM_TVL_HDR_LEN + RFAL_ISODEP_SPARAM_TAG_PCD2PICC_LEN + RFAL_ISODEP_SPARAM_TVL_HDR_LEN + RFAL_ISODEP_SPARAM_TAG_PICC2PCD_LEN);
+    sParam->sParam.value[it++] = RFAL_ISODEP_SPARAM_TAG_SEL_PCD2PICC;
+    sParam->sParam.value[it++] = RFAL_ISODEP_SPARAM_TAG_PCD2PICC_LEN;
+    sParam->sParam.value[it++] = ((uint8_t)0x01U << (uint8_t)txBR);
+    sParam->sParam.value[it++] = 0x00U;
+    sParam->sParam.value[it++] = RFAL_ISODEP_SPARAM_TAG_SEL_PICC2PCD;
+    sParam->sParam.value[it++] = RFAL_ISODEP_SPARAM_TAG_PICC2PCD_LEN;
+    sParam->sParam.value[it++] = ((uint8_t)0x01U << (uint8_t)rxBR);
+    sParam->sParam.value[it++] = 0x00U;
+    sParam->sParam.length      = it;
+    
+    return (RFAL_ISODEP_SPARAM_HDR_LEN + (uint16_t)it);
+}
+
+
+/*******************************************************************************/
+static ReturnCode isoDepSParamBRAck( rfalIsoDepDevice *isoDepDev, const rfalIsoDepControlMsgSParam *sParam, uint16_t rcvLen, rfalBitRate txBR, rfalBitRate rxBR )
+{
+    ReturnCode ret;
     
     /*******************************************************************************/
     /* Check S(PARAMETERS) Acknowledge  */
-    if( (sParam.pcb != ISODEP_PCB_SPARAMETERS) || (sParam.sParam.tag != RFAL_ISODEP_SPARAM_TAG_BLOCKINFO)  || 
-        (sParam.sParam.value[it] != RFAL_ISODEP_SPARAM_TAG_BRACK) || (rcvLen < RFAL_ISODEP_SPARAM_HDR_LEN)   )
+    if( (sParam->pcb != ISODEP_PCB_SPARAMETERS) || (sParam->sParam.tag != RFAL_ISODEP_SPARAM_TAG_BLOCKINFO)  || 
+        (sParam->sParam.value[0] != RFAL_ISODEP_SPARAM_TAG_BRACK) || (rcvLen < RFAL_ISODEP_SPARAM_HDR_LEN)   )
     {
         return ERR_PROTO;
     }
@@ -2330,10 +2541,498 @@ ReturnCode rfalIsoDepPollHandleSParameters( rfalIsoDepDevice *isoDepDev, rfalBit
     isoDepDev->info.DRI = txBR;
     isoDepDev->info.DSI = rxBR;
     
+    /* The new bit rate starts being monitored afresh, S(PARAMETERS) may step it down later in the session */
+    gIsoDep.brDev    = isoDepDev;
+    gIsoDep.brErrLvl = 0;
+    
     return ERR_NONE;
 }
 
 
+/*******************************************************************************/
+ReturnCode rfalIsoDepPollHandleSParameters( rfalIsoDepDevice *isoDepDev, rfalBitRate maxTxBR, rfalBitRate maxRxBR )
+{
+    rfalBitRate                txBR;
+    rfalBitRate                rxBR;
+    uint16_t                   txLen;
+    uint16_t                   rcvLen;
+    ReturnCode                 ret;
+    rfalIsoDepControlMsgSParam sParam;
+   
+  
+    if( (isoDepDev == NULL) || (maxTxBR > RFAL_BR_13560) || (maxRxBR > RFAL_BR_13560) )
+    {
+        return ERR_PARAM;
+    }
+    
+    /*******************************************************************************/
+    /* Send S(PARAMETERS) - Block Info */
+    txLen = isoDepSParamBRReq( &sParam );
+    EXIT_ON_ERR( ret, rfalTransceiveBlockingTxRx( (uint8_t*)&sParam, txLen, (uint8_t*)&sParam, sizeof(rfalIsoDepControlMsgSParam), &rcvLen, RFAL_TXRX_FLAGS_DEFAULT, (isoDepDev->info.FWT + isoDepDev->info.dFWT) ));
+    
+    EXIT_ON_ERR( ret, isoDepSParamBRInd( &sParam, rcvLen, maxTxBR, maxRxBR, &txBR, &rxBR ) );
+    
+    /*******************************************************************************/
+    /* Send S(PARAMETERS) - Bit rates Activation */
+    txLen = isoDepSParamBRAct( &sParam, txBR, rxBR );
+    EXIT_ON_ERR( ret, rfalTransceiveBlockingTxRx( (uint8_t*)&sParam, txLen, (uint8_t*)&sParam, sizeof(rfalIsoDepControlMsgSParam), &rcvLen, RFAL_TXRX_FLAGS_DEFAULT, (isoDepDev->info.FWT + isoDepDev->info.dFWT) ));
+    
+    return isoDepSParamBRAck( isoDepDev, &sParam, rcvLen, txBR, rxBR );
+}
+
+
+/*******************************************************************************/
+static bool isoDepBRStepDownStart( void )
+{
+    /* Only a bit rate set by S(PARAMETERS) is known to be renegotiable within the session */
+    if( (gIsoDep.role != ISODEP_ROLE_PCD) || (gIsoDep.brDev == NULL) || (gIsoDep.brErrLvl < ISODEP_BR_ERR_LEVEL) )
+    {
+        return false;
+    }
+    
+    if( MAX( gIsoDep.brDev->info.DRI, gIsoDep.brDev->info.DSI ) == RFAL_BR_106 )
+    {
+        return false;
+    }
+    
+    gIsoDep.ctrlRxLen = isoDepSParamBRReq( &gIsoDep.brMsg );
+    gIsoDep.isBrAct   = false;
+    return true;
+}
+
+
+/*******************************************************************************/
+static ReturnCode isoDepBRStepDown( void )
+{
+    ReturnCode  ret;
+    uint8_t     maxBR;
+    
+    /* ctrlRxLen holds the length to be sent on Tx and the one received on Rx */
+    if( gIsoDep.state == ISODEP_ST_PCD_BR_TX )
+    {
+        EXIT_ON_ERR( ret, rfalTransceiveBlockingTx( (uint8_t*)&gIsoDep.brMsg, gIsoDep.ctrlRxLen, (uint8_t*)&gIsoDep.brMsg, sizeof(rfalIsoDepControlMsgSParam), &gIsoDep.ctrlRxLen, RFAL_TXRX_FLAGS_DEFAULT, (gIsoDep.brDev->info.FWT + gIsoDep.brDev->info.dFWT) ) );
+        gIsoDep.state = ISODEP_ST_PCD_BR_RX;
+    }
+    
+    ret = rfalGetTransceiveStatus();
+    if( ret == ERR_BUSY )
+    {
+        return ERR_BUSY;
+    }
+    
+    if( ret == ERR_NONE )
+    {
+        gIsoDep.ctrlRxLen = rfalConvBitsToBytes( gIsoDep.ctrlRxLen );
+        
+        if( !gIsoDep.isBrAct )
+        {
+            /* Step one bit rate down: the highest one supported by the PICC below the current */
+            maxBR = ((uint8_t)MAX( gIsoDep.brDev->info.DRI, gIsoDep.brDev->info.DSI ) - 1U);
+            
+            ret = isoDepSParamBRInd( &gIsoDep.brMsg, gIsoDep.ctrlRxLen, (rfalBitRate)MIN( (uint8_t)gIsoDep.brDev->info.DRI, maxBR ), (rfalBitRate)MIN( (uint8_t)gIsoDep.brDev->info.DSI, maxBR ), &gIsoDep.brTxSel, &gIsoDep.brRxSel ); /* PRQA S 4342 # MISRA 10.5 - Layout of enum rfalBitRate and above check guarantee no invalid enum values to be created */
+            if( ret == ERR_NONE )
+            {
+                gIsoDep.ctrlRxLen = isoDepSParamBRAct( &gIsoDep.brMsg, gIsoDep.brTxSel, gIsoDep.brRxSel );
+                gIsoDep.isBrAct   = true;
+                gIsoDep.state     = ISODEP_ST_PCD_BR_TX;
+                return ERR_BUSY;
+            }
+        }
+        else
+        {
+            ret = isoDepSParamBRAck( gIsoDep.brDev, &gIsoDep.brMsg, gIsoDep.ctrlRxLen, gIsoDep.brTxSel, gIsoDep.brRxSel );
+        }
+    }
+    
+    /* The renegotiation is not retried: the bit rate is kept and the link remains reported degraded */
+    if( ret != ERR_NONE )
+    {
+        gIsoDep.brDev = NULL;
+    }
+    
+    /* Proceed with the I-Block of the command */
+    gIsoDep.state = ISODEP_ST_PCD_TX;
+    return ERR_BUSY;
+}
+
+
+/*******************************************************************************/
+bool rfalIsoDepPollIsBitRateDegraded( void )
+{
+    return ( (gIsoDep.role == ISODEP_ROLE_PCD) && (gIsoDep.brErrLvl >= ISODEP_BR_ERR_LEVEL) );
+}
+
+
+#if RFAL_FEATURE_NFCA
+
+/*******************************************************************************/
+ReturnCode rfalIsoDepPollASessionActivate( rfalIsoDepFSxI FSDI, uint8_t DID, rfalBitRate maxBR, const rfalNfcaListenDevice *nfcaDev, rfalIsoDepDevice *isoDepDev, rfalIsoDepSession *session )
+{
+    ReturnCode      ret;
+    rfalNfcaSensRes sensRes;
+    rfalNfcaSelRes  selRes;
+    bool            isNoDidActive;
+    
+    /* DID 0 would also address a card not supporting DID */
+    if( (nfcaDev == NULL) || (isoDepDev == NULL) || (session == NULL) || (DID == RFAL_ISODEP_DID_00) || (DID > RFAL_ISODEP_DID_MAX) )
+    {
+        return ERR_PARAM;
+    }
+    
+    /* Cards are selected at 106 kbps, a previous PPS may have changed the bit rate */
+    EXIT_ON_ERR( ret, rfalSetBitRate( RFAL_BR_106, RFAL_BR_106 ) );
+    
+    /* Wake up the halted cards and select this one, the ones in protocol state ignore both */
+    ret = rfalNfcaPollerCheckPresence( RFAL_14443A_SHORTFRAME_CMD_WUPA, &sensRes );
+    if( (ret != ERR_NONE) && (ret != ERR_RF_COLLISION) )
+    {
+        return ret;
+    }
+    
+    EXIT_ON_ERR( ret, rfalNfcaPollerSelect( nfcaDev->nfcId1, nfcaDev->nfcId1Len, &selRes ) );
+    
+    if( !rfalNfcaIsSelResT4T( &selRes ) && !rfalNfcaIsSelResT4TNFCDEP( &selRes ) )
+    {
+        return ERR_PROTO;
+    }
+    
+    /* The protocol of each card starts with block number 0 */
+    gIsoDep.role         = ISODEP_ROLE_PCD;
+    gIsoDep.state        = ISODEP_ST_IDLE;
+    gIsoDep.blockNumber  = 0;
+    gIsoDep.lastPCB      = ISODEP_PCB_INVALID;
+    gIsoDep.lastDID00    = false;
+    gIsoDep.isTxChaining = false;
+    gIsoDep.isRxChaining = false;
+    isNoDidActive        = gIsoDep.isNoDidActive;
+    
+    EXIT_ON_ERR( ret, rfalIsoDepPollAHandleActivation( FSDI, DID, maxBR, isoDepDev ) );
+    
+    /* Two cards not supporting DID would both take every block, only one such session may exist */
+    if( isoDepDev->info.DID == RFAL_ISODEP_NO_DID )
+    {
+        if( isNoDidActive )
+        {
+            return ERR_PARAM;
+        }
+        gIsoDep.isNoDidActive = true;
+    }
+    
+    gIsoDep.did        = isoDepDev->info.DID;
+    session->isoDepDev = isoDepDev;
+    
+    return rfalIsoDepSessionSave( session );
+}
+
+#endif /* RFAL_FEATURE_NFCA */
+
+
+/*******************************************************************************/
+ReturnCode rfalIsoDepSessionSave( rfalIsoDepSession *session )
+{
+    if( (session == NULL) || (session->isoDepDev == NULL) )
+    {
+        return ERR_PARAM;
+    }
+    
+    if( (gIsoDep.role != ISODEP_ROLE_PCD) || gIsoDep.isTxChaining || gIsoDep.isRxChaining )
+    {
+        return ERR_WRONG_STATE;
+    }
+    
+    session->blockNumber = gIsoDep.blockNumber;
+    session->ourFsx      = gIsoDep.ourFsx;
+    session->brErrLvl    = gIsoDep.brErrLvl;
+    session->isBrSParam  = (gIsoDep.brDev == session->isoDepDev);
+    session->rtProfile   = gIsoDep.rtProf;
+    
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalIsoDepSessionRestore( const rfalIsoDepSession *session )
+{
+    ReturnCode        ret;
+    rfalBitRate       txBR;
+    rfalBitRate       rxBR;
+    rfalIsoDepDevice *dev;
+    
+    if( (session == NULL) || (session->isoDepDev == NULL) )
+    {
+        return ERR_PARAM;
+    }
+    
+    /* A chain left open by the previous card's failed exchange is abandoned */
+    if( gIsoDep.role != ISODEP_ROLE_PCD )
+    {
+        return ERR_WRONG_STATE;
+    }
+    
+    dev = session->isoDepDev;
+    
+    /* Cards may run at different bit rates, only reconfigure on a change */
+    EXIT_ON_ERR( ret, rfalGetBitRate( &txBR, &rxBR ) );
+    if( (txBR != dev->info.DRI) || (rxBR != dev->info.DSI) )
+    {
+        EXIT_ON_ERR( ret, rfalSetBitRate( dev->info.DRI, dev->info.DSI ) );
+    }
+    
+    gIsoDep.state       = ISODEP_ST_IDLE;
+    gIsoDep.blockNumber = session->blockNumber;
+    gIsoDep.ourFsx      = session->ourFsx;
+    gIsoDep.did         = dev->info.DID;
+    gIsoDep.fsx         = dev->info.FSx;
+    gIsoDep.fwt         = dev->info.FWT;
+    gIsoDep.dFwt        = dev->info.dFWT;
+    gIsoDep.lastPCB     = ISODEP_PCB_INVALID;
+    gIsoDep.lastDID00   = false;
+    gIsoDep.isTxChaining = false;
+    gIsoDep.isRxChaining = false;
+    
+    gIsoDep.hdrLen      = RFAL_ISODEP_PCB_LEN;
+    gIsoDep.hdrLen     += (uint8_t)((gIsoDep.did != RFAL_ISODEP_NO_DID) ? RFAL_ISODEP_DID_LEN : 0U);
+    gIsoDep.hdrLen     += (uint8_t)((gIsoDep.nad != RFAL_ISODEP_NO_NAD) ? RFAL_ISODEP_NAD_LEN : 0U);
+    
+    gIsoDep.brErrLvl    = session->brErrLvl;
+    gIsoDep.brDev       = ((session->isBrSParam) ? dev : NULL);
+    gIsoDep.rtProf      = session->rtProfile;
+    gIsoDep.isRtIns     = false;
+    gIsoDep.isRtPending = false;
+    
+    /* Buffers belong to the previous card's exchange, a Deselect shall not use them */
+    gIsoDep.rxLen       = NULL;
+    gIsoDep.rxBuf       = NULL;
+    
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+rfalIsoDepRtProfile* rfalIsoDepRtProfileFind( rfalIsoDepRtProfile *profiles, uint8_t profilesCnt, const rfalIsoDepDevice *isoDepDev )
+{
+    rfalIsoDepRtProfile *prof;
+    uint32_t             trained;
+    uint32_t             minTrained;
+    uint8_t              i;
+    uint8_t              j;
+    
+    if( (profiles == NULL) || (profilesCnt == 0U) || (isoDepDev == NULL) )
+    {
+        return NULL;
+    }
+    
+    prof       = &profiles[0];
+    minTrained = 0xFFFFFFFFU;
+    
+    for( i = 0; i < profilesCnt; i++ )
+    {
+        trained = profiles[i].ctrlSamples;
+        for( j = 0; j < RFAL_ISODEP_RT_INS_NUM; j++ )
+        {
+            trained += ((uint32_t)profiles[i].ins[j].samples + profiles[i].ins[j].wtxSamples);
+        }
+        
+        if( (trained != 0U) && (profiles[i].HBKey == isoDepDev->info.HBKey) )
+        {
+            return &profiles[i];
+        }
+        
+        if( trained < minTrained )
+        {
+            minTrained = trained;
+            prof       = &profiles[i];
+        }
+    }
+    
+    /* Unknown card type: take over the least trained profile */
+    ST_MEMSET( prof, 0x00, sizeof(rfalIsoDepRtProfile) );
+    prof->HBKey = isoDepDev->info.HBKey;
+    
+    return prof;
+}
+
+
+/*******************************************************************************/
+void rfalIsoDepSetRtProfile( rfalIsoDepRtProfile *profile )
+{
+    gIsoDep.rtProf      = profile;
+    gIsoDep.isRtPending = false;
+}
+
+
+/*******************************************************************************/
+static uint8_t isoDepRtLenClass( const uint8_t *apdu, uint16_t apduLen )
+{
+    uint32_t dataLen;
+    uint32_t classLen;
+    uint8_t  lenClass;
+    
+    /* Data moved by the command: Lc or Le on P3, extended length after a P3 of 0 */
+    if( apduLen <= 4U )
+    {
+        dataLen = 0;
+    }
+    else if( apdu[4] != 0U )
+    {
+        dataLen = apdu[4];
+    }
+    else if( apduLen >= 7U )
+    {
+        dataLen = ((((uint32_t)apdu[5] << 8U) | apdu[6]) != 0U) ? (((uint32_t)apdu[5] << 8U) | apdu[6]) : 65536U;
+    }
+    else
+    {
+        dataLen = 256U;
+    }
+    
+    lenClass = 0;
+    classLen = ISODEP_RT_LEN_CLASS_MIN;
+    while( (dataLen > classLen) && (lenClass < ISODEP_RT_LEN_CLASS_MAX) )
+    {
+        classLen <<= 2U;
+        lenClass++;
+    }
+    
+    return lenClass;
+}
+
+
+/*******************************************************************************/
+static rfalIsoDepRtIns* isoDepRtGetIns( uint8_t ins, uint8_t lenClass, bool add )
+{
+    rfalIsoDepRtIns *entry;
+    uint8_t          i;
+    
+    for( i = 0; i < RFAL_ISODEP_RT_INS_NUM; i++ )
+    {
+        entry = &gIsoDep.rtProf->ins[i];
+        if( ((entry->samples != 0U) || (entry->wtxSamples != 0U)) && (entry->INS == ins) && (entry->lenClass == lenClass) )
+        {
+            return entry;
+        }
+    }
+    
+    if( !add )
+    {
+        return NULL;
+    }
+    
+    /* Not yet known, replace the entries round robin */
+    entry = &gIsoDep.rtProf->ins[gIsoDep.rtProf->insNext];
+    gIsoDep.rtProf->insNext = (uint8_t)((gIsoDep.rtProf->insNext + 1U) % RFAL_ISODEP_RT_INS_NUM);
+    
+    entry->INS        = ins;
+    entry->lenClass   = lenClass;
+    entry->samples    = 0;
+    entry->rtMax      = 0;
+    entry->wtxSamples = 0;
+    entry->wtxRtMax   = 0;
+    
+    return entry;
+}
+
+
+/*******************************************************************************/
+static uint32_t isoDepRtFwt( uint32_t fwt, uint16_t rtMax, uint8_t samples )
+{
+    /* Once the actual response time is known, never wait longer than a margin above it */
+    if( samples >= ISODEP_RT_MIN_SAMPLES )
+    {
+        return MIN( fwt, rfalConvMsTo1fc( ((uint32_t)rtMax * ISODEP_RT_MARGIN) + ISODEP_RT_FLOOR_MS ) );
+    }
+    
+    return fwt;
+}
+
+
+/*******************************************************************************/
+static uint32_t isoDepRtIBlockFwt( void )
+{
+    const rfalIsoDepRtIns *ins;
+    
+    /* Chained blocks are acknowledged after the card stored them, only the command's last block is adapted */
+    if( (gIsoDep.rtProf == NULL) || gIsoDep.isTxChaining || !gIsoDep.isRtIns )
+    {
+        return (gIsoDep.fwt + gIsoDep.dFwt);
+    }
+    
+    ins = isoDepRtGetIns( gIsoDep.rtIns, gIsoDep.rtLenClass, false );
+    
+    return ((ins != NULL) ? isoDepRtFwt( (gIsoDep.fwt + gIsoDep.dFwt), ins->rtMax, ins->samples ) : (gIsoDep.fwt + gIsoDep.dFwt));
+}
+
+
+/*******************************************************************************/
+static uint32_t isoDepRtWtxFwt( uint32_t fwt )
+{
+    const rfalIsoDepRtIns *ins;
+    
+    if( (gIsoDep.rtProf == NULL) || !gIsoDep.isRtIns )
+    {
+        return fwt;
+    }
+    
+    ins = isoDepRtGetIns( gIsoDep.rtIns, gIsoDep.rtLenClass, false );
+    
+    return ((ins != NULL) ? isoDepRtFwt( fwt, ins->wtxRtMax, ins->wtxSamples ) : fwt);
+}
+
+
+/*******************************************************************************/
+static void isoDepRtLearn( uint8_t rxPCB )
+{
+    rfalIsoDepRtIns *ins;
+    uint32_t         rt;
+    
+    if( gIsoDep.rtProf == NULL )
+    {
+        return;
+    }
+    
+    /* Command's first response: its I-Block, or its S(WTX) request */
+    if( gIsoDep.isRtPending && (isoDep_PCBisIBlock( rxPCB ) || isoDep_PCBisSWTX( rxPCB )) )
+    {
+        gIsoDep.isRtPending = false;
+        
+        /* After a retransmission the time includes the waits for the lost block, not learned */
+        if( (gIsoDep.cntRRetrys != 0U) || (gIsoDep.cntIRetrys != 0U) )
+        {
+            return;
+        }
+        
+        rt           = MIN( (platformGetSysTick() - gIsoDep.rtCmdTick), 0xFFFFU );
+        ins          = isoDepRtGetIns( gIsoDep.rtIns, gIsoDep.rtLenClass, true );
+        ins->rtMax   = (uint16_t)MAX( ins->rtMax, rt );
+        ins->samples = ((ins->samples < ISODEP_RT_SAMPLES_MAX) ? (ins->samples + 1U) : ins->samples);
+    }
+    /* Response to an R-Block outside of a command's first response */
+    else if( !gIsoDep.isRtPending && isoDep_PCBisRBlock( gIsoDep.lastPCB ) )
+    {
+        rt                          = MIN( (platformGetSysTick() - gIsoDep.rtTick), 0xFFFFU );
+        gIsoDep.rtProf->ctrlRtMax   = (uint16_t)MAX( gIsoDep.rtProf->ctrlRtMax, rt );
+        gIsoDep.rtProf->ctrlSamples = ((gIsoDep.rtProf->ctrlSamples < ISODEP_RT_SAMPLES_MAX) ? (gIsoDep.rtProf->ctrlSamples + 1U) : gIsoDep.rtProf->ctrlSamples);
+    }
+    /* Command's response once its S(WTX) granted: its I-Block, or a further S(WTX) request */
+    else if( gIsoDep.isRtIns && isoDep_PCBisSWTX( gIsoDep.lastPCB ) && (isoDep_PCBisIBlock( rxPCB ) || isoDep_PCBisSWTX( rxPCB )) )
+    {
+        if( (gIsoDep.cntRRetrys != 0U) || (gIsoDep.cntIRetrys != 0U) )
+        {
+            return;
+        }
+        
+        rt              = MIN( (platformGetSysTick() - gIsoDep.rtTick), 0xFFFFU );
+        ins             = isoDepRtGetIns( gIsoDep.rtIns, gIsoDep.rtLenClass, true );
+        ins->wtxRtMax   = (uint16_t)MAX( ins->wtxRtMax, rt );
+        ins->wtxSamples = ((ins->wtxSamples < ISODEP_RT_SAMPLES_MAX) ? (ins->wtxSamples + 1U) : ins->wtxSamples);
+    }
+    else
+    {
+        /* MISRA 15.7 - Empty else */
+    }
+}
+
+
 /*******************************************************************************/
 static void rfalIsoDepCalcBitRate( rfalBitRate maxAllowedBR, uint8_t piccBRCapability, rfalBitRate *dsi, rfalBitRate *dri )
 {
@@ -2437,8 +3136,6 @@ static uint32_t rfalIsoDepSFGI2SFGT( uint8_t sfgi )
  /*******************************************************************************/
  static void rfalIsoDepApdu2IBLockParam( rfalIsoDepApduTxRxParam apduParam, rfalIsoDepTxRxParam *iBlockParam, uint16_t txPos, uint16_t rxPos )
 {
-     NO_WARNING(rxPos); /* Keep this param for future use */
-     
      iBlockParam->DID    = apduParam.DID;
      iBlockParam->FSx    = apduParam.FSx;
      iBlockParam->ourFSx = apduParam.ourFSx;
@@ -2456,9 +3153,10 @@ static uint32_t rfalIsoDepSFGI2SFGT( uint8_t sfgi )
          iBlockParam->txBufLen     = (apduParam.txBufLen - txPos);
      }
      
-     /* TxBuf is moved to the beginning for every I-Block */
-     iBlockParam->txBuf        = (rfalIsoDepBufFormat*)apduParam.txBuf;   /*  PRQA S 0310 # MISRA 11.3 - Intentional safe cast to avoiding large buffer duplication */
-     iBlockParam->rxBuf        = apduParam.tmpBuf;                        /* Simply using the apdu buffer is not possible because of current ACK handling */
+     /* I-Block views over the APDU buffers: the prologue of each view overlays the APDU bytes *
+      * preceding txPos/rxPos, already transmitted or restored once the block is received    */
+     iBlockParam->txBuf        = (rfalIsoDepBufFormat*)&((uint8_t*)apduParam.txBuf)[txPos];   /*  PRQA S 0310 # MISRA 11.3 - Intentional safe cast to avoiding large buffer duplication */
+     iBlockParam->rxBuf        = (rfalIsoDepBufFormat*)&((uint8_t*)apduParam.rxBuf)[rxPos];   /*  PRQA S 0310 # MISRA 11.3 - Intentional safe cast to avoiding large buffer duplication */
      iBlockParam->isRxChaining = &gIsoDep.isAPDURxChaining;
      iBlockParam->rxLen        = apduParam.rxLen;
 }
@@ -2469,6 +3167,11 @@ ReturnCode rfalIsoDepStartApduTransceive( rfalIsoDepApduTxRxParam param )
 {
     rfalIsoDepTxRxParam txRxParam;
     
+    if( (param.txBuf == NULL) || (param.rxBuf == NULL) || (param.rxLen == NULL) || (param.txBufLen > RFAL_FEATURE_ISO_DEP_APDU_MAX_LEN) )
+    {
+        return ERR_PARAM;
+    }
+    
     /* Initialize and store APDU context */
     gIsoDep.APDUParam = param;
     gIsoDep.APDUTxPos = 0;
@@ -2478,10 +3181,20 @@ ReturnCode rfalIsoDepStartApduTransceive( rfalIsoDepApduTxRxParam param )
     gIsoDep.ourFsx = param.ourFSx;
     gIsoDep.fsx    = param.FSx;
     
+    /* As a PCD the header of the first I-Block is known upfront, the INF length must account for the DID already */
+    if( gIsoDep.role != ISODEP_ROLE_PICC )
+    {
+        gIsoDep.did     = param.DID;
+        gIsoDep.hdrLen  = RFAL_ISODEP_PCB_LEN;
+        gIsoDep.hdrLen += (uint8_t)((gIsoDep.did != RFAL_ISODEP_NO_DID) ? RFAL_ISODEP_DID_LEN : 0U);
+        gIsoDep.hdrLen += (uint8_t)((gIsoDep.nad != RFAL_ISODEP_NO_NAD) ? RFAL_ISODEP_NAD_LEN : 0U);
+    }
+    
     /* Convert APDU TxRxParams to I-Block TxRxParams */
     rfalIsoDepApdu2IBLockParam( gIsoDep.APDUParam, &txRxParam, gIsoDep.APDUTxPos, gIsoDep.APDURxPos );
     
-    return rfalIsoDepStartTransceive( txRxParam );
+    /* The Rx view spans the whole APDU buffer, chained I-Blocks are received in place */
+    return isoDepStartTransceive( txRxParam, (uint16_t)(sizeof(rfalIsoDepApduBufFormat) - gIsoDep.APDURxPos), true );
 }
  
  
@@ -2503,25 +3216,15 @@ ReturnCode rfalIsoDepGetApduTransceiveStatus( void )
                 /* Add already Tx bytes */
                 gIsoDep.APDUTxPos += gIsoDep.txBufLen;
                 
-                /* Convert APDU TxRxParams to I-Block TxRxParams */
+                /* Convert APDU TxRxParams to I-Block TxRxParams, next I-Block is framed in place */
                 rfalIsoDepApdu2IBLockParam( gIsoDep.APDUParam, &txRxParam, gIsoDep.APDUTxPos, gIsoDep.APDURxPos );
                 
-                if( txRxParam.txBufLen > 0U )      /* MISRA 21.18 */
-                {
-                    /* Move next I-Block to beginning of APDU Tx buffer */
-                    ST_MEMCPY( gIsoDep.APDUParam.txBuf->apdu, &gIsoDep.APDUParam.txBuf->apdu[gIsoDep.APDUTxPos], txRxParam.txBufLen );
-                }
-                
-                rfalIsoDepStartTransceive( txRxParam );
+                (void)isoDepStartTransceive( txRxParam, (uint16_t)(sizeof(rfalIsoDepApduBufFormat) - gIsoDep.APDURxPos), true );
                 return ERR_BUSY;
             }
             
-            if( *gIsoDep.APDUParam.rxLen > 0U )    /* MISRA 21.18 */
-            {
-                /* Copy packet from tmp buffer to APDU buffer */
-                ST_MEMCPY( &gIsoDep.APDUParam.rxBuf->apdu[gIsoDep.APDURxPos], gIsoDep.APDUParam.tmpBuf->inf, *gIsoDep.APDUParam.rxLen );
-                gIsoDep.APDURxPos += *gIsoDep.APDUParam.rxLen;
-            }
+            /* Last I-Block has been received in place */
+            gIsoDep.APDURxPos += *gIsoDep.APDUParam.rxLen;
              
             /* APDU TxRx is done */
             break;
@@ -2529,12 +3232,8 @@ ReturnCode rfalIsoDepGetApduTransceiveStatus( void )
         /*******************************************************************************/
         case ERR_AGAIN:
             
-            if( *gIsoDep.APDUParam.rxLen > 0U )    /* MISRA 21.18 */
-            {
-                /* Copy chained packet from tmp buffer to APDU buffer */
-                ST_MEMCPY( &gIsoDep.APDUParam.rxBuf->apdu[gIsoDep.APDURxPos], gIsoDep.APDUParam.tmpBuf->inf, *gIsoDep.APDUParam.rxLen );
-                gIsoDep.APDURxPos += *gIsoDep.APDUParam.rxLen;
-            }
+            /* Chained I-Block has been received in place, the next one follows it */
+            gIsoDep.APDURxPos += *gIsoDep.APDUParam.rxLen;
             
             /* Wait for next I-Block */
             return ERR_BUSY;
@@ -0,0 +1,1261 @@
+
+/******************************************************************************
+  * \attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2019 STMicroelectronics</center></h2>
+  *
+  * Licensed under ST MYLIBERTY SOFTWARE LICENSE AGREEMENT (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        www.st.com/myliberty
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied,
+  * AND SPECIFICALLY DISCLAIMING THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+******************************************************************************/
+
+/*
+ *      PROJECT:   ST25R391x firmware
+ *      Revision:
+ *      LANGUAGE:  ISO C99
+ */
+
+/*! \file rfal_llcp.c
+ *
+ *  \author
+ *
+ *  \brief Implementation of the NFC Forum Logical Link Control Protocol (LLCP)
+ *
+ *  This implementation was based on the following specs:
+ *    - NFC Forum Logical Link Control Protocol 1.1  2011-06-20
+ *
+ */
+
+/*
+ ******************************************************************************
+ * INCLUDES
+ ******************************************************************************
+ */
+#include "rfal_llcp.h"
+#include "utils.h"
+
+/*
+ ******************************************************************************
+ * ENABLE SWITCH
+ ******************************************************************************
+ */
+
+#ifndef RFAL_FEATURE_LLCP
+    #define RFAL_FEATURE_LLCP   false    /* LLCP module configuration missing. Disabled by default */
+#endif
+
+#if RFAL_FEATURE_LLCP
+
+/*
+ ******************************************************************************
+ * GLOBAL DEFINES
+ ******************************************************************************
+ */
+
+#define LLCP_PTYPE_SYMM             0x00U        /*!< Symmetry                                  LLCP 1.1  4.3.1   */
+#define LLCP_PTYPE_PAX              0x01U        /*!< Parameter Exchange                        LLCP 1.1  4.3.2   */
+#define LLCP_PTYPE_AGF              0x02U        /*!< Aggregated Frame                          LLCP 1.1  4.3.3   */
+#define LLCP_PTYPE_UI               0x03U        /*!< Unnumbered Information                    LLCP 1.1  4.3.4   */
+#define LLCP_PTYPE_CONNECT          0x04U        /*!< Connect                                   LLCP 1.1  4.3.5   */
+#define LLCP_PTYPE_DISC             0x05U        /*!< Disconnect                                LLCP 1.1  4.3.6   */
+#define LLCP_PTYPE_CC               0x06U        /*!< Connection Complete                       LLCP 1.1  4.3.7   */
+#define LLCP_PTYPE_DM               0x07U        /*!< Disconnected Mode                         LLCP 1.1  4.3.8   */
+#define LLCP_PTYPE_FRMR             0x08U        /*!< Frame Reject                              LLCP 1.1  4.3.9   */
+#define LLCP_PTYPE_I                0x0CU        /*!< Information                               LLCP 1.1  4.3.10  */
+#define LLCP_PTYPE_RR               0x0DU        /*!< Receive Ready                             LLCP 1.1  4.3.11  */
+#define LLCP_PTYPE_RNR              0x0EU        /*!< Receive Not Ready                         LLCP 1.1  4.3.12  */
+
+#define LLCP_PARAM_VERSION          0x01U        /*!< VERSION parameter                         LLCP 1.1  4.5.1   */
+#define LLCP_PARAM_MIUX             0x02U        /*!< MIUX parameter                            LLCP 1.1  4.5.2   */
+#define LLCP_PARAM_WKS              0x03U        /*!< WKS parameter                             LLCP 1.1  4.5.3   */
+#define LLCP_PARAM_LTO              0x04U        /*!< LTO parameter                             LLCP 1.1  4.5.4   */
+#define LLCP_PARAM_RW               0x05U        /*!< RW parameter                              LLCP 1.1  4.5.5   */
+#define LLCP_PARAM_SN               0x06U        /*!< SN parameter                              LLCP 1.1  4.5.6   */
+#define LLCP_PARAM_OPT              0x07U        /*!< OPT parameter                             LLCP 1.1  4.5.7   */
+
+#define LLCP_MIUX_MASK              0x07FFU      /*!< MIUX value mask (11 bits)                                   */
+#define LLCP_RW_MASK                0x0FU        /*!< RW value mask (4 bits)                                      */
+#define LLCP_SEQ_MASK               0x0FU        /*!< Sequence numbers are modulo 16                              */
+#define LLCP_SAP_MASK               0x3FU        /*!< SAP value mask (6 bits)                                     */
+#define LLCP_SAP_WKS_MAX            0x0FU        /*!< Highest SAP represented on the WKS                          */
+#define LLCP_OPT_LSC_CO             0x02U        /*!< Link Service Class 2: connection-oriented transport         */
+#define LLCP_VERSION_MAJOR_SHIFT    4U           /*!< Major version position on VERSION                           */
+
+#define LLCP_DM_DISC                0x00U        /*!< DM reason: disconnection acknowledged     LLCP 1.1  Table 4 */
+#define LLCP_DM_NO_CONN             0x01U        /*!< DM reason: no active connection                             */
+#define LLCP_DM_NO_SERVICE          0x02U        /*!< DM reason: no service bound to target SAP                   */
+#define LLCP_DM_REJECTED            0x03U        /*!< DM reason: CONNECT rejected by service layer                */
+
+#define LLCP_FRMR_W                 0x80U        /*!< FRMR flag: malformed PDU                  LLCP 1.1  4.3.9   */
+#define LLCP_FRMR_I                 0x40U        /*!< FRMR flag: information field too long                       */
+#define LLCP_FRMR_R                 0x20U        /*!< FRMR flag: invalid N(R)                                     */
+#define LLCP_FRMR_S                 0x10U        /*!< FRMR flag: invalid N(S)                                     */
+#define LLCP_FRMR_INFO_LEN          4U           /*!< FRMR information field length                               */
+
+/*
+ ******************************************************************************
+ * GLOBAL MACROS
+ ******************************************************************************
+ */
+
+#define llcpHdr0( dsap, ptype )     (uint8_t)( ((uint8_t)(dsap) << 2) | ((uint8_t)(ptype) >> 2) )         /*!< First header byte:  DSAP | PTYPE msbs */
+#define llcpHdr1( ptype, ssap )     (uint8_t)( (((uint8_t)(ptype) & 0x03U) << 6) | ((uint8_t)(ssap) & LLCP_SAP_MASK) ) /*!< Second header byte: PTYPE lsbs | SSAP */
+#define llcpGetDsap( p )            (uint8_t)( (p)[0] >> 2 )                                              /*!< DSAP of the given PDU   */
+#define llcpGetPtype( p )           (uint8_t)( (((p)[0] & 0x03U) << 2) | ((p)[1] >> 6) )                  /*!< PTYPE of the given PDU  */
+#define llcpGetSsap( p )            (uint8_t)( (p)[1] & LLCP_SAP_MASK )                                   /*!< SSAP of the given PDU   */
+#define llcpSeqInc( s )             (uint8_t)( ((s) + 1U) & LLCP_SEQ_MASK )                               /*!< Sequence number + 1     */
+#define llcpSeqDist( a, b )         (uint8_t)( ((uint8_t)(a) - (uint8_t)(b)) & LLCP_SEQ_MASK )            /*!< (a - b) modulo 16       */
+
+/*
+ ******************************************************************************
+ * LOCAL DATA TYPES
+ ******************************************************************************
+ */
+
+/*! LLCP parameters found on the General Bytes, CONNECT or CC */
+typedef struct
+{
+    uint8_t        version;                      /*!< VERSION (0 if absent)                                */
+    uint16_t       miux;                         /*!< MIUX                                                 */
+    uint16_t       wks;                          /*!< WKS                                                  */
+    uint8_t        lto;                          /*!< LTO                                                  */
+    uint8_t        rw;                           /*!< RW                                                   */
+    const uint8_t  *sn;                          /*!< SN  (NULL if absent)                                 */
+    uint8_t        snLen;                        /*!< SN length                                            */
+} llcpParams;
+
+/*
+ ******************************************************************************
+ * LOCAL VARIABLES
+ ******************************************************************************
+ */
+
+static const uint8_t gLlcpMagic[RFAL_LLCP_MAGIC_LEN] = { 0x46U, 0x66U, 0x6DU };  /*!< LLCP magic number  LLCP 1.1  6.2.3.1 */
+
+/*
+ ******************************************************************************
+ * LOCAL FUNCTION PROTOTYPES
+ ******************************************************************************
+ */
+static void llcpParseParams( const uint8_t *params, uint16_t paramsLen, llcpParams *out );
+static uint8_t llcpPutConnParams( uint8_t *buf );
+static rfalLlcpConn* llcpFindConn( const rfalLlcpLink *link, uint8_t dsap, uint8_t ssap );
+static rfalLlcpConn* llcpFindLocal( const rfalLlcpLink *link, uint8_t dsap );
+static ReturnCode llcpRegister( rfalLlcpLink *link, rfalLlcpConn *conn );
+static void llcpConnOpen( const rfalLlcpLink *link, rfalLlcpConn *conn, uint8_t rsap, const llcpParams *params );
+static void llcpConnClose( rfalLlcpConn *conn, ReturnCode status );
+static void llcpReply( rfalLlcpLink *link, uint8_t ptype, uint8_t dsap, uint8_t ssap, const uint8_t *info, uint8_t infoLen );
+static void llcpFrmr( rfalLlcpLink *link, rfalLlcpConn *conn, const uint8_t *pdu, uint16_t pduLen, uint8_t flags );
+static bool llcpAck( rfalLlcpConn *conn, uint8_t nr );
+static void llcpProcessConnect( rfalLlcpLink *link, const uint8_t *pdu, uint16_t pduLen );
+static void llcpProcessI( rfalLlcpLink *link, const uint8_t *pdu, uint16_t pduLen );
+static ReturnCode llcpProcessPdu( rfalLlcpLink *link, const uint8_t *pdu, uint16_t pduLen );
+static uint8_t* llcpPduAlloc( rfalLlcpLink *link, uint16_t pduLen );
+static void llcpConnTx( rfalLlcpLink *link, rfalLlcpConn *conn );
+static ReturnCode llcpLinkActivate( rfalLlcpLink *link, const uint8_t *gb, uint8_t gbLen, bool isInitiator );
+static ReturnCode llcpDepTxBlock( rfalLlcpLink *link );
+
+/*
+ ******************************************************************************
+ * LOCAL FUNCTIONS
+ ******************************************************************************
+ */
+
+/*******************************************************************************/
+static void llcpParseParams( const uint8_t *params, uint16_t paramsLen, llcpParams *out )
+{
+    uint16_t it;
+    uint8_t  type;
+    uint8_t  len;
+
+    ST_MEMSET( out, 0x00, sizeof(llcpParams) );
+    out->lto = RFAL_LLCP_LTO_DEFAULT;
+    out->rw  = 1U;                                                   /* LLCP 1.1  4.5.5  RW default is 1 */
+
+    it = 0;
+    while( (it + 2U) <= paramsLen )
+    {
+        type = params[it++];
+        len  = params[it++];
+
+        if( (it + len) > paramsLen )
+        {
+            break;                                                   /* Truncated TLV, ignore the rest   */
+        }
+
+        switch( type )
+        {
+            case LLCP_PARAM_VERSION:
+                out->version = ((len == 1U) ? params[it] : out->version);
+                break;
+
+            case LLCP_PARAM_MIUX:
+                out->miux = ((len == 2U) ? (uint16_t)(GETU16(&params[it]) & LLCP_MIUX_MASK) : out->miux);
+                break;
+
+            case LLCP_PARAM_WKS:
+                out->wks = ((len == 2U) ? GETU16(&params[it]) : out->wks);
+                break;
+
+            case LLCP_PARAM_LTO:
+                out->lto = ((len == 1U) ? params[it] : out->lto);
+                break;
+
+            case LLCP_PARAM_RW:
+                out->rw = ((len == 1U) ? (params[it] & LLCP_RW_MASK) : out->rw);
+                break;
+
+            case LLCP_PARAM_SN:
+                out->sn    = &params[it];
+                out->snLen = len;
+                break;
+
+            default:                                                 /* OPT and unknown parameters ignored */
+                break;
+        }
+        it += len;
+    }
+}
+
+
+/*******************************************************************************/
+static uint8_t llcpPutConnParams( uint8_t *buf )
+{
+    uint8_t it;
+
+    it = 0;
+    if( RFAL_FEATURE_LLCP_MIU > RFAL_LLCP_MIU_DEFAULT )
+    {
+        buf[it++] = LLCP_PARAM_MIUX;
+        buf[it++] = 2U;
+        buf[it++] = (uint8_t)((RFAL_FEATURE_LLCP_MIU - RFAL_LLCP_MIU_DEFAULT) >> 8U);
+        buf[it++] = (uint8_t)( RFAL_FEATURE_LLCP_MIU - RFAL_LLCP_MIU_DEFAULT);
+    }
+
+    buf[it++] = LLCP_PARAM_RW;
+    buf[it++] = 1U;
+    buf[it++] = (uint8_t)(MIN( RFAL_FEATURE_LLCP_RW, RFAL_LLCP_RW_MAX ));
+
+    return it;
+}
+
+
+/*******************************************************************************/
+static rfalLlcpConn* llcpFindConn( const rfalLlcpLink *link, uint8_t dsap, uint8_t ssap )
+{
+    uint8_t i;
+
+    for( i = 0; i < RFAL_FEATURE_LLCP_CONN_MAX; i++ )
+    {
+        if( (link->conn[i] != NULL) && (link->conn[i]->lsap == dsap) && (link->conn[i]->rsap == ssap) && (link->conn[i]->state >= RFAL_LLCP_CONN_ST_ACCEPT) )
+        {
+            return link->conn[i];
+        }
+    }
+    return NULL;
+}
+
+
+/*******************************************************************************/
+static rfalLlcpConn* llcpFindLocal( const rfalLlcpLink *link, uint8_t dsap )
+{
+    uint8_t i;
+
+    for( i = 0; i < RFAL_FEATURE_LLCP_CONN_MAX; i++ )
+    {
+        if( (link->conn[i] != NULL) && (link->conn[i]->lsap == dsap) )
+        {
+            return link->conn[i];
+        }
+    }
+    return NULL;
+}
+
+
+/*******************************************************************************/
+static ReturnCode llcpRegister( rfalLlcpLink *link, rfalLlcpConn *conn )
+{
+    uint8_t i;
+    uint8_t slot;
+
+    slot = RFAL_FEATURE_LLCP_CONN_MAX;
+    for( i = 0; i < RFAL_FEATURE_LLCP_CONN_MAX; i++ )
+    {
+        if( link->conn[i] == conn )
+        {
+            slot = i;
+            break;
+        }
+        if( (link->conn[i] == NULL) && (slot == RFAL_FEATURE_LLCP_CONN_MAX) )
+        {
+            slot = i;
+        }
+    }
+
+    if( slot == RFAL_FEATURE_LLCP_CONN_MAX )
+    {
+        return ERR_NOMEM;
+    }
+
+    ST_MEMSET( conn, 0x00, sizeof(rfalLlcpConn) );
+    conn->lsap       = (RFAL_LLCP_SAP_LOCAL + slot);
+    link->conn[slot] = conn;
+
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+static void llcpConnOpen( const rfalLlcpLink *link, rfalLlcpConn *conn, uint8_t rsap, const llcpParams *params )
+{
+    /* An I-PDU cannot exceed the remote link MIU either, keep rMiu as the real segment size */
+    conn->rsap   = rsap;
+    conn->rMiu   = MIN( (uint16_t)(RFAL_LLCP_MIU_DEFAULT + params->miux), link->rLinkMiu );
+    conn->rRw    = params->rw;
+    conn->rBusy  = false;
+    conn->vs     = 0;
+    conn->vsa    = 0;
+    conn->vr     = 0;
+    conn->vra    = 0;
+    conn->rxLen  = 0;
+    conn->status = ERR_NONE;
+}
+
+
+/*******************************************************************************/
+static void llcpConnClose( rfalLlcpConn *conn, ReturnCode status )
+{
+    conn->state  = (conn->isListen ? RFAL_LLCP_CONN_ST_LISTEN : RFAL_LLCP_CONN_ST_IDLE);
+    conn->status = status;
+    conn->txData = NULL;
+    conn->txLen  = 0;
+    conn->txIt   = 0;
+}
+
+
+/*******************************************************************************/
+static void llcpReply( rfalLlcpLink *link, uint8_t ptype, uint8_t dsap, uint8_t ssap, const uint8_t *info, uint8_t infoLen )
+{
+    uint8_t i;
+
+    for( i = 0; i < RFAL_LLCP_REPLY_MAX; i++ )
+    {
+        if( link->replyLen[i] == 0U )
+        {
+            link->reply[i][0] = llcpHdr0( dsap, ptype );
+            link->reply[i][1] = llcpHdr1( ptype, ssap );
+            ST_MEMCPY( &link->reply[i][RFAL_LLCP_HEADER_LEN], info, infoLen );
+            link->replyLen[i] = (RFAL_LLCP_HEADER_LEN + infoLen);
+            return;
+        }
+    }
+    /* All reply slots in use, the peer will recover on its own (DM/FRMR are not acknowledged) */
+}
+
+
+/*******************************************************************************/
+static void llcpFrmr( rfalLlcpLink *link, rfalLlcpConn *conn, const uint8_t *pdu, uint16_t pduLen, uint8_t flags )
+{
+    uint8_t info[LLCP_FRMR_INFO_LEN];
+
+    /* LLCP 1.1  4.3.9  W|I|R|S PTYPE, rejected sequence, V(S) V(R), V(SA) V(RA) */
+    info[0] = (flags | llcpGetPtype( pdu ));
+    info[1] = ((pduLen > RFAL_LLCP_HEADER_LEN) ? pdu[RFAL_LLCP_HEADER_LEN] : 0U);
+    info[2] = (uint8_t)((conn->vs  << 4) | conn->vr);
+    info[3] = (uint8_t)((conn->vsa << 4) | conn->vra);
+
+    llcpReply( link, LLCP_PTYPE_FRMR, conn->rsap, conn->lsap, info, LLCP_FRMR_INFO_LEN );
+    llcpConnClose( conn, ERR_PROTO );
+}
+
+
+/*******************************************************************************/
+static bool llcpAck( rfalLlcpConn *conn, uint8_t nr )
+{
+    /* LLCP 1.1  5.6.3  N(R) must acknowledge I-PDUs sent and not yet acknowledged */
+    if( llcpSeqDist( nr, conn->vsa ) > llcpSeqDist( conn->vs, conn->vsa ) )
+    {
+        return false;
+    }
+
+    conn->vsa = nr;
+    return true;
+}
+
+
+/*******************************************************************************/
+static void llcpProcessConnect( rfalLlcpLink *link, const uint8_t *pdu, uint16_t pduLen )
+{
+    rfalLlcpConn *conn;
+    llcpParams   params;
+    uint8_t      dsap;
+    uint8_t      ssap;
+    uint8_t      reason;
+    uint8_t      i;
+
+    dsap = llcpGetDsap( pdu );
+    ssap = llcpGetSsap( pdu );
+    llcpParseParams( &pdu[RFAL_LLCP_HEADER_LEN], (pduLen - RFAL_LLCP_HEADER_LEN), &params );
+
+    conn = NULL;
+    if( dsap == RFAL_LLCP_SAP_SDP )
+    {
+        /* LLCP 1.1  5.6.1  Connect by name: look for a listener bound to the SN */
+        for( i = 0; i < RFAL_FEATURE_LLCP_CONN_MAX; i++ )
+        {
+            if( (link->conn[i] != NULL) && link->conn[i]->isListen && (link->conn[i]->sn != NULL) && (params.sn != NULL) &&
+                (link->conn[i]->snLen == params.snLen) && (ST_BYTECMP( link->conn[i]->sn, params.sn, params.snLen ) == 0) )
+            {
+                conn = link->conn[i];
+                break;
+            }
+        }
+    }
+    else
+    {
+        conn = llcpFindLocal( link, dsap );
+        conn = (((conn != NULL) && conn->isListen) ? conn : NULL);
+    }
+
+    if( conn == NULL )
+    {
+        reason = LLCP_DM_NO_SERVICE;
+        llcpReply( link, LLCP_PTYPE_DM, ssap, dsap, &reason, 1U );
+        return;
+    }
+
+    if( conn->state != RFAL_LLCP_CONN_ST_LISTEN )
+    {
+        reason = LLCP_DM_REJECTED;                                   /* Service already connected */
+        llcpReply( link, LLCP_PTYPE_DM, ssap, dsap, &reason, 1U );
+        return;
+    }
+
+    llcpConnOpen( link, conn, ssap, &params );
+    conn->state = RFAL_LLCP_CONN_ST_ACCEPT;
+}
+
+
+/*******************************************************************************/
+static void llcpProcessI( rfalLlcpLink *link, const uint8_t *pdu, uint16_t pduLen )
+{
+    rfalLlcpConn *conn;
+    uint16_t     infoLen;
+    uint8_t      ns;
+    uint8_t      reason;
+
+    conn = llcpFindConn( link, llcpGetDsap( pdu ), llcpGetSsap( pdu ) );
+    if( (conn == NULL) || (conn->state < RFAL_LLCP_CONN_ST_CONNECTED) )
+    {
+        reason = LLCP_DM_NO_CONN;
+        llcpReply( link, LLCP_PTYPE_DM, llcpGetSsap( pdu ), llcpGetDsap( pdu ), &reason, 1U );
+        return;
+    }
+
+    if( pduLen < (RFAL_LLCP_HEADER_LEN + RFAL_LLCP_SEQ_LEN) )
+    {
+        llcpFrmr( link, conn, pdu, pduLen, LLCP_FRMR_W );
+        return;
+    }
+
+    ns      = (pdu[RFAL_LLCP_HEADER_LEN] >> 4);
+    infoLen = (pduLen - RFAL_LLCP_HEADER_LEN - RFAL_LLCP_SEQ_LEN);
+
+    if( (infoLen > RFAL_FEATURE_LLCP_MIU) || ((uint32_t)conn->rxLen + infoLen) > conn->rxBufLen )
+    {
+        llcpFrmr( link, conn, pdu, pduLen, LLCP_FRMR_I );
+        return;
+    }
+
+    if( (ns != conn->vr) || (llcpSeqDist( ns, conn->vra ) >= MIN( RFAL_FEATURE_LLCP_RW, RFAL_LLCP_RW_MAX )) )
+    {
+        llcpFrmr( link, conn, pdu, pduLen, LLCP_FRMR_S );
+        return;
+    }
+
+    if( !llcpAck( conn, (pdu[RFAL_LLCP_HEADER_LEN] & LLCP_SEQ_MASK) ) )
+    {
+        llcpFrmr( link, conn, pdu, pduLen, LLCP_FRMR_R );
+        return;
+    }
+
+    if( infoLen > 0U )
+    {
+        ST_MEMCPY( &conn->rxBuf[conn->rxLen], &pdu[RFAL_LLCP_HEADER_LEN + RFAL_LLCP_SEQ_LEN], infoLen );
+        conn->rxLen += infoLen;
+    }
+    conn->vr = llcpSeqInc( conn->vr );
+}
+
+
+/*******************************************************************************/
+static ReturnCode llcpProcessPdu( rfalLlcpLink *link, const uint8_t *pdu, uint16_t pduLen )
+{
+    rfalLlcpConn *conn;
+    llcpParams   params;
+    uint8_t      dsap;
+    uint8_t      ssap;
+    uint8_t      reason;
+
+    if( pduLen < RFAL_LLCP_HEADER_LEN )
+    {
+        return ERR_PROTO;
+    }
+
+    dsap = llcpGetDsap( pdu );
+    ssap = llcpGetSsap( pdu );
+
+    switch( llcpGetPtype( pdu ) )
+    {
+        /*******************************************************************************/
+        case LLCP_PTYPE_SYMM:
+        case LLCP_PTYPE_PAX:                                         /* Parameters are only taken at activation */
+        case LLCP_PTYPE_UI:                                          /* Connectionless transport not supported  */
+            break;
+
+        /*******************************************************************************/
+        case LLCP_PTYPE_DISC:
+            if( (dsap == RFAL_LLCP_SAP_LINK) && (ssap == RFAL_LLCP_SAP_LINK) )
+            {
+                link->state = RFAL_LLCP_LINK_ST_CLOSED;              /* LLCP 1.1  5.5  Link deactivation */
+                break;
+            }
+
+            conn   = llcpFindConn( link, dsap, ssap );
+            reason = ((conn != NULL) ? LLCP_DM_DISC : LLCP_DM_NO_CONN);
+            llcpReply( link, LLCP_PTYPE_DM, ssap, dsap, &reason, 1U );
+
+            if( conn != NULL )
+            {
+                llcpConnClose( conn, ERR_NONE );
+            }
+            break;
+
+        /*******************************************************************************/
+        case LLCP_PTYPE_CONNECT:
+            llcpProcessConnect( link, pdu, pduLen );
+            break;
+
+        /*******************************************************************************/
+        case LLCP_PTYPE_CC:
+            conn = llcpFindLocal( link, dsap );
+            if( (conn != NULL) && (conn->state == RFAL_LLCP_CONN_ST_CONNECTING) )
+            {
+                /* The SSAP of the CC is the service's SAP, also when connected by name */
+                llcpParseParams( &pdu[RFAL_LLCP_HEADER_LEN], (pduLen - RFAL_LLCP_HEADER_LEN), &params );
+                llcpConnOpen( link, conn, ssap, &params );
+                conn->state = RFAL_LLCP_CONN_ST_CONNECTED;
+            }
+            break;
+
+        /*******************************************************************************/
+        case LLCP_PTYPE_DM:
+            conn = llcpFindLocal( link, dsap );
+            if( conn != NULL )
+            {
+                if( conn->state == RFAL_LLCP_CONN_ST_CONNECTING )
+                {
+                    llcpConnClose( conn, ERR_REQUEST );              /* Connection refused */
+                }
+                else if( (conn->state >= RFAL_LLCP_CONN_ST_CONNECTED) && (conn->rsap == ssap) )
+                {
+                    llcpConnClose( conn, ((conn->state == RFAL_LLCP_CONN_ST_DISCONNECTING) ? ERR_NONE : ERR_REQUEST) );
+                }
+                else
+                {
+                    /* MISRA 15.7 - Empty else */
+                }
+            }
+            break;
+
+        /*******************************************************************************/
+        case LLCP_PTYPE_FRMR:
+            conn = llcpFindConn( link, dsap, ssap );
+            if( conn != NULL )
+            {
+                llcpConnClose( conn, ERR_PROTO );
+            }
+            break;
+
+        /*******************************************************************************/
+        case LLCP_PTYPE_I:
+            llcpProcessI( link, pdu, pduLen );
+            break;
+
+        /*******************************************************************************/
+        case LLCP_PTYPE_RR:
+        case LLCP_PTYPE_RNR:
+            conn = llcpFindConn( link, dsap, ssap );
+            if( (conn == NULL) || (conn->state < RFAL_LLCP_CONN_ST_CONNECTED) )
+            {
+                reason = LLCP_DM_NO_CONN;
+                llcpReply( link, LLCP_PTYPE_DM, ssap, dsap, &reason, 1U );
+                break;
+            }
+
+            if( pduLen != (RFAL_LLCP_HEADER_LEN + RFAL_LLCP_SEQ_LEN) )
+            {
+                llcpFrmr( link, conn, pdu, pduLen, LLCP_FRMR_W );
+                break;
+            }
+
+            if( !llcpAck( conn, (pdu[RFAL_LLCP_HEADER_LEN] & LLCP_SEQ_MASK) ) )
+            {
+                llcpFrmr( link, conn, pdu, pduLen, LLCP_FRMR_R );
+                break;
+            }
+            conn->rBusy = (llcpGetPtype( pdu ) == LLCP_PTYPE_RNR);
+            break;
+
+        /*******************************************************************************/
+        default:                                                     /* SNL and reserved PTYPEs ignored */
+            break;
+    }
+
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+static uint8_t* llcpPduAlloc( rfalLlcpLink *link, uint16_t pduLen )
+{
+    uint8_t  *pdu;
+    uint16_t agfMax;
+
+    /* PDUs are placed as AGF entries right away; a frame with a single PDU is *
+     * sent from the first entry, skipping the AGF header and length field     */
+    if( link->txPduCnt == 0U )
+    {
+        if( pduLen > (RFAL_LLCP_HEADER_LEN + RFAL_LLCP_SEQ_LEN + MIN( link->rLinkMiu, (uint16_t)RFAL_FEATURE_LLCP_MIU )) )
+        {
+            return NULL;
+        }
+    }
+    else
+    {
+        /* LLCP 1.1  4.3.3  The AGF information field must fit the remote Link MIU */
+        agfMax = MIN( link->rLinkMiu, (uint16_t)RFAL_FEATURE_LLCP_MIU );
+        if( ((uint32_t)link->txFrameIt - RFAL_LLCP_HEADER_LEN + RFAL_LLCP_AGF_LEN_LEN + pduLen) > agfMax )
+        {
+            return NULL;
+        }
+    }
+
+    link->txFrame[link->txFrameIt++] = (uint8_t)(pduLen >> 8U);
+    link->txFrame[link->txFrameIt++] = (uint8_t)pduLen;
+
+    pdu              = &link->txFrame[link->txFrameIt];
+    link->txFrameIt += pduLen;
+    link->txPduCnt++;
+
+    return pdu;
+}
+
+
+/*******************************************************************************/
+static void llcpConnTx( rfalLlcpLink *link, rfalLlcpConn *conn )
+{
+    uint8_t  params[RFAL_LLCP_GB_MAX_LEN];
+    uint8_t  paramsLen;
+    uint8_t  ptype;
+    uint8_t  *pdu;
+    uint16_t snLen;
+    uint16_t infoLen;
+
+    switch( conn->state )
+    {
+        /*******************************************************************************/
+        case RFAL_LLCP_CONN_ST_CONNECT:
+        case RFAL_LLCP_CONN_ST_ACCEPT:
+            ptype     = ((conn->state == RFAL_LLCP_CONN_ST_CONNECT) ? LLCP_PTYPE_CONNECT : LLCP_PTYPE_CC);
+            snLen     = (((ptype == LLCP_PTYPE_CONNECT) && (conn->sn != NULL)) ? (2U + (uint16_t)conn->snLen) : 0U);
+            paramsLen = llcpPutConnParams( params );
+
+            pdu = llcpPduAlloc( link, (RFAL_LLCP_HEADER_LEN + (uint16_t)paramsLen + snLen) );
+            if( pdu == NULL )
+            {
+                break;                                               /* No room left, goes on the next frame */
+            }
+
+            pdu[0] = llcpHdr0( conn->rsap, ptype );
+            pdu[1] = llcpHdr1( ptype, conn->lsap );
+            ST_MEMCPY( &pdu[RFAL_LLCP_HEADER_LEN], params, paramsLen );
+
+            if( snLen > 0U )
+            {
+                pdu[RFAL_LLCP_HEADER_LEN + paramsLen]      = LLCP_PARAM_SN;
+                pdu[RFAL_LLCP_HEADER_LEN + paramsLen + 1U] = conn->snLen;
+                ST_MEMCPY( &pdu[RFAL_LLCP_HEADER_LEN + paramsLen + 2U], conn->sn, conn->snLen );
+            }
+
+            conn->state = ((ptype == LLCP_PTYPE_CONNECT) ? RFAL_LLCP_CONN_ST_CONNECTING : RFAL_LLCP_CONN_ST_CONNECTED);
+            break;
+
+        /*******************************************************************************/
+        case RFAL_LLCP_CONN_ST_DISC:
+            pdu = llcpPduAlloc( link, RFAL_LLCP_HEADER_LEN );
+            if( pdu != NULL )
+            {
+                pdu[0] = llcpHdr0( conn->rsap, LLCP_PTYPE_DISC );
+                pdu[1] = llcpHdr1( LLCP_PTYPE_DISC, conn->lsap );
+                conn->state = RFAL_LLCP_CONN_ST_DISCONNECTING;
+            }
+            break;
+
+        /*******************************************************************************/
+        case RFAL_LLCP_CONN_ST_CONNECTED:
+
+            /* LLCP 1.1  5.6.4  Send I-PDUs while the remote receive window is open */
+            while( (conn->txIt < conn->txLen) && !conn->rBusy && (llcpSeqDist( conn->vs, conn->vsa ) < conn->rRw) )
+            {
+                infoLen = MIN( (conn->txLen - conn->txIt), MIN( conn->rMiu, (uint16_t)RFAL_FEATURE_LLCP_MIU ) );
+
+                pdu = llcpPduAlloc( link, (RFAL_LLCP_HEADER_LEN + RFAL_LLCP_SEQ_LEN + infoLen) );
+                if( pdu == NULL )
+                {
+                    break;
+                }
+
+                pdu[0] = llcpHdr0( conn->rsap, LLCP_PTYPE_I );
+                pdu[1] = llcpHdr1( LLCP_PTYPE_I, conn->lsap );
+                pdu[2] = (uint8_t)((conn->vs << 4) | conn->vr);      /* N(S) | N(R), acknowledges all received */
+                ST_MEMCPY( &pdu[RFAL_LLCP_HEADER_LEN + RFAL_LLCP_SEQ_LEN], &conn->txData[conn->txIt], infoLen );
+
+                conn->txIt += infoLen;
+                conn->vs    = llcpSeqInc( conn->vs );
+                conn->vra   = conn->vr;
+            }
+
+            /* Acknowledge received I-PDUs not covered by an outgoing I-PDU */
+            if( conn->vra != conn->vr )
+            {
+                pdu = llcpPduAlloc( link, (RFAL_LLCP_HEADER_LEN + RFAL_LLCP_SEQ_LEN) );
+                if( pdu != NULL )
+                {
+                    pdu[0] = llcpHdr0( conn->rsap, LLCP_PTYPE_RR );
+                    pdu[1] = llcpHdr1( LLCP_PTYPE_RR, conn->lsap );
+                    pdu[2] = conn->vr;
+                    conn->vra = conn->vr;
+                }
+            }
+            break;
+
+        /*******************************************************************************/
+        default:
+            break;
+    }
+}
+
+
+/*******************************************************************************/
+static ReturnCode llcpLinkActivate( rfalLlcpLink *link, const uint8_t *gb, uint8_t gbLen, bool isInitiator )
+{
+    llcpParams params;
+    uint8_t    i;
+
+    if( (gb == NULL) || (gbLen < RFAL_LLCP_MAGIC_LEN) || (ST_BYTECMP( gb, gLlcpMagic, RFAL_LLCP_MAGIC_LEN ) != 0) )
+    {
+        return ERR_PROTO;
+    }
+
+    llcpParseParams( &gb[RFAL_LLCP_MAGIC_LEN], (uint16_t)(gbLen - RFAL_LLCP_MAGIC_LEN), &params );
+
+    /* LLCP 1.1  5.2.2  Version agreement: major versions must match */
+    if( (params.version >> LLCP_VERSION_MAJOR_SHIFT) != (RFAL_LLCP_VERSION >> LLCP_VERSION_MAJOR_SHIFT) )
+    {
+        return ERR_NOTSUPP;
+    }
+
+    link->version     = params.version;
+    link->rLinkMiu    = (RFAL_LLCP_MIU_DEFAULT + params.miux);
+    link->rWks        = params.wks;
+    link->rLto        = params.lto;
+    link->isInitiator = isInitiator;
+    link->rxFrameLen  = 0;
+    ST_MEMSET( link->replyLen, 0x00, sizeof(link->replyLen) );
+
+    /* Connections established on a previous link are gone, pending CONNECTs are kept */
+    for( i = 0; i < RFAL_FEATURE_LLCP_CONN_MAX; i++ )
+    {
+        if( (link->conn[i] != NULL) && (link->conn[i]->state > RFAL_LLCP_CONN_ST_CONNECT) )
+        {
+            llcpConnClose( link->conn[i], ERR_LINK_LOSS );
+        }
+    }
+
+    link->state = RFAL_LLCP_LINK_ST_ACTIVE;
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+static ReturnCode llcpDepTxBlock( rfalLlcpLink *link )
+{
+    rfalNfcDepTxRxParam param;
+    uint16_t            blockLen;
+
+    /* Leave room for the largest DEP_REQ/DEP_RES header (DID and NAD) */
+    blockLen = MIN( (uint16_t)(link->depFrameLen - link->depFrameIt), (uint16_t)(link->nfcDepDev->info.FS - RFAL_NFCDEP_DEPREQ_HEADER_LEN) );
+
+    ST_MEMCPY( link->depTxBuf.inf, &link->depFrame[link->depFrameIt], blockLen );
+    link->depFrameIt     += blockLen;
+    link->isDepTxChaining = (link->depFrameIt < link->depFrameLen);
+
+    param.txBuf        = &link->depTxBuf;
+    param.txBufLen     = blockLen;
+    param.isTxChaining = link->isDepTxChaining;
+    param.rxBuf        = &link->depRxBuf;
+    param.rxLen        = &link->depRxLen;
+    param.isRxChaining = &link->isDepRxChaining;
+    param.FWT          = link->nfcDepDev->info.FWT;
+    param.dFWT         = link->nfcDepDev->info.dFWT;
+    param.FSx          = link->nfcDepDev->info.FS;
+    param.DID          = RFAL_NFCDEP_DID_KEEP;
+
+    return rfalNfcDepStartTransceive( &param );
+}
+
+
+/*
+ ******************************************************************************
+ * GLOBAL FUNCTIONS
+ ******************************************************************************
+ */
+
+/*******************************************************************************/
+void rfalLlcpInitialize( rfalLlcpLink *link )
+{
+    ST_MEMSET( link, 0x00, sizeof(rfalLlcpLink) );
+    link->state    = RFAL_LLCP_LINK_ST_IDLE;
+    link->rLinkMiu = RFAL_LLCP_MIU_DEFAULT;
+}
+
+
+/*******************************************************************************/
+uint8_t rfalLlcpGetGeneralBytes( const rfalLlcpLink *link, uint8_t *gb )
+{
+    uint16_t wks;
+    uint8_t  it;
+    uint8_t  i;
+
+    /* LLCP 1.1  4.5.3  LLC Link Management and SDP are always available */
+    wks = ((1U << RFAL_LLCP_SAP_LINK) | (1U << RFAL_LLCP_SAP_SDP));
+    for( i = 0; i < RFAL_FEATURE_LLCP_CONN_MAX; i++ )
+    {
+        if( (link->conn[i] != NULL) && link->conn[i]->isListen && (link->conn[i]->lsap <= LLCP_SAP_WKS_MAX) )
+        {
+            wks |= (uint16_t)(1U << link->conn[i]->lsap);
+        }
+    }
+
+    it = 0;
+    ST_MEMCPY( gb, gLlcpMagic, RFAL_LLCP_MAGIC_LEN );
+    it += RFAL_LLCP_MAGIC_LEN;
+
+    gb[it++] = LLCP_PARAM_VERSION;
+    gb[it++] = 1U;
+    gb[it++] = RFAL_LLCP_VERSION;
+
+    if( RFAL_FEATURE_LLCP_MIU > RFAL_LLCP_MIU_DEFAULT )
+    {
+        gb[it++] = LLCP_PARAM_MIUX;
+        gb[it++] = 2U;
+        gb[it++] = (uint8_t)((RFAL_FEATURE_LLCP_MIU - RFAL_LLCP_MIU_DEFAULT) >> 8U);
+        gb[it++] = (uint8_t)( RFAL_FEATURE_LLCP_MIU - RFAL_LLCP_MIU_DEFAULT);
+    }
+
+    gb[it++] = LLCP_PARAM_WKS;
+    gb[it++] = 2U;
+    gb[it++] = (uint8_t)(wks >> 8U);
+    gb[it++] = (uint8_t)wks;
+
+    gb[it++] = LLCP_PARAM_LTO;
+    gb[it++] = 1U;
+    gb[it++] = RFAL_LLCP_LTO_DEFAULT;
+
+    gb[it++] = LLCP_PARAM_OPT;
+    gb[it++] = 1U;
+    gb[it++] = LLCP_OPT_LSC_CO;
+
+    return it;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalLlcpActivate( rfalLlcpLink *link, rfalNfcDepDevice *nfcDepDev, bool isInitiator )
+{
+    ReturnCode ret;
+
+    if( (link == NULL) || (nfcDepDev == NULL) )
+    {
+        return ERR_PARAM;
+    }
+
+    /* The peer's General Bytes come on the ATR_RES as Initiator and on the ATR_REQ as Target */
+    EXIT_ON_ERR( ret, llcpLinkActivate( link, (isInitiator ? nfcDepDev->activation.Target.ATR_RES.GBt : nfcDepDev->activation.Initiator.ATR_REQ.GBi), nfcDepDev->info.GBLen, isInitiator ) );
+
+    link->nfcDepDev = nfcDepDev;
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalLlcpActivateLoopback( rfalLlcpLink *link, const uint8_t *gb, uint8_t gbLen, bool isInitiator )
+{
+    ReturnCode ret;
+
+    if( link == NULL )
+    {
+        return ERR_PARAM;
+    }
+
+    EXIT_ON_ERR( ret, llcpLinkActivate( link, gb, gbLen, isInitiator ) );
+
+    link->nfcDepDev = NULL;
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalLlcpDeactivate( rfalLlcpLink *link )
+{
+    if( link->state != RFAL_LLCP_LINK_ST_ACTIVE )
+    {
+        return ERR_WRONG_STATE;
+    }
+
+    link->state = RFAL_LLCP_LINK_ST_CLOSING;
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalLlcpConnect( rfalLlcpLink *link, rfalLlcpConn *conn, uint8_t dsap, const uint8_t *sn, uint8_t snLen, uint8_t *rxBuf, uint16_t rxBufLen )
+{
+    ReturnCode ret;
+
+    if( (link == NULL) || (conn == NULL) || ((rxBuf == NULL) && (rxBufLen > 0U)) || ((sn == NULL) && (dsap > LLCP_SAP_MASK)) )
+    {
+        return ERR_PARAM;
+    }
+
+    EXIT_ON_ERR( ret, llcpRegister( link, conn ) );
+
+    conn->rsap     = ((sn != NULL) ? RFAL_LLCP_SAP_SDP : dsap);
+    conn->sn       = sn;
+    conn->snLen    = ((sn != NULL) ? snLen : 0U);
+    conn->rxBuf    = rxBuf;
+    conn->rxBufLen = rxBufLen;
+    conn->state    = RFAL_LLCP_CONN_ST_CONNECT;
+
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalLlcpListen( rfalLlcpLink *link, rfalLlcpConn *conn, uint8_t sap, const uint8_t *sn, uint8_t snLen, uint8_t *rxBuf, uint16_t rxBufLen )
+{
+    ReturnCode ret;
+
+    if( (link == NULL) || (conn == NULL) || ((rxBuf == NULL) && (rxBufLen > 0U)) || (sap <= RFAL_LLCP_SAP_SDP) || (sap > LLCP_SAP_MASK) )
+    {
+        return ERR_PARAM;
+    }
+
+    EXIT_ON_ERR( ret, llcpRegister( link, conn ) );
+
+    conn->lsap     = sap;
+    conn->sn       = sn;
+    conn->snLen    = ((sn != NULL) ? snLen : 0U);
+    conn->rxBuf    = rxBuf;
+    conn->rxBufLen = rxBufLen;
+    conn->isListen = true;
+    conn->state    = RFAL_LLCP_CONN_ST_LISTEN;
+
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalLlcpSend( rfalLlcpConn *conn, const uint8_t *data, uint16_t dataLen )
+{
+    if( conn->state != RFAL_LLCP_CONN_ST_CONNECTED )
+    {
+        return ERR_WRONG_STATE;
+    }
+
+    if( conn->txIt < conn->txLen )
+    {
+        return ERR_BUSY;
+    }
+
+    conn->txData = data;
+    conn->txLen  = dataLen;
+    conn->txIt   = 0;
+
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+bool rfalLlcpIsSendDone( const rfalLlcpConn *conn )
+{
+    return ( (conn->txIt >= conn->txLen) && (conn->vsa == conn->vs) );
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalLlcpDisconnect( rfalLlcpConn *conn )
+{
+    if( conn->state == RFAL_LLCP_CONN_ST_CONNECT )
+    {
+        llcpConnClose( conn, ERR_NONE );                             /* CONNECT not yet sent */
+        return ERR_NONE;
+    }
+
+    if( conn->state != RFAL_LLCP_CONN_ST_CONNECTED )
+    {
+        return ERR_WRONG_STATE;
+    }
+
+    conn->state = RFAL_LLCP_CONN_ST_DISC;
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalLlcpGetFrame( rfalLlcpLink *link, const uint8_t **frame, uint16_t *frameLen )
+{
+    uint8_t *pdu;
+    uint8_t i;
+
+    if( (link->state != RFAL_LLCP_LINK_ST_ACTIVE) && (link->state != RFAL_LLCP_LINK_ST_CLOSING) )
+    {
+        return ERR_WRONG_STATE;
+    }
+
+    link->txFrameIt = RFAL_LLCP_HEADER_LEN;                          /* Room for the AGF header */
+    link->txPduCnt  = 0;
+
+    if( link->state == RFAL_LLCP_LINK_ST_CLOSING )
+    {
+        /* LLCP 1.1  5.5  Link deactivation: DISC with DSAP and SSAP 0 */
+        pdu = llcpPduAlloc( link, RFAL_LLCP_HEADER_LEN );
+        pdu[0] = llcpHdr0( RFAL_LLCP_SAP_LINK, LLCP_PTYPE_DISC );
+        pdu[1] = llcpHdr1( LLCP_PTYPE_DISC, RFAL_LLCP_SAP_LINK );
+        link->state = RFAL_LLCP_LINK_ST_CLOSED;
+    }
+    else
+    {
+        for( i = 0; i < RFAL_LLCP_REPLY_MAX; i++ )
+        {
+            if( link->replyLen[i] > 0U )
+            {
+                pdu = llcpPduAlloc( link, link->replyLen[i] );
+                if( pdu != NULL )
+                {
+                    ST_MEMCPY( pdu, link->reply[i], link->replyLen[i] );
+                    link->replyLen[i] = 0;
+                }
+            }
+        }
+
+        for( i = 0; i < RFAL_FEATURE_LLCP_CONN_MAX; i++ )
+        {
+            if( link->conn[i] != NULL )
+            {
+                llcpConnTx( link, link->conn[i] );
+            }
+        }
+    }
+
+    if( link->txPduCnt == 0U )
+    {
+        /* LLCP 1.1  6.2.5  Nothing to send, keep the symmetry */
+        pdu = llcpPduAlloc( link, RFAL_LLCP_HEADER_LEN );
+        pdu[0] = llcpHdr0( RFAL_LLCP_SAP_LINK, LLCP_PTYPE_SYMM );
+        pdu[1] = llcpHdr1( LLCP_PTYPE_SYMM, RFAL_LLCP_SAP_LINK );
+    }
+
+    if( link->txPduCnt == 1U )
+    {
+        *frame    = &link->txFrame[RFAL_LLCP_HEADER_LEN + RFAL_LLCP_AGF_LEN_LEN];
+        *frameLen = (link->txFrameIt - RFAL_LLCP_HEADER_LEN - RFAL_LLCP_AGF_LEN_LEN);
+    }
+    else
+    {
+        link->txFrame[0] = llcpHdr0( RFAL_LLCP_SAP_LINK, LLCP_PTYPE_AGF );
+        link->txFrame[1] = llcpHdr1( LLCP_PTYPE_AGF, RFAL_LLCP_SAP_LINK );
+        *frame    = link->txFrame;
+        *frameLen = link->txFrameIt;
+    }
+
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalLlcpProcessFrame( rfalLlcpLink *link, const uint8_t *frame, uint16_t frameLen )
+{
+    ReturnCode ret;
+    uint16_t   it;
+    uint16_t   pduLen;
+
+    if( link->state == RFAL_LLCP_LINK_ST_CLOSED )
+    {
+        return ERR_RELEASE_REQ;
+    }
+
+    if( link->state == RFAL_LLCP_LINK_ST_IDLE )
+    {
+        return ERR_WRONG_STATE;
+    }
+
+    if( frameLen < RFAL_LLCP_HEADER_LEN )
+    {
+        return ERR_PROTO;
+    }
+
+    if( llcpGetPtype( frame ) != LLCP_PTYPE_AGF )
+    {
+        EXIT_ON_ERR( ret, llcpProcessPdu( link, frame, frameLen ) );
+    }
+    else
+    {
+        /* LLCP 1.1  4.3.3  Process each encapsulated PDU in order */
+        it = RFAL_LLCP_HEADER_LEN;
+        while( it < frameLen )
+        {
+            if( (it + RFAL_LLCP_AGF_LEN_LEN) > frameLen )
+            {
+                return ERR_PROTO;
+            }
+
+            pduLen = GETU16( &frame[it] );
+            it    += RFAL_LLCP_AGF_LEN_LEN;
+
+            if( ((it + pduLen) > frameLen) || (pduLen < RFAL_LLCP_HEADER_LEN) || (llcpGetPtype( &frame[it] ) == LLCP_PTYPE_AGF) )
+            {
+                return ERR_PROTO;
+            }
+
+            EXIT_ON_ERR( ret, llcpProcessPdu( link, &frame[it], pduLen ) );
+            it += pduLen;
+        }
+    }
+
+    return ((link->state == RFAL_LLCP_LINK_ST_CLOSED) ? ERR_RELEASE_REQ : ERR_NONE);
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalLlcpStartExchange( rfalLlcpLink *link )
+{
+    ReturnCode ret;
+
+    if( link->nfcDepDev == NULL )
+    {
+        return ERR_WRONG_STATE;
+    }
+
+    EXIT_ON_ERR( ret, rfalLlcpGetFrame( link, &link->depFrame, &link->depFrameLen ) );
+
+    link->depFrameIt = 0;
+    link->rxFrameLen = 0;
+
+    return llcpDepTxBlock( link );
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalLlcpGetExchangeStatus( rfalLlcpLink *link )
+{
+    ReturnCode ret;
+
+    ret = rfalNfcDepGetTransceiveStatus();
+
+    if( ret == ERR_BUSY )
+    {
+        return ERR_BUSY;
+    }
+
+    if( (ret == ERR_NONE) && link->isDepTxChaining )
+    {
+        /* Chaining block acknowledged, send the next one */
+        EXIT_ON_ERR( ret, llcpDepTxBlock( link ) );
+        return ERR_BUSY;
+    }
+
+    if( (ret != ERR_NONE) && (ret != ERR_AGAIN) )
+    {
+        link->state = RFAL_LLCP_LINK_ST_CLOSED;                      /* NFC-DEP link lost */
+        return ret;
+    }
+
+    /* Reassemble the frame from the DEP chaining blocks */
+    if( ((uint32_t)link->rxFrameLen + link->depRxLen) > sizeof(link->rxFrame) )
+    {
+        link->state = RFAL_LLCP_LINK_ST_CLOSED;
+        return ERR_NOMEM;
+    }
+    ST_MEMCPY( &link->rxFrame[link->rxFrameLen], link->depRxBuf.inf, link->depRxLen );
+    link->rxFrameLen += link->depRxLen;
+
+    if( ret == ERR_AGAIN )
+    {
+        return ERR_BUSY;
+    }
+
+    return rfalLlcpProcessFrame( link, link->rxFrame, link->rxFrameLen );
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalLlcpLoopbackExchange( rfalLlcpLink *initiator, rfalLlcpLink *target )
+{
+    rfalLlcpLink   *tx;
+    rfalLlcpLink   *rx;
+    const uint8_t  *frame;
+    uint16_t       frameLen;
+    ReturnCode     ret;
+    uint8_t        i;
+
+    if( (initiator == NULL) || (target == NULL) || (initiator->nfcDepDev != NULL) || (target->nfcDepDev != NULL) )
+    {
+        return ERR_WRONG_STATE;
+    }
+
+    /* One symmetric exchange: Initiator frame first, then the Target's answer */
+    for( i = 0; i < 2U; i++ )
+    {
+        tx = ((i == 0U) ? initiator : target);
+        rx = ((i == 0U) ? target    : initiator);
+
+        EXIT_ON_ERR( ret, rfalLlcpGetFrame( tx, &frame, &frameLen ) );
+
+        /* Hand the frame over as a transport would, within the receiver's link MIU */
+        if( frameLen > sizeof(rx->rxFrame) )
+        {
+            return ERR_NOMEM;
+        }
+        ST_MEMCPY( rx->rxFrame, frame, frameLen );
+        rx->rxFrameLen = frameLen;
+
+        EXIT_ON_ERR( ret, rfalLlcpProcessFrame( rx, rx->rxFrame, rx->rxFrameLen ) );
+    }
+
+    return ERR_NONE;
+}
+
+#endif /* RFAL_FEATURE_LLCP */
@@ -54,6 +54,36 @@
 #include "rfal_analogConfig.h"
 
 
+/*
+ ******************************************************************************
+ * ENABLE SWITCH
+ ******************************************************************************
+ */
+#ifndef RFAL_FEATURE_NFC_TRACE
+    #define RFAL_FEATURE_NFC_TRACE   false    /* NFC trace configuration missing. Disabled by default */
+#endif
+
+#ifndef RFAL_FEATURE_NFC_TRACE_LEN
+    #define RFAL_FEATURE_NFC_TRACE_LEN   32U  /* NFC trace ring buffer length (entries) */
+#endif
+
+#if RFAL_FEATURE_NFC_TRACE && ((RFAL_FEATURE_NFC_TRACE_LEN == 0U) || (RFAL_FEATURE_NFC_TRACE_LEN > 255U))
+    #error " RFAL: Invalid NFC trace length. Please change RFAL_FEATURE_NFC_TRACE_LEN. "
+#endif
+
+#ifndef RFAL_FEATURE_NFC_INVENTORY
+    #define RFAL_FEATURE_NFC_INVENTORY   false    /* NFC inventory configuration missing. Disabled by default */
+#endif
+
+#ifndef RFAL_FEATURE_NFC_INVENTORY_LEN
+    #define RFAL_FEATURE_NFC_INVENTORY_LEN   16U  /* NFC inventory table length (UIDs) */
+#endif
+
+#if RFAL_FEATURE_NFC_INVENTORY && ((RFAL_FEATURE_NFC_INVENTORY_LEN == 0U) || (RFAL_FEATURE_NFC_INVENTORY_LEN > 255U))
+    #error " RFAL: Invalid NFC inventory length. Please change RFAL_FEATURE_NFC_INVENTORY_LEN. "
+#endif
+
+
 /*
 ******************************************************************************
 * GLOBAL DEFINES
@@ -72,6 +102,35 @@
 
 #define rfalNfcNfcNotify( st )         if( gNfcDev.disc.notifyCb != NULL )  gNfcDev.disc.notifyCb( st )
 
+#if RFAL_FEATURE_NFC_TRACE
+    #define rfalNfcTraceStart()                   gNfcDev.trace.phaseTick = platformGetSysTick()
+    #define rfalNfcTrace( evt, info, err )        rfalNfcTraceLog( (evt), (uint16_t)(info), (err), gNfcDev.trace.phaseTick )
+    #define rfalNfcTraceState()                   rfalNfcTraceStateChange()
+#else
+    #define rfalNfcTraceStart()
+    #define rfalNfcTrace( evt, info, err )
+    #define rfalNfcTraceState()
+#endif /* RFAL_FEATURE_NFC_TRACE */
+
+#if RFAL_FEATURE_NFC_INVENTORY
+    #define rfalNfcInvSetRssi( dev )              rfalNfcInvRefreshRssi( (dev) )
+    #define rfalNfcInvAge()                       rfalNfcInvAgeing()
+    #define rfalNfcInvTrack( from )               rfalNfcInvUpdate( (from) )
+    #define rfalNfcInvHandled( dev )              rfalNfcInvSetHandled( (dev) )
+    #define rfalNfcColResLimit()                  ( (gNfcDev.disc.invSkipHandled) ? (uint8_t)(RFAL_NFC_MAX_DEVICES - gNfcDev.devCnt) : (uint8_t)(gNfcDev.disc.devLimit - gNfcDev.devCnt) )  /* Handled devices are dropped after resolution, do not let them take the devLimit */
+#else
+    #define rfalNfcInvSetRssi( dev )
+    #define rfalNfcInvAge()
+    #define rfalNfcInvTrack( from )
+    #define rfalNfcInvHandled( dev )
+    #define rfalNfcColResLimit()                  (uint8_t)(gNfcDev.disc.devLimit - gNfcDev.devCnt)
+#endif /* RFAL_FEATURE_NFC_INVENTORY */
+
+#define rfalNfcPollStartState()        ( (gNfcDev.disc.reacquireEnabled && gNfcDev.lastDevValid) ? RFAL_NFC_STATE_POLL_REACQUIRE : RFAL_NFC_STATE_POLL_TECHDETECT )
+
+#define rfalNfcIsoDepAutoBR()          ( (gNfcDev.disc.isoDepBRAuto) ? (rfalBitRate)( (gNfcDev.disc.compMode == RFAL_COMPLIANCE_MODE_ISO) ? (uint8_t)rfalGetMaxBrRW() : MIN( (uint8_t)rfalGetMaxBrRW(), (uint8_t)RFAL_BR_848 ) ) : RFAL_BR_424 )  /* PRQA S 4342 # MISRA 10.5 - Layout of enum rfalBitRate guarantees no invalid enum values to be created */
+#define rfalNfcIsoDepPpsBR()           ( (rfalBitRate)MIN( (uint8_t)gNfcDev.isoDepMaxBR, (uint8_t)RFAL_BR_848 ) )  /* PRQA S 4342 # MISRA 10.5 - Layout of enum rfalBitRate guarantees no invalid enum values to be created */
+
 
 /*
 ******************************************************************************
@@ -79,6 +138,64 @@
 ******************************************************************************
 */
 
+#if RFAL_FEATURE_NFC_TRACE
+typedef struct{
+    rfalNfcTraceEntry       buf[RFAL_FEATURE_NFC_TRACE_LEN]; /* Trace ring buffer                  */
+    uint8_t                 head;               /* Next entry to be written                        */
+    uint8_t                 cnt;                /* Number of entries on the ring buffer            */
+    uint16_t                lost;               /* Entries overwritten since last read             */
+    uint32_t                phaseTick;          /* Current phase start tick                        */
+    uint32_t                stateTick;          /* Current state start tick                        */
+    rfalNfcState            state;              /* Last traced state                               */
+}rfalNfcTraceCtx;
+#endif /* RFAL_FEATURE_NFC_TRACE */
+
+#if RFAL_FEATURE_NFC_INVENTORY
+typedef struct{
+    rfalNfcInvEntry         tbl[RFAL_FEATURE_NFC_INVENTORY_LEN]; /* Devices seen recently             */
+    uint8_t                 cnt;                /* Number of entries on the table                  */
+}rfalNfcInvCtx;
+#endif /* RFAL_FEATURE_NFC_INVENTORY */
+
+/*! Poller working buffer, only one technology is detected/resolved at a time */
+typedef union{  /*  PRQA S 0750 # MISRA 19.2 - Members of the union will not be used concurrently, only one technology at a time */
+#if RFAL_FEATURE_NFCA
+    rfalNfcaSensRes         nfcaSensRes;                         /* NFC-A Technology Detection SENS_RES  */
+    rfalNfcaListenDevice    nfcaDevList[RFAL_NFC_MAX_DEVICES];   /* NFC-A Collision Resolution devices   */
+    struct{
+        rfalNfcaSensRes     sensRes;                             /* NFC-A Re-acquisition SENS_RES        */
+        rfalNfcaSelRes      selRes;                              /* NFC-A Re-acquisition SEL_RES         */
+    }nfcaReacq;
+#endif /* RFAL_FEATURE_NFCA */
+#if RFAL_FEATURE_NFCB
+    struct{
+        rfalNfcbSensbRes    sensbRes;                            /* NFC-B Technology Detection SENSB_RES */
+        uint8_t             sensbResLen;                         /* NFC-B SENSB_RES length               */
+    }nfcbDet;
+    rfalNfcbListenDevice    nfcbDevList[RFAL_NFC_MAX_DEVICES];   /* NFC-B Collision Resolution devices   */
+#endif /* RFAL_FEATURE_NFCB */
+#if RFAL_FEATURE_NFCF
+    rfalNfcfListenDevice    nfcfDevList[RFAL_NFC_MAX_DEVICES];   /* NFC-F Collision Resolution devices   */
+    struct{
+        rfalFeliCaPollRes   pollRes;                             /* NFC-F Re-acquisition SENSF_RES       */
+        uint8_t             pollFound;                           /* NFC-F Re-acquisition responses       */
+        uint8_t             pollCollision;                       /* NFC-F Re-acquisition collisions      */
+    }nfcfReacq;
+#endif /* RFAL_FEATURE_NFCF */
+#if RFAL_FEATURE_NFCV
+    rfalNfcvInventoryRes    nfcvInvRes;                          /* NFC-V Technology Detection INVENTORY_RES */
+    rfalNfcvListenDevice    nfcvDevList[RFAL_NFC_MAX_DEVICES];   /* NFC-V Collision Resolution devices   */
+#endif /* RFAL_FEATURE_NFCV */
+#if RFAL_FEATURE_ST25TB
+    rfalSt25tbListenDevice  st25tbDevList[RFAL_NFC_MAX_DEVICES]; /* ST25TB Collision Resolution devices  */
+    struct{
+        uint8_t             chipId;                              /* ST25TB Re-acquisition chip ID        */
+        rfalSt25tbUID       uid;                                 /* ST25TB Re-acquisition UID            */
+    }st25tbReacq;
+#endif /* RFAL_FEATURE_ST25TB */
+    uint8_t                 dummy;                               /* Keeps the union valid when all techs are disabled */
+}rfalNfcPollBuffer;
+
 typedef struct{
     rfalNfcState            state;              /* Main state                                      */
     uint16_t                techsFound;         /* Technologies found bitmask                      */
@@ -98,6 +215,26 @@ typedef struct{
     rfalNfcBuffer           txBuf;              /* Tx buffer for Data Exchange                     */
     rfalNfcBuffer           rxBuf;              /* Rx buffer for Data Exchange                     */
     uint16_t                rxLen;              /* Length of received data on Data Exchange        */
+    
+    rfalNfcDevice           lastDev;            /* Last activated Poll device (re-acquisition)     */
+    bool                    lastDevValid;       /* Flag indicating lastDev holds a device          */
+    rfalBitRate             isoDepMaxBR;        /* ISO-DEP max bit rate of the ongoing activation  */
+    rfalBitRate             lastDevMaxBR;       /* ISO-DEP max bit rate of lastDev, lowered if it was deactivated on a degraded link */
+    
+    rfalNfcPollBuffer       pollBuf;            /* Tech Detection / Coll Resolution working buffer */
+    uint8_t                 pollDevCnt;         /* Devices found by the ongoing Coll Resolution    */
+    bool                    pollColPending;     /* Collisions left by the ongoing Coll Resolution  */
+    bool                    isTechInit;         /* Current technology has been initialized         */
+    bool                    isOperOngoing;      /* Current technology operation has been started   */
+    uint8_t                 reacqStep;          /* Re-acquisition command being performed          */
+    
+#if RFAL_FEATURE_NFC_TRACE
+    rfalNfcTraceCtx         trace;              /* Discovery phase trace                           */
+#endif /* RFAL_FEATURE_NFC_TRACE */
+
+#if RFAL_FEATURE_NFC_INVENTORY
+    rfalNfcInvCtx           inv;                /* Inventory of devices seen recently              */
+#endif /* RFAL_FEATURE_NFC_INVENTORY */
 }rfalNfc;
 
   
@@ -115,24 +252,57 @@ static rfalNfc gNfcDev;
 */
 static ReturnCode rfalNfcPollTechDetetection( void );
 static ReturnCode rfalNfcPollCollResolution( void );
+static void rfalNfcPollTechDone( uint16_t tech );
 static ReturnCode rfalNfcPollActivation( uint8_t devIt );
+static ReturnCode rfalNfcPollReacquisition( void );
 static ReturnCode rfalNfcDeactivation( void );
 
 #if RFAL_FEATURE_NFC_DEP
 static ReturnCode rfalNfcNfcDepActivate( rfalNfcDevice *device, rfalNfcDepCommMode commMode, const uint8_t *atrReq, uint16_t atrReqLen );
+static void rfalNfcNfcDepPollParam( rfalNfcDevice *device, rfalNfcDepCommMode commMode, rfalNfcDepAtrParam *initParam );
+static ReturnCode rfalNfcNfcDepStartTransceive( uint16_t txDataLen );
 #endif /* RFAL_FEATURE_NFC_DEP */
 
+#if RFAL_FEATURE_ISO_DEP_POLL
+static void rfalNfcPollIsoDepVHBR( rfalIsoDepDevice *isoDepDev );
+static bool rfalNfcPollIsLastDev( const rfalNfcDevice *dev );
+#endif /* RFAL_FEATURE_ISO_DEP_POLL */
+
 #if RFAL_FEATURE_LISTEN_MODE
 static ReturnCode rfalNfcListenActivation( void );
 #endif /* RFAL_FEATURE_LISTEN_MODE*/
 
+#if RFAL_FEATURE_NFC_TRACE
+static void rfalNfcTraceLog( rfalNfcTraceEvt evt, uint16_t info, ReturnCode err, uint32_t startTick );
+static void rfalNfcTraceStateChange( void );
+#endif /* RFAL_FEATURE_NFC_TRACE */
+
+#if RFAL_FEATURE_NFC_INVENTORY
+static void rfalNfcInvAgeing( void );
+static void rfalNfcInvUpdate( uint8_t from );
+static void rfalNfcInvSetHandled( const rfalNfcDevice *dev );
+static void rfalNfcInvRefreshRssi( rfalNfcDevice *dev );
+#endif /* RFAL_FEATURE_NFC_INVENTORY */
+
 
 /*******************************************************************************/
 ReturnCode rfalNfcInitialize( void )
 {
     ReturnCode err;
     
-    gNfcDev.state = RFAL_NFC_STATE_NOTINIT;
+    gNfcDev.state        = RFAL_NFC_STATE_NOTINIT;
+    gNfcDev.lastDevValid = false;
+    gNfcDev.isoDepMaxBR  = RFAL_BR_424;
+    gNfcDev.lastDevMaxBR = RFAL_BR_KEEP;
+    
+#if RFAL_FEATURE_NFC_TRACE
+    ST_MEMSET( &gNfcDev.trace, 0x00, sizeof(rfalNfcTraceCtx) );
+    gNfcDev.trace.stateTick = platformGetSysTick();
+#endif /* RFAL_FEATURE_NFC_TRACE */
+    
+#if RFAL_FEATURE_NFC_INVENTORY
+    gNfcDev.inv.cnt = 0;
+#endif /* RFAL_FEATURE_NFC_INVENTORY */
     
     rfalAnalogConfigInitialize();              /* Initialize RFAL's Analog Configs */
     EXIT_ON_ERR( err, rfalInitialize() );      /* Initialize RFAL */
@@ -158,6 +328,13 @@ ReturnCode rfalNfcDiscover( const rfalNfcDiscoverParam *disParams )
         return ERR_PARAM;
     }
     
+#if RFAL_FEATURE_NFC_INVENTORY
+    if( disParams->invTtl == 0U )
+    {
+        return ERR_PARAM;
+    }
+#endif /* RFAL_FEATURE_NFC_INVENTORY */
+    
     if( (((disParams->techs2Find & RFAL_NFC_POLL_TECH_A) != 0U)      && !((bool)RFAL_FEATURE_NFCA))    ||
         (((disParams->techs2Find & RFAL_NFC_POLL_TECH_B) != 0U)      && !((bool)RFAL_FEATURE_NFCB))    ||
         (((disParams->techs2Find & RFAL_NFC_POLL_TECH_F) != 0U)      && !((bool)RFAL_FEATURE_NFCF))    ||
@@ -203,6 +380,8 @@ ReturnCode rfalNfcDiscover( const rfalNfcDiscoverParam *disParams )
 /*******************************************************************************/
 ReturnCode rfalNfcDeactivate( bool discovery )
 {
+    ReturnCode err;
+    
     /* Check for valid state */
     if( gNfcDev.state <= RFAL_NFC_STATE_IDLE )
     {
@@ -219,8 +398,13 @@ ReturnCode rfalNfcDeactivate( bool discovery )
     else
     {
         /* Otherwise deactivate immediately and go to IDLE */
-        rfalNfcDeactivation();
+        rfalNfcTraceStart();
+        err = rfalNfcDeactivation();
+        rfalNfcTrace( RFAL_NFC_TRACE_EVT_DEACTIVATION, 0U, err );
+        NO_WARNING(err);
+        
         gNfcDev.state = RFAL_NFC_STATE_IDLE;
+        rfalNfcTraceState();
     }
     
     return ERR_NONE;
@@ -293,6 +477,84 @@ ReturnCode rfalNfcGetActiveDevice( rfalNfcDevice **dev )
     return ERR_NONE;
 }
 
+/*******************************************************************************/
+ReturnCode rfalNfcTraceRead( rfalNfcTraceEntry *entries, uint8_t maxEntries, uint8_t *entriesCnt, uint16_t *lostCnt )
+{
+#if RFAL_FEATURE_NFC_TRACE
+    uint8_t tail;
+    
+    /* Check valid parameters */
+    if( (entries == NULL) || (entriesCnt == NULL) )
+    {
+        return ERR_PARAM;
+    }
+    
+    /* Oldest entry is located cnt positions behind head */
+    tail        = (uint8_t)((gNfcDev.trace.head + RFAL_FEATURE_NFC_TRACE_LEN - gNfcDev.trace.cnt) % RFAL_FEATURE_NFC_TRACE_LEN);
+    *entriesCnt = 0;
+    
+    while( (gNfcDev.trace.cnt > 0U) && (*entriesCnt < maxEntries) )
+    {
+        entries[*entriesCnt] = gNfcDev.trace.buf[tail];
+        tail                 = (uint8_t)((tail + 1U) % RFAL_FEATURE_NFC_TRACE_LEN);
+        
+        gNfcDev.trace.cnt--;
+        (*entriesCnt)++;
+    }
+    
+    if( lostCnt != NULL )
+    {
+        *lostCnt = gNfcDev.trace.lost;
+    }
+    gNfcDev.trace.lost = 0;
+    
+    return ERR_NONE;
+#else
+    
+    NO_WARNING(entries);
+    NO_WARNING(maxEntries);
+    NO_WARNING(entriesCnt);
+    NO_WARNING(lostCnt);
+    
+    return ERR_DISABLED;
+#endif /* RFAL_FEATURE_NFC_TRACE */
+}
+
+/*******************************************************************************/
+ReturnCode rfalNfcInventoryRead( rfalNfcInvEntry *entries, uint8_t maxEntries, uint8_t *entriesCnt )
+{
+#if RFAL_FEATURE_NFC_INVENTORY
+    /* Check valid parameters */
+    if( (entries == NULL) || (entriesCnt == NULL) )
+    {
+        return ERR_PARAM;
+    }
+    
+    *entriesCnt = MIN( gNfcDev.inv.cnt, maxEntries );
+    ST_MEMCPY( entries, gNfcDev.inv.tbl, ((uint32_t)*entriesCnt * sizeof(rfalNfcInvEntry)) );
+    
+    return ERR_NONE;
+#else
+    
+    NO_WARNING(entries);
+    NO_WARNING(maxEntries);
+    NO_WARNING(entriesCnt);
+    
+    return ERR_DISABLED;
+#endif /* RFAL_FEATURE_NFC_INVENTORY */
+}
+
+/*******************************************************************************/
+ReturnCode rfalNfcInventoryClear( void )
+{
+#if RFAL_FEATURE_NFC_INVENTORY
+    gNfcDev.inv.cnt = 0;
+    return ERR_NONE;
+#else
+    return ERR_DISABLED;
+#endif /* RFAL_FEATURE_NFC_INVENTORY */
+}
+
 /*******************************************************************************/
 void rfalNfcWorker( void )
 {
@@ -300,6 +562,8 @@ void rfalNfcWorker( void )
    
     rfalWorker();                                                                     /* Execute RFAL process  */
     
+    rfalNfcTraceState();                                                              /* Trace state changes triggered by the API calls */
+    
     switch( gNfcDev.state )
     {   
         /*******************************************************************************/
@@ -315,7 +579,10 @@ void rfalNfcWorker( void )
             gNfcDev.selDevIdx   = 0;
             gNfcDev.techsFound  = RFAL_NFC_TECH_NONE;
             gNfcDev.techs2do    = gNfcDev.disc.techs2Find;
-            gNfcDev.state       = RFAL_NFC_STATE_POLL_TECHDETECT;
+            gNfcDev.state       = rfalNfcPollStartState();
+            gNfcDev.discTmr     = (uint32_t)platformTimerCreate( gNfcDev.disc.totalDuration ); /* Start total duration timer */
+            rfalNfcPollTechDone( RFAL_NFC_TECH_NONE );
+            rfalNfcInvAge();                                                          /* Raise departure of devices no longer seen */
         
         #if RFAL_FEATURE_WAKEUP_MODE    
             /* Check if Low power Wake-Up is to be performed */
@@ -340,7 +607,8 @@ void rfalNfcWorker( void )
             if( rfalWakeUpModeHasWoke() )
             {
                 rfalWakeUpModeStop();                                                 /* Disable Wake-up mode           */
-                gNfcDev.state = RFAL_NFC_STATE_POLL_TECHDETECT;                       /* Go to Technology detection     */
+                gNfcDev.state   = rfalNfcPollStartState();                            /* Go to Re-acquisition or Technology detection */
+                gNfcDev.discTmr = (uint32_t)platformTimerCreate( gNfcDev.disc.totalDuration ); /* Restart total duration timer, the wake-up wait is not part of it */
                 
                 rfalNfcNfcNotify( gNfcDev.state );                                    /* Notify caller that WU has woke */
             }
@@ -348,15 +616,49 @@ void rfalNfcWorker( void )
 
             break;
             
+        /*******************************************************************************/
+        case RFAL_NFC_STATE_POLL_REACQUIRE:
+            
+            if( !gNfcDev.isTechInit )
+            {
+                rfalNfcTraceStart();
+            }
+            
+            err = rfalNfcPollReacquisition();                                         /* Try to directly retrieve the last activated device */
+            if( err == ERR_BUSY )
+            {
+                break;
+            }
+            
+            rfalNfcPollTechDone( RFAL_NFC_TECH_NONE );
+            rfalNfcTrace( RFAL_NFC_TRACE_EVT_REACQUIRE, gNfcDev.lastDev.type, err );
+            if( err == ERR_NONE )
+            {
+                rfalNfcInvSetRssi( &gNfcDev.devList[0] );                              /* Reacquired device answered last, colres did not run */
+                rfalNfcInvTrack( 0U );                                                /* Refresh the inventory, device may be dropped if already handled */
+            }
+            
+            if( (err == ERR_NONE) && (gNfcDev.devCnt != 0U) )
+            {
+                gNfcDev.selDevIdx = 0U;
+                gNfcDev.state     = RFAL_NFC_STATE_POLL_ACTIVATION;                   /* Device is back, skip Tech Detection and Collision Resolution */
+                break;
+            }
+            
+            rfalFieldOff();                                                           /* Reset any device left half selected */
+            gNfcDev.devCnt     = 0;
+            gNfcDev.techsFound = RFAL_NFC_TECH_NONE;
+            gNfcDev.state      = RFAL_NFC_STATE_POLL_TECHDETECT;                      /* Not found, fallback to full discovery */
+            break;
+            
         /*******************************************************************************/
         case RFAL_NFC_STATE_POLL_TECHDETECT:
             
-            /* Start total duration timer */
-            gNfcDev.discTmr = (uint32_t)platformTimerCreate( gNfcDev.disc.totalDuration );
-        
             err = rfalNfcPollTechDetetection();                                       /* Perform Technology Detection                         */
             if( err != ERR_BUSY )                                                     /* Wait until all technologies are performed            */
             {
+                rfalNfcPollTechDone( RFAL_NFC_TECH_NONE );                            /* Discard any technology left half performed           */
+                
                 if( ( err != ERR_NONE) || (gNfcDev.techsFound == RFAL_NFC_TECH_NONE) )/* Check if any error occurred or no techs were found   */
                 {
                     rfalFieldOff();
@@ -376,6 +678,13 @@ void rfalNfcWorker( void )
             err = rfalNfcPollCollResolution();                                        /* Resolve any eventual collision                       */
             if( err != ERR_BUSY )                                                     /* Wait until all technologies are performed            */
             {
+                rfalNfcPollTechDone( RFAL_NFC_TECH_NONE );                            /* Discard any technology left half performed           */
+                
+                if( gNfcDev.devCnt > gNfcDev.disc.devLimit )                          /* Handled devices were dropped per technology, trim to devLimit */
+                {
+                    gNfcDev.devCnt = gNfcDev.disc.devLimit;
+                }
+                
                 if( (err != ERR_NONE) || (gNfcDev.devCnt == 0U) )                     /* Check if any error occurred or no devices were found */
                 {
                     gNfcDev.state = RFAL_NFC_STATE_DEACTIVATION;
@@ -404,12 +713,29 @@ void rfalNfcWorker( void )
         /*******************************************************************************/
         case RFAL_NFC_STATE_POLL_ACTIVATION:
             
-            if( rfalNfcPollActivation( gNfcDev.selDevIdx ) != ERR_NONE )              /* Activate selected device           */
+            rfalNfcTraceStart();
+            gNfcDev.isoDepMaxBR = rfalNfcIsoDepAutoBR();                              /* A new activation starts at the highest bit rate */
+        #if RFAL_FEATURE_ISO_DEP_POLL
+            if( !rfalNfcPollIsLastDev( &gNfcDev.devList[gNfcDev.selDevIdx] ) )
             {
-                gNfcDev.state = RFAL_NFC_STATE_DEACTIVATION;                          /* If Activation failed, restart loop */
+                gNfcDev.lastDevMaxBR = RFAL_BR_KEEP;                                  /* A lowered bit rate only applies to the same device */
+            }
+            gNfcDev.isoDepMaxBR = (rfalBitRate)MIN( (uint8_t)gNfcDev.isoDepMaxBR, (uint8_t)gNfcDev.lastDevMaxBR );  /* PRQA S 4342 # MISRA 10.5 - Layout of enum rfalBitRate guarantees no invalid enum values to be created */
+        #endif /* RFAL_FEATURE_ISO_DEP_POLL */
+            err = rfalNfcPollActivation( gNfcDev.selDevIdx );                         /* Activate selected device           */
+            rfalNfcTrace( RFAL_NFC_TRACE_EVT_ACTIVATION, gNfcDev.devList[gNfcDev.selDevIdx].type, err );
+            if( err != ERR_NONE )
+            {
+                gNfcDev.lastDevValid = false;                                         /* Do not try to re-acquire it again  */
+                gNfcDev.state        = RFAL_NFC_STATE_DEACTIVATION;                   /* If Activation failed, restart loop */
                 break;
             }
             
+            /* Keep the activated device for a later re-acquisition (AP2P is already activated on Tech Detection) */
+            gNfcDev.lastDev      = *gNfcDev.activeDev;
+            gNfcDev.lastDevValid = (gNfcDev.activeDev->type != RFAL_NFC_LISTEN_TYPE_AP2P);
+            rfalNfcInvHandled( gNfcDev.activeDev );                                   /* Do not activate it again while on the inventory */
+            
             gNfcDev.state = RFAL_NFC_STATE_ACTIVATED;                                 /* Device has been properly activated */
             rfalNfcNfcNotify( gNfcDev.state );                                        /* Inform upper layer that a device has been activated */
             break;
@@ -436,7 +762,9 @@ void rfalNfcWorker( void )
         /*******************************************************************************/
         case RFAL_NFC_STATE_DEACTIVATION:
             
-            rfalNfcDeactivation();                                                    /* Deactivate current device */
+            rfalNfcTraceStart();
+            err = rfalNfcDeactivation();                                              /* Deactivate current device */
+            rfalNfcTrace( RFAL_NFC_TRACE_EVT_DEACTIVATION, 0U, err );
         
             gNfcDev.state = ((gNfcDev.discRestart) ? RFAL_NFC_STATE_START_DISCOVERY : RFAL_NFC_STATE_IDLE);
             rfalNfcNfcNotify( gNfcDev.state );                                        /* Notify caller             */
@@ -515,6 +843,8 @@ void rfalNfcWorker( void )
         default:
             return;
     }
+    
+    rfalNfcTraceState();                                                              /* Trace state changes triggered by the worker */
 }
 
 
@@ -543,7 +873,7 @@ ReturnCode rfalNfcDataExchangeStart( uint8_t *txData, uint16_t txDataLen, uint8_
             
             *rvdLen = (uint16_t*)&gNfcDev.rxLen;
             *rxData = (uint8_t*)(  (gNfcDev.activeDev->rfInterface == RFAL_NFC_INTERFACE_ISODEP) ? gNfcDev.rxBuf.isoDepBuf.inf : 
-                                  ((gNfcDev.activeDev->rfInterface == RFAL_NFC_INTERFACE_NFCDEP) ? gNfcDev.rxBuf.nfcDepBuf.inf : gNfcDev.rxBuf.rfBuf) );
+                                  ((gNfcDev.activeDev->rfInterface == RFAL_NFC_INTERFACE_NFCDEP) ? gNfcDev.rxBuf.nfcDepPduBuf.pdu : gNfcDev.rxBuf.rfBuf) );
             return ERR_NONE;
         }
         
@@ -566,7 +896,8 @@ ReturnCode rfalNfcDataExchangeStart( uint8_t *txData, uint16_t txDataLen, uint8_
             {
                 rfalIsoDepTxRxParam isoDepTxRx;
                 
-                if( txDataLen > 0U )
+                /* Data built in place with rfalNfcDataExchangeGetTxBuffer() is already on the INF */
+                if( (txDataLen > 0U) && (txData != gNfcDev.txBuf.isoDepBuf.inf) )
                 {
                     ST_MEMCPY( (uint8_t*)gNfcDev.txBuf.isoDepBuf.inf, txData, txDataLen );
                 }
@@ -595,32 +926,25 @@ ReturnCode rfalNfcDataExchangeStart( uint8_t *txData, uint16_t txDataLen, uint8_
         #if RFAL_FEATURE_NFC_DEP
             /*******************************************************************************/
             case RFAL_NFC_INTERFACE_NFCDEP:
-            {
-                rfalNfcDepTxRxParam nfcDepTxRx;
                 
-                if( txDataLen > 0U)
+                if( txDataLen > sizeof(gNfcDev.txBuf.nfcDepPduBuf.pdu) )
                 {
-                    ST_MEMCPY( (uint8_t*)gNfcDev.txBuf.nfcDepBuf.inf, txData, txDataLen );
+                    err = ERR_NOMEM;
+                    break;
                 }
                 
-                nfcDepTxRx.DID          = RFAL_NFCDEP_DID_KEEP;
-                nfcDepTxRx.FSx          = rfalNfcDepLR2FS( (uint8_t)rfalNfcDepPP2LR( gNfcDev.activeDev->proto.nfcDep.activation.Target.ATR_RES.PPt ) );
-                nfcDepTxRx.dFWT         = gNfcDev.activeDev->proto.nfcDep.info.dFWT;
-                nfcDepTxRx.FWT          = gNfcDev.activeDev->proto.nfcDep.info.FWT;
-                nfcDepTxRx.txBuf        = &gNfcDev.txBuf.nfcDepBuf;
-                nfcDepTxRx.txBufLen     = txDataLen;
-                nfcDepTxRx.isTxChaining = false;
-                nfcDepTxRx.rxBuf        = &gNfcDev.rxBuf.nfcDepBuf;
-                nfcDepTxRx.rxLen        = &gNfcDev.rxLen;
-                nfcDepTxRx.isRxChaining = &gNfcDev.isRxChaining;
-                *rxData                 = (uint8_t*)gNfcDev.rxBuf.nfcDepBuf.inf;
-                *rvdLen                 = (uint16_t*)&gNfcDev.rxLen;
+                if( (txDataLen > 0U) && (txData != gNfcDev.txBuf.nfcDepPduBuf.pdu) )
+                {
+                    ST_MEMCPY( (uint8_t*)gNfcDev.txBuf.nfcDepPduBuf.pdu, txData, txDataLen );
+                }
+                
+                *rxData = (uint8_t*)gNfcDev.rxBuf.nfcDepPduBuf.pdu;
+                *rvdLen = (uint16_t*)&gNfcDev.rxLen;
                 
                 /*******************************************************************************/
-                /* Trigger a RFAL NFC-DEP Transceive                                           */
-                err = rfalNfcDepStartTransceive( &nfcDepTxRx );                          
+                /* Trigger a RFAL NFC-DEP PDU Transceive, chaining is handled underneath       */
+                err = rfalNfcNfcDepStartTransceive( txDataLen );
                 break;
-            }
         #endif /* RFAL_FEATURE_NFC_DEP */
 
             /*******************************************************************************/
@@ -632,6 +956,9 @@ ReturnCode rfalNfcDataExchangeStart( uint8_t *txData, uint16_t txDataLen, uint8_
         /* If a transceive has succesfully started flag Data Exchange as ongoing */
         if( err == ERR_NONE )
         {
+            rfalNfcTraceState();
+            rfalNfcTraceStart();
+            
             gNfcDev.dataExErr = ERR_BUSY;
             gNfcDev.state     = RFAL_NFC_STATE_DATAEXCHANGE;
         }
@@ -643,6 +970,49 @@ ReturnCode rfalNfcDataExchangeStart( uint8_t *txData, uint16_t txDataLen, uint8_
 }
 
 
+/*******************************************************************************/
+ReturnCode rfalNfcDataExchangeGetTxBuffer( uint8_t **txData, uint16_t *txDataSize )
+{
+    if( (txData == NULL) || (txDataSize == NULL) )
+    {
+        return ERR_PARAM;
+    }
+    
+    if( (gNfcDev.state < RFAL_NFC_STATE_ACTIVATED) || (gNfcDev.activeDev == NULL) )
+    {
+        return ERR_WRONG_STATE;
+    }
+    
+    /* Location right after the room the interface needs for its own header/prologue */
+    switch( gNfcDev.activeDev->rfInterface )
+    {
+        case RFAL_NFC_INTERFACE_RF:
+            *txData     = gNfcDev.txBuf.rfBuf;
+            *txDataSize = (uint16_t)sizeof(gNfcDev.txBuf.rfBuf);
+            break;
+            
+    #if RFAL_FEATURE_ISO_DEP
+        case RFAL_NFC_INTERFACE_ISODEP:
+            *txData     = gNfcDev.txBuf.isoDepBuf.inf;
+            *txDataSize = (uint16_t)sizeof(gNfcDev.txBuf.isoDepBuf.inf);
+            break;
+    #endif /* RFAL_FEATURE_ISO_DEP */
+            
+    #if RFAL_FEATURE_NFC_DEP
+        case RFAL_NFC_INTERFACE_NFCDEP:
+            *txData     = gNfcDev.txBuf.nfcDepPduBuf.pdu;
+            *txDataSize = (uint16_t)sizeof(gNfcDev.txBuf.nfcDepPduBuf.pdu);
+            break;
+    #endif /* RFAL_FEATURE_NFC_DEP */
+            
+        default:
+            return ERR_PARAM;
+    }
+    
+    return ERR_NONE;
+}
+
+
 /*******************************************************************************/
 ReturnCode rfalNfcDataExchangeGetStatus( void )
 {
@@ -661,6 +1031,15 @@ ReturnCode rfalNfcDataExchangeGetStatus( void )
             /* Can only call rfalGetTransceiveStatus() after starting a transceive with rfalStartTransceive */
             gNfcDev.dataExErr = ERR_NONE;
         }
+        
+    #if RFAL_FEATURE_NFC_DEP
+        /* The first DEP has been retrieved on NFC-DEP activation, receive it as part of a complete PDU */
+        if( (gNfcDev.activeDev->rfInterface == RFAL_NFC_INTERFACE_NFCDEP) && rfalNfcIsRemDevPoller( gNfcDev.activeDev->type ) )
+        {
+            EXIT_ON_ERR( gNfcDev.dataExErr, rfalNfcNfcDepStartTransceive( 0 ) );
+            gNfcDev.dataExErr = ERR_BUSY;
+        }
+    #endif /* RFAL_FEATURE_NFC_DEP */
     }
     
     
@@ -699,7 +1078,7 @@ ReturnCode rfalNfcDataExchangeGetStatus( void )
             /*******************************************************************************/
         #if RFAL_FEATURE_NFC_DEP
             case RFAL_NFC_INTERFACE_NFCDEP:
-                gNfcDev.dataExErr = rfalNfcDepGetTransceiveStatus();
+                gNfcDev.dataExErr = rfalNfcDepGetPduTransceiveStatus();
                 break;
         #endif /* RFAL_FEATURE_NFC_DEP */
                 
@@ -709,6 +1088,11 @@ ReturnCode rfalNfcDataExchangeGetStatus( void )
                 break;
         }
         
+        if( gNfcDev.dataExErr != ERR_BUSY )
+        {
+            rfalNfcTrace( RFAL_NFC_TRACE_EVT_DATAEXCHANGE, gNfcDev.activeDev->rfInterface, gNfcDev.dataExErr );
+        }
+        
         
     #if  RFAL_FEATURE_LISTEN_MODE
         /*******************************************************************************/
@@ -755,18 +1139,43 @@ static ReturnCode rfalNfcPollTechDetetection( void )
     /*******************************************************************************/
     if( ((gNfcDev.disc.techs2Find & RFAL_NFC_POLL_TECH_AP2P) != 0U) && ((gNfcDev.techs2do & RFAL_NFC_POLL_TECH_AP2P) != 0U) )
     {
-        gNfcDev.techs2do &= ~RFAL_NFC_POLL_TECH_AP2P;
-        
     #if RFAL_FEATURE_NFC_DEP
-    
-        EXIT_ON_ERR( err, rfalSetMode( RFAL_MODE_POLL_ACTIVE_P2P, gNfcDev.disc.ap2pBR, gNfcDev.disc.ap2pBR ) );
-        rfalSetErrorHandling( RFAL_ERRORHANDLING_NFC );
-        rfalSetFDTListen( RFAL_FDT_LISTEN_AP2P_POLLER );
-        rfalSetFDTPoll( RFAL_TIMING_NONE );
-        rfalSetGT( RFAL_GT_AP2P_ADJUSTED );
-        EXIT_ON_ERR( err, rfalFieldOnAndStartGT() );                                     /* Turns the Field On and starts GT timer */
         
-        err = rfalNfcNfcDepActivate( gNfcDev.devList, RFAL_NFCDEP_COMM_ACTIVE, NULL, 0 );/* Poll for NFC-A devices */
+        if( !gNfcDev.isTechInit )
+        {
+            rfalNfcTraceStart();
+            EXIT_ON_ERR( err, rfalSetMode( RFAL_MODE_POLL_ACTIVE_P2P, gNfcDev.disc.ap2pBR, gNfcDev.disc.ap2pBR ) );
+            rfalSetErrorHandling( RFAL_ERRORHANDLING_NFC );
+            rfalSetFDTListen( RFAL_FDT_LISTEN_AP2P_POLLER );
+            rfalSetFDTPoll( RFAL_TIMING_NONE );
+            rfalSetGT( RFAL_GT_AP2P_ADJUSTED );
+            EXIT_ON_ERR( err, rfalFieldOnAndStartGT() );                              /* Turns the Field On and starts GT timer */
+            gNfcDev.isTechInit = true;
+        }
+        
+        if( !gNfcDev.isOperOngoing )
+        {
+            rfalNfcDepAtrParam atrParam;
+            
+            if( !rfalIsGTExpired() )                                                  /* Wait for GT without blocking */
+            {
+                return ERR_BUSY;
+            }
+            
+            rfalNfcNfcDepPollParam( gNfcDev.devList, RFAL_NFCDEP_COMM_ACTIVE, &atrParam );
+            EXIT_ON_ERR( err, rfalNfcDepInitiatorStartActivation( &atrParam, RFAL_BR_424, &gNfcDev.devList->proto.nfcDep ) ); /* Poll for AP2P devices: send ATR_REQ */
+            gNfcDev.isOperOngoing = true;
+            return ERR_BUSY;
+        }
+        
+        err = rfalNfcDepInitiatorGetActivationStatus();
+        if( err == ERR_BUSY )
+        {
+            return ERR_BUSY;
+        }
+        
+        rfalNfcTrace( RFAL_NFC_TRACE_EVT_TECHDETECT, RFAL_NFC_POLL_TECH_AP2P, err );
+        rfalNfcPollTechDone( RFAL_NFC_POLL_TECH_AP2P );
         if( err == ERR_NONE )
         {
             gNfcDev.techsFound |= RFAL_NFC_POLL_TECH_AP2P;
@@ -790,23 +1199,42 @@ static ReturnCode rfalNfcPollTechDetetection( void )
     /*******************************************************************************/
     if( ((gNfcDev.disc.techs2Find & RFAL_NFC_POLL_TECH_A) != 0U) && ((gNfcDev.techs2do & RFAL_NFC_POLL_TECH_A) != 0U) )
     {
-        gNfcDev.techs2do &= ~RFAL_NFC_POLL_TECH_A;
-        
     #if RFAL_FEATURE_NFCA
-        {
-            rfalNfcaSensRes sensRes;            
         
+        if( !gNfcDev.isTechInit )
+        {
+            rfalNfcTraceStart();
             EXIT_ON_ERR( err, rfalNfcaPollerInitialize() );                            /* Initialize RFAL for NFC-A */
             EXIT_ON_ERR( err, rfalFieldOnAndStartGT() );                               /* Turns the Field On and starts GT timer */
-                                                                                       
-            err = rfalNfcaPollerTechnologyDetection( gNfcDev.disc.compMode, &sensRes );/* Poll for NFC-A devices */
-            if( err == ERR_NONE )
+            gNfcDev.isTechInit = true;
+        }
+        
+        if( !gNfcDev.isOperOngoing )
+        {
+            if( !rfalIsGTExpired() )                                                   /* Wait for GT without blocking */
             {
-                gNfcDev.techsFound |= RFAL_NFC_POLL_TECH_A;
+                return ERR_BUSY;
             }
             
+            EXIT_ON_ERR( err, rfalNfcaPollerStartTechnologyDetection( gNfcDev.disc.compMode, &gNfcDev.pollBuf.nfcaSensRes ) ); /* Poll for NFC-A devices */
+            gNfcDev.isOperOngoing = true;
+            return ERR_BUSY;
+        }
+        
+        err = rfalNfcaPollerGetTechnologyDetectionStatus();
+        if( err == ERR_BUSY )
+        {
             return ERR_BUSY;
         }
+        
+        rfalNfcTrace( RFAL_NFC_TRACE_EVT_TECHDETECT, RFAL_NFC_POLL_TECH_A, err );
+        rfalNfcPollTechDone( RFAL_NFC_POLL_TECH_A );
+        if( err == ERR_NONE )
+        {
+            gNfcDev.techsFound |= RFAL_NFC_POLL_TECH_A;
+        }
+        
+        return ERR_BUSY;
     
     #endif /* RFAL_FEATURE_NFCA */
     }
@@ -817,24 +1245,42 @@ static ReturnCode rfalNfcPollTechDetetection( void )
     /*******************************************************************************/
     if( ((gNfcDev.disc.techs2Find & RFAL_NFC_POLL_TECH_B) != 0U) && ((gNfcDev.techs2do & RFAL_NFC_POLL_TECH_B) != 0U) )
     {
-        gNfcDev.techs2do &= ~RFAL_NFC_POLL_TECH_B;
-        
     #if RFAL_FEATURE_NFCB
-        {
-            rfalNfcbSensbRes sensbRes;
-            uint8_t          sensbResLen;            
         
+        if( !gNfcDev.isTechInit )
+        {
+            rfalNfcTraceStart();
             EXIT_ON_ERR( err, rfalNfcbPollerInitialize() );                           /* Initialize RFAL for NFC-B */
             EXIT_ON_ERR( err, rfalFieldOnAndStartGT() );                              /* As field is already On only starts GT timer */
-                                                                                                       
-            err = rfalNfcbPollerTechnologyDetection( gNfcDev.disc.compMode, &sensbRes, &sensbResLen ); /* Poll for NFC-B devices */
-            if( err == ERR_NONE )
+            gNfcDev.isTechInit = true;
+        }
+        
+        if( !gNfcDev.isOperOngoing )
+        {
+            if( !rfalIsGTExpired() )                                                  /* Wait for GT without blocking */
             {
-                gNfcDev.techsFound |= RFAL_NFC_POLL_TECH_B;
+                return ERR_BUSY;
             }
             
+            EXIT_ON_ERR( err, rfalNfcbPollerStartTechnologyDetection( gNfcDev.disc.compMode, &gNfcDev.pollBuf.nfcbDet.sensbRes, &gNfcDev.pollBuf.nfcbDet.sensbResLen ) ); /* Poll for NFC-B devices */
+            gNfcDev.isOperOngoing = true;
+            return ERR_BUSY;
+        }
+        
+        err = rfalNfcbPollerGetTechnologyDetectionStatus();
+        if( err == ERR_BUSY )
+        {
             return ERR_BUSY;
         }
+        
+        rfalNfcTrace( RFAL_NFC_TRACE_EVT_TECHDETECT, RFAL_NFC_POLL_TECH_B, err );
+        rfalNfcPollTechDone( RFAL_NFC_POLL_TECH_B );
+        if( err == ERR_NONE )
+        {
+            gNfcDev.techsFound |= RFAL_NFC_POLL_TECH_B;
+        }
+        
+        return ERR_BUSY;
     
     #endif /* RFAL_FEATURE_NFCB */
     }
@@ -844,14 +1290,36 @@ static ReturnCode rfalNfcPollTechDetetection( void )
     /*******************************************************************************/
     if( ((gNfcDev.disc.techs2Find & RFAL_NFC_POLL_TECH_F) != 0U) && ((gNfcDev.techs2do & RFAL_NFC_POLL_TECH_F) != 0U) )
     {
-        gNfcDev.techs2do &= ~RFAL_NFC_POLL_TECH_F;
-        
     #if RFAL_FEATURE_NFCF
-    
-        EXIT_ON_ERR( err, rfalNfcfPollerInitialize( gNfcDev.disc.nfcfBR ) );          /* Initialize RFAL for NFC-F */
-        EXIT_ON_ERR( err, rfalFieldOnAndStartGT() );                                  /* As field is already On only starts GT timer */
-                                                                                      
-        err = rfalNfcfPollerCheckPresence();                                          /* Poll for NFC-F devices */
+        
+        if( !gNfcDev.isTechInit )
+        {
+            rfalNfcTraceStart();
+            EXIT_ON_ERR( err, rfalNfcfPollerInitialize( gNfcDev.disc.nfcfBR ) );      /* Initialize RFAL for NFC-F */
+            EXIT_ON_ERR( err, rfalFieldOnAndStartGT() );                              /* As field is already On only starts GT timer */
+            gNfcDev.isTechInit = true;
+        }
+        
+        if( !gNfcDev.isOperOngoing )
+        {
+            if( !rfalIsGTExpired() )                                                  /* Wait for GT without blocking */
+            {
+                return ERR_BUSY;
+            }
+            
+            EXIT_ON_ERR( err, rfalNfcfPollerStartCheckPresence() );                   /* Poll for NFC-F devices */
+            gNfcDev.isOperOngoing = true;
+            return ERR_BUSY;
+        }
+        
+        err = rfalNfcfPollerGetCheckPresenceStatus();
+        if( err == ERR_BUSY )
+        {
+            return ERR_BUSY;
+        }
+        
+        rfalNfcTrace( RFAL_NFC_TRACE_EVT_TECHDETECT, RFAL_NFC_POLL_TECH_F, err );
+        rfalNfcPollTechDone( RFAL_NFC_POLL_TECH_F );
         if( err == ERR_NONE )
         {
             gNfcDev.techsFound |= RFAL_NFC_POLL_TECH_F;
@@ -868,23 +1336,42 @@ static ReturnCode rfalNfcPollTechDetetection( void )
     /*******************************************************************************/
     if( ((gNfcDev.disc.techs2Find & RFAL_NFC_POLL_TECH_V) != 0U) && ((gNfcDev.techs2do & RFAL_NFC_POLL_TECH_V) != 0U) )
     {
-        gNfcDev.techs2do &= ~RFAL_NFC_POLL_TECH_V;
-        
     #if RFAL_FEATURE_NFCV
+        
+        if( !gNfcDev.isTechInit )
         {
-            rfalNfcvInventoryRes invRes;
+            rfalNfcTraceStart();
+            EXIT_ON_ERR( err, rfalNfcvPollerInitialize() );                           /* Initialize RFAL for NFC-V */
+            EXIT_ON_ERR( err, rfalFieldOnAndStartGT() );                              /* As field is already On only starts GT timer */
+            gNfcDev.isTechInit = true;
+        }
         
-            EXIT_ON_ERR( err, rfalNfcvPollerInitialize() );                               /* Initialize RFAL for NFC-V */
-            EXIT_ON_ERR( err, rfalFieldOnAndStartGT() );                                  /* As field is already On only starts GT timer */
-                                                                                          
-            err = rfalNfcvPollerCheckPresence( &invRes );                                 /* Poll for NFC-V devices */
-            if( err == ERR_NONE )
+        if( !gNfcDev.isOperOngoing )
+        {
+            if( !rfalIsGTExpired() )                                                  /* Wait for GT without blocking */
             {
-                gNfcDev.techsFound |= RFAL_NFC_POLL_TECH_V;
+                return ERR_BUSY;
             }
             
+            EXIT_ON_ERR( err, rfalNfcvPollerStartCheckPresence( &gNfcDev.pollBuf.nfcvInvRes ) ); /* Poll for NFC-V devices */
+            gNfcDev.isOperOngoing = true;
             return ERR_BUSY;
         }
+        
+        err = rfalNfcvPollerGetCheckPresenceStatus();
+        if( err == ERR_BUSY )
+        {
+            return ERR_BUSY;
+        }
+        
+        rfalNfcTrace( RFAL_NFC_TRACE_EVT_TECHDETECT, RFAL_NFC_POLL_TECH_V, err );
+        rfalNfcPollTechDone( RFAL_NFC_POLL_TECH_V );
+        if( err == ERR_NONE )
+        {
+            gNfcDev.techsFound |= RFAL_NFC_POLL_TECH_V;
+        }
+        
+        return ERR_BUSY;
     
     #endif /* RFAL_FEATURE_NFCV */
     }
@@ -895,20 +1382,44 @@ static ReturnCode rfalNfcPollTechDetetection( void )
     /*******************************************************************************/  
     if( ((gNfcDev.disc.techs2Find & RFAL_NFC_POLL_TECH_ST25TB) != 0U) && ((gNfcDev.techs2do & RFAL_NFC_POLL_TECH_ST25TB) != 0U) )
     {
-        gNfcDev.techs2do &= ~RFAL_NFC_POLL_TECH_ST25TB;
-        
     #if RFAL_FEATURE_ST25TB
         
-        EXIT_ON_ERR( err, rfalSt25tbPollerInitialize() );                             /* Initialize RFAL for NFC-V */
-        EXIT_ON_ERR( err, rfalFieldOnAndStartGT() );                                  /* As field is already On only starts GT timer */
-        
-        err = rfalSt25tbPollerCheckPresence( NULL );                                  /* Poll for ST25TB devices */
-        if( err == ERR_NONE )
+        if( !gNfcDev.isTechInit )
         {
-            gNfcDev.techsFound |= RFAL_NFC_POLL_TECH_ST25TB;
+            rfalNfcTraceStart();
+            EXIT_ON_ERR( err, rfalSt25tbPollerInitialize() );                         /* Initialize RFAL for ST25TB */
+            EXIT_ON_ERR( err, rfalFieldOnAndStartGT() );                              /* As field is already On only starts GT timer */
+            gNfcDev.isTechInit = true;
         }
         
-    #endif /* RFAL_FEATURE_ST25TB */
+        if( !gNfcDev.isOperOngoing )
+        {
+            if( !rfalIsGTExpired() )                                                  /* Wait for GT without blocking */
+            {
+                return ERR_BUSY;
+            }
+            
+            EXIT_ON_ERR( err, rfalSt25tbPollerStartCheckPresence( NULL ) );           /* Poll for ST25TB devices */
+            gNfcDev.isOperOngoing = true;
+            return ERR_BUSY;
+        }
+        
+        err = rfalSt25tbPollerGetCheckPresenceStatus();
+        if( err == ERR_BUSY )
+        {
+            return ERR_BUSY;
+        }
+        
+        rfalNfcTrace( RFAL_NFC_TRACE_EVT_TECHDETECT, RFAL_NFC_POLL_TECH_ST25TB, err );
+        rfalNfcPollTechDone( RFAL_NFC_POLL_TECH_ST25TB );
+        if( err == ERR_NONE )
+        {
+            gNfcDev.techsFound |= RFAL_NFC_POLL_TECH_ST25TB;
+        }
+        
+        return ERR_BUSY;
+    
+    #endif /* RFAL_FEATURE_ST25TB */
     }
     
     return ERR_NONE;
@@ -930,16 +1441,13 @@ static ReturnCode rfalNfcPollTechDetetection( void )
 static ReturnCode rfalNfcPollCollResolution( void )
 {
     uint8_t    i;
-    uint8_t    devCnt;
     ReturnCode err;
     
     err    = ERR_NONE;
-    devCnt = 0;
     i      = 0;
     
     /* Supress warning when specific RFAL features have been disabled */
     NO_WARNING(err);
-    NO_WARNING(devCnt);
     NO_WARNING(i);
     
     /* Check if device limit has been reached */
@@ -954,22 +1462,43 @@ static ReturnCode rfalNfcPollCollResolution( void )
 #if RFAL_FEATURE_NFCA
     if( ((gNfcDev.techsFound & RFAL_NFC_POLL_TECH_A) != 0U) && ((gNfcDev.techs2do & RFAL_NFC_POLL_TECH_A) != 0U) )   /* If a NFC-A device was found/detected, perform Collision Resolution */
     {
-        rfalNfcaListenDevice nfcaDevList[RFAL_NFC_MAX_DEVICES];
+        if( !gNfcDev.isTechInit )
+        {
+            rfalNfcTraceStart();
+            EXIT_ON_ERR( err, rfalNfcaPollerInitialize() );                   /* Initialize RFAL for NFC-A */
+            EXIT_ON_ERR( err, rfalFieldOnAndStartGT() );                              /* Ensure GT again as other technologies have also been polled */
+            gNfcDev.isTechInit = true;
+        }
         
-        gNfcDev.techs2do &= ~RFAL_NFC_POLL_TECH_A;
+        if( !gNfcDev.isOperOngoing )
+        {
+            if( !rfalIsGTExpired() )                                                  /* Wait for GT without blocking */
+            {
+                return ERR_BUSY;
+            }
+            
+            EXIT_ON_ERR( err, rfalNfcaPollerStartFullCollisionResolution( gNfcDev.disc.compMode, rfalNfcColResLimit(), gNfcDev.pollBuf.nfcaDevList, &gNfcDev.pollDevCnt ) );
+            gNfcDev.isOperOngoing = true;
+            return ERR_BUSY;
+        }
         
-        EXIT_ON_ERR( err, rfalNfcaPollerInitialize());                                /* Initialize RFAL for NFC-A */
-        EXIT_ON_ERR( err, rfalFieldOnAndStartGT() );                                  /* Ensure GT again as other technologies have also been polled */
+        err = rfalNfcaPollerGetFullCollisionResolutionStatus();
+        if( err == ERR_BUSY )
+        {
+            return ERR_BUSY;
+        }
         
-        err = rfalNfcaPollerFullCollisionResolution( gNfcDev.disc.compMode, (gNfcDev.disc.devLimit - gNfcDev.devCnt), nfcaDevList, &devCnt );
-        if( (err == ERR_NONE) && (devCnt != 0U) )
+        rfalNfcTrace( RFAL_NFC_TRACE_EVT_COLRESOLUTION, RFAL_NFC_POLL_TECH_A, err );
+        rfalNfcPollTechDone( RFAL_NFC_POLL_TECH_A );
+        if( (err == ERR_NONE) && (gNfcDev.pollDevCnt != 0U) )
         {
-            for( i=0; i<devCnt; i++ )                                                 /* Copy devices found form local Nfca list into global device list */
+            for( i=0; i<gNfcDev.pollDevCnt; i++ )                                     /* Copy devices found form Nfca list into global device list */
             {
                 gNfcDev.devList[gNfcDev.devCnt].type     = RFAL_NFC_LISTEN_TYPE_NFCA;
-                gNfcDev.devList[gNfcDev.devCnt].dev.nfca = nfcaDevList[i];
+                gNfcDev.devList[gNfcDev.devCnt].dev.nfca = gNfcDev.pollBuf.nfcaDevList[i];
                 gNfcDev.devCnt++;
             }
+            rfalNfcInvTrack( (uint8_t)(gNfcDev.devCnt - gNfcDev.pollDevCnt) );   /* Refresh the inventory, dropping handled devices before the next limit */
         }
         
         return ERR_BUSY;
@@ -982,50 +1511,99 @@ static ReturnCode rfalNfcPollCollResolution( void )
 #if RFAL_FEATURE_NFCB
     if( ((gNfcDev.techsFound & RFAL_NFC_POLL_TECH_B) != 0U) && ((gNfcDev.techs2do & RFAL_NFC_POLL_TECH_B) != 0U) )   /* If a NFC-B device was found/detected, perform Collision Resolution */
     {
-        rfalNfcbListenDevice nfcbDevList[RFAL_NFC_MAX_DEVICES];
+        if( !gNfcDev.isTechInit )
+        {
+            rfalNfcTraceStart();
+            EXIT_ON_ERR( err, rfalNfcbPollerInitialize() );                   /* Initialize RFAL for NFC-B */
+            EXIT_ON_ERR( err, rfalFieldOnAndStartGT() );                              /* Ensure GT again as other technologies have also been polled */
+            gNfcDev.isTechInit = true;
+        }
         
-        gNfcDev.techs2do &= ~RFAL_NFC_POLL_TECH_B;
+        if( !gNfcDev.isOperOngoing )
+        {
+            if( !rfalIsGTExpired() )                                                  /* Wait for GT without blocking */
+            {
+                return ERR_BUSY;
+            }
+            
+            if( gNfcDev.disc.nfcbAdaptiveColRes )
+            {
+                EXIT_ON_ERR( err, rfalNfcbPollerStartAdaptiveCollisionResolution( gNfcDev.disc.compMode, rfalNfcColResLimit(), gNfcDev.pollBuf.nfcbDevList, &gNfcDev.pollDevCnt, &gNfcDev.pollColPending ) );
+            }
+            else
+            {
+                EXIT_ON_ERR( err, rfalNfcbPollerStartCollisionResolution( gNfcDev.disc.compMode, rfalNfcColResLimit(), gNfcDev.pollBuf.nfcbDevList, &gNfcDev.pollDevCnt ) );
+            }
+            gNfcDev.isOperOngoing = true;
+            return ERR_BUSY;
+        }
         
-        EXIT_ON_ERR( err, rfalNfcbPollerInitialize());                                /* Initialize RFAL for NFC-B */
-        EXIT_ON_ERR( err, rfalFieldOnAndStartGT() );                                  /* Ensure GT again as other technologies have also been polled */
+        err = ( (gNfcDev.disc.nfcbAdaptiveColRes) ? rfalNfcbPollerGetAdaptiveCollisionResolutionStatus() : rfalNfcbPollerGetCollisionResolutionStatus() );
+        if( err == ERR_BUSY )
+        {
+            return ERR_BUSY;
+        }
         
-        err = rfalNfcbPollerCollisionResolution( gNfcDev.disc.compMode, (gNfcDev.disc.devLimit - gNfcDev.devCnt), nfcbDevList, &devCnt );
-        if( (err == ERR_NONE) && (devCnt != 0U) )
+        rfalNfcTrace( RFAL_NFC_TRACE_EVT_COLRESOLUTION, RFAL_NFC_POLL_TECH_B, err );
+        rfalNfcPollTechDone( RFAL_NFC_POLL_TECH_B );
+        if( (err == ERR_NONE) && (gNfcDev.pollDevCnt != 0U) )
         {
-            for( i=0; i<devCnt; i++ )                                                 /* Copy devices found form local Nfcb list into global device list */
+            for( i=0; i<gNfcDev.pollDevCnt; i++ )                                     /* Copy devices found form Nfcb list into global device list */
             {
                 gNfcDev.devList[gNfcDev.devCnt].type     = RFAL_NFC_LISTEN_TYPE_NFCB;
-                gNfcDev.devList[gNfcDev.devCnt].dev.nfcb = nfcbDevList[i];
+                gNfcDev.devList[gNfcDev.devCnt].dev.nfcb = gNfcDev.pollBuf.nfcbDevList[i];
                 gNfcDev.devCnt++;
             }
+            rfalNfcInvTrack( (uint8_t)(gNfcDev.devCnt - gNfcDev.pollDevCnt) );   /* Refresh the inventory, dropping handled devices before the next limit */
         }
         
         return ERR_BUSY;
     }
-#endif /* RFAL_FEATURE_NFCB*/
+#endif /* RFAL_FEATURE_NFCB */
     
     /*******************************************************************************/
     /* NFC-F Collision Resolution                                                  */
     /*******************************************************************************/
 #if RFAL_FEATURE_NFCF
-    if( ((gNfcDev.techsFound & RFAL_NFC_POLL_TECH_F) != 0U) && ((gNfcDev.techs2do & RFAL_NFC_POLL_TECH_F) != 0U) )  /* If a NFC-F device was found/detected, perform Collision Resolution */
+    if( ((gNfcDev.techsFound & RFAL_NFC_POLL_TECH_F) != 0U) && ((gNfcDev.techs2do & RFAL_NFC_POLL_TECH_F) != 0U) )   /* If a NFC-F device was found/detected, perform Collision Resolution */
     {
-        rfalNfcfListenDevice nfcfDevList[RFAL_NFC_MAX_DEVICES];
+        if( !gNfcDev.isTechInit )
+        {
+            rfalNfcTraceStart();
+            EXIT_ON_ERR( err, rfalNfcfPollerInitialize( gNfcDev.disc.nfcfBR ) ); /* Initialize RFAL for NFC-F */
+            EXIT_ON_ERR( err, rfalFieldOnAndStartGT() );                              /* Ensure GT again as other technologies have also been polled */
+            gNfcDev.isTechInit = true;
+        }
         
-        gNfcDev.techs2do &= ~RFAL_NFC_POLL_TECH_F;
+        if( !gNfcDev.isOperOngoing )
+        {
+            if( !rfalIsGTExpired() )                                                  /* Wait for GT without blocking */
+            {
+                return ERR_BUSY;
+            }
+            
+            EXIT_ON_ERR( err, rfalNfcfPollerStartCollisionResolution( gNfcDev.disc.compMode, rfalNfcColResLimit(), gNfcDev.pollBuf.nfcfDevList, &gNfcDev.pollDevCnt ) );
+            gNfcDev.isOperOngoing = true;
+            return ERR_BUSY;
+        }
         
-        EXIT_ON_ERR( err, rfalNfcfPollerInitialize( gNfcDev.disc.nfcfBR ));           /* Initialize RFAL for NFC-F */
-        EXIT_ON_ERR( err, rfalFieldOnAndStartGT() );                                  /* Ensure GT again as other technologies have also been polled */
+        err = rfalNfcfPollerGetCollisionResolutionStatus();
+        if( err == ERR_BUSY )
+        {
+            return ERR_BUSY;
+        }
         
-        err = rfalNfcfPollerCollisionResolution( gNfcDev.disc.compMode, (gNfcDev.disc.devLimit - gNfcDev.devCnt), nfcfDevList, &devCnt );
-        if( (err == ERR_NONE) && (devCnt != 0U) )
+        rfalNfcTrace( RFAL_NFC_TRACE_EVT_COLRESOLUTION, RFAL_NFC_POLL_TECH_F, err );
+        rfalNfcPollTechDone( RFAL_NFC_POLL_TECH_F );
+        if( (err == ERR_NONE) && (gNfcDev.pollDevCnt != 0U) )
         {
-            for( i=0; i<devCnt; i++ )                                                 /* Copy devices found form local Nfcf list into global device list */
+            for( i=0; i<gNfcDev.pollDevCnt; i++ )                                     /* Copy devices found form Nfcf list into global device list */
             {
                 gNfcDev.devList[gNfcDev.devCnt].type     = RFAL_NFC_LISTEN_TYPE_NFCF;
-                gNfcDev.devList[gNfcDev.devCnt].dev.nfcf = nfcfDevList[i];
+                gNfcDev.devList[gNfcDev.devCnt].dev.nfcf = gNfcDev.pollBuf.nfcfDevList[i];
                 gNfcDev.devCnt++;
             }
+            rfalNfcInvTrack( (uint8_t)(gNfcDev.devCnt - gNfcDev.pollDevCnt) );   /* Refresh the inventory, dropping handled devices before the next limit */
         }
         
         return ERR_BUSY;
@@ -1036,24 +1614,45 @@ static ReturnCode rfalNfcPollCollResolution( void )
     /* NFC-V Collision Resolution                                                  */
     /*******************************************************************************/
 #if RFAL_FEATURE_NFCV
-    if( ((gNfcDev.techsFound & RFAL_NFC_POLL_TECH_V) != 0U) && ((gNfcDev.techs2do & RFAL_NFC_POLL_TECH_V) != 0U) )  /* If a NFC-V device was found/detected, perform Collision Resolution */
+    if( ((gNfcDev.techsFound & RFAL_NFC_POLL_TECH_V) != 0U) && ((gNfcDev.techs2do & RFAL_NFC_POLL_TECH_V) != 0U) )   /* If a NFC-V device was found/detected, perform Collision Resolution */
     {
-        rfalNfcvListenDevice nfcvDevList[RFAL_NFC_MAX_DEVICES];
+        if( !gNfcDev.isTechInit )
+        {
+            rfalNfcTraceStart();
+            EXIT_ON_ERR( err, rfalNfcvPollerInitialize() );                   /* Initialize RFAL for NFC-V */
+            EXIT_ON_ERR( err, rfalFieldOnAndStartGT() );                              /* Ensure GT again as other technologies have also been polled */
+            gNfcDev.isTechInit = true;
+        }
         
-        gNfcDev.techs2do &= ~RFAL_NFC_POLL_TECH_V;
+        if( !gNfcDev.isOperOngoing )
+        {
+            if( !rfalIsGTExpired() )                                                  /* Wait for GT without blocking */
+            {
+                return ERR_BUSY;
+            }
+            
+            EXIT_ON_ERR( err, rfalNfcvPollerStartCollisionResolution( RFAL_COMPLIANCE_MODE_NFC, rfalNfcColResLimit(), gNfcDev.pollBuf.nfcvDevList, &gNfcDev.pollDevCnt ) );
+            gNfcDev.isOperOngoing = true;
+            return ERR_BUSY;
+        }
         
-        EXIT_ON_ERR( err, rfalNfcvPollerInitialize());                                /* Initialize RFAL for NFC-V */
-        EXIT_ON_ERR( err, rfalFieldOnAndStartGT() );                                  /* Ensure GT again as other technologies have also been polled */
+        err = rfalNfcvPollerGetCollisionResolutionStatus();
+        if( err == ERR_BUSY )
+        {
+            return ERR_BUSY;
+        }
         
-        err = rfalNfcvPollerCollisionResolution( RFAL_COMPLIANCE_MODE_NFC, (gNfcDev.disc.devLimit - gNfcDev.devCnt), nfcvDevList, &devCnt );
-        if( (err == ERR_NONE) && (devCnt != 0U) )
+        rfalNfcTrace( RFAL_NFC_TRACE_EVT_COLRESOLUTION, RFAL_NFC_POLL_TECH_V, err );
+        rfalNfcPollTechDone( RFAL_NFC_POLL_TECH_V );
+        if( (err == ERR_NONE) && (gNfcDev.pollDevCnt != 0U) )
         {
-            for( i=0; i<devCnt; i++ )                                                 /* Copy devices found form local Nfcf list into global device list */
+            for( i=0; i<gNfcDev.pollDevCnt; i++ )                                     /* Copy devices found form Nfcv list into global device list */
             {
                 gNfcDev.devList[gNfcDev.devCnt].type     = RFAL_NFC_LISTEN_TYPE_NFCV;
-                gNfcDev.devList[gNfcDev.devCnt].dev.nfcv = nfcvDevList[i];
+                gNfcDev.devList[gNfcDev.devCnt].dev.nfcv = gNfcDev.pollBuf.nfcvDevList[i];
                 gNfcDev.devCnt++;
             }
+            rfalNfcInvTrack( (uint8_t)(gNfcDev.devCnt - gNfcDev.pollDevCnt) );   /* Refresh the inventory, dropping handled devices before the next limit */
         }
         
         return ERR_BUSY;
@@ -1066,22 +1665,43 @@ static ReturnCode rfalNfcPollCollResolution( void )
 #if RFAL_FEATURE_ST25TB
     if( ((gNfcDev.techsFound & RFAL_NFC_POLL_TECH_ST25TB) != 0U) && ((gNfcDev.techs2do & RFAL_NFC_POLL_TECH_ST25TB) != 0U) ) /* If a ST25TB device was found/detected, perform Collision Resolution */
     {
-        rfalSt25tbListenDevice st25tbDevList[RFAL_NFC_MAX_DEVICES];
+        if( !gNfcDev.isTechInit )
+        {
+            rfalNfcTraceStart();
+            EXIT_ON_ERR( err, rfalSt25tbPollerInitialize() );                         /* Initialize RFAL for ST25TB */
+            EXIT_ON_ERR( err, rfalFieldOnAndStartGT() );                              /* Ensure GT again as other technologies have also been polled */
+            gNfcDev.isTechInit = true;
+        }
         
-        gNfcDev.techs2do &= ~RFAL_NFC_POLL_TECH_ST25TB;
+        if( !gNfcDev.isOperOngoing )
+        {
+            if( !rfalIsGTExpired() )                                                  /* Wait for GT without blocking */
+            {
+                return ERR_BUSY;
+            }
+            
+            EXIT_ON_ERR( err, rfalSt25tbPollerStartCollisionResolution( rfalNfcColResLimit(), gNfcDev.pollBuf.st25tbDevList, &gNfcDev.pollDevCnt ) );
+            gNfcDev.isOperOngoing = true;
+            return ERR_BUSY;
+        }
         
-        rfalSt25tbPollerInitialize();                                                 /* Initialize RFAL for ST25TB */
-        EXIT_ON_ERR( err, rfalFieldOnAndStartGT() );                                  /* Ensure GT again as other technologies have also been polled */
+        err = rfalSt25tbPollerGetCollisionResolutionStatus();
+        if( err == ERR_BUSY )
+        {
+            return ERR_BUSY;
+        }
         
-        err = rfalSt25tbPollerCollisionResolution( (gNfcDev.disc.devLimit - gNfcDev.devCnt), st25tbDevList, &devCnt );
-        if( (err == ERR_NONE) && (devCnt != 0U) )
+        rfalNfcTrace( RFAL_NFC_TRACE_EVT_COLRESOLUTION, RFAL_NFC_POLL_TECH_ST25TB, err );
+        rfalNfcPollTechDone( RFAL_NFC_POLL_TECH_ST25TB );
+        if( (err == ERR_NONE) && (gNfcDev.pollDevCnt != 0U) )
         {
-            for( i=0; i<devCnt; i++ )                                                 /* Copy devices found form local Nfcf list into global device list */
+            for( i=0; i<gNfcDev.pollDevCnt; i++ )                                     /* Copy devices found form ST25TB list into global device list */
             {
                 gNfcDev.devList[gNfcDev.devCnt].type       = RFAL_NFC_LISTEN_TYPE_ST25TB;
-                gNfcDev.devList[gNfcDev.devCnt].dev.st25tb = st25tbDevList[i];
+                gNfcDev.devList[gNfcDev.devCnt].dev.st25tb = gNfcDev.pollBuf.st25tbDevList[i];
                 gNfcDev.devCnt++;
             }
+            rfalNfcInvTrack( (uint8_t)(gNfcDev.devCnt - gNfcDev.pollDevCnt) );   /* Refresh the inventory, dropping handled devices before the next limit */
         }
         
         return ERR_BUSY;
@@ -1094,162 +1714,513 @@ static ReturnCode rfalNfcPollCollResolution( void )
 
 /*!
  ******************************************************************************
- * \brief Poller Activation
+ * \brief Poller Technology done
  * 
- * This method Activates a given device according to it's type and 
- * protocols supported
- *  
- * \param[in]  devIt : device's position on the list to be activated 
+ * Marks the given technology as performed and resets the context of the 
+ * ongoing non-blocking technology operation so that the next technology 
+ * is initialized and started from scratch.
+ * 
+ * \param[in]  tech : technology performed (RFAL_NFC_TECH_NONE to only reset)
+ * 
+ ******************************************************************************
+ */
+static void rfalNfcPollTechDone( uint16_t tech )
+{
+    gNfcDev.techs2do     &= (uint16_t)~tech;
+    gNfcDev.isTechInit    = false;
+    gNfcDev.isOperOngoing = false;
+}
+
+
+/*!
+ ******************************************************************************
+ * \brief Poller Re-acquisition
+ * 
+ * This method tries to directly retrieve the last activated device, without
+ * performing Technology Detection and Collision Resolution. 
+ * The device is addressed by its UID (Select / masked Inventory / SENSF_RES 
+ * and SENSB_RES match) on its own technology. If found it is placed as the 
+ * single device on the device list, ready to be activated.
+ * 
+ * It is non-blocking like the other poll states: the technology is 
+ * initialized once, each command is started and its status retrieved on the
+ * following calls. Technologies requiring more than one command (NFC-A and 
+ * ST25TB) keep the command being performed on gNfcDev.reacqStep
  * 
- * \return  ERR_NONE         : Operation completed with no error
  * \return  ERR_BUSY         : Operation ongoing
- * \return  ERR_XXXX         : Error occurred
+ * \return  ERR_NONE         : Device found and placed on the device list
+ * \return  ERR_NOTSUPP      : Device cannot be directly re-acquired
+ * \return  ERR_NOTFOUND     : A different device has responded
+ * \return  ERR_XXXX         : Error occurred, device not found
  * 
  ******************************************************************************
  */
-static ReturnCode rfalNfcPollActivation( uint8_t devIt )
+static ReturnCode rfalNfcPollReacquisition( void )
 {
-    ReturnCode err;
+    ReturnCode     err;
+    rfalNfcDevice *dev;
     
-    err = ERR_NONE;
+    err = ERR_NOTSUPP;
+    dev = &gNfcDev.devList[0];
     
     /* Supress warning when specific RFAL features have been disabled */
     NO_WARNING(err);
+    NO_WARNING(dev);
     
-    if( devIt > gNfcDev.devCnt )
+    if( !gNfcDev.isTechInit )
     {
-        return ERR_WRONG_STATE;
+        /* Place the last device as the single entry on the device list */
+        gNfcDev.devCnt     = 0;
+        gNfcDev.techsFound = RFAL_NFC_TECH_NONE;
+        gNfcDev.devList[0] = gNfcDev.lastDev;
+        gNfcDev.reacqStep  = 0;
+        
+        switch( dev->type )
+        {
+        #if RFAL_FEATURE_NFCA
+            case RFAL_NFC_LISTEN_TYPE_NFCA:
+                
+                /* T1T has no Select, only the RID/RALL interface */
+                if( ((gNfcDev.disc.techs2Find & RFAL_NFC_POLL_TECH_A) == 0U) || (dev->dev.nfca.type == RFAL_NFCA_T1T) )
+                {
+                    return ERR_NOTSUPP;
+                }
+                EXIT_ON_ERR( err, rfalNfcaPollerInitialize() );                       /* Initialize RFAL for NFC-A */
+                break;
+        #endif /* RFAL_FEATURE_NFCA */
+            
+        #if RFAL_FEATURE_NFCB
+            case RFAL_NFC_LISTEN_TYPE_NFCB:
+                
+                if( (gNfcDev.disc.techs2Find & RFAL_NFC_POLL_TECH_B) == 0U )
+                {
+                    return ERR_NOTSUPP;
+                }
+                EXIT_ON_ERR( err, rfalNfcbPollerInitialize() );                       /* Initialize RFAL for NFC-B */
+                break;
+        #endif /* RFAL_FEATURE_NFCB */
+            
+        #if RFAL_FEATURE_NFCF
+            case RFAL_NFC_LISTEN_TYPE_NFCF:
+                
+                if( (gNfcDev.disc.techs2Find & RFAL_NFC_POLL_TECH_F) == 0U )
+                {
+                    return ERR_NOTSUPP;
+                }
+                EXIT_ON_ERR( err, rfalNfcfPollerInitialize( gNfcDev.disc.nfcfBR ) );  /* Initialize RFAL for NFC-F */
+                break;
+        #endif /* RFAL_FEATURE_NFCF */
+            
+        #if RFAL_FEATURE_NFCV
+            case RFAL_NFC_LISTEN_TYPE_NFCV:
+                
+                if( (gNfcDev.disc.techs2Find & RFAL_NFC_POLL_TECH_V) == 0U )
+                {
+                    return ERR_NOTSUPP;
+                }
+                EXIT_ON_ERR( err, rfalNfcvPollerInitialize() );                       /* Initialize RFAL for NFC-V */
+                break;
+        #endif /* RFAL_FEATURE_NFCV */
+            
+        #if RFAL_FEATURE_ST25TB
+            case RFAL_NFC_LISTEN_TYPE_ST25TB:
+                
+                if( (gNfcDev.disc.techs2Find & RFAL_NFC_POLL_TECH_ST25TB) == 0U )
+                {
+                    return ERR_NOTSUPP;
+                }
+                EXIT_ON_ERR( err, rfalSt25tbPollerInitialize() );                     /* Initialize RFAL for ST25TB */
+                break;
+        #endif /* RFAL_FEATURE_ST25TB */
+            
+            default:
+                return ERR_NOTSUPP;
+        }
+        
+        EXIT_ON_ERR( err, rfalFieldOnAndStartGT() );                                  /* Turns the Field On and starts GT timer */
+        gNfcDev.isTechInit = true;
     }
     
-    switch( gNfcDev.devList[devIt].type )
+    if( !gNfcDev.isOperOngoing )
     {
-        /*******************************************************************************/
-        /* AP2P Activation                                                             */
-        /*******************************************************************************/
-    #if RFAL_FEATURE_NFC_DEP
-        case RFAL_NFC_LISTEN_TYPE_AP2P:
-            /* Activation has already been perfomed (ATR_REQ) */
-        
-            gNfcDev.devList[devIt].nfcid     = gNfcDev.devList[devIt].proto.nfcDep.activation.Target.ATR_RES.NFCID3;
-            gNfcDev.devList[devIt].nfcidLen  = RFAL_NFCDEP_NFCID3_LEN;
-            break;
-    #endif /* RFAL_FEATURE_NFC_DEP */
+        if( !rfalIsGTExpired() )                                                      /* Wait for GT without blocking */
+        {
+            return ERR_BUSY;
+        }
         
+        switch( dev->type )
+        {
+        #if RFAL_FEATURE_NFCA
+            case RFAL_NFC_LISTEN_TYPE_NFCA:
+                /* Other devices may reply to WUPA as well, the Select with the full NFCID1 addresses only the known one */
+                EXIT_ON_ERR( err, rfalNfcaPollerStartCheckPresence( RFAL_14443A_SHORTFRAME_CMD_WUPA, &gNfcDev.pollBuf.nfcaReacq.sensRes ) );
+                break;
+        #endif /* RFAL_FEATURE_NFCA */
+            
+        #if RFAL_FEATURE_NFCB
+            case RFAL_NFC_LISTEN_TYPE_NFCB:
+                EXIT_ON_ERR( err, rfalNfcbPollerStartCheckPresence( RFAL_NFCB_SENS_CMD_ALLB_REQ, RFAL_NFCB_SLOT_NUM_1, &gNfcDev.pollBuf.nfcbDet.sensbRes, &gNfcDev.pollBuf.nfcbDet.sensbResLen ) );
+                break;
+        #endif /* RFAL_FEATURE_NFCB */
+            
+        #if RFAL_FEATURE_NFCF
+            case RFAL_NFC_LISTEN_TYPE_NFCF:
+                EXIT_ON_ERR( err, rfalStartFeliCaPoll( RFAL_FELICA_1_SLOT, RFAL_NFCF_SYSTEMCODE, RFAL_FELICA_POLL_RC_NO_REQUEST, &gNfcDev.pollBuf.nfcfReacq.pollRes, 1U, &gNfcDev.pollBuf.nfcfReacq.pollFound, &gNfcDev.pollBuf.nfcfReacq.pollCollision ) );
+                break;
+        #endif /* RFAL_FEATURE_NFCF */
+            
+        #if RFAL_FEATURE_NFCV
+            case RFAL_NFC_LISTEN_TYPE_NFCV:
+                /* Single slot Inventory masked with the whole UID, only the known device shall reply */
+                EXIT_ON_ERR( err, rfalNfcvPollerStartInventory( RFAL_NFCV_NUM_SLOTS_1, (uint8_t)rfalConvBytesToBits(RFAL_NFCV_UID_LEN), dev->dev.nfcv.InvRes.UID, &gNfcDev.pollBuf.nfcvInvRes, NULL ) );
+                break;
+        #endif /* RFAL_FEATURE_NFCV */
+            
+        #if RFAL_FEATURE_ST25TB
+            case RFAL_NFC_LISTEN_TYPE_ST25TB:
+                /* Chip ID is random on every Initiate, the UID identifies the device */
+                EXIT_ON_ERR( err, rfalSt25tbPollerStartCheckPresence( &gNfcDev.pollBuf.st25tbReacq.chipId ) );
+                break;
+        #endif /* RFAL_FEATURE_ST25TB */
+            
+            default:
+                return ERR_NOTSUPP;
+        }
         
+        gNfcDev.isOperOngoing = true;
+        return ERR_BUSY;
+    }
+    
+    switch( dev->type )
+    {
         /*******************************************************************************/
-        /* Passive NFC-A Activation                                                    */
+        /* Passive NFC-A Re-acquisition: WUPA, then Select with the known NFCID1       */
         /*******************************************************************************/
     #if RFAL_FEATURE_NFCA
         case RFAL_NFC_LISTEN_TYPE_NFCA:
             
-            rfalNfcaPollerInitialize();
-            if( gNfcDev.devList[devIt].dev.nfca.isSleep )                             /* Check if desired device is in Sleep */
+            if( gNfcDev.reacqStep == 0U )
             {
-                rfalNfcaSensRes sensRes;
-                rfalNfcaSelRes  selRes;
+                err = rfalNfcaPollerGetCheckPresenceStatus();
+                if( err == ERR_BUSY )
+                {
+                    return ERR_BUSY;
+                }
+                if( (err != ERR_NONE) && (err != ERR_RF_COLLISION) )
+                {
+                    return err;
+                }
                 
-                EXIT_ON_ERR( err, rfalNfcaPollerCheckPresence( RFAL_14443A_SHORTFRAME_CMD_WUPA, &sensRes ) ); /* Wake up all cards  */
-                EXIT_ON_ERR( err, rfalNfcaPollerSelect( gNfcDev.devList[devIt].dev.nfca.nfcId1, gNfcDev.devList[devIt].dev.nfca.nfcId1Len, &selRes ) ); /* Select specific device  */
+                EXIT_ON_ERR( err, rfalNfcaPollerStartSelect( dev->dev.nfca.nfcId1, dev->dev.nfca.nfcId1Len, &gNfcDev.pollBuf.nfcaReacq.selRes ) );
+                gNfcDev.reacqStep++;
+                return ERR_BUSY;
             }
             
-            /* Set NFCID */
-            gNfcDev.devList[devIt].nfcid    = gNfcDev.devList[devIt].dev.nfca.nfcId1;
-            gNfcDev.devList[devIt].nfcidLen = gNfcDev.devList[devIt].dev.nfca.nfcId1Len;
+            err = rfalNfcaPollerGetSelectStatus();
+            if( err != ERR_NONE )
+            {
+                return err;
+            }
             
-            /*******************************************************************************/
-            /* Perform protocol specific activation                                        */
-            switch( gNfcDev.devList[devIt].dev.nfca.type )
+            if( gNfcDev.pollBuf.nfcaReacq.selRes.sak != dev->dev.nfca.selRes.sak )
             {
-                /*******************************************************************************/
-                case RFAL_NFCA_T1T:
-                
-                    /* No further activation needed for T1T (RID already performed) */
-                
-                    gNfcDev.devList[devIt].nfcid    = gNfcDev.devList[devIt].dev.nfca.ridRes.uid;
-                    gNfcDev.devList[devIt].nfcidLen = RFAL_T1T_UID_LEN;
-                
-                    gNfcDev.devList[devIt].rfInterface = RFAL_NFC_INTERFACE_RF;
-                    break;
-                
-                case RFAL_NFCA_T2T:
-                    
-                    /* No further activation needed for a T2T */
-
-                    gNfcDev.devList[devIt].rfInterface = RFAL_NFC_INTERFACE_RF;
-                    break;
-                
-                
-                /*******************************************************************************/
-                case RFAL_NFCA_T4T:                                                   /* Device supports ISO-DEP */
-                
-                #if RFAL_FEATURE_ISO_DEP_POLL
-                    /* Perform ISO-DEP (ISO14443-4) activation: RATS and PPS if supported */
-                    rfalIsoDepInitialize();
-                    EXIT_ON_ERR( err, rfalIsoDepPollAHandleActivation( (rfalIsoDepFSxI)RFAL_ISODEP_FSDI_DEFAULT, RFAL_ISODEP_NO_DID, RFAL_BR_424, &gNfcDev.devList[devIt].proto.isoDep ) );
-                    
-                    gNfcDev.devList[devIt].rfInterface = RFAL_NFC_INTERFACE_ISODEP;   /* NFC-A T4T device activated */
-                #else
-                    gNfcDev.devList[devIt].rfInterface = RFAL_NFC_INTERFACE_RF;       /* No ISO-DEP supported activate using RF interface */
-                #endif /* RFAL_FEATURE_ISO_DEP_POLL */
-                    break;
-                    
-                  
-                  
-                /*******************************************************************************/
-                case RFAL_NFCA_T4T_NFCDEP:                                            /* Device supports both T4T and NFC-DEP */
-                case RFAL_NFCA_NFCDEP:                                                /* Device supports NFC-DEP */
-                
-                #if RFAL_FEATURE_NFC_DEP
-                    /* Perform NFC-DEP (P2P) activation: ATR and PSL if supported */
-                    EXIT_ON_ERR( err, rfalNfcNfcDepActivate( &gNfcDev.devList[devIt], RFAL_NFCDEP_COMM_PASSIVE, NULL, 0 ) );
-                
-                    gNfcDev.devList[devIt].nfcid    = gNfcDev.devList[devIt].proto.nfcDep.activation.Target.ATR_RES.NFCID3;
-                    gNfcDev.devList[devIt].nfcidLen = RFAL_NFCDEP_NFCID3_LEN;
-                
-                    gNfcDev.devList[devIt].rfInterface = RFAL_NFC_INTERFACE_NFCDEP;   /* NFC-A P2P device activated */
-                #else
-                    gNfcDev.devList[devIt].rfInterface = RFAL_NFC_INTERFACE_RF;       /* No NFC-DEP supported activate using RF interface */
-                #endif /* RFAL_FEATURE_NFC_DEP */
-                    break;
-                
-                /*******************************************************************************/
-                default:
-                    return ERR_WRONG_STATE;
+                return ERR_NOTFOUND;
             }
+            
+            dev->dev.nfca.isSleep = false;
+            gNfcDev.techsFound   |= RFAL_NFC_POLL_TECH_A;
             break;
     #endif /* RFAL_FEATURE_NFCA */
         
-        
         /*******************************************************************************/
-        /* Passive NFC-B Activation                                                    */
+        /* Passive NFC-B Re-acquisition                                                */
         /*******************************************************************************/
     #if RFAL_FEATURE_NFCB
         case RFAL_NFC_LISTEN_TYPE_NFCB:
             
-            rfalNfcbPollerInitialize();
-            if( gNfcDev.devList[devIt].dev.nfcb.isSleep )                             /* Check if desired device is in Sleep */
+            err = rfalNfcbPollerGetCheckPresenceStatus();
+            if( err != ERR_NONE )
             {
-                rfalNfcbSensbRes sensbRes;
-                uint8_t          sensbResLen;
-                
-                /* Wake up all cards. SENSB_RES may return collision but the NFCID0 is available to explicitly select NFC-B card via ATTRIB; so error will be ignored here */
-                rfalNfcbPollerCheckPresence( RFAL_NFCB_SENS_CMD_ALLB_REQ, RFAL_NFCB_SLOT_NUM_1, &sensbRes, &sensbResLen );
+                return err;
             }
             
-            /* Set NFCID */
-            gNfcDev.devList[devIt].nfcid    = gNfcDev.devList[devIt].dev.nfcb.sensbRes.nfcid0;
-            gNfcDev.devList[devIt].nfcidLen = RFAL_NFCB_NFCID0_LEN;
-            
-        #if RFAL_FEATURE_ISO_DEP_POLL
-            /* Check if device supports  ISO-DEP (ISO14443-4) */
-            if( (gNfcDev.devList[devIt].dev.nfcb.sensbRes.protInfo.FsciProType & RFAL_NFCB_SENSB_RES_PROTO_ISO_MASK) != 0U )
+            if( ST_BYTECMP( gNfcDev.pollBuf.nfcbDet.sensbRes.nfcid0, dev->dev.nfcb.sensbRes.nfcid0, RFAL_NFCB_NFCID0_LEN ) != 0 )
             {
-                rfalIsoDepInitialize();
-                /* Perform ISO-DEP (ISO14443-4) activation: RATS and PPS if supported    */
-                EXIT_ON_ERR( err, rfalIsoDepPollBHandleActivation( (rfalIsoDepFSxI)RFAL_ISODEP_FSDI_DEFAULT, RFAL_ISODEP_NO_DID, RFAL_BR_424, 0x00, &gNfcDev.devList[devIt].dev.nfcb, NULL, 0, &gNfcDev.devList[devIt].proto.isoDep ) );
-                
-                gNfcDev.devList[devIt].rfInterface = RFAL_NFC_INTERFACE_ISODEP;       /* NFC-B T4T device activated */
-                break;
+                return ERR_NOTFOUND;
+            }
+            
+            dev->dev.nfcb.sensbRes    = gNfcDev.pollBuf.nfcbDet.sensbRes;
+            dev->dev.nfcb.sensbResLen = gNfcDev.pollBuf.nfcbDet.sensbResLen;
+            dev->dev.nfcb.isSleep     = false;
+            gNfcDev.techsFound       |= RFAL_NFC_POLL_TECH_B;
+            break;
+    #endif /* RFAL_FEATURE_NFCB */
+        
+        /*******************************************************************************/
+        /* Passive NFC-F Re-acquisition                                                */
+        /*******************************************************************************/
+    #if RFAL_FEATURE_NFCF
+        case RFAL_NFC_LISTEN_TYPE_NFCF:
+            
+            err = rfalGetFeliCaPollStatus();
+            if( err != ERR_NONE )
+            {
+                return err;
+            }
+            
+            /* SENSF_RES is preceded by the LEN byte and the response code */
+            if( (gNfcDev.pollBuf.nfcfReacq.pollFound == 0U) || (ST_BYTECMP( &gNfcDev.pollBuf.nfcfReacq.pollRes[RFAL_NFCF_HEADER_LEN], dev->dev.nfcf.sensfRes.NFCID2, RFAL_NFCF_NFCID2_LEN ) != 0) )
+            {
+                return ERR_NOTFOUND;
+            }
+            
+            gNfcDev.techsFound |= RFAL_NFC_POLL_TECH_F;
+            break;
+    #endif /* RFAL_FEATURE_NFCF */
+        
+        /*******************************************************************************/
+        /* Passive NFC-V Re-acquisition                                                */
+        /*******************************************************************************/
+    #if RFAL_FEATURE_NFCV
+        case RFAL_NFC_LISTEN_TYPE_NFCV:
+            
+            err = rfalNfcvPollerGetInventoryStatus();
+            if( err != ERR_NONE )
+            {
+                return err;
+            }
+            
+            if( ST_BYTECMP( gNfcDev.pollBuf.nfcvInvRes.UID, dev->dev.nfcv.InvRes.UID, RFAL_NFCV_UID_LEN ) != 0 )
+            {
+                return ERR_NOTFOUND;
+            }
+            
+            dev->dev.nfcv.InvRes  = gNfcDev.pollBuf.nfcvInvRes;
+            dev->dev.nfcv.isSleep = false;
+            gNfcDev.techsFound   |= RFAL_NFC_POLL_TECH_V;
+            break;
+    #endif /* RFAL_FEATURE_NFCV */
+        
+        /*******************************************************************************/
+        /* Passive ST25TB Re-acquisition: Initiate, Select, then Get UID               */
+        /*******************************************************************************/
+    #if RFAL_FEATURE_ST25TB
+        case RFAL_NFC_LISTEN_TYPE_ST25TB:
+            
+            if( gNfcDev.reacqStep == 0U )
+            {
+                err = rfalSt25tbPollerGetCheckPresenceStatus();
+                if( err != ERR_NONE )
+                {
+                    return err;
+                }
+                
+                EXIT_ON_ERR( err, rfalSt25tbPollerStartSelect( gNfcDev.pollBuf.st25tbReacq.chipId ) );
+                gNfcDev.reacqStep++;
+                return ERR_BUSY;
+            }
+            
+            if( gNfcDev.reacqStep == 1U )
+            {
+                err = rfalSt25tbPollerGetSelectStatus();
+                if( err != ERR_NONE )
+                {
+                    return err;
+                }
+                
+                EXIT_ON_ERR( err, rfalSt25tbPollerStartGetUID( &gNfcDev.pollBuf.st25tbReacq.uid ) );
+                gNfcDev.reacqStep++;
+                return ERR_BUSY;
+            }
+            
+            err = rfalSt25tbPollerGetGetUIDStatus();
+            if( err != ERR_NONE )
+            {
+                return err;
+            }
+            
+            if( ST_BYTECMP( gNfcDev.pollBuf.st25tbReacq.uid, dev->dev.st25tb.UID, RFAL_ST25TB_UID_LEN ) != 0 )
+            {
+                return ERR_NOTFOUND;
+            }
+            
+            dev->dev.st25tb.chipID       = gNfcDev.pollBuf.st25tbReacq.chipId;
+            dev->dev.st25tb.isDeselected = false;
+            gNfcDev.techsFound          |= RFAL_NFC_POLL_TECH_ST25TB;
+            break;
+    #endif /* RFAL_FEATURE_ST25TB */
+        
+        /*******************************************************************************/
+        default:
+            return ERR_NOTSUPP;
+    }
+    
+    gNfcDev.devCnt = 1;
+    return ERR_NONE;
+}
+
+
+/*!
+ ******************************************************************************
+ * \brief Poller Activation
+ * 
+ * This method Activates a given device according to it's type and 
+ * protocols supported
+ *  
+ * \param[in]  devIt : device's position on the list to be activated 
+ * 
+ * \return  ERR_NONE         : Operation completed with no error
+ * \return  ERR_BUSY         : Operation ongoing
+ * \return  ERR_XXXX         : Error occurred
+ * 
+ ******************************************************************************
+ */
+static ReturnCode rfalNfcPollActivation( uint8_t devIt )
+{
+    ReturnCode err;
+    
+    err = ERR_NONE;
+    
+    /* Supress warning when specific RFAL features have been disabled */
+    NO_WARNING(err);
+    
+    if( devIt > gNfcDev.devCnt )
+    {
+        return ERR_WRONG_STATE;
+    }
+    
+    switch( gNfcDev.devList[devIt].type )
+    {
+        /*******************************************************************************/
+        /* AP2P Activation                                                             */
+        /*******************************************************************************/
+    #if RFAL_FEATURE_NFC_DEP
+        case RFAL_NFC_LISTEN_TYPE_AP2P:
+            /* Activation has already been perfomed (ATR_REQ) */
+        
+            gNfcDev.devList[devIt].nfcid     = gNfcDev.devList[devIt].proto.nfcDep.activation.Target.ATR_RES.NFCID3;
+            gNfcDev.devList[devIt].nfcidLen  = RFAL_NFCDEP_NFCID3_LEN;
+            break;
+    #endif /* RFAL_FEATURE_NFC_DEP */
+        
+        
+        /*******************************************************************************/
+        /* Passive NFC-A Activation                                                    */
+        /*******************************************************************************/
+    #if RFAL_FEATURE_NFCA
+        case RFAL_NFC_LISTEN_TYPE_NFCA:
+            
+            rfalNfcaPollerInitialize();
+            if( gNfcDev.devList[devIt].dev.nfca.isSleep )                             /* Check if desired device is in Sleep */
+            {
+                rfalNfcaSensRes sensRes;
+                rfalNfcaSelRes  selRes;
+                
+                EXIT_ON_ERR( err, rfalNfcaPollerCheckPresence( RFAL_14443A_SHORTFRAME_CMD_WUPA, &sensRes ) ); /* Wake up all cards  */
+                EXIT_ON_ERR( err, rfalNfcaPollerSelect( gNfcDev.devList[devIt].dev.nfca.nfcId1, gNfcDev.devList[devIt].dev.nfca.nfcId1Len, &selRes ) ); /* Select specific device  */
+            }
+            
+            /* Set NFCID */
+            gNfcDev.devList[devIt].nfcid    = gNfcDev.devList[devIt].dev.nfca.nfcId1;
+            gNfcDev.devList[devIt].nfcidLen = gNfcDev.devList[devIt].dev.nfca.nfcId1Len;
+            
+            /*******************************************************************************/
+            /* Perform protocol specific activation                                        */
+            switch( gNfcDev.devList[devIt].dev.nfca.type )
+            {
+                /*******************************************************************************/
+                case RFAL_NFCA_T1T:
+                
+                    /* No further activation needed for T1T (RID already performed) */
+                
+                    gNfcDev.devList[devIt].nfcid    = gNfcDev.devList[devIt].dev.nfca.ridRes.uid;
+                    gNfcDev.devList[devIt].nfcidLen = RFAL_T1T_UID_LEN;
+                
+                    gNfcDev.devList[devIt].rfInterface = RFAL_NFC_INTERFACE_RF;
+                    break;
+                
+                case RFAL_NFCA_T2T:
+                    
+                    /* No further activation needed for a T2T */
+
+                    gNfcDev.devList[devIt].rfInterface = RFAL_NFC_INTERFACE_RF;
+                    break;
+                
+                
+                /*******************************************************************************/
+                case RFAL_NFCA_T4T:                                                   /* Device supports ISO-DEP */
+                
+                #if RFAL_FEATURE_ISO_DEP_POLL
+                    /* Perform ISO-DEP (ISO14443-4) activation: RATS and PPS if supported */
+                    /* Announce the largest FSD the I-Block buffer holds, as allowed by the compliance mode */
+                    rfalIsoDepInitializeWithParams( gNfcDev.disc.compMode, RFAL_ISODEP_MAX_R_RETRYS, RFAL_ISODEP_MAX_S_RETRYS, RFAL_ISODEP_MAX_I_RETRYS, RFAL_ISODEP_RATS_RETRIES );
+                    EXIT_ON_ERR( err, rfalIsoDepPollAHandleActivation( (rfalIsoDepFSxI)RFAL_ISODEP_FSDI_MAX, RFAL_ISODEP_NO_DID, rfalNfcIsoDepPpsBR(), &gNfcDev.devList[devIt].proto.isoDep ) );
+                    rfalNfcPollIsoDepVHBR( &gNfcDev.devList[devIt].proto.isoDep );
+                    
+                    gNfcDev.devList[devIt].rfInterface = RFAL_NFC_INTERFACE_ISODEP;   /* NFC-A T4T device activated */
+                #else
+                    gNfcDev.devList[devIt].rfInterface = RFAL_NFC_INTERFACE_RF;       /* No ISO-DEP supported activate using RF interface */
+                #endif /* RFAL_FEATURE_ISO_DEP_POLL */
+                    break;
+                    
+                  
+                  
+                /*******************************************************************************/
+                case RFAL_NFCA_T4T_NFCDEP:                                            /* Device supports both T4T and NFC-DEP */
+                case RFAL_NFCA_NFCDEP:                                                /* Device supports NFC-DEP */
+                
+                #if RFAL_FEATURE_NFC_DEP
+                    /* Perform NFC-DEP (P2P) activation: ATR and PSL if supported */
+                    EXIT_ON_ERR( err, rfalNfcNfcDepActivate( &gNfcDev.devList[devIt], RFAL_NFCDEP_COMM_PASSIVE, NULL, 0 ) );
+                
+                    gNfcDev.devList[devIt].nfcid    = gNfcDev.devList[devIt].proto.nfcDep.activation.Target.ATR_RES.NFCID3;
+                    gNfcDev.devList[devIt].nfcidLen = RFAL_NFCDEP_NFCID3_LEN;
+                
+                    gNfcDev.devList[devIt].rfInterface = RFAL_NFC_INTERFACE_NFCDEP;   /* NFC-A P2P device activated */
+                #else
+                    gNfcDev.devList[devIt].rfInterface = RFAL_NFC_INTERFACE_RF;       /* No NFC-DEP supported activate using RF interface */
+                #endif /* RFAL_FEATURE_NFC_DEP */
+                    break;
+                
+                /*******************************************************************************/
+                default:
+                    return ERR_WRONG_STATE;
+            }
+            break;
+    #endif /* RFAL_FEATURE_NFCA */
+        
+        
+        /*******************************************************************************/
+        /* Passive NFC-B Activation                                                    */
+        /*******************************************************************************/
+    #if RFAL_FEATURE_NFCB
+        case RFAL_NFC_LISTEN_TYPE_NFCB:
+            
+            rfalNfcbPollerInitialize();
+            if( gNfcDev.devList[devIt].dev.nfcb.isSleep )                             /* Check if desired device is in Sleep */
+            {
+                rfalNfcbSensbRes sensbRes;
+                uint8_t          sensbResLen;
+                
+                /* Wake up all cards. SENSB_RES may return collision but the NFCID0 is available to explicitly select NFC-B card via ATTRIB; so error will be ignored here */
+                rfalNfcbPollerCheckPresence( RFAL_NFCB_SENS_CMD_ALLB_REQ, RFAL_NFCB_SLOT_NUM_1, &sensbRes, &sensbResLen );
+            }
+            
+            /* Set NFCID */
+            gNfcDev.devList[devIt].nfcid    = gNfcDev.devList[devIt].dev.nfcb.sensbRes.nfcid0;
+            gNfcDev.devList[devIt].nfcidLen = RFAL_NFCB_NFCID0_LEN;
+            
+        #if RFAL_FEATURE_ISO_DEP_POLL
+            /* Check if device supports  ISO-DEP (ISO14443-4) */
+            if( (gNfcDev.devList[devIt].dev.nfcb.sensbRes.protInfo.FsciProType & RFAL_NFCB_SENSB_RES_PROTO_ISO_MASK) != 0U )
+            {
+                rfalIsoDepInitializeWithParams( gNfcDev.disc.compMode, RFAL_ISODEP_MAX_R_RETRYS, RFAL_ISODEP_MAX_S_RETRYS, RFAL_ISODEP_MAX_I_RETRYS, RFAL_ISODEP_RATS_RETRIES );
+                /* Perform ISO-DEP (ISO14443-4) activation: ATTRIB with the largest FSD the I-Block buffer holds */
+                EXIT_ON_ERR( err, rfalIsoDepPollBHandleActivation( (rfalIsoDepFSxI)RFAL_ISODEP_FSDI_MAX, RFAL_ISODEP_NO_DID, rfalNfcIsoDepPpsBR(), 0x00, &gNfcDev.devList[devIt].dev.nfcb, NULL, 0, &gNfcDev.devList[devIt].proto.isoDep ) );
+                rfalNfcPollIsoDepVHBR( &gNfcDev.devList[devIt].proto.isoDep );
+                
+                gNfcDev.devList[devIt].rfInterface = RFAL_NFC_INTERFACE_ISODEP;       /* NFC-B T4T device activated */
+                break;
             }
         #endif /* RFAL_FEATURE_ISO_DEP_POLL */
             
@@ -1537,66 +2508,154 @@ static ReturnCode rfalNfcListenActivation( void )
 
 /*!
  ******************************************************************************
- * \brief Poller NFC DEP Activate
+ * \brief Poller ISO-DEP Very High Bit Rate
  * 
- * This method performs NFC-DEP Activation 
- *  
- * \param[in]  device    : device info
- * \param[in]  commMode  : communication mode (Passive/Active)
- * \param[in]  atrReq    : received ATR_REQ
- * \param[in]  atrReqLen : received ATR_REQ size
+ * When automatic bit rate is enabled, raises the bit rate of an activated
+ * ISO-DEP device above 848 kbps using S(PARAMETERS). This is an ISO14443-4
+ * mechanism, not part of NFC Forum Digital, hence only done in ISO mode
+ * (isoDepMaxBR is capped to 848 kbps otherwise).
  * 
- * \return  ERR_NONE     : Operation completed with no error
- * \return  ERR_BUSY     : Operation ongoing
- * \return  ERR_XXXX     : Error occurred
+ * \param[in]  isoDepDev : activated ISO-DEP device
  * 
  ******************************************************************************
  */
-#if RFAL_FEATURE_NFC_DEP
-static ReturnCode rfalNfcNfcDepActivate( rfalNfcDevice *device, rfalNfcDepCommMode commMode, const uint8_t *atrReq, uint16_t atrReqLen )
+#if RFAL_FEATURE_ISO_DEP_POLL
+static void rfalNfcPollIsoDepVHBR( rfalIsoDepDevice *isoDepDev )
 {
-    rfalNfcDepAtrParam          initParam;
-    
-    /* If we are in Poll mode */
-    if( rfalNfcIsRemDevListener( device->type ) )
+    if( gNfcDev.disc.isoDepBRAuto && ((uint8_t)gNfcDev.isoDepMaxBR > (uint8_t)RFAL_BR_848) )
     {
-        /*******************************************************************************/
-        /* If Passive F use the NFCID2 retrieved from SENSF                            */
-        if( device->type == RFAL_NFC_LISTEN_TYPE_NFCF )
-        {
-            initParam.nfcid    = device->dev.nfcf.sensfRes.NFCID2;
-            initParam.nfcidLen = RFAL_NFCF_NFCID2_LEN;
-        }
-        else
-        {
-            initParam.nfcid    = gNfcDev.disc.nfcid3; 
-            initParam.nfcidLen = RFAL_NFCDEP_NFCID3_LEN;
-        }    
-        
-        initParam.BS        = RFAL_NFCDEP_Bx_NO_HIGH_BR;
-        initParam.BR        = RFAL_NFCDEP_Bx_NO_HIGH_BR;
-        initParam.DID       = RFAL_NFCDEP_DID_NO;
-        initParam.NAD       = RFAL_NFCDEP_NAD_NO;
-        initParam.LR        = RFAL_NFCDEP_LR_254;
-        initParam.GB        = gNfcDev.disc.GB;
-        initParam.GBLen     = gNfcDev.disc.GBLen;
-        initParam.commMode  = commMode;
-        initParam.operParam = (RFAL_NFCDEP_OPER_FULL_MI_EN | RFAL_NFCDEP_OPER_EMPTY_DEP_DIS | RFAL_NFCDEP_OPER_ATN_EN | RFAL_NFCDEP_OPER_RTOX_REQ_EN);
-        
-        rfalNfcDepInitialize();
-        /* Perform NFC-DEP (P2P) activation: ATR and PSL if supported */
-        return rfalNfcDepInitiatorHandleActivation( &initParam, RFAL_BR_424, &device->proto.nfcDep );
+        /* A PICC not supporting S(PARAMETERS) remains at the bit rate set on activation */
+        (void)rfalIsoDepPollHandleSParameters( isoDepDev, gNfcDev.isoDepMaxBR, gNfcDev.isoDepMaxBR );
     }
-    
-    /* If we are in Listen mode */
-#if RFAL_FEATURE_LISTEN_MODE
-    else if( rfalNfcIsRemDevPoller( device->type ) )
-    {
-        rfalNfcDepListenActvParam   actvParams;
-        rfalNfcDepTargetParam       targetParam;
-        
-        ST_MEMCPY(targetParam.nfcid3, (uint8_t*)gNfcDev.disc.nfcid3, RFAL_NFCDEP_NFCID3_LEN);
-        targetParam.bst       = RFAL_NFCDEP_Bx_NO_HIGH_BR;
+}
+#endif /* RFAL_FEATURE_ISO_DEP_POLL */
+
+
+/*!
+ ******************************************************************************
+ * \brief Poller Is Last Device
+ * 
+ * Checks whether the given device is the last activated one, on its
+ * NFCID. Used to keep a lowered ISO-DEP bit rate for this device only.
+ * 
+ * \param[in]  dev : device found on collision resolution
+ * 
+ * \return  true  : Same device as lastDev
+ * \return  false : Other device, or no last device
+ * 
+ ******************************************************************************
+ */
+#if RFAL_FEATURE_ISO_DEP_POLL
+static bool rfalNfcPollIsLastDev( const rfalNfcDevice *dev )
+{
+    if( (!gNfcDev.lastDevValid) || (dev->type != gNfcDev.lastDev.type) )
+    {
+        return false;
+    }
+    
+    /* lastDev.nfcid points into the device list, compare with the copied device data */
+    switch( dev->type )
+    {
+    #if RFAL_FEATURE_NFCA
+        case RFAL_NFC_LISTEN_TYPE_NFCA:
+            return ( (dev->dev.nfca.nfcId1Len == gNfcDev.lastDev.dev.nfca.nfcId1Len) && (ST_BYTECMP( dev->dev.nfca.nfcId1, gNfcDev.lastDev.dev.nfca.nfcId1, dev->dev.nfca.nfcId1Len ) == 0) );
+    #endif /* RFAL_FEATURE_NFCA */
+    
+    #if RFAL_FEATURE_NFCB
+        case RFAL_NFC_LISTEN_TYPE_NFCB:
+            return ( ST_BYTECMP( dev->dev.nfcb.sensbRes.nfcid0, gNfcDev.lastDev.dev.nfcb.sensbRes.nfcid0, RFAL_NFCB_NFCID0_LEN ) == 0 );
+    #endif /* RFAL_FEATURE_NFCB */
+    
+        default:
+            return false;
+    }
+}
+#endif /* RFAL_FEATURE_ISO_DEP_POLL */
+
+
+/*!
+ ******************************************************************************
+ * \brief Poller NFC DEP parameters
+ * 
+ * This method computes the ATR_REQ parameters used to activate the given
+ * device as Initiator
+ *  
+ * \param[in]  device    : device info
+ * \param[in]  commMode  : communication mode (Passive/Active)
+ * \param[out] initParam : ATR_REQ parameters
+ * 
+ ******************************************************************************
+ */
+#if RFAL_FEATURE_NFC_DEP
+static void rfalNfcNfcDepPollParam( rfalNfcDevice *device, rfalNfcDepCommMode commMode, rfalNfcDepAtrParam *initParam )
+{
+    /*******************************************************************************/
+    /* If Passive F use the NFCID2 retrieved from SENSF                            */
+    if( device->type == RFAL_NFC_LISTEN_TYPE_NFCF )
+    {
+        initParam->nfcid    = device->dev.nfcf.sensfRes.NFCID2;
+        initParam->nfcidLen = RFAL_NFCF_NFCID2_LEN;
+    }
+    else
+    {
+        initParam->nfcid    = gNfcDev.disc.nfcid3; 
+        initParam->nfcidLen = RFAL_NFCDEP_NFCID3_LEN;
+    }    
+    
+    initParam->BS        = RFAL_NFCDEP_Bx_NO_HIGH_BR;
+    initParam->BR        = RFAL_NFCDEP_Bx_NO_HIGH_BR;
+    initParam->DID       = RFAL_NFCDEP_DID_NO;
+    initParam->NAD       = RFAL_NFCDEP_NAD_NO;
+    initParam->LR        = RFAL_NFCDEP_LR_254;
+    initParam->GB        = gNfcDev.disc.GB;
+    initParam->GBLen     = gNfcDev.disc.GBLen;
+    initParam->commMode  = commMode;
+    initParam->operParam = (RFAL_NFCDEP_OPER_FULL_MI_EN | RFAL_NFCDEP_OPER_EMPTY_DEP_DIS | RFAL_NFCDEP_OPER_ATN_EN | RFAL_NFCDEP_OPER_RTOX_REQ_EN);
+}
+#endif /* RFAL_FEATURE_NFC_DEP */
+
+
+/*!
+ ******************************************************************************
+ * \brief Poller NFC DEP Activate
+ * 
+ * This method performs NFC-DEP Activation 
+ *  
+ * \param[in]  device    : device info
+ * \param[in]  commMode  : communication mode (Passive/Active)
+ * \param[in]  atrReq    : received ATR_REQ
+ * \param[in]  atrReqLen : received ATR_REQ size
+ * 
+ * \return  ERR_NONE     : Operation completed with no error
+ * \return  ERR_BUSY     : Operation ongoing
+ * \return  ERR_XXXX     : Error occurred
+ * 
+ ******************************************************************************
+ */
+#if RFAL_FEATURE_NFC_DEP
+static ReturnCode rfalNfcNfcDepActivate( rfalNfcDevice *device, rfalNfcDepCommMode commMode, const uint8_t *atrReq, uint16_t atrReqLen )
+{
+    rfalNfcDepAtrParam          initParam;
+    
+    /* If we are in Poll mode */
+    if( rfalNfcIsRemDevListener( device->type ) )
+    {
+        rfalNfcNfcDepPollParam( device, commMode, &initParam );
+        
+        rfalNfcDepInitialize();
+        /* Perform NFC-DEP (P2P) activation: ATR and PSL if supported */
+        return rfalNfcDepInitiatorHandleActivation( &initParam, RFAL_BR_424, &device->proto.nfcDep );
+    }
+    
+    /* If we are in Listen mode */
+#if RFAL_FEATURE_LISTEN_MODE
+    else if( rfalNfcIsRemDevPoller( device->type ) )
+    {
+        rfalNfcDepListenActvParam   actvParams;
+        rfalNfcDepTargetParam       targetParam;
+        
+        ST_MEMCPY(targetParam.nfcid3, (uint8_t*)gNfcDev.disc.nfcid3, RFAL_NFCDEP_NFCID3_LEN);
+        targetParam.bst       = RFAL_NFCDEP_Bx_NO_HIGH_BR;
         targetParam.brt       = RFAL_NFCDEP_Bx_NO_HIGH_BR;
         targetParam.to        = RFAL_NFCDEP_WT_TRG_MAX;
         targetParam.ppt       = rfalNfcDepLR2PP(RFAL_NFCDEP_LR_254);
@@ -1624,6 +2683,38 @@ static ReturnCode rfalNfcNfcDepActivate( rfalNfcDevice *device, rfalNfcDepCommMo
         return ERR_INTERNAL;
     }
 }
+
+
+/*!
+ ******************************************************************************
+ * \brief NFC-DEP Start Transceive
+ * 
+ * This method starts a NFC-DEP PDU Transceive with the active device,
+ * sending txDataLen bytes from the PDU Tx buffer. The PDU is received 
+ * on the PDU Rx buffer, no matter how many DEPs it is chained on
+ *  
+ * \param[in]  txDataLen : length of the PDU on the Tx buffer
+ * 
+ * \return  ERR_NONE     : Transceive started
+ * \return  ERR_XXXX     : Error occurred
+ * 
+ ******************************************************************************
+ */
+static ReturnCode rfalNfcNfcDepStartTransceive( uint16_t txDataLen )
+{
+    rfalNfcDepPduTxRxParam nfcDepTxRx;
+    
+    nfcDepTxRx.DID      = RFAL_NFCDEP_DID_KEEP;
+    nfcDepTxRx.FSx      = gNfcDev.activeDev->proto.nfcDep.info.FS;                 /* FS negotiated on ATR, as Initiator or as Target */
+    nfcDepTxRx.dFWT     = gNfcDev.activeDev->proto.nfcDep.info.dFWT;
+    nfcDepTxRx.FWT      = gNfcDev.activeDev->proto.nfcDep.info.FWT;
+    nfcDepTxRx.txBuf    = &gNfcDev.txBuf.nfcDepPduBuf;
+    nfcDepTxRx.txBufLen = txDataLen;
+    nfcDepTxRx.rxBuf    = &gNfcDev.rxBuf.nfcDepPduBuf;
+    nfcDepTxRx.rxLen    = &gNfcDev.rxLen;
+    
+    return rfalNfcDepStartPduTransceive( nfcDepTxRx );
+}
 #endif /* RFAL_FEATURE_NFC_DEP */
 
 
@@ -1641,6 +2732,10 @@ static ReturnCode rfalNfcNfcDepActivate( rfalNfcDevice *device, rfalNfcDepCommMo
  */
 static ReturnCode rfalNfcDeactivation( void )
 {
+#if RFAL_FEATURE_ISO_DEP_POLL
+    uint8_t curBR;
+#endif /* RFAL_FEATURE_ISO_DEP_POLL */
+    
     /* Check if a device has been activated */
     if( gNfcDev.activeDev != NULL )
     {
@@ -1653,6 +2748,12 @@ static ReturnCode rfalNfcDeactivation( void )
             /*******************************************************************************/
         #if RFAL_FEATURE_ISO_DEP_POLL
             case RFAL_NFC_INTERFACE_ISODEP:
+                /* A device left on a degraded link is activated one bit rate lower next time */
+                if( gNfcDev.disc.isoDepBRAuto && !rfalNfcIsRemDevPoller( gNfcDev.activeDev->type ) && rfalIsoDepPollIsBitRateDegraded() )
+                {
+                    curBR = (uint8_t)MAX( gNfcDev.activeDev->proto.isoDep.info.DRI, gNfcDev.activeDev->proto.isoDep.info.DSI );
+                    gNfcDev.lastDevMaxBR = ((curBR > (uint8_t)RFAL_BR_106) ? (rfalBitRate)(curBR - 1U) : RFAL_BR_106);  /* PRQA S 4342 # MISRA 10.5 - Layout of enum rfalBitRate and above check guarantee no invalid enum values to be created */
+                }
                 rfalIsoDepDeselect();                                                 /* Send a Deselect to device */
                 break;
         #endif /* RFAL_FEATURE_ISO_DEP_POLL */
@@ -1682,3 +2783,400 @@ static ReturnCode rfalNfcDeactivation( void )
     gNfcDev.activeDev = NULL;
     return ERR_NONE;
 }
+
+
+#if RFAL_FEATURE_NFC_TRACE
+/*!
+ ******************************************************************************
+ * \brief NFC Trace Log
+ * 
+ * This method records one entry on the trace ring buffer, overwriting the
+ * oldest one if full, and forwards it to the trace callback if set
+ * 
+ * \param[in]  evt       : trace event type
+ * \param[in]  info      : event specific information
+ * \param[in]  err       : phase error code
+ * \param[in]  startTick : system tick at which the phase started
+ * 
+ ******************************************************************************
+ */
+static void rfalNfcTraceLog( rfalNfcTraceEvt evt, uint16_t info, ReturnCode err, uint32_t startTick )
+{
+    rfalNfcTraceEntry *entry;
+    uint32_t           duration;
+    
+    duration = (platformGetSysTick() - startTick);
+    
+    entry           = &gNfcDev.trace.buf[gNfcDev.trace.head];
+    entry->tick     = startTick;
+    entry->duration = (uint16_t)MIN( duration, UINT16_MAX );
+    entry->info     = info;
+    entry->err      = err;
+    entry->evt      = (uint8_t)evt;
+    
+    gNfcDev.trace.head = (uint8_t)((gNfcDev.trace.head + 1U) % RFAL_FEATURE_NFC_TRACE_LEN);
+    
+    if( gNfcDev.trace.cnt < RFAL_FEATURE_NFC_TRACE_LEN )
+    {
+        gNfcDev.trace.cnt++;
+    }
+    else
+    {
+        gNfcDev.trace.lost++;                                                         /* Oldest entry has been overwritten */
+    }
+    
+    if( gNfcDev.disc.traceCb != NULL )
+    {
+        gNfcDev.disc.traceCb( entry );
+    }
+}
+
+
+/*!
+ ******************************************************************************
+ * \brief NFC Trace State Change
+ * 
+ * This method checks whether the main state has changed since last call
+ * and if so records the state that was left and the time spent on it
+ * 
+ ******************************************************************************
+ */
+static void rfalNfcTraceStateChange( void )
+{
+    if( gNfcDev.state != gNfcDev.trace.state )
+    {
+        rfalNfcTraceLog( RFAL_NFC_TRACE_EVT_STATE, (uint16_t)gNfcDev.trace.state, ERR_NONE, gNfcDev.trace.stateTick );
+        
+        gNfcDev.trace.state     = gNfcDev.state;
+        gNfcDev.trace.stateTick = platformGetSysTick();
+    }
+}
+#endif /* RFAL_FEATURE_NFC_TRACE */
+
+
+#if RFAL_FEATURE_NFC_INVENTORY
+/*!
+ ******************************************************************************
+ * \brief NFC Inventory Get UID
+ * 
+ * This method retrieves the UID by which a device is tracked on the inventory
+ * 
+ * \param[in]  dev       : device
+ * \param[out] uid       : location of the device's UID
+ * \param[out] uidLen    : length of the device's UID
+ * 
+ * \return  true         : device has an UID
+ * \return  false        : device cannot be tracked (AP2P)
+ * 
+ ******************************************************************************
+ */
+static bool rfalNfcInvGetUid( const rfalNfcDevice *dev, const uint8_t **uid, uint8_t *uidLen )
+{
+    switch( dev->type )
+    {
+        case RFAL_NFC_LISTEN_TYPE_NFCA:
+            *uid    = dev->dev.nfca.nfcId1;
+            *uidLen = dev->dev.nfca.nfcId1Len;
+            break;
+            
+        case RFAL_NFC_LISTEN_TYPE_NFCB:
+            *uid    = dev->dev.nfcb.sensbRes.nfcid0;
+            *uidLen = RFAL_NFCB_NFCID0_LEN;
+            break;
+            
+        case RFAL_NFC_LISTEN_TYPE_NFCF:
+            *uid    = dev->dev.nfcf.sensfRes.NFCID2;
+            *uidLen = RFAL_NFCF_NFCID2_LEN;
+            break;
+            
+        case RFAL_NFC_LISTEN_TYPE_NFCV:
+            *uid    = dev->dev.nfcv.InvRes.UID;
+            *uidLen = RFAL_NFCV_UID_LEN;
+            break;
+            
+        case RFAL_NFC_LISTEN_TYPE_ST25TB:
+            *uid    = dev->dev.st25tb.UID;
+            *uidLen = RFAL_ST25TB_UID_LEN;
+            break;
+            
+        default:
+            return false;
+    }
+    
+    return ( (*uidLen != 0U) && (*uidLen <= RFAL_NFC_INV_UID_MAX_LEN) );
+}
+
+
+/*!
+ ******************************************************************************
+ * \brief NFC Inventory RSSI
+ * 
+ * This method retrieves the location of the RSSI the technology module 
+ * captured when the device's response was received
+ * 
+ * \param[in]  dev       : device
+ * 
+ * \return  location of the device's RSSI, NULL if none (AP2P)
+ * 
+ ******************************************************************************
+ */
+static uint16_t* rfalNfcInvRssi( rfalNfcDevice *dev )
+{
+    switch( dev->type )
+    {
+        case RFAL_NFC_LISTEN_TYPE_NFCA:
+            return &dev->dev.nfca.rssi;
+            
+        case RFAL_NFC_LISTEN_TYPE_NFCB:
+            return &dev->dev.nfcb.rssi;
+            
+        case RFAL_NFC_LISTEN_TYPE_NFCF:
+            return &dev->dev.nfcf.rssi;
+            
+        case RFAL_NFC_LISTEN_TYPE_NFCV:
+            return &dev->dev.nfcv.rssi;
+            
+        case RFAL_NFC_LISTEN_TYPE_ST25TB:
+            return &dev->dev.st25tb.rssi;
+            
+        default:
+            return NULL;
+    }
+}
+
+
+/*!
+ ******************************************************************************
+ * \brief NFC Inventory Refresh RSSI
+ * 
+ * This method overwrites the device's RSSI with the one of the last 
+ * reception, used when the device answered outside of collision resolution
+ * 
+ * \param[in]  dev       : device
+ * 
+ ******************************************************************************
+ */
+static void rfalNfcInvRefreshRssi( rfalNfcDevice *dev )
+{
+    uint16_t *rssi;
+    
+    rssi = rfalNfcInvRssi( dev );
+    if( rssi != NULL )
+    {
+        (void)rfalGetTransceiveRSSI( rssi );
+    }
+}
+
+
+/*!
+ ******************************************************************************
+ * \brief NFC Inventory Find
+ * 
+ * This method looks up a device on the inventory by its type and UID
+ * 
+ * \param[in]  dev       : device
+ * 
+ * \return  Inventory entry index, RFAL_FEATURE_NFC_INVENTORY_LEN if not found
+ * 
+ ******************************************************************************
+ */
+static uint8_t rfalNfcInvFind( const rfalNfcDevice *dev )
+{
+    const uint8_t *uid;
+    uint8_t        uidLen;
+    uint8_t        i;
+    
+    if( rfalNfcInvGetUid( dev, &uid, &uidLen ) )
+    {
+        for( i = 0; i < gNfcDev.inv.cnt; i++ )
+        {
+            if( (gNfcDev.inv.tbl[i].type == dev->type) && (gNfcDev.inv.tbl[i].uidLen == uidLen) && (ST_BYTECMP( gNfcDev.inv.tbl[i].uid, uid, uidLen ) == 0) )
+            {
+                return i;
+            }
+        }
+    }
+    
+    return (uint8_t)RFAL_FEATURE_NFC_INVENTORY_LEN;
+}
+
+
+/*!
+ ******************************************************************************
+ * \brief NFC Inventory Remove
+ * 
+ * This method removes an entry from the inventory, keeping the order of the 
+ * remaining ones, and raises its departure event
+ * 
+ * \param[in]  idx       : inventory entry index
+ * 
+ ******************************************************************************
+ */
+static void rfalNfcInvRemove( uint8_t idx )
+{
+    rfalNfcInvEntry entry;
+    uint8_t         i;
+    
+    entry = gNfcDev.inv.tbl[idx];
+    
+    for( i = idx; (i + 1U) < gNfcDev.inv.cnt; i++ )
+    {
+        gNfcDev.inv.tbl[i] = gNfcDev.inv.tbl[i + 1U];
+    }
+    gNfcDev.inv.cnt--;
+    
+    if( gNfcDev.disc.invCb != NULL )
+    {
+        gNfcDev.disc.invCb( RFAL_NFC_INV_EVT_DEPARTURE, &entry );
+    }
+}
+
+
+/*!
+ ******************************************************************************
+ * \brief NFC Inventory Ageing
+ * 
+ * This method removes from the inventory every device which has not been 
+ * seen for longer than the TTL, raising its departure event
+ * 
+ ******************************************************************************
+ */
+static void rfalNfcInvAgeing( void )
+{
+    uint32_t now;
+    uint8_t  i;
+    
+    now = platformGetSysTick();
+    i   = 0;
+    
+    while( i < gNfcDev.inv.cnt )
+    {
+        if( (now - gNfcDev.inv.tbl[i].lastSeen) > (uint32_t)gNfcDev.disc.invTtl )
+        {
+            rfalNfcInvRemove( i );
+        }
+        else
+        {
+            i++;
+        }
+    }
+}
+
+
+/*!
+ ******************************************************************************
+ * \brief NFC Inventory Update
+ * 
+ * This method refreshes the inventory with the devices on the device list 
+ * from the given index on: known devices have their last seen tick and RSSI updated, new ones 
+ * are added raising their arrival event (the least recently seen entry 
+ * departs if the inventory is full).
+ * If configured, devices already handled are removed from the device list.
+ * 
+ * \param[in] from : index on the device list of the first device to track
+ * 
+ ******************************************************************************
+ */
+static void rfalNfcInvUpdate( uint8_t from )
+{
+    const uint8_t   *uid;
+    uint8_t         uidLen;
+    uint8_t         devIt;
+    uint8_t         i;
+    uint8_t         idx;
+    uint32_t        now;
+    rfalNfcInvEntry *entry;
+    const uint16_t  *rssi;
+    
+    rfalNfcInvAgeing();
+    
+    now   = platformGetSysTick();
+    devIt = from;
+    
+    while( devIt < gNfcDev.devCnt )
+    {
+        if( !rfalNfcInvGetUid( &gNfcDev.devList[devIt], &uid, &uidLen ) )
+        {
+            devIt++;                                                                  /* Device cannot be tracked, keep it */
+            continue;
+        }
+        
+        rssi = rfalNfcInvRssi( &gNfcDev.devList[devIt] );                           /* Captured by the colres as the device answered */
+        idx  = rfalNfcInvFind( &gNfcDev.devList[devIt] );
+        if( idx >= RFAL_FEATURE_NFC_INVENTORY_LEN )
+        {
+            /* New device, make room for it if needed by removing the least recently seen */
+            if( gNfcDev.inv.cnt >= RFAL_FEATURE_NFC_INVENTORY_LEN )
+            {
+                idx = 0;
+                for( i = 1; i < gNfcDev.inv.cnt; i++ )
+                {
+                    if( (now - gNfcDev.inv.tbl[i].lastSeen) > (now - gNfcDev.inv.tbl[idx].lastSeen) )
+                    {
+                        idx = i;
+                    }
+                }
+                rfalNfcInvRemove( idx );
+            }
+            
+            entry            = &gNfcDev.inv.tbl[gNfcDev.inv.cnt];
+            entry->type      = gNfcDev.devList[devIt].type;
+            entry->uidLen    = uidLen;
+            entry->firstSeen = now;
+            entry->lastSeen  = now;
+            entry->rssi      = ( (rssi != NULL) ? *rssi : 0U );
+            entry->handled   = false;
+            ST_MEMCPY( entry->uid, uid, uidLen );
+            gNfcDev.inv.cnt++;
+            
+            if( gNfcDev.disc.invCb != NULL )
+            {
+                gNfcDev.disc.invCb( RFAL_NFC_INV_EVT_ARRIVAL, entry );
+            }
+            
+            devIt++;
+            continue;
+        }
+        
+        entry           = &gNfcDev.inv.tbl[idx];
+        entry->lastSeen = now;
+        entry->rssi     = ( (rssi != NULL) ? *rssi : 0U );
+        
+        if( gNfcDev.disc.invSkipHandled && entry->handled )
+        {
+            /* Already handled within the TTL, remove it from the device list */
+            for( i = devIt; (i + 1U) < gNfcDev.devCnt; i++ )
+            {
+                gNfcDev.devList[i] = gNfcDev.devList[i + 1U];
+            }
+            gNfcDev.devCnt--;
+        }
+        else
+        {
+            devIt++;
+        }
+    }
+}
+
+
+/*!
+ ******************************************************************************
+ * \brief NFC Inventory Set Handled
+ * 
+ * This method marks the given device as handled on the inventory
+ * 
+ * \param[in]  dev       : device which has been activated
+ * 
+ ******************************************************************************
+ */
+static void rfalNfcInvSetHandled( const rfalNfcDevice *dev )
+{
+    uint8_t idx;
+    
+    idx = rfalNfcInvFind( dev );
+    if( idx < RFAL_FEATURE_NFC_INVENTORY_LEN )
+    {
+        gNfcDev.inv.tbl[idx].handled = true;
+    }
+}
+#endif /* RFAL_FEATURE_NFC_INVENTORY */
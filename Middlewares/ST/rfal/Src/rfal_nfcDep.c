@@ -295,6 +295,17 @@ typedef enum{
 } rfalNfcDepCmd;
 
 
+/*! Initiator activation context, kept while the ATR_REQ / PSL_REQ are in flight */
+typedef struct{
+  rfalNfcDepDevice        *nfcDepDev;                       /*!< Device being activated                 */
+  rfalBitRate             desiredBR;                        /*!< Bit rate to be set with PSL            */
+  uint8_t                 retries;                          /*!< ATR_REQ retries left                   */
+  uint16_t                rxLen;                            /*!< Received length                        */
+  uint8_t                 txBuf[RFAL_NFCDEP_ATRREQ_MAX_LEN];/*!< ATR_REQ / PSL_REQ being sent           */
+  uint8_t                 rxBuf[NFCIP_ATRRES_BUF_LEN];      /*!< ATR_RES / PSL_RES received             */
+}rfalNfcDepInitActv;
+
+
 /*! Struct that holds all NFCIP data */
 typedef struct{  
   rfalNfcDepConfigs       cfg;               /*!< Holds the current configuration to be used    */
@@ -333,6 +344,20 @@ typedef struct{
   bool                    isReqPending;      /*!< Flag pending REQ from Target activation       */
   bool                    isTxPending;       /*!< Flag pending DEP Block while waiting RTOX Ack */
   bool                    isWait4RTOX;       /*!< Flag for waiting RTOX Ack                     */
+  
+  bool                    isRxInPlace;       /*!< Chained payload placed contiguously in rxBuf  */
+  bool                    isRxHdrSaved;      /*!< rxHdrSave holds bytes under Rx header         */
+  uint8_t                 rxHdrSave[RFAL_NFCDEP_DEPREQ_HEADER_LEN]; /*!< Data overlaid by Rx header */
+  
+  rfalNfcDepPduTxRxParam  PDUParam;          /*!< PDU TxRx params                               */
+  uint16_t                PDUTxPos;          /*!< PDU Tx position                               */
+  uint16_t                PDURxPos;          /*!< PDU Rx position                               */
+  bool                    isPDURxChaining;   /*!< PDU Transceive chaining flag                  */
+  
+  rfalNfcDepStreamTxRxParam StreamParam;     /*!< Stream TxRx params                            */
+  uint16_t                streamRxLen;       /*!< Length of the DEP received on Stream          */
+  
+  rfalNfcDepInitActv      actv;              /*!< Initiator activation context                  */
 }rfalNfcDep;
 
 
@@ -357,6 +382,18 @@ static ReturnCode nfcipDEPControlMsg( uint8_t pfb, uint8_t RTOX  );
 static ReturnCode nfcipInitiatorHandleDEP( ReturnCode rxRes, uint16_t rxLen, uint16_t *outActRxLen, bool *outIsChaining );
 static ReturnCode nfcipTargetHandleRX( ReturnCode rxRes, uint16_t *outActRxLen, bool *outIsChaining );
 static ReturnCode nfcipTargetHandleActivation( rfalNfcDepDevice *nfcDepDev, uint8_t *outBRS );
+static void nfcipStartTransceive( const rfalNfcDepTxRxParam *param, uint16_t rxBufLen, bool isRxInPlace );
+static void nfcipRxInPlaceNext( uint16_t paylLen );
+static void nfcipRxInPlaceRestore( void );
+static uint16_t nfcipPduMaxPaylLen( uint16_t fsx );
+static void nfcipPdu2BlockParam( rfalNfcDepPduTxRxParam pduParam, rfalNfcDepTxRxParam *blockParam, uint16_t txPos, uint16_t rxPos );
+static ReturnCode nfcipStreamTxNext( void );
+static void nfcipInitiatorConfig( const rfalNfcDepAtrParam* param );
+static ReturnCode nfcipCheckATRRes( const uint8_t* rxBuf, rfalNfcDepAtrRes *atrRes, uint8_t* atrResLen );
+static ReturnCode nfcipCheckPSLRes( const uint8_t* rxBuf );
+static ReturnCode nfcipInitiatorStartATR( void );
+static ReturnCode nfcipInitiatorHandleATRRes( void );
+static ReturnCode nfcipInitiatorHandlePSLRes( void );
 
 
 /*!
@@ -565,6 +602,28 @@ static void nfcipClearCounters( void )
     gNfcip.cntRTOXRetrys = 0;
 }
 
+/*******************************************************************************/
+static void nfcipRxInPlaceNext( uint16_t paylLen )
+{
+    /* Move the Rx window right after the payload just received, so that the next *
+     * chained payload lands contiguously. The header of the next DEP overlays    *
+     * the tail of the current payload, keep those bytes to restore them after    */
+    gNfcip.rxBuf        = &gNfcip.rxBuf[paylLen];
+    gNfcip.rxBufLen    -= paylLen;
+    gNfcip.isRxHdrSaved = true;
+    ST_MEMCPY( gNfcip.rxHdrSave, gNfcip.rxBuf, gNfcip.rxBufPaylPos );
+}
+
+/*******************************************************************************/
+static void nfcipRxInPlaceRestore( void )
+{
+    /* Put back the previous payload bytes overlaid by the header of the DEP just received */
+    if( gNfcip.isRxHdrSaved )
+    {
+        ST_MEMCPY( gNfcip.rxBuf, gNfcip.rxHdrSave, gNfcip.rxBufPaylPos );
+    }
+}
+
 /*******************************************************************************/
 static ReturnCode nfcipInitiatorHandleDEP( ReturnCode rxRes, uint16_t rxLen, uint16_t *outActRxLen, bool *outIsChaining )
 {
@@ -922,6 +981,13 @@ static ReturnCode nfcipInitiatorHandleDEP( ReturnCode rxRes, uint16_t rxLen, uin
             gNfcip.isRxChaining = true;
             *outIsChaining      = true;
             
+            /* Place the next block after this one before acknowledging it */
+            if( gNfcip.isRxInPlace )
+            {
+                nfcipRxInPlaceRestore();
+                nfcipRxInPlaceNext( *outActRxLen );
+            }
+            
             nfcipLogD( " NFCIP(I) Rcvd IPDU OK w MI -> ACK \r\n" );
             EXIT_ON_ERR( ret, nfcipDEPControlMsg( nfcip_PFBRPDU_ACK( gNfcip.pni ), gNfcip.rxBuf[rxMsgIt++] ) );
             
@@ -929,6 +995,8 @@ static ReturnCode nfcipInitiatorHandleDEP( ReturnCode rxRes, uint16_t rxLen, uin
         }
         else
         {
+            nfcipRxInPlaceRestore();
+            
             gNfcip.isRxChaining = false;
             gNfcip.state        = NFCIP_ST_INIT_DEP_IDLE;
             
@@ -1317,6 +1385,13 @@ static ReturnCode nfcipTargetHandleRX( ReturnCode rxRes, uint16_t *outActRxLen,
             gNfcip.isRxChaining = true;
             *outIsChaining      = true;
             
+            /* Place the next block after this one before acknowledging it */
+            if( gNfcip.isRxInPlace )
+            {
+                nfcipRxInPlaceRestore();
+                nfcipRxInPlaceNext( *outActRxLen );
+            }
+            
             nfcipLogD( " NFCIP(T) Rcvd IPDU OK w MI -> ACK \r\n" );
             EXIT_ON_ERR( ret, nfcipDEPControlMsg( nfcip_PFBRPDU_ACK( gNfcip.pni ), gNfcip.rxBuf[rxMsgIt++] ) );
             
@@ -1330,6 +1405,7 @@ static ReturnCode nfcipTargetHandleRX( ReturnCode rxRes, uint16_t *outActRxLen,
             {
                 nfcipLogI( " NFCIP(T) Rcvd last IPDU chaining finished \r\n" );
             }
+            nfcipRxInPlaceRestore();
             
             /*******************************************************************************/
             /* Reception done, send to DH and start RTOX timer                             */
@@ -1691,6 +1767,8 @@ void rfalNfcDepInitialize( void )
     gNfcip.isTxPending    = false;
     gNfcip.isWait4RTOX    = false;
     gNfcip.isReqPending   = false;
+    gNfcip.isRxInPlace    = false;
+    gNfcip.isRxHdrSaved   = false;
     
             
     gNfcip.cfg.oper  = (RFAL_NFCDEP_OPER_FULL_MI_DIS | RFAL_NFCDEP_OPER_EMPTY_DEP_EN | RFAL_NFCDEP_OPER_ATN_EN | RFAL_NFCDEP_OPER_RTOX_REQ_EN);
@@ -1933,20 +2011,9 @@ static ReturnCode nfcipTargetHandleActivation( rfalNfcDepDevice *nfcDepDev, uint
 
 
 /*******************************************************************************/
-ReturnCode rfalNfcDepATR( const rfalNfcDepAtrParam* param, rfalNfcDepAtrRes *atrRes, uint8_t* atrResLen )
+static void nfcipInitiatorConfig( const rfalNfcDepAtrParam* param )
 {
-    ReturnCode        ret;
     rfalNfcDepConfigs cfg;
-    uint16_t          rxLen;
-    uint8_t           msgIt;
-    uint8_t           txBuf[RFAL_NFCDEP_ATRREQ_MAX_LEN];
-    uint8_t           rxBuf[NFCIP_ATRRES_BUF_LEN];
-    
-    
-    if( (param == NULL) || (atrRes == NULL) || (atrResLen == NULL) )
-    {
-        return ERR_PARAM;
-    }
     
     /*******************************************************************************/
     /* Configure NFC-DEP layer                                                     */
@@ -1980,13 +2047,14 @@ ReturnCode rfalNfcDepATR( const rfalNfcDepAtrParam* param, rfalNfcDepAtrRes *atr
 
     rfalNfcDepInitialize();
     nfcipConfig( &cfg );
-    
-    /*******************************************************************************/
-    /* Send ATR_REQ                                                                */
-    /*******************************************************************************/
-    
-    EXIT_ON_ERR( ret, nfcipTxRx(NFCIP_CMD_ATR_REQ, txBuf, nfcipRWTActivation(), NULL, 0, rxBuf, NFCIP_ATRRES_BUF_LEN, &rxLen ) );
-    
+}
+
+
+/*******************************************************************************/
+static ReturnCode nfcipCheckATRRes( const uint8_t* rxBuf, rfalNfcDepAtrRes *atrRes, uint8_t* atrResLen )
+{
+    uint16_t rxLen;
+    uint8_t  msgIt;
     
     /*******************************************************************************/
     /* ATR sent, check response                                                    */
@@ -2016,6 +2084,32 @@ ReturnCode rfalNfcDepATR( const rfalNfcDepAtrParam* param, rfalNfcDepAtrRes *atr
 }
 
 
+/*******************************************************************************/
+ReturnCode rfalNfcDepATR( const rfalNfcDepAtrParam* param, rfalNfcDepAtrRes *atrRes, uint8_t* atrResLen )
+{
+    ReturnCode        ret;
+    uint16_t          rxLen;
+    uint8_t           txBuf[RFAL_NFCDEP_ATRREQ_MAX_LEN];
+    uint8_t           rxBuf[NFCIP_ATRRES_BUF_LEN];
+    
+    
+    if( (param == NULL) || (atrRes == NULL) || (atrResLen == NULL) )
+    {
+        return ERR_PARAM;
+    }
+    
+    nfcipInitiatorConfig( param );
+    
+    /*******************************************************************************/
+    /* Send ATR_REQ                                                                */
+    /*******************************************************************************/
+    
+    EXIT_ON_ERR( ret, nfcipTxRx(NFCIP_CMD_ATR_REQ, txBuf, nfcipRWTActivation(), NULL, 0, rxBuf, NFCIP_ATRRES_BUF_LEN, &rxLen ) );
+    
+    return nfcipCheckATRRes( rxBuf, atrRes, atrResLen );
+}
+
+
 /*******************************************************************************/
 ReturnCode rfalNfcDepPSL( uint8_t BRS, uint8_t FSL )
 {
@@ -2035,6 +2129,15 @@ ReturnCode rfalNfcDepPSL( uint8_t BRS, uint8_t FSL )
     /*******************************************************************************/
     EXIT_ON_ERR( ret, nfcipTxRx( NFCIP_CMD_PSL_REQ, txBuf, nfcipRWTActivation(), &txBuf[NFCIP_PSLREQ_LEN], (msgIt - NFCIP_PSLREQ_LEN), rxBuf, NFCIP_PSLRES_LEN, &rxLen ) );
     
+    return nfcipCheckPSLRes( rxBuf );
+}
+
+
+/*******************************************************************************/
+static ReturnCode nfcipCheckPSLRes( const uint8_t* rxBuf )
+{
+    uint16_t rxLen;
+    uint8_t  msgIt;
     
     /*******************************************************************************/
     /* PSL sent, check response                                                    */
@@ -2164,38 +2267,116 @@ ReturnCode rfalNfcDepRLS( void )
 ReturnCode rfalNfcDepInitiatorHandleActivation( rfalNfcDepAtrParam* param, rfalBitRate desiredBR, rfalNfcDepDevice* nfcDepDev )
 {
     ReturnCode ret;
-    uint8_t    maxRetyrs;
-    uint8_t    PSL_BRS;
-    uint8_t    PSL_FSL;
-    bool       sendPSL;
     
+    EXIT_ON_ERR( ret, rfalNfcDepInitiatorStartActivation( param, desiredBR, nfcDepDev ) );
+    do{
+        rfalWorker();
+        ret = rfalNfcDepInitiatorGetActivationStatus();
+    }
+    while( ret == ERR_BUSY );
+    
+    return ret;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcDepInitiatorStartActivation( rfalNfcDepAtrParam* param, rfalBitRate desiredBR, rfalNfcDepDevice* nfcDepDev )
+{
     if( (param == NULL) || (nfcDepDev == NULL) )
     {
         return ERR_PARAM;
     }
     
     param->NAD = RFAL_NFCDEP_NAD_NO;          /* Digital 1.1  16.6.2.9  Initiator SHALL NOT use NAD */
-    maxRetyrs  = NFCIP_ATR_RETRY_MAX;
-        
+    nfcipInitiatorConfig( param );
+    
+    gNfcip.actv.nfcDepDev = nfcDepDev;
+    gNfcip.actv.desiredBR = desiredBR;
+    gNfcip.actv.retries   = NFCIP_ATR_RETRY_MAX;
+    
     /*******************************************************************************/
-    /* Send ATR REQ and wait for response                                          */
+    /* Send ATR REQ, response is handled on rfalNfcDepInitiatorGetActivationStatus() */
     /*******************************************************************************/
-    do{  /* Upon transmission error ATR REQ should be retried */
+    return nfcipInitiatorStartATR();
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcDepInitiatorGetActivationStatus( void )
+{
+    ReturnCode ret;
+    
+    if( (gNfcip.state != NFCIP_ST_INIT_ATR) && (gNfcip.state != NFCIP_ST_INIT_PSL) )
+    {
+        return ERR_WRONG_STATE;
+    }
+    
+    ret = nfcipDataRx( false );
+    if( ret == ERR_BUSY )
+    {
+        return ERR_BUSY;
+    }
+    
+    if( gNfcip.state == NFCIP_ST_INIT_ATR )
+    {
+        /* Upon transmission error ATR REQ should be retried */
+        if( nfcipIsTransmissionError(ret) && (gNfcip.actv.retries > 0U) )
+        {
+            gNfcip.actv.retries--;
+            EXIT_ON_ERR( ret, nfcipInitiatorStartATR() );
+            return ERR_BUSY;
+        }
         
-         ret = rfalNfcDepATR( param, &nfcDepDev->activation.Target.ATR_RES, &nfcDepDev->activation.Target.ATR_RESLen );
-         
-         if( nfcipIsTransmissionError(ret) )
-         {
-             continue;
-         }
-         break;
+        if( ret == ERR_NONE )
+        {
+            ret = nfcipInitiatorHandleATRRes();
+        }
+    }
+    else
+    {
+        if( ret == ERR_NONE )
+        {
+            ret = nfcipCheckPSLRes( gNfcip.actv.rxBuf );
+        }
+        
+        if( ret == ERR_NONE )
+        {
+            ret = nfcipInitiatorHandlePSLRes();
+        }
     }
-    while( (maxRetyrs--) != 0U );
     
-    if( ret != ERR_NONE )
+    if( ret != ERR_BUSY )
     {
-        return ret;
+        gNfcip.state = NFCIP_ST_INIT_IDLE;
     }
+    return ret;
+}
+
+
+/*******************************************************************************/
+static ReturnCode nfcipInitiatorStartATR( void )
+{
+    gNfcip.rxBuf     = gNfcip.actv.rxBuf;
+    gNfcip.rxBufLen  = NFCIP_ATRRES_BUF_LEN;
+    gNfcip.rxRcvdLen = &gNfcip.actv.rxLen;
+    gNfcip.state     = NFCIP_ST_INIT_ATR;
+    
+    return nfcipTx( NFCIP_CMD_ATR_REQ, gNfcip.actv.txBuf, NULL, 0, 0, nfcipRWTActivation() );
+}
+
+
+/*******************************************************************************/
+static ReturnCode nfcipInitiatorHandleATRRes( void )
+{
+    ReturnCode       ret;
+    uint8_t          PSL_BRS;
+    uint8_t          PSL_FSL;
+    bool             sendPSL;
+    rfalNfcDepDevice *nfcDepDev;
+    
+    nfcDepDev = gNfcip.actv.nfcDepDev;
+    
+    EXIT_ON_ERR( ret, nfcipCheckATRRes( gNfcip.actv.rxBuf, &nfcDepDev->activation.Target.ATR_RES, &nfcDepDev->activation.Target.ATR_RESLen ) );
     
     /*******************************************************************************/
     /* Compute NFC-DEP device with ATR_RES                                         */
@@ -2252,13 +2433,13 @@ ReturnCode rfalNfcDepInitiatorHandleActivation( rfalNfcDepAtrParam* param, rfalB
     /*******************************************************************************/
     /* Check Baud rates                                                            */
     /*******************************************************************************/
-    if( nfcDepDev->info.DSI != desiredBR )    /* if desired BR is different    */
+    if( nfcDepDev->info.DSI != gNfcip.actv.desiredBR )    /* if desired BR is different    */
     {
        /* || (target->brt != RFAL_NFCDEP_Bx_NO_HIGH_BR) || (target->bst != RFAL_NFCDEP_Bx_NO_HIGH_BR)  */  /* if target supports higher BR, must send PSL? */
-        if( nfcipDxIsSupported( (uint8_t)desiredBR, nfcDepDev->activation.Target.ATR_RES.BRt, nfcDepDev->activation.Target.ATR_RES.BSt ) )  /* if desired BR is supported     */    /* MISRA 13.5 */
+        if( nfcipDxIsSupported( (uint8_t)gNfcip.actv.desiredBR, nfcDepDev->activation.Target.ATR_RES.BRt, nfcDepDev->activation.Target.ATR_RES.BSt ) )  /* if desired BR is supported     */    /* MISRA 13.5 */
         {
             sendPSL = true;
-            PSL_BRS = rfalNfcDepDx2BRS( desiredBR );
+            PSL_BRS = rfalNfcDepDx2BRS( gNfcip.actv.desiredBR );
         
             nfcipLogI( " NFCIP(I) BR differ, PSL BR: 0x%02X \r\n", PSL_BRS );
         }
@@ -2269,37 +2450,50 @@ ReturnCode rfalNfcDepInitiatorHandleActivation( rfalNfcDepAtrParam* param, rfalB
     if( sendPSL )
     {
         /*******************************************************************************/
-        /* Send PSL REQ and wait for response                                          */
+        /* Send PSL REQ, response is handled on rfalNfcDepInitiatorGetActivationStatus() */
         /*******************************************************************************/
-        EXIT_ON_ERR( ret, rfalNfcDepPSL(PSL_BRS, PSL_FSL) );
+        gNfcip.actv.txBuf[NFCIP_PSLREQ_LEN]      = PSL_BRS;
+        gNfcip.actv.txBuf[NFCIP_PSLREQ_LEN + 1U] = PSL_FSL;
         
-        /* Check if bit rate has been changed */
-        if( nfcDepDev->info.DSI != desiredBR )
+        gNfcip.rxBufLen = NFCIP_PSLRES_LEN;
+        gNfcip.state    = NFCIP_ST_INIT_PSL;
+        
+        EXIT_ON_ERR( ret, nfcipTx( NFCIP_CMD_PSL_REQ, gNfcip.actv.txBuf, &gNfcip.actv.txBuf[NFCIP_PSLREQ_LEN], NFCIP_PSLPAY_LEN, 0, nfcipRWTActivation() ) );
+        return ERR_BUSY;   /* PSL has been sent    */
+    }
+    
+    return ERR_NONE;       /* No PSL has been sent */
+}
+
+
+/*******************************************************************************/
+static ReturnCode nfcipInitiatorHandlePSLRes( void )
+{
+    rfalNfcDepDevice *nfcDepDev;
+    
+    nfcDepDev = gNfcip.actv.nfcDepDev;
+    
+    /* Check if bit rate has been changed */
+    if( nfcDepDev->info.DSI != gNfcip.actv.desiredBR )
+    {
+        /* Check if device was in Passive NFC-A and went to higher bit rates, use NFC-F */
+        if( (nfcDepDev->info.DSI == RFAL_BR_106) && (gNfcip.cfg.commMode == RFAL_NFCDEP_COMM_PASSIVE) )
         {
-            /* Check if device was in Passive NFC-A and went to higher bit rates, use NFC-F */
-            if( (nfcDepDev->info.DSI == RFAL_BR_106) && (gNfcip.cfg.commMode == RFAL_NFCDEP_COMM_PASSIVE) )
-            {
-                
-            #if RFAL_FEATURE_NFCF 
-                /* If Passive initialize NFC-F module */
-                rfalNfcfPollerInitialize( desiredBR );
-            #else /* RFAL_FEATURE_NFCF */
-                return ERR_NOTSUPP;
-            #endif /* RFAL_FEATURE_NFCF */
-                
-            }
-            
-            nfcDepDev->info.DRI  = desiredBR;  /* DSI Bit Rate coding from Initiator  to Target  */
-            nfcDepDev->info.DSI  = desiredBR;  /* DRI Bit Rate coding from Target to Initiator   */
-            
-            rfalSetBitRate( nfcDepDev->info.DSI, nfcDepDev->info.DRI );
+        #if RFAL_FEATURE_NFCF 
+            /* If Passive initialize NFC-F module */
+            rfalNfcfPollerInitialize( gNfcip.actv.desiredBR );
+        #else /* RFAL_FEATURE_NFCF */
+            return ERR_NOTSUPP;
+        #endif /* RFAL_FEATURE_NFCF */
         }
         
+        nfcDepDev->info.DRI  = gNfcip.actv.desiredBR;  /* DSI Bit Rate coding from Initiator  to Target  */
+        nfcDepDev->info.DSI  = gNfcip.actv.desiredBR;  /* DRI Bit Rate coding from Target to Initiator   */
         
-        return ERR_NONE;   /* PSL has been sent    */
+        rfalSetBitRate( nfcDepDev->info.DSI, nfcDepDev->info.DRI );
     }
     
-    return ERR_NONE;       /* No PSL has been sent */
+    return ERR_NONE;
 }
 
 
@@ -2496,27 +2690,54 @@ ReturnCode rfalNfcDepListenGetActivationStatus( void )
 
 
 /*******************************************************************************/
-ReturnCode rfalNfcDepStartTransceive( rfalNfcDepTxRxParam *param )
+static void nfcipStartTransceive( const rfalNfcDepTxRxParam *param, uint16_t rxBufLen, bool isRxInPlace )
 {
     rfalNfcDepDEPParams nfcDepParams;
+    uint8_t             *pendBuf;
+    uint8_t             hdrLen;
+    uint8_t             rxOffset;
+    
+    /* Header of an incoming DEP: LEN CMDType CMD PFB [DID] [NAD] */
+    hdrLen  = RFAL_NFCDEP_DEP_HEADER;
+    hdrLen += (uint8_t)((gNfcip.cfg.did != RFAL_NFCDEP_DID_NO) ? RFAL_NFCDEP_DID_LEN : 0U);
+    hdrLen += (uint8_t)((gNfcip.cfg.nad != RFAL_NFCDEP_NAD_NO) ? RFAL_NFCDEP_NAD_LEN : 0U);
+    
+    /* Rebase the Rx buffer so that the payload lands on its final position and no move is needed */
+    rxOffset = ((hdrLen < RFAL_NFCDEP_DEPREQ_HEADER_LEN) ? (RFAL_NFCDEP_DEPREQ_HEADER_LEN - hdrLen) : 0U);
     
     nfcDepParams.txBuf        = (uint8_t *)param->txBuf;
     nfcDepParams.txBufLen     = param->txBufLen;
     nfcDepParams.txChaining   = param->isTxChaining;
     nfcDepParams.txBufPaylPos = RFAL_NFCDEP_DEPREQ_HEADER_LEN;  /* position in txBuf where actual outgoing data is located */
     nfcDepParams.did          = RFAL_NFCDEP_DID_KEEP;
-    nfcDepParams.rxBufPaylPos = RFAL_NFCDEP_DEPREQ_HEADER_LEN;
-    nfcDepParams.rxBuf        = (uint8_t *)param->rxBuf;
-    nfcDepParams.rxBufLen     = sizeof(rfalNfcDepBufFormat);
+    nfcDepParams.rxBufPaylPos = (RFAL_NFCDEP_DEPREQ_HEADER_LEN - rxOffset);
+    nfcDepParams.rxBuf        = &((uint8_t *)param->rxBuf)[rxOffset];
+    nfcDepParams.rxBufLen     = (rxBufLen - rxOffset);
     nfcDepParams.fsc          = param->FSx;
     nfcDepParams.fwt          = param->FWT;
     nfcDepParams.dFwt         = param->dFWT;
 
+    pendBuf                   = gNfcip.rxBuf;
     gNfcip.rxRcvdLen          = param->rxLen;
     gNfcip.isChaining         = param->isRxChaining;
+    gNfcip.isRxInPlace        = isRxInPlace;
+    gNfcip.isRxHdrSaved       = false;
 
     nfcipSetDEPParams(&nfcDepParams);
     
+    /* A request received on Target activation is yet to be handled, bring it to the new Rx buffer */
+    if( gNfcip.isReqPending && (pendBuf != NULL) && (pendBuf != gNfcip.rxBuf) )
+    {
+        ST_MEMMOVE( gNfcip.rxBuf, pendBuf, MIN( (uint16_t)pendBuf[0], gNfcip.rxBufLen ) );
+    }
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcDepStartTransceive( rfalNfcDepTxRxParam *param )
+{
+    nfcipStartTransceive( param, sizeof(rfalNfcDepBufFormat), false );
+    
     return ERR_NONE;
 }
 
@@ -2527,4 +2748,209 @@ ReturnCode rfalNfcDepGetTransceiveStatus( void )
     return nfcipRun( gNfcip.rxRcvdLen, gNfcip.isChaining );
 }
 
+
+/*******************************************************************************/
+static uint16_t nfcipPduMaxPaylLen( uint16_t fsx )
+{
+    uint16_t hdrLen;
+    
+    /* Outgoing DEP header accounted by FSx: CMDType CMD PFB [DID] [NAD] */
+    hdrLen  = (RFAL_NFCDEP_HEADER + RFAL_NFCDEP_DEP_PFB_LEN);
+    hdrLen += (uint16_t)((gNfcip.cfg.did != RFAL_NFCDEP_DID_NO) ? RFAL_NFCDEP_DID_LEN : 0U);
+    hdrLen += (uint16_t)((gNfcip.cfg.nad != RFAL_NFCDEP_NAD_NO) ? RFAL_NFCDEP_NAD_LEN : 0U);
+    
+    return ((fsx > hdrLen) ? (uint16_t)(fsx - hdrLen) : 0U);
+}
+
+
+/*******************************************************************************/
+static void nfcipPdu2BlockParam( rfalNfcDepPduTxRxParam pduParam, rfalNfcDepTxRxParam *blockParam, uint16_t txPos, uint16_t rxPos )
+{
+    uint16_t maxPaylLen;
+    
+    blockParam->DID  = pduParam.DID;
+    blockParam->FSx  = pduParam.FSx;
+    blockParam->FWT  = pduParam.FWT;
+    blockParam->dFWT = pduParam.dFWT;
+    
+    /* Chains always use the maximum payload allowed by the FSx */
+    maxPaylLen = nfcipPduMaxPaylLen( pduParam.FSx );
+    
+    if( (pduParam.txBufLen - txPos) > maxPaylLen )
+    {
+        blockParam->isTxChaining = true;
+        blockParam->txBufLen     = maxPaylLen;
+    }
+    else
+    {
+        blockParam->isTxChaining = false;
+        blockParam->txBufLen     = (pduParam.txBufLen - txPos);
+    }
+    
+    /* DEP views over the PDU buffers: the prologue of each view overlays the PDU bytes *
+     * preceding txPos/rxPos, already transmitted or restored once the DEP is received  */
+    blockParam->txBuf        = (rfalNfcDepBufFormat*)&((uint8_t*)pduParam.txBuf)[txPos];   /*  PRQA S 0310 # MISRA 11.3 - Intentional safe cast to avoiding large buffer duplication */
+    blockParam->rxBuf        = (rfalNfcDepBufFormat*)&((uint8_t*)pduParam.rxBuf)[rxPos];   /*  PRQA S 0310 # MISRA 11.3 - Intentional safe cast to avoiding large buffer duplication */
+    blockParam->isRxChaining = &gNfcip.isPDURxChaining;
+    blockParam->rxLen        = pduParam.rxLen;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcDepStartPduTransceive( rfalNfcDepPduTxRxParam param )
+{
+    rfalNfcDepTxRxParam txRxParam;
+    
+    if( (param.txBuf == NULL) || (param.rxBuf == NULL) || (param.rxLen == NULL) || (param.txBufLen > RFAL_FEATURE_NFC_DEP_PDU_MAX_LEN) || (nfcipPduMaxPaylLen( param.FSx ) == 0U) )
+    {
+        return ERR_PARAM;
+    }
+    
+    /* Initialize and store PDU context */
+    gNfcip.PDUParam = param;
+    gNfcip.PDUTxPos = 0;
+    gNfcip.PDURxPos = 0;
+    
+    /* Convert PDU TxRxParams to DEP TxRxParams */
+    nfcipPdu2BlockParam( gNfcip.PDUParam, &txRxParam, gNfcip.PDUTxPos, gNfcip.PDURxPos );
+    
+    /* The Rx view spans the whole PDU buffer, chained DEPs are received in place */
+    nfcipStartTransceive( &txRxParam, (uint16_t)(sizeof(rfalNfcDepPduBufFormat) - gNfcip.PDURxPos), true );
+    
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcDepGetPduTransceiveStatus( void )
+{
+    ReturnCode          ret;
+    rfalNfcDepTxRxParam txRxParam;
+    
+    ret = rfalNfcDepGetTransceiveStatus();
+    switch( ret )
+    {
+        /*******************************************************************************/
+        case ERR_NONE:
+            
+            /* Check if we are still doing chaining on Tx */
+            if( gNfcip.isTxChaining )
+            {
+                /* Add already Tx bytes */
+                gNfcip.PDUTxPos += gNfcip.txBufLen;
+                
+                /* Convert PDU TxRxParams to DEP TxRxParams, next DEP is framed in place */
+                nfcipPdu2BlockParam( gNfcip.PDUParam, &txRxParam, gNfcip.PDUTxPos, gNfcip.PDURxPos );
+                
+                nfcipStartTransceive( &txRxParam, (uint16_t)(sizeof(rfalNfcDepPduBufFormat) - gNfcip.PDURxPos), true );
+                return ERR_BUSY;
+            }
+            
+            /* Last DEP has been received in place */
+            gNfcip.PDURxPos += *gNfcip.PDUParam.rxLen;
+            
+            /* PDU TxRx is done */
+            break;
+            
+        /*******************************************************************************/
+        case ERR_AGAIN:
+            
+            /* Chained DEP has been received in place, the next one follows it */
+            gNfcip.PDURxPos += *gNfcip.PDUParam.rxLen;
+            
+            /* Wait for next DEP */
+            return ERR_BUSY;
+            
+        /*******************************************************************************/
+        default:
+            return ret;
+    }
+    
+    *gNfcip.PDUParam.rxLen = gNfcip.PDURxPos;
+    
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+static ReturnCode nfcipStreamTxNext( void )
+{
+    rfalNfcDepTxRxParam txRxParam;
+    uint16_t            maxPaylLen;
+    
+    maxPaylLen = nfcipPduMaxPaylLen( gNfcip.StreamParam.FSx );
+    
+    /* Have the next payload written in place on the DEP buffer */
+    txRxParam.txBufLen     = 0;
+    txRxParam.isTxChaining = gNfcip.StreamParam.txCb( gNfcip.StreamParam.txBuf->inf, maxPaylLen, &txRxParam.txBufLen );
+    
+    /* Chains always use the maximum payload allowed by the FSx */
+    if( (txRxParam.txBufLen > maxPaylLen) || (txRxParam.isTxChaining && (txRxParam.txBufLen != maxPaylLen)) )
+    {
+        return ERR_PARAM;
+    }
+    
+    txRxParam.txBuf        = gNfcip.StreamParam.txBuf;
+    txRxParam.rxBuf        = gNfcip.StreamParam.rxBuf;
+    txRxParam.rxLen        = &gNfcip.streamRxLen;
+    txRxParam.isRxChaining = &gNfcip.isPDURxChaining;
+    txRxParam.DID          = gNfcip.StreamParam.DID;
+    txRxParam.FSx          = gNfcip.StreamParam.FSx;
+    txRxParam.FWT          = gNfcip.StreamParam.FWT;
+    txRxParam.dFWT         = gNfcip.StreamParam.dFWT;
+    
+    nfcipStartTransceive( &txRxParam, sizeof(rfalNfcDepBufFormat), false );
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcDepStartStreamTransceive( const rfalNfcDepStreamTxRxParam *param )
+{
+    if( (param == NULL) || (param->txBuf == NULL) || (param->rxBuf == NULL) || (param->txCb == NULL) || (param->rxCb == NULL) || (nfcipPduMaxPaylLen( param->FSx ) == 0U) )
+    {
+        return ERR_PARAM;
+    }
+    
+    gNfcip.StreamParam = *param;
+    
+    return nfcipStreamTxNext();
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcDepGetStreamTransceiveStatus( void )
+{
+    ReturnCode ret;
+    
+    ret = rfalNfcDepGetTransceiveStatus();
+    switch( ret )
+    {
+        /*******************************************************************************/
+        case ERR_NONE:
+            
+            /* Chained DEP acknowledged, frame the next one */
+            if( gNfcip.isTxChaining )
+            {
+                EXIT_ON_ERR( ret, nfcipStreamTxNext() );
+                return ERR_BUSY;
+            }
+            
+            /* Last DEP of the incoming PDU */
+            gNfcip.StreamParam.rxCb( gNfcip.StreamParam.rxBuf->inf, gNfcip.streamRxLen, false );
+            return ERR_NONE;
+            
+        /*******************************************************************************/
+        case ERR_AGAIN:
+            
+            /* Chained DEP received, hand it over before the next one lands on the same buffer */
+            gNfcip.StreamParam.rxCb( gNfcip.StreamParam.rxBuf->inf, gNfcip.streamRxLen, true );
+            return ERR_BUSY;
+            
+        /*******************************************************************************/
+        default:
+            return ret;
+    }
+}
+
 #endif /* RFAL_FEATURE_NFC_DEP */
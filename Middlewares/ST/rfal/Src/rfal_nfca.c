@@ -87,6 +87,9 @@
 
 #define RFAL_NFCA_T_RETRANS         5U                    /*!< t RETRANSMISSION [3, 33]ms   EMVCo 2.6  A.5      */
 #define RFAL_NFCA_N_RETRANS         2U                    /*!< Number of retries            EMVCo 2.6  9.6.1.3  */
+
+#define RFAL_NFCA_COLRES_TREE_LEN   16U                   /*!< Max unresolved collisions kept between devices   */
+#define RFAL_NFCA_COLRES_UPPER_LEN  (RFAL_NFCA_CASCADE_3_UID_LEN - RFAL_NFCA_CASCADE_1_UID_LEN)  /*!< Max NFCID1 length of the previous CLs */
  
 
 /*! SDD_REQ (Select) Cascade Levels  */
@@ -114,17 +117,11 @@ enum
 #define rfalNfcaCLn2SELCMD( cl )           (uint8_t)((uint8_t)(RFAL_NFCA_CMD_SEL_CL1) + (2U*(cl)))   /*!< Calculates SEL_CMD with the given cascade level   */
 #define rfalNfcaNfcidLen2CL( len )         ((len) / 5U)                                              /*!< Calculates cascade level by the NFCID length      */
 
-/*! Executes the given Tx method (f) and if a Timeout error is detected it retries (rt) times performing a delay of (dl) in between  */
-#define rfalNfcaTxRetry( r, f, rt, dl )   	                       \
-			{                                                      \
-				uint8_t rts = (uint8_t)(rt);                       \
-				do {						                       \
-					(r)=(f);                                       \
-					if (((rt)!=0U) && ((dl)!=0U)) {                \
-						platformDelay(dl);                         \
-					}                                              \
-				} while( ((rts--) != 0U) && ((r)==ERR_TIMEOUT) );  \
-			}
+#define rfalNfcaTimerStart( timer, time_ms ) (timer) = platformTimerCreate((uint16_t)(time_ms))            /*!< Configures and starts the retransmission timer */
+#define rfalNfcaTimerisExpired( timer )      platformTimerIsExpired( timer )                               /*!< Checks retransmission timer has expired        */
+
+/*! Runs the given status method (fn) until it is no longer busy, running the RFAL worker in between */
+#define rfalNfcaRunBlocking( e, fn )       do{ (e)=(fn); rfalWorker(); }while( (e) == ERR_BUSY )
 
 /*
 ******************************************************************************
@@ -138,12 +135,138 @@ typedef struct
     uint8_t      frame[RFAL_NFCA_SLP_REQ_LEN];  /*!< SLP:  0x50 0x00  */
 } rfalNfcaSlpReq;
 
+
+/*! Single Collision Resolution states */
+typedef enum
+{
+    RFAL_NFCA_CR_IDLE,                          /*!< IDLE state                                  */
+    RFAL_NFCA_CR_CL,                            /*!< New Cascading Level state                   */
+    RFAL_NFCA_CR_SDD_TX,                        /*!< Send SDD_REQ (anticollision frame) state    */
+    RFAL_NFCA_CR_SDD,                           /*!< Wait SDD_RES state                          */
+    RFAL_NFCA_CR_BACKTRACK,                     /*!< Wait SENS_RES of a backtrack SENS_REQ state */
+    RFAL_NFCA_CR_RESEL_TX,                      /*!< Send SEL_REQ of a previous CL on resume     */
+    RFAL_NFCA_CR_RESEL,                         /*!< Wait SEL_RES of a previous CL on resume     */
+    RFAL_NFCA_CR_SEL_TX,                        /*!< Send SEL_REQ (CL selection) state           */
+    RFAL_NFCA_CR_SEL                            /*!< Wait SEL_RES state                          */
+} rfalNfcaColResState;
+
+
+/*! Full Collision Resolution states */
+typedef enum
+{
+    RFAL_NFCA_FCR_IDLE,                         /*!< IDLE state                                  */
+    RFAL_NFCA_FCR_ALLREQ,                       /*!< Wait SENS_RES of the initial ALL_REQ state  */
+    RFAL_NFCA_FCR_RID,                          /*!< Wait RID_RES of a T1T state                 */
+    RFAL_NFCA_FCR_COLRES,                       /*!< Single Collision Resolution ongoing state   */
+    RFAL_NFCA_FCR_SLEEP,                        /*!< Wait SLP_REQ of the resolved device state   */
+    RFAL_NFCA_FCR_SENSREQ                       /*!< Wait SENS_RES of a following SENS_REQ state */
+} rfalNfcaFullColResState;
+
+
+/*! Unresolved collision: the branch not taken, to be resumed on a following device */
+typedef struct
+{
+    uint8_t             cascadeLv;                                /*!< Cascade Level of the collision          */
+    uint8_t             bytesTxRx;                                /*!< Bytes of SDD_REQ to resume with         */
+    uint8_t             bitsTxRx;                                 /*!< Bits of SDD_REQ to resume with          */
+    uint8_t             nfcId1[RFAL_NFCA_COLRES_UPPER_LEN];       /*!< NFCID1 of the previous Cascade Levels   */
+    uint8_t             uid[RFAL_NFCA_CASCADE_1_UID_LEN];         /*!< Partial NFCID1 of this Cascade Level    */
+} rfalNfcaColNode;
+
+
+/*! Single Collision Resolution context */
+typedef struct
+{
+    rfalNfcaColResState state;                  /*!< Single Collision Resolution state           */
+    uint8_t             devLimit;               /*!< Device limit given by the caller            */
+    bool                *collPending;           /*!< Caller's collision pending flag             */
+    rfalNfcaSelRes      *selRes;                /*!< Caller's SEL_RES location                   */
+    uint8_t             *nfcId1;                /*!< Caller's NFCID1 location                    */
+    uint8_t             *nfcId1Len;             /*!< Caller's NFCID1 length location             */
+    uint8_t             cascadeLv;              /*!< Current Cascade Level                       */
+    uint8_t             bytesTxRx;              /*!< Bytes of SDD_REQ to be sent                 */
+    uint8_t             bitsTxRx;               /*!< Bits of SDD_REQ to be sent                  */
+    uint8_t             rootBytes;              /*!< Bytes of SDD_REQ the current CL started with*/
+    uint8_t             rootBits;               /*!< Bits of SDD_REQ the current CL started with */
+    uint8_t             reselLv;                /*!< Cascade Level being re-selected on resume   */
+    const rfalNfcaColNode *resume;              /*!< Collision to resume from, NULL from the root*/
+    bool                trackTree;              /*!< Record unresolved collisions flag           */
+    uint16_t            rxLen;                  /*!< Received length                             */
+    uint8_t             retries;                /*!< Retransmissions left                        */
+    bool                waitRetrans;            /*!< Waiting for the retransmission timer flag   */
+    uint32_t            tmr;                    /*!< Retransmission timer                        */
+    bool                doBacktrack;            /*!< Backtrack ongoing flag                      */
+    uint8_t             backtrackCnt;           /*!< Backtracks left                             */
+    rfalNfcaSelReq      selReq;                 /*!< SDD_REQ / SEL_REQ being exchanged           */
+} rfalNfcaColResParams;
+
+
+/*! Full Collision Resolution context */
+typedef struct
+{
+    rfalNfcaFullColResState state;              /*!< Full Collision Resolution state             */
+    rfalComplianceMode      compMode;           /*!< Compliance mode given by the caller         */
+    uint8_t                 devLimit;           /*!< Device limit given by the caller            */
+    rfalNfcaListenDevice    *nfcaDevList;       /*!< Caller's device list                        */
+    uint8_t                 *devCnt;            /*!< Caller's device counter                     */
+    bool                    collPending;        /*!< Collision pending flag                      */
+    bool                    isResumed;          /*!< Current device resumed from a collision flag*/
+    bool                    reqRetry;           /*!< SENS_REQ being repeated flag                */
+    uint8_t                 treeCnt;            /*!< Number of unresolved collisions             */
+    bool                    treeLost;           /*!< Unresolved collision not kept (tree full)   */
+    rfalNfcaColNode         tree[RFAL_NFCA_COLRES_TREE_LEN]; /*!< Unresolved collisions, deepest last */
+    rfalNfcaColNode         resumeNode;         /*!< Collision being resumed                     */
+} rfalNfcaFullColResParams;
+
+
+/*! Select context */
+typedef struct
+{
+    const uint8_t           *nfcid1;            /*!< Caller's NFCID1 to be selected              */
+    rfalNfcaSelRes          *selRes;            /*!< Caller's SEL_RES location                   */
+    uint8_t                 cl;                 /*!< Cascade Level of the NFCID1                 */
+    uint8_t                 clIt;               /*!< Cascade Level being selected                */
+    uint8_t                 nfcidOffset;        /*!< NFCID1 bytes consumed by previous levels    */
+    uint16_t                rxLen;              /*!< Received length                             */
+    rfalNfcaSelReq          selReq;             /*!< SEL_REQ being exchanged                     */
+} rfalNfcaSelParams;
+
+
+/*! RFAL NFC-A instance */
+typedef struct
+{
+    rfalComplianceMode       compMode;          /*!< Technology Detection compliance mode        */
+    bool                     techDetSleep;      /*!< Technology Detection SLP_REQ ongoing flag   */
+    uint16_t                 rcvLen;            /*!< SENS_RES received length                    */
+    rfalNfcaSlpReq           slpReq;            /*!< SLP_REQ being sent                          */
+    uint8_t                  slpRes;            /*!< Dummy buffer, just to perform Rx on SLP_REQ */
+    rfalNfcaSensRes          sensRes;           /*!< SENS_RES of a backtrack SENS_REQ            */
+    rfalNfcaColResParams     colRes;            /*!< Single Collision Resolution context         */
+    rfalNfcaFullColResParams fullColRes;        /*!< Full Collision Resolution context           */
+    rfalNfcaSelParams        sel;               /*!< Select context                              */
+} rfalNfca;
+
 /*
 ******************************************************************************
 * LOCAL FUNCTION PROTOTYPES
 ******************************************************************************
 */
 static uint8_t rfalNfcaCalculateBcc( const uint8_t* buf, uint8_t bufLen );
+static ReturnCode rfalNfcaPollerSddResolution( ReturnCode ret, uint8_t collBit );
+static ReturnCode rfalNfcaPollerFullColResPrepare( ReturnCode ret );
+static ReturnCode rfalNfcaPollerFullColResStartDevice( void );
+static ReturnCode rfalNfcaPollerFullColResSensReq( bool retry );
+static void rfalNfcaPollerColResPush( void );
+static ReturnCode rfalNfcaPollerSelectCL( void );
+
+
+/*
+******************************************************************************
+* LOCAL VARIABLES
+******************************************************************************
+*/
+
+static rfalNfca gNfca; /*!< RFAL NFC-A instance */
 
 
 /*
@@ -168,6 +291,244 @@ static uint8_t rfalNfcaCalculateBcc( const uint8_t* buf, uint8_t bufLen )
     return BCC;
 }
 
+
+/*******************************************************************************/
+static ReturnCode rfalNfcaPollerSddResolution( ReturnCode ret, uint8_t collBit )
+{
+    bool bccColl;
+    
+    if( ret == ERR_RF_COLLISION )
+    {
+        bccColl = false;
+        
+        /* Check received length */
+        if( (gNfca.colRes.bytesTxRx + ((gNfca.colRes.bitsTxRx != 0U) ? 1U : 0U)) > (RFAL_NFCA_SDD_RES_LEN + RFAL_NFCA_SDD_REQ_LEN) )
+        {
+            gNfca.colRes.state = RFAL_NFCA_CR_IDLE;
+            return ERR_PROTO;
+        }
+
+        if( ((gNfca.colRes.bytesTxRx + ((gNfca.colRes.bitsTxRx != 0U) ? 1U : 0U)) > (RFAL_NFCA_CASCADE_1_UID_LEN + RFAL_NFCA_SDD_REQ_LEN)) && (gNfca.colRes.backtrackCnt != 0U) )
+        { /* Collision in BCC: Anticollide only UID part */
+            gNfca.colRes.backtrackCnt--;
+            bccColl                = true;
+            gNfca.colRes.bytesTxRx = RFAL_NFCA_CASCADE_1_UID_LEN + RFAL_NFCA_SDD_REQ_LEN - 1U;
+            gNfca.colRes.bitsTxRx  = 7;
+            collBit = (uint8_t)( ((uint8_t*)&gNfca.colRes.selReq)[gNfca.colRes.bytesTxRx] & (1U << gNfca.colRes.bitsTxRx) ); /* Not a real collision, extract the actual bit for the subsequent code */
+        }
+        
+        if( (gNfca.colRes.devLimit == 0U) && !(*gNfca.colRes.collPending) )
+        {   
+            /* Activity 1.0 & 1.1  9.3.4.12: If CON_DEVICES_LIMIT has a value of 0, then 
+             * NFC Forum Device is configured to perform collision detection only       */
+            *gNfca.colRes.collPending = true;
+            gNfca.colRes.state        = RFAL_NFCA_CR_IDLE;
+            return ERR_IGNORE;
+        }
+        
+        *gNfca.colRes.collPending = true;
+        
+        /* Keep the branch not taken of a real collision within the NFCID1, to resume it on a following device */
+        if( gNfca.colRes.trackTree && (collBit != 0U) && !bccColl && !gNfca.colRes.doBacktrack && (gNfca.colRes.bytesTxRx < (RFAL_NFCA_SDD_REQ_LEN + RFAL_NFCA_CASCADE_1_UID_LEN)) )
+        {
+            rfalNfcaPollerColResPush();
+        }
+        
+        /* Set and select the collision bit, with the number of bytes/bits successfully TxRx */
+        if (collBit != 0U)
+        {
+            ((uint8_t*)&gNfca.colRes.selReq)[gNfca.colRes.bytesTxRx] = (uint8_t)(((uint8_t*)&gNfca.colRes.selReq)[gNfca.colRes.bytesTxRx] | (1U << gNfca.colRes.bitsTxRx));   /* MISRA 10.3 */
+        }
+        else
+        {
+            ((uint8_t*)&gNfca.colRes.selReq)[gNfca.colRes.bytesTxRx] = (uint8_t)(((uint8_t*)&gNfca.colRes.selReq)[gNfca.colRes.bytesTxRx] & ~(1U << gNfca.colRes.bitsTxRx));  /* MISRA 10.3 */
+        }
+
+        gNfca.colRes.bitsTxRx++;
+        
+        /* Check if number of bits form a byte */
+        if( gNfca.colRes.bitsTxRx == RFAL_BITS_IN_BYTE )
+        {
+            gNfca.colRes.bitsTxRx = 0;
+            gNfca.colRes.bytesTxRx++;
+        }
+        
+        /* Continue the Collision loop */
+        gNfca.colRes.retries = ((gNfca.colRes.devLimit == 0U) ? RFAL_NFCA_N_RETRANS : 0U);
+        gNfca.colRes.state   = RFAL_NFCA_CR_SDD_TX;
+        return ERR_BUSY;
+    }
+    
+    
+    /*******************************************************************************/
+    /* Check if Collision loop has failed */
+    if( ret != ERR_NONE )
+    {
+        gNfca.colRes.state = RFAL_NFCA_CR_IDLE;
+        return ret;
+    }
+    
+    /* If collisions are to be reported check whether the response is complete */
+    if( (gNfca.colRes.devLimit == 0U) && (gNfca.colRes.rxLen != sizeof(rfalNfcaSddRes)) )
+    {
+        gNfca.colRes.state = RFAL_NFCA_CR_IDLE;
+        return ERR_PROTO;
+    }
+    
+    /* Check if the received BCC match */
+    if( gNfca.colRes.selReq.bcc != rfalNfcaCalculateBcc( gNfca.colRes.selReq.nfcid1, RFAL_NFCA_CASCADE_1_UID_LEN ) )
+    {
+        gNfca.colRes.state = RFAL_NFCA_CR_IDLE;
+        return ERR_PROTO;
+    }
+    
+    /*******************************************************************************/
+    /* Anticollision OK, Select this Cascade Level */
+    gNfca.colRes.selReq.selPar = RFAL_NFCA_SEL_SELPAR;
+    gNfca.colRes.retries       = ((gNfca.colRes.devLimit == 0U) ? RFAL_NFCA_N_RETRANS : 0U);
+    gNfca.colRes.state         = RFAL_NFCA_CR_SEL_TX;
+    return ERR_BUSY;
+}
+
+
+/*******************************************************************************/
+static ReturnCode rfalNfcaPollerFullColResPrepare( ReturnCode ret )
+{
+    rfalNfcaSensRes sensRes;
+    
+    gNfca.fullColRes.state = RFAL_NFCA_FCR_IDLE;
+    
+    #if RFAL_FEATURE_T1T
+    /*******************************************************************************/
+    /* Only check for T1T if previous SENS_RES was received without a transmission  *
+     * error. When collisions occur bits in the SENS_RES may look like a T1T        */
+    /* If T1T Anticollision is not supported  Activity 1.1  9.3.4.3 */
+    if( rfalNfcaIsSensResT1T( &gNfca.fullColRes.nfcaDevList->sensRes ) && (gNfca.fullColRes.devLimit != 0U) && (ret == ERR_NONE) && (gNfca.fullColRes.compMode != RFAL_COMPLIANCE_MODE_EMV) )
+    {
+        /* RID_REQ shall be performed     Activity 1.1  9.3.4.24 */
+        rfalT1TPollerInitialize();
+        EXIT_ON_ERR( ret, rfalT1TPollerStartRid( &gNfca.fullColRes.nfcaDevList->ridRes ) );
+        
+        gNfca.fullColRes.state = RFAL_NFCA_FCR_RID;
+        return ERR_BUSY;
+    }    
+    #endif /* RFAL_FEATURE_T1T */
+    
+    /*******************************************************************************/
+    /* Store the SENS_RES from Technology Detection or from WUPA */ 
+    sensRes = gNfca.fullColRes.nfcaDevList->sensRes;
+    
+    if( gNfca.fullColRes.devLimit > 0U )  /* MISRA 21.18 */
+    {
+        ST_MEMSET( gNfca.fullColRes.nfcaDevList, 0x00, (sizeof(rfalNfcaListenDevice) * gNfca.fullColRes.devLimit) );
+    }
+    
+    /* Restore the prev SENS_RES, assuming that the SENS_RES received is from first device
+     * When only one device is detected it's not woken up then we'll have no SENS_RES (ATQA) */
+    gNfca.fullColRes.nfcaDevList->sensRes = sensRes;
+    
+    
+    /*******************************************************************************/
+    /* Start resolving the first device */
+    EXIT_ON_ERR( ret, rfalNfcaPollerFullColResStartDevice() );
+    
+    return ERR_BUSY;
+}
+
+
+/*******************************************************************************/
+static ReturnCode rfalNfcaPollerFullColResStartDevice( void )
+{
+    ReturnCode           ret;
+    rfalNfcaListenDevice *dev;
+    
+    dev = &gNfca.fullColRes.nfcaDevList[*gNfca.fullColRes.devCnt];
+    
+    EXIT_ON_ERR( ret, rfalNfcaPollerStartSingleCollisionResolution( gNfca.fullColRes.devLimit, &gNfca.fullColRes.collPending, &dev->selRes, (uint8_t*)&dev->nfcId1, (uint8_t*)&dev->nfcId1Len ) );
+    
+    /* Collisions are only worth keeping if more than one device is to be resolved */
+    gNfca.colRes.trackTree     = (gNfca.fullColRes.devLimit > 1U);
+    gNfca.fullColRes.isResumed = (gNfca.fullColRes.treeCnt != 0U);
+    
+    if( gNfca.fullColRes.isResumed )
+    {
+        /* Resume from the deepest unresolved collision instead of walking the tree again from the root */
+        gNfca.fullColRes.treeCnt--;
+        gNfca.fullColRes.resumeNode = gNfca.fullColRes.tree[gNfca.fullColRes.treeCnt];
+        
+        gNfca.colRes.resume    = &gNfca.fullColRes.resumeNode;
+        gNfca.colRes.cascadeLv = gNfca.fullColRes.resumeNode.cascadeLv;
+        dev->nfcId1Len         = (uint8_t)(gNfca.colRes.cascadeLv * (RFAL_NFCA_CASCADE_1_UID_LEN - RFAL_NFCA_SDD_CT_LEN));
+        ST_MEMCPY( dev->nfcId1, gNfca.fullColRes.resumeNode.nfcId1, dev->nfcId1Len );
+        
+        /* Devices on this branch must be brought to its Cascade Level first */
+        gNfca.colRes.reselLv   = (uint8_t)RFAL_NFCA_SEL_CASCADE_L1;
+        gNfca.colRes.state     = ((gNfca.colRes.cascadeLv > (uint8_t)RFAL_NFCA_SEL_CASCADE_L1) ? RFAL_NFCA_CR_RESEL_TX : RFAL_NFCA_CR_CL);
+    }
+    else
+    {
+        /* From the root every device left answers: any collision lost before is seen again */
+        gNfca.fullColRes.treeLost = false;
+    }
+    
+    gNfca.fullColRes.state = RFAL_NFCA_FCR_COLRES;
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+static ReturnCode rfalNfcaPollerFullColResSensReq( bool retry )
+{
+    ReturnCode ret;
+    
+    /* Send a new SENS_REQ to check for other cards  Activity 1.1  9.3.4.23 */
+    ret = rfalNfcaPollerStartCheckPresence( RFAL_14443A_SHORTFRAME_CMD_REQA, &gNfca.fullColRes.nfcaDevList[*gNfca.fullColRes.devCnt].sensRes );
+    if( ret != ERR_NONE )
+    {
+        gNfca.fullColRes.state = RFAL_NFCA_FCR_IDLE;
+        return ret;
+    }
+    
+    gNfca.fullColRes.reqRetry = retry;
+    gNfca.fullColRes.state    = RFAL_NFCA_FCR_SENSREQ;
+    return ERR_BUSY;
+}
+
+
+/*******************************************************************************/
+static void rfalNfcaPollerColResPush( void )
+{
+    rfalNfcaColNode *node;
+    uint8_t         collByte;
+    
+    /* Without room left the branch is still found by the SENS_REQ sent once all known collisions are resolved */
+    if( gNfca.fullColRes.treeCnt >= RFAL_NFCA_COLRES_TREE_LEN )
+    {
+        gNfca.fullColRes.treeLost = true;
+        return;
+    }
+    
+    node = &gNfca.fullColRes.tree[gNfca.fullColRes.treeCnt];
+    gNfca.fullColRes.treeCnt++;
+    
+    node->cascadeLv = gNfca.colRes.cascadeLv;
+    ST_MEMCPY( node->nfcId1, gNfca.colRes.nfcId1, *gNfca.colRes.nfcId1Len );
+    ST_MEMCPY( node->uid, gNfca.colRes.selReq.nfcid1, RFAL_NFCA_CASCADE_1_UID_LEN );
+    
+    /* The branch not taken is the one with the collision bit set to Zero */
+    collByte             = (uint8_t)(gNfca.colRes.bytesTxRx - RFAL_NFCA_SDD_REQ_LEN);
+    node->uid[collByte]  = (uint8_t)(node->uid[collByte] & ~(1U << gNfca.colRes.bitsTxRx));  /* MISRA 10.3 */
+    
+    node->bytesTxRx = gNfca.colRes.bytesTxRx;
+    node->bitsTxRx  = (gNfca.colRes.bitsTxRx + 1U);
+    if( node->bitsTxRx == RFAL_BITS_IN_BYTE )
+    {
+        node->bitsTxRx = 0;
+        node->bytesTxRx++;
+    }
+}
+
+
 /*
 ******************************************************************************
 * GLOBAL FUNCTIONS
@@ -194,12 +555,30 @@ ReturnCode rfalNfcaPollerInitialize( void )
 ReturnCode rfalNfcaPollerCheckPresence( rfal14443AShortFrameCmd cmd, rfalNfcaSensRes *sensRes )
 {
     ReturnCode ret;
-    uint16_t   rcvLen;
     
+    EXIT_ON_ERR( ret, rfalNfcaPollerStartCheckPresence( cmd, sensRes ) );
+    rfalNfcaRunBlocking( ret, rfalNfcaPollerGetCheckPresenceStatus() );
+    
+    return ret;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcaPollerStartCheckPresence( rfal14443AShortFrameCmd cmd, rfalNfcaSensRes *sensRes )
+{
     /* Digital 1.1 6.10.1.3  For Commands ALL_REQ, SENS_REQ, SDD_REQ, and SEL_REQ, the NFC Forum Device      *
      *              MUST treat receipt of a Listen Frame at a time after FDT(Listen, min) as a Timeour Error */
     
-    ret = rfalISO14443ATransceiveShortFrame(  cmd, (uint8_t*)sensRes, (uint8_t)rfalConvBytesToBits(sizeof(rfalNfcaSensRes)), &rcvLen, RFAL_NFCA_FDTMIN  );
+    return rfalISO14443AStartTransceiveShortFrame(  cmd, (uint8_t*)sensRes, (uint8_t)rfalConvBytesToBits(sizeof(rfalNfcaSensRes)), &gNfca.rcvLen, RFAL_NFCA_FDTMIN  );
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcaPollerGetCheckPresenceStatus( void )
+{
+    ReturnCode ret;
+    
+    ret = rfalISO14443AGetTransceiveShortFrameStatus();
     if( (ret == ERR_RF_COLLISION) || (ret == ERR_CRC)  || (ret == ERR_NOMEM) || (ret == ERR_FRAMING) || (ret == ERR_PAR) )
     {
        ret = ERR_NONE;
@@ -214,28 +593,68 @@ ReturnCode rfalNfcaPollerTechnologyDetection( rfalComplianceMode compMode, rfalN
 {
     ReturnCode ret;
     
-    EXIT_ON_ERR( ret, rfalNfcaPollerCheckPresence( ((compMode == RFAL_COMPLIANCE_MODE_EMV) ? RFAL_14443A_SHORTFRAME_CMD_WUPA : RFAL_14443A_SHORTFRAME_CMD_REQA), sensRes ) );
+    EXIT_ON_ERR( ret, rfalNfcaPollerStartTechnologyDetection( compMode, sensRes ) );
+    rfalNfcaRunBlocking( ret, rfalNfcaPollerGetTechnologyDetectionStatus() );
+    
+    return ret;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcaPollerStartTechnologyDetection( rfalComplianceMode compMode, rfalNfcaSensRes *sensRes )
+{
+    ReturnCode ret;
+    
+    EXIT_ON_ERR( ret, rfalNfcaPollerStartCheckPresence( ((compMode == RFAL_COMPLIANCE_MODE_EMV) ? RFAL_14443A_SHORTFRAME_CMD_WUPA : RFAL_14443A_SHORTFRAME_CMD_REQA), sensRes ) );
+    
+    gNfca.compMode     = compMode;
+    gNfca.techDetSleep = false;
+    
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcaPollerGetTechnologyDetectionStatus( void )
+{
+    ReturnCode ret;
+    
+    /* Check if the SLP_REQ is ongoing */
+    if( gNfca.techDetSleep )
+    {
+        return rfalNfcaPollerGetSleepStatus();
+    }
+    
+    EXIT_ON_ERR( ret, rfalNfcaPollerGetCheckPresenceStatus() );
     
     /* Send SLP_REQ as  Activity 1.1  9.2.3.6 and EMVCo 2.6  9.2.1.3 */
-    if( compMode != RFAL_COMPLIANCE_MODE_ISO)
+    if( gNfca.compMode != RFAL_COMPLIANCE_MODE_ISO)
     {
-        rfalNfcaPollerSleep();
+        if( rfalNfcaPollerStartSleep() == ERR_NONE )
+        {
+            gNfca.techDetSleep = true;
+            return ERR_BUSY;
+        }
     }
     return ERR_NONE;
 }
 
+
 /*******************************************************************************/
 ReturnCode rfalNfcaPollerSingleCollisionResolution( uint8_t devLimit, bool *collPending, rfalNfcaSelRes *selRes, uint8_t *nfcId1, uint8_t *nfcId1Len )
 {
-    uint8_t         i;
-    ReturnCode      ret;
-    rfalNfcaSelReq  selReq;
-    uint16_t        bytesRx;
-    uint8_t         bytesTxRx;
-    uint8_t         bitsTxRx;
-    bool            doBacktrack = false;
-    uint8_t         backtrackCnt = 3;
+    ReturnCode ret;
     
+    EXIT_ON_ERR( ret, rfalNfcaPollerStartSingleCollisionResolution( devLimit, collPending, selRes, nfcId1, nfcId1Len ) );
+    rfalNfcaRunBlocking( ret, rfalNfcaPollerGetSingleCollisionResolutionStatus() );
+    
+    return ret;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcaPollerStartSingleCollisionResolution( uint8_t devLimit, bool *collPending, rfalNfcaSelRes *selRes, uint8_t *nfcId1, uint8_t *nfcId1Len )
+{
     /* Check parameters */
     if( (collPending == NULL) || (selRes == NULL) || (nfcId1 == NULL) || (nfcId1Len == NULL) )
     {
@@ -247,176 +666,308 @@ ReturnCode rfalNfcaPollerSingleCollisionResolution( uint8_t devLimit, bool *coll
     *nfcId1Len   = 0;
     ST_MEMSET( nfcId1, 0x00, RFAL_NFCA_CASCADE_3_UID_LEN );
     
-    /*******************************************************************************/
+    /* Save parameters */
+    gNfca.colRes.devLimit     = devLimit;
+    gNfca.colRes.collPending  = collPending;
+    gNfca.colRes.selRes       = selRes;
+    gNfca.colRes.nfcId1       = nfcId1;
+    gNfca.colRes.nfcId1Len    = nfcId1Len;
+    
+    gNfca.colRes.doBacktrack  = false;
+    gNfca.colRes.backtrackCnt = 3;
+    gNfca.colRes.waitRetrans  = false;
+    gNfca.colRes.resume       = NULL;
+    gNfca.colRes.trackTree    = false;
+    
     /* Go through all Cascade Levels     Activity 1.1  9.3.4 */
-    for( i = (uint8_t)RFAL_NFCA_SEL_CASCADE_L1; i <= (uint8_t)RFAL_NFCA_SEL_CASCADE_L3; i++)
-    {
-        /* Initialize the SDD_REQ to send for the new cascade level */
-        ST_MEMSET( (uint8_t*)&selReq, 0x00, sizeof(rfalNfcaSelReq) );
-        selReq.selCmd = rfalNfcaCLn2SELCMD(i);
+    gNfca.colRes.cascadeLv    = (uint8_t)RFAL_NFCA_SEL_CASCADE_L1;
+    gNfca.colRes.state        = RFAL_NFCA_CR_CL;
     
-        bytesTxRx    = RFAL_NFCA_SDD_REQ_LEN;
-        bitsTxRx     = 0;
-        
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcaPollerGetSingleCollisionResolutionStatus( void )
+{
+    ReturnCode            ret;
+    uint8_t               collBit;
+    rfalTransceiveContext ctx;
+    
+    switch( gNfca.colRes.state )
+    {
         /*******************************************************************************/
-        /* Go through Collision loop */
-        do
-        {
-            uint8_t         collBit = 1; /* standards mandate or recommend collision bit to be set to One. */
+        case RFAL_NFCA_CR_CL:
+            
+            /* Initialize the SDD_REQ to send for the new cascade level */
+            ST_MEMSET( (uint8_t*)&gNfca.colRes.selReq, 0x00, sizeof(rfalNfcaSelReq) );
+            gNfca.colRes.selReq.selCmd = rfalNfcaCLn2SELCMD( gNfca.colRes.cascadeLv );
+            
+            gNfca.colRes.bytesTxRx = RFAL_NFCA_SDD_REQ_LEN;
+            gNfca.colRes.bitsTxRx  = 0;
+            
+            /* When resuming start with the partial NFCID1 of the branch not taken */
+            if( gNfca.colRes.resume != NULL )
+            {
+                ST_MEMCPY( gNfca.colRes.selReq.nfcid1, gNfca.colRes.resume->uid, RFAL_NFCA_CASCADE_1_UID_LEN );
+                gNfca.colRes.bytesTxRx = gNfca.colRes.resume->bytesTxRx;
+                gNfca.colRes.bitsTxRx  = gNfca.colRes.resume->bitsTxRx;
+                gNfca.colRes.resume    = NULL;
+            }
+            
+            gNfca.colRes.rootBytes = gNfca.colRes.bytesTxRx;
+            gNfca.colRes.rootBits  = gNfca.colRes.bitsTxRx;
+            gNfca.colRes.retries   = ((gNfca.colRes.devLimit == 0U) ? RFAL_NFCA_N_RETRANS : 0U);
+            gNfca.colRes.state     = RFAL_NFCA_CR_SDD_TX;
+            break;
+            
+        /*******************************************************************************/
+        case RFAL_NFCA_CR_SDD_TX:
+            
+            /* Wait t RETRANSMISSION if a retry is to be performed */
+            if( gNfca.colRes.waitRetrans )
+            {
+                if( !rfalNfcaTimerisExpired( gNfca.colRes.tmr ) )
+                {
+                    return ERR_BUSY;
+                }
+                gNfca.colRes.waitRetrans = false;
+            }
+            
             /* Calculate SEL_PAR with the bytes/bits to be sent */
-            selReq.selPar = rfalNfcaSelPar(bytesTxRx, bitsTxRx);
-    
-            /* Send SDD_REQ (Anticollision frame) - Retry upon timeout  EMVCo 2.6  9.6.1.3 */
-            rfalNfcaTxRetry( ret, rfalISO14443ATransceiveAnticollisionFrame( (uint8_t*)&selReq, &bytesTxRx, &bitsTxRx, &bytesRx, RFAL_NFCA_FDTMIN ), ((devLimit==0U)?RFAL_NFCA_N_RETRANS:0U), RFAL_NFCA_T_RETRANS );
+            gNfca.colRes.selReq.selPar = rfalNfcaSelPar( gNfca.colRes.bytesTxRx, gNfca.colRes.bitsTxRx );
+            
+            /* Send SDD_REQ (Anticollision frame) */
+            ret = rfalISO14443AStartTransceiveAnticollisionFrame( (uint8_t*)&gNfca.colRes.selReq, &gNfca.colRes.bytesTxRx, &gNfca.colRes.bitsTxRx, &gNfca.colRes.rxLen, RFAL_NFCA_FDTMIN );
+            if( ret != ERR_NONE )
+            {
+                gNfca.colRes.state = RFAL_NFCA_CR_IDLE;
+                return ret;
+            }
+            
+            gNfca.colRes.state = RFAL_NFCA_CR_SDD;
+            break;
+            
+        /*******************************************************************************/
+        case RFAL_NFCA_CR_SDD:
+            
+            ret = rfalISO14443AGetTransceiveAnticollisionFrameStatus();
+            if( ret == ERR_BUSY )
+            {
+                return ret;
+            }
+            
+            /* Retry upon timeout  EMVCo 2.6  9.6.1.3 */
+            if( (ret == ERR_TIMEOUT) && (gNfca.colRes.retries != 0U) )
+            {
+                gNfca.colRes.retries--;
+                gNfca.colRes.waitRetrans = true;
+                rfalNfcaTimerStart( gNfca.colRes.tmr, RFAL_NFCA_T_RETRANS );
+                
+                gNfca.colRes.state = RFAL_NFCA_CR_SDD_TX;
+                break;
+            }
             
-            bytesRx = rfalConvBitsToBytes(bytesRx);
+            gNfca.colRes.rxLen = rfalConvBitsToBytes( gNfca.colRes.rxLen );
             
             if ((ret == ERR_TIMEOUT) 
-                && (backtrackCnt != 0U) && !doBacktrack
-                && !((RFAL_NFCA_SDD_REQ_LEN==bytesTxRx) && (0U==bitsTxRx)))
+                && (gNfca.colRes.backtrackCnt != 0U) && !gNfca.colRes.doBacktrack
+                && !((gNfca.colRes.rootBytes == gNfca.colRes.bytesTxRx) && (gNfca.colRes.rootBits == gNfca.colRes.bitsTxRx)))
             { 
                 /* In multiple card scenarios it may always happen that some 
                  * collisions of a weaker tag go unnoticed. If then a later 
                  * collision is recognized and the strong tag has a 0 at the 
                  * collision position then no tag will respond. Catch this 
                  * corner case and then try with the bit being sent as zero. */
-                rfalNfcaSensRes sensRes;
-                ret = ERR_RF_COLLISION;
-                rfalNfcaPollerCheckPresence( RFAL_14443A_SHORTFRAME_CMD_REQA, &sensRes );
-                /* Algorithm below does a post-increment, decrement to go back to current position */
-                if (0U == bitsTxRx)
-                {
-                    bitsTxRx = 7;
-                    bytesTxRx--;
-                }
-                else
-                {
-                    bitsTxRx--;
-                }
-                collBit = (uint8_t)( ((uint8_t*)&selReq)[bytesTxRx] & (1U << bitsTxRx) );
-                collBit = (uint8_t)((0U==collBit)?1U:0U); // invert the collision bit
-                doBacktrack = true;
-                backtrackCnt--;
+                rfalNfcaPollerStartCheckPresence( RFAL_14443A_SHORTFRAME_CMD_REQA, &gNfca.sensRes );
+                
+                gNfca.colRes.state = RFAL_NFCA_CR_BACKTRACK;
+                break;
             }
-            else
+            
+            gNfca.colRes.doBacktrack = false;
+            
+            /* standards mandate or recommend collision bit to be set to One. */
+            return rfalNfcaPollerSddResolution( ret, 1U );
+            
+        /*******************************************************************************/
+        case RFAL_NFCA_CR_BACKTRACK:
+            
+            if( rfalNfcaPollerGetCheckPresenceStatus() == ERR_BUSY )
             {
-                doBacktrack = false;
+                return ERR_BUSY;
             }
-
-            if( ret == ERR_RF_COLLISION )
+            
+            /* Algorithm below does a post-increment, decrement to go back to current position */
+            if (0U == gNfca.colRes.bitsTxRx)
             {
-                /* Check received length */
-                if( (bytesTxRx + ((bitsTxRx != 0U) ? 1U : 0U)) > (RFAL_NFCA_SDD_RES_LEN + RFAL_NFCA_SDD_REQ_LEN) )
+                gNfca.colRes.bitsTxRx = 7;
+                gNfca.colRes.bytesTxRx--;
+            }
+            else
+            {
+                gNfca.colRes.bitsTxRx--;
+            }
+            collBit = (uint8_t)( ((uint8_t*)&gNfca.colRes.selReq)[gNfca.colRes.bytesTxRx] & (1U << gNfca.colRes.bitsTxRx) );
+            collBit = (uint8_t)((0U==collBit)?1U:0U); // invert the collision bit
+            gNfca.colRes.doBacktrack = true;
+            gNfca.colRes.backtrackCnt--;
+            
+            return rfalNfcaPollerSddResolution( ERR_RF_COLLISION, collBit );
+            
+        /*******************************************************************************/
+        case RFAL_NFCA_CR_RESEL_TX:
+            
+            /* Select again the previous Cascade Level of the collision being resumed */
+            gNfca.colRes.selReq.selCmd    = rfalNfcaCLn2SELCMD( gNfca.colRes.reselLv );
+            gNfca.colRes.selReq.selPar    = RFAL_NFCA_SEL_SELPAR;
+            gNfca.colRes.selReq.nfcid1[0] = RFAL_NFCA_SDD_CT;
+            ST_MEMCPY( &gNfca.colRes.selReq.nfcid1[RFAL_NFCA_SDD_CT_LEN], &gNfca.colRes.nfcId1[(gNfca.colRes.reselLv * (RFAL_NFCA_CASCADE_1_UID_LEN - RFAL_NFCA_SDD_CT_LEN))], (RFAL_NFCA_CASCADE_1_UID_LEN - RFAL_NFCA_SDD_CT_LEN) );
+            gNfca.colRes.selReq.bcc       = rfalNfcaCalculateBcc( gNfca.colRes.selReq.nfcid1, RFAL_NFCA_CASCADE_1_UID_LEN );
+            
+            rfalCreateByteFlagsTxRxContext( ctx, (uint8_t*)&gNfca.colRes.selReq, sizeof(rfalNfcaSelReq), (uint8_t*)gNfca.colRes.selRes, sizeof(rfalNfcaSelRes), &gNfca.colRes.rxLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_NFCA_FDTMIN );
+            ret = rfalStartTransceive( &ctx );
+            if( ret != ERR_NONE )
+            {
+                gNfca.colRes.state = RFAL_NFCA_CR_IDLE;
+                return ret;
+            }
+            
+            gNfca.colRes.state = RFAL_NFCA_CR_RESEL;
+            break;
+            
+        /*******************************************************************************/
+        case RFAL_NFCA_CR_RESEL:
+            
+            ret = rfalGetTransceiveStatus();
+            if( ret == ERR_BUSY )
+            {
+                return ret;
+            }
+            
+            /* No device left on this branch if Timeout */
+            if( ret != ERR_NONE )
+            {
+                gNfca.colRes.state = RFAL_NFCA_CR_IDLE;
+                return ret;
+            }
+            
+            if( rfalConvBitsToBytes( gNfca.colRes.rxLen ) != sizeof(rfalNfcaSelRes) )
+            {
+                gNfca.colRes.state = RFAL_NFCA_CR_IDLE;
+                return ERR_PROTO;
+            }
+            
+            gNfca.colRes.reselLv++;
+            gNfca.colRes.state = ((gNfca.colRes.reselLv < gNfca.colRes.cascadeLv) ? RFAL_NFCA_CR_RESEL_TX : RFAL_NFCA_CR_CL);
+            break;
+            
+        /*******************************************************************************/
+        case RFAL_NFCA_CR_SEL_TX:
+            
+            /* Wait t RETRANSMISSION if a retry is to be performed */
+            if( gNfca.colRes.waitRetrans )
+            {
+                if( !rfalNfcaTimerisExpired( gNfca.colRes.tmr ) )
                 {
-                    return ERR_PROTO;
-                }
-
-                if( ((bytesTxRx + ((bitsTxRx != 0U) ? 1U : 0U)) > (RFAL_NFCA_CASCADE_1_UID_LEN + RFAL_NFCA_SDD_REQ_LEN)) && (backtrackCnt != 0U) )
-                { /* Collision in BCC: Anticollide only UID part */
-                    backtrackCnt--;
-                    bytesTxRx = RFAL_NFCA_CASCADE_1_UID_LEN + RFAL_NFCA_SDD_REQ_LEN - 1U;
-                    bitsTxRx = 7;
-                    collBit = (uint8_t)( ((uint8_t*)&selReq)[bytesTxRx] & (1U << bitsTxRx) ); /* Not a real collision, extract the actual bit for the subsequent code */
-                }
-                
-                if( (devLimit == 0U) && !(*collPending) )
-                {   
-                    /* Activity 1.0 & 1.1  9.3.4.12: If CON_DEVICES_LIMIT has a value of 0, then 
-                     * NFC Forum Device is configured to perform collision detection only       */
-                    *collPending = true;
-                    return ERR_IGNORE;
+                    return ERR_BUSY;
                 }
+                gNfca.colRes.waitRetrans = false;
+            }
+            
+            /* Send SEL_REQ (Select command) */
+            rfalCreateByteFlagsTxRxContext( ctx, (uint8_t*)&gNfca.colRes.selReq, sizeof(rfalNfcaSelReq), (uint8_t*)gNfca.colRes.selRes, sizeof(rfalNfcaSelRes), &gNfca.colRes.rxLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_NFCA_FDTMIN );
+            ret = rfalStartTransceive( &ctx );
+            if( ret != ERR_NONE )
+            {
+                gNfca.colRes.state = RFAL_NFCA_CR_IDLE;
+                return ret;
+            }
+            
+            gNfca.colRes.state = RFAL_NFCA_CR_SEL;
+            break;
+            
+        /*******************************************************************************/
+        case RFAL_NFCA_CR_SEL:
+            
+            ret = rfalGetTransceiveStatus();
+            if( ret == ERR_BUSY )
+            {
+                return ret;
+            }
+            
+            /* Retry upon timeout  EMVCo 2.6  9.6.1.3 */
+            if( (ret == ERR_TIMEOUT) && (gNfca.colRes.retries != 0U) )
+            {
+                gNfca.colRes.retries--;
+                gNfca.colRes.waitRetrans = true;
+                rfalNfcaTimerStart( gNfca.colRes.tmr, RFAL_NFCA_T_RETRANS );
                 
-                *collPending = true;
+                gNfca.colRes.state = RFAL_NFCA_CR_SEL_TX;
+                break;
+            }
+            
+            gNfca.colRes.state = RFAL_NFCA_CR_IDLE;
+            
+            if( ret != ERR_NONE )
+            {
+                return ret;
+            }
+            
+            /* Ensure proper response length */
+            if( rfalConvBitsToBytes( gNfca.colRes.rxLen ) != sizeof(rfalNfcaSelRes) )
+            {
+                return ERR_PROTO;
+            }
+            
+            /*******************************************************************************/
+            /* Check cascade byte, if cascade tag then go next cascade level */
+            if( *gNfca.colRes.selReq.nfcid1 == RFAL_NFCA_SDD_CT )
+            {
+                /* Cascade Tag present, store nfcid1 bytes (excluding cascade tag) and continue for next CL */
+                ST_MEMCPY( &gNfca.colRes.nfcId1[*gNfca.colRes.nfcId1Len], &((uint8_t*)&gNfca.colRes.selReq.nfcid1)[RFAL_NFCA_SDD_CT_LEN], (RFAL_NFCA_CASCADE_1_UID_LEN - RFAL_NFCA_SDD_CT_LEN) );
+                *gNfca.colRes.nfcId1Len += (RFAL_NFCA_CASCADE_1_UID_LEN - RFAL_NFCA_SDD_CT_LEN);
                 
-                /* Set and select the collision bit, with the number of bytes/bits successfully TxRx */
-                if (collBit != 0U)
-                {
-                    ((uint8_t*)&selReq)[bytesTxRx] = (uint8_t)(((uint8_t*)&selReq)[bytesTxRx] | (1U << bitsTxRx));   /* MISRA 10.3 */
-                }
-                else
+                gNfca.colRes.cascadeLv++;
+                if( gNfca.colRes.cascadeLv > (uint8_t)RFAL_NFCA_SEL_CASCADE_L3 )
                 {
-                    ((uint8_t*)&selReq)[bytesTxRx] = (uint8_t)(((uint8_t*)&selReq)[bytesTxRx] & ~(1U << bitsTxRx));  /* MISRA 10.3 */
+                    return ERR_INTERNAL;
                 }
-
-                bitsTxRx++;
                 
-                /* Check if number of bits form a byte */
-                if( bitsTxRx == RFAL_BITS_IN_BYTE )
-                {
-                    bitsTxRx = 0;
-                    bytesTxRx++;
-                }
+                gNfca.colRes.state = RFAL_NFCA_CR_CL;
+                break;
             }
-        }while (ret == ERR_RF_COLLISION);
-        
-        
-        /*******************************************************************************/
-        /* Check if Collision loop has failed */
-        if( ret != ERR_NONE )
-        {
-            return ret;
-        }
-        
-        
-        /* If collisions are to be reported check whether the response is complete */
-        if( (devLimit == 0U) && (bytesRx != sizeof(rfalNfcaSddRes)) )
-        {
-            return ERR_PROTO;
-        }
-        
-        /* Check if the received BCC match */
-        if( selReq.bcc != rfalNfcaCalculateBcc( selReq.nfcid1, RFAL_NFCA_CASCADE_1_UID_LEN ) )
-        {
-            return ERR_PROTO;
-        }
-        
-        /*******************************************************************************/
-        /* Anticollision OK, Select this Cascade Level */
-        selReq.selPar = RFAL_NFCA_SEL_SELPAR;
-        
-        /* Send SEL_REQ (Select command) - Retry upon timeout  EMVCo 2.6  9.6.1.3 */
-        rfalNfcaTxRetry( ret, rfalTransceiveBlockingTxRx( (uint8_t*)&selReq, sizeof(rfalNfcaSelReq), (uint8_t*)selRes, sizeof(rfalNfcaSelRes), &bytesRx, RFAL_TXRX_FLAGS_DEFAULT, RFAL_NFCA_FDTMIN ), ((devLimit==0U)?RFAL_NFCA_N_RETRANS:0U), RFAL_NFCA_T_RETRANS );
-        
-        if( ret != ERR_NONE )
-        {
-            return ret;
-        }
-
-        
-        /* Ensure proper response length */
-        if( bytesRx != sizeof(rfalNfcaSelRes) )
-        {
-            return ERR_PROTO;
-        }
-        
-        /*******************************************************************************/
-        /* Check cascade byte, if cascade tag then go next cascade level */
-        if( (ret == ERR_NONE) && (*selReq.nfcid1 == RFAL_NFCA_SDD_CT) )
-        {
-            /* Cascade Tag present, store nfcid1 bytes (excluding cascade tag) and continue for next CL */
-            ST_MEMCPY( &nfcId1[*nfcId1Len], &((uint8_t*)&selReq.nfcid1)[RFAL_NFCA_SDD_CT_LEN], (RFAL_NFCA_CASCADE_1_UID_LEN - RFAL_NFCA_SDD_CT_LEN) );
-            *nfcId1Len += (RFAL_NFCA_CASCADE_1_UID_LEN - RFAL_NFCA_SDD_CT_LEN);
-        }
-        else
-        {
+            
             /* UID Selection complete, Stop Cascade Level loop */
-            ST_MEMCPY( &nfcId1[*nfcId1Len], (uint8_t*)&selReq.nfcid1, RFAL_NFCA_CASCADE_1_UID_LEN );
-            *nfcId1Len += RFAL_NFCA_CASCADE_1_UID_LEN;
+            ST_MEMCPY( &gNfca.colRes.nfcId1[*gNfca.colRes.nfcId1Len], (uint8_t*)&gNfca.colRes.selReq.nfcid1, RFAL_NFCA_CASCADE_1_UID_LEN );
+            *gNfca.colRes.nfcId1Len += RFAL_NFCA_CASCADE_1_UID_LEN;
             return ERR_NONE;
-        }
+            
+        /*******************************************************************************/
+        default:
+            return ERR_WRONG_STATE;
     }
-    return ERR_INTERNAL;
+    
+    return ERR_BUSY;
 }
 
 
 /*******************************************************************************/
 ReturnCode rfalNfcaPollerFullCollisionResolution( rfalComplianceMode compMode, uint8_t devLimit, rfalNfcaListenDevice *nfcaDevList, uint8_t *devCnt )
 {
-    ReturnCode      ret;
-    bool            collPending;
-    rfalNfcaSensRes sensRes;
-    uint16_t        rcvLen;
+    ReturnCode ret;
+    
+    EXIT_ON_ERR( ret, rfalNfcaPollerStartFullCollisionResolution( compMode, devLimit, nfcaDevList, devCnt ) );
+    rfalNfcaRunBlocking( ret, rfalNfcaPollerGetFullCollisionResolutionStatus() );
+    
+    return ret;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcaPollerStartFullCollisionResolution( rfalComplianceMode compMode, uint8_t devLimit, rfalNfcaListenDevice *nfcaDevList, uint8_t *devCnt )
+{
+    ReturnCode ret;
     
     if( (nfcaDevList == NULL) || (devCnt == NULL) )
     {
@@ -424,164 +975,242 @@ ReturnCode rfalNfcaPollerFullCollisionResolution( rfalComplianceMode compMode, u
     }
     
     *devCnt = 0;
-    ret     = ERR_NONE;
+    
+    /* Save parameters */
+    gNfca.fullColRes.compMode    = compMode;
+    gNfca.fullColRes.devLimit    = devLimit;
+    gNfca.fullColRes.nfcaDevList = nfcaDevList;
+    gNfca.fullColRes.devCnt      = devCnt;
+    gNfca.fullColRes.collPending = false;
+    gNfca.fullColRes.isResumed   = false;
+    gNfca.fullColRes.treeCnt     = 0;
+    gNfca.fullColRes.treeLost    = false;
     
     /*******************************************************************************/
     /* Send ALL_REQ before Anticollision if a Sleep was sent before  Activity 1.1  9.3.4.1 and EMVco 2.6  9.3.2.1 */
     if( compMode != RFAL_COMPLIANCE_MODE_ISO )
     {
-        ret = rfalISO14443ATransceiveShortFrame( RFAL_14443A_SHORTFRAME_CMD_WUPA, (uint8_t*)&nfcaDevList->sensRes, (uint8_t)rfalConvBytesToBits(sizeof(rfalNfcaSensRes)), &rcvLen, RFAL_NFCA_FDTMIN  );
-        if(ret != ERR_NONE)
-        {
-            if( (compMode == RFAL_COMPLIANCE_MODE_EMV) || ((ret != ERR_RF_COLLISION) && (ret != ERR_CRC) && (ret != ERR_FRAMING) && (ret != ERR_PAR)) )
-            {
-                return ret;
-            }
-        }
-        
-        /* Check proper SENS_RES/ATQA size */
-        if( (ret == ERR_NONE) && (rfalConvBytesToBits(sizeof(rfalNfcaSensRes)) != rcvLen) )
-        {
-            return ERR_PROTO;
-        }
-    }
-    
-
-    #if RFAL_FEATURE_T1T
-    /*******************************************************************************/
-    /* Only check for T1T if previous SENS_RES was received without a transmission  *
-     * error. When collisions occur bits in the SENS_RES may look like a T1T        */
-    /* If T1T Anticollision is not supported  Activity 1.1  9.3.4.3 */
-    if( rfalNfcaIsSensResT1T( &nfcaDevList->sensRes ) && (devLimit != 0U) && (ret == ERR_NONE) && (compMode != RFAL_COMPLIANCE_MODE_EMV) )
-    {
-        /* RID_REQ shall be performed with rfalT1TPollerRid()    Activity 1.1  9.3.4.24 */
-        rfalT1TPollerInitialize();
-        EXIT_ON_ERR( ret, rfalT1TPollerRid( &nfcaDevList->ridRes ) );
-        
-        /* T1T doesn't support Anticollision */
-        *devCnt = 1;
-        nfcaDevList->isSleep   = false;
-        nfcaDevList->type      = RFAL_NFCA_T1T;
-        nfcaDevList->nfcId1Len = RFAL_NFCA_CASCADE_1_UID_LEN;
-        ST_MEMCPY( &nfcaDevList->nfcId1, &nfcaDevList->ridRes.uid, RFAL_NFCA_CASCADE_1_UID_LEN );
+        EXIT_ON_ERR( ret, rfalISO14443AStartTransceiveShortFrame( RFAL_14443A_SHORTFRAME_CMD_WUPA, (uint8_t*)&nfcaDevList->sensRes, (uint8_t)rfalConvBytesToBits(sizeof(rfalNfcaSensRes)), &gNfca.rcvLen, RFAL_NFCA_FDTMIN  ) );
         
+        gNfca.fullColRes.state = RFAL_NFCA_FCR_ALLREQ;
         return ERR_NONE;
-    }    
-    #endif /* RFAL_FEATURE_T1T */
-    
-    /*******************************************************************************/
-    /* Store the SENS_RES from Technology Detection or from WUPA */ 
-    sensRes = nfcaDevList->sensRes;
-    
-    if( devLimit > 0U )  /* MISRA 21.18 */
-    {
-        ST_MEMSET( nfcaDevList, 0x00, (sizeof(rfalNfcaListenDevice) * devLimit) );
     }
     
-    /* Restore the prev SENS_RES, assuming that the SENS_RES received is from first device
-     * When only one device is detected it's not woken up then we'll have no SENS_RES (ATQA) */
-    nfcaDevList->sensRes = sensRes;
-    
+    ret = rfalNfcaPollerFullColResPrepare( ERR_NONE );
+    return ((ret == ERR_BUSY) ? ERR_NONE : ret);
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcaPollerGetFullCollisionResolutionStatus( void )
+{
+    ReturnCode ret;
+    uint8_t    newDeviceType;
     
-    /*******************************************************************************/
-    do
+    switch( gNfca.fullColRes.state )
     {
-        uint8_t newDeviceType;
-        
-        EXIT_ON_ERR( ret, rfalNfcaPollerSingleCollisionResolution( devLimit, &collPending, &nfcaDevList[*devCnt].selRes, (uint8_t*)&nfcaDevList[*devCnt].nfcId1, (uint8_t*)&nfcaDevList[*devCnt].nfcId1Len ) );
-        
-        /* Assign Listen Device */
-        newDeviceType = ((uint8_t)nfcaDevList[*devCnt].selRes.sak) & RFAL_NFCA_SEL_RES_CONF_MASK;  /* MISRA 10.8 */
-        /* PRQA S 4342 1 # MISRA 10.5 - Guaranteed that no invalid enum values are created: see guard_eq_RFAL_NFCA_T2T, .... */
-        nfcaDevList[*devCnt].type    = (rfalNfcaListenDeviceType) (newDeviceType);
-        nfcaDevList[*devCnt].isSleep = false;
-        (*devCnt)++;
-
-        
-        /* If a collision was detected and device counter is lower than limit  Activity 1.1  9.3.4.21 */
-        if( (*devCnt < devLimit) && ((collPending) || (compMode != RFAL_COMPLIANCE_MODE_ISO) ) )
-        {
-            /* Put this device to Sleep  Activity 1.1  9.3.4.22 */
-            rfalNfcaPollerSleep();
-            nfcaDevList[(*devCnt - 1U)].isSleep = true;
+        /*******************************************************************************/
+        case RFAL_NFCA_FCR_ALLREQ:
             
+            ret = rfalISO14443AGetTransceiveShortFrameStatus();
+            if( ret == ERR_BUSY )
+            {
+                return ret;
+            }
             
-            /* Send a new SENS_REQ to check for other cards  Activity 1.1  9.3.4.23 */
-            ret = rfalNfcaPollerCheckPresence( RFAL_14443A_SHORTFRAME_CMD_REQA, &nfcaDevList[*devCnt].sensRes );
-            if( ret == ERR_TIMEOUT )
+            if(ret != ERR_NONE)
             {
-                /* No more devices found, exit */
-                collPending = false;
+                if( (gNfca.fullColRes.compMode == RFAL_COMPLIANCE_MODE_EMV) || ((ret != ERR_RF_COLLISION) && (ret != ERR_CRC) && (ret != ERR_FRAMING) && (ret != ERR_PAR)) )
+                {
+                    gNfca.fullColRes.state = RFAL_NFCA_FCR_IDLE;
+                    return ret;
+                }
             }
-            else
+            
+            /* Check proper SENS_RES/ATQA size */
+            if( (ret == ERR_NONE) && (rfalConvBytesToBits(sizeof(rfalNfcaSensRes)) != gNfca.rcvLen) )
             {
-                /* Another device found, continue loop */
-                collPending = true;
+                gNfca.fullColRes.state = RFAL_NFCA_FCR_IDLE;
+                return ERR_PROTO;
             }
-        }
-        else
-        {
+            
+            return rfalNfcaPollerFullColResPrepare( ret );
+            
+        /*******************************************************************************/
+    #if RFAL_FEATURE_T1T
+        case RFAL_NFCA_FCR_RID:
+            
+            ret = rfalT1TPollerGetRidStatus();
+            if( ret == ERR_BUSY )
+            {
+                return ret;
+            }
+            
+            gNfca.fullColRes.state = RFAL_NFCA_FCR_IDLE;
+            if( ret != ERR_NONE )
+            {
+                return ret;
+            }
+            
+            /* T1T doesn't support Anticollision */
+            *gNfca.fullColRes.devCnt = 1;
+            gNfca.fullColRes.nfcaDevList->isSleep   = false;
+            gNfca.fullColRes.nfcaDevList->type      = RFAL_NFCA_T1T;
+            gNfca.fullColRes.nfcaDevList->nfcId1Len = RFAL_NFCA_CASCADE_1_UID_LEN;
+            ST_MEMCPY( &gNfca.fullColRes.nfcaDevList->nfcId1, &gNfca.fullColRes.nfcaDevList->ridRes.uid, RFAL_NFCA_CASCADE_1_UID_LEN );
+            (void)rfalGetTransceiveRSSI( &gNfca.fullColRes.nfcaDevList->rssi );
+            
+            return ERR_NONE;
+    #endif /* RFAL_FEATURE_T1T */
+            
+        /*******************************************************************************/
+        case RFAL_NFCA_FCR_COLRES:
+            
+            ret = rfalNfcaPollerGetSingleCollisionResolutionStatus();
+            if( ret == ERR_BUSY )
+            {
+                return ret;
+            }
+            
+            if( ret != ERR_NONE )
+            {
+                /* A resumed branch may have become empty (device removed), continue with the remaining ones */
+                if( gNfca.fullColRes.isResumed )
+                {
+                    return rfalNfcaPollerFullColResSensReq( false );
+                }
+                
+                gNfca.fullColRes.state = RFAL_NFCA_FCR_IDLE;
+                return ret;
+            }
+            
+            /* Assign Listen Device */
+            newDeviceType = ((uint8_t)gNfca.fullColRes.nfcaDevList[*gNfca.fullColRes.devCnt].selRes.sak) & RFAL_NFCA_SEL_RES_CONF_MASK;  /* MISRA 10.8 */
+            /* PRQA S 4342 1 # MISRA 10.5 - Guaranteed that no invalid enum values are created: see guard_eq_RFAL_NFCA_T2T, .... */
+            gNfca.fullColRes.nfcaDevList[*gNfca.fullColRes.devCnt].type    = (rfalNfcaListenDeviceType) (newDeviceType);
+            gNfca.fullColRes.nfcaDevList[*gNfca.fullColRes.devCnt].isSleep = false;
+            (void)rfalGetTransceiveRSSI( &gNfca.fullColRes.nfcaDevList[*gNfca.fullColRes.devCnt].rssi );   /* SEL_RES was the last reception */
+            (*gNfca.fullColRes.devCnt)++;
+            
+            /* If a collision was detected and device counter is lower than limit  Activity 1.1  9.3.4.21 */
+            if( (*gNfca.fullColRes.devCnt < gNfca.fullColRes.devLimit) && ((gNfca.fullColRes.collPending) || (gNfca.fullColRes.treeCnt != 0U) || (gNfca.fullColRes.treeLost) || (gNfca.fullColRes.compMode != RFAL_COMPLIANCE_MODE_ISO) ) )
+            {
+                /* Put this device to Sleep  Activity 1.1  9.3.4.22 */
+                rfalNfcaPollerStartSleep();
+                
+                gNfca.fullColRes.state = RFAL_NFCA_FCR_SLEEP;
+                return ERR_BUSY;
+            }
+            
             /* Exit loop */
-            collPending = false;
-        }
-    }while( (*devCnt < devLimit) && (collPending) );
-    
-    return ERR_NONE;
+            gNfca.fullColRes.state = RFAL_NFCA_FCR_IDLE;
+            return ERR_NONE;
+            
+        /*******************************************************************************/
+        case RFAL_NFCA_FCR_SLEEP:
+            
+            if( rfalNfcaPollerGetSleepStatus() == ERR_BUSY )
+            {
+                return ERR_BUSY;
+            }
+            gNfca.fullColRes.nfcaDevList[(*gNfca.fullColRes.devCnt - 1U)].isSleep = true;
+            
+            return rfalNfcaPollerFullColResSensReq( false );
+            
+        /*******************************************************************************/
+        case RFAL_NFCA_FCR_SENSREQ:
+            
+            ret = rfalNfcaPollerGetCheckPresenceStatus();
+            if( ret == ERR_BUSY )
+            {
+                return ret;
+            }
+            
+            /* Devices left in READY by an SDD_REQ on an empty branch do not answer the first SENS_REQ */
+            if( (ret == ERR_TIMEOUT) && (gNfca.fullColRes.treeCnt != 0U) && !gNfca.fullColRes.reqRetry )
+            {
+                return rfalNfcaPollerFullColResSensReq( true );
+            }
+            
+            /* No more devices found if Timeout, otherwise another device found continue loop */
+            gNfca.fullColRes.collPending = (ret != ERR_TIMEOUT);
+            
+            if( (*gNfca.fullColRes.devCnt < gNfca.fullColRes.devLimit) && (gNfca.fullColRes.collPending) )
+            {
+                ret = rfalNfcaPollerFullColResStartDevice();
+                if( ret != ERR_NONE )
+                {
+                    gNfca.fullColRes.state = RFAL_NFCA_FCR_IDLE;
+                    return ret;
+                }
+                
+                return ERR_BUSY;
+            }
+            
+            gNfca.fullColRes.state = RFAL_NFCA_FCR_IDLE;
+            return ERR_NONE;
+            
+        /*******************************************************************************/
+        default:
+            return ERR_WRONG_STATE;
+    }
 }
 
 
 /*******************************************************************************/
 ReturnCode rfalNfcaPollerSelect( const uint8_t *nfcid1, uint8_t nfcidLen, rfalNfcaSelRes *selRes )
 {
-    uint8_t        i;
-    uint8_t        cl;
-    uint8_t        nfcidOffset;
-    uint16_t       rxLen;
-    ReturnCode     ret;
-    rfalNfcaSelReq selReq;
+    ReturnCode ret;
+    
+    EXIT_ON_ERR( ret, rfalNfcaPollerStartSelect( nfcid1, nfcidLen, selRes ) );
+    rfalNfcaRunBlocking( ret, rfalNfcaPollerGetSelectStatus() );
     
+    return ret;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcaPollerStartSelect( const uint8_t *nfcid1, uint8_t nfcidLen, rfalNfcaSelRes *selRes )
+{
     if( (nfcid1 == NULL) || (nfcidLen > RFAL_NFCA_CASCADE_3_UID_LEN) || (selRes == NULL) )
     {
         return ERR_PARAM;
     }
     
-    
     /* Calculate Cascate Level */
-    cl          = rfalNfcaNfcidLen2CL( nfcidLen );
-    nfcidOffset = 0;
+    gNfca.sel.nfcid1      = nfcid1;
+    gNfca.sel.selRes      = selRes;
+    gNfca.sel.cl          = rfalNfcaNfcidLen2CL( nfcidLen );
+    gNfca.sel.clIt        = RFAL_NFCA_SEL_CASCADE_L1;
+    gNfca.sel.nfcidOffset = 0;
+    
+    return rfalNfcaPollerSelectCL();
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcaPollerGetSelectStatus( void )
+{
+    ReturnCode ret;
+    
+    ret = rfalGetTransceiveStatus();
+    if( ret != ERR_NONE )
+    {
+        return ret;
+    }
+    
+    /* Ensure proper response length */
+    if( gNfca.sel.rxLen != rfalConvBytesToBits( sizeof(rfalNfcaSelRes) ) )
+    {
+        return ERR_PROTO;
+    }
     
-    /*******************************************************************************/
     /* Go through all Cascade Levels     Activity 1.1  9.4.4 */
-    for( i = RFAL_NFCA_SEL_CASCADE_L1; i <= cl; i++ )
+    if( gNfca.sel.clIt < gNfca.sel.cl )
     {
-        /* Assign SEL_CMD according to the CLn and SEL_PAR*/
-        selReq.selCmd = rfalNfcaCLn2SELCMD(i);
-        selReq.selPar = RFAL_NFCA_SEL_SELPAR;
-        
-        /* Compute NFCID/Data on the SEL_REQ command   Digital 1.1  Table 18 */
-        if( cl != i )
-        {
-            *selReq.nfcid1 = RFAL_NFCA_SDD_CT;
-            ST_MEMCPY( &selReq.nfcid1[RFAL_NFCA_SDD_CT_LEN], &nfcid1[nfcidOffset], (RFAL_NFCA_CASCADE_1_UID_LEN - RFAL_NFCA_SDD_CT_LEN) );
-            nfcidOffset += (RFAL_NFCA_CASCADE_1_UID_LEN - RFAL_NFCA_SDD_CT_LEN);
-        }
-        else
-        {
-            ST_MEMCPY( selReq.nfcid1, &nfcid1[nfcidOffset], RFAL_NFCA_CASCADE_1_UID_LEN );
-        }
-        
-        /* Calculate nfcid's BCC */
-        selReq.bcc = rfalNfcaCalculateBcc( (uint8_t*)&selReq.nfcid1, sizeof(selReq.nfcid1) );
-        
-        /*******************************************************************************/
-        /* Send SEL_REQ  */
-        EXIT_ON_ERR( ret, rfalTransceiveBlockingTxRx( (uint8_t*)&selReq, sizeof(rfalNfcaSelReq), (uint8_t*)selRes, sizeof(rfalNfcaSelRes), &rxLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_NFCA_FDTMIN ) );
-        
-        /* Ensure proper response length */
-        if( rxLen != sizeof(rfalNfcaSelRes) )
-        {
-            return ERR_PROTO;
-        }
+        gNfca.sel.clIt++;
+        EXIT_ON_ERR( ret, rfalNfcaPollerSelectCL() );
+        return ERR_BUSY;
     }
     
     /* REMARK: Could check if NFCID1 is complete */
@@ -590,21 +1219,76 @@ ReturnCode rfalNfcaPollerSelect( const uint8_t *nfcid1, uint8_t nfcidLen, rfalNf
 }
 
 
+/*******************************************************************************/
+static ReturnCode rfalNfcaPollerSelectCL( void )
+{
+    rfalTransceiveContext ctx;
+    
+    /* Assign SEL_CMD according to the CLn and SEL_PAR*/
+    gNfca.sel.selReq.selCmd = rfalNfcaCLn2SELCMD( gNfca.sel.clIt );
+    gNfca.sel.selReq.selPar = RFAL_NFCA_SEL_SELPAR;
+    
+    /* Compute NFCID/Data on the SEL_REQ command   Digital 1.1  Table 18 */
+    if( gNfca.sel.cl != gNfca.sel.clIt )
+    {
+        *gNfca.sel.selReq.nfcid1 = RFAL_NFCA_SDD_CT;
+        ST_MEMCPY( &gNfca.sel.selReq.nfcid1[RFAL_NFCA_SDD_CT_LEN], &gNfca.sel.nfcid1[gNfca.sel.nfcidOffset], (RFAL_NFCA_CASCADE_1_UID_LEN - RFAL_NFCA_SDD_CT_LEN) );
+        gNfca.sel.nfcidOffset += (RFAL_NFCA_CASCADE_1_UID_LEN - RFAL_NFCA_SDD_CT_LEN);
+    }
+    else
+    {
+        ST_MEMCPY( gNfca.sel.selReq.nfcid1, &gNfca.sel.nfcid1[gNfca.sel.nfcidOffset], RFAL_NFCA_CASCADE_1_UID_LEN );
+    }
+    
+    /* Calculate nfcid's BCC */
+    gNfca.sel.selReq.bcc = rfalNfcaCalculateBcc( (uint8_t*)&gNfca.sel.selReq.nfcid1, sizeof(gNfca.sel.selReq.nfcid1) );
+    
+    /*******************************************************************************/
+    /* Send SEL_REQ  */
+    rfalCreateByteFlagsTxRxContext( ctx, (uint8_t*)&gNfca.sel.selReq, sizeof(rfalNfcaSelReq), (uint8_t*)gNfca.sel.selRes, sizeof(rfalNfcaSelRes), &gNfca.sel.rxLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_NFCA_FDTMIN );
+    return rfalStartTransceive( &ctx );
+}
+
+
 /*******************************************************************************/
 ReturnCode rfalNfcaPollerSleep( void )
 {
-    rfalNfcaSlpReq slpReq;
-    uint8_t        rxBuf;    /* dummy buffer, just to perform Rx */
+    ReturnCode ret;
     
-    slpReq.frame[RFAL_NFCA_SLP_CMD_POS]   = RFAL_NFCA_SLP_CMD;
-    slpReq.frame[RFAL_NFCA_SLP_BYTE2_POS] = RFAL_NFCA_SLP_BYTE2;
+    EXIT_ON_ERR( ret, rfalNfcaPollerStartSleep() );
+    rfalNfcaRunBlocking( ret, rfalNfcaPollerGetSleepStatus() );
+    
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcaPollerStartSleep( void )
+{
+    rfalTransceiveContext ctx;
+    
+    gNfca.slpReq.frame[RFAL_NFCA_SLP_CMD_POS]   = RFAL_NFCA_SLP_CMD;
+    gNfca.slpReq.frame[RFAL_NFCA_SLP_BYTE2_POS] = RFAL_NFCA_SLP_BYTE2;
+    
+    rfalCreateByteFlagsTxRxContext( ctx, (uint8_t*)&gNfca.slpReq, sizeof(rfalNfcaSlpReq), &gNfca.slpRes, sizeof(gNfca.slpRes), NULL, RFAL_TXRX_FLAGS_DEFAULT, RFAL_NFCA_SLP_FWT );
+    return rfalStartTransceive( &ctx );
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcaPollerGetSleepStatus( void )
+{
+    ReturnCode ret;
     
-    rfalTransceiveBlockingTxRx( (uint8_t*)&slpReq, sizeof(rfalNfcaSlpReq), &rxBuf, sizeof(rxBuf), NULL, RFAL_TXRX_FLAGS_DEFAULT, RFAL_NFCA_SLP_FWT );
-        
     /* ISO14443-3 6.4.3  HLTA - If PICC responds with any modulation during 1 ms this response shall be interpreted as not acknowledge 
        Digital 2.0  6.9.2.1 & EMVCo 3.0  5.6.2.1 - consider the HLTA command always acknowledged
        No check to be compliant with NFC and EMVCo, and to improve interoprability (Kovio RFID Tag)
     */
+    ret = rfalGetTransceiveStatus();
+    if( ret == ERR_BUSY )
+    {
+        return ret;
+    }
     
     return ERR_NONE;
 }
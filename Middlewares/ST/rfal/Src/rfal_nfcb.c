@@ -69,6 +69,9 @@
 
 #define RFAL_NFCB_ACTIVATION_FWT                    (RFAL_NFCB_FWTSENSB + RFAL_NFCB_DTPOLL_20)  /*!< FWT(SENSB) + dTbPoll  Digital 2.0  7.9.1.3  */
 
+#define RFAL_NFCB_ADAPTIVE_EST_MAX                   32U   /*!< Max population considered by the adaptive slot estimation */
+#define RFAL_NFCB_ADAPTIVE_COLL_DEV                  239U  /*!< Expected devices per collided slot (x100)  Schoute        */
+
 /*! Advanced and Extended bit mask in Parameter of SENSB_REQ */
 #define RFAL_NFCB_SENSB_REQ_PARAM                   (RFAL_NFCB_SENSB_REQ_ADV_FEATURE | RFAL_NFCB_SENSB_REQ_EXT_SENSB_RES_SUPPORTED)
 
@@ -90,6 +93,9 @@ enum
 
 #define rfalNfcbNI2NumberOfSlots( ni )  (uint8_t)(1U << (ni))  /*!< Converts the Number of slots Identifier to slot number */
 
+/*! Runs the given status method (fn) until it is no longer busy, running the RFAL worker in between */
+#define rfalNfcbRunBlocking( e, fn )    do{ (e)=(fn); rfalWorker(); }while( (e) == ERR_BUSY )
+
 /*
 ******************************************************************************
 * GLOBAL TYPES
@@ -125,11 +131,57 @@ typedef struct
 } rfalNfcbSlpbRes;
 
 
+/*! Collision Resolution states */
+typedef enum
+{
+    RFAL_NFCB_CR_IDLE,                       /*!< IDLE state                                          */
+    RFAL_NFCB_CR_ALLB,                       /*!< Wait SENSB_RES of the initial ALLB_REQ state        */
+    RFAL_NFCB_CR_LOOP,                       /*!< New slotted round state          Symbol 22          */
+    RFAL_NFCB_CR_LOOP_SLEEP,                 /*!< Wait SLPB_RES of the last device of previous round  */
+    RFAL_NFCB_CR_SENSB_TX,                   /*!< Send SENSB_REQ with number of slots  Symbol 23      */
+    RFAL_NFCB_CR_SENSB,                      /*!< Wait SENSB_RES state                                */
+    RFAL_NFCB_CR_SLOT,                       /*!< Evaluate the response of the current slot state     */
+    RFAL_NFCB_CR_SLOT_SLEEP,                 /*!< Wait SLPB_RES of a device found in this round state */
+    RFAL_NFCB_CR_SLOT_NEXT,                  /*!< Go to next slot state            Symbol 14          */
+    RFAL_NFCB_CR_SLOTMARKER                  /*!< Wait SENSB_RES of a SLOT_MARKER state               */
+} rfalNfcbColResState;
+
+
+/*! Collision Resolution context */
+typedef struct
+{
+    rfalNfcbColResState   state;             /*!< Collision Resolution state           */
+    rfalComplianceMode    compMode;          /*!< Compliance mode given by the caller  */
+    uint8_t               devLimit;          /*!< Device limit given by the caller     */
+    rfalNfcbSlots         initSlots;         /*!< Initial number of slots              */
+    rfalNfcbSlots         endSlots;          /*!< Final number of slots                */
+    rfalNfcbListenDevice  *nfcbDevList;      /*!< Caller's device list                 */
+    uint8_t               *devCnt;           /*!< Caller's device counter              */
+    bool                  *colPending;       /*!< Caller's collision pending flag      */
+    uint8_t               slotsNum;          /*!< Current number of slots identifier   */
+    uint8_t               slotCode;          /*!< Current slot code                    */
+    uint8_t               curDevCnt;         /*!< Devices found on the current round   */
+    uint8_t               emptyCnt;          /*!< Empty slots on the current round     */
+    uint8_t               collCnt;           /*!< Collided slots on the current round  */
+    bool                  isAdaptive;        /*!< Adaptive number of slots flag        */
+    ReturnCode            slotRet;           /*!< Result of the current slot           */
+} rfalNfcbColResParams;
+
+
 /*! RFAL NFC-B instance */
 typedef struct
 {
-    uint8_t  AFI;                            /*!< AFI to be used       */
-    uint8_t  PARAM;                          /*!< PARAM to be used     */
+    uint8_t              AFI;                /*!< AFI to be used                        */
+    uint8_t              PARAM;              /*!< PARAM to be used                      */
+    rfalNfcbSensbReq     sensbReq;           /*!< SENSB_REQ being sent                  */
+    rfalNfcbSlotMarker   slotMarker;         /*!< SLOT_MARKER being sent                */
+    rfalNfcbSlpbReq      slpbReq;            /*!< SLPB_REQ being sent                   */
+    rfalNfcbSlpbRes      slpbRes;            /*!< SLPB_RES received                     */
+    rfalNfcbSensbRes     *sensbRes;          /*!< Caller's SENSB_RES location           */
+    uint8_t              *sensbResLen;       /*!< Caller's SENSB_RES length location    */
+    uint16_t             rxLen;              /*!< Received length                       */
+    bool                 colPending;         /*!< Dummy collision pending flag          */
+    rfalNfcbColResParams colRes;             /*!< Collision Resolution context          */
 } rfalNfcb;
 
 /*
@@ -138,6 +190,8 @@ typedef struct
 ******************************************************************************
 */
 static ReturnCode rfalNfcbCheckSensbRes( const rfalNfcbSensbRes *sensbRes, uint8_t sensbResLen );
+static uint8_t rfalNfcbPollerAdaptiveEstimate( uint8_t slots, uint8_t emptyCnt, uint8_t singleCnt, uint8_t collCnt );
+static uint8_t rfalNfcbPollerAdaptiveSlotsNum( const rfalNfcbColResParams *cr );
 
 
 /*
@@ -172,6 +226,86 @@ static ReturnCode rfalNfcbCheckSensbRes( const rfalNfcbSensbRes *sensbRes, uint8
     return ERR_NONE;
 }
 
+
+/*******************************************************************************/
+static uint8_t rfalNfcbPollerAdaptiveEstimate( uint8_t slots, uint8_t emptyCnt, uint8_t singleCnt, uint8_t collCnt )
+{
+    uint32_t q;
+    uint32_t pPrev;
+    uint32_t pCur;
+    int32_t  e0;
+    int32_t  e1;
+    int32_t  ec;
+    uint32_t dist;
+    uint32_t bestDist;
+    uint8_t  n;
+    uint8_t  best;
+    uint8_t  minCnt;
+    
+    /* Vogt's estimation: the population whose expected number of empty, single and    *
+     * collided slots is the closest to the observed ones. Each collided slot is        *
+     * taken to hold at least its expected 2.39 devices (Schoute), which also keeps     *
+     * a collided single slot round from being underestimated.                         *
+     * Probabilities are kept in Q16, distances computed in Q8                          */
+    minCnt   = (uint8_t)(singleCnt + (((RFAL_NFCB_ADAPTIVE_COLL_DEV * collCnt) + 99U) / 100U));
+    q        = ((((uint32_t)slots - 1U) << 16U) / slots);
+    pPrev    = (1UL << 16U);
+    best     = minCnt;
+    bestDist = UINT32_MAX;
+    
+    for( n = 1; n <= RFAL_NFCB_ADAPTIVE_EST_MAX; n++ )
+    {
+        pCur = ((pPrev * q) >> 16U);
+        
+        e0 = (int32_t)((slots * pCur) >> 8U);
+        e1 = (int32_t)((n * pPrev) >> 8U);
+        ec = ((int32_t)((uint32_t)slots << 8U) - e0 - e1);
+        
+        e0  -= (int32_t)((uint32_t)emptyCnt  << 8U);
+        e1  -= (int32_t)((uint32_t)singleCnt << 8U);
+        ec  -= (int32_t)((uint32_t)collCnt   << 8U);
+        dist = (uint32_t)((e0 * e0) + (e1 * e1) + (ec * ec));
+        
+        if( (n >= minCnt) && (dist < bestDist) )
+        {
+            bestDist = dist;
+            best     = n;
+        }
+        pPrev = pCur;
+    }
+    
+    return best;
+}
+
+
+/*******************************************************************************/
+static uint8_t rfalNfcbPollerAdaptiveSlotsNum( const rfalNfcbColResParams *cr )
+{
+    uint8_t remain;
+    uint8_t slotsNum;
+    
+    /* Devices found on this round are put to sleep, only the remaining ones contend */
+    remain = rfalNfcbPollerAdaptiveEstimate( rfalNfcbNI2NumberOfSlots(cr->slotsNum), cr->emptyCnt, cr->curDevCnt, cr->collCnt );
+    remain = ((remain > cr->curDevCnt) ? (uint8_t)(remain - cr->curDevCnt) : 1U);
+    
+    /* As an empty slot is cheaper than a replied one, the most devices identified per *
+     * airtime are achieved with the number of slots just above the population         */
+    slotsNum = (uint8_t)RFAL_NFCB_SLOT_NUM_1;
+    while( (rfalNfcbNI2NumberOfSlots(slotsNum) < remain) && (slotsNum < (uint8_t)cr->endSlots) )
+    {
+        slotsNum++;
+    }
+    
+    /* Without progress on this round, always open more slots to ensure termination */
+    if( (cr->curDevCnt == 0U) && (slotsNum <= cr->slotsNum) )
+    {
+        slotsNum = (cr->slotsNum + 1U);
+    }
+    
+    return slotsNum;
+}
+
+
 /*
 ******************************************************************************
 * GLOBAL FUNCTIONS
@@ -213,10 +347,19 @@ ReturnCode rfalNfcbPollerInitializeWithParams( uint8_t AFI, uint8_t PARAM )
 /*******************************************************************************/
 ReturnCode rfalNfcbPollerCheckPresence( rfalNfcbSensCmd cmd, rfalNfcbSlots slots, rfalNfcbSensbRes *sensbRes, uint8_t *sensbResLen )
 {
-    uint16_t         rxLen;
-    ReturnCode       ret;
-    rfalNfcbSensbReq sensbReq;
+    ReturnCode ret;
+    
+    EXIT_ON_ERR( ret, rfalNfcbPollerStartCheckPresence( cmd, slots, sensbRes, sensbResLen ) );
+    rfalNfcbRunBlocking( ret, rfalNfcbPollerGetCheckPresenceStatus() );
     
+    return ret;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcbPollerStartCheckPresence( rfalNfcbSensCmd cmd, rfalNfcbSlots slots, rfalNfcbSensbRes *sensbRes, uint8_t *sensbResLen )
+{
+    rfalTransceiveContext ctx;
 
     /* Check if the command requested and given the slot number are valid */
     if( ((RFAL_NFCB_SENS_CMD_SENSB_REQ != cmd) && (RFAL_NFCB_SENS_CMD_ALLB_REQ != cmd)) ||
@@ -228,27 +371,44 @@ ReturnCode rfalNfcbPollerCheckPresence( rfalNfcbSensCmd cmd, rfalNfcbSlots slots
     *sensbResLen = 0;
     ST_MEMSET(sensbRes, 0x00, sizeof(rfalNfcbSensbRes) );
     
+    gRfalNfcb.sensbRes    = sensbRes;
+    gRfalNfcb.sensbResLen = sensbResLen;
+    
     /* Compute SENSB_REQ */
-    sensbReq.cmd   = RFAL_NFCB_CMD_SENSB_REQ;
-    sensbReq.AFI   = gRfalNfcb.AFI;
-    sensbReq.PARAM = (((uint8_t)gRfalNfcb.PARAM & RFAL_NFCB_SENSB_REQ_PARAM) | (uint8_t)cmd | (uint8_t)slots);
+    gRfalNfcb.sensbReq.cmd   = RFAL_NFCB_CMD_SENSB_REQ;
+    gRfalNfcb.sensbReq.AFI   = gRfalNfcb.AFI;
+    gRfalNfcb.sensbReq.PARAM = (((uint8_t)gRfalNfcb.PARAM & RFAL_NFCB_SENSB_REQ_PARAM) | (uint8_t)cmd | (uint8_t)slots);
     
     /* Send SENSB_REQ and disable AGC to detect collisions */
-    ret = rfalTransceiveBlockingTxRx( (uint8_t*)&sensbReq, sizeof(rfalNfcbSensbReq), (uint8_t*)sensbRes, sizeof(rfalNfcbSensbRes), &rxLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_NFCB_FWTSENSB );
+    rfalCreateByteFlagsTxRxContext( ctx, (uint8_t*)&gRfalNfcb.sensbReq, sizeof(rfalNfcbSensbReq), (uint8_t*)sensbRes, sizeof(rfalNfcbSensbRes), &gRfalNfcb.rxLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_NFCB_FWTSENSB );
+    return rfalStartTransceive( &ctx );
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcbPollerGetCheckPresenceStatus( void )
+{
+    ReturnCode ret;
+    
+    ret = rfalGetTransceiveStatus();
+    if( ret == ERR_BUSY )
+    {
+        return ret;
+    }
     
-    *sensbResLen = (uint8_t)rxLen;
+    *gRfalNfcb.sensbResLen = (uint8_t)rfalConvBitsToBytes( gRfalNfcb.rxLen );
     
     /*  Check if a transmission error was detected */
     if( (ret == ERR_CRC) || (ret == ERR_FRAMING) )
     {
         /* Invalidate received frame as an error was detected (CollisionResolution checks if valid) */
-        *sensbResLen = 0;
+        *gRfalNfcb.sensbResLen = 0;
         return ERR_NONE;
     }
     
     if( ret == ERR_NONE )
     {
-        return rfalNfcbCheckSensbRes( sensbRes, *sensbResLen );
+        return rfalNfcbCheckSensbRes( gRfalNfcb.sensbRes, *gRfalNfcb.sensbResLen );
     }
     
     return ret;
@@ -258,10 +418,19 @@ ReturnCode rfalNfcbPollerCheckPresence( rfalNfcbSensCmd cmd, rfalNfcbSlots slots
 /*******************************************************************************/
 ReturnCode rfalNfcbPollerSleep( const uint8_t* nfcid0 )
 {
-    uint16_t        rxLen;
-    ReturnCode      ret;
-    rfalNfcbSlpbReq slpbReq;
-    rfalNfcbSlpbRes slpbRes;
+    ReturnCode ret;
+    
+    EXIT_ON_ERR( ret, rfalNfcbPollerStartSleep( nfcid0 ) );
+    rfalNfcbRunBlocking( ret, rfalNfcbPollerGetSleepStatus() );
+    
+    return ret;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcbPollerStartSleep( const uint8_t* nfcid0 )
+{
+    rfalTransceiveContext ctx;
     
     if( nfcid0 == NULL )
     {
@@ -269,13 +438,27 @@ ReturnCode rfalNfcbPollerSleep( const uint8_t* nfcid0 )
     }
     
     /* Compute SLPB_REQ */
-    slpbReq.cmd = RFAL_NFCB_CMD_SLPB_REQ;
-    ST_MEMCPY( slpbReq.nfcid0, nfcid0, RFAL_NFCB_NFCID0_LEN );
+    gRfalNfcb.slpbReq.cmd = RFAL_NFCB_CMD_SLPB_REQ;
+    ST_MEMCPY( gRfalNfcb.slpbReq.nfcid0, nfcid0, RFAL_NFCB_NFCID0_LEN );
+    
+    rfalCreateByteFlagsTxRxContext( ctx, (uint8_t*)&gRfalNfcb.slpbReq, sizeof(rfalNfcbSlpbReq), (uint8_t*)&gRfalNfcb.slpbRes, sizeof(rfalNfcbSlpbRes), &gRfalNfcb.rxLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_NFCB_ACTIVATION_FWT );
+    return rfalStartTransceive( &ctx );
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcbPollerGetSleepStatus( void )
+{
+    ReturnCode ret;
     
-    EXIT_ON_ERR( ret, rfalTransceiveBlockingTxRx( (uint8_t*)&slpbReq, sizeof(rfalNfcbSlpbReq), (uint8_t*)&slpbRes, sizeof(rfalNfcbSlpbRes), &rxLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_NFCB_ACTIVATION_FWT ));
+    ret = rfalGetTransceiveStatus();
+    if( ret != ERR_NONE )
+    {
+        return ret;
+    }
     
     /* Check SLPB_RES */
-    if( (rxLen != sizeof(rfalNfcbSlpbRes)) || (slpbRes.cmd != (uint8_t)RFAL_NFCB_CMD_SLPB_RES) )
+    if( (rfalConvBitsToBytes( gRfalNfcb.rxLen ) != sizeof(rfalNfcbSlpbRes)) || (gRfalNfcb.slpbRes.cmd != (uint8_t)RFAL_NFCB_CMD_SLPB_RES) )
     {
         return ERR_PROTO;
     }
@@ -286,9 +469,19 @@ ReturnCode rfalNfcbPollerSleep( const uint8_t* nfcid0 )
 /*******************************************************************************/
 ReturnCode rfalNfcbPollerSlotMarker( uint8_t slotCode, rfalNfcbSensbRes *sensbRes, uint8_t *sensbResLen )
 {
-    ReturnCode         ret;
-    rfalNfcbSlotMarker slotMarker;
-    uint16_t           rxLen;
+    ReturnCode ret;
+    
+    EXIT_ON_ERR( ret, rfalNfcbPollerStartSlotMarker( slotCode, sensbRes, sensbResLen ) );
+    rfalNfcbRunBlocking( ret, rfalNfcbPollerGetSlotMarkerStatus() );
+    
+    return ret;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcbPollerStartSlotMarker( uint8_t slotCode, rfalNfcbSensbRes *sensbRes, uint8_t *sensbResLen )
+{
+    rfalTransceiveContext ctx;
     
     /* Check parameters */
     if( (sensbRes == NULL) || (sensbResLen == NULL)    || 
@@ -297,12 +490,30 @@ ReturnCode rfalNfcbPollerSlotMarker( uint8_t slotCode, rfalNfcbSensbRes *sensbRe
     {
         return ERR_PARAM;
     }
+    
+    gRfalNfcb.sensbRes    = sensbRes;
+    gRfalNfcb.sensbResLen = sensbResLen;
+    
     /* Compose and send SLOT_MARKER with disabled AGC to detect collisions  */
-    slotMarker.APn = ((slotCode << RFAL_NFCB_SLOT_MARKER_SC_SHIFT) | (uint8_t)RFAL_NFCB_CMD_SENSB_REQ);
+    gRfalNfcb.slotMarker.APn = ((slotCode << RFAL_NFCB_SLOT_MARKER_SC_SHIFT) | (uint8_t)RFAL_NFCB_CMD_SENSB_REQ);
     
-    ret = rfalTransceiveBlockingTxRx( (uint8_t*)&slotMarker, sizeof(rfalNfcbSlotMarker), (uint8_t*)sensbRes, sizeof(rfalNfcbSensbRes), &rxLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_NFCB_ACTIVATION_FWT );
+    rfalCreateByteFlagsTxRxContext( ctx, (uint8_t*)&gRfalNfcb.slotMarker, sizeof(rfalNfcbSlotMarker), (uint8_t*)sensbRes, sizeof(rfalNfcbSensbRes), &gRfalNfcb.rxLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_NFCB_ACTIVATION_FWT );
+    return rfalStartTransceive( &ctx );
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcbPollerGetSlotMarkerStatus( void )
+{
+    ReturnCode ret;
+    
+    ret = rfalGetTransceiveStatus();
+    if( ret == ERR_BUSY )
+    {
+        return ret;
+    }
     
-    *sensbResLen = (uint8_t)rxLen;
+    *gRfalNfcb.sensbResLen = (uint8_t)rfalConvBitsToBytes( gRfalNfcb.rxLen );
     
     /* Check if a transmission error was detected */
     if( (ret == ERR_CRC) || (ret == ERR_FRAMING) )
@@ -312,18 +523,38 @@ ReturnCode rfalNfcbPollerSlotMarker( uint8_t slotCode, rfalNfcbSensbRes *sensbRe
     
     if( ret == ERR_NONE )
     {
-        return rfalNfcbCheckSensbRes( sensbRes, *sensbResLen );
+        return rfalNfcbCheckSensbRes( gRfalNfcb.sensbRes, *gRfalNfcb.sensbResLen );
     }
     
     return ret;
 }
 
 
+/*******************************************************************************/
 ReturnCode rfalNfcbPollerTechnologyDetection( rfalComplianceMode compMode, rfalNfcbSensbRes *sensbRes, uint8_t *sensbResLen )
+{
+    ReturnCode ret;
+    
+    EXIT_ON_ERR( ret, rfalNfcbPollerStartTechnologyDetection( compMode, sensbRes, sensbResLen ) );
+    rfalNfcbRunBlocking( ret, rfalNfcbPollerGetTechnologyDetectionStatus() );
+    
+    return ret;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcbPollerStartTechnologyDetection( rfalComplianceMode compMode, rfalNfcbSensbRes *sensbRes, uint8_t *sensbResLen )
 {
     NO_WARNING(compMode);
     
-    return rfalNfcbPollerCheckPresence( RFAL_NFCB_SENS_CMD_SENSB_REQ, RFAL_NFCB_SLOT_NUM_1, sensbRes, sensbResLen );
+    return rfalNfcbPollerStartCheckPresence( RFAL_NFCB_SENS_CMD_SENSB_REQ, RFAL_NFCB_SLOT_NUM_1, sensbRes, sensbResLen );
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcbPollerGetTechnologyDetectionStatus( void )
+{
+    return rfalNfcbPollerGetCheckPresenceStatus();
 }
 
 
@@ -335,157 +566,390 @@ ReturnCode rfalNfcbPollerCollisionResolution( rfalComplianceMode compMode, uint8
 }
 
 
+/*******************************************************************************/
+ReturnCode rfalNfcbPollerStartCollisionResolution( rfalComplianceMode compMode, uint8_t devLimit, rfalNfcbListenDevice *nfcbDevList, uint8_t *devCnt )
+{
+    return rfalNfcbPollerStartSlottedCollisionResolution( compMode, devLimit, RFAL_NFCB_SLOT_NUM_1, RFAL_NFCB_SLOT_NUM_16, nfcbDevList, devCnt, &gRfalNfcb.colPending );
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcbPollerGetCollisionResolutionStatus( void )
+{
+    return rfalNfcbPollerGetSlottedCollisionResolutionStatus();
+}
+
+
 /*******************************************************************************/
 ReturnCode rfalNfcbPollerSlottedCollisionResolution( rfalComplianceMode compMode, uint8_t devLimit, rfalNfcbSlots initSlots, rfalNfcbSlots endSlots, rfalNfcbListenDevice *nfcbDevList, uint8_t *devCnt, bool *colPending )
 {
-    ReturnCode    ret;
-        uint8_t slotsNum;
-        uint8_t       slotCode;
-        uint8_t       curDevCnt;
-        
-        
-        /* Check parameters. In ISO | Activity 1.0 mode the initial slots must be 1 as continuation of Technology Detection */
-        if( (nfcbDevList == NULL) || (devCnt == NULL)  || (colPending == NULL) || (initSlots > RFAL_NFCB_SLOT_NUM_16) || 
-            (endSlots > RFAL_NFCB_SLOT_NUM_16) || ((compMode == RFAL_COMPLIANCE_MODE_ISO) && (initSlots != RFAL_NFCB_SLOT_NUM_1)) )
-        {
-            return ERR_PARAM;
-        }
-        
-        /* Initialise as no error in case Activity 1.0 where the previous SENSB_RES from technology detection should be used */
-        ret         = ERR_NONE;
-        *devCnt     = 0;
-        curDevCnt   = 0;
-        *colPending = false;
-           
-        
-        /* Send ALLB_REQ   Activity 1.1   9.3.5.2 and 9.3.5.3  (Symbol 1 and 2) */
-        if( compMode != RFAL_COMPLIANCE_MODE_ISO )
-        {
-           ret =  rfalNfcbPollerCheckPresence( RFAL_NFCB_SENS_CMD_ALLB_REQ, initSlots, &nfcbDevList->sensbRes, &nfcbDevList->sensbResLen );
-           if( (ret != ERR_NONE) && (initSlots == RFAL_NFCB_SLOT_NUM_1) )
-           {
-               return ret;
-           }
-        }
+    ReturnCode ret;
+    
+    EXIT_ON_ERR( ret, rfalNfcbPollerStartSlottedCollisionResolution( compMode, devLimit, initSlots, endSlots, nfcbDevList, devCnt, colPending ) );
+    rfalNfcbRunBlocking( ret, rfalNfcbPollerGetSlottedCollisionResolutionStatus() );
+    
+    return ret;
+}
 
+
+/*******************************************************************************/
+ReturnCode rfalNfcbPollerStartSlottedCollisionResolution( rfalComplianceMode compMode, uint8_t devLimit, rfalNfcbSlots initSlots, rfalNfcbSlots endSlots, rfalNfcbListenDevice *nfcbDevList, uint8_t *devCnt, bool *colPending )
+{
+    ReturnCode ret;
+    
+    /* Check parameters. In ISO | Activity 1.0 mode the initial slots must be 1 as continuation of Technology Detection */
+    if( (nfcbDevList == NULL) || (devCnt == NULL)  || (colPending == NULL) || (initSlots > RFAL_NFCB_SLOT_NUM_16) || 
+        (endSlots > RFAL_NFCB_SLOT_NUM_16) || ((compMode == RFAL_COMPLIANCE_MODE_ISO) && (initSlots != RFAL_NFCB_SLOT_NUM_1)) )
+    {
+        return ERR_PARAM;
+    }
+    
+    /* Initialise as no error in case Activity 1.0 where the previous SENSB_RES from technology detection should be used */
+    *devCnt     = 0;
+    *colPending = false;
+    
+    gRfalNfcb.colRes.compMode    = compMode;
+    gRfalNfcb.colRes.devLimit    = devLimit;
+    gRfalNfcb.colRes.initSlots   = initSlots;
+    gRfalNfcb.colRes.endSlots    = endSlots;
+    gRfalNfcb.colRes.nfcbDevList = nfcbDevList;
+    gRfalNfcb.colRes.devCnt      = devCnt;
+    gRfalNfcb.colRes.colPending  = colPending;
+    gRfalNfcb.colRes.slotsNum    = (uint8_t)initSlots;
+    gRfalNfcb.colRes.curDevCnt   = 0;
+    gRfalNfcb.colRes.emptyCnt    = 0;
+    gRfalNfcb.colRes.collCnt     = 0;
+    gRfalNfcb.colRes.isAdaptive  = false;
+    gRfalNfcb.colRes.slotRet     = ERR_NONE;
+    gRfalNfcb.colRes.state       = RFAL_NFCB_CR_LOOP;
+    
+    /* Send ALLB_REQ   Activity 1.1   9.3.5.2 and 9.3.5.3  (Symbol 1 and 2) */
+    if( compMode != RFAL_COMPLIANCE_MODE_ISO )
+    {
+        EXIT_ON_ERR( ret, rfalNfcbPollerStartCheckPresence( RFAL_NFCB_SENS_CMD_ALLB_REQ, initSlots, &nfcbDevList->sensbRes, &nfcbDevList->sensbResLen ) );
+        gRfalNfcb.colRes.state = RFAL_NFCB_CR_ALLB;
+    }
+    
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcbPollerAdaptiveCollisionResolution( rfalComplianceMode compMode, uint8_t devLimit, rfalNfcbListenDevice *nfcbDevList, uint8_t *devCnt, bool *colPending )
+{
+    ReturnCode ret;
+    
+    EXIT_ON_ERR( ret, rfalNfcbPollerStartAdaptiveCollisionResolution( compMode, devLimit, nfcbDevList, devCnt, colPending ) );
+    rfalNfcbRunBlocking( ret, rfalNfcbPollerGetAdaptiveCollisionResolutionStatus() );
+    
+    return ret;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcbPollerStartAdaptiveCollisionResolution( rfalComplianceMode compMode, uint8_t devLimit, rfalNfcbListenDevice *nfcbDevList, uint8_t *devCnt, bool *colPending )
+{
+    ReturnCode ret;
+    
+    /* Start with a single slot, the first round is the continuation of Technology Detection */
+    EXIT_ON_ERR( ret, rfalNfcbPollerStartSlottedCollisionResolution( compMode, devLimit, RFAL_NFCB_SLOT_NUM_1, RFAL_NFCB_SLOT_NUM_16, nfcbDevList, devCnt, colPending ) );
+    
+    gRfalNfcb.colRes.isAdaptive = true;
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcbPollerGetAdaptiveCollisionResolutionStatus( void )
+{
+    return rfalNfcbPollerGetSlottedCollisionResolutionStatus();
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcbPollerGetSlottedCollisionResolutionStatus( void )
+{
+    ReturnCode            ret;
+    rfalNfcbColResParams  *cr;
+    rfalNfcbListenDevice  *curDev;
+    
+    cr = &gRfalNfcb.colRes;
+    
+    do
+    {
+        curDev = &cr->nfcbDevList[*cr->devCnt];
         
-        /* Check if there was a transmission error on WUPB  EMVCo 2.6  9.3.3.1 */
-        if( (compMode == RFAL_COMPLIANCE_MODE_EMV) && (nfcbDevList->sensbResLen == 0U) )
-        {
-            return ERR_FRAMING;
-        }
-        
-        for( slotsNum = (uint8_t)initSlots; slotsNum <= (uint8_t)endSlots; slotsNum++ )
+        switch( cr->state )
         {
-            do {
+            /*******************************************************************************/
+            case RFAL_NFCB_CR_ALLB:
+                
+                ret = rfalNfcbPollerGetCheckPresenceStatus();
+                if( ret == ERR_BUSY )
+                {
+                    return ret;
+                }
+                
+                if( (ret != ERR_NONE) && (cr->initSlots == RFAL_NFCB_SLOT_NUM_1) )
+                {
+                    cr->state = RFAL_NFCB_CR_IDLE;
+                    return ret;
+                }
+                
+                /* Check if there was a transmission error on WUPB  EMVCo 2.6  9.3.3.1 */
+                if( (cr->compMode == RFAL_COMPLIANCE_MODE_EMV) && (cr->nfcbDevList->sensbResLen == 0U) )
+                {
+                    cr->state = RFAL_NFCB_CR_IDLE;
+                    return ERR_FRAMING;
+                }
+                
+                cr->slotRet = ret;
+                cr->state   = RFAL_NFCB_CR_LOOP;
+                break;
+                
+            /*******************************************************************************/
+            case RFAL_NFCB_CR_LOOP:
+                
+                cr->state = RFAL_NFCB_CR_SENSB_TX;
+                
                 /* Activity 1.1  9.3.5.23  -  Symbol 22 */
-                if( (compMode == RFAL_COMPLIANCE_MODE_NFC) && (curDevCnt != 0U) )
+                if( (cr->compMode == RFAL_COMPLIANCE_MODE_NFC) && (cr->curDevCnt != 0U) )
                 {
-                    rfalNfcbPollerSleep( nfcbDevList[(*devCnt-1U)].sensbRes.nfcid0 );
-                    nfcbDevList[(*devCnt-1U)].isSleep = true;
+                    if( rfalNfcbPollerStartSleep( cr->nfcbDevList[(*cr->devCnt-1U)].sensbRes.nfcid0 ) == ERR_NONE )
+                    {
+                        cr->state = RFAL_NFCB_CR_LOOP_SLEEP;
+                    }
+                    cr->nfcbDevList[(*cr->devCnt-1U)].isSleep = true;
                 }
+                break;
+                
+            /*******************************************************************************/
+            case RFAL_NFCB_CR_LOOP_SLEEP:
+                
+                if( rfalNfcbPollerGetSleepStatus() == ERR_BUSY )
+                {
+                    return ERR_BUSY;
+                }
+                
+                cr->state = RFAL_NFCB_CR_SENSB_TX;
+                break;
+                
+            /*******************************************************************************/
+            case RFAL_NFCB_CR_SENSB_TX:
+                
+                cr->state = RFAL_NFCB_CR_SLOT;
                 
                 /* Send SENSB_REQ with number of slots if not the first Activity 1.1  9.3.5.24  -  Symbol 23 */
-                if( (slotsNum != (uint8_t)initSlots) || *colPending )
+                if( (cr->slotsNum != (uint8_t)cr->initSlots) || *cr->colPending )
                 {
                     /* PRQA S 4342 1 # MISRA 10.5 - Layout of rfalNfcbSlots and above loop guarantee that no invalid enum values are created. */
-                    ret = rfalNfcbPollerCheckPresence( RFAL_NFCB_SENS_CMD_SENSB_REQ, (rfalNfcbSlots)slotsNum, &nfcbDevList[*devCnt].sensbRes, &nfcbDevList[*devCnt].sensbResLen );
+                    cr->slotRet = rfalNfcbPollerStartCheckPresence( RFAL_NFCB_SENS_CMD_SENSB_REQ, (rfalNfcbSlots)cr->slotsNum, &curDev->sensbRes, &curDev->sensbResLen );
+                    if( cr->slotRet == ERR_NONE )
+                    {
+                        cr->state = RFAL_NFCB_CR_SENSB;
+                    }
                 }
                 
                 /* Activity 1.1  9.3.5.6  -  Symbol 5 */
-                slotCode    = 0;
-                curDevCnt   = 0;
-                *colPending = false;
-
-                do{
-                    /* Activity 1.1  9.3.5.26  -  Symbol 25 */
-                    if( slotCode != 0U )
+                cr->slotCode    = 0;
+                cr->curDevCnt   = 0;
+                cr->emptyCnt    = 0;
+                cr->collCnt     = 0;
+                *cr->colPending = false;
+                break;
+                
+            /*******************************************************************************/
+            case RFAL_NFCB_CR_SENSB:
+                
+                ret = rfalNfcbPollerGetCheckPresenceStatus();
+                if( ret == ERR_BUSY )
+                {
+                    return ret;
+                }
+                
+                cr->slotRet = ret;
+                cr->state   = RFAL_NFCB_CR_SLOT;
+                break;
+                
+            /*******************************************************************************/
+            case RFAL_NFCB_CR_SLOTMARKER:
+                
+                ret = rfalNfcbPollerGetSlotMarkerStatus();
+                if( ret == ERR_BUSY )
+                {
+                    return ret;
+                }
+                
+                cr->slotRet = ret;
+                cr->state   = RFAL_NFCB_CR_SLOT;
+                break;
+                
+            /*******************************************************************************/
+            case RFAL_NFCB_CR_SLOT:
+                
+                cr->state = RFAL_NFCB_CR_SLOT_NEXT;
+                
+                /* Activity 1.1  9.3.5.7 and 9.3.5.8  -  Symbol 6 */
+                if( cr->slotRet == ERR_TIMEOUT )
+                {
+                    cr->emptyCnt++;
+                    break;
+                }
+                
+                /* Activity 1.1  9.3.5.8  -  Symbol 7 */
+                if( (rfalNfcbCheckSensbRes( &curDev->sensbRes, curDev->sensbResLen) == ERR_NONE) && (cr->slotRet == ERR_NONE) )
+                {
+                    curDev->isSleep = false;
+                    (void)rfalGetTransceiveRSSI( &curDev->rssi );            /* SENSB_RES of this slot was the last reception */
+                    
+                    if( cr->compMode == RFAL_COMPLIANCE_MODE_EMV )
                     {
-                        ret = rfalNfcbPollerSlotMarker( slotCode, &nfcbDevList[*devCnt].sensbRes, &nfcbDevList[*devCnt].sensbResLen );
+                        (*cr->devCnt)++;
+                        cr->state = RFAL_NFCB_CR_IDLE;
+                        return cr->slotRet;
                     }
-                    
-                    /* Activity 1.1  9.3.5.7 and 9.3.5.8  -  Symbol 6 */
-                    if( ret != ERR_TIMEOUT )
+                    else if( cr->compMode == RFAL_COMPLIANCE_MODE_ISO )
                     {
-                        /* Activity 1.1  9.3.5.8  -  Symbol 7 */
-                        if( (rfalNfcbCheckSensbRes( &nfcbDevList[*devCnt].sensbRes, nfcbDevList[*devCnt].sensbResLen) == ERR_NONE) && (ret == ERR_NONE) )
+                        /* Activity 1.0  9.3.5.8  -  Symbol 7 */
+                        (*cr->devCnt)++;
+                        cr->curDevCnt++;
+                        
+                        /* Activity 1.0  9.3.5.10  -  Symbol 9 */
+                        if( (*cr->devCnt >= cr->devLimit) || (cr->slotsNum == (uint8_t)RFAL_NFCB_SLOT_NUM_1) )
                         {
-                            nfcbDevList[*devCnt].isSleep = false;
-                            
-                            if( compMode == RFAL_COMPLIANCE_MODE_EMV )
-                            {
-                                (*devCnt)++;
-                                return ret;
-                            }
-                            else if( compMode == RFAL_COMPLIANCE_MODE_ISO )
-                            {
-                                /* Activity 1.0  9.3.5.8  -  Symbol 7 */
-                                (*devCnt)++;
-                                curDevCnt++;
-                                
-                                /* Activity 1.0  9.3.5.10  -  Symbol 9 */
-                                if( (*devCnt >= devLimit) || (slotsNum == (uint8_t)RFAL_NFCB_SLOT_NUM_1) )
-                                {
-                                    return ret;
-                                }
-
-                                /* Activity 1.0  9.3.5.11  -  Symbol 10 */
-                                rfalNfcbPollerSleep( nfcbDevList[*devCnt-1U].sensbRes.nfcid0 );
-                                nfcbDevList[*devCnt-1U].isSleep =  true;
-                            }
-                            else if( compMode == RFAL_COMPLIANCE_MODE_NFC )
-                            {
-                                /* Activity 1.1  9.3.5.10 and 9.3.5.11  -  Symbol 9 and Symbol 11*/
-                                if(curDevCnt != 0U)
-                                {
-                                    rfalNfcbPollerSleep( nfcbDevList[*devCnt-1U].sensbRes.nfcid0 );
-                                    nfcbDevList[*devCnt-1U].isSleep = true;
-                                }
-                                
-                                /* Activity 1.1  9.3.5.12  -  Symbol 11 */
-                                (*devCnt)++;
-                                curDevCnt++;
-                                
-                                /* Activity 1.1  9.3.5.6  -  Symbol 13 */
-                                if( (*devCnt >= devLimit) || (slotsNum == (uint8_t)RFAL_NFCB_SLOT_NUM_1) )
-                                {
-                                    return ret;
-                                }
-                            }
-                            else
-                            {
-                                /* MISRA 15.7 - Empty else */
-                            }
+                            cr->state = RFAL_NFCB_CR_IDLE;
+                            return cr->slotRet;
                         }
-                        else
+                        
+                        /* Activity 1.0  9.3.5.11  -  Symbol 10 */
+                        if( rfalNfcbPollerStartSleep( cr->nfcbDevList[*cr->devCnt-1U].sensbRes.nfcid0 ) == ERR_NONE )
                         {
-                            /* If deviceLimit is set to 0 the NFC Forum Device is configured to perform collision detection only  Activity 1.0 and 1.1  9.3.5.5  - Symbol 4 */
-                            if( (devLimit == 0U) && (slotsNum == (uint8_t)RFAL_NFCB_SLOT_NUM_1) )
+                            cr->state = RFAL_NFCB_CR_SLOT_SLEEP;
+                        }
+                        cr->nfcbDevList[*cr->devCnt-1U].isSleep = true;
+                    }
+                    else if( cr->compMode == RFAL_COMPLIANCE_MODE_NFC )
+                    {
+                        /* Activity 1.1  9.3.5.10 and 9.3.5.11  -  Symbol 9 and Symbol 11*/
+                        if( cr->curDevCnt != 0U )
+                        {
+                            cr->nfcbDevList[*cr->devCnt-1U].isSleep = true;
+                            if( rfalNfcbPollerStartSleep( cr->nfcbDevList[*cr->devCnt-1U].sensbRes.nfcid0 ) == ERR_NONE )
                             {
-                                return ERR_RF_COLLISION;
+                                cr->state = RFAL_NFCB_CR_SLOT_SLEEP;
+                                break;
                             }
-                            
-                            /* Activity 1.1  9.3.5.9  -  Symbol 8 */
-                            *colPending = true;
+                        }
+                        
+                        /* Activity 1.1  9.3.5.12  -  Symbol 11 */
+                        (*cr->devCnt)++;
+                        cr->curDevCnt++;
+                        
+                        /* Activity 1.1  9.3.5.6  -  Symbol 13 */
+                        if( (*cr->devCnt >= cr->devLimit) || (cr->slotsNum == (uint8_t)RFAL_NFCB_SLOT_NUM_1) )
+                        {
+                            cr->state = RFAL_NFCB_CR_IDLE;
+                            return cr->slotRet;
                         }
                     }
+                    else
+                    {
+                        /* MISRA 15.7 - Empty else */
+                    }
+                }
+                else
+                {
+                    /* If deviceLimit is set to 0 the NFC Forum Device is configured to perform collision detection only  Activity 1.0 and 1.1  9.3.5.5  - Symbol 4 */
+                    if( (cr->devLimit == 0U) && (cr->slotsNum == (uint8_t)RFAL_NFCB_SLOT_NUM_1) )
+                    {
+                        cr->state = RFAL_NFCB_CR_IDLE;
+                        return ERR_RF_COLLISION;
+                    }
                     
-                    /* Activity 1.1  9.3.5.15  -  Symbol 14 */
-                    slotCode++;
+                    /* Activity 1.1  9.3.5.9  -  Symbol 8 */
+                    *cr->colPending = true;
+                    cr->collCnt++;
+                }
+                break;
+                
+            /*******************************************************************************/
+            case RFAL_NFCB_CR_SLOT_SLEEP:
+                
+                if( rfalNfcbPollerGetSleepStatus() == ERR_BUSY )
+                {
+                    return ERR_BUSY;
+                }
+                
+                cr->state = RFAL_NFCB_CR_SLOT_NEXT;
+                
+                if( cr->compMode == RFAL_COMPLIANCE_MODE_NFC )
+                {
+                    /* Activity 1.1  9.3.5.12  -  Symbol 11 */
+                    (*cr->devCnt)++;
+                    cr->curDevCnt++;
+                    
+                    /* Activity 1.1  9.3.5.6  -  Symbol 13 */
+                    if( (*cr->devCnt >= cr->devLimit) || (cr->slotsNum == (uint8_t)RFAL_NFCB_SLOT_NUM_1) )
+                    {
+                        cr->state = RFAL_NFCB_CR_IDLE;
+                        return cr->slotRet;
+                    }
+                }
+                break;
+                
+            /*******************************************************************************/
+            case RFAL_NFCB_CR_SLOT_NEXT:
+                
+                /* Activity 1.1  9.3.5.15  -  Symbol 14 */
+                cr->slotCode++;
+                if( cr->slotCode < rfalNfcbNI2NumberOfSlots(cr->slotsNum) )
+                {
+                    /* Activity 1.1  9.3.5.26  -  Symbol 25 */
+                    cr->slotRet = rfalNfcbPollerStartSlotMarker( cr->slotCode, &curDev->sensbRes, &curDev->sensbResLen );
+                    cr->state   = ((cr->slotRet == ERR_NONE) ? RFAL_NFCB_CR_SLOTMARKER : RFAL_NFCB_CR_SLOT);
+                    break;
                 }
-                while( slotCode < rfalNfcbNI2NumberOfSlots(slotsNum) );
                 
                 /* Activity 1.1  9.3.5.17  -  Symbol 16 */
-                if( !(*colPending) )
+                if( !(*cr->colPending) )
                 {
+                    cr->state = RFAL_NFCB_CR_IDLE;
                     return ERR_NONE;
                 }
-            
-            /* Activity 1.1  9.3.5.18  -  Symbol 17 */
-            } while (curDevCnt != 0U);     /* If a collision is detected and card(s) were found on this loop keep the same number of available slots */
+                
+                /* On adaptive mode the number of slots follows the population estimated on this round */
+                if( cr->isAdaptive )
+                {
+                    cr->slotsNum = rfalNfcbPollerAdaptiveSlotsNum( cr );
+                    if( cr->slotsNum > (uint8_t)cr->endSlots )
+                    {
+                        cr->state = RFAL_NFCB_CR_IDLE;
+                        return ERR_NONE;
+                    }
+                }
+                /* Activity 1.1  9.3.5.18  -  Symbol 17 */
+                /* If a collision is detected and card(s) were found on this round keep the same number of available slots */
+                else if( cr->curDevCnt == 0U )
+                {
+                    cr->slotsNum++;
+                    if( cr->slotsNum > (uint8_t)cr->endSlots )
+                    {
+                        cr->state = RFAL_NFCB_CR_IDLE;
+                        return ERR_NONE;
+                    }
+                }
+                
+                cr->state = RFAL_NFCB_CR_LOOP;
+                break;
+                
+            /*******************************************************************************/
+            default:
+                return ERR_WRONG_STATE;
         }
-        
-        return ERR_NONE;
+    }
+    while( cr->state != RFAL_NFCB_CR_IDLE );
+    
+    return ERR_NONE;
 }
 
 
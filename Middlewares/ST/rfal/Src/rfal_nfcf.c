@@ -82,6 +82,9 @@
 */
 #define RFAL_NFCF_MRT_CHECK_UPDATE   ((4096 * (8 + (15 * 8)) * 64 ) + 16)
 
+#define RFAL_NFCF_INV_MAX_ROUNDS       12U       /*!< Max SENSF_REQ rounds per System Code on Inventory                 */
+#define RFAL_NFCF_INV_Q16_ONE          65536UL  /*!< 1.0 in Q16 fixed point used by the Inventory completeness estimate */
+
 /*
  ******************************************************************************
  * GLOBAL MACROS
@@ -89,6 +92,9 @@
  */
 #define rfalNfcfSlots2CardNum( s )                 ((uint8_t)(s)+1U) /*!< Converts Time Slot Number (TSN) into num of slots  */
 
+/*! Runs the given status method (fn) until it is no longer busy, running the RFAL worker in between */
+#define rfalNfcfRunBlocking( e, fn )               do{ (e)=(fn); rfalWorker(); }while( (e) == ERR_BUSY )
+
 /*
 ******************************************************************************
 * GLOBAL TYPES
@@ -110,6 +116,51 @@ typedef struct{
 } rfalNfcfGreedyF;
 
 
+/*! Collision Resolution states                                                                   */
+typedef enum
+{
+    RFAL_NFCF_CR_IDLE,                                    /*!< IDLE state                          */
+    RFAL_NFCF_CR_POLL,                                    /*!< SENSF_REQ with 16 slots ongoing     */
+    RFAL_NFCF_CR_POLL_SC                                  /*!< SENSF_REQ requesting SC ongoing     */
+} rfalNfcfColResState;
+
+
+/*! Collision Resolution context                                                                   */
+typedef struct{
+    rfalNfcfColResState  state;                           /*!< Collision Resolution state          */
+    rfalComplianceMode   compMode;                        /*!< Compliance mode given by the caller */
+    uint8_t              devLimit;                        /*!< Device limit given by the caller    */
+    rfalNfcfListenDevice *nfcfDevList;                    /*!< Caller's device list                */
+    uint8_t              *devCnt;                         /*!< Caller's device counter             */
+    bool                 nfcDepFound;                     /*!< NFC-DEP device found flag           */
+} rfalNfcfColResParams;
+
+
+/*! Inventory states                                                                               */
+typedef enum
+{
+    RFAL_NFCF_INV_IDLE,                                   /*!< IDLE state                          */
+    RFAL_NFCF_INV_POLL                                    /*!< SENSF_REQ round ongoing             */
+} rfalNfcfInvState;
+
+
+/*! Inventory context                                                                              */
+typedef struct{
+    rfalNfcfInvState     state;                           /*!< Inventory state                     */
+    const uint16_t       *sysCodes;                       /*!< Caller's System Code list           */
+    uint8_t              sysCodesCnt;                     /*!< Number of System Codes              */
+    uint8_t              sysCodeIdx;                      /*!< System Code being polled            */
+    uint8_t              confidence;                      /*!< Completeness confidence in %        */
+    uint8_t              round;                           /*!< Rounds done on current System Code  */
+    rfalFeliCaPollSlots  slots;                           /*!< TSN of the ongoing round            */
+    uint32_t             missProb;                        /*!< P(unseen device stays unseen) Q16   */
+    uint8_t              devLimit;                        /*!< Device limit given by the caller    */
+    rfalNfcfListenDevice *nfcfDevList;                    /*!< Caller's device list                */
+    uint8_t              *devCnt;                         /*!< Caller's device counter             */
+    bool                 nfcDepFound;                     /*!< NFC-DEP device found flag           */
+} rfalNfcfInvParams;
+
+
 /*! NFC-F SENSF_REQ format  Digital 1.1  8.6.1                     */
 typedef struct
 {
@@ -125,7 +176,9 @@ typedef struct
 * LOCAL VARIABLES
 ******************************************************************************
 */
-static rfalNfcfGreedyF gRfalNfcfGreedyF;   /*!< Activity's NFCF Greedy collection */
+static rfalNfcfGreedyF      gRfalNfcfGreedyF;   /*!< Activity's NFCF Greedy collection */
+static rfalNfcfColResParams gRfalNfcfColRes;    /*!< NFCF Collision Resolution context */
+static rfalNfcfInvParams    gRfalNfcfInv;       /*!< NFCF Inventory context            */
 
 
 /*
@@ -134,6 +187,9 @@ static rfalNfcfGreedyF gRfalNfcfGreedyF;   /*!< Activity's NFCF Greedy collectio
 ******************************************************************************
 */
 static void rfalNfcfComputeValidSENF( rfalNfcfListenDevice *outDevInfo, uint8_t *curDevIdx, uint8_t devLimit, bool overwrite, bool *nfcDepFound );
+static ReturnCode rfalNfcfPollerInventoryStartRound( void );
+static uint32_t rfalNfcfPollerInventoryHitProb( rfalFeliCaPollSlots slots, uint8_t responders );
+static rfalFeliCaPollSlots rfalNfcfPollerInventoryNextSlots( rfalFeliCaPollSlots slots, uint8_t responders, bool progress );
 
 
 /*
@@ -201,6 +257,7 @@ static void rfalNfcfComputeValidSENF( rfalNfcfListenDevice *outDevInfo, uint8_t
             /* overwrite deviceInfo/GRE_SENSF_RES with SENSF_RES */
             outDevInfo[tmpIdx].sensfResLen = (sensfBuf->LEN - RFAL_NFCF_LENGTH_LEN);
             ST_MEMCPY( &outDevInfo[tmpIdx].sensfRes, &sensfBuf->SENSF_RES, outDevInfo[tmpIdx].sensfResLen );
+            (void)rfalGetFeliCaPollRSSI( gRfalNfcfGreedyF.pollFound, &outDevInfo[tmpIdx].rssi );
             continue;
         }
         else
@@ -208,6 +265,8 @@ static void rfalNfcfComputeValidSENF( rfalNfcfListenDevice *outDevInfo, uint8_t
             /* fill deviceInfo/GRE_SENSF_RES with new SENSF_RES */
             outDevInfo[(*curDevIdx)].sensfResLen = (sensfBuf->LEN - RFAL_NFCF_LENGTH_LEN);
             ST_MEMCPY( &outDevInfo[(*curDevIdx)].sensfRes, &sensfBuf->SENSF_RES, outDevInfo[(*curDevIdx)].sensfResLen );            
+            outDevInfo[(*curDevIdx)].rssi = 0U;
+            (void)rfalGetFeliCaPollRSSI( gRfalNfcfGreedyF.pollFound, &outDevInfo[(*curDevIdx)].rssi );
         }
         
         /* Check if this device supports NFC-DEP and signal it (ACTIVITY 1.1   9.3.6.63) */        
@@ -217,6 +276,71 @@ static void rfalNfcfComputeValidSENF( rfalNfcfListenDevice *outDevInfo, uint8_t
     }
 }
 
+/*******************************************************************************/
+static ReturnCode rfalNfcfPollerInventoryStartRound( void )
+{
+    ReturnCode ret;
+    uint16_t   sysCode;
+    
+    sysCode = ( (gRfalNfcfInv.sysCodesCnt == 0U) ? RFAL_NFCF_SYSTEMCODE : gRfalNfcfInv.sysCodes[gRfalNfcfInv.sysCodeIdx] );
+    
+    gRfalNfcfGreedyF.pollFound     = 0;
+    gRfalNfcfGreedyF.pollCollision = 0;
+    
+    ret = rfalStartFeliCaPoll( gRfalNfcfInv.slots, sysCode, RFAL_FELICA_POLL_RC_NO_REQUEST, gRfalNfcfGreedyF.POLL_F, rfalNfcfSlots2CardNum(gRfalNfcfInv.slots), &gRfalNfcfGreedyF.pollFound, &gRfalNfcfGreedyF.pollCollision );
+    
+    /* Only a round actually started is to be awaited */
+    gRfalNfcfInv.state = ((ret == ERR_NONE) ? RFAL_NFCF_INV_POLL : RFAL_NFCF_INV_IDLE);
+    return ret;
+}
+
+
+/*******************************************************************************/
+static uint32_t rfalNfcfPollerInventoryHitProb( rfalFeliCaPollSlots slots, uint8_t responders )
+{
+    uint32_t prob;
+    uint32_t nSlots;
+    uint8_t  i;
+    
+    /*******************************************************************************/
+    /* A device that has not been seen yet picks one of the N slots at random      */
+    /* (JIS X6319-4 9.2.1) and is only read if none of the other responders of the */
+    /* round picked the same slot: P(hit) = ((N-1)/N)^responders                   */
+    /*******************************************************************************/
+    nSlots = (uint32_t)rfalNfcfSlots2CardNum( slots );
+    prob   = RFAL_NFCF_INV_Q16_ONE;
+    
+    for( i = 0; i < responders; i++ )
+    {
+        prob = ((prob * (nSlots - 1U)) / nSlots);
+    }
+    
+    return prob;
+}
+
+
+/*******************************************************************************/
+static rfalFeliCaPollSlots rfalNfcfPollerInventoryNextSlots( rfalFeliCaPollSlots slots, uint8_t responders, bool progress )
+{
+    uint8_t nSlots;
+    
+    /* Aim for twice as many slots as devices responding on the previous round */
+    nSlots = rfalNfcfSlots2CardNum( RFAL_FELICA_4_SLOTS );
+    while( (nSlots < ((uint16_t)responders << 1U)) && (nSlots < RFAL_NFCF_POLL_MAXCARDS) )
+    {
+        nSlots <<= 1U;
+    }
+    
+    /* Escalate whenever a round still collides without revealing any new device */
+    if( !progress && (nSlots <= rfalNfcfSlots2CardNum( slots )) && (rfalNfcfSlots2CardNum( slots ) < RFAL_NFCF_POLL_MAXCARDS) )
+    {
+        nSlots = (rfalNfcfSlots2CardNum( slots ) << 1U);
+    }
+    
+    return (rfalFeliCaPollSlots)(nSlots - 1U);
+}
+
+
 /*
 ******************************************************************************
 * GLOBAL FUNCTIONS
@@ -253,6 +377,18 @@ ReturnCode rfalNfcfPollerPoll( rfalFeliCaPollSlots slots, uint16_t sysCode, uint
 
 /*******************************************************************************/
 ReturnCode rfalNfcfPollerCheckPresence( void )
+{
+    ReturnCode ret;
+    
+    EXIT_ON_ERR( ret, rfalNfcfPollerStartCheckPresence() );
+    rfalNfcfRunBlocking( ret, rfalNfcfPollerGetCheckPresenceStatus() );
+    
+    return ret;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcfPollerStartCheckPresence( void )
 {
     gRfalNfcfGreedyF.pollFound     = 0;
     gRfalNfcfGreedyF.pollCollision = 0;
@@ -260,23 +396,45 @@ ReturnCode rfalNfcfPollerCheckPresence( void )
     /* ACTIVITY 1.0 & 1.1 - 9.2.3.17 SENSF_REQ  must be with number of slots equal to 4
      *                                SC must be 0xFFFF
      *                                RC must be 0x00 (No system code info required) */
-    return rfalFeliCaPoll( RFAL_FELICA_4_SLOTS, RFAL_NFCF_SYSTEMCODE, RFAL_FELICA_POLL_RC_NO_REQUEST, gRfalNfcfGreedyF.POLL_F, rfalNfcfSlots2CardNum(RFAL_FELICA_4_SLOTS), &gRfalNfcfGreedyF.pollFound, &gRfalNfcfGreedyF.pollCollision );
+    return rfalStartFeliCaPoll( RFAL_FELICA_4_SLOTS, RFAL_NFCF_SYSTEMCODE, RFAL_FELICA_POLL_RC_NO_REQUEST, gRfalNfcfGreedyF.POLL_F, rfalNfcfSlots2CardNum(RFAL_FELICA_4_SLOTS), &gRfalNfcfGreedyF.pollFound, &gRfalNfcfGreedyF.pollCollision );
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcfPollerGetCheckPresenceStatus( void )
+{
+    return rfalGetFeliCaPollStatus();
 }
 
 
 /*******************************************************************************/
 ReturnCode rfalNfcfPollerCollisionResolution( rfalComplianceMode compMode, uint8_t devLimit, rfalNfcfListenDevice *nfcfDevList, uint8_t *devCnt )
 {
-    ReturnCode  ret;
-    bool        nfcDepFound;
+    ReturnCode ret;
+    
+    EXIT_ON_ERR( ret, rfalNfcfPollerStartCollisionResolution( compMode, devLimit, nfcfDevList, devCnt ) );
+    rfalNfcfRunBlocking( ret, rfalNfcfPollerGetCollisionResolutionStatus() );
     
+    return ret;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcfPollerStartCollisionResolution( rfalComplianceMode compMode, uint8_t devLimit, rfalNfcfListenDevice *nfcfDevList, uint8_t *devCnt )
+{
     if( (nfcfDevList == NULL) || (devCnt == NULL) )
     {
         return ERR_PARAM;
     }
             
-    *devCnt      = 0;
-    nfcDepFound  = false;
+    *devCnt = 0;
+    
+    gRfalNfcfColRes.compMode    = compMode;
+    gRfalNfcfColRes.devLimit    = devLimit;
+    gRfalNfcfColRes.nfcfDevList = nfcfDevList;
+    gRfalNfcfColRes.devCnt      = devCnt;
+    gRfalNfcfColRes.nfcDepFound = false;
+    gRfalNfcfColRes.state       = RFAL_NFCF_CR_IDLE;
     
     
     /*******************************************************************************************/
@@ -287,7 +445,7 @@ ReturnCode rfalNfcfPollerCollisionResolution( rfalComplianceMode compMode, uint8
     /* CON_DEVICES_LIMIT = 0 Just check if devices from Tech Detection exceeds -> always true  */
     /* Allow the number of slots open on Technology Detection                                  */
     /*******************************************************************************************/
-    rfalNfcfComputeValidSENF( nfcfDevList, devCnt, ((devLimit == 0U) ? rfalNfcfSlots2CardNum( RFAL_FELICA_4_SLOTS ) : devLimit), false, &nfcDepFound );
+    rfalNfcfComputeValidSENF( nfcfDevList, devCnt, ((devLimit == 0U) ? rfalNfcfSlots2CardNum( RFAL_FELICA_4_SLOTS ) : devLimit), false, &gRfalNfcfColRes.nfcDepFound );
 
     
     /*******************************************************************************/
@@ -303,28 +461,209 @@ ReturnCode rfalNfcfPollerCollisionResolution( rfalComplianceMode compMode, uint8
          * Phones detected: Samsung Galaxy Nexus,Samsung Galaxy S3,Samsung Nexus S */
         *devCnt = 0;
         
-        ret = rfalNfcfPollerPoll( RFAL_FELICA_16_SLOTS, RFAL_NFCF_SYSTEMCODE, RFAL_FELICA_POLL_RC_NO_REQUEST, gRfalNfcfGreedyF.POLL_F, &gRfalNfcfGreedyF.pollFound, &gRfalNfcfGreedyF.pollCollision );
-        if( ret == ERR_NONE )
+        if( rfalStartFeliCaPoll( RFAL_FELICA_16_SLOTS, RFAL_NFCF_SYSTEMCODE, RFAL_FELICA_POLL_RC_NO_REQUEST, gRfalNfcfGreedyF.POLL_F, rfalNfcfSlots2CardNum(RFAL_FELICA_16_SLOTS), &gRfalNfcfGreedyF.pollFound, &gRfalNfcfGreedyF.pollCollision ) == ERR_NONE )
         {
-            rfalNfcfComputeValidSENF( nfcfDevList, devCnt, devLimit, false, &nfcDepFound );
+            gRfalNfcfColRes.state = RFAL_NFCF_CR_POLL;
         }
-      
-      /*******************************************************************************/
-      /* ACTIVITY 1.1 -  9.3.6.63 Check if any device supports NFC DEP               */
-      /*******************************************************************************/
-      if( nfcDepFound && (compMode == RFAL_COMPLIANCE_MODE_NFC) )
-      {
-          ret = rfalNfcfPollerPoll( RFAL_FELICA_16_SLOTS, RFAL_NFCF_SYSTEMCODE, RFAL_FELICA_POLL_RC_SYSTEM_CODE, gRfalNfcfGreedyF.POLL_F, &gRfalNfcfGreedyF.pollFound, &gRfalNfcfGreedyF.pollCollision );
-          if( ret == ERR_NONE )
-          {
-              rfalNfcfComputeValidSENF( nfcfDevList, devCnt, devLimit, true, &nfcDepFound );
-          }
-      }
     }
     
     return ERR_NONE;
 }
 
+
+/*******************************************************************************/
+ReturnCode rfalNfcfPollerGetCollisionResolutionStatus( void )
+{
+    ReturnCode ret;
+    
+    switch( gRfalNfcfColRes.state )
+    {
+        /*******************************************************************************/
+        case RFAL_NFCF_CR_POLL:
+            
+            ret = rfalGetFeliCaPollStatus();
+            if( ret == ERR_BUSY )
+            {
+                return ret;
+            }
+            
+            if( ret == ERR_NONE )
+            {
+                rfalNfcfComputeValidSENF( gRfalNfcfColRes.nfcfDevList, gRfalNfcfColRes.devCnt, gRfalNfcfColRes.devLimit, false, &gRfalNfcfColRes.nfcDepFound );
+            }
+            
+            gRfalNfcfColRes.state = RFAL_NFCF_CR_IDLE;
+            
+            /*******************************************************************************/
+            /* ACTIVITY 1.1 -  9.3.6.63 Check if any device supports NFC DEP               */
+            /*******************************************************************************/
+            if( gRfalNfcfColRes.nfcDepFound && (gRfalNfcfColRes.compMode == RFAL_COMPLIANCE_MODE_NFC) )
+            {
+                if( rfalStartFeliCaPoll( RFAL_FELICA_16_SLOTS, RFAL_NFCF_SYSTEMCODE, RFAL_FELICA_POLL_RC_SYSTEM_CODE, gRfalNfcfGreedyF.POLL_F, rfalNfcfSlots2CardNum(RFAL_FELICA_16_SLOTS), &gRfalNfcfGreedyF.pollFound, &gRfalNfcfGreedyF.pollCollision ) == ERR_NONE )
+                {
+                    gRfalNfcfColRes.state = RFAL_NFCF_CR_POLL_SC;
+                    return ERR_BUSY;
+                }
+            }
+            break;
+            
+        /*******************************************************************************/
+        case RFAL_NFCF_CR_POLL_SC:
+            
+            ret = rfalGetFeliCaPollStatus();
+            if( ret == ERR_BUSY )
+            {
+                return ret;
+            }
+            
+            if( ret == ERR_NONE )
+            {
+                rfalNfcfComputeValidSENF( gRfalNfcfColRes.nfcfDevList, gRfalNfcfColRes.devCnt, gRfalNfcfColRes.devLimit, true, &gRfalNfcfColRes.nfcDepFound );
+            }
+            
+            gRfalNfcfColRes.state = RFAL_NFCF_CR_IDLE;
+            break;
+            
+        /*******************************************************************************/
+        default:
+            /* No SENSF_REQ needed or Collision Resolution already concluded */
+            break;
+    }
+    
+    return ERR_NONE;
+}
+
+/*******************************************************************************/
+ReturnCode rfalNfcfPollerInventory( const uint16_t *sysCodes, uint8_t sysCodesCnt, uint8_t confidence, uint8_t devLimit, rfalNfcfListenDevice *nfcfDevList, uint8_t *devCnt )
+{
+    ReturnCode ret;
+    
+    EXIT_ON_ERR( ret, rfalNfcfPollerStartInventory( sysCodes, sysCodesCnt, confidence, devLimit, nfcfDevList, devCnt ) );
+    rfalNfcfRunBlocking( ret, rfalNfcfPollerGetInventoryStatus() );
+    
+    return ret;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcfPollerStartInventory( const uint16_t *sysCodes, uint8_t sysCodesCnt, uint8_t confidence, uint8_t devLimit, rfalNfcfListenDevice *nfcfDevList, uint8_t *devCnt )
+{
+    if( (nfcfDevList == NULL) || (devCnt == NULL) || (devLimit == 0U) || ((sysCodes == NULL) && (sysCodesCnt != 0U)) || (confidence > 100U) )
+    {
+        return ERR_PARAM;
+    }
+    
+    *devCnt = 0;
+    
+    gRfalNfcfInv.sysCodes    = sysCodes;
+    gRfalNfcfInv.sysCodesCnt = sysCodesCnt;
+    gRfalNfcfInv.sysCodeIdx  = 0;
+    gRfalNfcfInv.confidence  = confidence;
+    gRfalNfcfInv.round       = 0;
+    gRfalNfcfInv.slots       = RFAL_FELICA_4_SLOTS;
+    gRfalNfcfInv.missProb    = RFAL_NFCF_INV_Q16_ONE;
+    gRfalNfcfInv.devLimit    = devLimit;
+    gRfalNfcfInv.nfcfDevList = nfcfDevList;
+    gRfalNfcfInv.devCnt      = devCnt;
+    gRfalNfcfInv.nfcDepFound = false;
+    gRfalNfcfInv.state       = RFAL_NFCF_INV_IDLE;
+    
+    return rfalNfcfPollerInventoryStartRound();
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcfPollerGetInventoryStatus( void )
+{
+    ReturnCode ret;
+    uint8_t    prevCnt;
+    uint8_t    responders;
+    uint8_t    collisions;
+    bool       progress;
+    bool       hidden;
+    bool       done;
+    
+    if( gRfalNfcfInv.state != RFAL_NFCF_INV_POLL )
+    {
+        return ERR_NONE;
+    }
+    
+    ret = rfalGetFeliCaPollStatus();
+    if( ret == ERR_BUSY )
+    {
+        return ret;
+    }
+    
+    /* Any error other than timeout (e.g. field lost) stops the Inventory */
+    if( (ret != ERR_NONE) && (ret != ERR_TIMEOUT) )
+    {
+        gRfalNfcfInv.state = RFAL_NFCF_INV_IDLE;
+        return ret;
+    }
+    
+    /* A round without any response (timeout) is a valid, collision free round */
+    responders = 0;
+    collisions = 0;
+    prevCnt    = *gRfalNfcfInv.devCnt;
+    
+    if( ret == ERR_NONE )
+    {
+        responders = gRfalNfcfGreedyF.pollFound;
+        collisions = gRfalNfcfGreedyF.pollCollision;
+        
+        /* Append only NFCID2s not yet known from previous rounds / System Codes */
+        rfalNfcfComputeValidSENF( gRfalNfcfInv.nfcfDevList, gRfalNfcfInv.devCnt, gRfalNfcfInv.devLimit, false, &gRfalNfcfInv.nfcDepFound );
+    }
+    
+    gRfalNfcfInv.round++;
+    progress = (*gRfalNfcfInv.devCnt > prevCnt);
+    
+    /* Each collided slot hides at least two devices */
+    responders = (uint8_t)MIN( ((uint16_t)responders + ((uint16_t)collisions << 1U)), (uint16_t)UINT8_MAX );
+    
+    /*******************************************************************************/
+    /* Estimate the probability that a device is still missing: it must have lost  */
+    /* every round since the last new NFCID2 showed up. Once that falls below the   */
+    /* requested confidence the System Code is considered complete                  */
+    /*******************************************************************************/
+    if( progress )
+    {
+        gRfalNfcfInv.missProb = RFAL_NFCF_INV_Q16_ONE;
+    }
+    gRfalNfcfInv.missProb = ((gRfalNfcfInv.missProb * (RFAL_NFCF_INV_Q16_ONE - rfalNfcfPollerInventoryHitProb( gRfalNfcfInv.slots, responders ))) / RFAL_NFCF_INV_Q16_ONE);
+    
+    /* More responders than NFCID2s known is a proof that some device is still missing */
+    hidden = (responders > *gRfalNfcfInv.devCnt);
+    
+    done = ( (*gRfalNfcfInv.devCnt >= gRfalNfcfInv.devLimit)                                                                     ||   /* Device list full          */
+             (collisions == 0U)                                                                                                  ||   /* Every responder was read  */
+             (!hidden && ((gRfalNfcfInv.missProb * 100U) <= ((100U - (uint32_t)gRfalNfcfInv.confidence) * RFAL_NFCF_INV_Q16_ONE))) ||   /* Confidence reached        */
+             (gRfalNfcfInv.round >= RFAL_NFCF_INV_MAX_ROUNDS)                                                                         );   /* Max rounds                */
+    
+    if( !done )
+    {
+        gRfalNfcfInv.slots = rfalNfcfPollerInventoryNextSlots( gRfalNfcfInv.slots, responders, progress );
+        EXIT_ON_ERR( ret, rfalNfcfPollerInventoryStartRound() );
+        return ERR_BUSY;
+    }
+    
+    /* Move on to the next System Code, if any */
+    gRfalNfcfInv.sysCodeIdx++;
+    if( (*gRfalNfcfInv.devCnt < gRfalNfcfInv.devLimit) && (gRfalNfcfInv.sysCodeIdx < gRfalNfcfInv.sysCodesCnt) )
+    {
+        gRfalNfcfInv.round    = 0;
+        gRfalNfcfInv.slots    = RFAL_FELICA_4_SLOTS;
+        gRfalNfcfInv.missProb = RFAL_NFCF_INV_Q16_ONE;
+        
+        EXIT_ON_ERR( ret, rfalNfcfPollerInventoryStartRound() );
+        return ERR_BUSY;
+    }
+    
+    gRfalNfcfInv.state = RFAL_NFCF_INV_IDLE;
+    return ERR_NONE;
+}
+
+
 /*******************************************************************************/
 ReturnCode rfalNfcfPollerCheck( const uint8_t* nfcid2, const rfalNfcfServBlockListParam *servBlock, uint8_t *rxBuf, uint16_t rxBufLen, uint16_t *rcvdLen )
 {
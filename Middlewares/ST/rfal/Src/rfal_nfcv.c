@@ -74,6 +74,7 @@
 #define RFAL_NFCV_INV_REQ_HEADER_LEN      3U     /*!< INVENTORY_REQ header length (INV_FLAG, CMD, MASK_LEN)             */
 #define RFAL_NFCV_INV_RES_LEN             10U    /*!< INVENTORY_RES length                                              */
 #define RFAL_NFCV_WR_MUL_REQ_HEADER_LEN   4U     /*!< Write Multiple header length (INV_FLAG, CMD, [UID], BNo, Bno)     */
+#define RFAL_NFCV_EXT_WR_MUL_REQ_HEADER_LEN 6U   /*!< Extended Write Multiple header length (INV_FLAG, CMD, [UID], BNo(2), Bno(2)) */
 
 
 #define RFAL_CMD_LEN                      1U     /*!< Commandbyte length                                                */
@@ -83,9 +84,15 @@
 #define RFAL_NFCV_DSFI_LEN                1U     /*!< DSFID length                                                      */
 #define RFAL_NFCV_SLPREQ_REQ_FLAG         0x22U  /*!< SLPV_REQ request flags Digital 2.0 (Candidate) 9.7.1.1            */
 
-#define RFAL_NFCV_MAX_COLL_SUPPORTED      16U    /*!< Maximum number of collisions supported by the Anticollision loop  */
+#define RFAL_NFCV_COLRES_MAX_DEPTH        RFAL_NFCV_MASKVAL_MAX_1SLOT_LEN /*!< Max nodes pending on the Anticollision loop: mask grows at least 1 bit per node */
+#define RFAL_NFCV_COLRES_16SLOT_BITS      4U     /*!< Mask bits resolved by a 16 slots round (slot number)              */
+#define RFAL_NFCV_COLRES_BIN_CHILDS       2U     /*!< Children of a node resolved with 1 slot (mask extended by 1 bit)  */
+#define RFAL_NFCV_COLRES_16SLOT_THLD      6U     /*!< Estimated devices on a node from which a 16 slots round is used   */
+#define RFAL_NFCV_COLRES_EST_MIN          2U     /*!< Min estimated devices on a collided node                          */
+#define RFAL_NFCV_COLRES_EST_MAX          255U   /*!< Max estimated devices on a node (unknown / all slots collided)    */
 
 #define RFAL_FDT_POLL_MAX                 rfalConvMsTo1fc(20) /*!< Maximum Wait time FDTV,EOF 20 ms    Digital 2.0  B.5 */   
+#define RFAL_NFCV_FDT_WR_MARGIN           rfalConvMsTo1fc(1)  /*!< Margin added to the VICC programming time of a write     */
 
 
 
@@ -111,6 +118,12 @@
  ******************************************************************************
  */
 
+#define rfalNfcvTimerStart( timer, time_ms ) (timer) = platformTimerCreate((uint16_t)(time_ms))            /*!< Configures and starts the FDTV,INVENT_NORES timer */
+#define rfalNfcvTimerisExpired( timer )      platformTimerIsExpired( timer )                               /*!< Checks FDTV,INVENT_NORES timer has expired        */
+
+/*! Runs the given status method (fn) until it is no longer busy, running the RFAL worker in between */
+#define rfalNfcvRunBlocking( e, fn )         do{ (e)=(fn); rfalWorker(); }while( (e) == ERR_BUSY )
+
 
 /*
 ******************************************************************************
@@ -137,12 +150,68 @@ typedef struct
 } rfalNfcvSlpvReq;
 
 
-/*! Container for a collision found during Anticollision loop */
+/*! Node (mask) with a collision pending on the Anticollision loop, resolved depth first.
+ *  Densely populated nodes are resolved with one 16 slots round (mask extended by 4 bits), 
+ *  sparse ones by a binary split with two 1 slot INVENTORY_REQ (mask extended by 1 bit)  */
+typedef struct
+{
+    uint8_t          maskLen;                          /*!< Mask length of the node (bits)                     */
+    rfalNfcvNumSlots slots;                            /*!< Number of slots used to resolve the node           */
+    uint8_t          child;                            /*!< Next child to be queried on a binary split         */
+    uint8_t          est;                              /*!< Estimated devices on the node (on each collided 
+                                                            child once its round is done)                      */
+    uint16_t         colMap;                           /*!< Children collided still to be resolved             */
+}rfalNfcvColNode;
+
+
+/*! Collision Resolution states */
+typedef enum
+{
+    RFAL_NFCV_CR_IDLE,                                 /*!< IDLE state                                         */
+    RFAL_NFCV_CR_INV,                                  /*!< Wait INVENTORY_RES of the 1 slot INVENTORY_REQ     */
+    RFAL_NFCV_CR_ROUND,                                /*!< Send INVENTORY_REQ (16 or 1 slot) for a collision  */
+    RFAL_NFCV_CR_EOF,                                  /*!< Send EOF to move to the next slot                  */
+    RFAL_NFCV_CR_SLOT,                                 /*!< Wait the response of the current slot              */
+    RFAL_NFCV_CR_SLEEP,                                /*!< Send SLPV_REQ to the devices identified            */
+    RFAL_NFCV_CR_SLEEP_WAIT,                           /*!< Wait SLPV_REQ to be acknowledged                   */
+    RFAL_NFCV_CR_NEXT,                                 /*!< Select the next node/child to be resolved          */
+    RFAL_NFCV_CR_WAIT                                  /*!< Wait FDTV,INVENT_NORES before the next command     */
+} rfalNfcvColResState;
+
+
+/*! Collision Resolution context */
 typedef struct
 {
-    uint8_t  maskLen;
-    uint8_t  maskVal[RFAL_NFCV_MASKVAL_MAX_LEN];
-}rfalNfcvCollision;
+    rfalNfcvColResState  state;                        /*!< Collision Resolution state                         */
+    rfalNfcvColResState  nextState;                    /*!< State to proceed once the wait has elapsed         */
+    uint8_t              devLimit;                     /*!< Device limit given by the caller                   */
+    rfalNfcvListenDevice *nfcvDevList;                 /*!< Caller's device list                               */
+    uint8_t              *devCnt;                      /*!< Caller's device counter                            */
+    bool                 sleepDevs;                    /*!< Put the devices identified to Quiet                */
+    bool                 isDone;                       /*!< Device limit reached or single device found        */
+    uint8_t              sleepCnt;                     /*!< Devices already put to Quiet                       */
+    uint8_t              slotNum;                      /*!< Current slot                                       */
+    uint8_t              emptyCnt;                     /*!< Empty slots on the current round                   */
+    uint8_t              devRound;                     /*!< Devices identified on the current round            */
+    uint16_t             rcvdLen;                      /*!< Received length of the current slot                */
+    uint32_t             tmr;                          /*!< FDTV,INVENT_NORES timer                            */
+    uint8_t              maskVal[RFAL_NFCV_MASKVAL_MAX_LEN];           /*!< Mask of the node being resolved    */
+    uint8_t              colDepth;                     /*!< Nodes pending on colStack                          */
+    rfalNfcvColNode      colStack[RFAL_NFCV_COLRES_MAX_DEPTH];         /*!< Nodes pending, from root to leaf   */
+} rfalNfcvColResParams;
+
+
+/*! RFAL NFC-V instance */
+typedef struct
+{
+    rfalNfcvInventoryReq invReq;                       /*!< INVENTORY_REQ being sent                           */
+    rfalNfcvSlpvReq      slpReq;                       /*!< SLPV_REQ being sent                                */
+    uint8_t              slpRes;                       /*!< Dummy buffer, just to perform Rx of SLPV_REQ       */
+    uint16_t             rxLen;                        /*!< INVENTORY_RES received length                      */
+    uint16_t             *rcvdLen;                     /*!< Caller's received length location (optional)      */
+    rfalNfcvColResParams colRes;                       /*!< Collision Resolution context                       */
+    uint32_t             wrBlockTime;                  /*!< VICC programming time of one block (1/fc), 0: unknown */
+} rfalNfcv;
 
 
 /*
@@ -151,6 +220,12 @@ typedef struct
 ******************************************************************************
 */
 static ReturnCode rfalNfcvParseError( uint8_t err );
+static ReturnCode rfalNfcvPollerColResStart( rfalComplianceMode compMode, uint8_t devLimit, rfalNfcvListenDevice *nfcvDevList, uint8_t *devCnt, bool sleepDevs );
+static void rfalNfcvColResPush( rfalNfcvColResParams *cr, uint8_t maskLen, uint8_t est );
+static void rfalNfcvColResSetMask( uint8_t *maskVal, uint8_t pos, uint8_t bitLen, uint8_t val );
+static uint8_t rfalNfcvColResBitCount( uint16_t map );
+static void rfalNfcvColResEstimate( rfalNfcvColResParams *cr, uint8_t colCnt );
+static uint32_t rfalNfcvWriteTime( uint8_t flags, uint16_t numOfBlocks );
 
 /*
 ******************************************************************************
@@ -158,6 +233,11 @@ static ReturnCode rfalNfcvParseError( uint8_t err );
 ******************************************************************************
 */
 
+static rfalNfcv gRfalNfcv;   /*!< RFAL NFC-V instance */
+
+/*! Devices estimated on a 16 slots round given its number of empty slots: 16*ln(16/empty), none empty taken as one */
+static const uint8_t gRfalNfcvColResEstTbl[RFAL_NFCV_MAX_SLOTS] = { 44U, 44U, 33U, 27U, 22U, 19U, 16U, 13U, 11U, 9U, 8U, 6U, 5U, 3U, 2U, 1U };
+
 /*
 ******************************************************************************
 * LOCAL FUNCTIONS
@@ -184,6 +264,165 @@ static ReturnCode rfalNfcvParseError( uint8_t err )
     }
 }
 
+
+/*******************************************************************************/
+static ReturnCode rfalNfcvPollerColResStart( rfalComplianceMode compMode, uint8_t devLimit, rfalNfcvListenDevice *nfcvDevList, uint8_t *devCnt, bool sleepDevs )
+{
+    ReturnCode ret;
+    
+    if( (nfcvDevList == NULL) || (devCnt == NULL) )
+    {
+        return ERR_PARAM;
+    }
+
+    /* Initialize parameters */
+    *devCnt = 0;
+    gRfalNfcv.colRes.devLimit    = devLimit;
+    gRfalNfcv.colRes.nfcvDevList = nfcvDevList;
+    gRfalNfcv.colRes.devCnt      = devCnt;
+    gRfalNfcv.colRes.sleepDevs   = sleepDevs;
+    gRfalNfcv.colRes.isDone      = false;
+    gRfalNfcv.colRes.sleepCnt    = 0;
+    gRfalNfcv.colRes.colDepth    = 0;
+    ST_MEMSET( gRfalNfcv.colRes.maskVal, 0x00, RFAL_NFCV_MASKVAL_MAX_LEN );
+
+    if( devLimit > 0U )       /* MISRA 21.18 */
+    {
+        ST_MEMSET(nfcvDevList, 0x00, (sizeof(rfalNfcvListenDevice)*devLimit) );
+    }
+
+    if( compMode == RFAL_COMPLIANCE_MODE_NFC )
+    {
+        /* Send INVENTORY_REQ with one slot   Activity 2.0  9.3.7.1  (Symbol 0)  */
+        EXIT_ON_ERR( ret, rfalNfcvPollerStartInventory( RFAL_NFCV_NUM_SLOTS_1, 0, NULL, &nfcvDevList->InvRes, NULL ) );
+        gRfalNfcv.colRes.state = RFAL_NFCV_CR_INV;
+    }
+    else if( devLimit == 0U )
+    {
+        gRfalNfcv.colRes.state = RFAL_NFCV_CR_IDLE;
+    }
+    else
+    { 
+        /* Advance to 16 slots below without mask. Will give a good chance to identify multiple cards */
+        rfalNfcvColResPush( &gRfalNfcv.colRes, 0U, RFAL_NFCV_COLRES_EST_MAX );
+        gRfalNfcv.colRes.state = RFAL_NFCV_CR_ROUND;
+    }
+    
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+static void rfalNfcvColResPush( rfalNfcvColResParams *cr, uint8_t maskLen, uint8_t est )
+{
+    rfalNfcvColNode *node;
+    
+    node          = &cr->colStack[cr->colDepth];
+    node->maskLen = maskLen;
+    node->child   = 0;
+    node->colMap  = 0;
+    node->est     = est;
+    
+    /* Use 16 slots on densely populated nodes, as long as the mask can still be extended by the slot number */
+    node->slots   = ( ((est >= RFAL_NFCV_COLRES_16SLOT_THLD) && ((maskLen + RFAL_NFCV_COLRES_16SLOT_BITS) <= RFAL_NFCV_MASKVAL_MAX_16SLOT_LEN)) ? RFAL_NFCV_NUM_SLOTS_16 : RFAL_NFCV_NUM_SLOTS_1 );
+    
+    cr->colDepth++;
+}
+
+
+/*******************************************************************************/
+static void rfalNfcvColResSetMask( uint8_t *maskVal, uint8_t pos, uint8_t bitLen, uint8_t val )
+{
+    uint8_t i;
+    uint8_t bit;
+    
+    /* Clear any bit beyond pos (left by a previous node) */
+    maskVal[(pos / RFAL_BITS_IN_BYTE)] &= (uint8_t)((1U << (pos % RFAL_BITS_IN_BYTE)) - 1U);
+    for( i = ((pos / RFAL_BITS_IN_BYTE) + 1U); i < RFAL_NFCV_MASKVAL_MAX_LEN; i++ )
+    {
+        maskVal[i] = 0;
+    }
+    
+    /* Append val (LSB first) */
+    for( i = 0; i < bitLen; i++ )
+    {
+        bit = (pos + i);
+        if( (val & (1U << i)) != 0U )
+        {
+            maskVal[(bit / RFAL_BITS_IN_BYTE)] |= (uint8_t)(1U << (bit % RFAL_BITS_IN_BYTE));
+        }
+    }
+}
+
+
+/*******************************************************************************/
+static uint8_t rfalNfcvColResBitCount( uint16_t map )
+{
+    uint8_t  cnt;
+    uint16_t m;
+    
+    cnt = 0;
+    m   = map;
+    while( m != 0U )
+    {
+        m &= (uint16_t)(m - 1U);
+        cnt++;
+    }
+    
+    return cnt;
+}
+
+
+/*******************************************************************************/
+static void rfalNfcvColResEstimate( rfalNfcvColResParams *cr, uint8_t colCnt )
+{
+    uint8_t         est;
+    rfalNfcvColNode *node;
+    
+    node = &cr->colStack[(cr->colDepth - 1U)];
+    
+    /* Devices on the node given its empty slots. With no slot left empty the round only bounds them from below, keep the node's own estimate if higher */
+    est = gRfalNfcvColResEstTbl[ MIN( cr->emptyCnt, (RFAL_NFCV_MAX_SLOTS - 1U) ) ];
+    if( cr->emptyCnt == 0U )
+    {
+        est = MAX( est, node->est );
+    }
+    
+    /* Siblings are expected to be alike: the parent's remaining collided children take this node's measure */
+    if( cr->colDepth > 1U )
+    {
+        cr->colStack[(cr->colDepth - 2U)].est = est;
+    }
+    
+    /* Devices left on the collided slots, shared among them */
+    est = (((est > cr->devRound) && (colCnt != 0U)) ? (uint8_t)((est - cr->devRound) / colCnt) : 0U);
+    
+    node->est = MAX( est, RFAL_NFCV_COLRES_EST_MIN );
+}
+
+/*******************************************************************************/
+static uint32_t rfalNfcvWriteTime( uint8_t flags, uint16_t numOfBlocks )
+{
+    uint32_t wrTime;
+    
+    /* Programming time unknown: wait FDTV,EOF max as for any other command */
+    if( gRfalNfcv.wrBlockTime == 0U )
+    {
+        return RFAL_FDT_POLL_MAX;
+    }
+    
+    wrTime = ((gRfalNfcv.wrBlockTime * numOfBlocks) + RFAL_NFCV_FDT_WR_MARGIN);
+    
+    /* Without Option flag the VICC answers once the blocks are programmed, the time is only a timeout  *
+     * With Option flag it is the time elapsed before sending the EOF  ISO15693-3 2009  10.4.2 & 10.4.3 */
+    if( (flags & (uint8_t)RFAL_NFCV_REQ_FLAG_OPTION) == 0U )
+    {
+        wrTime = MAX( wrTime, RFAL_FDT_POLL_MAX );
+    }
+    
+    return wrTime;
+}
+
 /*
 ******************************************************************************
 * GLOBAL FUNCTIONS
@@ -202,16 +441,43 @@ ReturnCode rfalNfcvPollerInitialize( void )
     rfalSetFDTListen( RFAL_FDT_LISTEN_NFCV_POLLER );
     rfalSetFDTPoll( RFAL_FDT_POLL_NFCV_POLLER );
     
+    gRfalNfcv.wrBlockTime = 0U;
+    
     return ERR_NONE;
 }
 
+/*******************************************************************************/
+void rfalNfcvPollerSetWriteTime( uint32_t blockWrTime )
+{
+    gRfalNfcv.wrBlockTime = blockWrTime;
+}
+
 /*******************************************************************************/
 ReturnCode rfalNfcvPollerCheckPresence( rfalNfcvInventoryRes *invRes )
 {
     ReturnCode ret;
     
+    EXIT_ON_ERR( ret, rfalNfcvPollerStartCheckPresence( invRes ) );
+    rfalNfcvRunBlocking( ret, rfalNfcvPollerGetCheckPresenceStatus() );
+    
+    return ret;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcvPollerStartCheckPresence( rfalNfcvInventoryRes *invRes )
+{
     /* INVENTORY_REQ with 1 slot and no Mask   Activity 2.0 (Candidate) 9.2.3.32 */
-    ret = rfalNfcvPollerInventory( RFAL_NFCV_NUM_SLOTS_1, 0, NULL, invRes, NULL );
+    return rfalNfcvPollerStartInventory( RFAL_NFCV_NUM_SLOTS_1, 0, NULL, invRes, NULL );
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcvPollerGetCheckPresenceStatus( void )
+{
+    ReturnCode ret;
+    
+    ret = rfalNfcvPollerGetInventoryStatus();
     
     if( (ret == ERR_RF_COLLISION) || (ret == ERR_CRC)  || 
         (ret == ERR_FRAMING)      || (ret == ERR_PROTO)  )
@@ -222,38 +488,62 @@ ReturnCode rfalNfcvPollerCheckPresence( rfalNfcvInventoryRes *invRes )
     return ret;
 }
 
+
 /*******************************************************************************/
 ReturnCode rfalNfcvPollerInventory( rfalNfcvNumSlots nSlots, uint8_t maskLen, const uint8_t *maskVal, rfalNfcvInventoryRes *invRes, uint16_t* rcvdLen )
 {
-    ReturnCode           ret;
-    rfalNfcvInventoryReq invReq;
-    uint16_t             rxLen;
+    ReturnCode ret;
+    
+    EXIT_ON_ERR( ret, rfalNfcvPollerStartInventory( nSlots, maskLen, maskVal, invRes, rcvdLen ) );
+    rfalNfcvRunBlocking( ret, rfalNfcvPollerGetInventoryStatus() );
     
+    return ret;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcvPollerStartInventory( rfalNfcvNumSlots nSlots, uint8_t maskLen, const uint8_t *maskVal, rfalNfcvInventoryRes *invRes, uint16_t* rcvdLen )
+{
     if( ((maskVal == NULL) && (maskLen != 0U)) || (invRes == NULL) )
     {
         return ERR_PARAM;
     }
     
-    invReq.INV_FLAG = (RFAL_NFCV_INV_REQ_FLAG | (uint8_t)nSlots);
-    invReq.CMD      = RFAL_NFCV_CMD_INVENTORY;
-    invReq.MASK_LEN = (uint8_t)MIN( maskLen, ((nSlots == RFAL_NFCV_NUM_SLOTS_1) ? RFAL_NFCV_MASKVAL_MAX_1SLOT_LEN : RFAL_NFCV_MASKVAL_MAX_16SLOT_LEN) );   /* Digital 2.0  9.6.1.6 */
+    gRfalNfcv.invReq.INV_FLAG = (RFAL_NFCV_INV_REQ_FLAG | (uint8_t)nSlots);
+    gRfalNfcv.invReq.CMD      = RFAL_NFCV_CMD_INVENTORY;
+    gRfalNfcv.invReq.MASK_LEN = (uint8_t)MIN( maskLen, ((nSlots == RFAL_NFCV_NUM_SLOTS_1) ? RFAL_NFCV_MASKVAL_MAX_1SLOT_LEN : RFAL_NFCV_MASKVAL_MAX_16SLOT_LEN) );   /* Digital 2.0  9.6.1.6 */
     
-    if( rfalConvBitsToBytes(invReq.MASK_LEN) > 0U )  /* MISRA 21.18 */
+    if( rfalConvBitsToBytes(gRfalNfcv.invReq.MASK_LEN) > 0U )  /* MISRA 21.18 */
     {
-        ST_MEMCPY( invReq.MASK_VALUE, maskVal, rfalConvBitsToBytes(invReq.MASK_LEN) );
+        ST_MEMCPY( gRfalNfcv.invReq.MASK_VALUE, maskVal, rfalConvBitsToBytes(gRfalNfcv.invReq.MASK_LEN) );
     }
     
-    ret = rfalISO15693TransceiveAnticollisionFrame( (uint8_t*)&invReq, (uint8_t)(RFAL_NFCV_INV_REQ_HEADER_LEN + rfalConvBitsToBytes(invReq.MASK_LEN)), (uint8_t*)invRes, sizeof(rfalNfcvInventoryRes), &rxLen );
+    gRfalNfcv.rcvdLen = rcvdLen;
+    
+    return rfalISO15693StartTransceiveAnticollisionFrame( (uint8_t*)&gRfalNfcv.invReq, (uint8_t)(RFAL_NFCV_INV_REQ_HEADER_LEN + rfalConvBitsToBytes(gRfalNfcv.invReq.MASK_LEN)), (uint8_t*)invRes, sizeof(rfalNfcvInventoryRes), &gRfalNfcv.rxLen );
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcvPollerGetInventoryStatus( void )
+{
+    ReturnCode ret;
+    
+    ret = rfalISO15693GetTransceiveAnticollisionFrameStatus();
+    if( ret == ERR_BUSY )
+    {
+        return ret;
+    }
     
     /* Check for optional output parameter */
-    if( rcvdLen != NULL )
+    if( gRfalNfcv.rcvdLen != NULL )
     {
-        *rcvdLen = rxLen;
+        *gRfalNfcv.rcvdLen = gRfalNfcv.rxLen;
     }
     
     if( ret == ERR_NONE )
     {
-        if( rxLen != rfalConvBytesToBits(RFAL_NFCV_INV_RES_LEN + RFAL_NFCV_CRC_LEN) )
+        if( gRfalNfcv.rxLen != rfalConvBytesToBits(RFAL_NFCV_INV_RES_LEN + RFAL_NFCV_CRC_LEN) )
         {
             return ERR_PROTO;
         }
@@ -262,153 +552,317 @@ ReturnCode rfalNfcvPollerInventory( rfalNfcvNumSlots nSlots, uint8_t maskLen, co
     return ret;
 }
 
+
 /*******************************************************************************/
 ReturnCode rfalNfcvPollerCollisionResolution( rfalComplianceMode compMode, uint8_t devLimit, rfalNfcvListenDevice *nfcvDevList, uint8_t *devCnt )
 {
-    ReturnCode        ret;
-    uint8_t           slotNum;
-    uint16_t          rcvdLen;
-    uint8_t           colIt;
-    uint8_t           colCnt;
-    uint8_t           colPos;
-    bool              colPending;
-    rfalNfcvCollision colFound[RFAL_NFCV_MAX_COLL_SUPPORTED];
+    ReturnCode ret;
     
+    EXIT_ON_ERR( ret, rfalNfcvPollerStartCollisionResolution( compMode, devLimit, nfcvDevList, devCnt ) );
+    rfalNfcvRunBlocking( ret, rfalNfcvPollerGetCollisionResolutionStatus() );
     
-    if( (nfcvDevList == NULL) || (devCnt == NULL) )
-    {
-        return ERR_PARAM;
-    }
-
-    /* Initialize parameters */
-    *devCnt = 0;
-    colIt         = 0;
-    colCnt        = 0;
-    colPending    = false;
-    ST_MEMSET(colFound, 0x00, (sizeof(rfalNfcvCollision)*RFAL_NFCV_MAX_COLL_SUPPORTED) );
-
-    if( devLimit > 0U )       /* MISRA 21.18 */
-    {
-        ST_MEMSET(nfcvDevList, 0x00, (sizeof(rfalNfcvListenDevice)*devLimit) );
-    }
-
-    NO_WARNING(colPending);   /* colPending is not exposed externally, in future it might become exposed/ouput parameter */
-
-    if( compMode == RFAL_COMPLIANCE_MODE_NFC )
-    {
-        /* Send INVENTORY_REQ with one slot   Activity 2.0  9.3.7.1  (Symbol 0)  */
-        ret = rfalNfcvPollerInventory( RFAL_NFCV_NUM_SLOTS_1, 0, NULL, &nfcvDevList->InvRes, NULL );
-
-        if( ret == ERR_TIMEOUT )  /* Exit if no device found     Activity 2.0  9.3.7.2 (Symbol 1)  */
-        {
-            return ERR_NONE;
-        }
-        if( ret == ERR_NONE )     /* Device found without transmission error/collision    Activity 2.0  9.3.7.3 (Symbol 2)  */
-        {
-            (*devCnt)++;
-            return ERR_NONE;
-        }
+    return ret;
+}
 
-        /* A Collision has been identified  Activity 2.0  9.3.7.2  (Symbol 3) */
-        colPending = true;
-        colCnt        = 1;
 
-        /* Check if the Collision Resolution is set to perform only Collision detection   Activity 2.0  9.3.7.5 (Symbol 4)*/
-        if( devLimit == 0U )
-        {
-            return ERR_RF_COLLISION;
-        }
+/*******************************************************************************/
+ReturnCode rfalNfcvPollerStartCollisionResolution( rfalComplianceMode compMode, uint8_t devLimit, rfalNfcvListenDevice *nfcvDevList, uint8_t *devCnt )
+{
+    return rfalNfcvPollerColResStart( compMode, devLimit, nfcvDevList, devCnt, false );
+}
 
-        platformDelay(RFAL_NFCV_FDT_V_INVENT_NORES);
 
-        /*******************************************************************************/
-        /* Collisions pending, Anticollision loop must be executed                     */
-        /*******************************************************************************/
-    }
-    else
-    { 
-        /* Advance to 16 slots below without mask. Will give a good chance to identify multiple cards */
-        colPending = true;
-        colCnt        = 1;
-    }
+/*******************************************************************************/
+ReturnCode rfalNfcvPollerGetCollisionResolutionStatus( void )
+{
+    ReturnCode            ret;
+    bool                  fdtWait;
+    bool                  isCol;
+    uint8_t               step;
+    uint8_t               val;
+    uint8_t               colNum;
+    rfalNfcvColNode       *node;
+    rfalNfcvColResParams  *cr;
     
+    cr = &gRfalNfcv.colRes;
     
-    /* Execute until all collisions are resolved Activity 2.0  9.3.7.16  (Symbol 17) */
     do
     {
-        /* Activity 2.0  9.3.7.5  (Symbol 6) */
-        colPending = false;
-        slotNum    = 0;
+        node = &cr->colStack[((cr->colDepth > 0U) ? (cr->colDepth - 1U) : 0U)];   /* Node being resolved */
         
-        do
+        switch( cr->state )
         {
-            if( slotNum == 0U )
-            {
-                /* Send INVENTORY_REQ with 16 slots   Activity 2.0  9.3.7.7  (Symbol 8) */
-                ret = rfalNfcvPollerInventory( RFAL_NFCV_NUM_SLOTS_16, colFound[colIt].maskLen, colFound[colIt].maskVal, &nfcvDevList[(*devCnt)].InvRes, &rcvdLen );
-            }
-            else
-            {
-                ret = rfalISO15693TransceiveEOFAnticollision( (uint8_t*)&nfcvDevList[(*devCnt)].InvRes, sizeof(rfalNfcvInventoryRes), &rcvdLen );
-            }
-            slotNum++;
-            
             /*******************************************************************************/
-            if( ret != ERR_TIMEOUT )
-            {
-                if( rcvdLen < rfalConvBytesToBits(RFAL_NFCV_INV_RES_LEN + RFAL_NFCV_CRC_LEN) )
-                { /* If only a partial frame was received make sure the FDT_V_INVENT_NORES is fulfilled */
-                    platformDelay(RFAL_NFCV_FDT_V_INVENT_NORES);
+            case RFAL_NFCV_CR_INV:
+                
+                ret = rfalNfcvPollerGetInventoryStatus();
+                if( ret == ERR_BUSY )
+                {
+                    return ret;
                 }
-
-                if( ret == ERR_NONE )
+                
+                cr->state = RFAL_NFCV_CR_IDLE;
+                
+                if( ret == ERR_TIMEOUT )  /* Exit if no device found     Activity 2.0  9.3.7.2 (Symbol 1)  */
+                {
+                    return ERR_NONE;
+                }
+                if( ret == ERR_NONE )     /* Device found without transmission error/collision    Activity 2.0  9.3.7.3 (Symbol 2)  */
+                {
+                    (void)rfalGetTransceiveRSSI( &cr->nfcvDevList[(*cr->devCnt)].rssi );
+                    (*cr->devCnt)++;
+                    cr->nextState = RFAL_NFCV_CR_SLEEP;
+                    cr->isDone    = true;
+                    cr->state     = RFAL_NFCV_CR_SLEEP;
+                    break;
+                }
+                
+                /* A Collision has been identified  Activity 2.0  9.3.7.2  (Symbol 3) */
+                
+                /* Check if the Collision Resolution is set to perform only Collision detection   Activity 2.0  9.3.7.5 (Symbol 4)*/
+                if( cr->devLimit == 0U )
                 {
-                    /* Check if the device found is already on the list and its response is a valid INVENTORY_RES */
-                    if( rcvdLen == rfalConvBytesToBits(RFAL_NFCV_INV_RES_LEN + RFAL_NFCV_CRC_LEN) )
+                    return ERR_RF_COLLISION;
+                }
+                
+                /*******************************************************************************/
+                /* Collisions pending, Anticollision loop must be executed after FDTV,INVENT_NORES */
+                /*******************************************************************************/
+                rfalNfcvColResPush( cr, 0U, RFAL_NFCV_COLRES_EST_MAX );
+                rfalNfcvTimerStart( cr->tmr, RFAL_NFCV_FDT_V_INVENT_NORES );
+                cr->nextState = RFAL_NFCV_CR_ROUND;
+                cr->state     = RFAL_NFCV_CR_WAIT;
+                break;
+                
+            /*******************************************************************************/
+            case RFAL_NFCV_CR_ROUND:
+                
+                /* Activity 2.0  9.3.7.5  (Symbol 6) */
+                cr->slotNum  = 0;
+                cr->emptyCnt = 0;
+                cr->devRound = 0;
+                
+                if( node->slots == RFAL_NFCV_NUM_SLOTS_16 )
+                {
+                    /* Send INVENTORY_REQ with 16 slots with the node's mask   Activity 2.0  9.3.7.7  (Symbol 8) */
+                    rfalNfcvColResSetMask( cr->maskVal, node->maskLen, 0U, 0U );
+                    ret = rfalNfcvPollerStartInventory( RFAL_NFCV_NUM_SLOTS_16, node->maskLen, cr->maskVal, &cr->nfcvDevList[(*cr->devCnt)].InvRes, &cr->rcvdLen );
+                }
+                else
+                {
+                    /* Send INVENTORY_REQ with 1 slot with the node's mask extended by the child bit */
+                    rfalNfcvColResSetMask( cr->maskVal, node->maskLen, 1U, node->child );
+                    ret = rfalNfcvPollerStartInventory( RFAL_NFCV_NUM_SLOTS_1, (node->maskLen + 1U), cr->maskVal, &cr->nfcvDevList[(*cr->devCnt)].InvRes, &cr->rcvdLen );
+                }
+                
+                if( ret != ERR_NONE )
+                {
+                    cr->state = RFAL_NFCV_CR_IDLE;
+                    return ret;
+                }
+                cr->state = RFAL_NFCV_CR_SLOT;
+                break;
+                
+            /*******************************************************************************/
+            case RFAL_NFCV_CR_EOF:
+                
+                /* Send EOF to move to the next slot */
+                ret = rfalISO15693StartTransceiveEOFAnticollision( (uint8_t*)&cr->nfcvDevList[(*cr->devCnt)].InvRes, sizeof(rfalNfcvInventoryRes), &cr->rcvdLen );
+                if( ret != ERR_NONE )
+                {
+                    cr->state = RFAL_NFCV_CR_IDLE;
+                    return ret;
+                }
+                cr->state = RFAL_NFCV_CR_SLOT;
+                break;
+                
+            /*******************************************************************************/
+            case RFAL_NFCV_CR_SLOT:
+                
+                ret = ((cr->slotNum == 0U) ? rfalNfcvPollerGetInventoryStatus() : rfalISO15693GetTransceiveAnticollisionFrameStatus());
+                if( ret == ERR_BUSY )
+                {
+                    return ret;
+                }
+                cr->slotNum++;
+                
+                /*******************************************************************************/
+                isCol = false;
+                if( ret != ERR_TIMEOUT )
+                {
+                    /* If only a partial frame was received make sure the FDT_V_INVENT_NORES is fulfilled */
+                    fdtWait = (cr->rcvdLen < rfalConvBytesToBits(RFAL_NFCV_INV_RES_LEN + RFAL_NFCV_CRC_LEN));
+                    
+                    if( (ret == ERR_NONE) && (cr->rcvdLen == rfalConvBytesToBits(RFAL_NFCV_INV_RES_LEN + RFAL_NFCV_CRC_LEN)) )
+                    {
+                        /* Valid INVENTORY_RES, device identified   Activity 2.0  9.3.7.15  (Symbol 11) */
+                        (void)rfalGetTransceiveRSSI( &cr->nfcvDevList[(*cr->devCnt)].rssi );
+                        (*cr->devCnt)++;
+                        cr->devRound++;
+                    }
+                    else
                     {
-                        /* Activity 2.0  9.3.7.15  (Symbol 11) */
-                        (*devCnt)++;
+                        /* Treat everything else as collision, it is kept to be resolved later   Activity 2.0  9.3.7.15  (Symbol 16) */
+                        isCol = true;
                     }
                 }
-                else /* Treat everything else as collision */
+                else 
+                { 
+                    /* Timeout */
+                    fdtWait = true;
+                    cr->emptyCnt++;
+                }
+                
+                if( node->slots == RFAL_NFCV_NUM_SLOTS_16 )
+                {
+                    node->colMap |= (uint16_t)((isCol ? 1U : 0U) << (cr->slotNum - 1U));
+                }
+                else
                 {
-                    /* Activity 2.0  9.3.7.15  (Symbol 16) */
-                    colPending = true;
+                    node->colMap |= (uint16_t)((isCol ? 1U : 0U) << node->child);
+                    node->child++;
                     
-
-                    /*******************************************************************************/
-                    /* Ensure that this collision still fits on the container */
-                    if( colCnt < RFAL_NFCV_MAX_COLL_SUPPORTED )
+                    /* Node is known to hold more than one device: if the first half is empty all of them are on the second one */
+                    if( (node->child == 1U) && (ret == ERR_TIMEOUT) )
                     {
-                        /* Store this collision on the container to be resolved later */
-                        /* Activity 2.0  9.3.7.15  (Symbol 16): add the collision information
-                         * (MASK_VAL + SN) to the list containing the collision information */
-                        ST_MEMCPY(colFound[colCnt].maskVal, colFound[colIt].maskVal, RFAL_NFCV_UID_LEN);
-                        colPos = colFound[colIt].maskLen;
-                        colFound[colCnt].maskVal[(colPos/RFAL_BITS_IN_BYTE)]      &= (uint8_t)((1U << (colPos % RFAL_BITS_IN_BYTE)) - 1U);
-                        colFound[colCnt].maskVal[(colPos/RFAL_BITS_IN_BYTE)]      |= (uint8_t)((slotNum-1U) << (colPos % RFAL_BITS_IN_BYTE));
-                        colFound[colCnt].maskVal[((colPos/RFAL_BITS_IN_BYTE)+1U)]  = (uint8_t)((slotNum-1U) >> (RFAL_BITS_IN_BYTE - (colPos % RFAL_BITS_IN_BYTE)));
-
-                        colFound[colCnt].maskLen = (colFound[colIt].maskLen + 4U);
-
-                        colCnt++;
+                        node->colMap |= 0x0002U;
+                        node->child   = RFAL_NFCV_COLRES_BIN_CHILDS;
                     }
                 }
-            }
-            else 
-            { 
-                /* Timeout */
-                platformDelay(RFAL_NFCV_FDT_V_INVENT_NORES);
-            }
-            
-            /* Check if devices found have reached device limit   Activity 2.0  9.3.7.15  (Symbol 16) */
-            if( *devCnt >= devLimit )
-            {
-                return ERR_NONE;
-            }
-        } while( slotNum < RFAL_NFCV_MAX_SLOTS );  /* Slot loop             */
-        colIt++;
-    } while( colIt < colCnt );                     /* Collisions found loop */
+                
+                /* Check if devices found have reached device limit   Activity 2.0  9.3.7.15  (Symbol 16) */
+                if( *cr->devCnt >= cr->devLimit )
+                {
+                    cr->isDone    = true;
+                    cr->nextState = RFAL_NFCV_CR_SLEEP;
+                }
+                /* Move to the next slot of the 16 slots round  Activity 2.0  9.3.7.16  (Symbol 17) */
+                else if( (node->slots == RFAL_NFCV_NUM_SLOTS_16) && (cr->slotNum < RFAL_NFCV_MAX_SLOTS) )
+                {
+                    cr->nextState = RFAL_NFCV_CR_EOF;
+                }
+                else
+                {
+                    /* Round done, estimate how many devices each collided child holds to choose how to resolve it */
+                    colNum = rfalNfcvColResBitCount( node->colMap );
+                    if( node->slots == RFAL_NFCV_NUM_SLOTS_16 )
+                    {
+                        rfalNfcvColResEstimate( cr, colNum );
+                    }
+                    else if( (node->child == RFAL_NFCV_COLRES_BIN_CHILDS) && (node->colMap == 0x0003U) )
+                    {
+                        /* Both halves collided, the node's devices are shared among them */
+                        node->est = (uint8_t)MAX( (node->est / 2U), RFAL_NFCV_COLRES_EST_MIN );
+                    }
+                    else
+                    {
+                        /* Split not done yet, or all collided devices of the node are on one half: keep the estimate */
+                    }
+                    cr->nextState = RFAL_NFCV_CR_SLEEP;
+                }
+                
+                /* Instead of blocking, FDTV,INVENT_NORES is awaited on a timer */
+                if( fdtWait )
+                {
+                    rfalNfcvTimerStart( cr->tmr, RFAL_NFCV_FDT_V_INVENT_NORES );
+                    cr->state = RFAL_NFCV_CR_WAIT;
+                }
+                else
+                {
+                    cr->state = cr->nextState;
+                }
+                break;
+                
+            /*******************************************************************************/
+            case RFAL_NFCV_CR_SLEEP:
+                
+                /* Once the round is over put the devices identified to Quiet, so that they don't reply anymore */
+                if( cr->sleepDevs && (cr->sleepCnt < *cr->devCnt) )
+                {
+                    ret = rfalNfcvPollerStartSleep( 0x00, cr->nfcvDevList[cr->sleepCnt].InvRes.UID );
+                    if( ret != ERR_NONE )
+                    {
+                        cr->state = RFAL_NFCV_CR_IDLE;
+                        return ret;
+                    }
+                    cr->state = RFAL_NFCV_CR_SLEEP_WAIT;
+                    break;
+                }
+                
+                cr->state = (cr->isDone ? RFAL_NFCV_CR_IDLE : RFAL_NFCV_CR_NEXT);
+                break;
+                
+            /*******************************************************************************/
+            case RFAL_NFCV_CR_SLEEP_WAIT:
+                
+                ret = rfalNfcvPollerGetSleepStatus();
+                if( ret == ERR_BUSY )
+                {
+                    return ret;
+                }
+                
+                cr->nfcvDevList[cr->sleepCnt].isSleep = (ret == ERR_NONE);
+                cr->sleepCnt++;
+                cr->state = RFAL_NFCV_CR_SLEEP;
+                break;
+                
+            /*******************************************************************************/
+            case RFAL_NFCV_CR_NEXT:
+                
+                /* Query the second half of a binary split */
+                if( (node->slots == RFAL_NFCV_NUM_SLOTS_1) && (node->child < RFAL_NFCV_COLRES_BIN_CHILDS) )
+                {
+                    cr->state = RFAL_NFCV_CR_ROUND;
+                    break;
+                }
+                
+                /* Resolve the next collided child of this node */
+                if( node->colMap != 0U )
+                {
+                    val = 0;
+                    while( (node->colMap & (1U << val)) == 0U )
+                    {
+                        val++;
+                    }
+                    node->colMap &= (uint16_t)~(1U << val);
+                    
+                    step = ((node->slots == RFAL_NFCV_NUM_SLOTS_16) ? RFAL_NFCV_COLRES_16SLOT_BITS : 1U);
+                    
+                    /* A child with the whole UID masked cannot collide, ignore it (noise) */
+                    if( (node->maskLen + step) < RFAL_NFCV_MASKVAL_MAX_1SLOT_LEN )
+                    {
+                        /* Extend the mask with the child value (slot number / bit) */
+                        rfalNfcvColResSetMask( cr->maskVal, node->maskLen, step, val );
+                        rfalNfcvColResPush( cr, (node->maskLen + step), node->est );
+                        cr->state = RFAL_NFCV_CR_ROUND;
+                    }
+                    break;
+                }
+                
+                /* Node fully resolved, go back to its parent */
+                cr->colDepth--;
+                if( cr->colDepth == 0U )
+                {
+                    cr->state = RFAL_NFCV_CR_IDLE;
+                }
+                break;
+                
+            /*******************************************************************************/
+            case RFAL_NFCV_CR_WAIT:
+                
+                if( !rfalNfcvTimerisExpired( cr->tmr ) )
+                {
+                    return ERR_BUSY;
+                }
+                cr->state = cr->nextState;
+                break;
+                
+            /*******************************************************************************/
+            default:
+                return ERR_WRONG_STATE;
+        }
+    }
+    while( cr->state != RFAL_NFCV_CR_IDLE );
     
     return ERR_NONE;
 }
@@ -416,40 +870,44 @@ ReturnCode rfalNfcvPollerCollisionResolution( rfalComplianceMode compMode, uint8
 /*******************************************************************************/
 ReturnCode rfalNfcvPollerSleepCollisionResolution( uint8_t devLimit, rfalNfcvListenDevice *nfcvDevList, uint8_t *devCnt )
 {
-    uint8_t    locDevCnt;
     ReturnCode ret;
-    uint8_t    i;
+    
+    EXIT_ON_ERR( ret, rfalNfcvPollerStartSleepCollisionResolution( devLimit, nfcvDevList, devCnt ) );
+    rfalNfcvRunBlocking( ret, rfalNfcvPollerGetSleepCollisionResolutionStatus() );
+    
+    return ret;
+}
 
-    if( (nfcvDevList == NULL) || (devCnt == NULL) )
-    {
-        return ERR_PARAM;
-    }
 
-    *devCnt = 0;
+/*******************************************************************************/
+ReturnCode rfalNfcvPollerStartSleepCollisionResolution( uint8_t devLimit, rfalNfcvListenDevice *nfcvDevList, uint8_t *devCnt )
+{
+    return rfalNfcvPollerColResStart( RFAL_COMPLIANCE_MODE_ISO, devLimit, nfcvDevList, devCnt, true );
+}
 
-    do
-    {
-        locDevCnt = 0;
-        ret = rfalNfcvPollerCollisionResolution( RFAL_COMPLIANCE_MODE_ISO, (devLimit - *devCnt), &nfcvDevList[*devCnt], &locDevCnt );
 
-        for( i = *devCnt; i < (*devCnt + locDevCnt); i++ )
-        {
-            rfalNfcvPollerSleep( 0x00, nfcvDevList[i].InvRes.UID );
-            nfcvDevList[i].isSleep = true;
-        }
-        *devCnt += locDevCnt;
-    }
-    while( (locDevCnt > 0U) && (*devCnt < devLimit) );
+/*******************************************************************************/
+ReturnCode rfalNfcvPollerGetSleepCollisionResolutionStatus( void )
+{
+    return rfalNfcvPollerGetCollisionResolutionStatus();
+}
 
+/*******************************************************************************/
+ReturnCode rfalNfcvPollerSleep( uint8_t flags, const uint8_t* uid )
+{
+    ReturnCode ret;
+    
+    EXIT_ON_ERR( ret, rfalNfcvPollerStartSleep( flags, uid ) );
+    rfalNfcvRunBlocking( ret, rfalNfcvPollerGetSleepStatus() );
+    
     return ret;
 }
 
+
 /*******************************************************************************/
-ReturnCode rfalNfcvPollerSleep( uint8_t flags, const uint8_t* uid )
+ReturnCode rfalNfcvPollerStartSleep( uint8_t flags, const uint8_t* uid )
 {
-    ReturnCode      ret;
-    rfalNfcvSlpvReq slpReq;
-    uint8_t         rxBuf;    /* dummy buffer, just to perform Rx */
+    rfalTransceiveContext ctx;
     
     if( uid == NULL )
     {
@@ -457,12 +915,22 @@ ReturnCode rfalNfcvPollerSleep( uint8_t flags, const uint8_t* uid )
     }
     
     /* Compute SLPV_REQ */
-    slpReq.REQ_FLAG = (flags | (uint8_t)RFAL_NFCV_REQ_FLAG_ADDRESS);   /* Should be with UID according Digital 2.0 (Candidate) 9.7.1.1 */
-    slpReq.CMD      = RFAL_NFCV_CMD_SLPV;
-    ST_MEMCPY( slpReq.UID, uid, RFAL_NFCV_UID_LEN );
+    gRfalNfcv.slpReq.REQ_FLAG = (flags | (uint8_t)RFAL_NFCV_REQ_FLAG_ADDRESS);   /* Should be with UID according Digital 2.0 (Candidate) 9.7.1.1 */
+    gRfalNfcv.slpReq.CMD      = RFAL_NFCV_CMD_SLPV;
+    ST_MEMCPY( gRfalNfcv.slpReq.UID, uid, RFAL_NFCV_UID_LEN );
     
     /* NFC Forum device SHALL wait at least FDTVpp to consider the SLPV acknowledged (FDTVpp = FDTVpoll)  Digital 2.0 (Candidate)  9.7  9.8.2  */
-    ret = rfalTransceiveBlockingTxRx( (uint8_t*)&slpReq, sizeof(rfalNfcvSlpvReq), &rxBuf, sizeof(rxBuf), NULL, RFAL_TXRX_FLAGS_DEFAULT, RFAL_FDT_POLL_NFCV_POLLER );
+    rfalCreateByteFlagsTxRxContext( ctx, (uint8_t*)&gRfalNfcv.slpReq, sizeof(rfalNfcvSlpvReq), &gRfalNfcv.slpRes, sizeof(gRfalNfcv.slpRes), NULL, RFAL_TXRX_FLAGS_DEFAULT, RFAL_FDT_POLL_NFCV_POLLER );
+    return rfalStartTransceive( &ctx );
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcvPollerGetSleepStatus( void )
+{
+    ReturnCode ret;
+    
+    ret = rfalGetTransceiveStatus();
     if( ret != ERR_TIMEOUT )
     {
         return ret;
@@ -591,7 +1059,13 @@ ReturnCode rfalNfcvPollerWriteMultipleBlocks( uint8_t flags, const uint8_t* uid,
     }
     
     /* Transceive Command */
-    ret = rfalTransceiveBlockingTxRx( txBuf, msgIt, (uint8_t*)&res, sizeof(rfalNfcvGenericRes), &rcvLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_FDT_POLL_MAX );
+    ret = rfalTransceiveBlockingTxRx( txBuf, msgIt, (uint8_t*)&res, sizeof(rfalNfcvGenericRes), &rcvLen, RFAL_TXRX_FLAGS_DEFAULT, rfalNfcvWriteTime( flags, numOfBlocks ) );
+    
+    /* If the Option Flag is set an EOF needs to be sent once the blocks are programmed to retrieve the VICC response  ISO15693-3 2009  10.4.3 */
+    if( (flags & (uint8_t)RFAL_NFCV_REQ_FLAG_OPTION) != 0U )
+    {
+        ret = rfalISO15693TransceiveEOF( (uint8_t*)&res, (uint8_t)sizeof(rfalNfcvGenericRes), &rcvLen );
+    }
 
     if( ret != ERR_NONE )
     {
@@ -699,7 +1173,7 @@ ReturnCode rfalNfcvPollerExtendedWriteMultipleBlocks( uint8_t flags, const uint8
     uint16_t           nBlocks;
 
     /* Calculate required buffer length */
-    reqLen = ((uid != NULL) ? (RFAL_NFCV_WR_MUL_REQ_HEADER_LEN + RFAL_NFCV_UID_LEN + wrDataLen) : (RFAL_NFCV_WR_MUL_REQ_HEADER_LEN + wrDataLen) );
+    reqLen = ((uid != NULL) ? (RFAL_NFCV_EXT_WR_MUL_REQ_HEADER_LEN + RFAL_NFCV_UID_LEN + wrDataLen) : (RFAL_NFCV_EXT_WR_MUL_REQ_HEADER_LEN + wrDataLen) );
   
     if( (reqLen > txBufLen) || (blockLen > (uint8_t)RFAL_NFCV_MAX_BLOCK_LEN) || (( (uint16_t)numOfBlocks * (uint16_t)blockLen) != wrDataLen) || (numOfBlocks == 0U) )
     {
@@ -737,7 +1211,13 @@ ReturnCode rfalNfcvPollerExtendedWriteMultipleBlocks( uint8_t flags, const uint8
     }
     
     /* Transceive Command */
-    ret = rfalTransceiveBlockingTxRx( txBuf, msgIt, (uint8_t*)&res, sizeof(rfalNfcvGenericRes), &rcvLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_FDT_POLL_MAX );
+    ret = rfalTransceiveBlockingTxRx( txBuf, msgIt, (uint8_t*)&res, sizeof(rfalNfcvGenericRes), &rcvLen, RFAL_TXRX_FLAGS_DEFAULT, rfalNfcvWriteTime( flags, numOfBlocks ) );
+    
+    /* If the Option Flag is set an EOF needs to be sent once the blocks are programmed to retrieve the VICC response  ISO15693-3 2009  10.4.3 */
+    if( (flags & (uint8_t)RFAL_NFCV_REQ_FLAG_OPTION) != 0U )
+    {
+        ret = rfalISO15693TransceiveEOF( (uint8_t*)&res, (uint8_t)sizeof(rfalNfcvGenericRes), &rcvLen );
+    }
 
     if( ret != ERR_NONE )
     {
@@ -779,6 +1259,7 @@ ReturnCode rfalNfcvPollerTransceiveReq( uint8_t cmd, uint8_t flags, uint8_t para
     uint8_t            msgIt;
     rfalBitRate        rxBR;
     bool               fastMode;
+    bool               isWrite;
     
     msgIt    = 0;
     fastMode = false;
@@ -834,13 +1315,16 @@ ReturnCode rfalNfcvPollerTransceiveReq( uint8_t cmd, uint8_t flags, uint8_t para
         msgIt += (uint8_t)dataLen;
     }
     
+    /* Commands programming the VICC memory wait its programming time */
+    isWrite = ( (cmd == (uint8_t)RFAL_NFCV_CMD_WRITE_SINGLE_BLOCK)          || (cmd == (uint8_t)RFAL_NFCV_CMD_WRITE_MULTIPLE_BLOCKS)        ||
+                (cmd == (uint8_t)RFAL_NFCV_CMD_LOCK_BLOCK)                  || (cmd == (uint8_t)RFAL_NFCV_CMD_EXTENDED_WRITE_SINGLE_BLOCK)  ||
+                (cmd == (uint8_t)RFAL_NFCV_CMD_EXTENDED_LOCK_SINGLE_BLOCK)  || (cmd == (uint8_t)RFAL_NFCV_CMD_EXTENDED_WRITE_MULTIPLE_BLOCK) );
+    
     /* Transceive Command */
-    ret = rfalTransceiveBlockingTxRx( (uint8_t*)&req, (RFAL_CMD_LEN + RFAL_NFCV_FLAG_LEN +(uint16_t)msgIt), rxBuf, rxBufLen, rcvLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_FDT_POLL_MAX );
+    ret = rfalTransceiveBlockingTxRx( (uint8_t*)&req, (RFAL_CMD_LEN + RFAL_NFCV_FLAG_LEN +(uint16_t)msgIt), rxBuf, rxBufLen, rcvLen, RFAL_TXRX_FLAGS_DEFAULT, (isWrite ? rfalNfcvWriteTime( flags, 1U ) : RFAL_FDT_POLL_MAX) );
     
-    /* If the Option Flag is set in certain commands an EOF needs to be sent after 20ms to retrieve the VICC response      ISO15693-3 2009  10.4.2 & 10.4.3 & 10.4.5 */
-    if( ((flags & (uint8_t)RFAL_NFCV_REQ_FLAG_OPTION) != 0U) && ((cmd == (uint8_t)RFAL_NFCV_CMD_WRITE_SINGLE_BLOCK) || (cmd == (uint8_t)RFAL_NFCV_CMD_WRITE_MULTIPLE_BLOCKS)        ||
-                                                        (cmd == (uint8_t)RFAL_NFCV_CMD_LOCK_BLOCK) || (cmd == (uint8_t)RFAL_NFCV_CMD_EXTENDED_WRITE_SINGLE_BLOCK)                   ||
-                                                        (cmd == (uint8_t)RFAL_NFCV_CMD_EXTENDED_LOCK_SINGLE_BLOCK) || (cmd == (uint8_t)RFAL_NFCV_CMD_EXTENDED_WRITE_MULTIPLE_BLOCK))  )
+    /* If the Option Flag is set in certain commands an EOF needs to be sent after the programming time (default 20ms) to retrieve the VICC response      ISO15693-3 2009  10.4.2 & 10.4.3 & 10.4.5 */
+    if( ((flags & (uint8_t)RFAL_NFCV_REQ_FLAG_OPTION) != 0U) && isWrite )
     {
         ret = rfalISO15693TransceiveEOF( rxBuf, (uint8_t)rxBufLen, rcvLen );
     }
@@ -141,9 +141,29 @@ typedef struct{
 } rfalConfigs;
 
 
-/*! Struct that holds NFC-F data - Used only inside rfalFelicaPoll() (static to avoid adding it into stack) */
+/*! Struct that holds NFC-A data - Used only inside rfalISO14443AStartTransceiveAnticollisionFrame() and rfalISO14443AGetTransceiveAnticollisionFrameStatus() */
+typedef struct{
+    uint8_t                 collByte;    /*!< NFC-A Anticollision collision byte                  */
+    uint8_t                 *buf;        /*!< NFC-A Anticollision frame buffer                    */
+    uint8_t                 *bytesToSend;/*!< NFC-A Anticollision NFCID|UID byte context          */
+    uint8_t                 *bitsToSend; /*!< NFC-A Anticollision NFCID|UID bit context           */
+} rfalNfcaWorkingData;
+
+
+/*! Struct that holds NFC-F data - Used only inside rfalStartFeliCaPoll() and rfalGetFeliCaPollStatus() */
 typedef struct{    
-    rfalFeliCaPollRes pollResponses[RFAL_FELICA_POLL_MAX_SLOTS];   /* FeliCa Poll response container for 16 slots */
+    rfalFeliCaPollRes  pollResponses[RFAL_FELICA_POLL_MAX_SLOTS];                 /* FeliCa Poll response container for 16 slots */
+    uint8_t            pollReq[RFAL_FELICA_POLL_REQ_LEN - RFAL_FELICA_LEN_LEN];   /* FeliCa Poll request (LEN added by ST25R3911) */
+    uint16_t           actLen;                                                    /* FeliCa Poll current response length          */
+    rfalEHandling      curHandling;                                               /* Error handling to be restored after the Poll */
+    uint8_t            nbSlots;                                                   /* Remaining slots to be received               */
+    uint8_t            devDetected;                                               /* Number of devices detected so far            */
+    uint8_t            colDetected;                                               /* Number of collisions detected so far         */
+    rfalFeliCaPollRes  *pollResList;                                              /* Caller's output list of responses            */
+    uint8_t            pollResListSize;                                           /* Caller's output list size                    */
+    uint8_t            *devicesDetected;                                          /* Caller's output number of devices            */
+    uint8_t            *collisionsDetected;                                       /* Caller's output number of collisions         */
+    uint16_t           pollRssi[RFAL_FELICA_POLL_MAX_SLOTS];                      /* RSSI of each response (0: not available)     */
 } rfalNfcfWorkingData;
 
 
@@ -165,6 +185,7 @@ typedef struct{
     uint16_t              nfcvOffset;                     /*!< Offset needed for ISO15693 coding function                            */
     rfalTransceiveContext origCtx;                        /*!< Context provided by user                                              */
     uint16_t              ignoreBits;                     /*!< Number of bits at the beginning of a frame to be ignored when decoding*/
+    uint8_t               eofTxBuf;                       /*!< Placeholder Tx buffer for the EOF (no payload is sent)                */
 } rfalNfcvWorkingData;
 
 
@@ -191,6 +212,10 @@ typedef struct{
     rfalWum                 wum;       /*!< RFAL's Wake-up mode management                */
 #endif /* RFAL_FEATURE_WAKEUP_MODE */
 
+#if RFAL_FEATURE_NFCA
+    rfalNfcaWorkingData     nfcaData; /*!< RFAL's working data when supporting NFC-A      */
+#endif /* RFAL_FEATURE_NFCA */
+    
 #if RFAL_FEATURE_NFCF
     rfalNfcfWorkingData     nfcfData; /*!< RFAL's working data when supporting NFC-F      */
 #endif /* RFAL_FEATURE_NFCF */
@@ -2475,6 +2500,23 @@ static uint8_t rfalFIFOGetNumIncompleteBits( void )
 ReturnCode rfalISO14443ATransceiveShortFrame( rfal14443AShortFrameCmd txCmd, uint8_t* rxBuf, uint8_t rxBufLen, uint16_t* rxRcvdLen, uint32_t fwt )
 {
     ReturnCode ret;
+    
+    EXIT_ON_ERR( ret, rfalISO14443AStartTransceiveShortFrame( txCmd, rxBuf, rxBufLen, rxRcvdLen, fwt ) );
+    
+    /* Execute Transceive Rx blocking */
+    do{
+        rfalWorker();
+        ret = rfalISO14443AGetTransceiveShortFrameStatus();
+    }
+    while( ret == ERR_BUSY );
+    
+    return ret;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalISO14443AStartTransceiveShortFrame( rfal14443AShortFrameCmd txCmd, uint8_t* rxBuf, uint8_t rxBufLen, uint16_t* rxRcvdLen, uint32_t fwt )
+{
     uint8_t    directCmd;
 
     /* Check if RFAL is properly initialized */
@@ -2515,7 +2557,8 @@ ReturnCode rfalISO14443ATransceiveShortFrame( rfal14443AShortFrameCmd txCmd, uin
     
     
     /*******************************************************************************/
-    /* Wait for GT and FDT */
+    /* Wait for GT and FDT                                                         */
+    /* A non-blocking caller should only start once rfalIsGTExpired() reports true */
     while( !rfalIsGTExpired() )      { /* MISRA 15.6: mandatory brackets */ };
     while( st25r3911IsGPTRunning() ) { /* MISRA 15.6: mandatory brackets */ };
     
@@ -2563,45 +2606,74 @@ ReturnCode rfalISO14443ATransceiveShortFrame( rfal14443AShortFrameCmd txCmd, uin
     /* Send either WUPA or REQA. All affected tags will backscatter ATQA and change to READY state */
     st25r3911ExecuteCommand( directCmd );
     
-    /* Wait for TXE */
+    /* Wait for TXE (short frame is only a few bit durations long) */
     if( st25r3911WaitForInterruptsTimed( ST25R3911_IRQ_MASK_TXE, (uint16_t)MAX( rfalConv1fcToMs( fwt ), RFAL_ST25R3911_SW_TMR_MIN_1MS ) ) == 0U)
     {
-        ret = ERR_IO;
+        /* Disable Collision interrupt, anti collision and ReEnable CRC on Rx */
+        st25r3911DisableInterrupts( (ST25R3911_IRQ_MASK_COL) );
+        st25r3911ClrRegisterBits( ST25R3911_REG_ISO14443A_NFC, ST25R3911_REG_ISO14443A_NFC_antcl );
+        st25r3911ClrRegisterBits( ST25R3911_REG_AUX, ST25R3911_REG_AUX_no_crc_rx );
+        
+        return ERR_IO;
     }
-    else
+    
+    /*Check if Observation Mode is enabled and set it on ST25R391x */
+    rfalCheckEnableObsModeRx();
+    
+    /* Jump into a transceive Rx state for reception (bypass Tx states) */
+    gRFAL.state       = RFAL_STATE_TXRX;
+    gRFAL.TxRx.state  = RFAL_TXRX_STATE_RX_IDLE;
+    gRFAL.TxRx.status = ERR_BUSY;
+    
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalISO14443AGetTransceiveShortFrameStatus( void )
+{
+    ReturnCode ret;
+    
+    ret = rfalGetTransceiveStatus();
+    if( ret != ERR_BUSY )
     {
-        /*Check if Observation Mode is enabled and set it on ST25R391x */
-        rfalCheckEnableObsModeRx();
+        /* Disable Collision interrupt */
+        st25r3911DisableInterrupts( (ST25R3911_IRQ_MASK_COL) );
         
-        /* Jump into a transceive Rx state for reception (bypass Tx states) */
-        gRFAL.state       = RFAL_STATE_TXRX;
-        gRFAL.TxRx.state  = RFAL_TXRX_STATE_RX_IDLE;
-        gRFAL.TxRx.status = ERR_BUSY;
+        /* Disable anti collision again */
+        st25r3911ClrRegisterBits( ST25R3911_REG_ISO14443A_NFC, ST25R3911_REG_ISO14443A_NFC_antcl );
         
-        /* Execute Transceive Rx blocking */
-        ret = rfalTransceiveBlockingRx();
+        /* ReEnable CRC on Rx */
+        st25r3911ClrRegisterBits(ST25R3911_REG_AUX, ST25R3911_REG_AUX_no_crc_rx );
     }
     
+    return ret;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalISO14443ATransceiveAnticollisionFrame( uint8_t *buf, uint8_t *bytesToSend, uint8_t *bitsToSend, uint16_t *rxLength, uint32_t fwt )
+{
+    ReturnCode ret;
     
-    /* Disable Collision interrupt */
-    st25r3911DisableInterrupts( (ST25R3911_IRQ_MASK_COL) );
-    
-    /* Disable anti collision again */
-    st25r3911ClrRegisterBits( ST25R3911_REG_ISO14443A_NFC, ST25R3911_REG_ISO14443A_NFC_antcl );
+    EXIT_ON_ERR( ret, rfalISO14443AStartTransceiveAnticollisionFrame( buf, bytesToSend, bitsToSend, rxLength, fwt ) );
     
-    /* ReEnable CRC on Rx */
-    st25r3911ClrRegisterBits(ST25R3911_REG_AUX, ST25R3911_REG_AUX_no_crc_rx );
+    /*******************************************************************************/
+    /* Run Transceive blocking */
+    do{
+        rfalWorker();
+        ret = rfalISO14443AGetTransceiveAnticollisionFrameStatus();
+    }
+    while( ret == ERR_BUSY );
     
     return ret;
 }
 
+
 /*******************************************************************************/
-ReturnCode rfalISO14443ATransceiveAnticollisionFrame( uint8_t *buf, uint8_t *bytesToSend, uint8_t *bitsToSend, uint16_t *rxLength, uint32_t fwt )
+ReturnCode rfalISO14443AStartTransceiveAnticollisionFrame( uint8_t *buf, uint8_t *bytesToSend, uint8_t *bitsToSend, uint16_t *rxLength, uint32_t fwt )
 {
-    ReturnCode            ret;
     rfalTransceiveContext ctx;
-    uint8_t               collByte;
-    uint8_t               collData;
     
     /* Check if RFAL is properly initialized */
     if( (gRFAL.state < RFAL_STATE_MODE_SET) || ( gRFAL.mode != RFAL_MODE_POLL_NFCA ) )
@@ -2646,44 +2718,60 @@ ReturnCode rfalISO14443ATransceiveAnticollisionFrame( uint8_t *buf, uint8_t *byt
     st25r3911EnableInterrupts( ST25R3911_IRQ_MASK_COL );
     
     /*******************************************************************************/
-    collByte = 0;
+    gRFAL.nfcaData.collByte    = 0;
+    gRFAL.nfcaData.buf         = buf;
+    gRFAL.nfcaData.bytesToSend = bytesToSend;
+    gRFAL.nfcaData.bitsToSend  = bitsToSend;
     
     /* save the collision byte */
     if ((*bitsToSend) > 0U)
     {
         buf[(*bytesToSend)] <<= (RFAL_BITS_IN_BYTE - (*bitsToSend));
         buf[(*bytesToSend)] >>= (RFAL_BITS_IN_BYTE - (*bitsToSend));
-        collByte = buf[(*bytesToSend)];
+        gRFAL.nfcaData.collByte = buf[(*bytesToSend)];
+    }
+    
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalISO14443AGetTransceiveAnticollisionFrameStatus( void )
+{
+    ReturnCode ret;
+    uint8_t    collData;
+    uint8_t    *buf;
+    uint8_t    *bytesToSend;
+    uint8_t    *bitsToSend;
+    
+    ret = rfalGetTransceiveStatus();
+    if( ret == ERR_BUSY )
+    {
+        return ret;
     }
     
+    buf         = gRFAL.nfcaData.buf;
+    bytesToSend = gRFAL.nfcaData.bytesToSend;
+    bitsToSend  = gRFAL.nfcaData.bitsToSend;
     
     /*******************************************************************************/
-    /* Run Transceive blocking */
-    ret = rfalTransceiveRunBlockingTx();
-    if( ret == ERR_NONE)
+    if ((*bitsToSend) > 0U)
     {
-       ret = rfalTransceiveBlockingRx();
+        buf[(*bytesToSend)] >>= (*bitsToSend);
+        buf[(*bytesToSend)] <<= (*bitsToSend);
+        buf[(*bytesToSend)] |= gRFAL.nfcaData.collByte;
+    }
     
-       /*******************************************************************************/
-       if ((*bitsToSend) > 0U)
-       {
-           buf[(*bytesToSend)] >>= (*bitsToSend);
-           buf[(*bytesToSend)] <<= (*bitsToSend);
-           buf[(*bytesToSend)] |= collByte;
-       }
-       
-       if( (ERR_RF_COLLISION == ret) )
-       {
-           /* read out collision register */
-           st25r3911ReadRegister( ST25R3911_REG_COLLISION_STATUS, &collData);
-
-           (*bytesToSend) = ((collData >> ST25R3911_REG_COLLISION_STATUS_shift_c_byte) & 0x0FU); // 4-bits Byte information
-           (*bitsToSend)  = ((collData >> ST25R3911_REG_COLLISION_STATUS_shift_c_bit)  & 0x07U); // 3-bits bit information
+    if( (ERR_RF_COLLISION == ret) )
+    {
+        /* read out collision register */
+        st25r3911ReadRegister( ST25R3911_REG_COLLISION_STATUS, &collData);
 
-       }
+        (*bytesToSend) = ((collData >> ST25R3911_REG_COLLISION_STATUS_shift_c_byte) & 0x0FU); // 4-bits Byte information
+        (*bitsToSend)  = ((collData >> ST25R3911_REG_COLLISION_STATUS_shift_c_bit)  & 0x07U); // 3-bits bit information
     }
     
-   
+    
     /*******************************************************************************/
     /* Disable Collision interrupt */
     st25r3911DisableInterrupts( (ST25R3911_IRQ_MASK_COL) );
@@ -2710,7 +2798,25 @@ ReturnCode rfalISO14443ATransceiveAnticollisionFrame( uint8_t *buf, uint8_t *byt
 /*******************************************************************************/
 ReturnCode rfalISO15693TransceiveAnticollisionFrame( uint8_t *txBuf, uint8_t txBufLen, uint8_t *rxBuf, uint8_t rxBufLen, uint16_t *actLen )
 {
-    ReturnCode            ret;
+    ReturnCode ret;
+    
+    EXIT_ON_ERR( ret, rfalISO15693StartTransceiveAnticollisionFrame( txBuf, txBufLen, rxBuf, rxBufLen, actLen ) );
+    
+    /*******************************************************************************/
+    /* Run Transceive blocking */
+    do{
+        rfalWorker();
+        ret = rfalISO15693GetTransceiveAnticollisionFrameStatus();
+    }
+    while( ret == ERR_BUSY );
+    
+    return ret;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalISO15693StartTransceiveAnticollisionFrame( uint8_t *txBuf, uint8_t txBufLen, uint8_t *rxBuf, uint8_t rxBufLen, uint16_t *actLen )
+{
     rfalTransceiveContext ctx;
     
     /* Check if RFAL is properly initialized */
@@ -2739,12 +2845,19 @@ ReturnCode rfalISO15693TransceiveAnticollisionFrame( uint8_t *txBuf, uint8_t txB
     
     rfalStartTransceive( &ctx );
     
-    /*******************************************************************************/
-    /* Run Transceive blocking */
-    ret = rfalTransceiveRunBlockingTx();
-    if( ret == ERR_NONE)
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalISO15693GetTransceiveAnticollisionFrameStatus( void )
+{
+    ReturnCode ret;
+    
+    ret = rfalGetTransceiveStatus();
+    if( ret == ERR_BUSY )
     {
-        ret = rfalTransceiveBlockingRx();
+        return ret;
     }
     
     /* Restore common Analog configurations for this mode */
@@ -2755,14 +2868,21 @@ ReturnCode rfalISO15693TransceiveAnticollisionFrame( uint8_t *txBuf, uint8_t txB
     return ret;
 }
 
+
 /*******************************************************************************/
 ReturnCode rfalISO15693TransceiveEOFAnticollision( uint8_t *rxBuf, uint8_t rxBufLen, uint16_t *actLen )
 {
-    uint8_t dummy;
+    return rfalISO15693TransceiveAnticollisionFrame( &gRFAL.nfcvData.eofTxBuf, 0, rxBuf, rxBufLen, actLen );
+}
 
-    return rfalISO15693TransceiveAnticollisionFrame( &dummy, 0, rxBuf, rxBufLen, actLen );
+
+/*******************************************************************************/
+ReturnCode rfalISO15693StartTransceiveEOFAnticollision( uint8_t *rxBuf, uint8_t rxBufLen, uint16_t *actLen )
+{
+    return rfalISO15693StartTransceiveAnticollisionFrame( &gRFAL.nfcvData.eofTxBuf, 0, rxBuf, rxBufLen, actLen );
 }
 
+
 /*******************************************************************************/
 ReturnCode rfalISO15693TransceiveEOF( uint8_t *rxBuf, uint8_t rxBufLen, uint16_t *actLen )
 {
@@ -2794,123 +2914,182 @@ ReturnCode rfalISO15693TransceiveEOF( uint8_t *rxBuf, uint8_t rxBufLen, uint16_t
 /*******************************************************************************/
 ReturnCode rfalFeliCaPoll( rfalFeliCaPollSlots slots, uint16_t sysCode, uint8_t reqCode, rfalFeliCaPollRes* pollResList, uint8_t pollResListSize, uint8_t *devicesDetected, uint8_t *collisionsDetected )
 {
-    ReturnCode        ret;
-    uint8_t           frame[RFAL_FELICA_POLL_REQ_LEN - RFAL_FELICA_LEN_LEN];  // LEN is added by ST25R3911 automatically
-    uint16_t          actLen;
-    uint8_t           frameIdx;
-    uint8_t           devDetected;
-    uint8_t           colDetected;
-    rfalEHandling     curHandling;
-    uint8_t           nbSlots;
-        
+    ReturnCode ret;
+    
+    EXIT_ON_ERR( ret, rfalStartFeliCaPoll( slots, sysCode, reqCode, pollResList, pollResListSize, devicesDetected, collisionsDetected ) );
+    
+    /*******************************************************************************/
+    /* Run Poll blocking, wait for all responses/slots                             */
+    do{
+        rfalWorker();
+        ret = rfalGetFeliCaPollStatus();
+    }
+    while( ret == ERR_BUSY );
+    
+    return ret;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalStartFeliCaPoll( rfalFeliCaPollSlots slots, uint16_t sysCode, uint8_t reqCode, rfalFeliCaPollRes* pollResList, uint8_t pollResListSize, uint8_t *devicesDetected, uint8_t *collisionsDetected )
+{
+    ReturnCode            ret;
+    rfalTransceiveContext ctx;
+    uint8_t               frameIdx;
+    
     /* Check if RFAL is properly initialized */
     if( (gRFAL.state < RFAL_STATE_MODE_SET) || ( gRFAL.mode != RFAL_MODE_POLL_NFCF ) )
     {
         return ERR_WRONG_STATE;
     }
     
-    frameIdx    = 0;
-    colDetected = 0;
-    devDetected = 0;
-    nbSlots     = (uint8_t)slots;
+    frameIdx                          = 0;
+    gRFAL.nfcfData.colDetected        = 0;
+    gRFAL.nfcfData.devDetected        = 0;
+    gRFAL.nfcfData.nbSlots            = (uint8_t)slots;
+    gRFAL.nfcfData.pollResList        = pollResList;
+    gRFAL.nfcfData.pollResListSize    = pollResListSize;
+    gRFAL.nfcfData.devicesDetected    = devicesDetected;
+    gRFAL.nfcfData.collisionsDetected = collisionsDetected;
     
     /*******************************************************************************/
     /* Compute SENSF_REQ frame */
-    frame[frameIdx++] = (uint8_t)FELICA_CMD_POLLING; /* CMD: SENF_REQ                       */
-    frame[frameIdx++] = (uint8_t)(sysCode >> 8);     /* System Code (SC)                    */
-    frame[frameIdx++] = (uint8_t)(sysCode & 0xFFU);  /* System Code (SC)                    */
-    frame[frameIdx++] = reqCode;                     /* Communication Parameter Request (RC)*/
-    frame[frameIdx++] = nbSlots;                     /* TimeSlot (TSN)                      */
+    gRFAL.nfcfData.pollReq[frameIdx++] = (uint8_t)FELICA_CMD_POLLING; /* CMD: SENF_REQ                       */
+    gRFAL.nfcfData.pollReq[frameIdx++] = (uint8_t)(sysCode >> 8);     /* System Code (SC)                    */
+    gRFAL.nfcfData.pollReq[frameIdx++] = (uint8_t)(sysCode & 0xFFU);  /* System Code (SC)                    */
+    gRFAL.nfcfData.pollReq[frameIdx++] = reqCode;                     /* Communication Parameter Request (RC)*/
+    gRFAL.nfcfData.pollReq[frameIdx++] = (uint8_t)slots;              /* TimeSlot (TSN)                      */
     
     
     /*******************************************************************************/
     /* NRT should not stop on reception - Use EMVCo mode to run NRT in nrt_emv     *
      * ERRORHANDLING_EMVCO has no special handling for NFC-F mode                  */
-    curHandling = gRFAL.conf.eHandling;
+    gRFAL.nfcfData.curHandling = gRFAL.conf.eHandling;
     rfalSetErrorHandling( RFAL_ERRORHANDLING_EMVCO );
     
     /*******************************************************************************/
-    /* Run transceive blocking, 
+    /* Start transceive, 
      * Calculate Total Response Time in(64/fc): 
      *                       512 PICC process time + (n * 256 Time Slot duration)  */
-    ret = rfalTransceiveBlockingTx( frame, 
-                                    (uint16_t)frameIdx, 
-                                    (uint8_t*)gRFAL.nfcfData.pollResponses, 
+    rfalCreateByteFlagsTxRxContext( ctx, 
+                                    gRFAL.nfcfData.pollReq, 
+                                    frameIdx, 
+                                    gRFAL.nfcfData.pollResponses, 
                                     RFAL_FELICA_POLL_RES_LEN, 
-                                    &actLen,
-                                    (RFAL_TXRX_FLAGS_DEFAULT),
-                                    rfalConv64fcTo1fc( RFAL_FELICA_POLL_DELAY_TIME + (RFAL_FELICA_POLL_SLOT_TIME * ((uint32_t)nbSlots + 1U)) ) );
+                                    &gRFAL.nfcfData.actLen, 
+                                    RFAL_TXRX_FLAGS_DEFAULT, 
+                                    rfalConv64fcTo1fc( RFAL_FELICA_POLL_DELAY_TIME + (RFAL_FELICA_POLL_SLOT_TIME * ((uint32_t)gRFAL.nfcfData.nbSlots + 1U)) ) );
     
-    /*******************************************************************************/
-    /* If Tx OK, Wait for all responses, store them as soon as they appear         */
-    if( ret == ERR_NONE )
+    ret = rfalStartTransceive( &ctx );
+    if( ret != ERR_NONE )
     {
-        bool timeout;
+        /* Restore previous error handling */
+        rfalSetErrorHandling( gRFAL.nfcfData.curHandling );
+    }
+    
+    return ret;
+}
+
 
-        do 
+/*******************************************************************************/
+ReturnCode rfalGetFeliCaPollStatus( void )
+{
+    ReturnCode ret;
+    bool       timeout;
+    
+    /* Check whether the Poll Request or the current slot reception is still ongoing */
+    ret = rfalGetTransceiveStatus();
+    if( ret == ERR_BUSY )
+    {
+        return ERR_BUSY;
+    }
+    
+    /*******************************************************************************/
+    /* Store the responses as soon as they appear                                  */
+    if( ret == ERR_TIMEOUT )
+    {
+        /* Upon timeout the full Poll Delay + (Slot time)*(nbSlots) has expired */
+        timeout = true;
+    }
+    else
+    {
+        /* Keep the RSSI of this response before the next slot is received */
+        if( (ret == ERR_NONE) && (gRFAL.nfcfData.devDetected < RFAL_FELICA_POLL_MAX_SLOTS) )
         {
-            ret = rfalTransceiveBlockingRx();
-            if( ret == ERR_TIMEOUT )
-            {
-                /* Upon timeout the full Poll Delay + (Slot time)*(nbSlots) has expired */
-                timeout = true;
-            }
-            else
-            {
-                /* Reception done, reEnabled Rx for following Slot */
-                st25r3911ExecuteCommand( ST25R3911_CMD_UNMASK_RECEIVE_DATA );
-                st25r3911ExecuteCommand( ST25R3911_CMD_CLEAR_SQUELCH );
-                
-                /* If the reception was OK, new device found */
-                if( ret == ERR_NONE )
-                {
-                   devDetected++;
-                   
-                   /* Overwrite the Transceive context for the next reception */
-                   gRFAL.TxRx.ctx.rxBuf = (uint8_t*)gRFAL.nfcfData.pollResponses[devDetected];
-                }
-                /* If the reception was not OK, mark as collision */
-                else
-                {
-                    colDetected++;
-                }
-                
-                /* Check whether NRT has expired meanwhile  */
-                timeout = st25r3911CheckReg( ST25R3911_REG_REGULATOR_RESULT, ST25R3911_REG_REGULATOR_RESULT_nrt_on, 0x00 );
-                if( !timeout )
-                {
-                    /* Jump again into transceive Rx state for the following reception */
-                    gRFAL.TxRx.status = ERR_BUSY;
-                    gRFAL.state       = RFAL_STATE_TXRX;
-                    gRFAL.TxRx.state  = RFAL_TXRX_STATE_RX_IDLE;
-                }
-            }
-        }while( ((nbSlots--) != 0U) && !timeout );
+            (void)rfalGetTransceiveRSSI( &gRFAL.nfcfData.pollRssi[gRFAL.nfcfData.devDetected] );
+        }
+        
+        /* Reception done, reEnabled Rx for following Slot */
+        st25r3911ExecuteCommand( ST25R3911_CMD_UNMASK_RECEIVE_DATA );
+        st25r3911ExecuteCommand( ST25R3911_CMD_CLEAR_SQUELCH );
+        
+        /* If the reception was OK, new device found */
+        if( ret == ERR_NONE )
+        {
+           gRFAL.nfcfData.devDetected++;
+           
+           /* Overwrite the Transceive context for the next reception */
+           gRFAL.TxRx.ctx.rxBuf = (uint8_t*)gRFAL.nfcfData.pollResponses[gRFAL.nfcfData.devDetected];
+        }
+        /* If the reception was not OK, mark as collision */
+        else
+        {
+            gRFAL.nfcfData.colDetected++;
+        }
+        
+        /* Check whether NRT has expired meanwhile  */
+        timeout = st25r3911CheckReg( ST25R3911_REG_REGULATOR_RESULT, ST25R3911_REG_REGULATOR_RESULT_nrt_on, 0x00 );
+        if( !timeout )
+        {
+            /* Jump again into transceive Rx state for the following reception */
+            gRFAL.TxRx.status = ERR_BUSY;
+            gRFAL.state       = RFAL_STATE_TXRX;
+            gRFAL.TxRx.state  = RFAL_TXRX_STATE_RX_IDLE;
+        }
+    }
+    
+    /* Keep waiting while there are slots left */
+    if( ((gRFAL.nfcfData.nbSlots--) != 0U) && !timeout )
+    {
+        return ERR_BUSY;
     }
     
     /*******************************************************************************/
     /* Restore NRT to normal mode - back to previous error handling */
-    rfalSetErrorHandling( curHandling );
+    rfalSetErrorHandling( gRFAL.nfcfData.curHandling );
     
     /*******************************************************************************/
     /* Assign output parameters if requested                                       */
     
-    if( (pollResList != NULL) && (pollResListSize > 0U) && (devDetected > 0U) )
+    if( (gRFAL.nfcfData.pollResList != NULL) && (gRFAL.nfcfData.pollResListSize > 0U) && (gRFAL.nfcfData.devDetected > 0U) )
     {
-        ST_MEMCPY( pollResList, gRFAL.nfcfData.pollResponses, (RFAL_FELICA_POLL_RES_LEN * (uint32_t)MIN(pollResListSize, devDetected) ) );
+        ST_MEMCPY( gRFAL.nfcfData.pollResList, gRFAL.nfcfData.pollResponses, (RFAL_FELICA_POLL_RES_LEN * (uint32_t)MIN(gRFAL.nfcfData.pollResListSize, gRFAL.nfcfData.devDetected) ) );
     }
     
-    if( devicesDetected != NULL )
+    if( gRFAL.nfcfData.devicesDetected != NULL )
     {
-        *devicesDetected = devDetected;
+        *gRFAL.nfcfData.devicesDetected = gRFAL.nfcfData.devDetected;
     }
     
-    if( collisionsDetected != NULL )
+    if( gRFAL.nfcfData.collisionsDetected != NULL )
     {
-        *collisionsDetected = colDetected;
+        *gRFAL.nfcfData.collisionsDetected = gRFAL.nfcfData.colDetected;
     }
     
-    return (( (colDetected != 0U) || (devDetected != 0U)) ? ERR_NONE : ret);
+    return (( (gRFAL.nfcfData.colDetected != 0U) || (gRFAL.nfcfData.devDetected != 0U)) ? ERR_NONE : ret);
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalGetFeliCaPollRSSI( uint8_t resIdx, uint16_t *rssi )
+{
+    if( (rssi == NULL) || (resIdx >= MIN( gRFAL.nfcfData.devDetected, RFAL_FELICA_POLL_MAX_SLOTS )) )
+    {
+        return ERR_PARAM;
+    }
+    
+    *rssi = gRFAL.nfcfData.pollRssi[resIdx];
+    return ERR_NONE;
 }
 
 #endif /* RFAL_FEATURE_NFCF */
@@ -0,0 +1,464 @@
+
+/******************************************************************************
+  * \attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2019 STMicroelectronics</center></h2>
+  *
+  * Licensed under ST MYLIBERTY SOFTWARE LICENSE AGREEMENT (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        www.st.com/myliberty
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied,
+  * AND SPECIFICALLY DISCLAIMING THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+******************************************************************************/
+
+/*
+ *      PROJECT:   ST25R391x firmware
+ *      Revision:
+ *      LANGUAGE:  ISO C99
+ */
+
+/*! \file rfal_snep.c
+ *
+ *  \author
+ *
+ *  \brief Implementation of the NFC Forum Simple NDEF Exchange Protocol (SNEP)
+ *
+ *  This implementation was based on the following specs:
+ *    - NFC Forum Simple NDEF Exchange Protocol 1.0  2011-08-31
+ *
+ */
+
+/*
+ ******************************************************************************
+ * INCLUDES
+ ******************************************************************************
+ */
+#include "rfal_snep.h"
+#include "utils.h"
+
+/*
+ ******************************************************************************
+ * ENABLE SWITCH
+ ******************************************************************************
+ */
+
+#ifndef RFAL_FEATURE_LLCP
+    #define RFAL_FEATURE_LLCP   false    /* LLCP module configuration missing. Disabled by default */
+#endif
+
+#if RFAL_FEATURE_LLCP
+
+/*
+ ******************************************************************************
+ * GLOBAL DEFINES
+ ******************************************************************************
+ */
+
+#define SNEP_VERSION_MAJOR_SHIFT    4U           /*!< Major version position on the Version field           */
+#define SNEP_HDR_VERSION_POS        0U           /*!< Version field position on the header                  */
+#define SNEP_HDR_CODE_POS           1U           /*!< Request/Response field position on the header         */
+#define SNEP_HDR_LEN_POS            2U           /*!< Length field position on the header                   */
+#define SNEP_HDR_POS                RFAL_SNEP_ACCEPT_LEN_LEN /*!< Header position on the prologue, but for a Get request */
+
+/*
+ ******************************************************************************
+ * GLOBAL MACROS
+ ******************************************************************************
+ */
+
+#define snepIsVersionOk( hdr )      ( ((hdr)[SNEP_HDR_VERSION_POS] >> SNEP_VERSION_MAJOR_SHIFT) == (RFAL_SNEP_VERSION >> SNEP_VERSION_MAJOR_SHIFT) ) /*!< SNEP 1.0  5.1  Major version must match */
+#define snepHdr( buf )              (&(buf)->prologue[SNEP_HDR_POS])                                                           /*!< Header of Put requests, responses and received messages  */
+#define snepClientMsg( snep )       (((snep)->rspLen != NULL) ? (snep)->buf->prologue : snepHdr( (snep)->buf ))                /*!< Client request: Get takes the whole prologue             */
+
+/*
+ ******************************************************************************
+ * LOCAL FUNCTION PROTOTYPES
+ ******************************************************************************
+ */
+static void snepPutU32( uint8_t *p, uint32_t val );
+static void snepSetHeader( uint8_t *hdr, uint8_t code, uint32_t len );
+static void snepSendHeader( rfalSnep *snep, uint8_t code );
+static ReturnCode snepClientStart( rfalSnep *snep, rfalLlcpLink *link, rfalSnepBufFormat *buf );
+static ReturnCode snepClientDone( rfalSnep *snep, ReturnCode ret );
+
+/*
+ ******************************************************************************
+ * LOCAL FUNCTIONS
+ ******************************************************************************
+ */
+
+/*******************************************************************************/
+static void snepPutU32( uint8_t *p, uint32_t val )
+{
+    p[0] = (uint8_t)(val >> 24U);
+    p[1] = (uint8_t)(val >> 16U);
+    p[2] = (uint8_t)(val >> 8U);
+    p[3] = (uint8_t)val;
+}
+
+
+/*******************************************************************************/
+static void snepSetHeader( uint8_t *hdr, uint8_t code, uint32_t len )
+{
+    hdr[SNEP_HDR_VERSION_POS] = RFAL_SNEP_VERSION;
+    hdr[SNEP_HDR_CODE_POS]    = code;
+    snepPutU32( &hdr[SNEP_HDR_LEN_POS], len );
+}
+
+
+/*******************************************************************************/
+static void snepSendHeader( rfalSnep *snep, uint8_t code )
+{
+    /* Caller ensures the previous message has been placed on I-PDUs */
+    snepSetHeader( snep->hdr, code, 0U );
+    rfalLlcpSend( &snep->conn, snep->hdr, RFAL_SNEP_HEADER_LEN );
+}
+
+
+/*******************************************************************************/
+static ReturnCode snepClientStart( rfalSnep *snep, rfalLlcpLink *link, rfalSnepBufFormat *buf )
+{
+    ReturnCode ret;
+
+    /* SNEP 1.0  2.1  Client connects to the default server by its Service Name  *
+     * Responses are received after the request has been sent, over its header  */
+    EXIT_ON_ERR( ret, rfalLlcpConnect( link, &snep->conn, RFAL_LLCP_SAP_SNEP, (const uint8_t*)RFAL_SNEP_SN, (uint8_t)(sizeof(RFAL_SNEP_SN) - 1U), snepHdr( buf ), (uint16_t)(sizeof(rfalSnepBufFormat) - SNEP_HDR_POS) ) );
+
+    snep->buf            = buf;
+    snep->isContinueSent = false;
+    snep->state          = RFAL_SNEP_ST_CONNECT;
+
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+static ReturnCode snepClientDone( rfalSnep *snep, ReturnCode ret )
+{
+    snep->conn.rxLen = 0;
+    rfalLlcpDisconnect( &snep->conn );
+    snep->state = RFAL_SNEP_ST_IDLE;
+    return ret;
+}
+
+
+/*
+ ******************************************************************************
+ * GLOBAL FUNCTIONS
+ ******************************************************************************
+ */
+
+/*******************************************************************************/
+ReturnCode rfalSnepClientPut( rfalSnep *snep, rfalLlcpLink *link, rfalSnepBufFormat *buf, uint16_t ndefLen )
+{
+    ReturnCode ret;
+
+    if( (snep == NULL) || (buf == NULL) || (ndefLen > RFAL_FEATURE_SNEP_NDEF_MAX_LEN) )
+    {
+        return ERR_PARAM;
+    }
+
+    EXIT_ON_ERR( ret, snepClientStart( snep, link, buf ) );
+
+    snepSetHeader( snepHdr( buf ), RFAL_SNEP_REQ_PUT, ndefLen );
+
+    snep->rspLen = NULL;
+    snep->msgLen = (RFAL_SNEP_HEADER_LEN + ndefLen);
+
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalSnepClientGet( rfalSnep *snep, rfalLlcpLink *link, rfalSnepBufFormat *buf, uint16_t reqLen, uint16_t *rspLen )
+{
+    ReturnCode ret;
+
+    if( (snep == NULL) || (buf == NULL) || (rspLen == NULL) || (reqLen > RFAL_FEATURE_SNEP_NDEF_MAX_LEN) )
+    {
+        return ERR_PARAM;
+    }
+
+    EXIT_ON_ERR( ret, snepClientStart( snep, link, buf ) );
+
+    /* SNEP 1.0  3.1.2  Get: Acceptable Length followed by the request NDEF message */
+    snepSetHeader( buf->prologue, RFAL_SNEP_REQ_GET, (RFAL_SNEP_ACCEPT_LEN_LEN + (uint32_t)reqLen) );
+    snepPutU32( &buf->prologue[RFAL_SNEP_HEADER_LEN], RFAL_FEATURE_SNEP_NDEF_MAX_LEN );
+
+    snep->rspLen = rspLen;
+    snep->msgLen = (RFAL_SNEP_HEADER_LEN + RFAL_SNEP_ACCEPT_LEN_LEN + reqLen);
+
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalSnepClientGetStatus( rfalSnep *snep )
+{
+    const uint8_t *rsp;
+    uint32_t      len;
+    uint16_t      fragLen;
+
+    switch( snep->state )
+    {
+        /*******************************************************************************/
+        case RFAL_SNEP_ST_CONNECT:
+            if( snep->conn.state == RFAL_LLCP_CONN_ST_CONNECTED )
+            {
+                /* SNEP 1.0  4.1  Send what fits the remote MIU and wait for Continue if more remains */
+                fragLen = MIN( snep->msgLen, snep->conn.rMiu );
+                rfalLlcpSend( &snep->conn, snepClientMsg( snep ), fragLen );
+
+                snep->state = ((fragLen < snep->msgLen) ? RFAL_SNEP_ST_WAIT_CONTINUE : RFAL_SNEP_ST_WAIT_RESPONSE);
+                return ERR_BUSY;
+            }
+
+            if( snep->conn.state < RFAL_LLCP_CONN_ST_CONNECT )
+            {
+                snep->state = RFAL_SNEP_ST_IDLE;
+                return ERR_REQUEST;                                  /* Server not available */
+            }
+            return ERR_BUSY;
+
+        /*******************************************************************************/
+        case RFAL_SNEP_ST_WAIT_CONTINUE:
+        case RFAL_SNEP_ST_WAIT_RESPONSE:
+            if( snep->conn.state != RFAL_LLCP_CONN_ST_CONNECTED )
+            {
+                snep->state = RFAL_SNEP_ST_IDLE;
+                return ERR_PROTO;
+            }
+
+            if( snep->conn.rxLen < RFAL_SNEP_HEADER_LEN )
+            {
+                return ERR_BUSY;
+            }
+
+            rsp = snepHdr( snep->buf );
+            if( !snepIsVersionOk( rsp ) )
+            {
+                return snepClientDone( snep, ERR_PROTO );
+            }
+
+            if( snep->state == RFAL_SNEP_ST_WAIT_CONTINUE )
+            {
+                snep->conn.rxLen = 0;
+                if( rsp[SNEP_HDR_CODE_POS] != RFAL_SNEP_RSP_CONTINUE )
+                {
+                    return snepClientDone( snep, ERR_REQUEST );      /* Reject or error, do not send the rest */
+                }
+
+                /* Stream the remaining fragments, I-PDUs go out as the receive window allows.  *
+                 * The first fragment (at least one MIU) is gone, the response only overlaps it  */
+                fragLen = snep->conn.txLen;
+                rfalLlcpSend( &snep->conn, &snepClientMsg( snep )[fragLen], (snep->msgLen - fragLen) );
+
+                snep->state = RFAL_SNEP_ST_WAIT_RESPONSE;
+                return ERR_BUSY;
+            }
+
+            if( (rsp[SNEP_HDR_CODE_POS] == RFAL_SNEP_RSP_SUCCESS) && (snep->rspLen != NULL) )
+            {
+                len = GETU32( &rsp[SNEP_HDR_LEN_POS] );
+                if( len > RFAL_FEATURE_SNEP_NDEF_MAX_LEN )
+                {
+                    return snepClientDone( snep, ERR_PROTO );        /* Beyond the Acceptable Length */
+                }
+
+                /* SNEP 1.0  4.2  Get response fragmented, ask for the rest */
+                if( snep->conn.rxLen < (RFAL_SNEP_HEADER_LEN + len) )
+                {
+                    if( !snep->isContinueSent )
+                    {
+                        snep->isContinueSent = true;
+                        snepSendHeader( snep, RFAL_SNEP_REQ_CONTINUE );
+                    }
+                    return ERR_BUSY;
+                }
+
+                *snep->rspLen = (uint16_t)len;
+            }
+
+            return snepClientDone( snep, ((rsp[SNEP_HDR_CODE_POS] == RFAL_SNEP_RSP_SUCCESS) ? ERR_NONE : ERR_REQUEST) );
+
+        /*******************************************************************************/
+        default:
+            return ERR_WRONG_STATE;
+    }
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalSnepServerStart( rfalSnep *snep, rfalLlcpLink *link, rfalSnepBufFormat *buf )
+{
+    ReturnCode ret;
+
+    if( (snep == NULL) || (buf == NULL) )
+    {
+        return ERR_PARAM;
+    }
+
+    EXIT_ON_ERR( ret, rfalLlcpListen( link, &snep->conn, RFAL_LLCP_SAP_SNEP, (const uint8_t*)RFAL_SNEP_SN, (uint8_t)(sizeof(RFAL_SNEP_SN) - 1U), snepHdr( buf ), (uint16_t)(sizeof(rfalSnepBufFormat) - SNEP_HDR_POS) ) );
+
+    snep->buf            = buf;
+    snep->msgLen         = 0;
+    snep->isContinueSent = false;
+    snep->rspLen         = NULL;
+    snep->getRsp         = NULL;
+    snep->getRspLen      = 0;
+    snep->state          = RFAL_SNEP_ST_SERVE;
+
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalSnepServerSetGetResponse( rfalSnep *snep, const uint8_t *ndef, uint16_t ndefLen )
+{
+    if( (snep == NULL) || (ndefLen > RFAL_FEATURE_SNEP_NDEF_MAX_LEN) )
+    {
+        return ERR_PARAM;
+    }
+
+    snep->getRsp    = ndef;
+    snep->getRspLen = ((ndef != NULL) ? ndefLen : 0U);
+
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalSnepServerGetStatus( rfalSnep *snep, uint16_t *ndefLen )
+{
+    uint8_t  *req;
+    uint32_t len;
+    uint16_t fragLen;
+
+    if( snep->state != RFAL_SNEP_ST_SERVE )
+    {
+        return ERR_WRONG_STATE;
+    }
+
+    if( snep->conn.state != RFAL_LLCP_CONN_ST_CONNECTED )
+    {
+        snep->isContinueSent = false;
+        snep->msgLen         = 0;
+        return ERR_BUSY;
+    }
+
+    /* Wait for a request header, and for the previous response to be sent */
+    if( (snep->conn.rxLen < RFAL_SNEP_HEADER_LEN) || !rfalLlcpIsSendDone( &snep->conn ) )
+    {
+        return ERR_BUSY;
+    }
+
+    req = snepHdr( snep->buf );
+    if( !snepIsVersionOk( req ) )
+    {
+        snep->conn.rxLen = 0;
+        snepSendHeader( snep, RFAL_SNEP_RSP_UNSUPPORTED_VERSION );
+        return ERR_BUSY;
+    }
+
+    len = GETU32( &req[SNEP_HDR_LEN_POS] );
+
+    switch( req[SNEP_HDR_CODE_POS] )
+    {
+        /*******************************************************************************/
+        case RFAL_SNEP_REQ_CONTINUE:
+            /* SNEP 1.0  4.1  Send the rest of the Get response. The request *
+             * overlaps the first fragment only, which is gone already       */
+            snep->conn.rxLen = 0;
+            if( snep->msgLen > snep->conn.txLen )
+            {
+                fragLen = snep->conn.txLen;
+                rfalLlcpSend( &snep->conn, &req[fragLen], (snep->msgLen - fragLen) );
+            }
+            snep->msgLen = 0;
+            break;
+
+        /*******************************************************************************/
+        case RFAL_SNEP_REQ_REJECT:
+            snep->conn.rxLen = 0;                                    /* Client does not want the rest */
+            snep->msgLen     = 0;
+            break;
+
+        /*******************************************************************************/
+        case RFAL_SNEP_REQ_PUT:
+        case RFAL_SNEP_REQ_GET:
+            if( len > RFAL_FEATURE_SNEP_NDEF_MAX_LEN )
+            {
+                /* SNEP 1.0  4.2  Cannot take the whole message, the client shall not send the rest */
+                snep->conn.rxLen = 0;
+                snepSendHeader( snep, RFAL_SNEP_RSP_REJECT );
+                break;
+            }
+
+            if( snep->conn.rxLen < (RFAL_SNEP_HEADER_LEN + len) )
+            {
+                if( !snep->isContinueSent )
+                {
+                    snep->isContinueSent = true;
+                    snepSendHeader( snep, RFAL_SNEP_RSP_CONTINUE );
+                }
+                break;
+            }
+
+            snep->conn.rxLen     = 0;
+            snep->isContinueSent = false;
+
+            if( req[SNEP_HDR_CODE_POS] == RFAL_SNEP_REQ_PUT )
+            {
+                snepSendHeader( snep, RFAL_SNEP_RSP_SUCCESS );
+
+                *ndefLen = (uint16_t)len;
+                return ERR_NONE;
+            }
+
+            /* SNEP 1.0  3.1.2  Get: Acceptable Length on the first bytes of the information field */
+            if( len < RFAL_SNEP_ACCEPT_LEN_LEN )
+            {
+                snepSendHeader( snep, RFAL_SNEP_RSP_BAD_REQUEST );
+            }
+            else if( snep->getRsp == NULL )
+            {
+                snepSendHeader( snep, RFAL_SNEP_RSP_NOT_IMPLEMENTED );
+            }
+            else if( snep->getRspLen > GETU32( snep->buf->ndef ) )
+            {
+                snepSendHeader( snep, RFAL_SNEP_RSP_EXCESS_DATA );
+            }
+            else
+            {
+                ST_MEMCPY( snep->buf->ndef, snep->getRsp, snep->getRspLen );
+                snepSetHeader( req, RFAL_SNEP_RSP_SUCCESS, snep->getRspLen );
+
+                /* SNEP 1.0  4.1  Send what fits the client MIU and wait for Continue if more remains */
+                snep->msgLen = (RFAL_SNEP_HEADER_LEN + snep->getRspLen);
+                fragLen      = MIN( snep->msgLen, snep->conn.rMiu );
+                rfalLlcpSend( &snep->conn, req, fragLen );
+
+                snep->msgLen = ((fragLen < snep->msgLen) ? snep->msgLen : 0U);
+            }
+            break;
+
+        /*******************************************************************************/
+        default:
+            snep->conn.rxLen = 0;
+            snepSendHeader( snep, RFAL_SNEP_RSP_BAD_REQUEST );
+            break;
+    }
+
+    return ERR_BUSY;
+}
+
+#endif /* RFAL_FEATURE_LLCP */
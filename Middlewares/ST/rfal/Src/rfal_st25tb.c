@@ -78,6 +78,7 @@
 
 #define RFAL_ST25TB_T0               2157U                              /*!< ST25TB t0  159 us   ST25TB RF characteristics    */
 #define RFAL_ST25TB_T1               2048U                              /*!< ST25TB t1  151 us   ST25TB RF characteristics    */
+#define RFAL_ST25TB_T2               1792U                              /*!< ST25TB t2  132 us   Answer to new request delay  */
 
 #define RFAL_ST25TB_FWT             (RFAL_ST25TB_T0 + RFAL_ST25TB_T1)   /*!< ST25TB FWT  = T0 + T1                            */
 #define RFAL_ST25TB_TW              rfalConvMsTo1fc(7U)                 /*!< ST25TB TW : Programming time for write max 7ms   */
@@ -89,6 +90,9 @@
  ******************************************************************************
  */
 
+/*! Runs the given status method (fn) until it is no longer busy, running the RFAL worker in between */
+#define rfalSt25tbRunBlocking( e, fn )    do{ (e)=(fn); rfalWorker(); }while( (e) == ERR_BUSY )
+
 /*
 ******************************************************************************
 * GLOBAL TYPES
@@ -132,106 +136,155 @@ typedef struct
     rfalSt25tbBlock data;               /*!< Block Data                   */
 } rfalSt25tbWriteBlockReq;
 
+/*! Read Multiple Blocks context */
+typedef struct
+{
+    bool                   isReading;   /*!< Read Multiple Blocks ongoing */
+    rfalSt25tbReadBlockReq req;         /*!< Read Block Request in flight */
+    uint8_t                firstBlock;  /*!< First block address          */
+    uint8_t                numOfBlocks; /*!< Number of blocks to be read  */
+    uint8_t                blockIdx;    /*!< Block being read             */
+    rfalSt25tbBlock        *blockData;  /*!< Caller's block buffer        */
+    uint16_t               rxLen;       /*!< Received length in bits      */
+} rfalSt25tbReadMultipleCtx;
+
+/*! Check Presence / Collision Resolution states */
+typedef enum
+{
+    RFAL_ST25TB_COLRES_ST_IDLE,         /*!< No operation ongoing                   */
+    RFAL_ST25TB_COLRES_ST_PRESENCE,     /*!< Initiate sent to check presence        */
+    RFAL_ST25TB_COLRES_ST_INITIATE,     /*!< Initiate sent                          */
+    RFAL_ST25TB_COLRES_ST_SLOT,         /*!< Pcall16 / SlotMarker sent              */
+    RFAL_ST25TB_COLRES_ST_SELECT,       /*!< Select sent                            */
+    RFAL_ST25TB_COLRES_ST_GETUID,       /*!< Get UID sent                           */
+    RFAL_ST25TB_COLRES_ST_SEL_SINGLE,   /*!< Select sent outside collision res      */
+    RFAL_ST25TB_COLRES_ST_UID_SINGLE    /*!< Get UID sent outside collision res     */
+} rfalSt25tbColResState;
+
+/*! Check Presence / Collision Resolution context */
+typedef struct
+{
+    rfalSt25tbColResState  state;       /*!< Current state                          */
+    uint8_t                devLimit;    /*!< Device limit, size of devList          */
+    rfalSt25tbListenDevice *devList;    /*!< Caller's device list                   */
+    uint8_t                *devCnt;     /*!< Caller's device counter                */
+    uint8_t                *chipId;     /*!< Caller's chip ID on Check Presence     */
+    bool                   isInitiated; /*!< Device being selected answered Initiate*/
+    bool                   col;         /*!< Collision detected on the slot sweep   */
+    uint8_t                slot;        /*!< Slot being swept                       */
+    uint8_t                slotIds[RFAL_ST25TB_SLOTS]; /*!< Chip IDs found on sweep */
+    uint8_t                slotCnt;     /*!< Chip IDs found on sweep counter        */
+    uint8_t                selIdx;      /*!< Chip ID being selected                 */
+    uint8_t                txBuf[sizeof(rfalSt25tbSelectReq)]; /*!< Request in flight */
+    uint8_t                rxBuf[RFAL_ST25TB_CHIP_ID_LEN + RFAL_ST25TB_CRC_LEN]; /*!< Chip ID received */
+    uint16_t               rxLen;       /*!< Received length in bits                */
+} rfalSt25tbColResCtx;
+
 
 /*
 ******************************************************************************
 * LOCAL FUNCTION PROTOTYPES
 ******************************************************************************
 */
-/*! 
- *****************************************************************************
- * \brief  ST25TB Poller Do Collision Resolution
- *  
- * This method performs ST25TB Collision resolution loop for each slot
- *   
- * \param[in]  devLimit      : device limit value, and size st25tbDevList
- * \param[out] st25tbDevList : ST35TB listener device info
- * \param[out] devCnt        : Devices found counter
- * 
- * \return colPending         : true if a collision was detected
- *****************************************************************************
- */
-static bool rfalSt25tbPollerDoCollisionResolution( uint8_t devLimit, rfalSt25tbListenDevice *st25tbDevList, uint8_t *devCnt );
+static ReturnCode rfalSt25tbPollerStartReadNextBlock( void );
+static ReturnCode rfalSt25tbPollerStartColResCmd( rfalSt25tbColResState state, uint8_t cmd, uint8_t param, uint8_t txLen, uint8_t *rxBuf, uint16_t rxBufLen );
+static ReturnCode rfalSt25tbPollerStartSweep( void );
+static ReturnCode rfalSt25tbPollerSelectNext( void );
+
 
 /*
 ******************************************************************************
-* LOCAL FUNCTION PROTOTYPES
+* LOCAL VARIABLES
 ******************************************************************************
 */
+static rfalSt25tbReadMultipleCtx gRfalSt25tbRdMul;  /*!< ST25TB Read Multiple Blocks context */
+static rfalSt25tbColResCtx       gRfalSt25tbColRes; /*!< ST25TB Check Presence / Collision Resolution context */
 
 
-static bool rfalSt25tbPollerDoCollisionResolution( uint8_t devLimit, rfalSt25tbListenDevice *st25tbDevList, uint8_t *devCnt )
-{
-    uint8_t    i;
-    uint8_t    chipId;
-    ReturnCode ret;
-    bool col;
+/*
+******************************************************************************
+* LOCAL FUNCTIONS
+******************************************************************************
+*/
+
 
-    col = false;
+static ReturnCode rfalSt25tbPollerStartColResCmd( rfalSt25tbColResState state, uint8_t cmd, uint8_t param, uint8_t txLen, uint8_t *rxBuf, uint16_t rxBufLen )
+{
+    rfalTransceiveContext ctx;
     
-    for(i = 0; i < RFAL_ST25TB_SLOTS; i++)
-    {
-        platformDelay(1);  /* Wait t2: Answer to new request delay  */
-        
-        if( i==0U )
-        {
-            /* Step 2: Send Pcall16 */
-            ret = rfalSt25tbPollerPcall( &chipId );
-        }
-        else
-        {
-            /* Step 3-17: Send Pcall16 */
-            ret = rfalSt25tbPollerSlotMarker( i, &chipId );
-        }
-        
-        if( ret == ERR_NONE )
-        {
-            /* Found another device */
-            st25tbDevList[*devCnt].chipID       = chipId;
-            st25tbDevList[*devCnt].isDeselected = false;
-            
-            /* Select Device, retrieve its UID  */
-            ret = rfalSt25tbPollerSelect( chipId );
+    /* Keep the request until it is sent, the FDT Poll (t2) paces the following request */
+    gRfalSt25tbColRes.txBuf[0] = cmd;
+    gRfalSt25tbColRes.txBuf[1] = param;
+    gRfalSt25tbColRes.state    = state;
+    
+    rfalCreateByteFlagsTxRxContext( ctx, gRfalSt25tbColRes.txBuf, txLen, rxBuf, rxBufLen, &gRfalSt25tbColRes.rxLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_ST25TB_FWT );
+    return rfalStartTransceive( &ctx );
+}
 
-            /* By Selecting this device, the previous gets Deselected */
-            if( (*devCnt) > 0U )
-            {
-                st25tbDevList[(*devCnt)-1U].isDeselected = true;
-            }
 
-            if( ERR_NONE == ret )
-            {
-                rfalSt25tbPollerGetUID( &st25tbDevList[*devCnt].UID );
-            }
+/*******************************************************************************/
+static ReturnCode rfalSt25tbPollerStartSweep( void )
+{
+    gRfalSt25tbColRes.col         = false;
+    gRfalSt25tbColRes.isInitiated = false;
+    gRfalSt25tbColRes.slot        = 0;
+    gRfalSt25tbColRes.slotCnt     = 0;
+    gRfalSt25tbColRes.selIdx      = 0;
+    
+    /*******************************************************************************/
+    /* Sweep all slots back to back, t2 (Answer to new request delay) is ensured   */
+    /* by the FDT Poll set on rfalSt25tbPollerInitialize()                         */
+    /*******************************************************************************/
+    
+    /* Step 2: Send Pcall16 */
+    return rfalSt25tbPollerStartColResCmd( RFAL_ST25TB_COLRES_ST_SLOT, RFAL_ST25TB_PCALL_CMD1, RFAL_ST25TB_PCALL_CMD2, (uint8_t)sizeof(rfalSt25tbPcallReq), gRfalSt25tbColRes.rxBuf, sizeof(gRfalSt25tbColRes.rxBuf) );
+}
 
-            if( ERR_NONE == ret )
-            {
-                (*devCnt)++;
-            }
-        }
-        else if( (ret == ERR_CRC) || (ret == ERR_FRAMING) )
-        {
-            col = true;
-        }
-        else
-        {
-            /* MISRA 15.7 - Empty else */
-        }
+
+/*******************************************************************************/
+static ReturnCode rfalSt25tbPollerSelectNext( void )
+{
+    uint8_t devCnt;
+    
+    devCnt = *gRfalSt25tbColRes.devCnt;
+    
+    /*******************************************************************************/
+    /* Only after the sweep Select each device found and retrieve its UID          */
+    /*******************************************************************************/
+    if( gRfalSt25tbColRes.selIdx < gRfalSt25tbColRes.slotCnt )
+    {
+        gRfalSt25tbColRes.devList[devCnt].chipID       = gRfalSt25tbColRes.slotIds[gRfalSt25tbColRes.selIdx];
+        gRfalSt25tbColRes.devList[devCnt].isDeselected = false;
         
-        if( *devCnt >= devLimit )
-        {
-            break;
-        }
+        return rfalSt25tbPollerStartColResCmd( RFAL_ST25TB_COLRES_ST_SELECT, RFAL_ST25TB_SELECT_CMD, gRfalSt25tbColRes.slotIds[gRfalSt25tbColRes.selIdx], (uint8_t)sizeof(rfalSt25tbSelectReq), gRfalSt25tbColRes.rxBuf, sizeof(gRfalSt25tbColRes.rxBuf) );
     }
-    return col;
+    
+    /* Always proceed to Pcall16 anticollision as phase differences of tags can lead to no tag recognized, even if there is one */
+    /* and keep sweeping while collisions are pending                                                                          */
+    if( (gRfalSt25tbColRes.isInitiated || gRfalSt25tbColRes.col) && (devCnt < gRfalSt25tbColRes.devLimit) )
+    {
+        return rfalSt25tbPollerStartSweep();
+    }
+    
+    gRfalSt25tbColRes.state = RFAL_ST25TB_COLRES_ST_IDLE;
+    return ERR_NONE;
 }
 
 
-/*
-******************************************************************************
-* LOCAL VARIABLES
-******************************************************************************
-*/
+/*******************************************************************************/
+static ReturnCode rfalSt25tbPollerStartReadNextBlock( void )
+{
+    rfalTransceiveContext ctx;
+    
+    /* Compute Read Block Request */
+    gRfalSt25tbRdMul.req.cmd     = RFAL_ST25TB_READ_BLOCK_CMD;
+    gRfalSt25tbRdMul.req.address = (gRfalSt25tbRdMul.firstBlock + gRfalSt25tbRdMul.blockIdx);
+    
+    /* Receive straight into the caller's buffer, the FDT Poll (t2) paces the following request */
+    rfalCreateByteFlagsTxRxContext( ctx, (uint8_t*)&gRfalSt25tbRdMul.req, sizeof(rfalSt25tbReadBlockReq), (uint8_t*)gRfalSt25tbRdMul.blockData[gRfalSt25tbRdMul.blockIdx], sizeof(rfalSt25tbBlock), &gRfalSt25tbRdMul.rxLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_ST25TB_FWT );
+    return rfalStartTransceive( &ctx );
+}
+
 
 /*
 ******************************************************************************
@@ -242,7 +295,14 @@ static bool rfalSt25tbPollerDoCollisionResolution( uint8_t devLimit, rfalSt25tbL
 /*******************************************************************************/
 ReturnCode rfalSt25tbPollerInitialize( void )
 {
-    return rfalNfcbPollerInitialize();
+    ReturnCode ret;
+    
+    EXIT_ON_ERR( ret, rfalNfcbPollerInitialize() );
+    
+    /* ST25TB only requires t2 between its response and the next request, shorter than FDTB,POLL */
+    rfalSetFDTPoll( RFAL_ST25TB_T2 );
+    
+    return ERR_NONE;
 }
 
 
@@ -250,12 +310,40 @@ ReturnCode rfalSt25tbPollerInitialize( void )
 ReturnCode rfalSt25tbPollerCheckPresence( uint8_t *chipId )
 {
     ReturnCode ret;
-    uint8_t    chipIdRes;
+    
+    EXIT_ON_ERR( ret, rfalSt25tbPollerStartCheckPresence( chipId ) );
+    rfalSt25tbRunBlocking( ret, rfalSt25tbPollerGetCheckPresenceStatus() );
+    
+    return ret;
+}
+
 
-    chipIdRes = 0x00;
-   
+/*******************************************************************************/
+ReturnCode rfalSt25tbPollerStartCheckPresence( uint8_t *chipId )
+{
+    gRfalSt25tbColRes.chipId = chipId;
+    
     /* Send Initiate Request */
-    ret = rfalSt25tbPollerInitiate( &chipIdRes );
+    return rfalSt25tbPollerStartColResCmd( RFAL_ST25TB_COLRES_ST_PRESENCE, RFAL_ST25TB_INITIATE_CMD1, RFAL_ST25TB_INITIATE_CMD2, (uint8_t)sizeof(rfalSt25tbInitiateReq), gRfalSt25tbColRes.rxBuf, sizeof(gRfalSt25tbColRes.rxBuf) );
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalSt25tbPollerGetCheckPresenceStatus( void )
+{
+    ReturnCode ret;
+    
+    if( gRfalSt25tbColRes.state != RFAL_ST25TB_COLRES_ST_PRESENCE )
+    {
+        return ERR_WRONG_STATE;
+    }
+    
+    ret = rfalGetTransceiveStatus();
+    if( ret == ERR_BUSY )
+    {
+        return ret;
+    }
+    gRfalSt25tbColRes.state = RFAL_ST25TB_COLRES_ST_IDLE;
     
     /*  Check if a transmission error was detected */
     if( (ret == ERR_CRC) || (ret == ERR_FRAMING) )
@@ -263,10 +351,16 @@ ReturnCode rfalSt25tbPollerCheckPresence( uint8_t *chipId )
         return ERR_NONE;
     }
     
+    /* Check for valid Initiate Response   */
+    if( (ret == ERR_NONE) && (gRfalSt25tbColRes.rxLen != rfalConvBytesToBits( RFAL_ST25TB_CHIP_ID_LEN )) )
+    {
+        return ERR_PROTO;
+    }
+    
     /* Copy chip ID if requested */
-    if( chipId != NULL )
+    if( (ret == ERR_NONE) && (gRfalSt25tbColRes.chipId != NULL) )
     {
-        *chipId = chipIdRes;
+        *gRfalSt25tbColRes.chipId = gRfalSt25tbColRes.rxBuf[0];
     }
     
     return ret;
@@ -360,20 +454,42 @@ ReturnCode rfalSt25tbPollerSlotMarker( uint8_t slotNum, uint8_t *chipIdRes )
 /*******************************************************************************/
 ReturnCode rfalSt25tbPollerSelect( uint8_t chipId )
 {
-    ReturnCode          ret;
-    uint16_t            rxLen;    
-    rfalSt25tbSelectReq selectReq;
-    uint8_t             chipIdRes;
+    ReturnCode ret;
+    
+    EXIT_ON_ERR( ret, rfalSt25tbPollerStartSelect( chipId ) );
+    rfalSt25tbRunBlocking( ret, rfalSt25tbPollerGetSelectStatus() );
+    
+    return ret;
+}
 
-    /* Compute Select Request */
-    selectReq.cmd    = RFAL_ST25TB_SELECT_CMD;
-    selectReq.chipId = chipId;
+
+/*******************************************************************************/
+ReturnCode rfalSt25tbPollerStartSelect( uint8_t chipId )
+{
+    /* Send Select Request, the chip ID is kept on the request for the response check */
+    return rfalSt25tbPollerStartColResCmd( RFAL_ST25TB_COLRES_ST_SEL_SINGLE, RFAL_ST25TB_SELECT_CMD, chipId, (uint8_t)sizeof(rfalSt25tbSelectReq), gRfalSt25tbColRes.rxBuf, sizeof(gRfalSt25tbColRes.rxBuf) );
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalSt25tbPollerGetSelectStatus( void )
+{
+    ReturnCode ret;
+    
+    if( gRfalSt25tbColRes.state != RFAL_ST25TB_COLRES_ST_SEL_SINGLE )
+    {
+        return ERR_WRONG_STATE;
+    }
     
-    /* Send Select Request */
-    ret = rfalTransceiveBlockingTxRx( (uint8_t*)&selectReq, sizeof(rfalSt25tbSelectReq), (uint8_t*)&chipIdRes, RFAL_ST25TB_CHIP_ID_LEN, &rxLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_ST25TB_FWT );
+    ret = rfalGetTransceiveStatus();
+    if( ret == ERR_BUSY )
+    {
+        return ret;
+    }
+    gRfalSt25tbColRes.state = RFAL_ST25TB_COLRES_ST_IDLE;
     
     /* Check for valid Select Response   */
-    if( (ret == ERR_NONE) && ((rxLen != RFAL_ST25TB_CHIP_ID_LEN) || (chipIdRes != chipId)) )
+    if( (ret == ERR_NONE) && ((gRfalSt25tbColRes.rxLen != rfalConvBytesToBits( RFAL_ST25TB_CHIP_ID_LEN )) || (gRfalSt25tbColRes.rxBuf[0] != gRfalSt25tbColRes.txBuf[1])) )
     {
         return ERR_PROTO;
     }
@@ -386,18 +502,46 @@ ReturnCode rfalSt25tbPollerSelect( uint8_t chipId )
 ReturnCode rfalSt25tbPollerGetUID( rfalSt25tbUID *UID )
 {
     ReturnCode ret;
-    uint16_t   rxLen;
-    uint8_t    getUidReq;
     
+    EXIT_ON_ERR( ret, rfalSt25tbPollerStartGetUID( UID ) );
+    rfalSt25tbRunBlocking( ret, rfalSt25tbPollerGetGetUIDStatus() );
+    
+    return ret;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalSt25tbPollerStartGetUID( rfalSt25tbUID *UID )
+{
+    if( UID == NULL )
+    {
+        return ERR_PARAM;
+    }
+    
+    /* Send Get UID Request, received straight into the caller's UID */
+    return rfalSt25tbPollerStartColResCmd( RFAL_ST25TB_COLRES_ST_UID_SINGLE, RFAL_ST25TB_GET_UID_CMD, 0U, RFAL_ST25TB_CMD_LEN, (uint8_t*)UID, sizeof(rfalSt25tbUID) );
+}
+
 
-    /* Compute Get UID Request */
-    getUidReq = RFAL_ST25TB_GET_UID_CMD;
+/*******************************************************************************/
+ReturnCode rfalSt25tbPollerGetGetUIDStatus( void )
+{
+    ReturnCode ret;
     
-    /* Send Select Request */
-    ret = rfalTransceiveBlockingTxRx( (uint8_t*)&getUidReq, RFAL_ST25TB_CMD_LEN, (uint8_t*)UID, sizeof(rfalSt25tbUID), &rxLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_ST25TB_FWT );
+    if( gRfalSt25tbColRes.state != RFAL_ST25TB_COLRES_ST_UID_SINGLE )
+    {
+        return ERR_WRONG_STATE;
+    }
+    
+    ret = rfalGetTransceiveStatus();
+    if( ret == ERR_BUSY )
+    {
+        return ret;
+    }
+    gRfalSt25tbColRes.state = RFAL_ST25TB_COLRES_ST_IDLE;
     
     /* Check for valid UID Response */
-    if( (ret == ERR_NONE) && (rxLen != RFAL_ST25TB_UID_LEN) )
+    if( (ret == ERR_NONE) && (gRfalSt25tbColRes.rxLen != rfalConvBytesToBits( RFAL_ST25TB_UID_LEN )) )
     {
         return ERR_PROTO;
     }
@@ -409,11 +553,18 @@ ReturnCode rfalSt25tbPollerGetUID( rfalSt25tbUID *UID )
 /*******************************************************************************/
 ReturnCode rfalSt25tbPollerCollisionResolution( uint8_t devLimit, rfalSt25tbListenDevice *st25tbDevList, uint8_t *devCnt )
 {
-    
-    uint8_t    chipId;
     ReturnCode ret;
-    bool       detected;  /* collision or device was detected */
     
+    EXIT_ON_ERR( ret, rfalSt25tbPollerStartCollisionResolution( devLimit, st25tbDevList, devCnt ) );
+    rfalSt25tbRunBlocking( ret, rfalSt25tbPollerGetCollisionResolutionStatus() );
+    
+    return ret;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalSt25tbPollerStartCollisionResolution( uint8_t devLimit, rfalSt25tbListenDevice *st25tbDevList, uint8_t *devCnt )
+{
     if( (st25tbDevList == NULL) || (devCnt == NULL) || (devLimit == 0U) )
     {
         return ERR_PARAM;
@@ -421,39 +572,142 @@ ReturnCode rfalSt25tbPollerCollisionResolution( uint8_t devLimit, rfalSt25tbList
     
     *devCnt = 0;
     
+    gRfalSt25tbColRes.devLimit = devLimit;
+    gRfalSt25tbColRes.devList  = st25tbDevList;
+    gRfalSt25tbColRes.devCnt   = devCnt;
+    gRfalSt25tbColRes.col      = false;
+    gRfalSt25tbColRes.slotCnt  = 0;
+    gRfalSt25tbColRes.selIdx   = 0;
+    
     /* Step 1: Send Initiate */
-    ret = rfalSt25tbPollerInitiate( &chipId );
-    if( ret == ERR_NONE )
+    return rfalSt25tbPollerStartColResCmd( RFAL_ST25TB_COLRES_ST_INITIATE, RFAL_ST25TB_INITIATE_CMD1, RFAL_ST25TB_INITIATE_CMD2, (uint8_t)sizeof(rfalSt25tbInitiateReq), gRfalSt25tbColRes.rxBuf, sizeof(gRfalSt25tbColRes.rxBuf) );
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalSt25tbPollerGetCollisionResolutionStatus( void )
+{
+    ReturnCode             ret;
+    uint8_t                *devCnt;
+    rfalSt25tbListenDevice *dev;
+    bool                   isChipId;
+    
+    if( (gRfalSt25tbColRes.state == RFAL_ST25TB_COLRES_ST_IDLE)       || (gRfalSt25tbColRes.state == RFAL_ST25TB_COLRES_ST_PRESENCE) ||
+        (gRfalSt25tbColRes.state == RFAL_ST25TB_COLRES_ST_SEL_SINGLE) || (gRfalSt25tbColRes.state == RFAL_ST25TB_COLRES_ST_UID_SINGLE)  )
     {
-        /* If only 1 answer is detected */
-        st25tbDevList[*devCnt].chipID       = chipId;
-        st25tbDevList[*devCnt].isDeselected = false;
+        return ERR_WRONG_STATE;
+    }
+    
+    ret = rfalGetTransceiveStatus();
+    if( ret == ERR_BUSY )
+    {
+        return ret;
+    }
+    
+    devCnt   = gRfalSt25tbColRes.devCnt;
+    dev      = &gRfalSt25tbColRes.devList[*devCnt];
+    isChipId = ((ret == ERR_NONE) && (gRfalSt25tbColRes.rxLen == rfalConvBytesToBits( RFAL_ST25TB_CHIP_ID_LEN )));
+    
+    switch( gRfalSt25tbColRes.state )
+    {
+        /*******************************************************************************/
+        case RFAL_ST25TB_COLRES_ST_INITIATE:
+            
+            gRfalSt25tbColRes.isInitiated = true;
+            
+            if( isChipId )
+            {
+                /* If only 1 answer is detected retrieve its UID and keep it Selected */
+                dev->chipID       = gRfalSt25tbColRes.rxBuf[0];
+                dev->isDeselected = false;
+                
+                ret = rfalSt25tbPollerStartColResCmd( RFAL_ST25TB_COLRES_ST_SELECT, RFAL_ST25TB_SELECT_CMD, dev->chipID, (uint8_t)sizeof(rfalSt25tbSelectReq), gRfalSt25tbColRes.rxBuf, sizeof(gRfalSt25tbColRes.rxBuf) );
+            }
+            else
+            {
+                ret = rfalSt25tbPollerSelectNext();
+            }
+            break;
         
-        /* Retrieve its UID and keep it Selected*/
-        ret = rfalSt25tbPollerSelect( chipId );
+        /*******************************************************************************/
+        case RFAL_ST25TB_COLRES_ST_SLOT:
+            
+            if( isChipId )
+            {
+                /* Found another device */
+                gRfalSt25tbColRes.slotIds[gRfalSt25tbColRes.slotCnt++] = gRfalSt25tbColRes.rxBuf[0];
+            }
+            else if( (ret == ERR_CRC) || (ret == ERR_FRAMING) )
+            {
+                gRfalSt25tbColRes.col = true;
+            }
+            else
+            {
+                /* MISRA 15.7 - Empty else */
+            }
+            
+            gRfalSt25tbColRes.slot++;
+            if( (gRfalSt25tbColRes.slot < RFAL_ST25TB_SLOTS) && ((*devCnt + gRfalSt25tbColRes.slotCnt) < gRfalSt25tbColRes.devLimit) )
+            {
+                /* Step 3-17: Send SlotMarker */
+                ret = rfalSt25tbPollerStartColResCmd( RFAL_ST25TB_COLRES_ST_SLOT, (uint8_t)(((gRfalSt25tbColRes.slot & RFAL_ST25TB_SLOTNUM_MASK) << RFAL_ST25TB_SLOTNUM_SHIFT) | RFAL_ST25TB_PCALL_CMD1), 0U, RFAL_ST25TB_CMD_LEN, gRfalSt25tbColRes.rxBuf, sizeof(gRfalSt25tbColRes.rxBuf) );
+            }
+            else
+            {
+                ret = rfalSt25tbPollerSelectNext();
+            }
+            break;
         
-        if( ERR_NONE == ret )
-        {
-            ret = rfalSt25tbPollerGetUID( &st25tbDevList[*devCnt].UID );
-        }
+        /*******************************************************************************/
+        case RFAL_ST25TB_COLRES_ST_SELECT:
+            
+            /* By Selecting a device found on the sweep, the previous gets Deselected */
+            if( (!gRfalSt25tbColRes.isInitiated) && (*devCnt > 0U) )
+            {
+                gRfalSt25tbColRes.devList[(*devCnt) - 1U].isDeselected = true;
+            }
+            
+            if( isChipId && (gRfalSt25tbColRes.rxBuf[0] == dev->chipID) )
+            {
+                ret = rfalSt25tbPollerStartColResCmd( RFAL_ST25TB_COLRES_ST_GETUID, RFAL_ST25TB_GET_UID_CMD, 0U, RFAL_ST25TB_CMD_LEN, (uint8_t*)dev->UID, sizeof(rfalSt25tbUID) );
+            }
+            else
+            {
+                gRfalSt25tbColRes.selIdx += (gRfalSt25tbColRes.isInitiated ? 0U : 1U);
+                ret = rfalSt25tbPollerSelectNext();
+            }
+            break;
         
-        if( ERR_NONE == ret )
-        {
-            (*devCnt)++;
-        }
+        /*******************************************************************************/
+        case RFAL_ST25TB_COLRES_ST_GETUID:
+            
+            if( (ret == ERR_NONE) && (gRfalSt25tbColRes.rxLen == rfalConvBytesToBits( RFAL_ST25TB_UID_LEN )) )
+            {
+                (void)rfalGetTransceiveRSSI( &dev->rssi );
+                (*devCnt)++;
+            }
+            
+            gRfalSt25tbColRes.selIdx += (gRfalSt25tbColRes.isInitiated ? 0U : 1U);
+            ret = rfalSt25tbPollerSelectNext();
+            break;
+        
+        /*******************************************************************************/
+        default:
+            ret = ERR_WRONG_STATE;
+            break;
     }
-    /* Always proceed to Pcall16 anticollision as phase differences of tags can lead to no tag recognized, even if there is one */
-    if( *devCnt < devLimit )
+    
+    if( gRfalSt25tbColRes.state == RFAL_ST25TB_COLRES_ST_IDLE )
     {
-        /* Multiple device responses */
-        do
-        {
-            detected = rfalSt25tbPollerDoCollisionResolution( devLimit, st25tbDevList, devCnt );
-        }
-        while( (detected == true) && (*devCnt < devLimit) );
+        return ret;
     }
-
-    return ERR_NONE;
+    
+    if( ret != ERR_NONE )
+    {
+        gRfalSt25tbColRes.state = RFAL_ST25TB_COLRES_ST_IDLE;
+        return ret;
+    }
+    return ERR_BUSY;
 }
 
 
@@ -482,6 +736,82 @@ ReturnCode rfalSt25tbPollerReadBlock( uint8_t blockAddress, rfalSt25tbBlock *blo
 }
 
 
+/*******************************************************************************/
+ReturnCode rfalSt25tbPollerReadMultipleBlocks( uint8_t firstBlock, uint8_t numOfBlocks, rfalSt25tbBlock *blockData )
+{
+    ReturnCode ret;
+    
+    EXIT_ON_ERR( ret, rfalSt25tbPollerStartReadMultipleBlocks( firstBlock, numOfBlocks, blockData ) );
+    rfalSt25tbRunBlocking( ret, rfalSt25tbPollerGetReadMultipleBlocksStatus() );
+    
+    return ret;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalSt25tbPollerStartReadMultipleBlocks( uint8_t firstBlock, uint8_t numOfBlocks, rfalSt25tbBlock *blockData )
+{
+    ReturnCode ret;
+    
+    if( (blockData == NULL) || (numOfBlocks == 0U) || (((uint16_t)firstBlock + numOfBlocks) > ((uint16_t)UINT8_MAX + 1U)) )
+    {
+        return ERR_PARAM;
+    }
+    
+    gRfalSt25tbRdMul.firstBlock  = firstBlock;
+    gRfalSt25tbRdMul.numOfBlocks = numOfBlocks;
+    gRfalSt25tbRdMul.blockIdx    = 0;
+    gRfalSt25tbRdMul.blockData   = blockData;
+    
+    ret = rfalSt25tbPollerStartReadNextBlock();
+    gRfalSt25tbRdMul.isReading = (ret == ERR_NONE);
+    
+    return ret;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalSt25tbPollerGetReadMultipleBlocksStatus( void )
+{
+    ReturnCode ret;
+    
+    if( !gRfalSt25tbRdMul.isReading )
+    {
+        return ERR_NONE;
+    }
+    
+    ret = rfalGetTransceiveStatus();
+    if( ret == ERR_BUSY )
+    {
+        return ret;
+    }
+    
+    /* Check for valid Read Block Response */
+    if( (ret == ERR_NONE) && (gRfalSt25tbRdMul.rxLen != rfalConvBytesToBits( RFAL_ST25TB_BLOCK_LEN )) )
+    {
+        ret = ERR_PROTO;
+    }
+    
+    if( ret == ERR_NONE )
+    {
+        gRfalSt25tbRdMul.blockIdx++;
+        
+        /* Issue the next Read Block right away */
+        if( gRfalSt25tbRdMul.blockIdx < gRfalSt25tbRdMul.numOfBlocks )
+        {
+            ret = rfalSt25tbPollerStartReadNextBlock();
+            if( ret == ERR_NONE )
+            {
+                return ERR_BUSY;
+            }
+        }
+    }
+    
+    gRfalSt25tbRdMul.isReading = false;
+    return ret;
+}
+
+
 /*******************************************************************************/
 ReturnCode rfalSt25tbPollerWriteBlock( uint8_t blockAddress, const rfalSt25tbBlock *blockData  )
 {
@@ -70,6 +70,16 @@
 #define RFAL_T1T_RID_RES_HR0_VAL    0x10U      /*!< HR0 indicating NDEF support  Digital 2.0 (Candidate) 11.6.2.1        */
 #define RFAL_T1T_RID_RES_HR0_MASK   0xF0U      /*!< HR0 most significant nibble mask                                     */
 
+#define RFAL_T1T_ADDS_SEGMENT_SHIFT 4U         /*!< ADDS: segment number on the most significant nibble T1T 1.2 Table 4 */
+
+/*
+******************************************************************************
+* GLOBAL MACROS
+******************************************************************************
+*/
+
+#define rfalT1TRunBlocking( e, fn )    do{ (e)=(fn); rfalWorker(); }while( (e) == ERR_BUSY )
+
 /*
 ******************************************************************************
 * GLOBAL TYPES
@@ -113,11 +123,56 @@ typedef struct
     uint8_t data;                              /*!< DAT                       */
 } rfalT1TWriteRes;
 
+
+/*! NFC-A T1T (Topaz) RSEG_REQ, READ8_REQ, WRITE-E8_REQ and WRITE-NE8_REQ   T1T 1.2  Table 4 */
+typedef struct
+{
+    uint8_t cmd;                               /*!< T1T cmd: RSEG, READ8, WRITE-E8, WRITE-NE8   */
+    uint8_t add;                               /*!< ADDS | ADD8                                 */
+    uint8_t data[RFAL_T1T_BLOCK_LEN];          /*!< DATA: 00h for reads                         */
+    uint8_t uid[RFAL_T1T_UID_LEN];             /*!< UID                                         */
+} rfalT1TBlockReq;
+
+
+/*! NFC-A T1T (Topaz) READ8_RES, WRITE-E8_RES and WRITE-NE8_RES   T1T 1.2  Table 4 */
+typedef struct
+{
+    uint8_t add;                               /*!< ADD8                      */
+    uint8_t data[RFAL_T1T_BLOCK_LEN];          /*!< DATA                      */
+} rfalT1TBlockRes;
+
+
+/*! NFC-A T1T (Topaz) RSEG_RES   T1T 1.2  Table 4 */
+typedef struct
+{
+    uint8_t adds;                              /*!< ADDS                      */
+    uint8_t data[RFAL_T1T_SEGMENT_LEN];        /*!< DATA                      */
+} rfalT1TRsegRes;
+
+
+/*! NFC-A T1T (Topaz) Poller context */
+typedef struct
+{
+    rfalT1TRidReq  ridReq;                     /*!< RID_REQ being exchanged   */
+    rfalT1TRidRes  *ridRes;                    /*!< Caller's RID_RES location */
+    uint16_t       rcvdLen;                    /*!< Received length           */
+} rfalT1T;
+
+
+/*
+******************************************************************************
+* LOCAL VARIABLES
+******************************************************************************
+*/
+
+static rfalT1T gT1T;                           /*!< RFAL T1T instance         */
+
 /*
 ******************************************************************************
 * LOCAL FUNCTION PROTOTYPES
 ******************************************************************************
 */
+static ReturnCode rfalT1TPollerWriteBlock( const uint8_t* uid, rfalT1Tcmds cmd, uint8_t block, const uint8_t* data, uint32_t fwt );
 
 /*
 ******************************************************************************
@@ -143,9 +198,19 @@ ReturnCode rfalT1TPollerInitialize( void )
 /*******************************************************************************/
 ReturnCode rfalT1TPollerRid( rfalT1TRidRes *ridRes )
 {
-    ReturnCode     ret;
-    rfalT1TRidReq  ridReq;
-    uint16_t       rcvdLen;
+    ReturnCode ret;
+    
+    EXIT_ON_ERR( ret, rfalT1TPollerStartRid( ridRes ) );
+    rfalT1TRunBlocking( ret, rfalT1TPollerGetRidStatus() );
+    
+    return ret;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalT1TPollerStartRid( rfalT1TRidRes *ridRes )
+{
+    rfalTransceiveContext ctx;
     
     if( ridRes == NULL )
     {
@@ -153,13 +218,28 @@ ReturnCode rfalT1TPollerRid( rfalT1TRidRes *ridRes )
     }
     
     /* Compute RID command and set Undefined Values to 0x00    Digital 1.1 10.6.1 */
-    ST_MEMSET( &ridReq, 0x00, sizeof(rfalT1TRidReq) );
-    ridReq.cmd = (uint8_t)RFAL_T1T_CMD_RID;
+    ST_MEMSET( &gT1T.ridReq, 0x00, sizeof(rfalT1TRidReq) );
+    gT1T.ridReq.cmd = (uint8_t)RFAL_T1T_CMD_RID;
+    gT1T.ridRes     = ridRes;
+    
+    rfalCreateByteFlagsTxRxContext( ctx, (uint8_t*)&gT1T.ridReq, sizeof(rfalT1TRidReq), (uint8_t*)ridRes, sizeof(rfalT1TRidRes), &gT1T.rcvdLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_T1T_DRD_READ );
+    return rfalStartTransceive( &ctx );
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalT1TPollerGetRidStatus( void )
+{
+    ReturnCode ret;
     
-    EXIT_ON_ERR( ret, rfalTransceiveBlockingTxRx( (uint8_t*)&ridReq, sizeof(rfalT1TRidReq), (uint8_t*)ridRes, sizeof(rfalT1TRidRes), &rcvdLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_T1T_DRD_READ ) );
+    ret = rfalGetTransceiveStatus();
+    if( ret != ERR_NONE )
+    {
+        return ret;
+    }
     
     /* Check expected RID response length and the HR0   Digital 2.0 (Candidate) 11.6.2.1 */
-    if( (rcvdLen != sizeof(rfalT1TRidRes)) || ((ridRes->hr0 & RFAL_T1T_RID_RES_HR0_MASK) != RFAL_T1T_RID_RES_HR0_VAL) )
+    if( (rfalConvBitsToBytes( gT1T.rcvdLen ) != sizeof(rfalT1TRidRes)) || ((gT1T.ridRes->hr0 & RFAL_T1T_RID_RES_HR0_MASK) != RFAL_T1T_RID_RES_HR0_VAL) )
     {
         return ERR_PROTO;
     }
@@ -217,4 +297,111 @@ ReturnCode rfalT1TPollerWrite( const uint8_t* uid, uint8_t address, uint8_t data
     return err;
 }
 
+
+/*******************************************************************************/
+ReturnCode rfalT1TPollerRseg( const uint8_t* uid, uint8_t segment, uint8_t* rxBuf, uint16_t rxBufLen )
+{
+    rfalT1TBlockReq rsegReq;
+    rfalT1TRsegRes  rsegRes;
+    uint16_t        rxRcvdLen;
+    ReturnCode      ret;
+    
+    if( (rxBuf == NULL) || (uid == NULL) || (rxBufLen < RFAL_T1T_SEGMENT_LEN) )
+    {
+        return ERR_PARAM;
+    }
+    
+    /* Compute RSEG command, DATA set to 0x00 */
+    ST_MEMSET( &rsegReq, 0x00, sizeof(rfalT1TBlockReq) );
+    rsegReq.cmd = (uint8_t)RFAL_T1T_CMD_RSEG;
+    rsegReq.add = (uint8_t)(segment << RFAL_T1T_ADDS_SEGMENT_SHIFT);
+    ST_MEMCPY(rsegReq.uid, uid, RFAL_T1T_UID_LEN);
+    
+    EXIT_ON_ERR( ret, rfalTransceiveBlockingTxRx( (uint8_t*)&rsegReq, sizeof(rfalT1TBlockReq), (uint8_t*)&rsegRes, sizeof(rfalT1TRsegRes), &rxRcvdLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_T1T_DRD_READ ) );
+    
+    if( (rxRcvdLen != sizeof(rfalT1TRsegRes)) || (rsegRes.adds != rsegReq.add) )
+    {
+        return ERR_PROTO;
+    }
+    
+    ST_MEMCPY( rxBuf, rsegRes.data, RFAL_T1T_SEGMENT_LEN );
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalT1TPollerRead8( const uint8_t* uid, uint8_t block, uint8_t* rxBuf, uint16_t rxBufLen )
+{
+    rfalT1TBlockReq read8Req;
+    rfalT1TBlockRes read8Res;
+    uint16_t        rxRcvdLen;
+    ReturnCode      ret;
+    
+    if( (rxBuf == NULL) || (uid == NULL) || (rxBufLen < RFAL_T1T_BLOCK_LEN) )
+    {
+        return ERR_PARAM;
+    }
+    
+    /* Compute READ8 command, DATA set to 0x00 */
+    ST_MEMSET( &read8Req, 0x00, sizeof(rfalT1TBlockReq) );
+    read8Req.cmd = (uint8_t)RFAL_T1T_CMD_READ8;
+    read8Req.add = block;
+    ST_MEMCPY(read8Req.uid, uid, RFAL_T1T_UID_LEN);
+    
+    EXIT_ON_ERR( ret, rfalTransceiveBlockingTxRx( (uint8_t*)&read8Req, sizeof(rfalT1TBlockReq), (uint8_t*)&read8Res, sizeof(rfalT1TBlockRes), &rxRcvdLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_T1T_DRD_READ ) );
+    
+    if( (rxRcvdLen != sizeof(rfalT1TBlockRes)) || (read8Res.add != block) )
+    {
+        return ERR_PROTO;
+    }
+    
+    ST_MEMCPY( rxBuf, read8Res.data, RFAL_T1T_BLOCK_LEN );
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalT1TPollerWriteE8( const uint8_t* uid, uint8_t block, const uint8_t* data )
+{
+    return rfalT1TPollerWriteBlock( uid, RFAL_T1T_CMD_WRITE_E8, block, data, RFAL_T1T_DRD_WRITE_E );
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalT1TPollerWriteNE8( const uint8_t* uid, uint8_t block, const uint8_t* data )
+{
+    return rfalT1TPollerWriteBlock( uid, RFAL_T1T_CMD_WRITE_NE8, block, data, RFAL_T1T_DRD_WRITE );
+}
+
+
+/*******************************************************************************/
+static ReturnCode rfalT1TPollerWriteBlock( const uint8_t* uid, rfalT1Tcmds cmd, uint8_t block, const uint8_t* data, uint32_t fwt )
+{
+    rfalT1TBlockReq writeReq;
+    rfalT1TBlockRes writeRes;
+    uint16_t        rxRcvdLen;
+    ReturnCode      ret;
+    
+    if( (uid == NULL) || (data == NULL) )
+    {
+        return ERR_PARAM;
+    }
+    
+    writeReq.cmd = (uint8_t)cmd;
+    writeReq.add = block;
+    ST_MEMCPY(writeReq.data, data, RFAL_T1T_BLOCK_LEN);
+    ST_MEMCPY(writeReq.uid, uid, RFAL_T1T_UID_LEN);
+    
+    EXIT_ON_ERR( ret, rfalTransceiveBlockingTxRx( (uint8_t*)&writeReq, sizeof(rfalT1TBlockReq), (uint8_t*)&writeRes, sizeof(rfalT1TBlockRes), &rxRcvdLen, RFAL_TXRX_FLAGS_DEFAULT, fwt ) );
+    
+    /* WRITE-E8 echoes the written data, WRITE-NE8 the resulting block content (OR) */
+    if( (rxRcvdLen != sizeof(rfalT1TBlockRes)) || (writeRes.add != block) || 
+        ((cmd == RFAL_T1T_CMD_WRITE_E8) && (ST_BYTECMP(writeRes.data, data, RFAL_T1T_BLOCK_LEN) != 0))  )
+    {
+        return ERR_PROTO;
+    }
+    
+    return ERR_NONE;
+}
+
 #endif /* RFAL_FEATURE_T1T */
@@ -86,7 +86,9 @@ typedef enum
 {
     RFAL_T2T_CMD_READ           = 0x30,     /*!< T2T Read                                */
     RFAL_T2T_CMD_WRITE          = 0xA2,     /*!< T2T Write                               */
-    RFAL_T2T_CMD_SECTOR_SELECT  = 0xC2      /*!< T2T Sector Select                       */
+    RFAL_T2T_CMD_SECTOR_SELECT  = 0xC2,     /*!< T2T Sector Select                       */
+    RFAL_T2T_CMD_GET_VERSION    = 0x60,     /*!< NTAG / Ultralight EV1 Get Version       */
+    RFAL_T2T_CMD_FAST_READ      = 0x3A      /*!< NTAG / Ultralight EV1 Fast Read         */
 } rfalT2Tcmds;
 
 
@@ -107,6 +109,15 @@ typedef struct
 } rfalT2TWriteReq;
 
 
+/*! NTAG / Ultralight EV1 FAST_READ   NTAG21x 10.3 */
+typedef struct
+{
+    uint8_t code;                           /*!< Command code                            */
+    uint8_t startBlNo;                      /*!< Start block number                      */
+    uint8_t endBlNo;                        /*!< End block number (inclusive)            */
+} rfalT2TFastReadReq;
+
+
 /*! NFC-A T2T SECTOR SELECT Packet 1   T2T 1.0 5.4 and table 13 */
 typedef struct
 {
@@ -155,6 +166,59 @@ typedef struct
  }
  
  
+ /*******************************************************************************/
+ ReturnCode rfalT2TPollerFastRead( uint8_t startBlockNum, uint8_t endBlockNum, uint8_t* rxBuf, uint16_t rxBufLen, uint16_t *rcvLen )
+ {
+    ReturnCode          ret;
+    rfalT2TFastReadReq  req;
+    
+    if( (rxBuf == NULL) || (rcvLen == NULL) || (endBlockNum < startBlockNum) || (rxBufLen < (((uint16_t)endBlockNum - startBlockNum + 1U) * RFAL_T2T_BLOCK_LEN)) )
+    {
+        return ERR_PARAM;
+    }
+    
+    req.code      = (uint8_t)RFAL_T2T_CMD_FAST_READ;
+    req.startBlNo = startBlockNum;
+    req.endBlNo   = endBlockNum;
+    
+    /* Transceive Command, the whole range comes back in a single frame */
+    ret = rfalTransceiveBlockingTxRx( (uint8_t*)&req, sizeof(rfalT2TFastReadReq), rxBuf, rxBufLen, rcvLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_FDT_POLL_READ_MAX );
+    
+    /* A NACK (e.g. range beyond the memory) is treated as a Protocol Error, same as on READ */
+    if( (ret == ERR_INCOMPLETE_BYTE) && (*rcvLen == RFAL_T2T_ACK_NACK_LEN) && ((*rxBuf & RFAL_T2T_ACK_MASK) != RFAL_T2T_ACK) )
+    {
+        return ERR_PROTO;
+    }
+    return ret;
+ }
+ 
+ 
+ /*******************************************************************************/
+ ReturnCode rfalT2TPollerGetVersion( rfalT2TVersion *version )
+ {
+    ReturnCode ret;
+    uint8_t    req;
+    uint16_t   rcvLen;
+    
+    if( version == NULL )
+    {
+        return ERR_PARAM;
+    }
+    
+    req = (uint8_t)RFAL_T2T_CMD_GET_VERSION;
+    
+    /* Transceive Command */
+    ret = rfalTransceiveBlockingTxRx( &req, sizeof(uint8_t), (uint8_t*)version, sizeof(rfalT2TVersion), &rcvLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_FDT_POLL_READ_MAX );
+    
+    /* A NACK or an unexpected length means the command is not supported */
+    if( (ret == ERR_INCOMPLETE_BYTE) || ((ret == ERR_NONE) && (rcvLen != RFAL_T2T_VERSION_LEN)) )
+    {
+        return ERR_PROTO;
+    }
+    return ret;
+ }
+ 
+ 
  /*******************************************************************************/
  ReturnCode rfalT2TPollerWrite( uint8_t blockNum, const uint8_t* wrData )
  {
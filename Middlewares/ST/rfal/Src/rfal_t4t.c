@@ -70,7 +70,13 @@
 #define RFAL_T4T_LENGTH_DO          0x03U        /*!< Len value for offset BER-TLV data object          */
 #define RFAL_T4T_DATA_DO            0x53U        /*!< Tag value for data BER-TLV data object            */
 
+#define RFAL_T4T_BER_LEN_1BYTE      0x81U        /*!< BER-TLV length coded on the 1 following byte      */
+#define RFAL_T4T_BER_LEN_2BYTES     0x82U        /*!< BER-TLV length coded on the 2 following bytes     */
+#define RFAL_T4T_BER_SHORT_LEN_MAX  0x7FU        /*!< Maximum BER-TLV length coded in a single byte     */
+
 #define RFAL_T4T_MAX_LC             255U         /*!< Maximum Lc value for short Lc coding              */
+#define RFAL_T4T_MAX_LE             256U         /*!< Maximum Le value for short Le coding (00h)        */
+#define RFAL_T4T_EXT_MARKER         0x00U        /*!< Extended field coding marker byte                 */
  /*
 ******************************************************************************
 * GLOBAL TYPES
@@ -102,7 +108,9 @@
 ReturnCode rfalT4TPollerComposeCAPDU( rfalT4tCApduParam *apduParam )
 {
     uint8_t                  hdrLen;
+    uint8_t                  leLen;
     uint16_t                 msgIt;
+    bool                     extended;
     
     if( (apduParam == NULL) || (apduParam->cApduBuf == NULL) || (apduParam->cApduLen == NULL) )
     {
@@ -115,28 +123,32 @@ ReturnCode rfalT4TPollerComposeCAPDU( rfalT4tCApduParam *apduParam )
     /*******************************************************************************/
     /* Compute Command-APDU  according to the format   T4T 1.0 5.1.2 & ISO7816-4 2013 Table 1 */
     
+    /* Extended field coding applies to both Lc and Le when either exceeds short coding  ISO7816-4 2013 5.1 */
+    extended = ( (apduParam->LcFlag && (apduParam->Lc > RFAL_T4T_MAX_LC)) || (apduParam->LeFlag && (apduParam->Le > RFAL_T4T_MAX_LE)) );
+    
+    /* Le is preceded by the marker byte when extended and no Lc is present */
+    leLen = 0U;
+    if( apduParam->LeFlag )
+    {
+        leLen = ( extended ? (apduParam->LcFlag ? RFAL_T4T_LE_EXT_LEN : (RFAL_T4T_LE_EXT_LEN + 1U)) : RFAL_T4T_LE_LEN );
+    }
+    
     /* Check if Data is present */
     if( apduParam->LcFlag )
     {
         if( apduParam->Lc == 0U )
         {
-            /* Extented field coding not supported */
+            /* Lc = 0 is not a valid Data field length */
             return ERR_PARAM;
         }
         
-        /* Check whether requested Lc fits */
-        if( (uint16_t)apduParam->Lc > (uint16_t)(RFAL_FEATURE_ISO_DEP_APDU_MAX_LEN - RFAL_T4T_LE_LEN) )
-        {
-            return ERR_PARAM; /*  PRQA S  2880 # MISRA 2.1 - Unreachable code due to configuration option being set/unset  */ 
-        }
-        
         /* Calculate the header length a place the data/body where it should be */
-        hdrLen = RFAL_T4T_MAX_CAPDU_PROLOGUE_LEN + RFAL_T4T_LC_LEN;
+        hdrLen = RFAL_T4T_MAX_CAPDU_PROLOGUE_LEN + ( extended ? RFAL_T4T_LC_EXT_LEN : RFAL_T4T_LC_LEN );
         
         /* make sure not to exceed buffer size */
-        if( ((uint16_t)hdrLen + (uint16_t)apduParam->Lc + (apduParam->LeFlag ? RFAL_T4T_LC_LEN : 0U)) > RFAL_FEATURE_ISO_DEP_APDU_MAX_LEN )
+        if( ((uint32_t)hdrLen + (uint32_t)apduParam->Lc + (uint32_t)leLen) > RFAL_FEATURE_ISO_DEP_APDU_MAX_LEN )
         {
-            return ERR_NOMEM; /*  PRQA S  2880 # MISRA 2.1 - Unreachable code due to configuration option being set/unset */ 
+            return ERR_NOMEM;
         }
         ST_MEMMOVE( &apduParam->cApduBuf->apdu[hdrLen], apduParam->cApduBuf->apdu, apduParam->Lc );
     }
@@ -151,14 +163,27 @@ ReturnCode rfalT4TPollerComposeCAPDU( rfalT4tCApduParam *apduParam )
     /* Check if Data field length is to be added */
     if( apduParam->LcFlag )
     {
-        apduParam->cApduBuf->apdu[msgIt++] = apduParam->Lc;
+        if( extended )
+        {
+            apduParam->cApduBuf->apdu[msgIt++] = RFAL_T4T_EXT_MARKER;
+            apduParam->cApduBuf->apdu[msgIt++] = (uint8_t)(apduParam->Lc >> 8U);
+        }
+        apduParam->cApduBuf->apdu[msgIt++] = (uint8_t)(apduParam->Lc & 0xFFU);
         msgIt += apduParam->Lc;
     }
     
     /* Check if Expected Response Length is to be added */
     if( apduParam->LeFlag )
     {
-        apduParam->cApduBuf->apdu[msgIt++] = apduParam->Le;
+        if( extended )
+        {
+            if( !apduParam->LcFlag )
+            {
+                apduParam->cApduBuf->apdu[msgIt++] = RFAL_T4T_EXT_MARKER;
+            }
+            apduParam->cApduBuf->apdu[msgIt++] = (uint8_t)(apduParam->Le >> 8U);
+        }
+        apduParam->cApduBuf->apdu[msgIt++] = (uint8_t)(apduParam->Le & 0xFFU);  /* Le = 256 is coded as 00h */
     }
     
     *(apduParam->cApduLen) = msgIt;
@@ -275,7 +300,7 @@ ReturnCode rfalT4TPollerComposeSelectFileV1Mapping( rfalIsoDepApduBufFormat *cAp
 
 
 /*******************************************************************************/ 
-ReturnCode rfalT4TPollerComposeReadData( rfalIsoDepApduBufFormat *cApduBuf, uint16_t offset, uint8_t expLen, uint16_t *cApduLen )
+ReturnCode rfalT4TPollerComposeReadData( rfalIsoDepApduBufFormat *cApduBuf, uint16_t offset, uint16_t expLen, uint16_t *cApduLen )
 {    
     rfalT4tCApduParam cAPDU;
   
@@ -296,7 +321,7 @@ ReturnCode rfalT4TPollerComposeReadData( rfalIsoDepApduBufFormat *cApduBuf, uint
 
 
 /*******************************************************************************/ 
-ReturnCode rfalT4TPollerComposeReadDataODO( rfalIsoDepApduBufFormat *cApduBuf, uint32_t offset, uint8_t expLen, uint16_t *cApduLen )
+ReturnCode rfalT4TPollerComposeReadDataODO( rfalIsoDepApduBufFormat *cApduBuf, uint32_t offset, uint16_t expLen, uint16_t *cApduLen )
 {    
     rfalT4tCApduParam cAPDU;
     uint8_t           dataIt;
@@ -327,7 +352,7 @@ ReturnCode rfalT4TPollerComposeReadDataODO( rfalIsoDepApduBufFormat *cApduBuf, u
 
 
 /*******************************************************************************/ 
-ReturnCode rfalT4TPollerComposeWriteData( rfalIsoDepApduBufFormat *cApduBuf, uint16_t offset, const uint8_t* data, uint8_t dataLen, uint16_t *cApduLen )
+ReturnCode rfalT4TPollerComposeWriteData( rfalIsoDepApduBufFormat *cApduBuf, uint16_t offset, const uint8_t* data, uint16_t dataLen, uint16_t *cApduLen )
 {    
     rfalT4tCApduParam cAPDU;
 
@@ -344,6 +369,11 @@ ReturnCode rfalT4TPollerComposeWriteData( rfalIsoDepApduBufFormat *cApduBuf, uin
     cAPDU.cApduBuf = cApduBuf;
     cAPDU.cApduLen = cApduLen;
     
+    if( dataLen > (uint16_t)RFAL_FEATURE_ISO_DEP_APDU_MAX_LEN )
+    {
+        return ERR_NOMEM;
+    }
+    
     if( dataLen > 0U )
     {
         ST_MEMCPY( cAPDU.cApduBuf->apdu, data, dataLen );
@@ -353,13 +383,14 @@ ReturnCode rfalT4TPollerComposeWriteData( rfalIsoDepApduBufFormat *cApduBuf, uin
 }
 
 /*******************************************************************************/ 
-ReturnCode rfalT4TPollerComposeWriteDataODO( rfalIsoDepApduBufFormat *cApduBuf, uint32_t offset, const uint8_t* data, uint8_t dataLen, uint16_t *cApduLen )
+ReturnCode rfalT4TPollerComposeWriteDataODO( rfalIsoDepApduBufFormat *cApduBuf, uint32_t offset, const uint8_t* data, uint16_t dataLen, uint16_t *cApduLen )
 {    
     rfalT4tCApduParam cAPDU;
-    uint8_t           dataIt;
+    uint16_t          dataIt;
         
     /* CLA INS P1  P2   Lc  Data                     Le  */
     /* 00h D7h 00h 00h  len 54 03 xxyyzz 53 Ld data  -   */
+    /*                  Ld is BER-TLV coded: Ld | 81h Ld | 82h LdLd */
     /*                           [offset]     [data]     */
     cAPDU.CLA      = RFAL_T4T_CLA;
     cAPDU.INS      = (uint8_t)RFAL_T4T_INS_UPDATEBINARY_ODO;
@@ -377,9 +408,22 @@ ReturnCode rfalT4TPollerComposeWriteDataODO( rfalIsoDepApduBufFormat *cApduBuf,
     cApduBuf->apdu[dataIt++] = (uint8_t)(offset >> 8U);
     cApduBuf->apdu[dataIt++] = (uint8_t)(offset);
     cApduBuf->apdu[dataIt++] = RFAL_T4T_DATA_DO;
-    cApduBuf->apdu[dataIt++] = dataLen;
+    if( dataLen > 0xFFU )
+    {
+        cApduBuf->apdu[dataIt++] = RFAL_T4T_BER_LEN_2BYTES;
+        cApduBuf->apdu[dataIt++] = (uint8_t)(dataLen >> 8U);
+    }
+    else if( dataLen > RFAL_T4T_BER_SHORT_LEN_MAX )
+    {
+        cApduBuf->apdu[dataIt++] = RFAL_T4T_BER_LEN_1BYTE;
+    }
+    else
+    {
+        /* MISRA 15.7 - Empty else */
+    }
+    cApduBuf->apdu[dataIt++] = (uint8_t)(dataLen & 0xFFU);
     
-    if( (((uint32_t)dataLen + (uint32_t)dataIt) >= RFAL_T4T_MAX_LC) ||  (((uint32_t)dataLen + (uint32_t)dataIt) >= RFAL_FEATURE_ISO_DEP_APDU_MAX_LEN) )
+    if( ((uint32_t)dataLen + (uint32_t)dataIt) >= RFAL_FEATURE_ISO_DEP_APDU_MAX_LEN )
     {
         return (ERR_NOMEM);
     }
@@ -0,0 +1,394 @@
+
+/******************************************************************************
+  * \attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2019 STMicroelectronics</center></h2>
+  *
+  * Licensed under ST MYLIBERTY SOFTWARE LICENSE AGREEMENT (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        www.st.com/myliberty
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied,
+  * AND SPECIFICALLY DISCLAIMING THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+******************************************************************************/
+
+/*
+ *      PROJECT:   ST25R391x firmware
+ *      Revision:
+ *      LANGUAGE:  ISO C99
+ */
+
+/*! \file rfal_t4tCe.c
+ *
+ *  \author
+ *
+ *  \brief T4T NDEF Tag card emulation
+ *
+ *  This implementation was based on the following specs:
+ *    - ISO/IEC 7816-4  3rd Edition 2013-04-15
+ *    - NFC Forum T4T Technical Specification 1.0 2017-08-28
+ *
+ */
+
+/*
+ ******************************************************************************
+ * INCLUDES
+ ******************************************************************************
+ */
+#include "rfal_t4tCe.h"
+#include "utils.h"
+
+/*
+ ******************************************************************************
+ * ENABLE SWITCH
+ ******************************************************************************
+ */
+
+#ifndef RFAL_FEATURE_T4T_CE
+    #define RFAL_FEATURE_T4T_CE   false    /* T4T CE module configuration missing. Disabled by default */
+#endif
+
+#if RFAL_FEATURE_T4T_CE
+
+/*
+ ******************************************************************************
+ * GLOBAL DEFINES
+ ******************************************************************************
+ */
+
+#define T4TCE_CLA_POS               0U           /*!< CLA position in a C-APDU                                    */
+#define T4TCE_INS_POS               1U           /*!< INS position in a C-APDU                                    */
+#define T4TCE_P1_POS                2U           /*!< P1 position in a C-APDU                                     */
+#define T4TCE_LC_POS                4U           /*!< Lc (or short Le) position in a C-APDU                       */
+#define T4TCE_DATA_POS              5U           /*!< Data position in a C-APDU with short Lc                     */
+
+#define T4TCE_AID_LEN               7U           /*!< NDEF Tag Application name length                            */
+#define T4TCE_FID_LEN               2U           /*!< File Identifier length                                      */
+#define T4TCE_MAPPING_VERSION_2_0   0x20U        /*!< Mapping version 2.0 announced on the CC File                */
+#define T4TCE_NDEF_CTLV_T           0x04U        /*!< NDEF-File_Ctrl_TLV T field                                  */
+#define T4TCE_NDEF_CTLV_L           0x06U        /*!< NDEF-File_Ctrl_TLV L field                                  */
+#define T4TCE_AC_GRANTED            0x00U        /*!< Access condition: granted without security                  */
+#define T4TCE_AC_DENIED             0xFFU        /*!< Access condition: no access granted                         */
+#define T4TCE_OFFSET_EXT_MASK       0x80U        /*!< P1 b8 set: not an offset (SFI or ODO coding)                */
+#define T4TCE_SHORT_LE_MAX          256U         /*!< Short Le 00h stands for 256                                 */
+
+/*
+ ******************************************************************************
+ * LOCAL VARIABLES
+ ******************************************************************************
+ */
+
+static const uint8_t gT4tCeAid[T4TCE_AID_LEN] = { 0xD2U, 0x76U, 0x00U, 0x00U, 0x85U, 0x01U, 0x01U };  /*!< NDEF Tag Application  T4T 1.0  5.1.1 */
+
+/*
+ ******************************************************************************
+ * LOCAL FUNCTION PROTOTYPES
+ ******************************************************************************
+ */
+static uint16_t t4tCeSW( uint8_t *rApdu, uint16_t pos, uint16_t sw );
+static uint16_t t4tCeSelect( rfalT4tCe *ce, const uint8_t *cApdu, uint16_t cApduLen, uint8_t *rApdu );
+static uint16_t t4tCeReadBinary( const rfalT4tCe *ce, const uint8_t *cApdu, uint16_t cApduLen, uint8_t *rApdu, uint16_t rApduBufLen );
+static uint16_t t4tCeUpdateBinary( const rfalT4tCe *ce, const uint8_t *cApdu, uint16_t cApduLen, uint8_t *rApdu );
+
+/*
+ ******************************************************************************
+ * LOCAL FUNCTIONS
+ ******************************************************************************
+ */
+
+/*******************************************************************************/
+static uint16_t t4tCeSW( uint8_t *rApdu, uint16_t pos, uint16_t sw )
+{
+    rApdu[pos]      = (uint8_t)(sw >> 8);
+    rApdu[pos + 1U] = (uint8_t)(sw & 0xFFU);
+
+    return (pos + RFAL_T4T_MAX_RAPDU_SW1SW2_LEN);
+}
+
+
+/*******************************************************************************/
+static uint16_t t4tCeSelect( rfalT4tCe *ce, const uint8_t *cApdu, uint16_t cApduLen, uint8_t *rApdu )
+{
+    uint16_t fid;
+    uint8_t  lc;
+
+    /* Cmd: CLA INS P1 P2 Lc Data [Le]    Rsp: SW1 SW2 */
+    if( cApduLen <= T4TCE_LC_POS )
+    {
+        return t4tCeSW( rApdu, 0, RFAL_T4TCE_SW_WRONG_LENGTH );
+    }
+
+    lc = cApdu[T4TCE_LC_POS];
+    if( (cApduLen != (T4TCE_DATA_POS + lc)) && (cApduLen != (T4TCE_DATA_POS + lc + RFAL_T4T_LE_LEN)) )
+    {
+        return t4tCeSW( rApdu, 0, RFAL_T4TCE_SW_WRONG_LENGTH );
+    }
+
+    /*******************************************************************************/
+    /* Select by name: only the NDEF Tag Application is known. Any other name      */
+    /* selects another application, so ours is left                               */
+    if( cApdu[T4TCE_P1_POS] == RFAL_T4T_ISO7816_P1_SELECT_BY_DF_NAME )
+    {
+        ce->state = RFAL_T4TCE_ST_IDLE;
+        ce->image = ce->pending;                                     /* Swap in the last image published */
+
+        if( (lc != T4TCE_AID_LEN) || (ST_BYTECMP( &cApdu[T4TCE_DATA_POS], gT4tCeAid, T4TCE_AID_LEN ) != 0) || (ce->image == NULL) )
+        {
+            return t4tCeSW( rApdu, 0, RFAL_T4TCE_SW_NOT_FOUND );
+        }
+
+        ce->state = RFAL_T4TCE_ST_APP_SELECTED;
+        return t4tCeSW( rApdu, 0, RFAL_T4TCE_SW_OK );
+    }
+
+    /*******************************************************************************/
+    /* Select by File Identifier, only within the NDEF Tag Application             */
+    if( (cApdu[T4TCE_P1_POS] != RFAL_T4T_ISO7816_P1_SELECT_BY_FILEID) || (lc != T4TCE_FID_LEN) || (ce->state == RFAL_T4TCE_ST_IDLE) )
+    {
+        return t4tCeSW( rApdu, 0, RFAL_T4TCE_SW_NOT_FOUND );
+    }
+
+    /* The image latched on the application SELECT is kept: CC and NDEF File always come from the same one */
+    ce->state = RFAL_T4TCE_ST_APP_SELECTED;
+
+    fid = (uint16_t)GETU16( &cApdu[T4TCE_DATA_POS] );
+    if( fid == RFAL_T4TCE_FID_CC )
+    {
+        ce->state = RFAL_T4TCE_ST_CC_SELECTED;
+    }
+    else if( fid == RFAL_T4TCE_FID_NDEF )
+    {
+        ce->state = RFAL_T4TCE_ST_NDEF_SELECTED;
+    }
+    else
+    {
+        return t4tCeSW( rApdu, 0, RFAL_T4TCE_SW_NOT_FOUND );
+    }
+
+    return t4tCeSW( rApdu, 0, RFAL_T4TCE_SW_OK );
+}
+
+
+/*******************************************************************************/
+static uint16_t t4tCeReadBinary( const rfalT4tCe *ce, const uint8_t *cApdu, uint16_t cApduLen, uint8_t *rApdu, uint16_t rApduBufLen )
+{
+    const uint8_t *file;
+    uint16_t      fileLen;
+    uint16_t      offset;
+    uint16_t      len;
+
+    /* Cmd: CLA INS P1 P2 Le    Rsp: Data SW1 SW2 */
+    if( cApduLen != (T4TCE_LC_POS + RFAL_T4T_LE_LEN) )
+    {
+        return t4tCeSW( rApdu, 0, RFAL_T4TCE_SW_WRONG_LENGTH );
+    }
+
+    if( ce->state == RFAL_T4TCE_ST_CC_SELECTED )
+    {
+        file    = ce->image->ccRApdu;
+        fileLen = RFAL_T4TCE_CC_LEN;
+    }
+    else if( ce->state == RFAL_T4TCE_ST_NDEF_SELECTED )
+    {
+        file    = ce->image->file;
+        fileLen = ce->image->fileLen;
+    }
+    else
+    {
+        return t4tCeSW( rApdu, 0, RFAL_T4TCE_SW_NO_EF );
+    }
+
+    offset = (uint16_t)GETU16( &cApdu[T4TCE_P1_POS] );
+    if( ((cApdu[T4TCE_P1_POS] & T4TCE_OFFSET_EXT_MASK) != 0U) || (offset > fileLen) )
+    {
+        return t4tCeSW( rApdu, 0, RFAL_T4TCE_SW_WRONG_P1P2 );
+    }
+
+    len = ((cApdu[T4TCE_LC_POS] == 0U) ? T4TCE_SHORT_LE_MAX : (uint16_t)cApdu[T4TCE_LC_POS]);
+    len = MIN( len, RFAL_FEATURE_T4T_CE_MLE );
+    len = MIN( len, (uint16_t)(rApduBufLen - RFAL_T4T_MAX_RAPDU_SW1SW2_LEN) );
+    len = MIN( len, (uint16_t)(fileLen - offset) );
+
+    /* The CC File R-APDU is precomputed with its SW, a read up to its end is sent as is */
+    if( (ce->state == RFAL_T4TCE_ST_CC_SELECTED) && ((offset + len) == RFAL_T4TCE_CC_LEN) )
+    {
+        ST_MEMCPY( rApdu, &file[offset], (len + RFAL_T4T_MAX_RAPDU_SW1SW2_LEN) );
+        return (len + RFAL_T4T_MAX_RAPDU_SW1SW2_LEN);
+    }
+
+    /* Data is taken directly from the image, no intermediate buffer */
+    ST_MEMCPY( rApdu, &file[offset], len );
+    return t4tCeSW( rApdu, len, RFAL_T4TCE_SW_OK );
+}
+
+
+/*******************************************************************************/
+static uint16_t t4tCeUpdateBinary( const rfalT4tCe *ce, const uint8_t *cApdu, uint16_t cApduLen, uint8_t *rApdu )
+{
+    uint16_t offset;
+    uint8_t  lc;
+
+    /* Cmd: CLA INS P1 P2 Lc Data    Rsp: SW1 SW2 */
+    if( cApduLen <= T4TCE_DATA_POS )
+    {
+        return t4tCeSW( rApdu, 0, RFAL_T4TCE_SW_WRONG_LENGTH );
+    }
+
+    lc = cApdu[T4TCE_LC_POS];
+    if( (lc == 0U) || (cApduLen != (T4TCE_DATA_POS + lc)) )
+    {
+        return t4tCeSW( rApdu, 0, RFAL_T4TCE_SW_WRONG_LENGTH );
+    }
+
+    if( ce->state == RFAL_T4TCE_ST_CC_SELECTED )
+    {
+        return t4tCeSW( rApdu, 0, RFAL_T4TCE_SW_SECURITY );          /* CC File is read-only */
+    }
+
+    if( ce->state != RFAL_T4TCE_ST_NDEF_SELECTED )
+    {
+        return t4tCeSW( rApdu, 0, RFAL_T4TCE_SW_NO_EF );
+    }
+
+    if( ce->image->wrFile == NULL )
+    {
+        return t4tCeSW( rApdu, 0, RFAL_T4TCE_SW_SECURITY );
+    }
+
+    offset = (uint16_t)GETU16( &cApdu[T4TCE_P1_POS] );
+    if( ((cApdu[T4TCE_P1_POS] & T4TCE_OFFSET_EXT_MASK) != 0U) || (((uint32_t)offset + lc) > ce->image->fileLen) )
+    {
+        return t4tCeSW( rApdu, 0, RFAL_T4TCE_SW_WRONG_P1P2 );
+    }
+
+    ST_MEMCPY( &ce->image->wrFile[offset], &cApdu[T4TCE_DATA_POS], lc );
+    return t4tCeSW( rApdu, 0, RFAL_T4TCE_SW_OK );
+}
+
+
+/*
+ ******************************************************************************
+ * GLOBAL FUNCTIONS
+ ******************************************************************************
+ */
+
+/*******************************************************************************/
+ReturnCode rfalT4tCeNdefImageInit( rfalT4tCeNdefImage *img, const uint8_t *file, uint8_t *wrFile, uint16_t fileLen )
+{
+    uint8_t it;
+
+    if( (img == NULL) || (file == NULL) || (fileLen < RFAL_T4TCE_NDEF_FILE_MIN_LEN) || (fileLen > RFAL_T4TCE_NDEF_FILE_MAX_LEN) )
+    {
+        return ERR_PARAM;
+    }
+
+    if( (wrFile != NULL) && (wrFile != file) )
+    {
+        return ERR_PARAM;
+    }
+
+    img->file    = file;
+    img->wrFile  = wrFile;
+    img->fileLen = fileLen;
+
+    /* CC File  T4T 1.0  5.1.2.1: CCLEN T4T_VNo MLe MLc NDEF-File_Ctrl_TLV */
+    it = 0;
+    img->ccRApdu[it++] = 0x00U;
+    img->ccRApdu[it++] = RFAL_T4TCE_CC_LEN;
+    img->ccRApdu[it++] = T4TCE_MAPPING_VERSION_2_0;
+    img->ccRApdu[it++] = (uint8_t)(RFAL_FEATURE_T4T_CE_MLE >> 8);
+    img->ccRApdu[it++] = (uint8_t)(RFAL_FEATURE_T4T_CE_MLE & 0xFFU);
+    img->ccRApdu[it++] = (uint8_t)(RFAL_FEATURE_T4T_CE_MLC >> 8);
+    img->ccRApdu[it++] = (uint8_t)(RFAL_FEATURE_T4T_CE_MLC & 0xFFU);
+    img->ccRApdu[it++] = T4TCE_NDEF_CTLV_T;
+    img->ccRApdu[it++] = T4TCE_NDEF_CTLV_L;
+    img->ccRApdu[it++] = (uint8_t)(RFAL_T4TCE_FID_NDEF >> 8);
+    img->ccRApdu[it++] = (uint8_t)(RFAL_T4TCE_FID_NDEF & 0xFFU);
+    img->ccRApdu[it++] = (uint8_t)(fileLen >> 8);
+    img->ccRApdu[it++] = (uint8_t)(fileLen & 0xFFU);
+    img->ccRApdu[it++] = T4TCE_AC_GRANTED;
+    img->ccRApdu[it++] = ((wrFile != NULL) ? T4TCE_AC_GRANTED : T4TCE_AC_DENIED);
+    (void)t4tCeSW( img->ccRApdu, it, RFAL_T4TCE_SW_OK );
+
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+void rfalT4tCeInitialize( rfalT4tCe *ce, const rfalT4tCeNdefImage *img )
+{
+    ce->pending = img;
+    ce->image   = NULL;
+    ce->state   = RFAL_T4TCE_ST_IDLE;
+}
+
+
+/*******************************************************************************/
+void rfalT4tCeSetNdefImage( rfalT4tCe *ce, const rfalT4tCeNdefImage *img )
+{
+    /* A single pointer store: the image being served is only replaced on SELECT */
+    ce->pending = img;
+}
+
+
+/*******************************************************************************/
+const rfalT4tCeNdefImage* rfalT4tCeGetNdefImage( const rfalT4tCe *ce )
+{
+    return ce->image;
+}
+
+
+/*******************************************************************************/
+void rfalT4tCeDeactivate( rfalT4tCe *ce )
+{
+    /* No Reader is reading, the last image published can be taken into use right away */
+    ce->state = RFAL_T4TCE_ST_IDLE;
+    ce->image = ce->pending;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalT4tCeProcessCApdu( rfalT4tCe *ce, const uint8_t *cApdu, uint16_t cApduLen, uint8_t *rApdu, uint16_t rApduBufLen, uint16_t *rApduLen )
+{
+    if( (ce == NULL) || (cApdu == NULL) || (rApdu == NULL) || (rApduLen == NULL) || (cApduLen < RFAL_T4T_MAX_CAPDU_PROLOGUE_LEN) || (rApduBufLen < RFAL_T4T_MAX_RAPDU_SW1SW2_LEN) )
+    {
+        return ERR_PARAM;
+    }
+
+    if( cApdu[T4TCE_CLA_POS] != RFAL_T4T_CLA )
+    {
+        *rApduLen = t4tCeSW( rApdu, 0, RFAL_T4TCE_SW_CLA_NOT_SUPPORTED );
+        return ERR_NONE;
+    }
+
+    switch( cApdu[T4TCE_INS_POS] )
+    {
+        case (uint8_t)RFAL_T4T_INS_SELECT:
+            *rApduLen = t4tCeSelect( ce, cApdu, cApduLen, rApdu );
+            break;
+
+        case (uint8_t)RFAL_T4T_INS_READBINARY:
+            *rApduLen = t4tCeReadBinary( ce, cApdu, cApduLen, rApdu, rApduBufLen );
+            break;
+
+        case (uint8_t)RFAL_T4T_INS_UPDATEBINARY:
+            *rApduLen = t4tCeUpdateBinary( ce, cApdu, cApduLen, rApdu );
+            break;
+
+        default:
+            *rApduLen = t4tCeSW( rApdu, 0, RFAL_T4TCE_SW_INS_NOT_SUPPORTED );
+            break;
+    }
+
+    return ERR_NONE;
+}
+
+#endif /* RFAL_FEATURE_T4T_CE */
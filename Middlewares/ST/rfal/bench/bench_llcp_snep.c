@@ -0,0 +1,525 @@
+/******************************************************************************
+  * \attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2019 STMicroelectronics</center></h2>
+  *
+  * Licensed under ST MYLIBERTY SOFTWARE LICENSE AGREEMENT (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        www.st.com/myliberty
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied,
+  * AND SPECIFICALLY DISCLAIMING THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+******************************************************************************/
+
+/*
+ *      PROJECT:   ST25R391x firmware
+ *      Revision:
+ *      LANGUAGE:  ISO C99
+ */
+
+/*! \file bench_llcp_snep.c
+ *
+ *  \brief LLCP / SNEP loopback test
+ *
+ *  Runs rfal_llcp.c and rfal_snep.c on a PC with two links connected by
+ *  rfalLlcpLoopbackExchange(): an Initiator running a SNEP client and a
+ *  Target running a SNEP server (and the other way round for the
+ *  bidirectional run). Every exchange checks that:
+ *    - no frame exceeds the receiver's link MIU
+ *    - no connection has more I-PDUs unacknowledged than the remote RW
+ *
+ *  The link and data link MIU/RW taken on activation and on CONNECT/CC are
+ *  checked against the configuration, also with a peer announcing no MIUX
+ *  (default link MIU of 128). SNEP Put and Get are run for messages from
+ *  1 byte to RFAL_FEATURE_SNEP_NDEF_MAX_LEN and the received NDEF compared.
+ *  The Target may hold its frames back (answering SYMM) for some exchanges
+ *  so that acknowledgements come late and the receive window fills up.
+ *  Frames carrying more than one PDU (AGF) are counted.
+ *
+ *  Build and run from this folder, MIU, RW and NDEF size may be varied:
+ *    gcc -std=c99 -O2 -I. -I../Inc -I../../../../Drivers/BSP/Components/ST25R3911 \
+ *        [-DRFAL_FEATURE_LLCP_MIU=128U -DRFAL_FEATURE_LLCP_RW=1U -DRFAL_FEATURE_SNEP_NDEF_MAX_LEN=2048U] \
+ *        bench_llcp_snep.c ../Src/rfal_llcp.c ../Src/rfal_snep.c -o bench_llcp_snep
+ *    ./bench_llcp_snep
+ *
+ */
+
+/*
+ ******************************************************************************
+ * INCLUDES
+ ******************************************************************************
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "rfal_llcp.h"
+#include "rfal_snep.h"
+#include "rfal_nfcDep.h"
+#include "utils.h"
+
+/*
+ ******************************************************************************
+ * LOCAL DEFINES
+ ******************************************************************************
+ */
+
+#define BENCH_EXCHANGES_MAX     5000U    /*!< Exchanges after which a transfer is reported stalled      */
+#define BENCH_GET_REQ_LEN       16U      /*!< Get request NDEF length                                   */
+#define BENCH_PARAM_MIUX        0x02U    /*!< MIUX parameter type                           LLCP 1.1    */
+#define BENCH_SEQ_MASK          0x0FU    /*!< Sequence numbers are modulo 16                            */
+
+/*! Counters of one transfer */
+typedef struct
+{
+    uint32_t  exchanges;                 /*!< Symmetric exchanges                 */
+    uint32_t  frames;                    /*!< Frames sent by either side          */
+    uint32_t  agfs;                      /*!< Frames carrying more than one PDU   */
+    uint32_t  pdus;                      /*!< PDUs sent by either side            */
+    uint8_t   maxOutstanding;            /*!< Most unacknowledged I-PDUs seen     */
+} benchStats;
+
+
+/*
+ ******************************************************************************
+ * LOCAL VARIABLES
+ ******************************************************************************
+ */
+
+static rfalLlcpLink       gLinkI;        /*!< Initiator link                      */
+static rfalLlcpLink       gLinkT;        /*!< Target link                         */
+static rfalSnep           gCliI;         /*!< SNEP client on the Initiator        */
+static rfalSnep           gSrvT;         /*!< SNEP server on the Target           */
+static rfalSnep           gCliT;         /*!< SNEP client on the Target           */
+static rfalSnep           gSrvI;         /*!< SNEP server on the Initiator        */
+static rfalSnepBufFormat  gCliIBuf;      /*!< Initiator client buffer             */
+static rfalSnepBufFormat  gSrvTBuf;      /*!< Target server buffer                */
+static rfalSnepBufFormat  gCliTBuf;      /*!< Target client buffer                */
+static rfalSnepBufFormat  gSrvIBuf;      /*!< Initiator server buffer             */
+static uint8_t            gRef[RFAL_FEATURE_SNEP_NDEF_MAX_LEN];     /*!< Message sent by the Initiator */
+static uint8_t            gRefT[RFAL_FEATURE_SNEP_NDEF_MAX_LEN];    /*!< Message sent by the Target    */
+
+static benchStats         gStats;        /*!< Current transfer counters           */
+static bool               gIsFail;       /*!< A check failed                      */
+
+
+/*
+ ******************************************************************************
+ * NFC-DEP STUBS (never reached on loopback)
+ ******************************************************************************
+ */
+
+ReturnCode rfalNfcDepStartTransceive( rfalNfcDepTxRxParam *param )
+{
+    (void)param;
+    return ERR_WRONG_STATE;
+}
+
+ReturnCode rfalNfcDepGetTransceiveStatus( void )
+{
+    return ERR_WRONG_STATE;
+}
+
+
+/*
+ ******************************************************************************
+ * LOOPBACK PEER
+ ******************************************************************************
+ */
+
+/*******************************************************************************/
+static void benchCheck( bool cond, const char *what )
+{
+    if( !cond )
+    {
+        printf( "  FAIL: %s\n", what );
+        gIsFail = true;
+    }
+}
+
+
+/*******************************************************************************/
+static void benchPattern( uint8_t *buf, uint16_t len, uint8_t seed )
+{
+    uint16_t i;
+
+    for( i = 0; i < len; i++ )
+    {
+        buf[i] = (uint8_t)((i * 7U) + seed);
+    }
+}
+
+
+/*******************************************************************************/
+static void benchAccountFrame( const rfalLlcpLink *tx )
+{
+    uint16_t frameLen;
+
+    /* A single PDU is sent from the first AGF entry, see rfalLlcpGetFrame() */
+    frameLen = ((tx->txPduCnt == 1U) ? (tx->txFrameIt - RFAL_LLCP_HEADER_LEN - RFAL_LLCP_AGF_LEN_LEN) : tx->txFrameIt);
+
+    gStats.frames++;
+    gStats.pdus += tx->txPduCnt;
+    gStats.agfs += ((tx->txPduCnt > 1U) ? 1U : 0U);
+
+    benchCheck( (frameLen <= (RFAL_LLCP_HEADER_LEN + RFAL_LLCP_SEQ_LEN + tx->rLinkMiu)), "frame exceeds the remote link MIU" );
+}
+
+
+/*******************************************************************************/
+static void benchCheckWindow( const rfalLlcpLink *link )
+{
+    const rfalLlcpConn *conn;
+    uint8_t            outstanding;
+    uint8_t            i;
+
+    for( i = 0; i < RFAL_FEATURE_LLCP_CONN_MAX; i++ )
+    {
+        conn = link->conn[i];
+        if( (conn == NULL) || (conn->state != RFAL_LLCP_CONN_ST_CONNECTED) )
+        {
+            continue;
+        }
+
+        outstanding = (uint8_t)((conn->vs - conn->vsa) & BENCH_SEQ_MASK);
+        gStats.maxOutstanding = ((outstanding > gStats.maxOutstanding) ? outstanding : gStats.maxOutstanding);
+
+        benchCheck( (outstanding <= conn->rRw), "I-PDUs outstanding beyond the remote RW" );
+    }
+}
+
+
+/*******************************************************************************/
+static ReturnCode benchExchange( bool isTargetHeld )
+{
+    static const uint8_t symm[RFAL_LLCP_HEADER_LEN] = { 0x00U, 0x00U };
+    const uint8_t        *frame;
+    uint16_t             frameLen;
+    ReturnCode           ret;
+
+    gStats.exchanges++;
+
+    if( !isTargetHeld )
+    {
+        ret = rfalLlcpLoopbackExchange( &gLinkI, &gLinkT );
+
+        benchAccountFrame( &gLinkI );
+        if( ret == ERR_NONE )
+        {
+            benchAccountFrame( &gLinkT );
+        }
+    }
+    else
+    {
+        /* Target keeps its frame (and acknowledgements) for later, answers SYMM */
+        ret = rfalLlcpGetFrame( &gLinkI, &frame, &frameLen );
+        if( ret == ERR_NONE )
+        {
+            benchAccountFrame( &gLinkI );
+            ret = rfalLlcpProcessFrame( &gLinkT, frame, frameLen );
+        }
+        if( ret == ERR_NONE )
+        {
+            ret = rfalLlcpProcessFrame( &gLinkI, symm, sizeof(symm) );
+        }
+    }
+
+    benchCheckWindow( &gLinkI );
+    benchCheckWindow( &gLinkT );
+
+    return ret;
+}
+
+
+/*******************************************************************************/
+static void benchSettle( void )
+{
+    uint8_t i;
+
+    /* Let DISC / DM go through before the client connection is reused */
+    for( i = 0; i < 8U; i++ )
+    {
+        (void)benchExchange( false );
+    }
+}
+
+
+/*******************************************************************************/
+static uint8_t benchStripMiux( const uint8_t *gb, uint8_t gbLen, uint8_t *out )
+{
+    uint8_t it;
+    uint8_t outLen;
+
+    ST_MEMCPY( out, gb, RFAL_LLCP_MAGIC_LEN );
+    outLen = RFAL_LLCP_MAGIC_LEN;
+
+    for( it = RFAL_LLCP_MAGIC_LEN; (it + 2U) <= gbLen; it += (2U + gb[it + 1U]) )
+    {
+        if( gb[it] != BENCH_PARAM_MIUX )
+        {
+            ST_MEMCPY( &out[outLen], &gb[it], (2U + gb[it + 1U]) );
+            outLen += (2U + gb[it + 1U]);
+        }
+    }
+    return outLen;
+}
+
+
+/*******************************************************************************/
+static void benchLinkUp( bool isPeerMiuDefault )
+{
+    uint8_t gbI[RFAL_LLCP_GB_MAX_LEN];
+    uint8_t gbT[RFAL_LLCP_GB_MAX_LEN];
+    uint8_t gbPeer[RFAL_LLCP_GB_MAX_LEN];
+    uint8_t gbILen;
+    uint8_t gbTLen;
+    uint8_t gbPeerLen;
+
+    rfalLlcpInitialize( &gLinkI );
+    rfalLlcpInitialize( &gLinkT );
+
+    /* Servers before the General Bytes to be announced on WKS */
+    benchCheck( (rfalSnepServerStart( &gSrvT, &gLinkT, &gSrvTBuf ) == ERR_NONE), "Target server start" );
+    benchCheck( (rfalSnepServerStart( &gSrvI, &gLinkI, &gSrvIBuf ) == ERR_NONE), "Initiator server start" );
+
+    gbILen = rfalLlcpGetGeneralBytes( &gLinkI, gbI );
+    gbTLen = rfalLlcpGetGeneralBytes( &gLinkT, gbT );
+
+    /* Optionally the Initiator sees a Target announcing no MIUX: link MIU 128 */
+    gbPeerLen = (isPeerMiuDefault ? benchStripMiux( gbT, gbTLen, gbPeer ) : gbTLen);
+    if( !isPeerMiuDefault )
+    {
+        ST_MEMCPY( gbPeer, gbT, gbTLen );
+    }
+
+    benchCheck( (rfalLlcpActivateLoopback( &gLinkI, gbPeer, gbPeerLen, true ) == ERR_NONE), "Initiator activation" );
+    benchCheck( (rfalLlcpActivateLoopback( &gLinkT, gbI, gbILen, false ) == ERR_NONE), "Target activation" );
+
+    /* Link parameters  LLCP 1.1  5.2.2 */
+    benchCheck( (gLinkI.rLinkMiu == (isPeerMiuDefault ? RFAL_LLCP_MIU_DEFAULT : RFAL_FEATURE_LLCP_MIU)), "Initiator link MIU" );
+    benchCheck( (gLinkT.rLinkMiu == RFAL_FEATURE_LLCP_MIU), "Target link MIU" );
+    benchCheck( (gLinkI.version == RFAL_LLCP_VERSION) && (gLinkT.version == RFAL_LLCP_VERSION), "version" );
+    benchCheck( ((gLinkI.rWks & (1U << RFAL_LLCP_SAP_SNEP)) != 0U) && ((gLinkT.rWks & (1U << RFAL_LLCP_SAP_SNEP)) != 0U), "SNEP on WKS" );
+}
+
+
+/*******************************************************************************/
+static void benchCheckConnParams( const rfalSnep *cli, const rfalSnep *srv )
+{
+    /* Data link parameters  LLCP 1.1  5.6.1  CONNECT / CC carry MIUX and RW */
+    /* The client's I-PDUs are also bound by the link MIU the Target announced */
+    benchCheck( (cli->conn.rMiu == MIN( RFAL_FEATURE_LLCP_MIU, gLinkI.rLinkMiu )) && (srv->conn.rMiu == RFAL_FEATURE_LLCP_MIU), "data link MIU" );
+    benchCheck( (cli->conn.rRw == RFAL_FEATURE_LLCP_RW) && (srv->conn.rRw == RFAL_FEATURE_LLCP_RW), "data link RW" );
+}
+
+
+/*******************************************************************************/
+static void benchPrint( const char *op, uint16_t len, uint8_t hold )
+{
+    printf( "%-5s %6u %5u %10u %7u %6u %5u %12u   %s\n", op, len, hold, gStats.exchanges, gStats.frames, gStats.pdus, gStats.agfs, gStats.maxOutstanding, (gIsFail ? "FAIL" : "ok") );
+}
+
+
+/*******************************************************************************/
+static bool benchTransfer( bool isGet, uint16_t len, uint8_t hold )
+{
+    ReturnCode cliRet;
+    ReturnCode srvRet;
+    uint16_t   rspLen;
+    uint16_t   rxLen;
+    bool       isRx;
+    bool       isParamsChecked;
+
+    ST_MEMSET( &gStats, 0x00, sizeof(gStats) );
+    gIsFail         = false;
+    isRx            = false;
+    isParamsChecked = false;
+    rxLen           = 0;
+    rspLen          = 0;
+
+    if( isGet )
+    {
+        benchPattern( gRef, len, 0x5AU );
+        benchPattern( gCliIBuf.ndef, BENCH_GET_REQ_LEN, 0xA5U );
+        rfalSnepServerSetGetResponse( &gSrvT, ((len > 0U) ? gRef : NULL), len );
+        benchCheck( (rfalSnepClientGet( &gCliI, &gLinkI, &gCliIBuf, BENCH_GET_REQ_LEN, &rspLen ) == ERR_NONE), "Get start" );
+    }
+    else
+    {
+        benchPattern( gRef, len, (uint8_t)len );
+        ST_MEMCPY( gCliIBuf.ndef, gRef, len );
+        benchCheck( (rfalSnepClientPut( &gCliI, &gLinkI, &gCliIBuf, len ) == ERR_NONE), "Put start" );
+    }
+
+    do
+    {
+        benchCheck( (benchExchange( ((hold > 0U) && ((gStats.exchanges % (hold + 1U)) != hold)) ) == ERR_NONE), "exchange" );
+
+        srvRet = rfalSnepServerGetStatus( &gSrvT, &rxLen );
+        if( srvRet == ERR_NONE )
+        {
+            isRx = true;
+            benchCheck( (rxLen == len) && (memcmp( gSrvTBuf.ndef, gRef, len ) == 0), "Put message received" );
+        }
+
+        if( !isParamsChecked && (gCliI.conn.state == RFAL_LLCP_CONN_ST_CONNECTED) && (gSrvT.conn.state == RFAL_LLCP_CONN_ST_CONNECTED) )
+        {
+            isParamsChecked = true;
+            benchCheckConnParams( &gCliI, &gSrvT );
+        }
+
+        cliRet = rfalSnepClientGetStatus( &gCliI );
+    }
+    while( (cliRet == ERR_BUSY) && (gStats.exchanges < BENCH_EXCHANGES_MAX) );
+
+    benchCheck( (cliRet != ERR_BUSY), "transfer stalled" );
+
+    if( isGet && (len == 0U) )
+    {
+        benchCheck( (cliRet == ERR_REQUEST), "Get without response answered Not Implemented" );
+    }
+    else
+    {
+        benchCheck( (cliRet == ERR_NONE), "client Success" );
+        benchCheck( isGet || isRx, "Put reported by the server" );
+        benchCheck( !isGet || ((rspLen == len) && (memcmp( gCliIBuf.ndef, gRef, len ) == 0)), "Get response received" );
+    }
+
+    benchPrint( (isGet ? "GET" : "PUT"), len, hold );
+    benchSettle();
+
+    return !gIsFail;
+}
+
+
+/*******************************************************************************/
+static bool benchBidirectional( uint16_t len )
+{
+    ReturnCode retI;
+    ReturnCode retT;
+    uint16_t   rxLen;
+    uint8_t    rxCnt;
+
+    ST_MEMSET( &gStats, 0x00, sizeof(gStats) );
+    gIsFail = false;
+    retI    = ERR_BUSY;
+    retT    = ERR_BUSY;
+    rxCnt   = 0;
+
+    /* Both sides Put at once: I-PDUs of one connection share frames with the other's RR/I-PDUs */
+    benchPattern( gRef,  len, 0x11U );
+    benchPattern( gRefT, len, 0x22U );
+    ST_MEMCPY( gCliIBuf.ndef, gRef,  len );
+    ST_MEMCPY( gCliTBuf.ndef, gRefT, len );
+    benchCheck( (rfalSnepClientPut( &gCliI, &gLinkI, &gCliIBuf, len ) == ERR_NONE), "Initiator Put start" );
+    benchCheck( (rfalSnepClientPut( &gCliT, &gLinkT, &gCliTBuf, len ) == ERR_NONE), "Target Put start" );
+
+    do
+    {
+        benchCheck( (benchExchange( false ) == ERR_NONE), "exchange" );
+
+        if( rfalSnepServerGetStatus( &gSrvT, &rxLen ) == ERR_NONE )
+        {
+            rxCnt++;
+            benchCheck( (rxLen == len) && (memcmp( gSrvTBuf.ndef, gRef, len ) == 0), "Initiator Put received" );
+        }
+        if( rfalSnepServerGetStatus( &gSrvI, &rxLen ) == ERR_NONE )
+        {
+            rxCnt++;
+            benchCheck( (rxLen == len) && (memcmp( gSrvIBuf.ndef, gRefT, len ) == 0), "Target Put received" );
+        }
+
+        retI = ((retI == ERR_BUSY) ? rfalSnepClientGetStatus( &gCliI ) : retI);
+        retT = ((retT == ERR_BUSY) ? rfalSnepClientGetStatus( &gCliT ) : retT);
+    }
+    while( ((retI == ERR_BUSY) || (retT == ERR_BUSY)) && (gStats.exchanges < BENCH_EXCHANGES_MAX) );
+
+    benchCheck( (retI == ERR_NONE) && (retT == ERR_NONE) && (rxCnt == 2U), "both Puts delivered" );
+    benchCheck( (gStats.agfs > 0U), "aggregated frames sent" );
+
+    benchPrint( "PUT2", len, 0U );
+    benchSettle();
+
+    return !gIsFail;
+}
+
+
+/*
+ ******************************************************************************
+ * MAIN
+ ******************************************************************************
+ */
+
+int main( void )
+{
+    static const uint8_t holds[] = { 0U, RFAL_FEATURE_LLCP_RW + 1U };
+    uint16_t             sizes[6];
+    bool                 isOk;
+    uint8_t              peer;
+    uint8_t              h;
+    uint8_t              s;
+    uint8_t              rw;
+
+    sizes[0] = 1U;
+    sizes[1] = (uint16_t)(RFAL_FEATURE_LLCP_MIU - RFAL_SNEP_HEADER_LEN);     /* Single I-PDU with the header */
+    sizes[2] = (uint16_t)RFAL_FEATURE_LLCP_MIU;                              /* Header spills, Continue      */
+    sizes[3] = (uint16_t)((2U * RFAL_FEATURE_LLCP_MIU) + 1U);
+    sizes[4] = (uint16_t)(RFAL_FEATURE_SNEP_NDEF_MAX_LEN - RFAL_SNEP_ACCEPT_LEN_LEN);
+    sizes[5] = (uint16_t)RFAL_FEATURE_SNEP_NDEF_MAX_LEN;
+
+    rw   = (uint8_t)((RFAL_FEATURE_LLCP_RW < RFAL_LLCP_RW_MAX) ? RFAL_FEATURE_LLCP_RW : RFAL_LLCP_RW_MAX);
+    isOk = true;
+
+    printf( "LLCP/SNEP loopback  MIU %u  RW %u  SNEP NDEF max %u\n", (unsigned)RFAL_FEATURE_LLCP_MIU, (unsigned)rw, (unsigned)RFAL_FEATURE_SNEP_NDEF_MAX_LEN );
+
+    for( peer = 0; peer < 2U; peer++ )
+    {
+        printf( "\nPeer link MIU %s\n", ((peer == 0U) ? "as configured" : "default (no MIUX)") );
+        printf( "op      size  hold  exchanges  frames   pdus   agf  outstanding\n" );
+
+        gIsFail = false;
+        benchLinkUp( (peer != 0U) );
+        isOk = (isOk && !gIsFail);
+
+        for( h = 0; h < sizeof(holds); h++ )
+        {
+            for( s = 0; s < (sizeof(sizes) / sizeof(sizes[0])); s++ )
+            {
+                isOk = (benchTransfer( false, sizes[s], holds[h] ) && isOk);
+            }
+
+            /* Acknowledgements held back long enough on the largest Put: the window must have filled up */
+            if( (holds[h] > rw) && (((uint32_t)sizes[5] + RFAL_SNEP_HEADER_LEN) > (rw * (uint32_t)RFAL_FEATURE_LLCP_MIU)) )
+            {
+                gIsFail = false;
+                benchCheck( (gStats.maxOutstanding == rw), "receive window filled" );
+                isOk = (isOk && !gIsFail);
+            }
+
+            for( s = 0; s < (sizeof(sizes) / sizeof(sizes[0])); s++ )
+            {
+                isOk = (benchTransfer( true, sizes[s], holds[h] ) && isOk);
+            }
+        }
+
+        isOk = (benchTransfer( true, 0U, 0U ) && isOk);
+        isOk = (benchBidirectional( 12U ) && isOk);
+        isOk = (benchBidirectional( sizes[5] ) && isOk);
+
+        /* LLCP 1.1  5.5  Link deactivation */
+        gIsFail = false;
+        rfalLlcpDeactivate( &gLinkI );
+        benchCheck( (benchExchange( false ) == ERR_RELEASE_REQ), "link deactivation" );
+        isOk = (isOk && !gIsFail);
+    }
+
+    printf( "\n%s\n", (isOk ? "PASS" : "FAIL") );
+    return (isOk ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,659 @@
+
+/******************************************************************************
+  * \attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2019 STMicroelectronics</center></h2>
+  *
+  * Licensed under ST MYLIBERTY SOFTWARE LICENSE AGREEMENT (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        www.st.com/myliberty
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied,
+  * AND SPECIFICALLY DISCLAIMING THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+******************************************************************************/
+
+/*
+ *      PROJECT:   ST25R391x firmware
+ *      Revision:
+ *      LANGUAGE:  ISO C99
+ */
+
+/*! \file bench_nfca_colres.c
+ *
+ *  \brief NFC-A Full Collision Resolution benchmark
+ *
+ *  Runs rfal_nfca.c on a PC against a simulated field of 1 to 100 PICCs
+ *  and reports, per population, the frames sent (SENS_REQ/ALL_REQ, SDD_REQ,
+ *  SEL_REQ, SLP_REQ), the timeouts and the resulting time, averaged over
+ *  50 fields. Every run checks that all PICCs were found exactly once
+ *  and that each device entry carries the RSSI of its own PICC.
+ *
+ *  Each PICC runs the ISO14443-3 state machine (IDLE, READY per cascade
+ *  level, ACTIVE, HALT). Two populations are simulated: 7 byte UIDs only
+ *  and a mix of 4, 7 and 10 byte UIDs. Both the NFC and ISO compliance
+ *  modes are run, preceded by rfalNfcaPollerTechnologyDetection() as done
+ *  by rfalNfcWorker().
+ *
+ *  Time is an estimate at 106 kbps: frame durations (9 bits per byte) plus
+ *  a fixed turnaround per frame, and the FWT of each frame not answered
+ *  (1 ms for SLP_REQ, which dominates).
+ *
+ *  Build and run from this folder:
+ *    gcc -std=c99 -O2 -I. -I../Inc -I../../../../Drivers/BSP/Components/ST25R3911 \
+ *        bench_nfca_colres.c ../Src/rfal_nfca.c -o bench_nfca_colres
+ *    ./bench_nfca_colres
+ *
+ */
+
+/*
+ ******************************************************************************
+ * INCLUDES
+ ******************************************************************************
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "rfal_nfca.h"
+#include "rfal_rf.h"
+
+/*
+ ******************************************************************************
+ * LOCAL DEFINES
+ ******************************************************************************
+ */
+
+#define BENCH_MAX_TAGS          100U     /*!< Max simulated PICCs on the field                          */
+#define BENCH_RUNS              50U      /*!< Fields simulated per population                           */
+#define BENCH_CL_LEN            5U       /*!< Cascade level data: 4 UID bytes (or CT + 3) and BCC       */
+#define BENCH_CL_BITS           56U      /*!< SEL_CMD + SEL_PAR + CL data, in bits                      */
+#define BENCH_SDD_HDR_BITS      16U      /*!< SEL_CMD + SEL_PAR, in bits                                */
+#define BENCH_SEL_CL1           0x93U    /*!< SEL_CMD cascade level 1                       ISO14443-3  */
+#define BENCH_SEL_CL2           0x95U    /*!< SEL_CMD cascade level 2                       ISO14443-3  */
+#define BENCH_SEL_CL3           0x97U    /*!< SEL_CMD cascade level 3                       ISO14443-3  */
+#define BENCH_SDD_CT            0x88U    /*!< Cascade Tag                                   ISO14443-3  */
+
+#define BENCH_BIT_US            9.44     /*!< Bit duration at 106 kbps                                  */
+#define BENCH_PARITY            1.125    /*!< Parity overhead: 9 bits sent per byte                     */
+#define BENCH_TURN_US           150.0    /*!< Poller turnaround before each frame                       */
+#define BENCH_FDT_US            86.0     /*!< PICC frame delay before its response                      */
+#define BENCH_FWT_US            100.0    /*!< Wait for a response that does not come                    */
+#define BENCH_SLP_FWT_US        1000.0   /*!< RFAL_NFCA_SLP_FWT: SLP_REQ is never answered              */
+
+/*! PICC states  ISO14443-3  6.3 */
+typedef enum
+{
+    BENCH_ST_IDLE,
+    BENCH_ST_READY,
+    BENCH_ST_ACTIVE,
+    BENCH_ST_HALT
+} benchPiccState;
+
+/*! Simulated PICC */
+typedef struct
+{
+    uint8_t         uid[RFAL_NFCA_CASCADE_3_UID_LEN];  /*!< UID                                 */
+    uint8_t         uidLen;                            /*!< UID length                          */
+    uint8_t         clData[3][BENCH_CL_LEN];           /*!< Data answered on each cascade level */
+    uint8_t         clCnt;                             /*!< Number of cascade levels            */
+    uint8_t         cl;                                /*!< Current cascade level               */
+    benchPiccState  st;                                /*!< State                               */
+    uint16_t        rssi;                              /*!< RSSI its responses are received at  */
+} benchPicc;
+
+
+/*
+ ******************************************************************************
+ * LOCAL VARIABLES
+ ******************************************************************************
+ */
+
+static benchPicc  gPicc[BENCH_MAX_TAGS];  /*!< Simulated PICCs                         */
+static uint8_t    gTagCnt;                /*!< Simulated PICCs on the field            */
+static ReturnCode gRet;                   /*!< Outcome of the last frame               */
+static uint16_t   gRssi;                  /*!< RSSI of the last response               */
+
+static uint32_t   gShorts;                /*!< SENS_REQ / ALL_REQ sent                 */
+static uint32_t   gSdds;                  /*!< SDD_REQ sent                            */
+static uint32_t   gSels;                  /*!< SEL_REQ sent                            */
+static uint32_t   gSlps;                  /*!< SLP_REQ sent                            */
+static uint32_t   gTimeouts;              /*!< Frames not answered                     */
+static double     gTimeUs;                /*!< Time spent (us)                         */
+
+
+/*
+ ******************************************************************************
+ * SIMULATED FIELD
+ ******************************************************************************
+ */
+
+/*******************************************************************************/
+static void benchCost( uint16_t txBits, uint16_t rxBits, double fwtUs )
+{
+    gTimeUs += (BENCH_TURN_US + (txBits * BENCH_BIT_US * BENCH_PARITY));
+
+    if( fwtUs > 0.0 )
+    {
+        gTimeUs += fwtUs;
+        gTimeouts++;
+    }
+    else
+    {
+        gTimeUs += (BENCH_FDT_US + (rxBits * BENCH_BIT_US * BENCH_PARITY));
+    }
+}
+
+
+/*******************************************************************************/
+static uint8_t benchGetBit( const uint8_t *buf, uint16_t pos )
+{
+    return (uint8_t)((buf[(pos / 8U)] >> (pos % 8U)) & 0x01U);
+}
+
+
+/*******************************************************************************/
+static void benchSetBit( uint8_t *buf, uint16_t pos, uint8_t val )
+{
+    if( val != 0U )
+    {
+        buf[(pos / 8U)] |= (uint8_t)(1U << (pos % 8U));
+    }
+    else
+    {
+        buf[(pos / 8U)] &= (uint8_t)~(1U << (pos % 8U));
+    }
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalISO14443AStartTransceiveShortFrame( rfal14443AShortFrameCmd txCmd, uint8_t* rxBuf, uint8_t rxBufLen, uint16_t* rxRcvdLen, uint32_t fwt )
+{
+    uint16_t atqa;
+    uint16_t a;
+    uint16_t diff;
+    uint8_t  n;
+    uint8_t  i;
+
+    (void)rxBufLen;
+    (void)fwt;
+
+    gShorts++;
+    n    = 0;
+    atqa = 0;
+    diff = 0;
+
+    for( i = 0; i < gTagCnt; i++ )
+    {
+        if( (gPicc[i].st == BENCH_ST_IDLE) || ((txCmd == RFAL_14443A_SHORTFRAME_CMD_WUPA) && (gPicc[i].st == BENCH_ST_HALT)) )
+        {
+            /* ATQA with the UID size bits  ISO14443-3  6.5.2.1 */
+            a = ((gPicc[i].uidLen == RFAL_NFCA_CASCADE_1_UID_LEN) ? 0x0004U : ((gPicc[i].uidLen == RFAL_NFCA_CASCADE_2_UID_LEN) ? 0x0044U : 0x0084U));
+            if( n != 0U )
+            {
+                diff |= (uint16_t)(a ^ atqa);
+            }
+            atqa |= a;
+            n++;
+
+            gPicc[i].st = BENCH_ST_READY;
+            gPicc[i].cl = 0;
+        }
+        else if( (gPicc[i].st == BENCH_ST_READY) || (gPicc[i].st == BENCH_ST_ACTIVE) )
+        {
+            gPicc[i].st = BENCH_ST_IDLE;                       /* Unexpected command */
+        }
+        else
+        {
+            /* HALT PICCs ignore REQA */
+        }
+    }
+
+    if( n == 0U )
+    {
+        *rxRcvdLen = 0;
+        gRet       = ERR_TIMEOUT;
+        benchCost( 7U, 0U, BENCH_FWT_US );
+        return ERR_NONE;
+    }
+
+    rxBuf[0]   = (uint8_t)atqa;
+    rxBuf[1]   = (uint8_t)(atqa >> 8U);
+    *rxRcvdLen = 16U;
+    gRet       = ((diff != 0U) ? ERR_RF_COLLISION : ERR_NONE);
+    benchCost( 7U, 16U, 0.0 );
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalISO14443AGetTransceiveShortFrameStatus( void )
+{
+    return gRet;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalISO14443AStartTransceiveAnticollisionFrame( uint8_t *buf, uint8_t *bytesToSend, uint8_t *bitsToSend, uint16_t *rxLength, uint32_t fwt )
+{
+    uint8_t  resp[BENCH_MAX_TAGS];
+    uint8_t  nResp;
+    uint8_t  lvl;
+    uint8_t  i;
+    uint8_t  k;
+    uint8_t  v;
+    uint16_t txBits;
+    uint16_t b;
+    uint16_t col;
+    bool     match;
+
+    (void)fwt;
+
+    gSdds++;
+    txBits = (uint16_t)((*bytesToSend * 8U) + *bitsToSend);
+    lvl    = (uint8_t)((buf[0] - BENCH_SEL_CL1) / 2U);
+    nResp  = 0;
+
+    if( buf[1] != (uint8_t)((*bytesToSend << 4U) | *bitsToSend) )
+    {
+        printf( "SEL_PAR does not match the bits sent\r\n" );
+        exit( 1 );
+    }
+
+    /* PICCs READY on this cascade level whose data starts with the bits sent answer */
+    for( i = 0; i < gTagCnt; i++ )
+    {
+        if( (gPicc[i].st != BENCH_ST_READY) || (gPicc[i].cl != lvl) )
+        {
+            continue;
+        }
+
+        match = true;
+        for( b = BENCH_SDD_HDR_BITS; b < txBits; b++ )
+        {
+            if( benchGetBit( gPicc[i].clData[lvl], (b - BENCH_SDD_HDR_BITS) ) != benchGetBit( buf, b ) )
+            {
+                match = false;
+                break;
+            }
+        }
+
+        if( match )
+        {
+            resp[nResp++] = i;
+        }
+    }
+
+    if( nResp == 0U )
+    {
+        *rxLength = 0;
+        gRet      = ERR_TIMEOUT;
+        benchCost( txBits, 0U, BENCH_FWT_US );
+        return ERR_NONE;
+    }
+
+    /* Find the first bit where the answers differ */
+    col = BENCH_CL_BITS;
+    for( b = txBits; (b < BENCH_CL_BITS) && (col == BENCH_CL_BITS); b++ )
+    {
+        for( k = 1; k < nResp; k++ )
+        {
+            if( benchGetBit( gPicc[resp[k]].clData[lvl], (b - BENCH_SDD_HDR_BITS) ) != benchGetBit( gPicc[resp[0]].clData[lvl], (b - BENCH_SDD_HDR_BITS) ) )
+            {
+                col = b;
+                break;
+            }
+        }
+    }
+
+    /* Bits received: the common ones, then the wired-OR of all answers */
+    for( b = txBits; b < BENCH_CL_BITS; b++ )
+    {
+        v = 0;
+        for( k = 0; k < ((b < col) ? 1U : nResp); k++ )
+        {
+            v |= benchGetBit( gPicc[resp[k]].clData[lvl], (b - BENCH_SDD_HDR_BITS) );
+        }
+        benchSetBit( buf, b, v );
+    }
+
+    if( col < BENCH_CL_BITS )
+    {
+        *bytesToSend = (uint8_t)(col / 8U);
+        *bitsToSend  = (uint8_t)(col % 8U);
+        gRet         = ERR_RF_COLLISION;
+    }
+    else
+    {
+        gRet         = ERR_NONE;
+    }
+
+    *rxLength = (uint16_t)(BENCH_CL_BITS - txBits);
+    benchCost( txBits, *rxLength, 0.0 );
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalISO14443AGetTransceiveAnticollisionFrameStatus( void )
+{
+    return gRet;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalStartTransceive( const rfalTransceiveContext *ctx )
+{
+    const uint8_t *tx;
+    uint16_t      txLen;
+    uint8_t       lvl;
+    uint8_t       i;
+    uint8_t       n;
+    int16_t       sak;
+    int16_t       s;
+    bool          sakErr;
+
+    tx    = ctx->txBuf;
+    txLen = (uint16_t)rfalConvBitsToBytes( ctx->txBufLen );
+
+    /* SLP_REQ (HLTA) */
+    if( (txLen == 2U) && (tx[0] == 0x50U) )
+    {
+        gSlps++;
+        for( i = 0; i < gTagCnt; i++ )
+        {
+            if( gPicc[i].st == BENCH_ST_ACTIVE )
+            {
+                gPicc[i].st = BENCH_ST_HALT;
+            }
+            else if( gPicc[i].st == BENCH_ST_READY )
+            {
+                gPicc[i].st = BENCH_ST_IDLE;
+            }
+            else
+            {
+                /* Not addressed */
+            }
+        }
+        gRet = ERR_TIMEOUT;
+        benchCost( 16U, 0U, BENCH_SLP_FWT_US );
+        return ERR_NONE;
+    }
+
+    /* SEL_REQ */
+    if( (txLen == (2U + BENCH_CL_LEN)) && (tx[1] == 0x70U) && ((tx[0] == BENCH_SEL_CL1) || (tx[0] == BENCH_SEL_CL2) || (tx[0] == BENCH_SEL_CL3)) )
+    {
+        gSels++;
+        lvl    = (uint8_t)((tx[0] - BENCH_SEL_CL1) / 2U);
+        n      = 0;
+        sak    = -1;
+        sakErr = false;
+
+        for( i = 0; i < gTagCnt; i++ )
+        {
+            if( gPicc[i].st != BENCH_ST_READY )
+            {
+                continue;
+            }
+
+            if( (gPicc[i].cl == lvl) && (memcmp( gPicc[i].clData[lvl], &tx[2], BENCH_CL_LEN ) == 0) )
+            {
+                s = (((lvl + 1U) < gPicc[i].clCnt) ? 0x04 : 0x00);      /* Cascade bit: UID not complete */
+                if( (sak >= 0) && (s != sak) )
+                {
+                    sakErr = true;
+                }
+                sak   = s;
+                gRssi = gPicc[i].rssi;
+                n++;
+
+                if( (lvl + 1U) < gPicc[i].clCnt )
+                {
+                    gPicc[i].cl++;
+                }
+                else
+                {
+                    gPicc[i].st = BENCH_ST_ACTIVE;
+                }
+            }
+            else
+            {
+                gPicc[i].st = BENCH_ST_IDLE;
+            }
+        }
+
+        if( n == 0U )
+        {
+            gRet = ERR_TIMEOUT;
+            benchCost( BENCH_CL_BITS, 0U, BENCH_FWT_US );
+            return ERR_NONE;
+        }
+
+        ctx->rxBuf[0]   = (uint8_t)sak;
+        *ctx->rxRcvdLen = 8U;
+        gRet            = (sakErr ? ERR_CRC : ERR_NONE);
+        benchCost( (BENCH_CL_BITS + 16U), 24U, 0.0 );
+        return ERR_NONE;
+    }
+
+    printf( "Unexpected frame %02X, %u bytes\r\n", tx[0], txLen );
+    exit( 1 );
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalGetTransceiveStatus( void )
+{
+    return gRet;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalGetTransceiveRSSI( uint16_t *rssi )
+{
+    *rssi = gRssi;
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+/* Remaining RF services used by rfal_nfca.c, not exercised by the benchmark   */
+/*******************************************************************************/
+void rfalWorker( void ) { }
+void rfalSetErrorHandling( rfalEHandling eHandling ) { (void)eHandling; }
+void rfalSetGT( uint32_t GT ) { (void)GT; }
+void rfalSetFDTListen( uint32_t FDTListen ) { (void)FDTListen; }
+void rfalSetFDTPoll( uint32_t FDTPoll ) { (void)FDTPoll; }
+ReturnCode rfalSetMode( rfalMode mode, rfalBitRate txBR, rfalBitRate rxBR ) { (void)mode; (void)txBR; (void)rxBR; return ERR_NONE; }
+ReturnCode rfalTransceiveBlockingTxRx( uint8_t *txBuf, uint16_t txBufLen, uint8_t *rxBuf, uint16_t rxBufLen, uint16_t *actLen, uint32_t flags, uint32_t fwt )
+{
+    (void)txBuf; (void)txBufLen; (void)rxBuf; (void)rxBufLen; (void)actLen; (void)flags; (void)fwt;
+    printf( "Unexpected blocking transceive\r\n" );
+    exit( 1 );
+}
+
+
+/*
+ ******************************************************************************
+ * BENCHMARK
+ ******************************************************************************
+ */
+
+/*******************************************************************************/
+static void benchPiccInit( benchPicc *picc, uint8_t uidLen )
+{
+    uint8_t i;
+    uint8_t l;
+    uint8_t o;
+    uint8_t *d;
+
+    picc->uidLen = uidLen;
+    for( i = 0; i < uidLen; i++ )
+    {
+        picc->uid[i] = (uint8_t)rand();
+    }
+    if( uidLen > RFAL_NFCA_CASCADE_1_UID_LEN )
+    {
+        picc->uid[0] = (uint8_t)(0x04U + ((uint8_t)rand() % 2U));      /* Few manufacturers share the field */
+    }
+
+    /* Split the UID on cascade levels with Cascade Tag and BCC  ISO14443-3  6.5.4 */
+    picc->clCnt = ((uidLen == RFAL_NFCA_CASCADE_1_UID_LEN) ? 1U : ((uidLen == RFAL_NFCA_CASCADE_2_UID_LEN) ? 2U : 3U));
+    o = 0;
+    for( l = 0; l < picc->clCnt; l++ )
+    {
+        d = picc->clData[l];
+        if( (l + 1U) < picc->clCnt )
+        {
+            d[0] = BENCH_SDD_CT;
+            memcpy( &d[1], &picc->uid[o], 3U );
+            o += 3U;
+        }
+        else
+        {
+            if( picc->uid[o] == BENCH_SDD_CT )
+            {
+                picc->uid[o] = 0x08U;                                    /* CT is not a valid first byte */
+            }
+            memcpy( d, &picc->uid[o], 4U );
+        }
+        d[4] = (uint8_t)(d[0] ^ d[1] ^ d[2] ^ d[3]);
+    }
+
+    picc->st = BENCH_ST_IDLE;
+    picc->cl = 0;
+}
+
+
+/*******************************************************************************/
+static void benchField( uint8_t tagCnt, bool mixed, uint32_t seed )
+{
+    uint8_t i;
+    uint8_t j;
+
+    srand( seed );
+    gTagCnt = tagCnt;
+
+    for( i = 0; i < tagCnt; i++ )
+    {
+        benchPiccInit( &gPicc[i], (mixed ? ((uint8_t[]){ RFAL_NFCA_CASCADE_1_UID_LEN, RFAL_NFCA_CASCADE_2_UID_LEN, RFAL_NFCA_CASCADE_3_UID_LEN })[(rand() % 3)] : RFAL_NFCA_CASCADE_2_UID_LEN) );
+
+        for( j = 0; j < i; j++ )
+        {
+            if( (gPicc[j].uidLen == gPicc[i].uidLen) && (memcmp( gPicc[j].uid, gPicc[i].uid, gPicc[i].uidLen ) == 0) )
+            {
+                benchPiccInit( &gPicc[i], gPicc[i].uidLen );            /* Draw again, UIDs are unique */
+                j = UINT8_MAX;
+            }
+        }
+        gPicc[i].rssi = (uint16_t)(100U + i);
+    }
+
+    gShorts   = 0;
+    gSdds     = 0;
+    gSels     = 0;
+    gSlps     = 0;
+    gTimeouts = 0;
+    gTimeUs   = 0;
+}
+
+
+/*******************************************************************************/
+static bool benchRun( rfalComplianceMode compMode )
+{
+    static rfalNfcaListenDevice devList[BENCH_MAX_TAGS];
+    rfalNfcaSensRes             sensRes;
+    uint8_t                     devCnt;
+    uint8_t                     i;
+    uint8_t                     j;
+    bool                        found;
+
+    devCnt = 0;
+    (void)rfalNfcaPollerTechnologyDetection( compMode, &sensRes );
+
+    if( (rfalNfcaPollerFullCollisionResolution( compMode, gTagCnt, devList, &devCnt ) != ERR_NONE) || (devCnt != gTagCnt) )
+    {
+        return false;
+    }
+
+    for( i = 0; i < devCnt; i++ )
+    {
+        found = false;
+        for( j = 0; j < gTagCnt; j++ )
+        {
+            if( (gPicc[j].uidLen == devList[i].nfcId1Len) && (memcmp( gPicc[j].uid, devList[i].nfcId1, gPicc[j].uidLen ) == 0) )
+            {
+                found = (devList[i].rssi == gPicc[j].rssi);             /* RSSI taken as this PICC answered */
+            }
+        }
+
+        for( j = (i + 1U); j < devCnt; j++ )
+        {
+            if( (devList[i].nfcId1Len == devList[j].nfcId1Len) && (memcmp( devList[i].nfcId1, devList[j].nfcId1, devList[i].nfcId1Len ) == 0) )
+            {
+                found = false;
+            }
+        }
+
+        if( !found )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+/*******************************************************************************/
+int main( void )
+{
+    static const uint8_t sizes[] = { 1, 2, 4, 8, 16, 32, 64, 100 };
+    uint32_t             run;
+    uint32_t             frames;
+    uint32_t             sdds;
+    uint32_t             timeouts;
+    uint32_t             fails;
+    double               time;
+    uint8_t              s;
+    uint8_t              mixed;
+    uint8_t              mode;
+
+    printf( "%-5s %-6s %-9s %8s %8s %8s %10s %6s\r\n", "mode", "tags", "uids", "frames", "sdd_req", "timeouts", "time_ms", "fails" );
+
+    for( mode = 0; mode < 2U; mode++ )
+    {
+        for( s = 0; s < (sizeof(sizes) / sizeof(sizes[0])); s++ )
+        {
+            for( mixed = 0; mixed < 2U; mixed++ )
+            {
+                frames = 0; sdds = 0; timeouts = 0; fails = 0; time = 0;
+
+                for( run = 0; run < BENCH_RUNS; run++ )
+                {
+                    benchField( sizes[s], (mixed != 0U), ((run * 131U) + (sizes[s] * 7U) + mixed) );
+
+                    if( !benchRun( ((mode == 0U) ? RFAL_COMPLIANCE_MODE_NFC : RFAL_COMPLIANCE_MODE_ISO) ) )
+                    {
+                        fails++;
+                    }
+
+                    frames   += (gShorts + gSdds + gSels + gSlps);
+                    sdds     += gSdds;
+                    timeouts += gTimeouts;
+                    time     += gTimeUs;
+                }
+
+                printf( "%-5s %-6u %-9s %8u %8u %8u %10.1f %6u\r\n", ((mode == 0U) ? "NFC" : "ISO"), sizes[s], ((mixed != 0U) ? "4/7/10" : "7"),
+                        (frames / BENCH_RUNS), (sdds / BENCH_RUNS), (timeouts / BENCH_RUNS), ((time / BENCH_RUNS) / 1000.0), fails );
+            }
+        }
+    }
+
+    return 0;
+}
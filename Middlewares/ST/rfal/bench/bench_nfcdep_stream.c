@@ -0,0 +1,768 @@
+
+/******************************************************************************
+  * \attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2019 STMicroelectronics</center></h2>
+  *
+  * Licensed under ST MYLIBERTY SOFTWARE LICENSE AGREEMENT (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        www.st.com/myliberty
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied,
+  * AND SPECIFICALLY DISCLAIMING THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+******************************************************************************/
+
+/*
+ *      PROJECT:   ST25R391x firmware
+ *      Revision:
+ *      LANGUAGE:  ISO C99
+ */
+
+/*! \file bench_nfcdep_stream.c
+ *
+ *  \brief NFC-DEP PDU and Stream Transceive benchmark
+ *
+ *  Runs rfal_nfcDep.c on a PC, in Initiator role, against a simulated
+ *  NFC-DEP Target and exchanges PDUs through rfalNfcDepStartPduTransceive()
+ *  (up to RFAL_FEATURE_NFC_DEP_PDU_MAX_LEN) and through
+ *  rfalNfcDepStartStreamTransceive() (up to 20000 bytes), with and without
+ *  DID, with the Target announcing LR 254 or LR 128, and with 0, 5 and 15%
+ *  of the Target's frames received with a CRC error.
+ *
+ *  The Target checks every DEP_REQ: frame size against its FS, DID, PNI,
+ *  chained DEPs carrying the maximum payload and the request content.
+ *  It answers ACK/NACK/ATN as per Digital 1.1 16.12 and chains its
+ *  response on the Initiator's FS. The response is only written on the
+ *  Rx buffer once its status is polled, as done by the RF layer.
+ *  Each exchange checks the response content and length as received by
+ *  the caller, any mismatch or Target side violation counts as a fail.
+ *
+ *  Reported per configuration: exchanges, payload bytes both ways, frames
+ *  sent by the Initiator, NACKs sent, fails and the caller's buffer bytes
+ *  (Tx + Rx) needed by each API.
+ *
+ *  Build and run from this folder:
+ *    gcc -std=c99 -O2 -DRFAL_FEATURE_NFC_DEP=true -I. -I../Inc -I../../../../Drivers/BSP/Components/ST25R3911 \
+ *        bench_nfcdep_stream.c ../Src/rfal_nfcDep.c -o bench_nfcdep_stream
+ *    ./bench_nfcdep_stream
+ *
+ */
+
+/*
+ ******************************************************************************
+ * INCLUDES
+ ******************************************************************************
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "rfal_nfcDep.h"
+#include "rfal_nfcf.h"
+#include "rfal_rf.h"
+
+/*
+ ******************************************************************************
+ * LOCAL DEFINES
+ ******************************************************************************
+ */
+
+#define BENCH_RUNS              20U      /*!< Exchanges per PDU size                                    */
+#define BENCH_STREAM_MAX_LEN    20000U   /*!< Largest PDU exchanged through the Stream API              */
+#define BENCH_LOOP_MAX          1000000U /*!< Worker iterations before an exchange is declared stuck    */
+#define BENCH_ERR_MAX_CONSEC    2U       /*!< Consecutive CRC errors injected, below NFCIP's 3 NACKs    */
+
+#define BENCH_REQ               0xD4U    /*!< CMDType request                            Digital 1.1    */
+#define BENCH_RES               0xD5U    /*!< CMDType response                           Digital 1.1    */
+#define BENCH_CMD_ATR_REQ       0x00U    /*!< ATR_REQ                                    Digital 1.1    */
+#define BENCH_CMD_DEP_REQ       0x06U    /*!< DEP_REQ                                    Digital 1.1    */
+#define BENCH_CMD_DSL_REQ       0x08U    /*!< DSL_REQ                                    Digital 1.1    */
+#define BENCH_CMD_RLS_REQ       0x0AU    /*!< RLS_REQ                                    Digital 1.1    */
+#define BENCH_HDR_LEN           3U       /*!< CMDType CMD PFB                                           */
+#define BENCH_ATR_DID_POS       12U      /*!< DIDi on ATR_REQ: CMDType CMD NFCID3i(10)                  */
+#define BENCH_ATR_PP_POS        15U      /*!< PPi on ATR_REQ                                            */
+
+#define BENCH_PFB_TYPE_MASK     0xE0U    /*!< PFB: PDU type                                             */
+#define BENCH_PFB_I             0x00U    /*!< PFB: I-PDU                                                */
+#define BENCH_PFB_R             0x40U    /*!< PFB: R-PDU                                                */
+#define BENCH_PFB_S             0x80U    /*!< PFB: S-PDU                                                */
+#define BENCH_PFB_MI            0x10U    /*!< PFB: MI on I-PDU, NACK on R-PDU, RTOX on S-PDU            */
+#define BENCH_PFB_NAD           0x08U    /*!< PFB: NAD present                                          */
+#define BENCH_PFB_DID           0x04U    /*!< PFB: DID present                                          */
+#define BENCH_PFB_PNI           0x03U    /*!< PFB: PNI                                                  */
+
+#define benchLR2FS( lr )        (uint16_t)(((64U * ((uint16_t)(lr) + 1U)) > 254U) ? 254U : (64U * ((uint16_t)(lr) + 1U)))
+
+
+/*! Simulated NFC-DEP Target */
+typedef struct
+{
+    uint8_t   did;                       /*!< DID set on ATR_REQ, RFAL_NFCDEP_DID_NO if none    */
+    uint8_t   lr;                        /*!< LR announced on ATR_RES                           */
+    uint16_t  fsT;                       /*!< Target's FS: max DEP_REQ length                   */
+    uint16_t  fsI;                       /*!< Initiator's FS: max DEP_RES length                */
+    uint8_t   pni;                       /*!< PNI expected on the next DEP_REQ                  */
+    uint32_t  reqPos;                    /*!< Request bytes received                            */
+    uint32_t  rspPos;                    /*!< Response bytes sent                               */
+    bool      rspChaining;               /*!< Last I-PDU sent had MI set                        */
+    uint8_t   last[256];                 /*!< Last frame sent, LEN included                     */
+    uint16_t  lastLen;                   /*!< Last frame sent length                            */
+} benchTarget;
+
+
+/*
+ ******************************************************************************
+ * LOCAL VARIABLES
+ ******************************************************************************
+ */
+
+static benchTarget gTgt;                 /*!< Simulated Target                                  */
+
+static uint8_t    *gRxBuf;               /*!< Initiator's Rx buffer of the ongoing transceive   */
+static uint16_t    gRxBufLen;            /*!< Initiator's Rx buffer length                      */
+static uint16_t   *gRxLen;               /*!< Initiator's received length, in bits              */
+static uint8_t     gAir[256];            /*!< Target's frame on air                             */
+static uint16_t    gAirLen;              /*!< Target's frame length                             */
+static bool        gAirPending;          /*!< Target's frame not yet polled                     */
+
+static uint8_t     gErrPct;              /*!< CRC errors injected, in percent                   */
+static uint8_t     gErrConsec;           /*!< Consecutive CRC errors injected                   */
+
+static uint32_t    gReqLen;              /*!< Request length of the ongoing exchange            */
+static uint32_t    gRspLen;              /*!< Response length of the ongoing exchange           */
+static uint8_t     gReqSeed;             /*!< Request content seed                              */
+static uint8_t     gRspSeed;             /*!< Response content seed                             */
+static uint32_t    gTxPos;               /*!< Request bytes provided through txCb               */
+static uint32_t    gRxPos;               /*!< Response bytes consumed through rxCb              */
+static bool        gRxDone;              /*!< Last response DEP consumed through rxCb           */
+
+static uint32_t    gFrames;              /*!< Frames sent by the Initiator                      */
+static uint32_t    gNacks;               /*!< NACKs sent by the Initiator                       */
+static uint32_t    gViol;                /*!< Protocol or content violations                    */
+
+static rfalNfcDepPduBufFormat gPduTx;    /*!< PDU API Tx buffer                                 */
+static rfalNfcDepPduBufFormat gPduRx;    /*!< PDU API Rx buffer                                 */
+static rfalNfcDepBufFormat    gDepTx;    /*!< Stream API Tx buffer                              */
+static rfalNfcDepBufFormat    gDepRx;    /*!< Stream API Rx buffer                              */
+
+
+/*
+ ******************************************************************************
+ * SIMULATED TARGET
+ ******************************************************************************
+ */
+
+/*******************************************************************************/
+static uint8_t benchByte( uint8_t seed, uint32_t pos )
+{
+    return (uint8_t)((pos * 31U) + (pos >> 8U) + seed);
+}
+
+
+/*******************************************************************************/
+static uint8_t benchDidLen( void )
+{
+    return ((gTgt.did != RFAL_NFCDEP_DID_NO) ? 1U : 0U);
+}
+
+
+/*******************************************************************************/
+static void benchTargetSend( const uint8_t *frame, uint16_t len )
+{
+    gTgt.last[0] = (uint8_t)(len + 1U);                        /* LEN */
+    memcpy( &gTgt.last[1], frame, len );
+    gTgt.lastLen = (uint16_t)(len + 1U);
+
+    memcpy( gAir, gTgt.last, gTgt.lastLen );
+    gAirLen     = gTgt.lastLen;
+    gAirPending = true;
+}
+
+
+/*******************************************************************************/
+static void benchTargetResend( void )
+{
+    memcpy( gAir, gTgt.last, gTgt.lastLen );
+    gAirLen     = gTgt.lastLen;
+    gAirPending = true;
+}
+
+
+/*******************************************************************************/
+static void benchTargetSendDep( uint8_t pfb, const uint8_t *payl, uint16_t paylLen )
+{
+    uint8_t  f[255];
+    uint16_t i;
+
+    i      = 0;
+    f[i++] = BENCH_RES;
+    f[i++] = (uint8_t)(BENCH_CMD_DEP_REQ + 1U);
+    f[i++] = (uint8_t)(pfb | ((gTgt.did != RFAL_NFCDEP_DID_NO) ? BENCH_PFB_DID : 0U));
+    if( gTgt.did != RFAL_NFCDEP_DID_NO )
+    {
+        f[i++] = gTgt.did;
+    }
+    if( paylLen > 0U )
+    {
+        memcpy( &f[i], payl, paylLen );
+        i = (uint16_t)(i + paylLen);
+    }
+
+    if( i > gTgt.fsI )
+    {
+        gViol++;
+    }
+    benchTargetSend( f, i );
+}
+
+
+/*******************************************************************************/
+static void benchTargetSendRsp( void )
+{
+    uint8_t  payl[254];
+    uint16_t maxLen;
+    uint16_t n;
+    uint16_t i;
+
+    maxLen = (uint16_t)(gTgt.fsI - BENCH_HDR_LEN - benchDidLen());
+    n      = (uint16_t)(((gRspLen - gTgt.rspPos) > maxLen) ? maxLen : (gRspLen - gTgt.rspPos));
+
+    for( i = 0; i < n; i++ )
+    {
+        payl[i] = benchByte( gRspSeed, (gTgt.rspPos + i) );
+    }
+
+    gTgt.rspPos     += n;
+    gTgt.rspChaining = (gTgt.rspPos < gRspLen);
+
+    benchTargetSendDep( (uint8_t)(BENCH_PFB_I | gTgt.pni | (gTgt.rspChaining ? BENCH_PFB_MI : 0U)), payl, n );
+    gTgt.pni = (uint8_t)((gTgt.pni + 1U) & BENCH_PFB_PNI);
+}
+
+
+/*******************************************************************************/
+static void benchTargetAtr( const uint8_t *t, uint16_t len )
+{
+    uint8_t  f[17];
+    uint8_t  i;
+
+    if( len < (BENCH_ATR_PP_POS + 1U) )
+    {
+        gViol++;
+        return;
+    }
+
+    gTgt.did     = t[BENCH_ATR_DID_POS];
+    gTgt.fsI     = benchLR2FS( (t[BENCH_ATR_PP_POS] >> 4U) & 0x03U );
+    gTgt.fsT     = benchLR2FS( gTgt.lr );
+    gTgt.pni     = 0;
+    gTgt.lastLen = 0;
+
+    i      = 0;
+    f[i++] = BENCH_RES;
+    f[i++] = (uint8_t)(BENCH_CMD_ATR_REQ + 1U);
+    memset( &f[i], 0x5A, RFAL_NFCDEP_NFCID3_LEN );                 /* NFCID3t */
+    i      = (uint8_t)(i + RFAL_NFCDEP_NFCID3_LEN);
+    f[i++] = gTgt.did;                                             /* DIDt    */
+    f[i++] = 0x00;                                                 /* BSt     */
+    f[i++] = 0x00;                                                 /* BRt     */
+    f[i++] = 0x08;                                                 /* TO      */
+    f[i++] = (uint8_t)(gTgt.lr << 4U);                             /* PPt     */
+
+    benchTargetSend( f, i );
+}
+
+
+/*******************************************************************************/
+static void benchTargetDep( const uint8_t *t, uint16_t len )
+{
+    uint8_t  pfb;
+    uint8_t  pni;
+    uint16_t i;
+    uint16_t n;
+
+    pfb = t[2];
+    pni = (uint8_t)(pfb & BENCH_PFB_PNI);
+    i   = BENCH_HDR_LEN;
+
+    /* Frame size, DID and NAD  Digital 1.1 16.7, 16.8 */
+    if( (len > gTgt.fsT) || ((pfb & BENCH_PFB_NAD) != 0U) )
+    {
+        gViol++;
+    }
+    if( gTgt.did != RFAL_NFCDEP_DID_NO )
+    {
+        if( ((pfb & BENCH_PFB_DID) == 0U) || (t[i++] != gTgt.did) )
+        {
+            gViol++;
+        }
+    }
+    else if( (pfb & BENCH_PFB_DID) != 0U )
+    {
+        gViol++;
+    }
+    else
+    {
+        /* No DID */
+    }
+
+    switch( pfb & BENCH_PFB_TYPE_MASK )
+    {
+        /*******************************************************************************/
+        case BENCH_PFB_I:
+
+            /* Retransmitted I-PDU: the response was lost, send it again  Digital 1.1 16.12.4.4 */
+            if( (pni == ((gTgt.pni - 1U) & BENCH_PFB_PNI)) && (gTgt.lastLen != 0U) )
+            {
+                benchTargetResend();
+                return;
+            }
+            if( pni != gTgt.pni )
+            {
+                gViol++;
+            }
+
+            n = (uint16_t)(len - i);
+            for( ; i < len; i++ )
+            {
+                if( ((gTgt.reqPos >= gReqLen)) || (t[i] != benchByte( gReqSeed, gTgt.reqPos )) )
+                {
+                    gViol++;
+                }
+                gTgt.reqPos++;
+            }
+
+            if( (pfb & BENCH_PFB_MI) != 0U )
+            {
+                /* Chained DEP_REQ shall carry the maximum payload */
+                if( n != (uint16_t)(gTgt.fsT - BENCH_HDR_LEN - benchDidLen()) )
+                {
+                    gViol++;
+                }
+                benchTargetSendDep( (uint8_t)(BENCH_PFB_R | pni), NULL, 0 );
+                gTgt.pni = (uint8_t)((gTgt.pni + 1U) & BENCH_PFB_PNI);
+                return;
+            }
+
+            /* The response carries the PNI of the last DEP_REQ  Digital 1.1 16.12.3 */
+
+            if( gTgt.reqPos != gReqLen )
+            {
+                gViol++;
+            }
+            benchTargetSendRsp();
+            break;
+
+        /*******************************************************************************/
+        case BENCH_PFB_R:
+
+            if( (pfb & BENCH_PFB_MI) != 0U )
+            {
+                gNacks++;
+                benchTargetResend();
+            }
+            else if( gTgt.rspChaining && (pni == gTgt.pni) )
+            {
+                benchTargetSendRsp();
+            }
+            else if( pni == ((gTgt.pni - 1U) & BENCH_PFB_PNI) )
+            {
+                benchTargetResend();
+            }
+            else
+            {
+                gViol++;
+            }
+            break;
+
+        /*******************************************************************************/
+        case BENCH_PFB_S:
+
+            /* ATN is answered with ATN, RTOX is never requested */
+            if( (pfb & BENCH_PFB_MI) != 0U )
+            {
+                gViol++;
+                break;
+            }
+            benchTargetSendDep( BENCH_PFB_S, NULL, 0 );
+            break;
+
+        /*******************************************************************************/
+        default:
+            gViol++;
+            break;
+    }
+}
+
+
+/*******************************************************************************/
+static void benchTargetRx( const uint8_t *t, uint16_t len )
+{
+    uint8_t f[2];
+
+    if( (len < 2U) || (t[0] != BENCH_REQ) )
+    {
+        gViol++;
+        return;
+    }
+
+    switch( t[1] )
+    {
+        case BENCH_CMD_ATR_REQ:
+            benchTargetAtr( t, len );
+            break;
+
+        case BENCH_CMD_DEP_REQ:
+            if( len < BENCH_HDR_LEN )
+            {
+                gViol++;
+                break;
+            }
+            benchTargetDep( t, len );
+            break;
+
+        case BENCH_CMD_DSL_REQ:
+        case BENCH_CMD_RLS_REQ:
+            f[0] = BENCH_RES;
+            f[1] = (uint8_t)(t[1] + 1U);
+            benchTargetSend( f, sizeof(f) );
+            break;
+
+        default:
+            gViol++;
+            break;
+    }
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalTransceiveBlockingTx( uint8_t* txBuf, uint16_t txBufLen, uint8_t* rxBuf, uint16_t rxBufLen, uint16_t* actLen, uint32_t flags, uint32_t fwt )
+{
+    (void)flags;
+    (void)fwt;
+
+    gRxBuf      = rxBuf;
+    gRxBufLen   = rxBufLen;
+    gRxLen      = actLen;
+    gAirPending = false;
+
+    if( (txBuf != NULL) && (txBufLen > 0U) )
+    {
+        gFrames++;
+        benchTargetRx( txBuf, txBufLen );
+    }
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalGetTransceiveStatus( void )
+{
+    uint16_t len;
+
+    if( !gAirPending )
+    {
+        return ERR_TIMEOUT;
+    }
+    gAirPending = false;
+
+    len = ((gAirLen > gRxBufLen) ? gRxBufLen : gAirLen);
+    if( len != gAirLen )
+    {
+        gViol++;
+    }
+
+    /* Frame received with a CRC error: garbage on the buffer */
+    if( (gErrConsec < BENCH_ERR_MAX_CONSEC) && ((uint8_t)(rand() % 100) < gErrPct) )
+    {
+        gErrConsec++;
+        memset( gRxBuf, 0xEE, len );
+        *gRxLen = (uint16_t)(len * 8U);
+        return ERR_CRC;
+    }
+
+    gErrConsec = 0;
+    memcpy( gRxBuf, gAir, len );
+    *gRxLen = (uint16_t)(len * 8U);
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalTransceiveBlockingRx( void )
+{
+    return rfalGetTransceiveStatus();
+}
+
+
+/*******************************************************************************/
+/* Remaining RF services used by rfal_nfcDep.c, not exercised by the benchmark */
+void rfalWorker( void ) { }
+ReturnCode rfalSetMode( rfalMode mode, rfalBitRate txBR, rfalBitRate rxBR ) { (void)mode; (void)txBR; (void)rxBR; return ERR_NONE; }
+ReturnCode rfalSetBitRate( rfalBitRate txBR, rfalBitRate rxBR ) { (void)txBR; (void)rxBR; return ERR_NONE; }
+ReturnCode rfalGetBitRate( rfalBitRate *txBR, rfalBitRate *rxBR ) { *txBR = RFAL_BR_106; *rxBR = RFAL_BR_106; return ERR_NONE; }
+ReturnCode rfalNfcfPollerInitialize( rfalBitRate bitRate ) { (void)bitRate; return ERR_NONE; }
+
+
+/*
+ ******************************************************************************
+ * BENCHMARK
+ ******************************************************************************
+ */
+
+/*******************************************************************************/
+static bool benchStreamTx( uint8_t *payl, uint16_t paylMaxLen, uint16_t *paylLen )
+{
+    uint16_t n;
+    uint16_t i;
+
+    if( paylMaxLen != (uint16_t)(gTgt.fsT - BENCH_HDR_LEN - benchDidLen()) )
+    {
+        gViol++;
+    }
+
+    n = (uint16_t)(((gReqLen - gTxPos) > paylMaxLen) ? paylMaxLen : (gReqLen - gTxPos));
+    for( i = 0; i < n; i++ )
+    {
+        payl[i] = benchByte( gReqSeed, (gTxPos + i) );
+    }
+    gTxPos  += n;
+    *paylLen = n;
+
+    return (gTxPos < gReqLen);
+}
+
+
+/*******************************************************************************/
+static void benchStreamRx( const uint8_t *payl, uint16_t paylLen, bool isChaining )
+{
+    uint16_t i;
+
+    if( gRxDone || (isChaining && (paylLen != (uint16_t)(gTgt.fsI - BENCH_HDR_LEN - benchDidLen()))) )
+    {
+        gViol++;
+    }
+
+    for( i = 0; i < paylLen; i++ )
+    {
+        if( payl[i] != benchByte( gRspSeed, (gRxPos + i) ) )
+        {
+            gViol++;
+            break;
+        }
+    }
+    gRxPos += paylLen;
+    gRxDone = !isChaining;
+}
+
+
+/*******************************************************************************/
+static bool benchActivate( uint8_t did, uint8_t lr, rfalNfcDepDevice *dev )
+{
+    static uint8_t     nfcid3[RFAL_NFCDEP_NFCID3_LEN] = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A };
+    rfalNfcDepAtrParam param;
+    uint8_t            errPct;
+
+    memset( &gTgt, 0x00, sizeof(gTgt) );
+    gTgt.lr = lr;
+
+    memset( &param, 0x00, sizeof(param) );
+    param.commMode  = RFAL_NFCDEP_COMM_PASSIVE;
+    param.operParam = 0x00;
+    param.nfcid     = nfcid3;
+    param.nfcidLen  = RFAL_NFCDEP_NFCID3_LEN;
+    param.DID       = did;
+    param.NAD       = RFAL_NFCDEP_NAD_NO;
+    param.LR        = RFAL_NFCDEP_LR_254;
+
+    /* Activation is run on a clean link */
+    errPct  = gErrPct;
+    gErrPct = 0;
+
+    rfalNfcDepInitialize();
+    if( rfalNfcDepInitiatorHandleActivation( &param, RFAL_BR_106, dev ) != ERR_NONE )
+    {
+        gErrPct = errPct;
+        return false;
+    }
+
+    gErrPct = errPct;
+    return ((dev->info.FS == gTgt.fsT) && (dev->info.DID == did));
+}
+
+
+/*******************************************************************************/
+static bool benchExchange( const rfalNfcDepDevice *dev, bool stream, uint32_t reqLen, uint32_t rspLen, uint8_t seed )
+{
+    rfalNfcDepPduTxRxParam    pduParam;
+    rfalNfcDepStreamTxRxParam streamParam;
+    ReturnCode                ret;
+    uint32_t                  viol;
+    uint32_t                  loop;
+    uint16_t                  rxLen;
+    uint32_t                  i;
+
+    gReqLen     = reqLen;
+    gRspLen     = rspLen;
+    gReqSeed    = seed;
+    gRspSeed    = (uint8_t)~seed;
+    gTxPos      = 0;
+    gRxPos      = 0;
+    gRxDone     = false;
+    gTgt.reqPos = 0;
+    gTgt.rspPos = 0;
+    viol        = gViol;
+    rxLen       = 0;
+
+    if( stream )
+    {
+        streamParam.txBuf = &gDepTx;
+        streamParam.rxBuf = &gDepRx;
+        streamParam.txCb  = benchStreamTx;
+        streamParam.rxCb  = benchStreamRx;
+        streamParam.FWT   = dev->info.FWT;
+        streamParam.dFWT  = dev->info.dFWT;
+        streamParam.FSx   = dev->info.FS;
+        streamParam.DID   = dev->info.DID;
+
+        ret = rfalNfcDepStartStreamTransceive( &streamParam );
+    }
+    else
+    {
+        for( i = 0; i < reqLen; i++ )
+        {
+            gPduTx.pdu[i] = benchByte( gReqSeed, i );
+        }
+
+        pduParam.txBuf    = &gPduTx;
+        pduParam.txBufLen = (uint16_t)reqLen;
+        pduParam.rxBuf    = &gPduRx;
+        pduParam.rxLen    = &rxLen;
+        pduParam.FWT      = dev->info.FWT;
+        pduParam.dFWT     = dev->info.dFWT;
+        pduParam.FSx      = dev->info.FS;
+        pduParam.DID      = dev->info.DID;
+
+        ret = rfalNfcDepStartPduTransceive( pduParam );
+    }
+
+    for( loop = 0; (ret == ERR_NONE) && (loop < BENCH_LOOP_MAX); loop++ )
+    {
+        rfalWorker();
+        ret = (stream ? rfalNfcDepGetStreamTransceiveStatus() : rfalNfcDepGetPduTransceiveStatus());
+        if( ret != ERR_BUSY )
+        {
+            break;
+        }
+        ret = ERR_NONE;
+    }
+
+    if( ret != ERR_NONE )
+    {
+        return false;
+    }
+
+    if( stream )
+    {
+        return (gRxDone && (gRxPos == rspLen) && (gViol == viol));
+    }
+
+    if( rxLen != rspLen )
+    {
+        return false;
+    }
+    for( i = 0; i < rspLen; i++ )
+    {
+        if( gPduRx.pdu[i] != benchByte( gRspSeed, i ) )
+        {
+            return false;
+        }
+    }
+    return (gViol == viol);
+}
+
+
+/*******************************************************************************/
+int main( void )
+{
+    static const uint32_t sizes[]  = { 1, 100, 250, 251, 252, 300, 500, RFAL_FEATURE_NFC_DEP_PDU_MAX_LEN, 2000, 8192, BENCH_STREAM_MAX_LEN };
+    static const uint8_t  errPcts[] = { 0, 5, 15 };
+    static const uint8_t  lrs[]     = { RFAL_NFCDEP_LR_254, RFAL_NFCDEP_LR_128 };
+    rfalNfcDepDevice      dev;
+    uint32_t              xchg;
+    uint32_t              bytes;
+    uint32_t              fails;
+    uint32_t              rspLen;
+    uint32_t              run;
+    uint8_t               mode;
+    uint8_t               did;
+    uint8_t               l;
+    uint8_t               e;
+    uint8_t               s;
+
+    printf( "%-7s %-4s %-4s %-5s %8s %10s %8s %7s %6s %7s\r\n", "api", "did", "fsT", "err%", "xchg", "bytes", "frames", "nacks", "fails", "buf_B" );
+
+    for( mode = 0; mode < 2U; mode++ )
+    {
+        for( did = 0; did < 2U; did++ )
+        {
+            for( l = 0; l < sizeof(lrs); l++ )
+            {
+                for( e = 0; e < sizeof(errPcts); e++ )
+                {
+                    srand( (unsigned)((mode * 1000U) + (did * 100U) + (l * 10U) + e) );
+                    xchg = 0; bytes = 0; fails = 0; gFrames = 0; gNacks = 0; gViol = 0;
+                    gErrPct = errPcts[e]; gErrConsec = 0;
+
+                    if( !benchActivate( did, lrs[l], &dev ) )
+                    {
+                        printf( "activation failed\r\n" );
+                        return 1;
+                    }
+                    gFrames = 0;
+
+                    for( s = 0; s < (sizeof(sizes) / sizeof(sizes[0])); s++ )
+                    {
+                        /* PDU API is bound by RFAL_FEATURE_NFC_DEP_PDU_MAX_LEN */
+                        if( (mode == 0U) && (sizes[s] > RFAL_FEATURE_NFC_DEP_PDU_MAX_LEN) )
+                        {
+                            break;
+                        }
+
+                        for( run = 0; run < BENCH_RUNS; run++ )
+                        {
+                            rspLen = ((sizes[s] > (run % 3U)) ? (sizes[s] - (run % 3U)) : sizes[s]);
+
+                            if( !benchExchange( &dev, (mode != 0U), sizes[s], rspLen, (uint8_t)((run * 7U) + s) ) )
+                            {
+                                fails++;
+
+                                /* Resynchronise the link after a failed exchange */
+                                if( !benchActivate( did, lrs[l], &dev ) )
+                                {
+                                    printf( "activation failed\r\n" );
+                                    return 1;
+                                }
+                            }
+                            xchg++;
+                            bytes += (sizes[s] + rspLen);
+                        }
+                    }
+
+                    printf( "%-7s %-4s %-4u %-5u %8u %10u %8u %7u %6u %7u\r\n", ((mode == 0U) ? "pdu" : "stream"), ((did != 0U) ? "yes" : "no"),
+                            benchLR2FS( lrs[l] ), errPcts[e], xchg, bytes, gFrames, gNacks, fails,
+                            (unsigned)((mode == 0U) ? (2U * sizeof(rfalNfcDepPduBufFormat)) : (2U * sizeof(rfalNfcDepBufFormat))) );
+                }
+            }
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,479 @@
+
+/******************************************************************************
+  * \attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2019 STMicroelectronics</center></h2>
+  *
+  * Licensed under ST MYLIBERTY SOFTWARE LICENSE AGREEMENT (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        www.st.com/myliberty
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied,
+  * AND SPECIFICALLY DISCLAIMING THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+******************************************************************************/
+
+/*
+ *      PROJECT:   ST25R391x firmware
+ *      Revision:
+ *      LANGUAGE:  ISO C99
+ */
+
+/*! \file bench_nfcv_colres.c
+ *
+ *  \brief NFC-V Collision Resolution benchmark
+ *
+ *  Runs rfal_nfcv.c on a PC against a simulated field of 10 to 500 VICCs
+ *  and reports, per population, the INVENTORY_REQs, EOFs and SLPV_REQs
+ *  sent and the resulting airtime, averaged over several fields.
+ *
+ *  Three UID populations are simulated: random UIDs, UIDs of one
+ *  manufacturer sharing their 16 least significant bits (a common prefix
+ *  as the mask is built from the LSB, so the first 4 slot levels all
+ *  collide) and consecutive serial numbers (a reel).
+ *  Two scenarios are run on each:
+ *   - full: rfalNfcvPollerCollisionResolution() (ISO mode) with devLimit
+ *           the population, checking every UID is unique and carries the
+ *           RSSI of its own VICC. devLimit is at most 255: on larger
+ *           populations the resolution stops once 255 are found, these
+ *           rows are reported as "part" and are not full resolutions
+ *   - sleep: rfalNfcvPollerSleepCollisionResolution() with devLimit 255
+ *           repeated until no device answers, checking all went Quiet
+ *
+ *  Airtime is an estimate at 26.48 kbps (1 out of 4, single subcarrier):
+ *  frame durations plus FDTV,POLL, and the FDTV,INVENT_NORES timer
+ *  (RFAL_NFCV_FDT_V_INVENT_NORES) after every empty or collided slot.
+ *
+ *  Build and run from this folder:
+ *    gcc -std=c99 -O2 -I. -I../Inc -I../../../../Drivers/BSP/Components/ST25R3911 \
+ *        bench_nfcv_colres.c ../Src/rfal_nfcv.c -o bench_nfcv_colres
+ *    ./bench_nfcv_colres
+ *
+ */
+
+/*
+ ******************************************************************************
+ * INCLUDES
+ ******************************************************************************
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "rfal_nfcv.h"
+#include "rfal_rf.h"
+
+/*
+ ******************************************************************************
+ * LOCAL DEFINES
+ ******************************************************************************
+ */
+
+#define BENCH_MAX_TAGS          500U     /*!< Max simulated VICCs on the field                          */
+#define BENCH_RUNS              20U      /*!< Fields simulated per population                           */
+#define BENCH_SLEEP_PASSES      64U      /*!< Max sleep resolutions before giving up                    */
+
+#define BENCH_BYTE_US           302.08   /*!< VCD byte duration, 1 out of 4                 ISO15693-2  */
+#define BENCH_SOF_EOF_US        113.28   /*!< VCD SOF + EOF duration                        ISO15693-2  */
+#define BENCH_EOF_US            37.76    /*!< VCD EOF duration                              ISO15693-2  */
+#define BENCH_INVRES_US         3738.24  /*!< INVENTORY_RES with SOF/EOF, high data rate    ISO15693-2  */
+#define BENCH_T1_US             318.6    /*!< VICC response time t1 (4320/fc)               ISO15693-3  */
+#define BENCH_FDTPOLL_US        309.1    /*!< FDTV,POLL before the next command (4192/fc)   Digital 2.1 */
+#define BENCH_NORES_US          4000.0   /*!< RFAL_NFCV_FDT_V_INVENT_NORES timer                        */
+#define BENCH_CRC_LEN           2U       /*!< CRC appended by the ST25R391x                             */
+#define BENCH_INVRES_LEN        10U      /*!< INVENTORY_RES length without CRC                          */
+
+
+/*
+ ******************************************************************************
+ * LOCAL VARIABLES
+ ******************************************************************************
+ */
+
+static uint64_t gUid[BENCH_MAX_TAGS];    /*!< Simulated VICCs UIDs (byte 0 is the LSB)  */
+static bool     gQuiet[BENCH_MAX_TAGS];  /*!< Simulated VICCs put to Quiet              */
+static uint16_t gRssi;                   /*!< RSSI of the last INVENTORY_RES (VICC idx) */
+static uint16_t gTagCnt;                 /*!< Simulated VICCs on the field              */
+
+static uint8_t  gMaskLen;                /*!< Mask length of the current INVENTORY_REQ  */
+static uint64_t gMask;                   /*!< Mask of the current INVENTORY_REQ         */
+static bool     gOneSlot;                /*!< Current INVENTORY_REQ uses 1 slot         */
+static uint8_t  gSlot;                   /*!< Current slot                              */
+static uint8_t  *gRxBuf;                 /*!< Where the slot's reply is placed          */
+static uint16_t *gRxLen;                 /*!< Where the slot's reply length is placed   */
+static ReturnCode gSlotRet;              /*!< Outcome of the current slot               */
+
+static uint32_t gReqs;                   /*!< INVENTORY_REQs sent                       */
+static uint32_t gEofs;                   /*!< EOFs sent                                 */
+static uint32_t gSlpvs;                  /*!< SLPV_REQs sent                            */
+static double   gAirUs;                  /*!< Airtime spent (us)                        */
+
+
+/*
+ ******************************************************************************
+ * SIMULATED FIELD
+ ******************************************************************************
+ */
+
+/*******************************************************************************/
+static void benchSlot( void )
+{
+    uint16_t i;
+    uint16_t cnt;
+    uint16_t last;
+    uint8_t  b;
+    uint64_t m;
+
+    m    = ((gMaskLen >= 64U) ? UINT64_MAX : ((1ULL << gMaskLen) - 1ULL));
+    cnt  = 0;
+    last = 0;
+
+    for( i = 0; i < gTagCnt; i++ )
+    {
+        if( gQuiet[i] || ((gUid[i] & m) != gMask) )
+        {
+            continue;
+        }
+        if( !gOneSlot && ((uint8_t)((gUid[i] >> gMaskLen) & 0x0FU) != gSlot) )
+        {
+            continue;
+        }
+        cnt++;
+        last = i;
+    }
+
+    if( cnt == 0U )
+    {
+        *gRxLen   = 0;
+        gSlotRet  = ERR_TIMEOUT;
+        gAirUs   += (BENCH_T1_US + BENCH_NORES_US);
+    }
+    else if( cnt == 1U )
+    {
+        gRxBuf[0] = 0x00;                                  /* Flags */
+        gRxBuf[1] = 0x00;                                  /* DSFID */
+        for( b = 0; b < RFAL_NFCV_UID_LEN; b++ )
+        {
+            gRxBuf[2U + b] = (uint8_t)(gUid[last] >> (8U * b));
+        }
+        *gRxLen   = (uint16_t)rfalConvBytesToBits( BENCH_INVRES_LEN + RFAL_NFCV_CRC_LEN );
+        gSlotRet  = ERR_NONE;
+        gRssi     = last;
+        gAirUs   += (BENCH_T1_US + BENCH_INVRES_US + BENCH_FDTPOLL_US);
+    }
+    else
+    {
+        *gRxLen   = 20;                                    /* Partial frame */
+        gSlotRet  = ERR_RF_COLLISION;
+        gAirUs   += (BENCH_T1_US + BENCH_INVRES_US + BENCH_NORES_US);
+    }
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalISO15693StartTransceiveAnticollisionFrame( uint8_t *txBuf, uint8_t txBufLen, uint8_t *rxBuf, uint8_t rxBufLen, uint16_t *actLen )
+{
+    uint8_t b;
+
+    (void)rxBufLen;
+
+    gOneSlot = ((txBuf[0] & (uint8_t)RFAL_NFCV_REQ_FLAG_NB_SLOTS) != 0U);
+    gMaskLen = txBuf[2];
+    gMask    = 0;
+    for( b = 0; b < ((gMaskLen + 7U) / 8U); b++ )
+    {
+        gMask |= ((uint64_t)txBuf[3U + b] << (8U * b));
+    }
+
+    if( ((gMaskLen % 8U) != 0U) && ((txBuf[3U + (gMaskLen / 8U)] >> (gMaskLen % 8U)) != 0U) )
+    {
+        printf( "Mask with bits beyond its length\r\n" );
+        exit( 1 );
+    }
+
+    gReqs++;
+    gAirUs += (((double)txBufLen + BENCH_CRC_LEN) * BENCH_BYTE_US) + BENCH_SOF_EOF_US;
+
+    gSlot  = 0;
+    gRxBuf = rxBuf;
+    gRxLen = actLen;
+    benchSlot();
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalISO15693GetTransceiveAnticollisionFrameStatus( void )
+{
+    return gSlotRet;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalISO15693StartTransceiveEOFAnticollision( uint8_t *rxBuf, uint8_t rxBufLen, uint16_t *actLen )
+{
+    (void)rxBufLen;
+
+    gSlot++;
+    if( gSlot >= 16U )
+    {
+        printf( "EOF beyond the 16th slot\r\n" );
+        exit( 1 );
+    }
+
+    gEofs++;
+    gAirUs += BENCH_EOF_US;
+
+    gRxBuf = rxBuf;
+    gRxLen = actLen;
+    benchSlot();
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalStartTransceive( const rfalTransceiveContext *ctx )
+{
+    uint64_t uid;
+    uint16_t i;
+    uint8_t  b;
+
+    if( ctx->txBuf[1] != (uint8_t)RFAL_NFCV_CMD_SLPV )
+    {
+        printf( "Unexpected command\r\n" );
+        exit( 1 );
+    }
+
+    uid = 0;
+    for( b = 0; b < RFAL_NFCV_UID_LEN; b++ )
+    {
+        uid |= ((uint64_t)ctx->txBuf[2U + b] << (8U * b));
+    }
+
+    for( i = 0; i < gTagCnt; i++ )
+    {
+        if( gUid[i] == uid )
+        {
+            gQuiet[i] = true;
+        }
+    }
+
+    gSlpvs++;
+    gAirUs += (((double)rfalConvBitsToBytes(ctx->txBufLen) + BENCH_CRC_LEN) * BENCH_BYTE_US) + BENCH_SOF_EOF_US + BENCH_FDTPOLL_US;
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalGetTransceiveStatus( void )
+{
+    return ERR_TIMEOUT;                                     /* SLPV_REQ is not answered */
+}
+
+
+/*******************************************************************************/
+/* Remaining RF services used by rfal_nfcv.c, not exercised by the benchmark   */
+/*******************************************************************************/
+void rfalWorker( void ) { }
+void rfalSetErrorHandling( rfalEHandling eHandling ) { (void)eHandling; }
+void rfalSetGT( uint32_t GT ) { (void)GT; }
+void rfalSetFDTListen( uint32_t FDTListen ) { (void)FDTListen; }
+void rfalSetFDTPoll( uint32_t FDTPoll ) { (void)FDTPoll; }
+ReturnCode rfalSetMode( rfalMode mode, rfalBitRate txBR, rfalBitRate rxBR ) { (void)mode; (void)txBR; (void)rxBR; return ERR_NONE; }
+ReturnCode rfalGetBitRate( rfalBitRate *txBR, rfalBitRate *rxBR ) { (void)txBR; (void)rxBR; return ERR_NONE; }
+ReturnCode rfalSetBitRate( rfalBitRate txBR, rfalBitRate rxBR ) { (void)txBR; (void)rxBR; return ERR_NONE; }
+ReturnCode rfalISO15693TransceiveEOF( uint8_t *rxBuf, uint8_t rxBufLen, uint16_t *actLen ) { (void)rxBuf; (void)rxBufLen; (void)actLen; return ERR_TIMEOUT; }
+ReturnCode rfalGetTransceiveRSSI( uint16_t *rssi ) { *rssi = gRssi; return ERR_NONE; }
+ReturnCode rfalTransceiveBlockingTxRx( uint8_t *txBuf, uint16_t txBufLen, uint8_t *rxBuf, uint16_t rxBufLen, uint16_t *actLen, uint32_t flags, uint32_t fwt )
+{
+    (void)txBuf; (void)txBufLen; (void)rxBuf; (void)rxBufLen; (void)actLen; (void)flags; (void)fwt;
+    return ERR_TIMEOUT;
+}
+
+
+/*
+ ******************************************************************************
+ * BENCHMARK
+ ******************************************************************************
+ */
+
+/*******************************************************************************/
+static uint64_t benchRand64( void )
+{
+    return (((uint64_t)rand() << 42) ^ ((uint64_t)rand() << 21) ^ (uint64_t)rand());
+}
+
+
+/*******************************************************************************/
+static void benchField( uint16_t tagCnt, uint8_t pop, uint32_t seed )
+{
+    uint16_t i;
+    uint16_t j;
+    uint64_t base;
+
+    srand( seed );
+    gTagCnt = tagCnt;
+    base    = (benchRand64() & 0x000000FFFFFF0000ULL);
+
+    for( i = 0; i < tagCnt; i++ )
+    {
+        switch( pop )
+        {
+            case 0:  gUid[i] = benchRand64();                                                      break;  /* Random            */
+            case 1:  gUid[i] = (0xE002000000000000ULL | (benchRand64() & 0x0000FFFFFFFF0000ULL) | ((base >> 16) & 0xFFFFULL));  break;  /* Common prefix */
+            default: gUid[i] = (0xE002000000000000ULL | (base + i));                               break;  /* Consecutive serials */
+        }
+
+        for( j = 0; j < i; j++ )
+        {
+            if( gUid[j] == gUid[i] )
+            {
+                i--;                                                                           /* Draw again, UIDs are unique */
+                break;
+            }
+        }
+        gQuiet[i] = false;
+    }
+}
+
+
+/*******************************************************************************/
+static void benchReset( void )
+{
+    gReqs  = 0;
+    gEofs  = 0;
+    gSlpvs = 0;
+    gAirUs = 0;
+}
+
+
+/*******************************************************************************/
+static bool benchFull( uint16_t tagCnt )
+{
+    static rfalNfcvListenDevice devList[255];
+    uint8_t                     devCnt;
+    uint8_t                     devLimit;
+    uint16_t                    i;
+    uint16_t                    j;
+
+    devLimit = (uint8_t)((tagCnt > 255U) ? 255U : tagCnt);
+
+    if( (rfalNfcvPollerCollisionResolution( RFAL_COMPLIANCE_MODE_ISO, devLimit, devList, &devCnt ) != ERR_NONE) || (devCnt != devLimit) )
+    {
+        return false;
+    }
+
+    for( i = 0; i < devCnt; i++ )
+    {
+        for( j = 0; j < gTagCnt; j++ )
+        {
+            if( memcmp( devList[i].InvRes.UID, &gUid[j], RFAL_NFCV_UID_LEN ) == 0 )
+            {
+                break;
+            }
+        }
+        if( (j == gTagCnt) || (devList[i].rssi != j) )                                         /* RSSI taken as this VICC answered */
+        {
+            return false;
+        }
+        
+        for( j = (i + 1U); j < devCnt; j++ )
+        {
+            if( memcmp( devList[i].InvRes.UID, devList[j].InvRes.UID, RFAL_NFCV_UID_LEN ) == 0 )
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+
+/*******************************************************************************/
+static bool benchSleep( uint16_t tagCnt )
+{
+    static rfalNfcvListenDevice devList[255];
+    uint8_t                     devCnt;
+    uint16_t                    found;
+    uint16_t                    i;
+
+    found = 0;
+    for( i = 0; i < BENCH_SLEEP_PASSES; i++ )
+    {
+        if( rfalNfcvPollerSleepCollisionResolution( 255U, devList, &devCnt ) != ERR_NONE )
+        {
+            return false;
+        }
+        if( devCnt == 0U )
+        {
+            break;
+        }
+        found += devCnt;
+    }
+
+    for( i = 0; i < tagCnt; i++ )
+    {
+        if( !gQuiet[i] )
+        {
+            return false;
+        }
+    }
+    return (found == tagCnt);
+}
+
+
+/*******************************************************************************/
+int main( void )
+{
+    static const uint16_t sizes[] = { 10, 25, 50, 100, 200, 300, 500 };
+    static const char    *pops[]  = { "random", "prefix", "reel" };
+    uint32_t              run;
+    uint32_t              reqs;
+    uint32_t              eofs;
+    uint32_t              slpvs;
+    uint32_t              fails;
+    double                air;
+    uint8_t               s;
+    uint8_t               p;
+    uint8_t               scen;
+
+    printf( "%-6s %-8s %-6s %8s %8s %8s %10s %6s\r\n", "tags", "uids", "scen", "inv_req", "eof", "slpv_req", "air_ms", "fails" );
+
+    for( s = 0; s < (sizeof(sizes) / sizeof(sizes[0])); s++ )
+    {
+        for( p = 0; p < (sizeof(pops) / sizeof(pops[0])); p++ )
+        {
+            for( scen = 0; scen < 2U; scen++ )
+            {
+                reqs = 0; eofs = 0; slpvs = 0; fails = 0; air = 0;
+
+                for( run = 0; run < BENCH_RUNS; run++ )
+                {
+                    benchField( sizes[s], p, ((run * 7919U) + sizes[s]) );
+                    benchReset();
+
+                    if( !((scen == 0U) ? benchFull( sizes[s] ) : benchSleep( sizes[s] )) )
+                    {
+                        fails++;
+                    }
+
+                    reqs  += gReqs;
+                    eofs  += gEofs;
+                    slpvs += gSlpvs;
+                    air   += gAirUs;
+                }
+
+                printf( "%-6u %-8s %-6s %8u %8u %8u %10.1f %6u\r\n", sizes[s], pops[p], ((scen == 0U) ? ((sizes[s] > 255U) ? "part" : "full") : "sleep"),
+                        (reqs / BENCH_RUNS), (eofs / BENCH_RUNS), (slpvs / BENCH_RUNS), ((air / BENCH_RUNS) / 1000.0), fails );
+            }
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,100 @@
+
+/******************************************************************************
+  * \attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2019 STMicroelectronics</center></h2>
+  *
+  * Licensed under ST MYLIBERTY SOFTWARE LICENSE AGREEMENT (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        www.st.com/myliberty
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied,
+  * AND SPECIFICALLY DISCLAIMING THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+******************************************************************************/
+
+/*
+ *      PROJECT:   ST25R391x firmware
+ *      Revision:
+ *      LANGUAGE:  ISO C99
+ */
+
+/*! \file platform.h
+ *
+ *  \brief Host platform for the RFAL benchmarks
+ *
+ *  Lets a poller module be built on a PC against a simulated field, or
+ *  the LLCP/SNEP stack against a loopback peer (see the bench_*.c files).
+ *  Timers expire immediately, airtime is accounted by the simulated field
+ *  instead.
+ *
+ */
+
+#ifndef PLATFORM_H
+#define PLATFORM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <limits.h>
+#include <string.h>
+
+
+#define platformProtectST25R391xComm()
+#define platformUnprotectST25R391xComm()
+#define platformProtectST25R391xIrqStatus()
+#define platformUnprotectST25R391xIrqStatus()
+#define platformProtectWorker()
+#define platformUnprotectWorker()
+
+#define platformLedOff( port, pin )
+#define platformLedOn( port, pin )
+#define platformGpioSet( port, pin )
+#define platformGpioClear( port, pin )
+#define platformGpioIsHigh( port, pin )               (false)
+#define platformGpioIsLow( port, pin )                (true)
+
+#define platformTimerCreate( t )                      (0U)
+#define platformTimerIsExpired( timer )               (true)
+#define platformDelay( t )
+#define platformGetSysTick()                          (0U)
+
+#define platformLog(...)
+
+
+#define RFAL_FEATURE_LISTEN_MODE               false
+#define RFAL_FEATURE_WAKEUP_MODE               false
+#define RFAL_FEATURE_NFCA                      true
+#define RFAL_FEATURE_NFCB                      false
+#define RFAL_FEATURE_NFCF                      false
+#define RFAL_FEATURE_NFCV                      true
+#define RFAL_FEATURE_T1T                       false
+#define RFAL_FEATURE_T2T                       false
+#define RFAL_FEATURE_T4T                       false
+#define RFAL_FEATURE_ST25TB                    false
+#define RFAL_FEATURE_ST25xV                    false
+#define RFAL_FEATURE_DYNAMIC_ANALOG_CONFIG     false
+#define RFAL_FEATURE_DYNAMIC_POWER             false
+#define RFAL_FEATURE_ISO_DEP                   false
+#define RFAL_FEATURE_ISO_DEP_POLL              false
+#define RFAL_FEATURE_ISO_DEP_LISTEN            false
+#ifndef RFAL_FEATURE_NFC_DEP                                   /* -D to enable, see bench_nfcdep_stream.c */
+    #define RFAL_FEATURE_NFC_DEP               false
+#endif
+
+#define RFAL_FEATURE_LLCP                      true
+
+#define RFAL_FEATURE_ISO_DEP_IBLOCK_MAX_LEN    256U
+#define RFAL_FEATURE_ISO_DEP_APDU_MAX_LEN      1024U
+
+#ifndef RFAL_FEATURE_SNEP_NDEF_MAX_LEN                         /* -D to vary, with RFAL_FEATURE_LLCP_MIU/RW */
+    #define RFAL_FEATURE_SNEP_NDEF_MAX_LEN     1024U
+#endif
+
+#endif /* PLATFORM_H */
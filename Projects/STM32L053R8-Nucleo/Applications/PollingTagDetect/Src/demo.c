@@ -185,6 +185,7 @@ bool demoIni( void )
         discParam.devLimit      = 1U;
         discParam.nfcfBR        = RFAL_BR_212;
         discParam.ap2pBR        = RFAL_BR_424;
+        discParam.isoDepBRAuto  = true;
         
         ST_MEMCPY( &discParam.nfcid3, NFCID3, sizeof(NFCID3) );
         ST_MEMCPY( &discParam.GB, GB, sizeof(GB) );
@@ -404,7 +405,8 @@ static void demoCE( rfalNfcDevice *nfcDev )
     ReturnCode err;
     uint8_t *rxData;
     uint16_t *rcvLen;
-    uint8_t  txBuf[100];
+    uint8_t  *txBuf;
+    uint16_t txBufLen;
     uint16_t txLen;
     
     demoCeInit( ceNFCF_nfcid2 );
@@ -422,7 +424,14 @@ static void demoCE( rfalNfcDevice *nfcDev )
             case RFAL_NFC_STATE_DATAEXCHANGE:
             case RFAL_NFC_STATE_DATAEXCHANGE_DONE:
                 
-                txLen = ( (nfcDev->type == RFAL_NFC_POLL_TYPE_NFCA) ? demoCeT4T( rxData, *rcvLen, txBuf, sizeof(txBuf) ): demoCeT3T( rxData, *rcvLen, txBuf, sizeof(txBuf) ) );
+                /* Build the response in place on the Tx buffer of the active interface, it is not copied again */
+                err = rfalNfcDataExchangeGetTxBuffer( &txBuf, &txBufLen );
+                if( err != ERR_NONE )
+                {
+                    break;
+                }
+                
+                txLen = ( (nfcDev->type == RFAL_NFC_POLL_TYPE_NFCA) ? demoCeT4T( rxData, *rcvLen, txBuf, txBufLen ): demoCeT3T( rxData, *rcvLen, txBuf, txBufLen ) );
                 err   = demoTransceiveBlocking( txBuf, txLen, &rxData, &rcvLen, RFAL_FWT_NONE );
                 break;
             
@@ -175,6 +175,7 @@ static void LedNotificationWriteDone(void);
 #endif /* NDEF_FEATURE_ALL */
 
 static void demoP2P( void );
+static void demoIsoDepRelease( void );
 ReturnCode  demoTransceiveBlocking( uint8_t *txBuf, uint16_t txBufSize, uint8_t **rxBuf, uint16_t **rcvLen, uint32_t fwt );
 
 static void ledsOn(void);
@@ -259,6 +260,7 @@ bool demoIni( void )
         discParam.devLimit      = 1U;
         discParam.nfcfBR        = RFAL_BR_212;
         discParam.ap2pBR        = RFAL_BR_424;
+        discParam.isoDepBRAuto  = true;
 
         ST_MEMCPY( &discParam.nfcid3, NFCID3, sizeof(NFCID3) );
         ST_MEMCPY( &discParam.GB, GB, sizeof(GB) );
@@ -393,7 +395,7 @@ void demoCycle( void )
                             case RFAL_NFCA_T4T:
                                 platformLog("NFCA Passive ISO-DEP device found. UID: %s\r\n", hex2Str( nfcDevice->nfcid, nfcDevice->nfcidLen ) );
                                 demoNdef(nfcDevice);
-                                rfalIsoDepDeselect(); 
+                                demoIsoDepRelease();
                                 break;
                             
                             case RFAL_NFCA_T4T_NFCDEP:
@@ -432,7 +434,7 @@ void demoCycle( void )
                         if( rfalNfcbIsIsoDepSupported( &nfcDevice->dev.nfcb ) )
                         {
                             demoNdef(nfcDevice);
-                            rfalIsoDepDeselect();
+                            demoIsoDepRelease();
                         }
                         else
                         {
@@ -541,6 +543,31 @@ void demoCycle( void )
 }
 
 
+/*!
+ *****************************************************************************
+ * \brief Demo ISO-DEP Release
+ *
+ * Deselects the ISO-DEP device once the NDEF operations are done.
+ * If they left the link degraded, the device is deactivated through rfalNfc
+ * instead, which re-activates it one bit rate lower on the next discovery.
+ * The field is then off: the tag is found again right away.
+ * 
+ *****************************************************************************
+ */
+static void demoIsoDepRelease( void )
+{
+    if( rfalIsoDepPollIsBitRateDegraded() )
+    {
+        platformLog("ISO-DEP link degraded, next activation at a lower bit rate\r\n");
+        rfalNfcDeactivate( false );
+    }
+    else
+    {
+        rfalIsoDepDeselect();
+    }
+}
+
+
 /*!
  *****************************************************************************
  * \brief Demo P2P Exchange
@@ -97,6 +97,7 @@ uint8_t											devCnt = 0;//CL
 static void demoNfcv( rfalNfcvListenDevice *nfcvDev );
 
 static void demoNotif( rfalNfcState st );
+static void demoInvNotif( rfalNfcInvEvt evt, const rfalNfcInvEntry *entry );
 ReturnCode  demoTransceiveBlocking( uint8_t *txBuf, uint16_t txBufSize, uint8_t **rxBuf, uint16_t **rcvLen, uint32_t fwt );
 ReturnCode rfalNfcvPollerGetBlockSecurityStatus( uint8_t flags, const uint8_t* uid, uint8_t firstBlockNum, uint8_t numOfBlocks, uint8_t* rxBuf, uint16_t rxBufLen, uint16_t *rcvLen );
 
@@ -132,6 +133,30 @@ static void demoNotif( rfalNfcState st )
     }
 }
 
+/*!
+ *****************************************************************************
+ * \brief Demo Inventory Notification
+ *
+ *  This function receives the inventory arrival/departure events from RFAL
+ *****************************************************************************
+ */
+static void demoInvNotif( rfalNfcInvEvt evt, const rfalNfcInvEntry *entry )
+{
+    uint8_t devUID[RFAL_NFC_INV_UID_MAX_LEN];
+    
+    ST_MEMCPY( devUID, entry->uid, entry->uidLen );                                 /* Copy the UID into local var */
+    REVERSE_BYTES( devUID, entry->uidLen );                                         /* Reverse the UID for display purposes */
+    
+    if( evt == RFAL_NFC_INV_EVT_ARRIVAL )
+    {
+        platformLog("Tag arrived. UID: %s\r\n", hex2Str(devUID, entry->uidLen));
+    }
+    else
+    {
+        platformLog("Tag departed. UID: %s (present %u ms)\r\n", hex2Str(devUID, entry->uidLen), (unsigned int)(entry->lastSeen - entry->firstSeen));
+    }
+}
+
 /*!
  *****************************************************************************
  * \brief Demo Ini
@@ -156,7 +181,11 @@ bool demoIni( void )
         discParam.totalDuration        = 1000U;
         discParam.wakeupEnabled        = false;
         discParam.wakeupConfigDefault  = true;
-        discParam.techs2Find           = (  RFAL_NFC_POLL_TECH_V ); //CL: Poll olny T5T
+        discParam.techs2Find           = (  RFAL_NFC_POLL_TECH_V | RFAL_NFC_POLL_TECH_B ); //CL: Poll T5T and stacked NFC-B cards
+        discParam.nfcbAdaptiveColRes   = true;                   /* Size NFC-B slots on the number of cards estimated in the field */
+        discParam.invTtl               = 2000U;                  /* Tags not seen for 2s depart from the inventory */
+        discParam.invSkipHandled       = true;                   /* Do not re-read tags already read while present */
+        discParam.invCb                = demoInvNotif;
 	
         state = DEMO_ST_START_DISCOVERY;
         return true;
@@ -219,8 +248,11 @@ void demoCycle( void )
                 switch( nfcDevice->type )
                 {
                     /*******************************************************************************/
-
-                    /*******************************************************************************/
+                    case RFAL_NFC_LISTEN_TYPE_NFCB:
+                        
+                        platformLog("NFC-B card found. UID: %s\r\n", hex2Str(nfcDevice->nfcid, nfcDevice->nfcidLen));
+                        platformLedOn(PLATFORM_LED_B_PORT, PLATFORM_LED_B_PIN);
+                        break;
                               
                     /*******************************************************************************/
                     case RFAL_NFC_LISTEN_TYPE_NFCV:
@@ -404,7 +404,8 @@ static void demoCE( rfalNfcDevice *nfcDev )
     ReturnCode err;
     uint8_t *rxData;
     uint16_t *rcvLen;
-    uint8_t  txBuf[100];
+    uint8_t  *txBuf;
+    uint16_t txBufLen;
     uint16_t txLen;
     
     demoCeInit( ceNFCF_nfcid2 );
@@ -422,7 +423,14 @@ static void demoCE( rfalNfcDevice *nfcDev )
             case RFAL_NFC_STATE_DATAEXCHANGE:
             case RFAL_NFC_STATE_DATAEXCHANGE_DONE:
                 
-                txLen = ( (nfcDev->type == RFAL_NFC_POLL_TYPE_NFCA) ? demoCeT4T( rxData, *rcvLen, txBuf, sizeof(txBuf) ): demoCeT3T( rxData, *rcvLen, txBuf, sizeof(txBuf) ) );
+                /* Build the response in place on the Tx buffer of the active interface, it is not copied again */
+                err = rfalNfcDataExchangeGetTxBuffer( &txBuf, &txBufLen );
+                if( err != ERR_NONE )
+                {
+                    break;
+                }
+                
+                txLen = ( (nfcDev->type == RFAL_NFC_POLL_TYPE_NFCA) ? demoCeT4T( rxData, *rcvLen, txBuf, txBufLen ): demoCeT3T( rxData, *rcvLen, txBuf, txBufLen ) );
                 err   = demoTransceiveBlocking( txBuf, txLen, &rxData, &rcvLen, RFAL_FWT_NONE );
                 break;
             
@@ -44,6 +44,7 @@
 #include "rfal_rf.h"
 #include "rfal_nfca.h"
 #include "rfal_nfcf.h"
+#include "rfal_t4tCe.h"
 
 /** @addtogroup X-CUBE-NFC6_Applications
  *  @{
@@ -58,32 +59,11 @@
  */
 
 /* Private typedef -----------------------------------------------------------*/
-/** @defgroup CE_CardEmul_Private_Typedef 
- * @{
- */
-enum States
-{
-    STATE_IDLE                      = 0,    /*!< Emulated Tag state idle                  */
-    STATE_APP_SELECTED              = 1,    /*!< Emulated Tag state application selected  */
-    STATE_CC_SELECTED               = 2,    /*!< Emulated Tag state CCFile selected       */
-    STATE_FID_SELECTED              = 3,    /*!< Emulated Tag state FileID selected       */
-};
-/**
-  * @}
-  */ 
-
 /* Private define ------------------------------------------------------------*/
 /** @defgroup CE_CardEmul_Private_Define 
  * @{
  */
 
-#define NDEF_SIZE           0xFFFE    /*!< Max NDEF size emulated                          */
-#define T4T_CLA_00          0x00      /*!< CLA value for type 4 command                    */
-#define T4T_INS_SELECT      0xA4      /*!< INS value for select command                    */
-#define T4T_INS_READ        0xB0      /*!< INS value for reabbinary command                */
-#define T4T_INS_UPDATE      0xD6      /*!< INS value for update command                    */
-#define FID_CC              0xE103    /*!< File ID number for CCFile                       */
-#define FID_NDEF            0xE104    /*!< File ID number for NDEF file                    */
 #define T3T_BLOCK_SIZE      0x10      /*!< Block size in Type 3 Tag                        */
 /**
   * @}
@@ -96,37 +76,9 @@ enum States
  */
 static uint8_t        gNfcfNfcid[RFAL_NFCF_NFCID2_LEN];
 static uint8_t        ndefFile[2048];       /*!< Buffer to store NDEF File                 */
-static int8_t         nState = STATE_IDLE;  /*!< Type 4 tag emulation status               */
-static int32_t        nSelectedIdx = -1;    /*!< current file selected                     */
-static int32_t        nFiles = 2;           /*!< Number of file emulated                   */
-
-
-/**
-  * CCLEN : Indicates the size of this CC File <BR>
-  * T4T_VNo : Indicates the Mapping Version <BR>
-  * MLe high : Max R-APDU size <BR>
-  * MLc high : Max C-APDU size <BR>
-  * NDEF FCI T: Indicates the NDEF-File_Ctrl_TLV <BR>
-  * NDEF FCI L: The length of the V-field <BR>
-  * NDEF FCI V1: NDEF File Identifier <BR>
-  * NDEF FCI V2: NDEF File size <BR>
-  * NDEF FCI V3: NDEF Read AC <BR>
-  * NDEF FCI V4: NDEF Write AC <BR>
-  */
-static uint8_t ccfile[] = {
-                            0x00, 0x0F,                                       /* CCLEN      */
-                            0x20,                                             /* T4T_VNo    */
-                            0x00, 0x7F,                                       /* MLe        */
-                            0x00, 0x7F,                                       /* MLc        */
-                            0x04,                                             /* T          */
-                            0x06,                                             /* L          */
-                            (FID_NDEF & 0xFF00) >> 8, (FID_NDEF & 0x00FF),    /* V1         */
-                            (NDEF_SIZE & 0xFF00) >> 8, (NDEF_SIZE & 0x00FF),  /* V2         */
-                            0x00,                                             /* V3         */
-                            0x00                                              /* V4         */
-};
-
-static uint32_t pdwFileSize[] = {sizeof(ccfile), NDEF_SIZE};  /*!< Current emulated files size     */
+static rfalT4tCe      gCeT4t;               /*!< Type 4 tag emulation context              */
+static rfalT4tCeNdefImage gCeNdefImg;       /*!< Type 4 tag NDEF image of ndefFile         */
+static bool           gCeT4tInit = false;   /*!< Type 4 tag emulation context initialized  */
 
 /**
   * NDEF length <BR>
@@ -179,165 +131,6 @@ static uint8_t InformationBlock[] = { 0x10,
  * @{
  */
 
-/**
-  *****************************************************************************
-  * @brief  Compare 2 commands supplied in parameters
-  *
-  * @param[in]  cmd : pointer to the received command.
-  * @param[in]  find : pointer to the avalaible command.
-  * @param[in]  len : length of the available command.
-  *
-  * @retval True : Same command.
-  * @retval False : Different command.
-  *****************************************************************************
-  */
-static bool cmdCompare(uint8_t *cmd, uint8_t *find, uint16_t len)
-{
-  for(int i = 0; i < 20; i++)
-  {
-    if(!memcmp(&cmd[i],find, len))
-    {
-      return true;
-    }
-  }
-  return false;
-}
-
-/**
-  *****************************************************************************
-  * @brief  Manage the T4T Select answer to the reader
-  *
-  * @param[in]  cmdData : pointer to the received command.
-  * @param[out]  rspData : pointer to the answer to send.
-  *
-  * @return Answer size.
-  *****************************************************************************
-  */
-static uint16_t demoCeT4TSelect(uint8_t *cmdData, uint8_t *rspData)
-{
-  bool success = false;
-  /*
-   * Cmd: CLA(1) | INS(1) | P1(1) | P2(1) | Lc(1) | Data(n) | [Le(1)]
-   * Rsp: [FCI(n)] | SW12
-   *
-   * Select App by Name NDEF:       00 A4 04 00 07 D2 76 00 00 85 01 01 00
-   * Select App by Name NDEF 4 ST:  00 A4 04 00 07 A0 00 00 00 03 00 00 00
-   * Select CC FID:                 00 A4 00 0C 02 xx xx
-   * Select NDEF FID:               00 A4 00 0C 02 xx xx
-   */
-  
-  uint8_t aid[] = {0xD2, 0x76, 0x00, 0x00, 0x85, 0x01, 0x01};
-  uint8_t fidCC[] = {FID_CC >> 8 , FID_CC & 0xFF};
-  uint8_t fidNDEF[] = {FID_NDEF >> 8, FID_NDEF & 0xFF};
-  uint8_t selectFileId[] = {0xA4, 0x00, 0x0C, 0x02, 0x00, 0x01 };
-
-  if(cmdCompare( cmdData, aid, sizeof(aid)))
-  { /* Select Appli */
-      nState = STATE_APP_SELECTED;
-      success = true;
-  }
-  else if((nState >= STATE_APP_SELECTED) && cmdCompare(cmdData, fidCC, sizeof(fidCC)))
-  { /* Select CC */
-      nState = STATE_CC_SELECTED;
-      nSelectedIdx = 0;
-      success = true;
-  }
-  else if((nState >= STATE_APP_SELECTED) && (cmdCompare(cmdData,fidNDEF,sizeof(fidNDEF)) || cmdCompare(cmdData,selectFileId,sizeof(selectFileId))))
-  { /* Select NDEF */
-      nState = STATE_FID_SELECTED;
-      nSelectedIdx = 1;
-      success = true;
-  }
-  else
-  {
-      nState = STATE_IDLE;
-  }
-
-  rspData[0] = (success ? (char)0x90 : 0x6A);
-  rspData[1] = (success ? (char)0x00 : 0x82);
-  
-  return 2;
-}
-
-/**
-  *****************************************************************************
-  * @brief  Manage the T4T Read answer to the reader
-  *
-  * @param[in]  cmdData : pointer to the received command.
-  * @param[out]  rspData : pointer to the answer to send.
-  *
-  * @return Answer size.
-  *****************************************************************************
-  */
-static uint16_t demoCeT4TRead(uint8_t *cmdData, uint8_t *rspData)
-{
-  /*
-   * Cmd: CLA(1) | INS(1) | P1(1).. offset inside file high | P2(1).. offset inside file high | Le(1).. nBytes to read
-   * Rsp: BytesRead | SW12
-   */
-  unsigned short offset = (cmdData[2] << 8) | cmdData[3];
-  unsigned short toRead = cmdData[4];
-  uint8_t * ppbMemory;
-
-  /* Any file selected */
-  if(nSelectedIdx < 0 || nSelectedIdx >= nFiles)
-  {
-      rspData[0] = ((char)0x6A);
-      rspData[1] = ((char)0x82);
-      return 2;
-  }
-
-  /* offset + length exceed file size */
-  if((unsigned long)(offset + toRead) > pdwFileSize[nSelectedIdx])
-  {
-      toRead = pdwFileSize[nSelectedIdx] - offset;
-  }
-
-  ppbMemory = (nSelectedIdx == 0 ? ccfile : ndefFile);
-  /* read data */
-  memcpy(rspData, &ppbMemory[offset], toRead);
-
-  rspData[toRead] = ((char)0x90);
-  rspData[toRead+1] = ((char)0x00);
-  return toRead + 2;
-}
-
-/**
-  *****************************************************************************
-  * @brief  Manage the T4T Update answer to the reader
-  *
-  * @param[in]  cmdData : pointer to the received command.
-  * @param[in]  rspData : pointer to the answer to send.
-  *
-  * @return Answer size.
-  *****************************************************************************
-  */
-static uint16_t demoCeT4TUpdate(uint8_t *cmdData, uint8_t *rspData)
-{
-  uint32_t offset = (cmdData[2] << 8) | cmdData[3];
-  uint32_t length = cmdData[4];
-
-  if(nSelectedIdx != 1)
-  {
-    rspData[0] = ((char)0x6A);
-    rspData[1] = ((char)0x82);
-    return 2;
-  }
-
-  if((unsigned long)(offset + length) > pdwFileSize[nSelectedIdx])
-  {
-    rspData[0] = ((char)0x62);
-    rspData[1] = ((char)0x82);
-    return 2;
-  }
-
-  memcpy((ndefFile + offset), &cmdData[5], length);
-
-  rspData[0] = ((char)0x90);
-  rspData[1] = ((char)0x00);
-  return 2;
-}
-
 /**
   *****************************************************************************
   * @brief  Manage the T4T Read answer to the reader
@@ -548,11 +341,32 @@ static uint16_t demoCeT3TUpdate(uint8_t *cmdData, uint8_t *rspData)
 }
 
 
+/**
+  *****************************************************************************
+  * @brief  Demo CE T4T Initialize 
+  *
+  * Initializes the T4T emulation context once, serving ndefFile. Images 
+  * published later with demoCeSetNdefImage() are kept across sessions.
+  *
+  * @return None
+  *****************************************************************************
+  */
+static void demoCeT4tInit( void )
+{
+    if( !gCeT4tInit )
+    {
+        /* T4T serves ndefFile in place and lets the Reader update it */
+        rfalT4tCeNdefImageInit( &gCeNdefImg, ndefFile, ndefFile, sizeof(ndefFile) );
+        rfalT4tCeInitialize( &gCeT4t, &gCeNdefImg );
+        gCeT4tInit = true;
+    }
+}
+
 /**
   *****************************************************************************
   * @brief  Demo CE Initialize 
   *
-  * Initializes the demo CE 
+  * Initializes the demo CE for a new session
   *
   * @param[in]  nfcfNfcid : The NFCID to be used in T3T CE.
   *
@@ -563,6 +377,45 @@ void demoCeInit( uint8_t* nfcfNfcid )
 {
     ST_MEMCPY(gNfcfNfcid, nfcfNfcid, RFAL_NFCF_NFCID2_LEN );
     ST_MEMCPY(ndefFile, (uint8_t *)ndef_uri, sizeof(ndef_uri) );
+    
+    /* New session: nothing selected yet, the last image published is taken into use */
+    demoCeT4tInit();
+    rfalT4tCeDeactivate( &gCeT4t );
+}
+
+/**
+  *****************************************************************************
+  * @brief  Demo CE Set NDEF image
+  *
+  * Replaces the NDEF content emulated by T4T. It may be called while
+  * emulating, the Reader gets the new image from its next SELECT of the
+  * NDEF Tag Application on, or from the next session. The previous image
+  * shall be kept until demoCeGetNdefImage() returns img.
+  *
+  * @param[in]  img : NDEF image, see rfalT4tCeNdefImageInit().
+  *
+  * @return None
+  *****************************************************************************
+  */
+void demoCeSetNdefImage( const rfalT4tCeNdefImage *img )
+{
+    demoCeT4tInit();
+    rfalT4tCeSetNdefImage( &gCeT4t, img );
+}
+
+/**
+  *****************************************************************************
+  * @brief  Demo CE Get NDEF image
+  *
+  * Returns the NDEF image emulated by T4T. Once it returns the image last
+  * set with demoCeSetNdefImage(), the previous ones are released.
+  *
+  * @return NDEF image in use, NULL if none.
+  *****************************************************************************
+  */
+const rfalT4tCeNdefImage* demoCeGetNdefImage( void )
+{
+    return rfalT4tCeGetNdefImage( &gCeT4t );
 }
 
 /**
@@ -582,33 +435,14 @@ void demoCeInit( uint8_t* nfcfNfcid )
   */
 uint16_t demoCeT4T(uint8_t *rxData, uint16_t rxDataLen, uint8_t *txBuf, uint16_t txBufLen )
 {
-  if( (rxData == NULL) || (rxDataLen < 4) || (txBuf == NULL) || (txBufLen < 2) )
+  uint16_t txLen;
+  
+  if( rfalT4tCeProcessCApdu( &gCeT4t, rxData, rxDataLen, txBuf, txBufLen, &txLen ) != ERR_NONE )
   {
     return 0;
   }
-    
-  if(rxData[0] == T4T_CLA_00)
-  {
-      switch(rxData[1])
-      {
-          case T4T_INS_SELECT:
-              return demoCeT4TSelect(rxData, txBuf);
-
-          case T4T_INS_READ:
-              return demoCeT4TRead(rxData, txBuf);
-
-          case T4T_INS_UPDATE:
-              return demoCeT4TUpdate(rxData, txBuf);
-
-          default:
-              break;
-      }
-  }
-
-  /* Function not supported ...  */
-  txBuf[0] = ((char)0x68);
-  txBuf[1] = ((char)0x00);
-  return 2;
+  
+  return txLen;
 }
 
 /**
@@ -45,6 +45,7 @@
 #include "demo.h"
 #include "utils.h"
 #include "rfal_nfc.h"
+#include "rfal_snep.h"
 
 /*
 ******************************************************************************
@@ -62,6 +63,8 @@
 #define DEMO_NFCV_USE_SELECT_MODE     false /*!< NFCV demonstrate select mode        */
 #define DEMO_NFCV_WRITE_TAG           false /*!< NFCV demonstrate Write Single Block */
 
+#define DEMO_P2P_EXCHANGE_MAX         20U   /*!< P2P max LLCP exchanges to push NDEF */
+
 /*
  ******************************************************************************
  * GLOBAL MACROS
@@ -76,12 +79,14 @@
 
 /* P2P communication data */
 static uint8_t NFCID3[] = {0x01, 0xFE, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A};
-static uint8_t GB[] = {0x46, 0x66, 0x6d, 0x01, 0x01, 0x11, 0x02, 0x02, 0x07, 0x80, 0x03, 0x02, 0x00, 0x03, 0x04, 0x01, 0x32, 0x07, 0x01, 0x03};
-    
-/* P2P communication data */    
-static uint8_t ndefLLCPSYMM[] = {0x00, 0x00};
-static uint8_t ndefInit[] = {0x05, 0x20, 0x06, 0x0F, 0x75, 0x72, 0x6E, 0x3A, 0x6E, 0x66, 0x63, 0x3A, 0x73, 0x6E, 0x3A, 0x73, 0x6E, 0x65, 0x70, 0x02, 0x02, 0x07, 0x80, 0x05, 0x01, 0x02};
-static uint8_t ndefUriSTcom[] = {0x13, 0x20, 0x00, 0x10, 0x02, 0x00, 0x00, 0x00, 0x19, 0xc1, 0x01, 0x00, 0x00, 0x00, 0x12, 0x55, 0x00, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 0x73, 0x74, 0x2e, 0x63, 0x6f, 0x6d};
+
+/* NDEF message: URI record 'http://www.st.com' */
+static const uint8_t ndefUriSTcom[] = {0xc1, 0x01, 0x00, 0x00, 0x00, 0x12, 0x55, 0x00, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 0x73, 0x74, 0x2e, 0x63, 0x6f, 0x6d};
+
+/* LLCP link and SNEP client pushing the NDEF message */
+static rfalLlcpLink      llcpLink;
+static rfalSnep          snepClient;
+static rfalSnepBufFormat snepBuf;
 
 
   
@@ -99,9 +104,9 @@ static uint8_t              state = DEMO_ST_NOTINIT;
 ******************************************************************************
 */
 
-static void demoP2P( void );
+static void demoP2P( rfalNfcDevice *nfcDev );
 static void demoNotif( rfalNfcState st );
-ReturnCode  demoTransceiveBlocking( uint8_t *txBuf, uint16_t txBufSize, uint8_t **rxBuf, uint16_t **rcvLen, uint32_t fwt );
+ReturnCode  demoLlcpExchangeBlocking( rfalLlcpLink *link );
 
 
 
@@ -159,8 +164,10 @@ bool demoIni( void )
         discParam.ap2pBR        = RFAL_BR_106;	//CL:RFAL_BR_424; //Used typeA modulation 
         
         ST_MEMCPY( &discParam.nfcid3, NFCID3, sizeof(NFCID3) );
-        ST_MEMCPY( &discParam.GB, GB, sizeof(GB) );
-        discParam.GBLen         = sizeof(GB);
+
+        /* LLCP parameters announced on the ATR_REQ General Bytes */
+        rfalLlcpInitialize( &llcpLink );
+        discParam.GBLen         = rfalLlcpGetGeneralBytes( &llcpLink, discParam.GB );
 
         discParam.notifyCb             = demoNotif;
         discParam.totalDuration        = 1000U;
@@ -243,7 +250,7 @@ void demoCycle( void )
                             case RFAL_NFCA_NFCDEP:
                                 platformLog("NFCA Passive P2P device found. NFCID: %s\r\n", hex2Str( nfcDevice->nfcid, nfcDevice->nfcidLen ) );
                                 
-                                demoP2P();
+                                demoP2P( nfcDevice );
                                 break;
                                 
                             default:
@@ -260,7 +267,7 @@ void demoCycle( void )
                         platformLog("NFC Active P2P device found. NFCID3: %s\r\n", hex2Str(nfcDevice->nfcid, nfcDevice->nfcidLen));
                         platformLedOn(PLATFORM_LED_AP2P_PORT, PLATFORM_LED_AP2P_PIN);
                     
-                        demoP2P();
+                        demoP2P( nfcDevice );
                         break;
                     
                     /*******************************************************************************/
@@ -288,21 +295,21 @@ void demoCycle( void )
  *
  * Sends a NDEF URI record 'http://www.ST.com' via NFC-DEP (P2P) protocol.
  * 
- * This method sends a set of static predefined frames which tries to establish
- * a LLCP connection, followed by the NDEF record, and then keeps sending 
- * LLCP SYMM packets to maintain the connection.
+ * This method activates the LLCP link on the NFC-DEP device, pushes the NDEF
+ * record to the peer's default SNEP server with a SNEP Put, and then keeps 
+ * exchanging LLCP frames (SYMM) to maintain the connection.
  * 
+ * \param[in]  nfcDev     : activated NFC-DEP device
  * 
  *****************************************************************************
  */
-void demoP2P( void )
+static void demoP2P( rfalNfcDevice *nfcDev )
 {
-    uint16_t   *rxLen;
-    uint8_t    *rxData;
     ReturnCode err;
+    uint8_t    i;
 
     platformLog(" Initalize device .. ");
-    err = demoTransceiveBlocking( ndefInit, sizeof(ndefInit), &rxData, &rxLen, RFAL_FWT_NONE);
+    err = rfalLlcpActivate( &llcpLink, &nfcDev->proto.nfcDep, true );
     if( err != ERR_NONE )
     {
         platformLog("failed.");
@@ -311,7 +318,22 @@ void demoP2P( void )
     platformLog("succeeded.\r\n");
 
     platformLog(" Push NDEF Uri: www.ST.com .. ");
-    err = demoTransceiveBlocking( ndefUriSTcom, sizeof(ndefUriSTcom), &rxData, &rxLen, RFAL_FWT_NONE);
+    ST_MEMCPY( snepBuf.ndef, ndefUriSTcom, sizeof(ndefUriSTcom) );
+    err = rfalSnepClientPut( &snepClient, &llcpLink, &snepBuf, sizeof(ndefUriSTcom) );
+    if( err == ERR_NONE )
+    {
+        i = 0;
+        do{
+            err = demoLlcpExchangeBlocking( &llcpLink );
+            if( err == ERR_NONE )
+            {
+                err = rfalSnepClientGetStatus( &snepClient );
+            }
+            i++;
+        }
+        while( (err == ERR_BUSY) && (i < DEMO_P2P_EXCHANGE_MAX) );
+    }
+    
     if( err != ERR_NONE )
     {
         platformLog("failed.");
@@ -323,7 +345,7 @@ void demoP2P( void )
     platformLog(" Device present, maintaining connection ");
     while(err == ERR_NONE) 
     {
-        err = demoTransceiveBlocking( ndefLLCPSYMM, sizeof(ndefLLCPSYMM), &rxData, &rxLen, RFAL_FWT_NONE);
+        err = demoLlcpExchangeBlocking( &llcpLink );
         platformLog(".");
         platformDelay(50);
     }
@@ -333,9 +355,11 @@ void demoP2P( void )
 
 /*!
  *****************************************************************************
- * \brief Demo Blocking Transceive 
+ * \brief Demo Blocking LLCP Exchange 
  *
- * Helper function to send data in a blocking manner via the rfalNfc module 
+ * Helper function to exchange a LLCP frame in a blocking manner: sends the
+ * pending PDUs (or a SYMM) and processes the frame received from the peer.
+ * NFC-DEP chaining is handled by the LLCP module
  *  
  * \warning A protocol transceive handles long timeouts (several seconds), 
  * transmission errors and retransmissions which may lead to a long period of 
@@ -343,32 +367,27 @@ void demoP2P( void )
  * This is a demo implementation, for a non-blocking usage example please 
  * refer to the Examples available with RFAL
  *
- * \param[in]  txBuf      : data to be transmitted
- * \param[in]  txBufSize  : size of the data to be transmited
- * \param[out] rxData     : location where the received data has been placed
- * \param[out] rcvLen     : number of data bytes received
- * \param[in]  fwt        : FWT to be used (only for RF frame interface, 
- *                                          otherwise use RFAL_FWT_NONE)
+ * \param[in]  link       : activated LLCP link
  *
  * 
- *  \return ERR_PARAM     : Invalid parameters
- *  \return ERR_TIMEOUT   : Timeout error
- *  \return ERR_FRAMING   : Framing error detected
- *  \return ERR_PROTO     : Protocol error detected
- *  \return ERR_NONE      : No error, activation successful
+ *  \return ERR_TIMEOUT     : Timeout error
+ *  \return ERR_FRAMING     : Framing error detected
+ *  \return ERR_PROTO       : Protocol error detected
+ *  \return ERR_RELEASE_REQ : LLCP link deactivated by the peer
+ *  \return ERR_NONE        : No error, frame exchanged
  * 
  *****************************************************************************
  */
-ReturnCode demoTransceiveBlocking( uint8_t *txBuf, uint16_t txBufSize, uint8_t **rxData, uint16_t **rcvLen, uint32_t fwt )
+ReturnCode demoLlcpExchangeBlocking( rfalLlcpLink *link )
 {
     ReturnCode err;
     
-    err = rfalNfcDataExchangeStart( txBuf, txBufSize, rxData, rcvLen, fwt );
+    err = rfalLlcpStartExchange( link );
     if( err == ERR_NONE )
     {
         do{
             rfalNfcWorker();
-            err = rfalNfcDataExchangeGetStatus();
+            err = rfalLlcpGetExchangeStatus( link );
         }
         while( err == ERR_BUSY );
     }
@@ -58,6 +58,9 @@
 #define DEMO_ST_START_DISCOVERY       1     /*!< Demo State:  Start Discovery        */
 #define DEMO_ST_DISCOVERY             2     /*!< Demo State:  Discovery              */
 
+#define DEMO_NFCF_INV_MAX_DEVICES     10U   /*!< Max NFC-F devices on the inventory  */
+#define DEMO_NFCF_INV_CONFIDENCE      99U   /*!< Inventory completeness confidence % */
+
 
 /*
  ******************************************************************************
@@ -81,6 +84,10 @@ static rfalNfcDiscoverParam discParam;
 static uint8_t              state = DEMO_ST_NOTINIT;
 static uint8_t							devCnt = 0; //CL RFAL_NFC_MAX_DEVICES to be changed
 //static rfalNfcDevice *nfcDevice;
+
+/*! System Codes swept by the inventory: any, NDEF (T3T 1.0 7.1) and FeliCa Lite-S */
+static const uint16_t       demoNfcfSysCodes[] = { RFAL_NFCF_SYSTEMCODE, 0x12FCU, 0x88B4U };
+static rfalNfcfListenDevice demoNfcfDevList[DEMO_NFCF_INV_MAX_DEVICES];
 /*
 ******************************************************************************
 * LOCAL FUNCTION PROTOTYPES
@@ -219,21 +226,27 @@ void demoCycle( void )
                  
                     /*******************************************************************************/
                     case RFAL_NFC_LISTEN_TYPE_NFCF:
-                        
                     {
-     
-											platformLog("Felica/NFC-F card found. Tags : %s\r\n", hex2Str(&devCnt, 1));											
-											for(uint8_t i=0; i<devCnt; i++)
-											{	
-												platformLog("Felica/NFC-F card no.%d found. UID: %s\r\n",i+1, hex2Str( nfcDevice->dev.nfcf.sensfRes.NFCID2, RFAL_NFCF_NFCID2_LEN));
-											
-												platformLedOn(PLATFORM_LED_F_PORT, PLATFORM_LED_F_PIN);
-												
-												demoNfcf( &nfcDevice->dev.nfcf );
-												nfcDevice++;
-											}
-										 	devCnt = 1 ;
-                   }
+                        ReturnCode err;
+                        uint8_t    i;
+                        
+                        platformLedOn(PLATFORM_LED_F_PORT, PLATFORM_LED_F_PIN);
+                        
+                        /* A single SENSF_REQ misses the cards whose responses collided, run a multi-round inventory */
+                        err = rfalNfcfPollerInventory( demoNfcfSysCodes, (uint8_t)(sizeof(demoNfcfSysCodes)/sizeof(demoNfcfSysCodes[0])), DEMO_NFCF_INV_CONFIDENCE, DEMO_NFCF_INV_MAX_DEVICES, demoNfcfDevList, &devCnt );
+                        if( err != ERR_NONE )
+                        {
+                            platformLog("Felica/NFC-F inventory failed: %d\r\n", err);
+                            break;
+                        }
+                        
+                        platformLog("Felica/NFC-F cards found: %d\r\n", devCnt);
+                        for( i = 0; i < devCnt; i++ )
+                        {
+                            platformLog("Felica/NFC-F card no.%d found. UID: %s\r\n", (i + 1U), hex2Str( demoNfcfDevList[i].sensfRes.NFCID2, RFAL_NFCF_NFCID2_LEN ));
+                            demoNfcf( &demoNfcfDevList[i] );
+                        }
+                    }
                         break;
  
                     
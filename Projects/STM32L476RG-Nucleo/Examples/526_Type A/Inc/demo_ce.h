@@ -47,6 +47,7 @@
    
 /* Includes ------------------------------------------------------------------*/
 #include "platform.h"
+#include "rfal_t4tCe.h"
 
 /** @addtogroup X-CUBE-NFC6_Applications
  *  @brief Sample applications for X-NUCLEO-NFC06A1 STM32 expansion boards.
@@ -99,6 +100,8 @@
 void     demoCeInit(uint8_t* nfcfNfcid);
 uint16_t demoCeT3T(uint8_t *rxData, uint16_t rxDataLen, uint8_t *txBuf, uint16_t txBufLen );
 uint16_t demoCeT4T(uint8_t *rxData, uint16_t rxDataLen, uint8_t *txBuf, uint16_t txBufLen );
+void     demoCeSetNdefImage(const rfalT4tCeNdefImage *img);
+const rfalT4tCeNdefImage* demoCeGetNdefImage(void);
 
 
 